@@ -37,6 +37,9 @@
 /* Define to 1 if you have the <sys/times.h> header file. */
 #cmakedefine HAVE_SYS_TIMES_H 1
 
+/* Define to 1 if you have the <sys/resource.h> header file. */
+#cmakedefine HAVE_SYS_RESOURCE_H 1
+
 /* Define to 1 if you have the `cfmakeraw' function. */
 #cmakedefine HAVE_CFMAKERAW 1
 
@@ -49,6 +52,9 @@
 /* Define to 1 if you have unix domain sockets */
 #cmakedefine HAVE_UNIX_DOMAIN_SOCKETS 1
 
+/* Define to 1 if you have internet domain sockets */
+#cmakedefine HAVE_INET_SOCKETS 1
+
 /* Define to 1 if you have the 'posix_memalign' function. */
 #cmakedefine HAVE_POSIX_MEMALIGN 1
 
@@ -61,6 +67,9 @@
 /* Define to 1 if you have the 'nanosleep' function. */
 #cmakedefine HAVE_NANOSLEEP 1
 
+/* Define to 1 if you have the 'clock_nanosleep' function. */
+#cmakedefine HAVE_CLOCK_NANOSLEEP 1
+
 /* Define to 1 if you have the 'alphasort' function. */
 #cmakedefine HAVE_ALPHASORT 1
 
@@ -79,9 +88,15 @@
 /* Define to 1 if you have the 'flock' function. */
 #cmakedefine HAVE_FLOCK 1
 
+/* Define to 1 if you have the 'mmap' function. */
+#cmakedefine HAVE_MMAP 1
+
 /* Define to 1 if you have the 'd_type' member in the 'dirent' struct */
 #cmakedefine HAVE_DIRENT_D_TYPE 1
 
+/* Define to 1 if you have the <pthread.h> header file. */
+#cmakedefine HAVE_PTHREAD_H 1
+
 /* Relative path from bindir to datadir */
 #define BIN2DATADIR "@BIN2DATADIR@"
 
@@ -94,5 +109,11 @@
 /* Define to 1 to use less memory - at the expense of emulation speed */
 #cmakedefine ENABLE_SMALL_MEM 1
 
+/* Define to 1 to dispatch opcodes through a 16-bit handler index table */
+#cmakedefine ENABLE_COMPACT_DISPATCH 1
+
+/* Define to 1 to compute the STE bass/treble filter in fixed point */
+#cmakedefine ENABLE_LMC_FIXED_POINT 1
+
 /* Define to 1 to enable trace logs - undefine to slightly increase speed */
 #cmakedefine ENABLE_TRACING 1
@@ -8,7 +8,7 @@
 #include "main.h"
 #include "screen.h"
 
-extern unsigned char savbkg[1024*1024*2];
+extern unsigned char *savbkg;
 
 typedef struct                       /**** BMP file header structure ****/
 {
@@ -165,6 +165,9 @@ int SDL_SaveBMP(SDL_Surface *surface,const char *file){
    unsigned short int temp;
 
 
+   if (!savbkg)
+      return (-1);
+
    /* Try opening the file; use "wb" mode to write this *binary* file. */
    if ((fp = fopen(file, "wb")) == NULL){
       printf("openfile faided %s\n",file);
@@ -204,11 +207,21 @@ int SDL_SaveBMP(SDL_Surface *surface,const char *file){
    // RGB565 to bgr
 
    unsigned short int *ptr=(unsigned short int*)&savbkg[0];
+   unsigned int *ptr32=(unsigned int*)&savbkg[0];
 
    short R8, G8 , B8 ;
 
    for (i = 0; i < retrow * retroh; i++)
    {
+      if (retro_pixel_bytes == 4)
+      {
+         // XRGB8888 to bgr
+         pixels[(i*3)+0]= ptr32[i]&0xff;
+         pixels[(i*3)+1]= (ptr32[i]>>8)&0xff;
+         pixels[(i*3)+2]= (ptr32[i]>>16)&0xff;
+         continue;
+      }
+
       temp = (unsigned short  int) (*ptr)&0xffff;
 
 #define R5 ((temp>>11)&0x1F)
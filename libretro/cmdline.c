@@ -14,8 +14,9 @@ void parse_cmdline( const char *argv );
 
 // Global variables
 extern bool hatari_fastfdc;
+extern bool hatari_turbofdc;
 extern bool hatari_borders;
-extern char hatari_frameskips[2];
+extern char hatari_frameskips[3];
 
 void Add_Option(const char* option)
 {
@@ -52,6 +53,8 @@ int pre_main(const char *argv)
       Add_Option("0");
       Add_Option("--fastfdc");
       Add_Option(hatari_fastfdc==true?"1":"0");
+      Add_Option("--turbofdc");
+      Add_Option(hatari_turbofdc==true?"1":"0");
       Add_Option("--borders");
       Add_Option(hatari_borders==true?"1":"0");
       Add_Option("--frameskips");
@@ -2,50 +2,75 @@
 #include <stdlib.h>
 #include <stdarg.h>
 #include <math.h>
+#include <string.h>
+#include <stdbool.h>
 
 #include "graph.h"
 
+// Overlays are drawn in the pixel format given to the frontend
+static inline void PutPixel(unsigned short *buffer, int idx, unsigned short color)
+{
+   if (retro_pixel_bytes == 4)
+      ((unsigned int *)buffer)[idx] = RGB565_TO_XRGB8888(color);
+   else
+      buffer[idx] = color;
+}
+
 void DrawPointBmp(unsigned short *buffer,int x, int y, unsigned short color)
 {
    int idx;
 
    idx=x+y*VIRTUAL_WIDTH;
-   buffer[idx]=color;	
+   PutPixel(buffer,idx,color);	
 }
 
-void DrawFBoxBmp(unsigned short *buffer,int x,int y,int dx,int dy,unsigned short color)
+// Fill n pixels from idx on, the row loops are simple enough for the
+// compiler to vectorise them
+static inline void FillSpan(unsigned short *buffer, int idx, int n, unsigned short color)
 {
-   int i,j,idx;
+   int i;
 
-   for(i=x;i<x+dx;i++)
+   if (retro_pixel_bytes == 4)
    {
-      for(j=y;j<y+dy;j++)
-      {
-         idx=i+j*VIRTUAL_WIDTH;
-         buffer[idx]=color;	
-      }
+      unsigned int *p = (unsigned int *)buffer + idx;
+      unsigned int c = RGB565_TO_XRGB8888(color);
+      for (i = 0; i < n; i++)
+         p[i] = c;
+   }
+   else if ((color >> 8) == (color & 0xff))
+   {
+      if (n > 0)
+         memset(buffer + idx, color & 0xff, n * sizeof(*buffer));
    }
+   else
+   {
+      unsigned short *p = buffer + idx;
+      for (i = 0; i < n; i++)
+         p[i] = color;
+   }
+}
 
+void DrawFBoxBmp(unsigned short *buffer,int x,int y,int dx,int dy,unsigned short color)
+{
+   int j;
+
+   for(j=y;j<y+dy;j++)
+      FillSpan(buffer,x+j*VIRTUAL_WIDTH,dx,color);
 }
 
 void DrawBoxBmp(unsigned short  *buffer,int x,int y,int dx,int dy,unsigned short  color)
 {
-   int i,j,idx;
+   int j,idx;
 
-   for(i=x;i<x+dx;i++)
-   {
-      idx=i+y*VIRTUAL_WIDTH;
-      buffer[idx]=color;
-      idx=i+(y+dy)*VIRTUAL_WIDTH;
-      buffer[idx]=color;
-   }
+   FillSpan(buffer,x+y*VIRTUAL_WIDTH,dx,color);
+   FillSpan(buffer,x+(y+dy)*VIRTUAL_WIDTH,dx,color);
 
    for(j=y;j<y+dy;j++)
    {
       idx=x+j*VIRTUAL_WIDTH;
-      buffer[idx]=color;	
+      PutPixel(buffer,idx,color);	
       idx=(x+dx)+j*VIRTUAL_WIDTH;
-      buffer[idx]=color;	
+      PutPixel(buffer,idx,color);	
    }
 
 }
@@ -53,13 +78,7 @@ void DrawBoxBmp(unsigned short  *buffer,int x,int y,int dx,int dy,unsigned short
 
 void DrawHlineBmp(unsigned short  *buffer,int x,int y,int dx,int dy,unsigned short  color)
 {
-	int i,j,idx;
-		
-	for(i=x;i<x+dx;i++)
-   {
-		idx=i+y*VIRTUAL_WIDTH;
-		buffer[idx]=color;		
-	}
+	FillSpan(buffer,x+y*VIRTUAL_WIDTH,dx,color);
 }
 
 void DrawVlineBmp(unsigned short *buffer,int x,int y,int dx,int dy,unsigned short  color)
@@ -69,7 +88,7 @@ void DrawVlineBmp(unsigned short *buffer,int x,int y,int dx,int dy,unsigned shor
 	for(j=y;j<y+dy;j++)
    {
 		idx=x+j*VIRTUAL_WIDTH;
-		buffer[idx]=color;		
+		PutPixel(buffer,idx,color);		
 	}	
 }
 
@@ -91,7 +110,7 @@ void DrawlineBmp(unsigned short *buffer,int x1,int y1,int x2,int y2,unsigned sho
       else
       {
          idx=x1+y1*VIRTUAL_WIDTH;
-         buffer[idx]=color;
+         PutPixel(buffer,idx,color);
       }
       return;
    }
@@ -131,7 +150,7 @@ void DrawlineBmp(unsigned short *buffer,int x1,int y1,int x2,int y2,unsigned sho
 
    for (; x < dx; x++, idx +=pixx)
    {
-      buffer[idx]=color;
+      PutPixel(buffer,idx,color);
       y += dy;
       if (y >= dx)
       {
@@ -158,60 +177,61 @@ void DrawCircle(unsigned short *buf,int x, int y, int radius,unsigned short rgba
       if (full)
          DrawlineBmp(buf,x,y, x1,y1,rgba); 
       else
-         buf[x1+y1*VIRTUAL_WIDTH]=rgba;
+         PutPixel(buf,x1+y1*VIRTUAL_WIDTH,rgba);
    }
 
 }
 
 #include "font2.c"
 
+// Text is drawn straight from the font rows: each glyph pixel is a span
+// of xscale pixels, only spans of non-zero colour are drawn. When both
+// colours are drawn, the first row of each scaled glyph row is copied to
+// the yscale-1 others.
 void Draw_string(unsigned short *surf, signed short int x, signed short int y, 
       const unsigned char *string,unsigned short maxstrlen,unsigned short xscale,
       unsigned short yscale, unsigned short fg, unsigned short bg)
 {
-   int k,strlen, col, bit, xrepeat, yrepeat, surfw, surfh;
-   unsigned char *linesurf, b;
+   int strlen, col, bit, yrepeat, surfw, idx;
+   unsigned char b;
    signed short int ypixel;
-   unsigned short *yptr; 
+   bool opaque = fg != 0 && bg != 0;
 
    if(string == NULL)
       return;
    for(strlen = 0; strlen<maxstrlen && string[strlen]; strlen++) {}
 
    surfw=strlen * 7 * xscale;
-   surfh=8 * yscale;
-
-   linesurf = (unsigned char*)malloc(sizeof(unsigned short)*surfw*surfh );
-
-   yptr = (unsigned short *)&linesurf[0];
+   if (surfw == 0)
+      return;
 
    for(ypixel = 0; ypixel<8; ypixel++)
    {
-      for(col=0; col<strlen; col++)
+      for(yrepeat = 0; yrepeat < yscale; yrepeat++)
       {
-         b = font_array[(string[col]^0x80)*8 + ypixel];
+         idx = x + (y + ypixel*yscale + yrepeat)*VIRTUAL_WIDTH;
 
-         for(bit=0; bit<7; bit++, yptr++)
+         if (opaque && yrepeat > 0)
          {
-            *yptr = (b & (1<<(7-bit))) ? fg : bg;
-            for(xrepeat = 1; xrepeat < xscale; xrepeat++, yptr++)
-               yptr[1] = *yptr;
+            memcpy((unsigned char *)surf + idx*retro_pixel_bytes,
+                   (unsigned char *)surf + (idx - VIRTUAL_WIDTH)*retro_pixel_bytes,
+                   surfw*retro_pixel_bytes);
+            continue;
          }
-      }
-
-      for(yrepeat = 1; yrepeat < yscale; yrepeat++) 
-         for(xrepeat = 0; xrepeat<surfw; xrepeat++, yptr++)
-            *yptr = yptr[-surfw];
 
+         for(col=0; col<strlen; col++)
+         {
+            b = font_array[(string[col]^0x80)*8 + ypixel];
+
+            for(bit=0; bit<7; bit++, idx += xscale)
+            {
+               unsigned short color = (b & (1<<(7-bit))) ? fg : bg;
+               if (color != 0)
+                  FillSpan(surf, idx, xscale, color);
+            }
+         }
+      }
    }
-
-   yptr = (unsigned short*)&linesurf[0];
-
-   for(yrepeat = y; yrepeat < y+ surfh; yrepeat++) 
-      for(xrepeat = x; xrepeat< x+surfw; xrepeat++,yptr++)
-         if(*yptr!=0)surf[xrepeat+yrepeat*VIRTUAL_WIDTH] = *yptr;
-
-   free(linesurf);
 }
 
 
@@ -11,6 +11,7 @@ const char SDLGui_fileid[] = "Hatari sdlgui.c : " __DATE__ " " __TIME__;
 #include <SDL.h>
 #include <ctype.h>
 #include <string.h>
+#include <stdint.h>
 
 #include "main.h"
 #include "sdlgui.h"
@@ -23,7 +24,7 @@ extern int touch;
 int gmx,gmy;
 int okold=0,boutc=0;
 
-extern unsigned short int bmp[1024*1024];
+extern unsigned short int *bmp;
 #define B ((rgba>> 8)&0xff)>>3 
 #define G ((rgba>>16)&0xff)>>3
 #define R ((rgba>>24)&0xff)>>3
@@ -86,6 +87,7 @@ static SDL_Surface *pFontGfx = NULL;        /* The actual font graphics */
 #endif
 
 static int current_object = 0;				/* Current selected object */
+static Uint32 dialog_shown = 0;				/* Hash of the dialog as shown in bmp, 0 if none */
 
 int sdlgui_fontwidth;			/* Width of the actual font */
 int sdlgui_fontheight;			/* Height of the actual font */
@@ -226,7 +228,8 @@ int SDLGui_SetScreen(SDL_Surface *pScrn)
 	return 0;
 #else
 	pSdlGuiScrn = pScrn;
-	memset(bmp, 0, sizeof(bmp));
+	memset(bmp, 0, retrow * retroh * retro_pixel_bytes);
+	dialog_shown = 0;
 
 	sdlgui_fontwidth  = 10;
 	sdlgui_fontheight = 16;
@@ -664,7 +667,8 @@ void SDLGui_DrawDialog(const SGOBJ *dlg)
 {
 	int i;
 
-	memset(bmp, 0, sizeof(bmp));
+	memset(bmp, 0, retrow * retroh * retro_pixel_bytes);
+	dialog_shown = 0;
 
 	for (i = 0; dlg[i].type != -1; i++)
 	{
@@ -761,6 +765,54 @@ static int SDLGui_SearchFlaggedButton(const SGOBJ *dlg, int flag)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Hash what the dialog and the mouse cursor look like, to redraw them
+ * only when this changes.
+ */
+static Uint32 SDLGui_DialogHash(const SGOBJ *dlg)
+{
+	Uint32 h = 2166136261u;
+	const char *c;
+	int i;
+
+#define HASH(v) (h = (h ^ (Uint32)(v)) * 16777619u)
+	HASH((uintptr_t)dlg);
+	HASH((uintptr_t)bmp);
+	HASH(retrow);
+	HASH(retroh);
+	HASH(gmx);
+	HASH(gmy);
+	for (i = 0; dlg[i].type != -1; i++)
+	{
+		HASH(dlg[i].type);
+		HASH(dlg[i].flags);
+		HASH(dlg[i].state);
+		HASH(dlg[i].x);
+		HASH(dlg[i].y);
+		HASH(dlg[i].w);
+		HASH(dlg[i].h);
+		for (c = dlg[i].txt; c && *c; c++)
+			HASH(*c);
+		HASH(0);
+	}
+#undef HASH
+
+	return h ? h : 1;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Force the next SDLGui_DoDialog() call to redraw the dialog, after
+ * something else has drawn into bmp.
+ */
+void SDLGui_InvalidateDialog(void)
+{
+	dialog_shown = 0;
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Show and process a dialog. Returns the button number that has been
@@ -814,8 +866,9 @@ int SDLGui_DoDialog(SGOBJ *dlg, SDL_Event *pEventOut)
 		fprintf(stderr, "SDLGUI_DoDialog: CreateRGBSurface failed: %s\n", SDL_GetError());
 	}
 #endif
-	/* (Re-)draw the dialog */
-	SDLGui_DrawDialog(dlg);
+	/* (Re-)draw the dialog, unless it is shown as it is already */
+	if (SDLGui_DialogHash(dlg) != dialog_shown)
+		SDLGui_DrawDialog(dlg);
 
 	/* Is the left mouse button still pressed? Yes -> Handle TOUCHEXIT objects here */
 	//SDL_PumpEvents();
@@ -885,7 +938,13 @@ int SDLGui_DoDialog(SGOBJ *dlg, SDL_Event *pEventOut)
 
 		input_gui();
 		
-		draw_cross(gmx,gmy);
+		if (dialog_shown == 0 || SDLGui_DialogHash(dlg) != dialog_shown)
+		{
+			if (dialog_shown != 0)
+				SDLGui_DrawDialog(dlg);
+			draw_cross(gmx,gmy);
+			dialog_shown = SDLGui_DialogHash(dlg);
+		}
 
                 if(touch!=-1 && okold==0 ){
 
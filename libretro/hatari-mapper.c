@@ -1,3 +1,4 @@
+#include <limits.h>
 #include "libretro.h"
 #include "libretro-hatari.h"
 #include "graph.h"
@@ -12,12 +13,17 @@ extern const char *retro_system_directory;
 extern const char *retro_content_directory;
 char RETRO_DIR[512];
 char RETRO_TOS[512];
+char RETRO_IKBD[512];
 
 //HATARI PROTOTYPES
 #include "configuration.h"
 #include "file.h"
+#include "main.h"
+#include "movie.h"
+#include "perf.h"
 extern bool Dialog_DoProperty(void);
 extern void Screen_SetFullUpdate(void);
+extern void SDLGui_InvalidateDialog(void);
 extern void Main_HandleMouseMotion(void);
 extern void Main_UnInit(void);
 extern int  hmain(int argc, char *argv[]);
@@ -39,8 +45,24 @@ static unsigned long Ktime=0, LastFPSTime=0;
 
 //VIDEO
 extern SDL_Surface *sdlscrn; 
-unsigned short int bmp[1024*1024];
-unsigned char savbkg[1024*1024* 2];
+unsigned short int *bmp; // output surface, sized by bmp_resize()
+static void *bmp_block;  // allocation holding it
+static size_t bmp_size;
+unsigned char *savbkg;   // screen under the GUI, for screenshots
+int SCREEN_UPDATED=0; //screen contents changed since last retro_run
+int SCREEN_UPDATED_Y0, SCREEN_UPDATED_Y1; //rows Y0..Y1-1 of it changed
+
+//OVERLAYS
+// The virtual keyboard and status line are drawn into their own layer only
+// when what they show changes, then composited on each presented frame
+static unsigned short *overlay_bmp;  // layer, OVERLAY_KEY where transparent
+static unsigned short *overlay_save; // frame pixels under the composited layer
+static size_t overlay_size;          // of both, and of savbkg
+static unsigned char overlay_rows[1024];         // rows of the layer with visible pixels
+static int overlay_state[16];                    // what the layer was drawn for
+static int overlay_shown=0;     // layer is composited into bmp
+static int overlay_presented=0; // last presented frame had the layer
+static int vkx=0,vky=0;         // virtual keyboard cursor
 
 //SOUND
 short signed int SNDBUF[1024*2];
@@ -53,6 +75,11 @@ char RPATH[512];
 int NPAGE=-1, KCOL=1, BKGCOLOR=0, MAXPAS=6;
 int SHIFTON=-1,MOUSEMODE=-1,SHOWKEY=-1,PAS=4,STATUTON=-1;
 int SND; //SOUND ON/OFF
+int REWIND=0; //rewind button held
+// Joystick and mouse packets take ~20 lines each through the ACIA
+#define LATE_INPUT_LINES 64
+int LATE_INPUT=0; //input to be read by the emulation during the frame
+int INPUT_ACTIVE=0; //a key, button, direction or mouse motion was read
 static int firstps=0;
 int pauseg=0; //enter_gui
 
@@ -73,6 +100,17 @@ int point_y_last = -1;
 char Key_Sate[512];
 char Key_Sate2[512];
 
+// With frontend keyboard events Key_Sate is updated as keys change, and
+// only needs scanning after that. Otherwise all keys are polled per frame.
+static bool keyboard_events=false;
+static bool keys_changed=true;
+static bool keys_held=false;
+
+// Joypad buttons of ports 0 and 1, read once per update_input
+static bool joypad_bitmasks=false;
+static unsigned joypad_mask[2];
+#define JOYPAD(port, id) ((joypad_mask[port] >> (id)) & 1)
+
 static int mbt[16]={0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
 
 //STATS GUI
@@ -163,12 +201,15 @@ void save_bkg(void)
    int i, j, k; 
    unsigned char *ptr;
 
+   if (!savbkg)
+      return;
+
    k = 0;
    ptr = (unsigned char*)sdlscrn->pixels;
 
    for(j=0;j<retroh;j++)
    {
-      for(i=0;i<retrow*2;i++)
+      for(i=0;i<retrow*retro_pixel_bytes;i++)
       {
          savbkg[k]=*ptr;
          ptr++;
@@ -179,7 +220,53 @@ void save_bkg(void)
 
 void retro_fillrect(SDL_Surface * surf,SDL_Rect *rect,unsigned int col)
 {
-   DrawFBoxBmp(bmp,rect->x,rect->y,rect->w ,rect->h,col); 
+   int i, j;
+   unsigned short *line;
+   unsigned int *line32;
+
+   // Surface may point to the frontend framebuffer, so use its own pitch
+   for(j=rect->y;j<rect->y+rect->h;j++)
+   {
+      if (surf->format->BytesPerPixel == 4)
+      {
+         line32=(unsigned int *)((unsigned char *)surf->pixels + j*surf->pitch);
+         for(i=rect->x;i<rect->x+rect->w;i++)
+            line32[i]=col;
+      }
+      else
+      {
+         line=(unsigned short *)((unsigned char *)surf->pixels + j*surf->pitch);
+         for(i=rect->x;i<rect->x+rect->w;i++)
+            line[i]=col;
+      }
+   }
+}
+
+void retro_updaterects(SDL_Surface * surf, int numrects, SDL_Rect *rects)
+{
+   int i;
+
+   if (!SCREEN_UPDATED)
+   {
+      SCREEN_UPDATED_Y0 = INT_MAX;
+      SCREEN_UPDATED_Y1 = 0;
+   }
+   SCREEN_UPDATED=1;
+
+   // The GUI and whole screen updates change all rows
+   if (surf != sdlscrn || !numrects)
+   {
+      SCREEN_UPDATED_Y0 = 0;
+      SCREEN_UPDATED_Y1 = INT_MAX;
+      return;
+   }
+   for (i = 0; i < numrects; i++)
+   {
+      if (rects[i].y < SCREEN_UPDATED_Y0)
+         SCREEN_UPDATED_Y0 = rects[i].y;
+      if (rects[i].y + rects[i].h > SCREEN_UPDATED_Y1)
+         SCREEN_UPDATED_Y1 = rects[i].y + rects[i].h;
+   }
 }
 
 int  GuiGetMouseState( int * x,int * y)
@@ -189,6 +276,77 @@ int  GuiGetMouseState( int * x,int * y)
    return 0;
 }
 
+static void overlay_free(void)
+{
+   free(overlay_bmp);
+   free(overlay_save);
+   free(savbkg);
+   overlay_bmp = overlay_save = NULL;
+   savbkg = NULL;
+   overlay_size = 0;
+}
+
+// Size the output surface for retrow x retroh pixels of the frontend format,
+// and for the w x h ST screen drawn into it at the same pitch. It starts on
+// a cache line, as do its rows since the widths are multiples of 32 pixels.
+// The overlay layers and the GUI background are retrow x retroh pixels.
+static bool bmp_resize(int w, int h)
+{
+   size_t pitch = retrow * retro_pixel_bytes;
+   size_t size = pitch * retroh;
+   unsigned short *old = bmp;
+
+   if (size != overlay_size)
+   {
+      overlay_free();
+      overlay_bmp = malloc(size);
+      overlay_save = malloc(size);
+      savbkg = malloc(size);
+      if (!overlay_bmp || !overlay_save || !savbkg)
+      {
+         printf("overlay pixels failed");
+         overlay_free();
+         return false;
+      }
+      overlay_size = size;
+      // redrawn at the new size
+      memset(overlay_state, 0, sizeof(overlay_state));
+      overlay_shown = 0;
+   }
+
+   if (h > 0 && pitch * (h - 1) + w * retro_pixel_bytes > size)
+      size = pitch * (h - 1) + w * retro_pixel_bytes;
+   size = (size + 63) & ~(size_t)63;
+   if (size == bmp_size)
+      return true;
+
+   free(bmp_block);
+   bmp_block = malloc(size + 63);
+   if (bmp_block == NULL)
+   {
+      printf("tex pixels failed");
+      bmp = NULL;
+      bmp_size = 0;
+      return false;
+   }
+   bmp = (unsigned short *)(((uintptr_t)bmp_block + 63) & ~(uintptr_t)63);
+   bmp_size = size;
+   memset(bmp, 0, size);
+
+   if (sdlscrn && sdlscrn->pixels == (void *)old)
+      sdlscrn->pixels = (unsigned char *)bmp;
+   return true;
+}
+
+void texture_free(void)
+{
+   free(bmp_block);
+   bmp_block = NULL;
+   bmp = NULL;
+   bmp_size = 0;
+   overlay_free();
+}
+
 void texture_uninit(void)
 {
    if(sdlscrn)
@@ -206,6 +364,10 @@ SDL_Surface *prepare_texture(int w,int h,int b)
 
    if(sdlscrn)
       texture_uninit();
+   sdlscrn = NULL;
+
+   if (!bmp_resize(w, h))
+      return NULL;
 
    bitmp = (SDL_Surface *) calloc(1, sizeof(*bitmp));
    if (bitmp == NULL)
@@ -221,20 +383,41 @@ SDL_Surface *prepare_texture(int w,int h,int b)
       return NULL;
    }
 
-   bitmp->format->BitsPerPixel = 16;
-   bitmp->format->BytesPerPixel = 2;
-   bitmp->format->Rloss=3;
-   bitmp->format->Gloss=3;
-   bitmp->format->Bloss=3;
-   bitmp->format->Aloss=0;
-   bitmp->format->Rshift=11;
-   bitmp->format->Gshift=6;
-   bitmp->format->Bshift=0;
-   bitmp->format->Ashift=0;
-   bitmp->format->Rmask=0x0000F800;
-   bitmp->format->Gmask=0x000007E0;
-   bitmp->format->Bmask=0x0000001F;
-   bitmp->format->Amask=0x00000000;
+   if (retro_pixel_bytes == 4)
+   {
+      // XRGB8888, the converters use their 32 bpp code
+      bitmp->format->BitsPerPixel = 32;
+      bitmp->format->BytesPerPixel = 4;
+      bitmp->format->Rloss=0;
+      bitmp->format->Gloss=0;
+      bitmp->format->Bloss=0;
+      bitmp->format->Aloss=0;
+      bitmp->format->Rshift=16;
+      bitmp->format->Gshift=8;
+      bitmp->format->Bshift=0;
+      bitmp->format->Ashift=0;
+      bitmp->format->Rmask=0x00FF0000;
+      bitmp->format->Gmask=0x0000FF00;
+      bitmp->format->Bmask=0x000000FF;
+      bitmp->format->Amask=0x00000000;
+   }
+   else
+   {
+      bitmp->format->BitsPerPixel = 16;
+      bitmp->format->BytesPerPixel = 2;
+      bitmp->format->Rloss=3;
+      bitmp->format->Gloss=3;
+      bitmp->format->Bloss=3;
+      bitmp->format->Aloss=0;
+      bitmp->format->Rshift=11;
+      bitmp->format->Gshift=6;
+      bitmp->format->Bshift=0;
+      bitmp->format->Ashift=0;
+      bitmp->format->Rmask=0x0000F800;
+      bitmp->format->Gmask=0x000007E0;
+      bitmp->format->Bmask=0x0000001F;
+      bitmp->format->Amask=0x00000000;
+   }
    bitmp->format->colorkey=0;
    bitmp->format->alpha=0;
    bitmp->format->palette = NULL;
@@ -242,7 +425,7 @@ SDL_Surface *prepare_texture(int w,int h,int b)
    bitmp->flags=0;
    bitmp->w=w;
    bitmp->h=h;
-   bitmp->pitch=retrow*2;
+   bitmp->pitch=retrow*retro_pixel_bytes;
    bitmp->pixels=(unsigned char *)&bmp[0];
    bitmp->clip_rect.x=0;
    bitmp->clip_rect.y=0;
@@ -255,7 +438,15 @@ SDL_Surface *prepare_texture(int w,int h,int b)
 
 void texture_init(void)
 {
-   memset(bmp, 0, sizeof(bmp));
+   if (sdlscrn && sdlscrn->pixels == (void *)bmp)
+   {
+      // The screen is drawn at the new pitch from now on
+      sdlscrn->pitch = retrow * retro_pixel_bytes;
+      Screen_SetFullUpdate();
+   }
+   if (bmp_resize(sdlscrn ? sdlscrn->w : 0, sdlscrn ? sdlscrn->h : 0))
+      memset(bmp, 0, bmp_size);
+   SDLGui_InvalidateDialog();
 
    gmx=(retrow/2)-1;
    gmy=(retroh/2)-1;
@@ -279,55 +470,224 @@ void pause_select(void)
    }
 }
 
-void Print_Statut(void)
+void Print_Statut(unsigned short *buf)
 {
    STAT_BASEY=CROP_HEIGHT+24;
 
-   DrawFBoxBmp(bmp,0,STAT_BASEY,CROP_WIDTH,STAT_YSZ,RGB565(0,0,0));
+   DrawFBoxBmp(buf,0,STAT_BASEY,CROP_WIDTH,STAT_YSZ,RGB565(0,0,0));
 
-   Draw_text(bmp,STAT_DECX    ,STAT_BASEY,0xffff,0x8080,1,2,40,(MOUSEMODE<0)?" Joy ":"Mouse");
+   Draw_text(buf,STAT_DECX    ,STAT_BASEY,0xffff,0x8080,1,2,40,(MOUSEMODE<0)?" Joy ":"Mouse");
    if (MOUSEMODE>=0)
-   Draw_text(bmp,STAT_DECX+40 ,STAT_BASEY,0xffff,0x8080,1,2,40,"Speed:%d",PAS);
-   Draw_text(bmp,STAT_DECX+100,STAT_BASEY,0xffff,0x8080,1,2,40,(SHIFTON>0)?"SHIFT":"     ");
-   Draw_text(bmp,STAT_DECX+150,STAT_BASEY,0xffff,0x8080,1,2,40,"Joysticks:%s",(NUMjoy < 0) ? " 2 " : "1+M");
+   Draw_text(buf,STAT_DECX+40 ,STAT_BASEY,0xffff,0x8080,1,2,40,"Speed:%d",PAS);
+   Draw_text(buf,STAT_DECX+100,STAT_BASEY,0xffff,0x8080,1,2,40,(SHIFTON>0)?"SHIFT":"     ");
+   Draw_text(buf,STAT_DECX+150,STAT_BASEY,0xffff,0x8080,1,2,40,"Joysticks:%s",(NUMjoy < 0) ? " 2 " : "1+M");
 
    if(LEDA)
    {
-      DrawFBoxBmp(bmp,CROP_WIDTH-6*BOXDEC-6-16,STAT_BASEY,16,16,RGB565(0,7,0));//led A drive
-      Draw_text(bmp,CROP_WIDTH-6*BOXDEC-6-16,STAT_BASEY,0xffff,0x0,1,2,40," A");
+      DrawFBoxBmp(buf,CROP_WIDTH-6*BOXDEC-6-16,STAT_BASEY,16,16,RGB565(0,7,0));//led A drive
+      Draw_text(buf,CROP_WIDTH-6*BOXDEC-6-16,STAT_BASEY,0xffff,0x0,1,2,40," A");
    }    
 
    if(LEDB)
    {
-      DrawFBoxBmp(bmp,CROP_WIDTH-7*BOXDEC-6-16,STAT_BASEY,16,16,RGB565(0,7,0));//led B drive
-      Draw_text(bmp,CROP_WIDTH-7*BOXDEC-6-16,STAT_BASEY,0xffff,0x0,1,2,40," B");
+      DrawFBoxBmp(buf,CROP_WIDTH-7*BOXDEC-6-16,STAT_BASEY,16,16,RGB565(0,7,0));//led B drive
+      Draw_text(buf,CROP_WIDTH-7*BOXDEC-6-16,STAT_BASEY,0xffff,0x0,1,2,40," B");
    }
 
    if(LEDC)
    {
-      DrawFBoxBmp(bmp,CROP_WIDTH-8*BOXDEC-6-16,STAT_BASEY,16,16,RGB565(0,7,0));//led C drive
-      Draw_text(bmp,CROP_WIDTH-8*BOXDEC-6-16,STAT_BASEY,0xffff,0x0,1,2,40," C");
+      DrawFBoxBmp(buf,CROP_WIDTH-8*BOXDEC-6-16,STAT_BASEY,16,16,RGB565(0,7,0));//led C drive
+      Draw_text(buf,CROP_WIDTH-8*BOXDEC-6-16,STAT_BASEY,0xffff,0x0,1,2,40," C");
       LEDC=0;
    }
 
 }
 
+// Never drawn by the overlays, top byte isn't used by XRGB8888
+#define OVERLAY_KEY16 0x0001
+#define OVERLAY_KEY32 0x01000000
+
+// Redraw the layer if what it shows changed, return true if it was redrawn
+static int overlay_update(void)
+{
+   int state[16] = { SHOWKEY, STATUTON, vkx, vky, NPAGE, SHIFTON, KCOL, MOUSEMODE,
+                     PAS, NUMjoy, LEDA, LEDB, LEDC, CROP_WIDTH, CROP_HEIGHT,
+                     retrow * retro_pixel_bytes + retroh };
+   int i, j;
+
+   if (!memcmp(state, overlay_state, sizeof(state)))
+      return 0;
+   memcpy(overlay_state, state, sizeof(state));
+
+   if (retro_pixel_bytes == 4)
+   {
+      unsigned int *p = (unsigned int *)overlay_bmp;
+      for (i = 0; i < retrow * retroh; i++)
+         p[i] = OVERLAY_KEY32;
+   }
+   else
+   {
+      for (i = 0; i < retrow * retroh; i++)
+         overlay_bmp[i] = OVERLAY_KEY16;
+   }
+
+   if (SHOWKEY == 1)
+      virtual_kdb(overlay_bmp, vkx, vky);
+   if (STATUTON == 1)
+      Print_Statut(overlay_bmp);
+
+   // Remember which rows need compositing
+   for (j = 0; j < retroh; j++)
+   {
+      overlay_rows[j] = 0;
+      for (i = 0; i < retrow && !overlay_rows[j]; i++)
+      {
+         if (retro_pixel_bytes == 4)
+            overlay_rows[j] = ((unsigned int *)overlay_bmp)[j * retrow + i] != OVERLAY_KEY32;
+         else
+            overlay_rows[j] = overlay_bmp[j * retrow + i] != OVERLAY_KEY16;
+      }
+   }
+   return 1;
+}
+
+// Draw the overlays on top of the frame in bmp, keeping the pixels under
+// them for overlay_restore(). Return true if the presented image differs
+// from the previous one because of the overlays.
+int overlay_compose(void)
+{
+   int i, j, changed;
+   int rowbytes = retrow * retro_pixel_bytes;
+   unsigned char *frame = (unsigned char *)bmp;
+   unsigned char *save = (unsigned char *)overlay_save;
+
+   if ((SHOWKEY != 1 && STATUTON != 1) || !overlay_bmp)
+   {
+      changed = overlay_presented;
+      overlay_presented = 0;
+      return changed;
+   }
+
+   Perf_Begin(PERF_OVERLAY);
+   changed = overlay_update() || !overlay_presented;
+
+   for (j = 0; j < retroh; j++)
+   {
+      if (!overlay_rows[j])
+         continue;
+      memcpy(save + j * rowbytes, frame + j * rowbytes, rowbytes);
+
+      if (retro_pixel_bytes == 4)
+      {
+         unsigned int *src = (unsigned int *)overlay_bmp + j * retrow;
+         unsigned int *dst = (unsigned int *)bmp + j * retrow;
+         for (i = 0; i < retrow; i++)
+            if (src[i] != OVERLAY_KEY32)
+               dst[i] = src[i];
+      }
+      else
+      {
+         unsigned short *src = overlay_bmp + j * retrow;
+         unsigned short *dst = bmp + j * retrow;
+         for (i = 0; i < retrow; i++)
+            if (src[i] != OVERLAY_KEY16)
+               dst[i] = src[i];
+      }
+   }
+
+   overlay_shown = overlay_presented = 1;
+   Perf_End();
+   return changed;
+}
+
+// Put back the frame pixels under the overlays, so the emulation only
+// needs to convert what it changed
+void overlay_restore(void)
+{
+   int j;
+   int rowbytes = retrow * retro_pixel_bytes;
+
+   if (!overlay_shown)
+      return;
+
+   Perf_Begin(PERF_OVERLAY);
+   for (j = 0; j < retroh; j++)
+      if (overlay_rows[j])
+         memcpy((unsigned char *)bmp + j * rowbytes,
+                (unsigned char *)overlay_save + j * rowbytes, rowbytes);
+   overlay_shown = 0;
+   Perf_End();
+}
+
 void retro_key_down(unsigned char retrok)
 {
+   if (Movie_IsRecording())
+      Movie_RecordKey(retrok, true);
    IKBD_PressSTKey(retrok,1); 
 }
 
 void retro_key_up(unsigned char retrok)
 {
+   if (Movie_IsRecording())
+      Movie_RecordKey(retrok, false);
    IKBD_PressSTKey(retrok,0);
 }
 
+void RETRO_CALLCONV keyboard_event(bool down, unsigned keycode,
+      uint32_t character, uint16_t key_modifiers)
+{
+   if (keycode >= 320 || !Key_Sate[keycode] == !down)
+      return;
+
+   Key_Sate[keycode] = down ? 0x80 : 0;
+   keys_changed = true;
+}
+
+void input_init(bool key_events, bool bitmasks)
+{
+   keyboard_events = key_events;
+   joypad_bitmasks = bitmasks;
+   keys_changed = true;
+}
+
+static void joypad_read(void)
+{
+   unsigned port, id;
+
+   for (port = 0; port < 2; port++)
+   {
+      if (joypad_bitmasks)
+      {
+         joypad_mask[port] = (uint16_t)input_state_cb(port, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_MASK);
+         continue;
+      }
+
+      joypad_mask[port] = 0;
+      for (id = 0; id <= RETRO_DEVICE_ID_JOYPAD_R3; id++)
+         if (input_state_cb(port, RETRO_DEVICE_JOYPAD, 0, id))
+            joypad_mask[port] |= 1 << id;
+   }
+}
+
 void Process_key(void)
 {
    int i;
+
+   if (keyboard_events && !keys_changed)
+   {
+      if (keys_held)
+         INPUT_ACTIVE=1;
+      return;
+   }
+   keys_changed = false;
+   keys_held = false;
+
    for(i=0;i<320;i++)
    {
-      Key_Sate[i]=input_state_cb(0, RETRO_DEVICE_KEYBOARD, 0,i) ? 0x80: 0;
+      if (!keyboard_events)
+         Key_Sate[i]=input_state_cb(0, RETRO_DEVICE_KEYBOARD, 0,i) ? 0x80: 0;
+      if (Key_Sate[i])
+         INPUT_ACTIVE=keys_held=1;
 
       if(SDLKeyToSTScanCode[i]==0x2a )
       {  //SHIFT CASE
@@ -381,11 +741,11 @@ void Deadzone(int* a)
    X   Hatari Gui
    */
 
-void update_input(void)
+// Returns false when the virtual keyboard took the joystick 1 and mouse input
+static bool read_input(void)
 {
    int i;
    static int oldi=-1;
-   static int vkx=0,vky=0;
 
    static int mbL=0,mbR=0;
    int mouse_l;
@@ -398,32 +758,33 @@ void update_input(void)
 
    if(oldi!=-1)
    {
-      IKBD_PressSTKey(oldi,0);
+      retro_key_up(oldi);
       oldi=-1;
    }
 
    input_poll_cb();
+   joypad_read();
 
+   INPUT_ACTIVE=0;
    Process_key();
 
    i=RETRO_DEVICE_ID_JOYPAD_X;
-   if (Key_Sate[RETROK_TILDE] || Key_Sate[RETROK_BACKQUOTE] || input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, i) )
+   if (Key_Sate[RETROK_TILDE] || Key_Sate[RETROK_BACKQUOTE] || JOYPAD(0, i) )
       pauseg=1;
 
    i=RETRO_DEVICE_ID_JOYPAD_L;//show vkey toggle
-   if ( input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, i) && mbt[i]==0 )
+   if ( JOYPAD(0, i) && mbt[i]==0 )
       mbt[i]=1;
-   else if ( mbt[i]==1 && ! input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, i) )
+   else if ( mbt[i]==1 && ! JOYPAD(0, i) )
    {
       mbt[i]=0;
       SHOWKEY=-SHOWKEY;
-      Screen_SetFullUpdate();
    }
 
    i=RETRO_DEVICE_ID_JOYPAD_SELECT;//mouse/joy toggle
-   if ( input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, i) && mbt[i]==0 )
+   if ( JOYPAD(0, i) && mbt[i]==0 )
       mbt[i]=1;
-   else if ( mbt[i]==1 && ! input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, i) )
+   else if ( mbt[i]==1 && ! JOYPAD(0, i) )
    {
       mbt[i]=0;
       MOUSEMODE=-MOUSEMODE;
@@ -431,9 +792,9 @@ void update_input(void)
    }
 
    i=RETRO_DEVICE_ID_JOYPAD_START;//num joy toggle (on either joystick)
-   if ( (input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, i) || input_state_cb(1, RETRO_DEVICE_JOYPAD, 0, i)) && mbt[i]==0 )
+   if ( (JOYPAD(0, i) || JOYPAD(1, i)) && mbt[i]==0 )
       mbt[i]=1;
-   else if ( mbt[i]==1 && ! (input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, i)  || input_state_cb(1, RETRO_DEVICE_JOYPAD, 0, i)) )
+   else if ( mbt[i]==1 && ! (JOYPAD(0, i)  || JOYPAD(1, i)) )
    {
       mbt[i]=0;
       NUMjoy=-NUMjoy;
@@ -441,45 +802,42 @@ void update_input(void)
    }
 
    i=RETRO_DEVICE_ID_JOYPAD_R;//mouse gui speed
-   if ( input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, i) && mbt[i]==0 )
+   if ( JOYPAD(0, i) && mbt[i]==0 )
       mbt[i]=1;
-   else if ( mbt[i]==1 && ! input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, i) )
+   else if ( mbt[i]==1 && ! JOYPAD(0, i) )
    {
       mbt[i]=0;
       PAS++;if(PAS>MAXPAS)PAS=1;
    }
 
    i=RETRO_DEVICE_ID_JOYPAD_Y;//switch shift On/Off 
-   if ( input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, i) && mbt[i]==0 )
+   if ( JOYPAD(0, i) && mbt[i]==0 )
       mbt[i]=1;
-   else if ( mbt[i]==1 && ! input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, i) )
+   else if ( mbt[i]==1 && ! JOYPAD(0, i) )
    {
       mbt[i]=0;
       SHIFTON=-SHIFTON;
-      Screen_SetFullUpdate();
    }
 
    i=RETRO_DEVICE_ID_JOYPAD_L2;//show/hide status (either joystick)
-   if ( (input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, i) || input_state_cb(1, RETRO_DEVICE_JOYPAD, 0, i)) && mbt[i]==0 )
+   if ( (JOYPAD(0, i) || JOYPAD(1, i)) && mbt[i]==0 )
       mbt[i]=1;
-   else if ( mbt[i]==1 && ! (input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, i) || input_state_cb(1, RETRO_DEVICE_JOYPAD, 0, i)) )
+   else if ( mbt[i]==1 && ! (JOYPAD(0, i) || JOYPAD(1, i)) )
    {
       mbt[i]=0;
       STATUTON=-STATUTON;
-      Screen_SetFullUpdate();
    }
 
+   REWIND = JOYPAD(0, RETRO_DEVICE_ID_JOYPAD_L3);
+
    i=RETRO_DEVICE_ID_JOYPAD_R2;//swap kbd pages
-   if ( input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, i) && mbt[i]==0 )
+   if ( JOYPAD(0, i) && mbt[i]==0 )
       mbt[i]=1;
-   else if ( mbt[i]==1 && ! input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, i) )
+   else if ( mbt[i]==1 && ! JOYPAD(0, i) )
    {
       mbt[i]=0;
       if(SHOWKEY==1)
-      {
          NPAGE=-NPAGE;
-         Screen_SetFullUpdate();
-      }
    }
 
    // joystick 2
@@ -500,14 +858,14 @@ void update_input(void)
       else if (al[0] >= JOYRANGE_RIGHT_VALUE)
          MXjoy1 |= ATARIJOY_BITMASK_RIGHT;
 
-      if( input_state_cb(1, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_UP   ) ) MXjoy1 |= ATARIJOY_BITMASK_UP;
-      if( input_state_cb(1, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_DOWN ) ) MXjoy1 |= ATARIJOY_BITMASK_DOWN;
-      if( input_state_cb(1, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_LEFT ) ) MXjoy1 |= ATARIJOY_BITMASK_LEFT;
-      if( input_state_cb(1, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_RIGHT) ) MXjoy1 |= ATARIJOY_BITMASK_RIGHT;
-      if( input_state_cb(1, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_B)     ) MXjoy1 |= ATARIJOY_BITMASK_FIRE;
+      if( JOYPAD(1, RETRO_DEVICE_ID_JOYPAD_UP) ) MXjoy1 |= ATARIJOY_BITMASK_UP;
+      if( JOYPAD(1, RETRO_DEVICE_ID_JOYPAD_DOWN) ) MXjoy1 |= ATARIJOY_BITMASK_DOWN;
+      if( JOYPAD(1, RETRO_DEVICE_ID_JOYPAD_LEFT) ) MXjoy1 |= ATARIJOY_BITMASK_LEFT;
+      if( JOYPAD(1, RETRO_DEVICE_ID_JOYPAD_RIGHT) ) MXjoy1 |= ATARIJOY_BITMASK_RIGHT;
+      if( JOYPAD(1, RETRO_DEVICE_ID_JOYPAD_B)     ) MXjoy1 |= ATARIJOY_BITMASK_FIRE;
 
       // Joy autofire
-      if( input_state_cb(1, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_A) )
+      if( JOYPAD(1, RETRO_DEVICE_ID_JOYPAD_A) )
       {
          MXjoy1 |= ATARIJOY_BITMASK_FIRE;
          if ((nVBLs&0x7)<4)
@@ -529,33 +887,33 @@ void update_input(void)
       bool al_lf = al[0] <= JOYRANGE_LEFT_VALUE;
       bool al_rt = al[0] >= JOYRANGE_RIGHT_VALUE;
 
-      if ( (input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_UP) || al_up) && vkflag[0]==0 )
+      if ( (JOYPAD(0, RETRO_DEVICE_ID_JOYPAD_UP) || al_up) && vkflag[0]==0 )
          vkflag[0]=1;
-      else if (vkflag[0]==1 && ! (input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_UP) || al_up) )
+      else if (vkflag[0]==1 && ! (JOYPAD(0, RETRO_DEVICE_ID_JOYPAD_UP) || al_up) )
       {
          vkflag[0]=0;
          vky -= 1; 
       }
 
-      if ( (input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_DOWN) || al_dn) && vkflag[1]==0 )
+      if ( (JOYPAD(0, RETRO_DEVICE_ID_JOYPAD_DOWN) || al_dn) && vkflag[1]==0 )
          vkflag[1]=1;
-      else if (vkflag[1]==1 && ! (input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_DOWN) || al_dn) )
+      else if (vkflag[1]==1 && ! (JOYPAD(0, RETRO_DEVICE_ID_JOYPAD_DOWN) || al_dn) )
       {
          vkflag[1]=0;
          vky += 1; 
       }
 
-      if ( (input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_LEFT) || al_lf) && vkflag[2]==0 )
+      if ( (JOYPAD(0, RETRO_DEVICE_ID_JOYPAD_LEFT) || al_lf) && vkflag[2]==0 )
          vkflag[2]=1;
-      else if (vkflag[2]==1 && ! (input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_LEFT) || al_lf) )
+      else if (vkflag[2]==1 && ! (JOYPAD(0, RETRO_DEVICE_ID_JOYPAD_LEFT) || al_lf) )
       {
          vkflag[2]=0;
          vkx -= 1;
       }
 
-      if ( (input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_RIGHT) || al_rt) && vkflag[3]==0 )
+      if ( (JOYPAD(0, RETRO_DEVICE_ID_JOYPAD_RIGHT) || al_rt) && vkflag[3]==0 )
          vkflag[3]=1;
-      else if (vkflag[3]==1 && ! (input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_RIGHT) || al_rt) )
+      else if (vkflag[3]==1 && ! (JOYPAD(0, RETRO_DEVICE_ID_JOYPAD_RIGHT) || al_rt) )
       {
          vkflag[3]=0;
          vkx += 1;
@@ -566,12 +924,10 @@ void update_input(void)
       if(vky<0)vky=4;
       if(vky>4)vky=0;
 
-      virtual_kdb(bmp,vkx,vky);
-
       i=RETRO_DEVICE_ID_JOYPAD_B;
-      if(input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, i)  && vkflag[4]==0)
+      if(JOYPAD(0, i)  && vkflag[4]==0)
          vkflag[4]=1;
-      else if( !input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, i)  && vkflag[4]==1)
+      else if( !JOYPAD(0, i)  && vkflag[4]==1)
       {
          vkflag[4]=0;
          i=check_vkey2(vkx,vky);
@@ -579,15 +935,12 @@ void update_input(void)
          if(i==-2)
          {
             NPAGE=-NPAGE;oldi=-1;
-            //Clear interface zone
-            Screen_SetFullUpdate();
          }
          else if(i==-1)
             oldi=-1;
          else if(i==-3)
          {
             //KDB bgcolor
-            Screen_SetFullUpdate();
             KCOL=-KCOL;
             oldi=-1;
          }
@@ -595,7 +948,6 @@ void update_input(void)
          {
             //VKbd show/hide
             oldi=-1;
-            Screen_SetFullUpdate();
             SHOWKEY=-SHOWKEY;
          }
          else if(i==-5)
@@ -610,26 +962,24 @@ void update_input(void)
             if(i==0x2a)
             {
 
-               IKBD_PressSTKey(i,(SHIFTON == 1)?0:1);
+               if (SHIFTON == 1)
+                  retro_key_up(i);
+               else
+                  retro_key_down(i);
 
                SHIFTON=-SHIFTON;
 
-               Screen_SetFullUpdate();
-
                oldi=-1;
             }
             else
             {
                oldi=i;
-               IKBD_PressSTKey(i,1);
+               retro_key_down(i);
             }
          }
       }
 
-      if(STATUTON==1)
-         Print_Statut();
-
-      return;
+      return false;
    }
 
    // joystick 1 / mouse
@@ -653,14 +1003,14 @@ void update_input(void)
       else if (al[0] >= JOYRANGE_RIGHT_VALUE)
          MXjoy0 |= ATARIJOY_BITMASK_RIGHT;
 
-      if( input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_UP   ) ) MXjoy0 |= ATARIJOY_BITMASK_UP;
-      if( input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_DOWN ) ) MXjoy0 |= ATARIJOY_BITMASK_DOWN;
-      if( input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_LEFT ) ) MXjoy0 |= ATARIJOY_BITMASK_LEFT;
-      if( input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_RIGHT) ) MXjoy0 |= ATARIJOY_BITMASK_RIGHT;
-      if( input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_B)     ) MXjoy0 |= ATARIJOY_BITMASK_FIRE;
+      if( JOYPAD(0, RETRO_DEVICE_ID_JOYPAD_UP) ) MXjoy0 |= ATARIJOY_BITMASK_UP;
+      if( JOYPAD(0, RETRO_DEVICE_ID_JOYPAD_DOWN) ) MXjoy0 |= ATARIJOY_BITMASK_DOWN;
+      if( JOYPAD(0, RETRO_DEVICE_ID_JOYPAD_LEFT) ) MXjoy0 |= ATARIJOY_BITMASK_LEFT;
+      if( JOYPAD(0, RETRO_DEVICE_ID_JOYPAD_RIGHT) ) MXjoy0 |= ATARIJOY_BITMASK_RIGHT;
+      if( JOYPAD(0, RETRO_DEVICE_ID_JOYPAD_B)     ) MXjoy0 |= ATARIJOY_BITMASK_FIRE;
 
       // Joy autofire
-      if( input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_A) )
+      if( JOYPAD(0, RETRO_DEVICE_ID_JOYPAD_A) )
       {
          MXjoy0 |= ATARIJOY_BITMASK_FIRE;
          if ((nVBLs&0x7)<4)
@@ -691,17 +1041,17 @@ void update_input(void)
       fmousey += al[1]/1024;
 
       //emulate mouse with dpad
-      if (input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_RIGHT))
+      if (JOYPAD(0, RETRO_DEVICE_ID_JOYPAD_RIGHT))
          fmousex += PAS;
-      if (input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_LEFT))
+      if (JOYPAD(0, RETRO_DEVICE_ID_JOYPAD_LEFT))
          fmousex -= PAS;
-      if (input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_DOWN))
+      if (JOYPAD(0, RETRO_DEVICE_ID_JOYPAD_DOWN))
          fmousey += PAS;
-      if (input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_UP))
+      if (JOYPAD(0, RETRO_DEVICE_ID_JOYPAD_UP))
          fmousey -= PAS;
 
-      mouse_l=input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_B);
-      mouse_r=input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_A);
+      mouse_l=JOYPAD(0, RETRO_DEVICE_ID_JOYPAD_B);
+      mouse_r=JOYPAD(0, RETRO_DEVICE_ID_JOYPAD_A);
    }
 
    if(mbL==0 && mouse_l)
@@ -726,10 +1076,73 @@ void update_input(void)
       mbR=0;
    }
 
+   if (MXjoy0 || MXjoy1 || fmousex || fmousey || mouse_l || mouse_r)
+      INPUT_ACTIVE=1;
+
    Main_HandleMouseMotion();
+   return true;
+}
+
+// Give the emulation the input of the frame, either read from the frontend
+// (and recorded into a movie) or played back from a movie
+void update_input(void)
+{
+   MOVIE_INPUT input;
+
+   if (Movie_IsPlaying())
+   {
+      input_poll_cb();
+      if (Movie_PlayInput(&input))
+      {
+         MXjoy0 = input.nJoy0;
+         MXjoy1 = input.nJoy1;
+         NUMjoy = (input.nFlags & MOVIE_INPUT_TWOJOYS) ? -1 : 1;
+         INPUT_ACTIVE = 0;
+         if (!(input.nFlags & MOVIE_INPUT_MOUSE))
+            return;
+
+         if (input.nFlags & MOVIE_INPUT_LBUTTON)
+            Keyboard.bLButtonDown |= BUTTON_MOUSE;
+         else
+            Keyboard.bLButtonDown &= ~BUTTON_MOUSE;
+         if (input.nFlags & MOVIE_INPUT_RBUTTON)
+            Keyboard.bRButtonDown |= BUTTON_MOUSE;
+         else
+            Keyboard.bRButtonDown &= ~BUTTON_MOUSE;
+         fmousex = input.nMouseDx;
+         fmousey = input.nMouseDy;
+         Main_HandleMouseMotion();
+         return;
+      }
+   }
+
+   input.nFlags = read_input() ? MOVIE_INPUT_MOUSE : 0;
+   if (!Movie_IsRecording())
+      return;
+
+   input.nJoy0 = MXjoy0;
+   input.nJoy1 = MXjoy1;
+   input.nMouseDx = fmousex;
+   input.nMouseDy = fmousey;
+   if (NUMjoy < 0)
+      input.nFlags |= MOVIE_INPUT_TWOJOYS;
+   if (Keyboard.bLButtonDown & BUTTON_MOUSE)
+      input.nFlags |= MOVIE_INPUT_LBUTTON;
+   if (Keyboard.bRButtonDown & BUTTON_MOUSE)
+      input.nFlags |= MOVIE_INPUT_RBUTTON;
+   Movie_RecordInput(&input);
+}
+
+// Called on each HBL, reads the input left for the emulation by retro_run
+// a few lines before the VBL, so that the IKBD still sends it in time
+void update_input_late(int line, int lines)
+{
+   if (!LATE_INPUT || line < lines - LATE_INPUT_LINES)
+      return;
 
-   if(STATUTON==1)
-      Print_Statut();
+   LATE_INPUT=0;
+   update_input();
+   IKBD_InputSync();
 }
 
 void input_gui(void)
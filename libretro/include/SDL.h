@@ -19,10 +19,12 @@ extern int Reset_Warm(void);
 #include "SDL_types.h"
 
 #define RGB565(r, g, b)  (((r) << (5+6)) | ((g) << 6) | (b))
-#define SDL_MapRGB(a, r, g, b) RGB565( (r)>>3, (g)>>3, (b)>>3)
+#define SDL_MapRGB(a, r, g, b) ((a)->BytesPerPixel == 4 ? XRGB8888( (r), (g), (b)) \
+                                : RGB565( (r)>>3, (g)>>3, (b)>>3))
 extern long GetTicks(void);
 
 extern void retro_fillrect(SDL_Surface * surf,SDL_Rect *rect,unsigned int col);
+extern void retro_updaterects(SDL_Surface * surf, int numrects, SDL_Rect *rects);
 extern SDL_Surface *prepare_texture(int w,int h,int b);
 extern int SDL_SaveBMP(SDL_Surface *surface,const char *file);
 
@@ -59,8 +61,8 @@ Uint8 type;
 #define SDL_LockSurface(a) 0
 #define SDL_UnlockSurface(a) 0
 #define SDL_FillRect(s,r,c) retro_fillrect((s),(r),(c))
-#define SDL_UpdateRects(a, b,c)
-#define SDL_UpdateRect(...)
+#define SDL_UpdateRects(a, b,c) retro_updaterects((a),(b),(c))
+#define SDL_UpdateRect(a, ...) retro_updaterects((a),0,NULL)
 #define SDL_SetVideoMode(w, h, b, f) prepare_texture((w),(h),(b))
 //KEY
 #define SDL_GetError() "RetroWrapper"
@@ -49,6 +49,11 @@
 /* Define to 1 if you have unix domain sockets */
 //#define HAVE_UNIX_DOMAIN_SOCKETS 1
 
+/* Define to 1 if you have internet domain sockets */
+#if !defined(_WIN32) && !defined(__CELLOS_LV2__) && !defined(WIIU) && !defined(VITA)
+#define HAVE_INET_SOCKETS 1
+#endif
+
 #ifdef __LIBRETRO__
 #if defined(AND) || defined(__CELLOS_LV2__) || defined(WIIU) || defined(VITA)
 #undef HAVE_POSIX_MEMALIGN
@@ -72,6 +77,9 @@
 /* Define to 1 if you have the 'nanosleep' function. */
 //#define HAVE_NANOSLEEP 1
 
+/* Define to 1 if you have the 'clock_nanosleep' function. */
+//#define HAVE_CLOCK_NANOSLEEP 1
+
 /* Define to 1 if you have the 'alphasort' function. */
 #ifndef WIN32PORT
 #if !defined(WIIU) && !defined(VITA)
@@ -105,6 +113,16 @@
 #define utime(file,time) 0
 #endif
 
+/* Define to 1 if you have the 'mmap' function. */
+#if !defined(_WIN32) && !defined(__CELLOS_LV2__) && !defined(GEKKO) && !defined(WIIU) && !defined(VITA)
+#define HAVE_MMAP 1
+#endif
+
+/* Define to 1 if you have the <pthread.h> header file. */
+#if !defined(__CELLOS_LV2__) && !defined(GEKKO) && !defined(WIIU) && !defined(VITA) && !defined(_MSC_VER)
+#define HAVE_PTHREAD_H 1
+#endif
+
 /* Relative path from bindir to datadir */
 #define BIN2DATADIR "."
 
@@ -117,5 +135,14 @@
 /* Define to 1 to use less memory - at the expense of emulation speed */
 //#define ENABLE_SMALL_MEM 1
 
+/* Define to 1 to dispatch opcodes through a 16-bit handler index table
+ * (set by CPU_COMPACT_DISPATCH=1 in Makefile.libretro) */
+//#define ENABLE_COMPACT_DISPATCH 1
+
+/* Define to 1 to compute the STE bass/treble filter in fixed point */
+#if defined(__arm__) || defined(VITA)
+#define ENABLE_LMC_FIXED_POINT 1
+#endif
+
 /* Define to 1 to enable trace logs - undefine to slightly increase speed */
 //#define ENABLE_TRACING 1
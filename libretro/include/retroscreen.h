@@ -6,5 +6,12 @@ extern int CROP_HEIGHT;
 extern int VIRTUAL_WIDTH;
 extern int retrow ; 
 extern int retroh ;
+extern int retro_pixel_bytes; // 2 for RGB565, 4 for XRGB8888
+
+#define XRGB8888(r, g, b)  (((r) << 16) | ((g) << 8) | (b))
+// Overlays use RGB565 colours, expanded when the frontend gets XRGB8888
+#define RGB565_TO_XRGB8888(c)  XRGB8888((((c) >> 8) & 0xf8) | (((c) >> 13) & 7), \
+                                        (((c) >> 3) & 0xfc) | (((c) >> 9) & 3), \
+                                        (((c) << 3) & 0xf8) | (((c) >> 2) & 7))
 
 #endif
@@ -18,7 +18,7 @@ extern const char SDLKeyToSTScanCode[512] ;
 #include <libco.h>
 
 extern cothread_t mainThread;
-extern cothread_t emuThread;
+extern cothread_t guiThread;
 
 extern char Key_Sate[512];
 extern char Key_Sate2[512];
@@ -4,39 +4,74 @@
 
 #include "STkeymap.h"
 #include "memorySnapShot.h"
+#include "floppy.h"
+#include "movie.h"
+#include "rewind.h"
+#include "reverse.h"
+#include "rowPool.h"
+#include "stMemory.h"
+#include "ioMem.h"
+#include "dsp.h"
+#include "sound.h"
+#include "audio.h"
+#include "stats.h"
+#include "perf.h"
+#include "screen.h"
+#include "video.h"
+#include "vdi.h"
+#include "midi.h"
+#include "fdc.h"
+#include "tos.h"
+#include "utils.h"
 
 #include "retro_strings.h"
 #include "retro_files.h"
 #include "retro_disk_control.h"
+#include "retro_hw_render.h"
 static dc_storage* dc;
 
 // LOG
 retro_log_printf_t log_cb;
 
 cothread_t mainThread;
-cothread_t emuThread;
+cothread_t guiThread;
 
 int CROP_WIDTH;
 int CROP_HEIGHT;
 int VIRTUAL_WIDTH ;
 int retrow=1024; 
 int retroh=1024;
+int retro_pixel_bytes=2;
 
-extern unsigned short int bmp[1024*1024];
-extern int STATUTON,SHOWKEY,SHIFTON,pauseg,SND ,snd_sampler;
+extern unsigned short int *bmp;
+extern SDL_Surface *sdlscrn;
+extern int STATUTON,SHOWKEY,SHIFTON,pauseg,SND ,snd_sampler,REWIND;
+extern int SCREEN_UPDATED;
+extern int SCREEN_UPDATED_Y0, SCREEN_UPDATED_Y1;
 extern short signed int SNDBUF[1024*2];
 extern char RPATH[512];
 extern char RETRO_DIR[512];
 extern char RETRO_TOS[512];
+extern char RETRO_IKBD[512];
 extern struct retro_midi_interface *MidiRetroInterface;
 
 #include "cmdline.c"
 
 extern void update_input(void);
+extern void input_init(bool key_events, bool bitmasks);
+extern void RETRO_CALLCONV keyboard_event(bool down, unsigned keycode, uint32_t character, uint16_t key_modifiers);
+extern int LATE_INPUT;
+extern int INPUT_ACTIVE;
+extern long GetTicks(void);
+extern int overlay_compose(void);
+extern void overlay_restore(void);
+extern void Screen_SetFullUpdate(void);
 extern void texture_init(void);
 extern void texture_uninit(void);
+extern void texture_free(void);
 extern void Emu_init();
 extern void Emu_uninit();
+extern void pause_select(void);
 
 const char *retro_save_directory;
 const char *retro_system_directory;
@@ -47,6 +82,9 @@ static retro_audio_sample_t audio_cb;
 static retro_audio_sample_batch_t audio_batch_cb;
 static retro_environment_t environ_cb;
 static char buf[64][4096] = { 0 };
+static int stats_frames = 0;
+static bool perf_osd = false;
+static int perf_frames = 0;
 
 unsigned int video_config = 0;
 #define HATARI_VIDEO_HIRES 	0x04
@@ -61,10 +99,49 @@ int CHANGE_RATE = 0, CHANGEAV_TIMING = 0;
 float FRAMERATE = 50.0, SAMPLERATE = 44100.0;
 
 bool hatari_fastfdc = true;
+bool hatari_turbofdc = false;
+bool hatari_ikbd_rom = false;
+bool hatari_late_input = false;
+int hatari_runahead = 0;
+bool hatari_deterministic = false;
+bool hatari_boot_cache = false;
+int hatari_auto_turbo = 0;
+bool hatari_huge_pages = false;
 bool hatari_borders = true;
-char hatari_frameskips[2];
+bool hatari_video_native = false;
+char hatari_frameskips[3];
+bool hatari_frameskip_adaptive = false;
 int firstpass = 1;
-char savestate_fname[RETRO_PATH_MAX];
+int hatari_rewind_secs = 0;
+
+// The machine state is global to the process, so there can only be
+// one game loaded at a time, whatever the frontend does
+static bool game_loaded = false;
+
+// Savestates are kept in memory, uncompressed
+static size_t savestate_size = 0;
+static MACHINETYPE savestate_machine;
+static int savestate_memsize;
+static int savestate_floppies;
+// State after the last real frame, while the run-ahead frames are emulated
+// (ST-RAM is kept apart, in the backup of stMemory.c)
+static void *runahead_state = NULL;
+static size_t runahead_state_size = 0;
+
+// Boot snapshot cache: on the first launch with a given setup, the state
+// at the start of the frame in which TOS reads the boot sector is saved,
+// later launches restore it and only insert their disks
+enum { BOOTCACHE_START, BOOTCACHE_RECORD, BOOTCACHE_DONE };
+static int bootcache_step = BOOTCACHE_START;
+static char bootcache_path[RETRO_PATH_MAX];
+static void *bootcache_state = NULL;
+static int bootcache_used = 0;
+static Uint32 bootcache_reads;
+
+// Frontend can repeat the previous frame when video_cb gets NULL
+static bool can_dupe = false;
+// Pixels the emulation rendered into on the previous frame
+static void *video_target = NULL;
 
 static struct retro_input_descriptor input_descriptors[] = {
    { 0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_UP, "Up" },
@@ -81,6 +158,7 @@ static struct retro_input_descriptor input_descriptors[] = {
    { 0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_R, "Mouse speed" },
    { 0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_L2, "Status display" },
    { 0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_R2, "Virtual keyboard page" },
+   { 0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_L3, "Rewind" },
    { 0, RETRO_DEVICE_ANALOG, RETRO_DEVICE_INDEX_ANALOG_LEFT, RETRO_DEVICE_ID_ANALOG_X, "Joystick/Mouse X" },
    { 0, RETRO_DEVICE_ANALOG, RETRO_DEVICE_INDEX_ANALOG_LEFT, RETRO_DEVICE_ID_ANALOG_Y, "Joystick/Mouse Y" },
    { 1, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_UP, "Up" },
@@ -115,6 +193,99 @@ void retro_set_environment(retro_environment_t cb)
          },
          "true"
        },
+       {
+         "hatari_turbofdc",
+         "Turbo floppy access",
+         "Loads ST/MSA/DIM disks at host speed, exact timings are restored if a protection polls the FDC",
+         {
+           { "false", "disabled" },
+           { "true", "enabled" },
+           { NULL, NULL },
+         },
+         "false"
+       },
+       // Keyboard
+       {
+         "hatari_ikbd_rom",
+         "Real IKBD ROM",
+         "Runs ikbd.img from the system directory on an emulated HD6301 (needs restart)",
+         {
+           { "false", "disabled" },
+           { "true", "enabled" },
+           { NULL, NULL },
+         },
+         "false"
+       },
+       {
+         "hatari_late_input",
+         "Late input polling",
+         "Reads the controllers near the end of the frame instead of before it, sending them to the IKBD at once",
+         {
+           { "false", "disabled" },
+           { "true", "enabled" },
+           { NULL, NULL },
+         },
+         "false"
+       },
+       {
+         "hatari_runahead",
+         "Run-ahead",
+         "Hides frames of input lag by showing the future ones, each costs one more frame of emulation (not with GEMDOS drives)",
+         {
+           { "0", "disabled" },
+           { "1", "1 frame" },
+           { "2", "2 frames" },
+           { "3", "3 frames" },
+           { "4", "4 frames" },
+           { NULL, NULL },
+         },
+         "0"
+       },
+       {
+         "hatari_netplay",
+         "Netplay safe mode",
+         "Emulates the same way on all hosts (clocks, file dates, random numbers) and logs a state hash per frame",
+         {
+           { "false", "disabled" },
+           { "true", "enabled" },
+           { NULL, NULL },
+         },
+         "false"
+       },
+       {
+         "hatari_boot_cache",
+         "Boot snapshot cache",
+         "Saves the machine just before it boots from floppy, later launches with the same setup start from there (not with hard disks)",
+         {
+           { "false", "disabled" },
+           { "true", "enabled" },
+           { NULL, NULL },
+         },
+         "false"
+       },
+       {
+         "hatari_auto_turbo",
+         "Automatic turbo",
+         "Emulates as fast as possible without sound while TOS boots and the floppy drive works, stops on input",
+         {
+           { "0", "disabled" },
+           { "1", "boot and disk access" },
+           { "2", "boot, disk access and still screens" },
+           { NULL, NULL },
+         },
+         "0"
+       },
+       {
+         "hatari_huge_pages",
+         "Huge memory pages",
+         "Backs the emulated RAM with huge host pages where available, for fewer TLB misses",
+         {
+           { "false", "disabled" },
+           { "true", "enabled" },
+           { NULL, NULL },
+         },
+         "false"
+       },
        // Video
        {
          "hatari_video_hires",
@@ -138,10 +309,43 @@ void retro_set_environment(retro_environment_t cb)
          },
          "false"
       },  
+      {
+         "hatari_video_native",
+         "Native resolution",
+         "Needs restart, outputs the ST screen at its own size (low resolution undoubled, e.g. 416x276 with borders) and leaves the scaling to the frontend",
+         {
+            { "false", "disabled" },
+            { "true", "enabled" },
+            { NULL, NULL },
+         },
+         "false"
+      },
+      {
+         "hatari_video_pixel_format",
+         "Pixel format",
+         "Needs restart, XRGB8888 saves the conversion to RGB565 and its expansion by the frontend",
+         {
+            { "RGB565", NULL },
+            { "XRGB8888", NULL },
+            { NULL, NULL },
+         },
+         "RGB565"
+      },
+      {
+         "hatari_video_renderer",
+         "Renderer",
+         "Needs restart, OpenGL decodes the ST low and medium resolution screens on the GPU",
+         {
+            { "software", NULL },
+            { "opengl", "OpenGL" },
+            { NULL, NULL },
+         },
+         "software"
+      },
       {
          "hatari_frameskips",
          "Frameskip",
-         "Needs restart",
+         "Frames skipped after each drawn one, the auto settings skip up to that many while the host is too slow",
          {
             { "0", "disabled" },
             { "1", NULL },
@@ -154,6 +358,142 @@ void retro_set_environment(retro_environment_t cb)
          },
          "0"
       },
+      {
+         "hatari_frameskip_adaptive",
+         "Adaptive frameskip",
+         "Skip drawing frames while the host needs more than a frame's time to emulate them, at most as many as the auto frameskip setting or 5. Sound and emulation speed aren't affected",
+         {
+            { "false", "disabled" },
+            { "true", "enabled" },
+            { NULL, NULL },
+         },
+         "false"
+      },
+      {
+         "hatari_headless",
+         "Headless fast-forward",
+         "Skip the screen conversion and audio output, draw only every Nth frame or the frames requested for screenshots",
+         {
+            { "disabled", NULL },
+            { "0", "requested frames only" },
+            { "50", "every 50th frame" },
+            { "250", "every 250th frame" },
+            { "1000", "every 1000th frame" },
+            { NULL, NULL },
+         },
+         "disabled"
+      },
+      {
+         "hatari_convert_threads",
+         "Falcon/TT conversion threads",
+         "Share the rows of the Falcon and TT screens between this many host cores",
+         {
+            { "1", "disabled" },
+            { "2", NULL },
+            { "3", NULL },
+            { "4", NULL },
+            { NULL, NULL },
+         },
+         "1"
+      },
+      // Rewind
+      {
+         "hatari_rewind",
+         "Rewind",
+         "Keep the last seconds of emulation, hold L3 to step back",
+         {
+            { "0", "disabled" },
+            { "5", "5 seconds" },
+            { "10", "10 seconds" },
+            { "30", "30 seconds" },
+            { NULL, NULL },
+         },
+         "0"
+      },
+      // Falcon DSP
+      {
+         "hatari_dsp_thread",
+         "DSP on own thread",
+         "Run the Falcon DSP in parallel to the CPU on another host core",
+         {
+            { "false", "disabled" },
+            { "true", "enabled" },
+            { NULL, NULL },
+         },
+         "false"
+      },
+      {
+         "hatari_dsp_quantum",
+         "DSP batch size",
+         "Run the Falcon DSP in batches of this many cycles instead of in lockstep with the CPU, until the CPU accesses it. Faster, but DSP output may come later",
+         {
+            { "0", "lockstep" },
+            { "256", "256 cycles" },
+            { "1024", "1024 cycles" },
+            { "4096", "4096 cycles" },
+            { NULL, NULL },
+         },
+         "0"
+      },
+      // Sound
+      {
+         "hatari_ym_blep",
+         "YM band limited synthesis",
+         "Place YM2149 waveform edges between output samples to remove aliasing of high pitched voices",
+         {
+            { "false", "disabled" },
+            { "true", "enabled" },
+            { NULL, NULL },
+         },
+         "false"
+      },
+      {
+         "hatari_sound_thread",
+         "Sound on own thread",
+         "Generate YM2149 sound in parallel to the emulation on another host core",
+         {
+            { "false", "disabled" },
+            { "true", "enabled" },
+            { NULL, NULL },
+         },
+         "false"
+      },
+      {
+         "hatari_audio_rate",
+         "Audio output rate",
+         "Render sound directly at this rate. Set it to the audio driver's output rate, so that the frontend doesn't need to resample it again",
+         {
+            { "44100", "44100 Hz" },
+            { "48000", "48000 Hz" },
+            { "32000", "32000 Hz" },
+            { "22050", "22050 Hz" },
+            { NULL, NULL },
+         },
+         "44100"
+      },
+      // Statistics
+      {
+         "hatari_stats",
+         "Log frame statistics",
+         "Count CPU/DSP instructions, interrupts, IO accesses, blitter words, converted lines and audio samples, and log the last frame's counts once per second",
+         {
+            { "false", "disabled" },
+            { "true", "enabled" },
+            { NULL, NULL },
+         },
+         "false"
+      },
+      {
+         "hatari_perf_osd",
+         "Show frame time breakdown",
+         "Time the CPU, DSP, interrupt handlers, screen conversion, audio, overlays and presentation of each frame, and show the frame time percentiles and the 95th percentile of each stage on screen once per second",
+         {
+            { "false", "disabled" },
+            { "true", "enabled" },
+            { NULL, NULL },
+         },
+         "false"
+      },
 	  
       { NULL, NULL, NULL, {{0}}, NULL },
 	};
@@ -212,6 +552,102 @@ static void update_variables(void)
       ConfigureParams.DiskImage.FastFloppy = hatari_fastfdc;
    }
 
+   var.key = "hatari_turbofdc";
+   var.value = NULL;
+   bool new_hatari_turbofdc = false;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   {
+      if(strcmp(var.value, "true") == 0)
+         new_hatari_turbofdc = true;
+   }
+   if (new_hatari_turbofdc != hatari_turbofdc) // switch immediately
+   {
+      hatari_turbofdc = new_hatari_turbofdc;
+      ConfigureParams.DiskImage.TurboFloppy = hatari_turbofdc;
+   }
+
+   // Keyboard
+   var.key = "hatari_ikbd_rom";
+   var.value = NULL;
+   bool new_hatari_ikbd_rom = false;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   {
+      if(strcmp(var.value, "true") == 0)
+         new_hatari_ikbd_rom = true;
+   }
+   if (new_hatari_ikbd_rom != hatari_ikbd_rom) // used at next cold reset
+   {
+      hatari_ikbd_rom = new_hatari_ikbd_rom;
+      snprintf(ConfigureParams.Rom.szIkbdRomFileName, FILENAME_MAX, "%s", hatari_ikbd_rom ? RETRO_IKBD : "");
+   }
+
+   var.key = "hatari_late_input";
+   var.value = NULL;
+   hatari_late_input = false;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   {
+      if(strcmp(var.value, "true") == 0)
+         hatari_late_input = true;
+   }
+
+   var.key = "hatari_runahead";
+   var.value = NULL;
+   hatari_runahead = 0;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+      hatari_runahead = atoi(var.value);
+
+   var.key = "hatari_boot_cache";
+   var.value = NULL;
+   hatari_boot_cache = false;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   {
+      if(strcmp(var.value, "true") == 0)
+         hatari_boot_cache = true;
+   }
+
+   var.key = "hatari_auto_turbo";
+   var.value = NULL;
+   hatari_auto_turbo = 0;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+      hatari_auto_turbo = atoi(var.value);
+
+   var.key = "hatari_huge_pages";
+   var.value = NULL;
+   hatari_huge_pages = false;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   {
+      if(strcmp(var.value, "true") == 0)
+         hatari_huge_pages = true;
+   }
+   if (hatari_huge_pages != ConfigureParams.Memory.bHugePages)
+   {
+      ConfigureParams.Memory.bHugePages = hatari_huge_pages;
+      STMemory_SetHugePages(hatari_huge_pages);
+   }
+
+   var.key = "hatari_netplay";
+   var.value = NULL;
+   bool new_hatari_deterministic = false;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   {
+      if(strcmp(var.value, "true") == 0)
+         new_hatari_deterministic = true;
+   }
+   if (new_hatari_deterministic != hatari_deterministic) // random seed at next cold reset
+   {
+      hatari_deterministic = new_hatari_deterministic;
+      ConfigureParams.System.bDeterministic = hatari_deterministic;
+      DSP_EnableThread(ConfigureParams.System.bDSPThread);
+   }
+
    // Video
    var.key = "hatari_video_hires";
    var.value = NULL;
@@ -232,12 +668,172 @@ static void update_variables(void)
          new_video_config |= HATARI_VIDEO_CROP;
    }
 
+   var.key = "hatari_video_native";
+   var.value = NULL;
+   hatari_video_native = false;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   {
+      if(strcmp(var.value, "true") == 0)
+         hatari_video_native = true;
+   }
+
    var.key = "hatari_frameskips";
    var.value = NULL;
 
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value
+       && strcmp(var.value, hatari_frameskips) != 0)
+   {
+      snprintf(hatari_frameskips, sizeof(hatari_frameskips), "%s", var.value);
+      ConfigureParams.Screen.nFrameSkips = atoi(hatari_frameskips);
+      if (ConfigureParams.Screen.nFrameSkips < AUTO_FRAMESKIP_LIMIT)
+         nFrameSkips = ConfigureParams.Screen.nFrameSkips;
+   }
+
+   var.key = "hatari_frameskip_adaptive";
+   var.value = NULL;
+   bool new_adaptive = false;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+      new_adaptive = !strcmp(var.value, "true");
+   if (new_adaptive != hatari_frameskip_adaptive)
+   {
+      hatari_frameskip_adaptive = new_adaptive;
+      ConfigureParams.Screen.bAdaptiveFrameSkip = new_adaptive;
+      if (ConfigureParams.Screen.nFrameSkips < AUTO_FRAMESKIP_LIMIT)
+         nFrameSkips = ConfigureParams.Screen.nFrameSkips;
+      else
+         nFrameSkips = 0;
+   }
+
+   var.key = "hatari_headless";
+   var.value = NULL;
+   bool old_headless = bVideoHeadless;
+   bVideoHeadless = false;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value
+       && strcmp(var.value, "disabled") != 0)
+   {
+      bVideoHeadless = true;
+      nVideoHeadlessSample = atoi(var.value);
+   }
+
+   // Headless mode is only useful when the frontend doesn't pace it
+   if (bVideoHeadless != old_headless)
+   {
+      struct retro_fastforwarding_override ff;
+      ff.ratio = 0.0f;
+      ff.fastforward = bVideoHeadless;
+      ff.notification = false;
+      ff.inhibit_toggle = bVideoHeadless;
+      environ_cb(RETRO_ENVIRONMENT_SET_FASTFORWARDING_OVERRIDE, &ff);
+   }
+
+   var.key = "hatari_convert_threads";
+   var.value = NULL;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value
+       && atoi(var.value) != ConfigureParams.Screen.nConvertThreads)
+   {
+      ConfigureParams.Screen.nConvertThreads = atoi(var.value);
+      RowPool_SetThreads(ConfigureParams.Screen.nConvertThreads);
+   }
+
+   var.key = "hatari_rewind";
+   var.value = NULL;
+   int new_rewind_secs = 0;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+      new_rewind_secs = atoi(var.value);
+   if (new_rewind_secs != hatari_rewind_secs)
+   {
+      hatari_rewind_secs = new_rewind_secs;
+      if (!Rewind_Init(hatari_rewind_secs * (int)FRAMERATE))
+         log_cb(RETRO_LOG_ERROR, "Rewind buffer allocation failed.\n");
+   }
+
+   var.key = "hatari_dsp_thread";
+   var.value = NULL;
+   bool new_dsp_thread = false;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+      new_dsp_thread = !strcmp(var.value, "true");
+   if (new_dsp_thread != ConfigureParams.System.bDSPThread)
+   {
+      ConfigureParams.System.bDSPThread = new_dsp_thread;
+      DSP_EnableThread(new_dsp_thread);
+   }
+
+   var.key = "hatari_dsp_quantum";
+   var.value = NULL;
+   int new_dsp_quantum = 0;
+
    if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+      new_dsp_quantum = atoi(var.value);
+   if (new_dsp_quantum != ConfigureParams.System.nDSPQuantum)
    {
-      strncpy((char*)hatari_frameskips, var.value, 2);
+      ConfigureParams.System.nDSPQuantum = new_dsp_quantum;
+      DSP_SetQuantum(new_dsp_quantum);
+   }
+
+   var.key = "hatari_ym_blep";
+   var.value = NULL;
+
+   // Only wait for the sound thread when the synthesis really changes
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value
+       && !strcmp(var.value, "true") != UseBlepSynthesis)
+   {
+      ConfigureParams.Sound.bYmBlepSynthesis = !strcmp(var.value, "true");
+      Sound_ThreadSync();
+      UseBlepSynthesis = ConfigureParams.Sound.bYmBlepSynthesis;
+   }
+
+   var.key = "hatari_sound_thread";
+   var.value = NULL;
+   bool new_sound_thread = false;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+      new_sound_thread = !strcmp(var.value, "true");
+   if (new_sound_thread != ConfigureParams.Sound.bSoundThread)
+   {
+      ConfigureParams.Sound.bSoundThread = new_sound_thread;
+      Sound_EnableThread(new_sound_thread);
+   }
+
+   var.key = "hatari_audio_rate";
+   var.value = NULL;
+
+   // YM steps, DMA sound and crossbar ratios follow nAudioFrequency,
+   // and the new rate is announced to the frontend on next retro_run
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   {
+      ConfigureParams.Sound.nPlaybackFreq = atoi(var.value);
+      Audio_SetOutputAudioFreq(ConfigureParams.Sound.nPlaybackFreq);
+   }
+
+   var.key = "hatari_stats";
+   var.value = NULL;
+   bool new_stats = false;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+      new_stats = !strcmp(var.value, "true");
+   if (new_stats != Stats_bEnabled)
+   {
+      Stats_Enable(new_stats);
+      stats_frames = 0;
+   }
+
+   var.key = "hatari_perf_osd";
+   var.value = NULL;
+   bool new_perf_osd = false;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+      new_perf_osd = !strcmp(var.value, "true");
+   if (new_perf_osd != perf_osd)
+   {
+      perf_osd = new_perf_osd;
+      Perf_Enable(perf_osd);
+      perf_frames = 0;
    }
 
    if (new_video_config != video_config)
@@ -277,26 +873,38 @@ static void update_variables(void)
    }
 }
 
-static void retro_wrap_emulator()
+// The GUI dialogs are modal loops, they run on their own cothread
+// that gui_poll_events() leaves once per frame
+static void retro_wrap_gui(void)
 {
-log_cb(RETRO_LOG_INFO, "WRAP EMU THD\n");
-   pre_main(RPATH);
-log_cb(RETRO_LOG_INFO, "EXIT EMU THD\n");
-   pauseg=-1;
-
-   environ_cb(RETRO_ENVIRONMENT_SHUTDOWN, 0); 
-
-   // Were done here
-   co_switch(mainThread);
-
-   // Dead emulator, but libco says not to return
    while(true)
    {
-      log_cb(RETRO_LOG_INFO, "Running a dead emulator.");
+      pause_select();
       co_switch(mainThread);
    }
 }
 
+// Emulate one frame, up to the next VBL. While the GUI is open, it
+// runs instead of the emulation.
+static void emu_frame(void)
+{
+   static bool quit = false;
+
+   if (pauseg == 1)
+   {
+      co_switch(guiThread);
+      return;
+   }
+
+   if (quit || Main_RunFrame())
+      return;
+
+   log_cb(RETRO_LOG_INFO, "EXIT EMU\n");
+   quit = true;
+   pauseg = -1;
+   environ_cb(RETRO_ENVIRONMENT_SHUTDOWN, 0);
+}
+
 void Emu_init()
 {
 #ifdef RETRO_AND
@@ -308,10 +916,10 @@ void Emu_init()
    memset(Key_Sate,0,512);
    memset(Key_Sate2,0,512);
 
-   if(!emuThread && !mainThread)
+   if(!guiThread && !mainThread)
    {
       mainThread = co_active();
-      emuThread = co_create(65536*sizeof(void*), retro_wrap_emulator);
+      guiThread = co_create(65536*sizeof(void*), retro_wrap_gui);
    }
 
    update_variables();
@@ -320,6 +928,7 @@ void Emu_init()
 void Emu_uninit()
 {
    texture_uninit();
+   texture_free();
 }
 
 void retro_shutdown_hatari(void)
@@ -329,9 +938,12 @@ void retro_shutdown_hatari(void)
    environ_cb(RETRO_ENVIRONMENT_SHUTDOWN, NULL);
 }
 
+static void auto_turbo_reset(void);
+
 void retro_reset(void){
    update_variables();
    Reset_Warm();
+   auto_turbo_reset();
 }
 
 //*****************************************************************************
@@ -340,17 +952,40 @@ void retro_reset(void){
 extern bool Floppy_EjectDiskFromDrive(int Drive);
 extern const char* Floppy_SetDiskFileName(int Drive, const char *pszFileName, const char *pszZipPath);
 extern bool Floppy_InsertDiskIntoDrive(int Drive);
+extern void Floppy_Prefetch(const char *pszFileName);
+
+// Read the disk following the current one in the background,
+// so that swapping to it doesn't stall the emulation
+static void disk_prefetch_next(void)
+{
+	if (dc && dc->count > 1)
+	{
+		unsigned next = (dc->index + 1) % dc->count;
+		if (dc->files[next])
+			Floppy_Prefetch(dc->files[next]);
+	}
+}
 
 static bool disk_set_eject_state(bool ejected)
 {
 	if (dc)
 	{
+		bool ret;
+
 		dc->eject_state = ejected;
 		
 		if(dc->eject_state)
+		{
+			if (Movie_IsRecording())
+				Movie_RecordDisk(0, NULL);
 			return Floppy_EjectDiskFromDrive(0);
-		else
-			return Floppy_InsertDiskIntoDrive(0);			
+		}
+
+		ret = Floppy_InsertDiskIntoDrive(0);
+		if (ret && Movie_IsRecording())
+			Movie_RecordDisk(0, ConfigureParams.DiskImage.szDiskFileName[0]);
+		disk_prefetch_next();
+		return ret;
 	}
 	
 	return true;
@@ -386,6 +1021,8 @@ static bool disk_set_image_index(unsigned index)
 		{
 			dc->index = index;
 			Floppy_SetDiskFileName(0, dc->files[index], NULL);
+			// The frontend inserts it once the tray is closed
+			Floppy_Prefetch(dc->files[index]);
 			log_cb(RETRO_LOG_INFO, "Disk (%d) inserted into drive A : %s\n", dc->index+1, dc->files[dc->index]);
 			return true;
 		}
@@ -502,15 +1139,37 @@ void retro_init(void)
    log_cb(RETRO_LOG_INFO, "Retro SAVE_DIRECTORY %s\n",retro_save_directory);
    log_cb(RETRO_LOG_INFO, "Retro CONTENT_DIRECTORY %s\n",retro_content_directory);
 
-   enum retro_pixel_format fmt = RETRO_PIXEL_FORMAT_RGB565;
-   if (!environ_cb(RETRO_ENVIRONMENT_SET_PIXEL_FORMAT, &fmt))
+   // The pixel format can only be set here, so the option needs a restart
+   struct retro_variable var = { "hatari_video_pixel_format", NULL };
+   enum retro_pixel_format fmt = RETRO_PIXEL_FORMAT_XRGB8888;
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value
+       && !strcmp(var.value, "XRGB8888")
+       && environ_cb(RETRO_ENVIRONMENT_SET_PIXEL_FORMAT, &fmt))
    {
-      log_cb(RETRO_LOG_ERROR, "RGB565 is not supported.\n");
-      exit(0);
+      retro_pixel_bytes = 4;
+   }
+   else
+   {
+      fmt = RETRO_PIXEL_FORMAT_RGB565;
+      if (!environ_cb(RETRO_ENVIRONMENT_SET_PIXEL_FORMAT, &fmt))
+      {
+         log_cb(RETRO_LOG_ERROR, "RGB565 is not supported.\n");
+         exit(0);
+      }
+      retro_pixel_bytes = 2;
    }
 
 	environ_cb(RETRO_ENVIRONMENT_SET_INPUT_DESCRIPTORS, input_descriptors);
 
+   // Take keys as they change and the joypad buttons as one bitmask,
+   // rather than polling each key and button every frame
+   struct retro_keyboard_callback keyboard = { keyboard_event };
+   input_init(environ_cb(RETRO_ENVIRONMENT_SET_KEYBOARD_CALLBACK, &keyboard),
+              environ_cb(RETRO_ENVIRONMENT_GET_INPUT_BITMASKS, NULL));
+
+   if (!environ_cb(RETRO_ENVIRONMENT_GET_CAN_DUPE, &can_dupe))
+      can_dupe = false;
+
    static struct retro_midi_interface midi_interface;
 
    if(environ_cb(RETRO_ENVIRONMENT_GET_MIDI_INTERFACE, &midi_interface))
@@ -522,7 +1181,7 @@ void retro_init(void)
 	environ_cb(RETRO_ENVIRONMENT_SET_DISK_CONTROL_INTERFACE, &disk_interface);
 
    // Savestates
-   static uint32_t quirks = RETRO_SERIALIZATION_QUIRK_INCOMPLETE | RETRO_SERIALIZATION_QUIRK_MUST_INITIALIZE | RETRO_SERIALIZATION_QUIRK_CORE_VARIABLE_SIZE;
+   static uint32_t quirks = RETRO_SERIALIZATION_QUIRK_INCOMPLETE | RETRO_SERIALIZATION_QUIRK_MUST_INITIALIZE;
    environ_cb(RETRO_ENVIRONMENT_SET_SERIALIZATION_QUIRKS, &quirks);
 
    // Init
@@ -533,11 +1192,24 @@ void retro_init(void)
 void retro_deinit(void)
 {	 
    Emu_uninit(); 
-
-   if(emuThread)
+   Rewind_UnInit();
+   Movie_UnInit();
+   Sound_UnInit();
+
+   savestate_size = 0;
+   free(runahead_state);
+   runahead_state = NULL;
+   runahead_state_size = 0;
+   STMemory_RamBackupFree();
+   DSP_RamBackupFree();
+   free(bootcache_state);
+   bootcache_state = NULL;
+   bootcache_step = BOOTCACHE_START;
+
+   if(guiThread)
    {
-      co_delete(emuThread);
-      emuThread = 0;
+      co_delete(guiThread);
+      guiThread = 0;
    }
 
 	// Clean the m3u storage
@@ -609,17 +1281,358 @@ void update_timing(void)
    snd_sampler = (int)SAMPLERATE / (int)FRAMERATE;
 }
 
+// With native resolution output the frame size follows the ST screen,
+// tell the frontend its size and aspect ratio when that changes
+static void update_native_geometry(unsigned width, unsigned height)
+{
+   static unsigned geometry_w, geometry_h;
+   struct retro_game_geometry geom = { width, height, 1024, 1024, 4.0 / 3.0 };
+
+   if (width == geometry_w && height == geometry_h)
+      return;
+   geometry_w = width;
+   geometry_h = height;
+
+   // ST/STE 320x200 and 640x400 screens fill a 4:3 monitor,
+   // TT and Falcon video modes have (nearly) square pixels
+   if (ConfigureParams.System.nMachineType == MACHINE_TT
+       || ConfigureParams.System.nMachineType == MACHINE_FALCON)
+      geom.aspect_ratio = (float)width / height;
+   else
+      geom.aspect_ratio = (float)width * 5 / (height * 6);
+   environ_cb(RETRO_ENVIRONMENT_SET_GEOMETRY, &geom);
+}
+
+static size_t savestate_get_size(void);
+
+static bool runahead_capture(void)
+{
+   size_t size = savestate_get_size();
+   int used;
+
+   if (!size)
+      return false;
+   if (size > runahead_state_size)
+   {
+      void *state = realloc(runahead_state, size);
+      if (!state)
+         return false;
+      runahead_state = state;
+      runahead_state_size = size;
+   }
+   STMemory_bSnapShotRamBackup = true;
+   used = MemorySnapShot_CaptureMem(runahead_state, runahead_state_size);
+   STMemory_bSnapShotRamBackup = false;
+   return used > 0;
+}
+
+// Everything that changes what happens before the boot sector is read,
+// except the disks themselves
+static Uint32 bootcache_key(void)
+{
+   Uint32 hash, cfg[16];
+   int i, n = 0;
+
+   cfg[n++] = ConfigureParams.System.nMachineType;
+   cfg[n++] = ConfigureParams.Memory.nMemorySize;
+   cfg[n++] = ConfigureParams.System.nCpuLevel;
+   cfg[n++] = ConfigureParams.System.nCpuFreq;
+   cfg[n++] = ConfigureParams.System.bCompatibleCpu;
+   cfg[n++] = ConfigureParams.System.bBlitter;
+   cfg[n++] = ConfigureParams.System.nDSPType;
+   cfg[n++] = ConfigureParams.System.bRealTimeClock;
+   cfg[n++] = ConfigureParams.System.bPatchTimerD;
+   cfg[n++] = ConfigureParams.System.bFastBoot;
+   cfg[n++] = ConfigureParams.Screen.nMonitorType;
+   cfg[n++] = ConfigureParams.DiskImage.EnableDriveA | ConfigureParams.DiskImage.EnableDriveB << 1;
+   cfg[n++] = ConfigureParams.DiskImage.DriveA_NumberOfHeads | ConfigureParams.DiskImage.DriveB_NumberOfHeads << 4;
+   cfg[n++] = ConfigureParams.DiskImage.FastFloppy | ConfigureParams.DiskImage.TurboFloppy << 1;
+   cfg[n++] = hatari_ikbd_rom;
+
+   hash32_reset(&hash);
+   hash32_add_block(&hash, &RomMem[TosAddress], TosSize);
+   for (i = 0; i < n; i++)
+      hash32_add_block(&hash, (Uint8 *)&cfg[i], sizeof(cfg[i]));
+   return hash;
+}
+
+static bool bootcache_possible(void)
+{
+   int i;
+
+   if (!hatari_boot_cache || ConfigureParams.HardDisk.bUseHardDiskDirectories
+       || ConfigureParams.HardDisk.bUseIdeMasterHardDiskImage
+       || ConfigureParams.HardDisk.bUseIdeSlaveHardDiskImage)
+      return false;
+   for (i = 0; i < MAX_ACSI_DEVS; i++)
+      if (ConfigureParams.Acsi[i].bUseDevice)
+         return false;
+   return true;
+}
+
+// Called before each frame until the boot snapshot was used or saved
+static void bootcache_frame(void)
+{
+   char name[32];
+   char disks[MAX_FLOPPYDRIVES][FILENAME_MAX], zips[MAX_FLOPPYDRIVES][FILENAME_MAX];
+   FILE *f;
+   long size;
+   int i;
+
+   if (bootcache_step == BOOTCACHE_START)
+   {
+      bootcache_step = BOOTCACHE_DONE;
+      if (!bootcache_possible())
+         return;
+
+      snprintf(name, sizeof(name), "hatari_boot_%08x.sna", bootcache_key());
+      path_join(bootcache_path, retro_save_directory ? retro_save_directory : RETRO_DIR, name);
+
+      f = fopen(bootcache_path, "rb");
+      if (!f)
+      {
+         bootcache_step = BOOTCACHE_RECORD;
+         bootcache_reads = FDC_BootSectorReads;
+         return;
+      }
+      fseek(f, 0, SEEK_END);
+      size = ftell(f);
+      fseek(f, 0, SEEK_SET);
+      bootcache_state = malloc(size > 0 ? size : 1);
+      if (bootcache_state && size > 0 && fread(bootcache_state, 1, size, f) == (size_t)size)
+      {
+         // The snapshot brings back the disks of the first launch
+         for (i = 0; i < MAX_FLOPPYDRIVES; i++)
+         {
+            strcpy(disks[i], ConfigureParams.DiskImage.szDiskFileName[i]);
+            strcpy(zips[i], ConfigureParams.DiskImage.szDiskZipPath[i]);
+         }
+         if (MemorySnapShot_RestoreMem(bootcache_state, size))
+         {
+            for (i = 0; i < MAX_FLOPPYDRIVES; i++)
+            {
+               Floppy_EjectDiskFromDrive(i);
+               if (disks[i][0] && Floppy_SetDiskFileName(i, disks[i], zips[i][0] ? zips[i] : NULL))
+                  Floppy_InsertDiskIntoDrive(i);
+            }
+            log_cb(RETRO_LOG_INFO, "Booted from snapshot %s\n", bootcache_path);
+         }
+      }
+      fclose(f);
+   }
+   else if (FDC_BootSectorReads != bootcache_reads)
+   {
+      // The boot sector was read during the previous frame, keep the
+      // state from before it
+      bootcache_step = BOOTCACHE_DONE;
+      if (bootcache_used > 0 && (f = fopen(bootcache_path, "wb")))
+      {
+         if (fwrite(bootcache_state, 1, bootcache_used, f) != (size_t)bootcache_used)
+            log_cb(RETRO_LOG_WARN, "Can't write boot snapshot %s\n", bootcache_path);
+         fclose(f);
+      }
+   }
+   else
+   {
+      size = savestate_get_size();
+      if (!bootcache_state)
+         bootcache_state = malloc(size);
+      if (!bootcache_state)
+      {
+         bootcache_step = BOOTCACHE_DONE;
+         return;
+      }
+      bootcache_used = MemorySnapShot_CaptureMem(bootcache_state, size);
+      return;
+   }
+
+   free(bootcache_state);
+   bootcache_state = NULL;
+   bootcache_used = 0;
+}
+
+static bool runahead_active(void)
+{
+   return hatari_runahead > 0 && pauseg == 0 && !firstpass && !REWIND
+       && !Reverse_IsEnabled()
+       && !ConfigureParams.HardDisk.bUseHardDiskDirectories
+       && !ConfigureParams.RS232.bEnableRS232
+       && !(MidiRetroInterface && (MidiRetroInterface->output_enabled()
+                                   || MidiRetroInterface->input_enabled()));
+}
+
+// Automatic turbo: while TOS boots, the FDC works or (optionally) the
+// screen doesn't change, hidden frames are emulated before the presented
+// one for up to 3/4 of a frame of host time, and their sound is dropped
+#define AUTO_TURBO_BOOT_FRAMES   500 // at most 10 s after a reset are the boot
+#define AUTO_TURBO_DISK_FRAMES   25  // keeps going between FDC commands
+#define AUTO_TURBO_STILL_FRAMES  50  // unchanged frames for a still screen
+#define AUTO_TURBO_MAX_FRAMES    32
+
+static int turbo_boot_frames = 0;
+static Uint32 turbo_boot_reads = 0;
+static int turbo_disk_frames = 0;
+static int turbo_still_frames = 0;
+
+static void auto_turbo_reset(void)
+{
+   turbo_boot_frames = AUTO_TURBO_BOOT_FRAMES;
+   turbo_boot_reads = FDC_BootSectorReads;
+   turbo_disk_frames = turbo_still_frames = 0;
+}
+
+// Called after each frame, presented tells whether the screen was drawn
+static void auto_turbo_update(bool presented)
+{
+   if (turbo_boot_frames > 0 && (--turbo_boot_frames == 0
+                                 || FDC_BootSectorReads != turbo_boot_reads))
+      turbo_boot_frames = 0;
+
+   if (FDC_IsBusy())
+      turbo_disk_frames = AUTO_TURBO_DISK_FRAMES;
+   else if (turbo_disk_frames > 0)
+      turbo_disk_frames--;
+
+   if (presented)
+      turbo_still_frames = SCREEN_UPDATED ? 0 : turbo_still_frames + 1;
+
+   if (INPUT_ACTIVE)
+      turbo_boot_frames = turbo_still_frames = 0;
+}
+
+static bool auto_turbo_wanted(void)
+{
+   if (hatari_auto_turbo == 0 || pauseg != 0 || firstpass || REWIND
+       || INPUT_ACTIVE || SHOWKEY == 1 || hatari_deterministic
+       || ConfigureParams.RS232.bEnableRS232
+       || (MidiRetroInterface && (MidiRetroInterface->output_enabled()
+                                  || MidiRetroInterface->input_enabled())))
+      return false;
+
+   return turbo_boot_frames > 0 || turbo_disk_frames > 0
+       || (hatari_auto_turbo == 2 && turbo_still_frames >= AUTO_TURBO_STILL_FRAMES);
+}
+
+static void auto_turbo_run(void)
+{
+   long start = GetTicks();
+   long budget = (long)(750 / FRAMERATE);
+   Uint32 ringpos = 0;
+   bool thread;
+   int i;
+
+   if (!auto_turbo_wanted())
+      return;
+
+   // Without the sound thread, the presented frame overwrites SNDBUF
+   thread = Sound_ThreadIsActive();
+   if (thread)
+      ringpos = Sound_RingTell();
+
+   bVideoFrameHidden = true;
+   for (i = 0; i < AUTO_TURBO_MAX_FRAMES && auto_turbo_wanted()
+               && GetTicks() - start < budget; i++)
+   {
+      emu_frame();
+      auto_turbo_update(false);
+   }
+   bVideoFrameHidden = false;
+
+   if (thread)
+      Sound_RingTruncate(ringpos);
+}
+
+// Emulate one frame. With run-ahead, the state after it is kept, the
+// next frames are emulated too with the same input and only the last
+// one is drawn, then their state and sound are thrown away.
+static void run_frame(void)
+{
+   static short signed int sndbuf[1024*2];
+   int sampler = 0;
+   Uint32 ringpos = 0;
+   bool thread;
+   int i;
+
+   Midi_PollInput();
+
+   auto_turbo_run();
+
+   bVideoFrameHidden = runahead_active();
+   emu_frame();
+   bVideoFrameHidden = false;
+   auto_turbo_update(!runahead_active());
+
+   // The input wasn't read during the frame (e.g. it ended early)
+   if (LATE_INPUT)
+   {
+      LATE_INPUT = 0;
+      update_input();
+   }
+
+   if (!runahead_active() || !runahead_capture())
+      return;
+
+   thread = Sound_ThreadIsActive();
+   if (thread)
+      ringpos = Sound_RingTell();
+   else
+   {
+      memcpy(sndbuf, SNDBUF, sizeof(sndbuf));
+      sampler = snd_sampler;
+   }
+
+   bVideoFrameSpeculative = true;
+   for (i = 1; i <= hatari_runahead; i++)
+   {
+      bVideoFrameHidden = (i < hatari_runahead);
+      emu_frame();
+   }
+   bVideoFrameHidden = bVideoFrameSpeculative = false;
+
+   if (thread)
+      Sound_RingTruncate(ringpos);
+   else
+   {
+      memcpy(SNDBUF, sndbuf, sizeof(sndbuf));
+      snd_sampler = sampler;
+   }
+   STMemory_bSnapShotRamBackup = true;
+   MemorySnapShot_RestoreMem(runahead_state, runahead_state_size);
+   STMemory_bSnapShotRamBackup = false;
+}
+
+// Hand the frame to the frontend, timed for the frame time breakdown
+static void video_present(const void *data, unsigned width, unsigned height, size_t pitch)
+{
+   Perf_Begin(PERF_PRESENT);
+   video_cb(data, width, height, pitch);
+   Perf_End();
+}
+
 void retro_run(void)
 {
-   int x;
    unsigned width = 640;
    unsigned height = 400;
+   struct retro_framebuffer fb;
+   void *target;
+   size_t pitch;
+   bool overlay;
+   int overlay_changed;
 
    bool updated = false;
 
    if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE_UPDATE, &updated) && updated)
       update_variables();
 
+   // Time until the end of retro_run() is split between the stages
+   Perf_FrameStart();
+
+   // The emulation doesn't wait for the host clock while the frontend
+   // fast-forwards, and adaptive frameskip then draws as little as it can
+   bool fastforward = false;
+   if (environ_cb(RETRO_ENVIRONMENT_GET_FASTFORWARDING, &fastforward))
+      ConfigureParams.System.bFastForward = fastforward;
+
    if (CHANGE_RATE || CHANGEAV_TIMING)
    {
       if (CHANGEAV_TIMING)
@@ -637,30 +1650,186 @@ void retro_run(void)
       }	  
    }
 
+   // Videl and the VDI screen copy skip converting unchanged parts using the
+   // written ST-RAM pages, run-ahead copies only them to roll back and the
+   // state hash rehashes them
+   if (STMemory_bDirtyTracking != (ConfigureParams.System.nMachineType == MACHINE_FALCON
+                                   || bUseVDIRes || hatari_runahead > 0 || hatari_deterministic))
+      STMemory_SetDirtyTracking(!STMemory_bDirtyTracking);
+
    if(pauseg==0)
    {
-      update_input();
+      // Late input is read by the emulation, near the end of the frame
+      if (hatari_late_input && !Reverse_IsEnabled())
+         LATE_INPUT = 1;
+      else
+         update_input();
+
+      if (!firstpass && bootcache_step != BOOTCACHE_DONE)
+         bootcache_frame();
+
+      if (!firstpass && Rewind_IsEnabled())
+      {
+         if (REWIND)
+            Rewind_Back();
+         else
+            Rewind_Push();
+      }
 
-      if(SND==1)
+      // snd_sampler is the number of samples generated for this VBL,
+      // with the sound thread all samples completed so far are in its ring
+      Perf_Begin(PERF_AUDIO);
+      if (Sound_ThreadIsActive())
       {
-         int16_t *p=(int16_t*)SNDBUF;
+         Sint16 *samples;
+         int n;
 
-         for(x = 0; x < snd_sampler; x++)
-            audio_cb(*p++,*p++);
+         while ((n = Sound_RingPeek(&samples)) > 0)
+         {
+            if(SND==1 && !bVideoHeadless)
+               audio_batch_cb((const int16_t*)samples, n);
+            Sound_RingAdvance(n);
+         }
       }
+      else if(SND==1 && !bVideoHeadless)
+         audio_batch_cb((const int16_t*)SNDBUF, snd_sampler);
+      Perf_End();
    }
 
-   if(ConfigureParams.Screen.bAllowOverscan || SHOWKEY==1 || STATUTON==1 || pauseg==1 )
+   // Overlays and the GUI draw into bmp, otherwise try rendering the
+   // next frame straight into the frontend framebuffer.
+   overlay = (SHOWKEY==1 || STATUTON==1 || pauseg==1);
+
+   if (hatari_video_native && !overlay && sdlscrn)
+   {
+      width  = sdlscrn->w;
+      height = sdlscrn->h;
+   }
+   else if(ConfigureParams.Screen.bAllowOverscan || overlay)
    {
       width  = retrow;
       height = retroh;
    }
-   video_cb(bmp, width, height, retrow<< 1);
+   if (hatari_video_native)
+      update_native_geometry(width, height);
+
+   target = bmp;
+   pitch = retrow * retro_pixel_bytes;
+   if (!overlay && can_dupe && !hw_render_active() && sdlscrn && sdlscrn->w <= width && sdlscrn->h <= height)
+   {
+      memset(&fb, 0, sizeof(fb));
+      fb.width = width;
+      fb.height = height;
+      fb.access_flags = RETRO_MEMORY_ACCESS_WRITE;
+      if (environ_cb(RETRO_ENVIRONMENT_GET_CURRENT_SOFTWARE_FRAMEBUFFER, &fb)
+          && fb.data && fb.pitch >= width * retro_pixel_bytes
+          && fb.format == (retro_pixel_bytes == 4 ? RETRO_PIXEL_FORMAT_XRGB8888 : RETRO_PIXEL_FORMAT_RGB565))
+      {
+         target = fb.data;
+         pitch = fb.pitch;
+      }
+   }
+
+   if (hw_render_active())
+   {
+      // The GPU decodes the ST screen, unless the overlays need it in bmp
+      hw_render_allow_raw(!overlay);
+      SCREEN_UPDATED = 0;
+      run_frame();
+
+      overlay_changed = (pauseg != 1) && overlay_compose();
+      if (overlay_changed || pauseg == 1 || !SCREEN_UPDATED)
+      {
+         SCREEN_UPDATED_Y0 = 0;
+         SCREEN_UPDATED_Y1 = height;
+      }
+      hw_render_present(video_present, bmp, pitch, width, height,
+            SCREEN_UPDATED || overlay_changed || pauseg == 1,
+            SCREEN_UPDATED_Y0, SCREEN_UPDATED_Y1, can_dupe);
+      overlay_restore();
+   }
+   else if (target == bmp && video_target == bmp)
+   {
+      // Present the frame emulated on the previous call, with the overlays
+      // drawn on top of it for as long as it's presented
+      overlay_changed = (pauseg != 1) && overlay_compose();
+      if (!SCREEN_UPDATED && !overlay_changed && pauseg != 1 && can_dupe)
+         video_present(NULL, width, height, pitch);
+      else
+         video_present(bmp, width, height, pitch);
+      overlay_restore();
+
+      SCREEN_UPDATED = 0;
+      run_frame();
+   }
+   else
+   {
+      // New buffer doesn't contain the previous frame, redraw it all
+      if (target != video_target)
+      {
+         memset(target, 0, pitch * (target == bmp ? retroh : height));
+         Screen_SetFullUpdate();
+         video_target = target;
+      }
 
-   co_switch(emuThread);
+      sdlscrn->pixels = target;
+      sdlscrn->pitch = pitch;
+      SCREEN_UPDATED = 0;
+      run_frame();
 
-   if (MidiRetroInterface && MidiRetroInterface->output_enabled())
-      MidiRetroInterface->flush();
+      if (sdlscrn->pixels != target)
+      {
+         // Video mode changed during the frame, so it went to bmp
+         target = video_target = bmp;
+         pitch = retrow * retro_pixel_bytes;
+      }
+      else if (target != bmp)
+      {
+         sdlscrn->pixels = (unsigned char *)bmp;
+         sdlscrn->pitch = retrow * retro_pixel_bytes;
+      }
+
+      // Nothing was drawn (e.g. skipped frame), repeat the previous one
+      overlay_changed = (pauseg != 1) && overlay_compose();
+      if (!SCREEN_UPDATED && !overlay_changed && can_dupe)
+         video_present(NULL, width, height, pitch);
+      else
+         video_present(target, width, height, pitch);
+      overlay_restore();
+   }
+
+   // MIDI bytes written during the frame go to the frontend in one go
+   Midi_FlushOutput();
+
+   // Netplay peers compare the hashes to find the first diverging frame
+   if (hatari_deterministic && pauseg == 0 && !firstpass)
+      log_cb(RETRO_LOG_DEBUG, "Frame %d state hash %08x\n", nVBLs, STMemory_GetStateHash());
+
+   // Input movies start, and record or check the state hash, between frames
+   if (pauseg == 0 && !firstpass)
+      Movie_FrameDone();
+
+   // Counters are flushed on each VBL, log the last frame once per second
+   if (Stats_bEnabled && ++stats_frames >= (int)FRAMERATE)
+   {
+      char line[256];
+      Stats_Summary(line, sizeof(line));
+      log_cb(RETRO_LOG_INFO, "Frame stats: %s\n", line);
+      stats_frames = 0;
+   }
+
+   Perf_FrameDone();
+   if (perf_osd && ++perf_frames >= (int)FRAMERATE)
+   {
+      static char line[256];
+      struct retro_message msg;
+
+      Perf_Summary(line, sizeof(line));
+      msg.msg = line;
+      msg.frames = perf_frames;
+      environ_cb(RETRO_ENVIRONMENT_SET_MESSAGE, &msg);
+      perf_frames = 0;
+   }
   
    if (firstpass)
       firstpass=0;
@@ -668,11 +1837,20 @@ void retro_run(void)
 
 #define M3U_FILE_EXT "m3u"
 
+static void set_memory_maps(void);
+
 bool retro_load_game(const struct retro_game_info *info)
 {
+   if (game_loaded)
+   {
+      log_cb(RETRO_LOG_ERROR, "Only one machine can run per process, use another process for more\n");
+      return false;
+   }
+
    // Init
    environ_cb(RETRO_ENVIRONMENT_SET_INPUT_DESCRIPTORS, input_descriptors);
    path_join(RETRO_TOS, RETRO_DIR, "tos.img");
+   path_join(RETRO_IKBD, RETRO_DIR, "ikbd.img");
    
    // Verify if tos.img is present
    if(!file_exists(RETRO_TOS))
@@ -714,16 +1892,29 @@ bool retro_load_game(const struct retro_game_info *info)
 	dc->eject_state = false;
 	log_cb(RETRO_LOG_INFO, "Disk (%d) inserted into drive A : %s\n", dc->index+1, dc->files[dc->index]);
 	strcpy(RPATH,dc->files[0]);
+	disk_prefetch_next();
 
 	memset(SNDBUF,0,1024*2*2);
 
-	co_switch(emuThread);
+   // The frontend only accepts a hardware context when loading the content
+   struct retro_variable var = { "hatari_video_renderer", NULL };
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value && !strcmp(var.value, "opengl"))
+      hw_render_init(environ_cb);
+
+	pre_main(RPATH);
+	emu_frame();
 
+   // ST-RAM and TOS are set up by the emulation init
+   set_memory_maps();
+
+   auto_turbo_reset();
+   game_loaded = true;
    return true;
 }
 
 void retro_unload_game(void)
 {
+   game_loaded = false;
    pauseg=0;
 }
 
@@ -740,22 +1931,54 @@ bool retro_load_game_special(unsigned type, const struct retro_game_info *info,
    return false;
 }
 
-size_t retro_serialize_size(void)
+// Room reserved in the savestate size for images inserted later on
+// (up to HD floppy size per drive), and for the GEMDOS, STX write and
+// pending hard disk transfer state.
+#define SAVESTATE_FLOPPY_SIZE (2*80*18*512)
+#define SAVESTATE_SLACK_SIZE  (256*1024)
+
+// The size reported to the frontend has to stay the same, so it is an
+// upper bound computed once for the machine, its RAM and the floppy
+// images. It is only computed again when one of them changes, and then
+// never shrinks. Swapping regular floppies doesn't change it.
+static size_t savestate_get_size(void)
 {
-   if (firstpass != 1)
+   int i, size, floppies = 0;
+
+   for (i = 0; i < MAX_FLOPPYDRIVES; i++)
    {
-      snprintf(savestate_fname, sizeof(savestate_fname), "%s%shatari_tempsave.uss", retro_save_directory, RETRO_PATH_SEPARATOR);
-      MemorySnapShot_Capture(savestate_fname, false);
-	  FILE *file = fopen(savestate_fname, "rb");
-	  if (file)
-	  {
-		 size_t size = 0;
-		 fseek(file, 0L, SEEK_END);
-		 size = ftell(file);
-		 fclose(file);
-		 return size;
-	  }
+      int imgsize = EmulationDrives[i].pBuffer ? EmulationDrives[i].nImageBytes : 0;
+      floppies += imgsize > SAVESTATE_FLOPPY_SIZE ? imgsize : SAVESTATE_FLOPPY_SIZE;
    }
+
+   if (savestate_size
+       && savestate_machine == ConfigureParams.System.nMachineType
+       && savestate_memsize == ConfigureParams.Memory.nMemorySize
+       && savestate_floppies == floppies)
+      return savestate_size;
+
+   size = MemorySnapShot_Size();
+   if (size < 0)
+      return 0;
+   for (i = 0; i < MAX_FLOPPYDRIVES; i++)
+      size -= EmulationDrives[i].pBuffer ? EmulationDrives[i].nImageBytes : 0;
+   size += floppies + SAVESTATE_SLACK_SIZE;
+
+   savestate_machine = ConfigureParams.System.nMachineType;
+   savestate_memsize = ConfigureParams.Memory.nMemorySize;
+   savestate_floppies = floppies;
+   if ((size_t)size > savestate_size)
+   {
+      savestate_size = size;
+      log_cb(RETRO_LOG_INFO, "Savestate size %u bytes.\n", (unsigned)savestate_size);
+   }
+   return savestate_size;
+}
+
+size_t retro_serialize_size(void)
+{
+   if (firstpass != 1)
+      return savestate_get_size();
    return 0;
 }
 
@@ -763,18 +1986,13 @@ bool retro_serialize(void *data_, size_t size)
 {
    if (firstpass != 1)
    {
-      snprintf(savestate_fname, sizeof(savestate_fname), "%s%shatari_tempsave.uss", retro_save_directory, RETRO_PATH_SEPARATOR);
-      MemorySnapShot_Capture(savestate_fname, false);
-	  FILE *file = fopen(savestate_fname, "rb");
-	  if (file)
-	  {
-		 if (fread(data_, size, 1, file) == 1)
-		 {
-		    fclose(file);
-		    return true;
-		 }
-		 fclose(file);
-	  }
+      int used = MemorySnapShot_CaptureMem(data_, size);
+      if (used > 0)
+      {
+         // keep the unused padding deterministic
+         memset((char *)data_ + used, 0, size - used);
+         return true;
+      }
    }
    return false;
 }
@@ -782,36 +2000,72 @@ bool retro_serialize(void *data_, size_t size)
 bool retro_unserialize(const void *data_, size_t size)
 {
    if (firstpass != 1)
-   {
-      snprintf(savestate_fname, sizeof(savestate_fname), "%s%shatari_tempsave.uss", retro_save_directory, RETRO_PATH_SEPARATOR);
-      FILE *file = fopen(savestate_fname, "wb");
-      if (file)
-      {
-         if (fwrite(data_, size, 1, file) == 1)
-         {
-            fclose(file);
-            MemorySnapShot_Restore(savestate_fname, false);
-            return true;
-         }
-         else
-            fclose(file);
-      }
-   }
+      return MemorySnapShot_RestoreMem(data_, size);
    return false;
 }
 
+// ST-RAM is shown as is, in the big endian byte order of the 68000
 void *retro_get_memory_data(unsigned id)
 {
-   (void)id;
+   if (id == RETRO_MEMORY_SYSTEM_RAM)
+      return STRam;
    return NULL;
 }
 
 size_t retro_get_memory_size(unsigned id)
 {
-   (void)id;
+   if (id == RETRO_MEMORY_SYSTEM_RAM)
+      return STRamEnd;
    return 0;
 }
 
+// Describe the ST address space to the frontend (achievements, cheats,
+// automation), so it can read memory directly instead of through savestates
+static void set_memory_maps(void)
+{
+   static struct retro_memory_descriptor desc[4];
+   struct retro_memory_map map = { desc, 0 };
+
+   memset(desc, 0, sizeof(desc));
+
+   desc[map.num_descriptors].flags = RETRO_MEMDESC_SYSTEM_RAM | RETRO_MEMDESC_BIGENDIAN;
+   desc[map.num_descriptors].ptr = STRam;
+   desc[map.num_descriptors].start = 0;
+   desc[map.num_descriptors].len = STRamEnd;
+   desc[map.num_descriptors].addrspace = "ST-RAM";
+   map.num_descriptors++;
+
+   desc[map.num_descriptors].flags = RETRO_MEMDESC_BIGENDIAN;
+   desc[map.num_descriptors].ptr = RomMem;
+   desc[map.num_descriptors].offset = 0xfa0000;
+   desc[map.num_descriptors].start = 0xfa0000;
+   desc[map.num_descriptors].len = 0x20000;
+   desc[map.num_descriptors].addrspace = "Cartridge";
+   map.num_descriptors++;
+
+   if (TosSize)
+   {
+      desc[map.num_descriptors].flags = RETRO_MEMDESC_BIGENDIAN;
+      desc[map.num_descriptors].ptr = RomMem;
+      desc[map.num_descriptors].offset = TosAddress;
+      desc[map.num_descriptors].start = TosAddress;
+      desc[map.num_descriptors].len = TosSize;
+      desc[map.num_descriptors].addrspace = "TOS";
+      map.num_descriptors++;
+   }
+
+   // Last values written to / read from the hardware registers. Writing
+   // here doesn't reach the emulated chips, so it's only for observing
+   desc[map.num_descriptors].flags = RETRO_MEMDESC_BIGENDIAN;
+   desc[map.num_descriptors].ptr = &IoMem[0xff8000];
+   desc[map.num_descriptors].start = 0xff8000;
+   desc[map.num_descriptors].len = 0x8000;
+   desc[map.num_descriptors].addrspace = "IO";
+   map.num_descriptors++;
+
+   environ_cb(RETRO_ENVIRONMENT_SET_MEMORY_MAPS, &map);
+}
+
 void retro_cheat_reset(void) {}
 
 void retro_cheat_set(unsigned index, bool enabled, const char *code)
@@ -0,0 +1,459 @@
+#include "libretro.h"
+#include "libretro-hatari.h"
+#include "main.h"
+#include "screen.h"
+
+#include "retro_hw_render.h"
+
+#ifdef HAVE_OPENGL
+
+#include <GL/gl.h>
+#include <GL/glext.h>
+
+// With the "opengl" renderer, the ST low and medium resolution frames are
+// not converted by screen.c: their bitplanes and line palettes are copied
+// as they are and a fragment shader decodes them into the frontend
+// framebuffer. Everything else (Spec512, mono, VDI, Falcon/TT, overlays and
+// the GUI) is still converted into bmp by the CPU and drawn as a texture.
+
+extern retro_log_printf_t log_cb;
+extern int retro_pixel_bytes;
+
+#define HW_FRAME_SIZE 1024
+#define HW_LINE_BYTES 256      // more than SCREENBYTES_LINE with the largest borders
+#define HW_SCREEN_WORDS (HW_LINE_BYTES / 2)
+#define HW_PALETTE_ENTRIES 17   // 16 ST colors and the medium res flag
+
+enum { HW_SOURCE_NONE, HW_SOURCE_FRAME, HW_SOURCE_RAW };
+
+#define HW_GL_FUNCS(F) \
+   F(void, ActiveTexture, (GLenum texture)) \
+   F(void, AttachShader, (GLuint program, GLuint shader)) \
+   F(void, BindAttribLocation, (GLuint program, GLuint index, const GLchar *name)) \
+   F(void, BindBuffer, (GLenum target, GLuint buffer)) \
+   F(void, BindFramebuffer, (GLenum target, GLuint framebuffer)) \
+   F(void, BindTexture, (GLenum target, GLuint texture)) \
+   F(void, Clear, (GLbitfield mask)) \
+   F(void, ClearColor, (GLfloat r, GLfloat g, GLfloat b, GLfloat a)) \
+   F(void, CompileShader, (GLuint shader)) \
+   F(GLuint, CreateProgram, (void)) \
+   F(GLuint, CreateShader, (GLenum type)) \
+   F(void, DeleteProgram, (GLuint program)) \
+   F(void, DeleteShader, (GLuint shader)) \
+   F(void, DeleteTextures, (GLsizei n, const GLuint *textures)) \
+   F(void, Disable, (GLenum cap)) \
+   F(void, DrawArrays, (GLenum mode, GLint first, GLsizei count)) \
+   F(void, EnableVertexAttribArray, (GLuint index)) \
+   F(void, GenTextures, (GLsizei n, GLuint *textures)) \
+   F(void, GetProgramInfoLog, (GLuint program, GLsizei size, GLsizei *length, GLchar *log)) \
+   F(void, GetProgramiv, (GLuint program, GLenum pname, GLint *param)) \
+   F(void, GetShaderInfoLog, (GLuint shader, GLsizei size, GLsizei *length, GLchar *log)) \
+   F(void, GetShaderiv, (GLuint shader, GLenum pname, GLint *param)) \
+   F(GLint, GetUniformLocation, (GLuint program, const GLchar *name)) \
+   F(void, LinkProgram, (GLuint program)) \
+   F(void, PixelStorei, (GLenum pname, GLint param)) \
+   F(void, ShaderSource, (GLuint shader, GLsizei count, const GLchar *const *string, const GLint *length)) \
+   F(void, TexImage2D, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, \
+         GLint border, GLenum format, GLenum type, const void *pixels)) \
+   F(void, TexParameteri, (GLenum target, GLenum pname, GLint param)) \
+   F(void, TexSubImage2D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, \
+         GLsizei height, GLenum format, GLenum type, const void *pixels)) \
+   F(void, Uniform1f, (GLint location, GLfloat v0)) \
+   F(void, Uniform1i, (GLint location, GLint v0)) \
+   F(void, Uniform2f, (GLint location, GLfloat v0, GLfloat v1)) \
+   F(void, UseProgram, (GLuint program)) \
+   F(void, VertexAttribPointer, (GLuint index, GLint size, GLenum type, GLboolean normalized, \
+         GLsizei stride, const void *pointer)) \
+   F(void, Viewport, (GLint x, GLint y, GLsizei width, GLsizei height))
+
+#define HW_GL_MEMBER(ret, name, args) ret (APIENTRY *name) args;
+static struct { HW_GL_FUNCS(HW_GL_MEMBER) } gl;
+
+static struct retro_hw_render_callback hw_render;
+static bool hw_enabled;
+static bool hw_ready;
+static bool hw_raw_allowed;
+static int hw_source = HW_SOURCE_NONE;
+
+static GLuint frame_program, raw_program;
+static GLint frame_size_loc, raw_size_loc, raw_wide_loc, raw_double_y_loc;
+static GLuint frame_tex, screen_tex, palette_tex;
+static unsigned frame_width, frame_height;  // size of the frame in frame_tex
+
+// Last raw frame, copied by the emulation and uploaded by hw_render_present()
+static Uint8 raw_screen[NUM_VISIBLE_LINES][HW_LINE_BYTES];
+static Uint8 raw_palette[NUM_VISIBLE_LINES][HW_PALETTE_ENTRIES][2];
+static SCREEN_RAWFRAME raw_frame;
+static bool raw_pending;
+
+// Shaders are preceded by the GLSL version and the texture sizes
+static const char vertex_shader[] =
+   "attribute vec2 a_pos;\n"
+   "uniform vec2 u_size;\n"
+   "varying vec2 v_coord;\n"
+   "void main()\n"
+   "{\n"
+   "   v_coord = a_pos * u_size;\n"
+   "   gl_Position = vec4(a_pos.x * 2.0 - 1.0, 1.0 - a_pos.y * 2.0, 0.0, 1.0);\n"
+   "}\n";
+
+static const char frame_shader[] =
+   "uniform sampler2D u_frame;\n"
+   "varying vec2 v_coord;\n"
+   "void main()\n"
+   "{\n"
+   "   gl_FragColor = texture2D(u_frame, (floor(v_coord) + 0.5) / frame_size);\n"
+   "}\n";
+
+// One texel of u_screen is a big endian bitplane word and one line of
+// u_palette holds the 0x0RGB STe colors of an ST line.
+static const char raw_shader[] =
+   "uniform sampler2D u_screen;\n"
+   "uniform sampler2D u_palette;\n"
+   "uniform float u_wide;\n"
+   "uniform float u_double_y;\n"
+   "varying vec2 v_coord;\n"
+   "float word(vec2 t)\n"
+   "{\n"
+   "   return floor(t.x * 255.0 + 0.5) * 256.0 + floor(t.y * 255.0 + 0.5);\n"
+   "}\n"
+   "float palette(float i, float line)\n"
+   "{\n"
+   "   return word(texture2D(u_palette, vec2((i + 0.5) / 17.0, (line + 0.5) / screen_size.y)).ra);\n"
+   "}\n"
+   "float plane(float x, float line, float b)\n"
+   "{\n"
+   "   float w = word(texture2D(u_screen, (vec2(x, line) + 0.5) / screen_size).ra);\n"
+   "   return mod(floor((w + 0.5) / exp2(b)), 2.0);\n"
+   "}\n"
+   "void main()\n"
+   "{\n"
+   "   vec2 p = floor(v_coord);\n"
+   "   float line = floor(p.y / (1.0 + u_wide));\n"
+   "   if (u_wide > 0.5 && u_double_y < 0.5 && mod(p.y, 2.0) > 0.5)\n"
+   "   {\n"
+   "      gl_FragColor = vec4(0.0, 0.0, 0.0, 1.0);\n"
+   "      return;\n"
+   "   }\n"
+   "   bool med = u_wide > 0.5 && palette(16.0, line) > 0.5;\n"
+   "   float planes = med ? 2.0 : 4.0;\n"
+   "   float x = med ? p.x : floor(p.x / (1.0 + u_wide));\n"
+   "   float first = floor(x / 16.0) * planes;\n"
+   "   float b = 15.0 - mod(x, 16.0);\n"
+   "   float ci = plane(first, line, b) + plane(first + 1.0, line, b) * 2.0;\n"
+   "   if (!med)\n"
+   "      ci += plane(first + 2.0, line, b) * 4.0 + plane(first + 3.0, line, b) * 8.0;\n"
+   "   float c = palette(ci, line);\n"
+   "   vec3 n = vec3(floor(c / 256.0), mod(floor(c / 16.0), 16.0), mod(c, 16.0));\n"
+   "   vec3 ste = mod(n, 8.0) * 2.0 + floor(n / 8.0);\n"
+   "   gl_FragColor = vec4(ste * 17.0 / 255.0, 1.0);\n"
+   "}\n";
+
+static GLuint hw_compile(GLenum type, const char *source)
+{
+   GLuint shader = gl.CreateShader(type);
+   GLint ok = GL_FALSE;
+   char header[128];
+   const char *sources[2] = { header, source };
+   char log[512];
+
+   snprintf(header, sizeof(header), "#version 110\n"
+         "const float frame_size = %d.0;\n"
+         "const vec2 screen_size = vec2(%d.0, %d.0);\n",
+         HW_FRAME_SIZE, HW_SCREEN_WORDS, NUM_VISIBLE_LINES);
+   gl.ShaderSource(shader, 2, sources, NULL);
+   gl.CompileShader(shader);
+   gl.GetShaderiv(shader, GL_COMPILE_STATUS, &ok);
+   if (!ok)
+   {
+      gl.GetShaderInfoLog(shader, sizeof(log), NULL, log);
+      log_cb(RETRO_LOG_ERROR, "Shader compilation failed: %s\n", log);
+   }
+   return shader;
+}
+
+static GLuint hw_link(const char *fragment)
+{
+   GLuint program = gl.CreateProgram();
+   GLuint vs = hw_compile(GL_VERTEX_SHADER, vertex_shader);
+   GLuint fs = hw_compile(GL_FRAGMENT_SHADER, fragment);
+   GLint ok = GL_FALSE;
+   char log[512];
+
+   gl.AttachShader(program, vs);
+   gl.AttachShader(program, fs);
+   gl.BindAttribLocation(program, 0, "a_pos");
+   gl.LinkProgram(program);
+   gl.DeleteShader(vs);
+   gl.DeleteShader(fs);
+   gl.GetProgramiv(program, GL_LINK_STATUS, &ok);
+   if (!ok)
+   {
+      gl.GetProgramInfoLog(program, sizeof(log), NULL, log);
+      log_cb(RETRO_LOG_ERROR, "Shader link failed: %s\n", log);
+      gl.DeleteProgram(program);
+      return 0;
+   }
+   return program;
+}
+
+static GLuint hw_texture(GLint internal, int width, int height, GLenum format, GLenum type)
+{
+   GLuint tex;
+
+   gl.GenTextures(1, &tex);
+   gl.BindTexture(GL_TEXTURE_2D, tex);
+   gl.TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+   gl.TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+   gl.TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+   gl.TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+   gl.TexImage2D(GL_TEXTURE_2D, 0, internal, width, height, 0, format, type, NULL);
+   return tex;
+}
+
+static void hw_context_reset(void)
+{
+#define HW_GL_LOAD(ret, name, args) \
+   gl.name = (ret (APIENTRY *) args)hw_render.get_proc_address("gl" #name); \
+   if (!gl.name) \
+   { \
+      log_cb(RETRO_LOG_ERROR, "OpenGL function gl%s not found\n", #name); \
+      return; \
+   }
+   HW_GL_FUNCS(HW_GL_LOAD)
+#undef HW_GL_LOAD
+
+   frame_program = hw_link(frame_shader);
+   raw_program = hw_link(raw_shader);
+   if (!frame_program || !raw_program)
+      return;
+
+   frame_size_loc = gl.GetUniformLocation(frame_program, "u_size");
+   raw_size_loc = gl.GetUniformLocation(raw_program, "u_size");
+   raw_wide_loc = gl.GetUniformLocation(raw_program, "u_wide");
+   raw_double_y_loc = gl.GetUniformLocation(raw_program, "u_double_y");
+   gl.UseProgram(frame_program);
+   gl.Uniform1i(gl.GetUniformLocation(frame_program, "u_frame"), 0);
+   gl.UseProgram(raw_program);
+   gl.Uniform1i(gl.GetUniformLocation(raw_program, "u_screen"), 0);
+   gl.Uniform1i(gl.GetUniformLocation(raw_program, "u_palette"), 1);
+   gl.UseProgram(0);
+
+   if (retro_pixel_bytes == 4)
+      frame_tex = hw_texture(GL_RGBA, HW_FRAME_SIZE, HW_FRAME_SIZE, GL_BGRA, GL_UNSIGNED_BYTE);
+   else
+      frame_tex = hw_texture(GL_RGB, HW_FRAME_SIZE, HW_FRAME_SIZE, GL_RGB, GL_UNSIGNED_SHORT_5_6_5);
+   screen_tex = hw_texture(GL_LUMINANCE_ALPHA, HW_SCREEN_WORDS, NUM_VISIBLE_LINES,
+         GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE);
+   palette_tex = hw_texture(GL_LUMINANCE_ALPHA, HW_PALETTE_ENTRIES, NUM_VISIBLE_LINES,
+         GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE);
+
+   hw_source = HW_SOURCE_NONE;
+   hw_ready = true;
+   // The frames shown so far have to be redrawn
+   Screen_SetFullUpdate();
+}
+
+static void hw_context_destroy(void)
+{
+   if (hw_ready)
+   {
+      GLuint tex[3] = { frame_tex, screen_tex, palette_tex };
+      gl.DeleteTextures(3, tex);
+      gl.DeleteProgram(frame_program);
+      gl.DeleteProgram(raw_program);
+   }
+   frame_program = raw_program = 0;
+   hw_ready = false;
+}
+
+// Called by screen.c instead of converting a frame
+static bool hw_rawframe(const SCREEN_RAWFRAME *frame)
+{
+   int y, i;
+
+   if (!hw_ready || !hw_raw_allowed || frame->nLines > NUM_VISIBLE_LINES
+         || frame->nWidthBytes > HW_LINE_BYTES)
+      return false;
+
+   for (y = 0; y < frame->nLines; y++)
+   {
+      const Uint16 *pal = frame->pPalettes + (y << 4);
+
+      memcpy(raw_screen[y], frame->pScreen + y * frame->nPitch, frame->nWidthBytes);
+      for (i = 0; i < 16; i++)
+      {
+         raw_palette[y][i][0] = pal[i] >> 8;
+         raw_palette[y][i][1] = pal[i] & 0xff;
+      }
+      raw_palette[y][16][0] = 0;
+      raw_palette[y][16][1] = (frame->pPaletteMasks[y] & 0x00030000) != 0;
+   }
+   raw_frame = *frame;
+   raw_pending = true;
+   return true;
+}
+
+static void hw_draw(GLuint program, GLint size_loc, int x, int y, int w, int h, unsigned height)
+{
+   static const GLfloat quad[8] = { 0, 0, 1, 0, 0, 1, 1, 1 };
+
+   // Frontend reads the image from the bottom left corner
+   gl.Viewport(x, (int)height - y - h, w, h);
+   gl.UseProgram(program);
+   gl.Uniform2f(size_loc, w, h);
+   gl.VertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, quad);
+   gl.EnableVertexAttribArray(0);
+   gl.DrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+}
+
+bool hw_render_init(retro_environment_t environ_cb)
+{
+   memset(&hw_render, 0, sizeof(hw_render));
+   hw_render.context_type = RETRO_HW_CONTEXT_OPENGL;
+   hw_render.context_reset = hw_context_reset;
+   hw_render.context_destroy = hw_context_destroy;
+   hw_render.bottom_left_origin = true;
+
+   if (!environ_cb(RETRO_ENVIRONMENT_SET_HW_RENDER, &hw_render))
+   {
+      log_cb(RETRO_LOG_WARN, "OpenGL rendering not supported, using software.\n");
+      return false;
+   }
+   hw_enabled = true;
+   Screen_SetRawFrameHook(hw_rawframe);
+   return true;
+}
+
+bool hw_render_active(void)
+{
+   return hw_enabled;
+}
+
+void hw_render_allow_raw(bool allow)
+{
+   hw_raw_allowed = allow;
+}
+
+void hw_render_present(retro_video_refresh_t video_cb, const void *frame, size_t pitch,
+      unsigned width, unsigned height, bool updated, unsigned first_row, unsigned end_row,
+      bool can_dupe)
+{
+   int scale;
+
+   if (!hw_ready)
+   {
+      raw_pending = false;
+      video_cb(NULL, width, height, 0);
+      return;
+   }
+
+   gl.BindFramebuffer(GL_FRAMEBUFFER, hw_render.get_current_framebuffer());
+   gl.BindBuffer(GL_ARRAY_BUFFER, 0);
+   gl.Disable(GL_SCISSOR_TEST);
+   gl.Disable(GL_BLEND);
+   gl.Disable(GL_DEPTH_TEST);
+
+   if (raw_pending)
+   {
+      gl.PixelStorei(GL_UNPACK_ALIGNMENT, 1);
+      gl.PixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+      gl.ActiveTexture(GL_TEXTURE1);
+      gl.BindTexture(GL_TEXTURE_2D, palette_tex);
+      gl.TexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, HW_PALETTE_ENTRIES, raw_frame.nLines,
+            GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE, raw_palette);
+      gl.ActiveTexture(GL_TEXTURE0);
+      gl.BindTexture(GL_TEXTURE_2D, screen_tex);
+      gl.TexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, HW_SCREEN_WORDS, raw_frame.nLines,
+            GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE, raw_screen);
+      hw_source = HW_SOURCE_RAW;
+      raw_pending = false;
+   }
+   else if (updated || hw_source != HW_SOURCE_FRAME)
+   {
+      // Only the updated rows of the same sized frame need uploading
+      if (hw_source != HW_SOURCE_FRAME || width != frame_width || height != frame_height)
+      {
+         first_row = 0;
+         end_row = height;
+      }
+      if (end_row > height)
+         end_row = height;
+      frame = (const Uint8 *)frame + first_row * pitch;
+
+      gl.PixelStorei(GL_UNPACK_ALIGNMENT, retro_pixel_bytes);
+      gl.PixelStorei(GL_UNPACK_ROW_LENGTH, pitch / retro_pixel_bytes);
+      gl.ActiveTexture(GL_TEXTURE0);
+      gl.BindTexture(GL_TEXTURE_2D, frame_tex);
+      if (first_row >= end_row)
+         ;
+      else if (retro_pixel_bytes == 4)
+         gl.TexSubImage2D(GL_TEXTURE_2D, 0, 0, first_row, width, end_row - first_row,
+               GL_BGRA, GL_UNSIGNED_BYTE, frame);
+      else
+         gl.TexSubImage2D(GL_TEXTURE_2D, 0, 0, first_row, width, end_row - first_row,
+               GL_RGB, GL_UNSIGNED_SHORT_5_6_5, frame);
+      gl.PixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+      hw_source = HW_SOURCE_FRAME;
+      frame_width = width;
+      frame_height = height;
+   }
+   else if (can_dupe)
+   {
+      video_cb(NULL, width, height, 0);
+      return;
+   }
+
+   gl.ClearColor(0, 0, 0, 1);
+   gl.Clear(GL_COLOR_BUFFER_BIT);
+
+   if (hw_source == HW_SOURCE_RAW)
+   {
+      scale = raw_frame.bWide ? 2 : 1;
+      gl.ActiveTexture(GL_TEXTURE1);
+      gl.BindTexture(GL_TEXTURE_2D, palette_tex);
+      gl.ActiveTexture(GL_TEXTURE0);
+      gl.BindTexture(GL_TEXTURE_2D, screen_tex);
+      gl.UseProgram(raw_program);
+      gl.Uniform1f(raw_wide_loc, raw_frame.bWide);
+      gl.Uniform1f(raw_double_y_loc, raw_frame.bDoubleY);
+      hw_draw(raw_program, raw_size_loc, raw_frame.nOffsetX, raw_frame.nOffsetY,
+            raw_frame.nWidthBytes * 2 * scale, raw_frame.nLines * scale, height);
+   }
+   else
+   {
+      gl.ActiveTexture(GL_TEXTURE0);
+      gl.BindTexture(GL_TEXTURE_2D, frame_tex);
+      hw_draw(frame_program, frame_size_loc, 0, 0, width, height, height);
+   }
+   gl.UseProgram(0);
+
+   video_cb(RETRO_HW_FRAME_BUFFER_VALID, width, height, 0);
+}
+
+#else
+
+bool hw_render_init(retro_environment_t environ_cb)
+{
+   (void)environ_cb;
+   return false;
+}
+
+bool hw_render_active(void)
+{
+   return false;
+}
+
+void hw_render_allow_raw(bool allow)
+{
+   (void)allow;
+}
+
+void hw_render_present(retro_video_refresh_t video_cb, const void *frame, size_t pitch,
+      unsigned width, unsigned height, bool updated, unsigned first_row, unsigned end_row,
+      bool can_dupe)
+{
+   video_cb(frame, width, height, pitch);
+}
+
+#endif
@@ -0,0 +1,18 @@
+#ifndef RETRO_HW_RENDER_H__
+#define RETRO_HW_RENDER_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "libretro.h"
+
+//*****************************************************************************
+// OpenGL presentation, the ST low/medium res frames are decoded by a shader
+bool hw_render_init(retro_environment_t environ_cb);
+bool hw_render_active(void);
+void hw_render_allow_raw(bool allow);
+// Rows first_row..end_row-1 of an updated frame differ from the previous one
+void hw_render_present(retro_video_refresh_t video_cb, const void *frame, size_t pitch,
+      unsigned width, unsigned height, bool updated, unsigned first_row, unsigned end_row,
+      bool can_dupe);
+
+#endif
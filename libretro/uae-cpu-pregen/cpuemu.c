@@ -30,8 +30,7 @@ unsigned long REGPARAM2 CPUFUNC(op_0_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 return 8;
@@ -46,8 +45,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -63,8 +61,7 @@ unsigned long REGPARAM2 CPUFUNC(op_18_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -80,8 +77,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -96,8 +92,7 @@ unsigned long REGPARAM2 CPUFUNC(op_28_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -114,8 +109,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}}return 22;
 }
@@ -128,8 +122,7 @@ unsigned long REGPARAM2 CPUFUNC(op_38_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -143,8 +136,7 @@ unsigned long REGPARAM2 CPUFUNC(op_39_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 return 24;
@@ -169,8 +161,7 @@ unsigned long REGPARAM2 CPUFUNC(op_40_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 return 8;
@@ -185,8 +176,7 @@ unsigned long REGPARAM2 CPUFUNC(op_50_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -202,8 +192,7 @@ unsigned long REGPARAM2 CPUFUNC(op_58_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -219,8 +208,7 @@ unsigned long REGPARAM2 CPUFUNC(op_60_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -235,8 +223,7 @@ unsigned long REGPARAM2 CPUFUNC(op_68_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -253,8 +240,7 @@ unsigned long REGPARAM2 CPUFUNC(op_70_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}}return 22;
 }
@@ -267,8 +253,7 @@ unsigned long REGPARAM2 CPUFUNC(op_78_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -282,8 +267,7 @@ unsigned long REGPARAM2 CPUFUNC(op_79_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 return 24;
@@ -309,8 +293,7 @@ unsigned long REGPARAM2 CPUFUNC(op_80_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 return 16;
@@ -325,8 +308,7 @@ unsigned long REGPARAM2 CPUFUNC(op_90_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 28;
@@ -342,8 +324,7 @@ unsigned long REGPARAM2 CPUFUNC(op_98_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 28;
@@ -359,8 +340,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a0_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 30;
@@ -375,8 +355,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a8_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 32;
@@ -393,8 +372,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b0_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}}return 34;
 }
@@ -407,8 +385,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b8_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 32;
@@ -422,8 +399,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b9_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(10);
 return 36;
@@ -1224,8 +1200,7 @@ unsigned long REGPARAM2 CPUFUNC(op_200_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 return 8;
@@ -1240,8 +1215,7 @@ unsigned long REGPARAM2 CPUFUNC(op_210_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -1257,8 +1231,7 @@ unsigned long REGPARAM2 CPUFUNC(op_218_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -1274,8 +1247,7 @@ unsigned long REGPARAM2 CPUFUNC(op_220_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -1290,8 +1262,7 @@ unsigned long REGPARAM2 CPUFUNC(op_228_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -1308,8 +1279,7 @@ unsigned long REGPARAM2 CPUFUNC(op_230_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}}return 22;
 }
@@ -1322,8 +1292,7 @@ unsigned long REGPARAM2 CPUFUNC(op_238_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -1337,8 +1306,7 @@ unsigned long REGPARAM2 CPUFUNC(op_239_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 return 24;
@@ -1363,8 +1331,7 @@ unsigned long REGPARAM2 CPUFUNC(op_240_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 return 8;
@@ -1379,8 +1346,7 @@ unsigned long REGPARAM2 CPUFUNC(op_250_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -1396,8 +1362,7 @@ unsigned long REGPARAM2 CPUFUNC(op_258_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -1413,8 +1378,7 @@ unsigned long REGPARAM2 CPUFUNC(op_260_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -1429,8 +1393,7 @@ unsigned long REGPARAM2 CPUFUNC(op_268_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -1447,8 +1410,7 @@ unsigned long REGPARAM2 CPUFUNC(op_270_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}}return 22;
 }
@@ -1461,8 +1423,7 @@ unsigned long REGPARAM2 CPUFUNC(op_278_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -1476,8 +1437,7 @@ unsigned long REGPARAM2 CPUFUNC(op_279_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 return 24;
@@ -1503,8 +1463,7 @@ unsigned long REGPARAM2 CPUFUNC(op_280_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 return 16;
@@ -1519,8 +1478,7 @@ unsigned long REGPARAM2 CPUFUNC(op_290_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 28;
@@ -1536,8 +1494,7 @@ unsigned long REGPARAM2 CPUFUNC(op_298_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 28;
@@ -1553,8 +1510,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2a0_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 30;
@@ -1569,8 +1525,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2a8_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 32;
@@ -1587,8 +1542,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2b0_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}}return 34;
 }
@@ -1601,8 +1555,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2b8_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 32;
@@ -1616,8 +1569,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2b9_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(10);
 return 36;
@@ -1761,11 +1713,10 @@ unsigned long REGPARAM2 CPUFUNC(op_400_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}m68k_incpc(4);
 return 8;
@@ -1782,11 +1733,10 @@ unsigned long REGPARAM2 CPUFUNC(op_410_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 16;
@@ -1804,11 +1754,10 @@ unsigned long REGPARAM2 CPUFUNC(op_418_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 16;
@@ -1826,11 +1775,10 @@ unsigned long REGPARAM2 CPUFUNC(op_420_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 18;
@@ -1847,11 +1795,10 @@ unsigned long REGPARAM2 CPUFUNC(op_428_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(6);
 return 20;
@@ -1870,11 +1817,10 @@ unsigned long REGPARAM2 CPUFUNC(op_430_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}}return 22;
 }
@@ -1889,11 +1835,10 @@ unsigned long REGPARAM2 CPUFUNC(op_438_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(6);
 return 20;
@@ -1909,11 +1854,10 @@ unsigned long REGPARAM2 CPUFUNC(op_439_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(8);
 return 24;
@@ -1929,11 +1873,10 @@ unsigned long REGPARAM2 CPUFUNC(op_440_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}m68k_incpc(4);
 return 8;
@@ -1950,11 +1893,10 @@ unsigned long REGPARAM2 CPUFUNC(op_450_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 16;
@@ -1972,11 +1914,10 @@ unsigned long REGPARAM2 CPUFUNC(op_458_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 16;
@@ -1994,11 +1935,10 @@ unsigned long REGPARAM2 CPUFUNC(op_460_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 18;
@@ -2015,11 +1955,10 @@ unsigned long REGPARAM2 CPUFUNC(op_468_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(6);
 return 20;
@@ -2038,11 +1977,10 @@ unsigned long REGPARAM2 CPUFUNC(op_470_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}}return 22;
 }
@@ -2057,11 +1995,10 @@ unsigned long REGPARAM2 CPUFUNC(op_478_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(6);
 return 20;
@@ -2077,11 +2014,10 @@ unsigned long REGPARAM2 CPUFUNC(op_479_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(8);
 return 24;
@@ -2097,11 +2033,10 @@ unsigned long REGPARAM2 CPUFUNC(op_480_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}m68k_incpc(6);
 return 16;
@@ -2118,11 +2053,10 @@ unsigned long REGPARAM2 CPUFUNC(op_490_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(6);
 return 28;
@@ -2140,11 +2074,10 @@ unsigned long REGPARAM2 CPUFUNC(op_498_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(6);
 return 28;
@@ -2162,11 +2095,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4a0_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(6);
 return 30;
@@ -2183,11 +2115,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4a8_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(8);
 return 32;
@@ -2206,11 +2137,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4b0_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}}return 34;
 }
@@ -2225,11 +2155,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4b8_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(8);
 return 32;
@@ -2245,11 +2174,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4b9_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(10);
 return 36;
@@ -2386,11 +2314,10 @@ unsigned long REGPARAM2 CPUFUNC(op_600_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}m68k_incpc(4);
 return 8;
@@ -2407,11 +2334,10 @@ unsigned long REGPARAM2 CPUFUNC(op_610_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 16;
@@ -2429,11 +2355,10 @@ unsigned long REGPARAM2 CPUFUNC(op_618_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 16;
@@ -2451,11 +2376,10 @@ unsigned long REGPARAM2 CPUFUNC(op_620_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 18;
@@ -2472,11 +2396,10 @@ unsigned long REGPARAM2 CPUFUNC(op_628_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(6);
 return 20;
@@ -2495,11 +2418,10 @@ unsigned long REGPARAM2 CPUFUNC(op_630_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}}return 22;
 }
@@ -2514,11 +2436,10 @@ unsigned long REGPARAM2 CPUFUNC(op_638_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(6);
 return 20;
@@ -2534,11 +2455,10 @@ unsigned long REGPARAM2 CPUFUNC(op_639_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(8);
 return 24;
@@ -2554,11 +2474,10 @@ unsigned long REGPARAM2 CPUFUNC(op_640_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}m68k_incpc(4);
 return 8;
@@ -2575,11 +2494,10 @@ unsigned long REGPARAM2 CPUFUNC(op_650_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 16;
@@ -2597,11 +2515,10 @@ unsigned long REGPARAM2 CPUFUNC(op_658_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 16;
@@ -2619,11 +2536,10 @@ unsigned long REGPARAM2 CPUFUNC(op_660_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 18;
@@ -2640,11 +2556,10 @@ unsigned long REGPARAM2 CPUFUNC(op_668_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(6);
 return 20;
@@ -2663,11 +2578,10 @@ unsigned long REGPARAM2 CPUFUNC(op_670_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}}return 22;
 }
@@ -2682,11 +2596,10 @@ unsigned long REGPARAM2 CPUFUNC(op_678_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(6);
 return 20;
@@ -2702,11 +2615,10 @@ unsigned long REGPARAM2 CPUFUNC(op_679_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(8);
 return 24;
@@ -2722,11 +2634,10 @@ unsigned long REGPARAM2 CPUFUNC(op_680_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}m68k_incpc(6);
 return 16;
@@ -2743,11 +2654,10 @@ unsigned long REGPARAM2 CPUFUNC(op_690_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(6);
 return 28;
@@ -2765,11 +2675,10 @@ unsigned long REGPARAM2 CPUFUNC(op_698_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(6);
 return 28;
@@ -2787,11 +2696,10 @@ unsigned long REGPARAM2 CPUFUNC(op_6a0_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(6);
 return 30;
@@ -2808,11 +2716,10 @@ unsigned long REGPARAM2 CPUFUNC(op_6a8_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(8);
 return 32;
@@ -2831,11 +2738,10 @@ unsigned long REGPARAM2 CPUFUNC(op_6b0_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}}return 34;
 }
@@ -2850,11 +2756,10 @@ unsigned long REGPARAM2 CPUFUNC(op_6b8_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(8);
 return 32;
@@ -2870,11 +2775,10 @@ unsigned long REGPARAM2 CPUFUNC(op_6b9_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(10);
 return 36;
@@ -3519,8 +3423,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a00_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 return 8;
@@ -3535,8 +3438,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a10_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -3552,8 +3454,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a18_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -3569,8 +3470,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a20_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -3585,8 +3485,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a28_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -3603,8 +3502,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a30_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}}return 22;
 }
@@ -3617,8 +3515,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a38_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -3632,8 +3529,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a39_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 return 24;
@@ -3658,8 +3554,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a40_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 return 8;
@@ -3674,8 +3569,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a50_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -3691,8 +3585,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a58_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -3708,8 +3601,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a60_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -3724,8 +3616,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a68_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -3742,8 +3633,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a70_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}}return 22;
 }
@@ -3756,8 +3646,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a78_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -3771,8 +3660,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a79_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 return 24;
@@ -3801,8 +3689,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a80_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 return 16;
@@ -3817,8 +3704,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a90_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 28;
@@ -3834,8 +3720,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a98_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 28;
@@ -3851,8 +3736,7 @@ unsigned long REGPARAM2 CPUFUNC(op_aa0_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 30;
@@ -3867,8 +3751,7 @@ unsigned long REGPARAM2 CPUFUNC(op_aa8_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 32;
@@ -3885,8 +3768,7 @@ unsigned long REGPARAM2 CPUFUNC(op_ab0_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}}return 34;
 }
@@ -3899,8 +3781,7 @@ unsigned long REGPARAM2 CPUFUNC(op_ab8_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 32;
@@ -3914,8 +3795,7 @@ unsigned long REGPARAM2 CPUFUNC(op_ab9_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(10);
 return 36;
@@ -3933,10 +3813,9 @@ unsigned long REGPARAM2 CPUFUNC(op_ad0_0)(uae_u32 opcode) /* CAS */
 {	int flgs = ((uae_s8)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(m68k_dreg(regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 	if (GET_ZFLG){	put_byte(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}m68k_incpc(4);
@@ -3956,10 +3835,9 @@ unsigned long REGPARAM2 CPUFUNC(op_ad8_0)(uae_u32 opcode) /* CAS */
 {	int flgs = ((uae_s8)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(m68k_dreg(regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 	if (GET_ZFLG){	put_byte(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}m68k_incpc(4);
@@ -3979,10 +3857,9 @@ unsigned long REGPARAM2 CPUFUNC(op_ae0_0)(uae_u32 opcode) /* CAS */
 {	int flgs = ((uae_s8)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(m68k_dreg(regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 	if (GET_ZFLG){	put_byte(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}m68k_incpc(4);
@@ -4001,10 +3878,9 @@ unsigned long REGPARAM2 CPUFUNC(op_ae8_0)(uae_u32 opcode) /* CAS */
 {	int flgs = ((uae_s8)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(m68k_dreg(regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 	if (GET_ZFLG){	put_byte(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}m68k_incpc(6);
@@ -4025,10 +3901,9 @@ unsigned long REGPARAM2 CPUFUNC(op_af0_0)(uae_u32 opcode) /* CAS */
 {	int flgs = ((uae_s8)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(m68k_dreg(regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 	if (GET_ZFLG){	put_byte(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}}return 22;
@@ -4045,10 +3920,9 @@ unsigned long REGPARAM2 CPUFUNC(op_af8_0)(uae_u32 opcode) /* CAS */
 {	int flgs = ((uae_s8)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(m68k_dreg(regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 	if (GET_ZFLG){	put_byte(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}m68k_incpc(6);
@@ -4066,10 +3940,9 @@ unsigned long REGPARAM2 CPUFUNC(op_af9_0)(uae_u32 opcode) /* CAS */
 {	int flgs = ((uae_s8)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(m68k_dreg(regs, rc))) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 	if (GET_ZFLG){	put_byte(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}m68k_incpc(8);
@@ -4085,10 +3958,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c00_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}m68k_incpc(4);
 return 8;
 }
@@ -4103,10 +3975,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c10_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(4);
 return 12;
 }
@@ -4122,10 +3993,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c18_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(4);
 return 12;
 }
@@ -4141,10 +4011,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c20_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(4);
 return 14;
 }
@@ -4159,10 +4028,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c28_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(6);
 return 16;
 }
@@ -4179,10 +4047,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c30_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}return 18;
 }
 unsigned long REGPARAM2 CPUFUNC(op_c38_0)(uae_u32 opcode) /* CMP */
@@ -4195,10 +4062,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c38_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(6);
 return 16;
 }
@@ -4212,10 +4078,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c39_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(8);
 return 20;
 }
@@ -4231,10 +4096,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c3a_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(6);
 return 16;
 }
@@ -4252,10 +4116,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c3b_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}return 18;
 }
 unsigned long REGPARAM2 CPUFUNC(op_c40_0)(uae_u32 opcode) /* CMP */
@@ -4268,10 +4131,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c40_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}m68k_incpc(4);
 return 8;
 }
@@ -4286,10 +4148,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c50_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(4);
 return 12;
 }
@@ -4305,10 +4166,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c58_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(4);
 return 12;
 }
@@ -4324,10 +4184,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c60_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(4);
 return 14;
 }
@@ -4342,10 +4201,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c68_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(6);
 return 16;
 }
@@ -4362,10 +4220,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c70_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}return 18;
 }
 unsigned long REGPARAM2 CPUFUNC(op_c78_0)(uae_u32 opcode) /* CMP */
@@ -4378,10 +4235,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c78_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(6);
 return 16;
 }
@@ -4395,10 +4251,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c79_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(8);
 return 20;
 }
@@ -4414,10 +4269,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c7a_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(6);
 return 16;
 }
@@ -4435,10 +4289,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c7b_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}return 18;
 }
 unsigned long REGPARAM2 CPUFUNC(op_c80_0)(uae_u32 opcode) /* CMP */
@@ -4451,10 +4304,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c80_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}m68k_incpc(6);
 return 14;
 }
@@ -4469,10 +4321,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c90_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(6);
 return 20;
 }
@@ -4488,10 +4339,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c98_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(6);
 return 20;
 }
@@ -4507,10 +4357,9 @@ unsigned long REGPARAM2 CPUFUNC(op_ca0_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(6);
 return 22;
 }
@@ -4525,10 +4374,9 @@ unsigned long REGPARAM2 CPUFUNC(op_ca8_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(8);
 return 24;
 }
@@ -4545,10 +4393,9 @@ unsigned long REGPARAM2 CPUFUNC(op_cb0_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}return 26;
 }
 unsigned long REGPARAM2 CPUFUNC(op_cb8_0)(uae_u32 opcode) /* CMP */
@@ -4561,10 +4408,9 @@ unsigned long REGPARAM2 CPUFUNC(op_cb8_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(8);
 return 24;
 }
@@ -4578,10 +4424,9 @@ unsigned long REGPARAM2 CPUFUNC(op_cb9_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(10);
 return 28;
 }
@@ -4597,10 +4442,9 @@ unsigned long REGPARAM2 CPUFUNC(op_cba_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(8);
 return 24;
 }
@@ -4618,10 +4462,9 @@ unsigned long REGPARAM2 CPUFUNC(op_cbb_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}return 26;
 }
 unsigned long REGPARAM2 CPUFUNC(op_cd0_0)(uae_u32 opcode) /* CAS */
@@ -4637,10 +4480,9 @@ unsigned long REGPARAM2 CPUFUNC(op_cd0_0)(uae_u32 opcode) /* CAS */
 {	int flgs = ((uae_s16)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(m68k_dreg(regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 	if (GET_ZFLG){	put_word(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}m68k_incpc(4);
@@ -4660,10 +4502,9 @@ unsigned long REGPARAM2 CPUFUNC(op_cd8_0)(uae_u32 opcode) /* CAS */
 {	int flgs = ((uae_s16)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(m68k_dreg(regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 	if (GET_ZFLG){	put_word(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}m68k_incpc(4);
@@ -4683,10 +4524,9 @@ unsigned long REGPARAM2 CPUFUNC(op_ce0_0)(uae_u32 opcode) /* CAS */
 {	int flgs = ((uae_s16)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(m68k_dreg(regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 	if (GET_ZFLG){	put_word(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}m68k_incpc(4);
@@ -4705,10 +4545,9 @@ unsigned long REGPARAM2 CPUFUNC(op_ce8_0)(uae_u32 opcode) /* CAS */
 {	int flgs = ((uae_s16)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(m68k_dreg(regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 	if (GET_ZFLG){	put_word(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}m68k_incpc(6);
@@ -4729,10 +4568,9 @@ unsigned long REGPARAM2 CPUFUNC(op_cf0_0)(uae_u32 opcode) /* CAS */
 {	int flgs = ((uae_s16)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(m68k_dreg(regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 	if (GET_ZFLG){	put_word(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}}return 22;
@@ -4749,10 +4587,9 @@ unsigned long REGPARAM2 CPUFUNC(op_cf8_0)(uae_u32 opcode) /* CAS */
 {	int flgs = ((uae_s16)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(m68k_dreg(regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 	if (GET_ZFLG){	put_word(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}m68k_incpc(6);
@@ -4770,10 +4607,9 @@ unsigned long REGPARAM2 CPUFUNC(op_cf9_0)(uae_u32 opcode) /* CAS */
 {	int flgs = ((uae_s16)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(m68k_dreg(regs, rc))) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 	if (GET_ZFLG){	put_word(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}m68k_incpc(8);
@@ -4790,19 +4626,17 @@ unsigned long REGPARAM2 CPUFUNC(op_cfc_0)(uae_u32 opcode) /* CAS2 */
 {	int flgs = ((uae_s16)(m68k_dreg(regs, (extra >> 16) & 7))) < 0;
 	int flgo = ((uae_s16)(dst1)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(m68k_dreg(regs, (extra >> 16) & 7))) > ((uae_u16)(dst1)));
-	SET_NFLG (flgn != 0);
 	if (GET_ZFLG) {
 {uae_u32 newv = ((uae_s16)(dst2)) - ((uae_s16)(m68k_dreg(regs, extra & 7)));
 {	int flgs = ((uae_s16)(m68k_dreg(regs, extra & 7))) < 0;
 	int flgo = ((uae_s16)(dst2)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(m68k_dreg(regs, extra & 7))) > ((uae_u16)(dst2)));
-	SET_NFLG (flgn != 0);
 	if (GET_ZFLG) {
 	put_word(rn1, m68k_dreg(regs, (extra >> 22) & 7));
 	put_word(rn1, m68k_dreg(regs, (extra >> 6) & 7));
@@ -5280,10 +5114,9 @@ unsigned long REGPARAM2 CPUFUNC(op_ed0_0)(uae_u32 opcode) /* CAS */
 {	int flgs = ((uae_s32)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(m68k_dreg(regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 	if (GET_ZFLG){	put_long(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}m68k_incpc(4);
@@ -5303,10 +5136,9 @@ unsigned long REGPARAM2 CPUFUNC(op_ed8_0)(uae_u32 opcode) /* CAS */
 {	int flgs = ((uae_s32)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(m68k_dreg(regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 	if (GET_ZFLG){	put_long(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}m68k_incpc(4);
@@ -5326,10 +5158,9 @@ unsigned long REGPARAM2 CPUFUNC(op_ee0_0)(uae_u32 opcode) /* CAS */
 {	int flgs = ((uae_s32)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(m68k_dreg(regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 	if (GET_ZFLG){	put_long(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}m68k_incpc(4);
@@ -5348,10 +5179,9 @@ unsigned long REGPARAM2 CPUFUNC(op_ee8_0)(uae_u32 opcode) /* CAS */
 {	int flgs = ((uae_s32)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(m68k_dreg(regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 	if (GET_ZFLG){	put_long(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}m68k_incpc(6);
@@ -5372,10 +5202,9 @@ unsigned long REGPARAM2 CPUFUNC(op_ef0_0)(uae_u32 opcode) /* CAS */
 {	int flgs = ((uae_s32)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(m68k_dreg(regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 	if (GET_ZFLG){	put_long(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}}return 30;
@@ -5392,10 +5221,9 @@ unsigned long REGPARAM2 CPUFUNC(op_ef8_0)(uae_u32 opcode) /* CAS */
 {	int flgs = ((uae_s32)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(m68k_dreg(regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 	if (GET_ZFLG){	put_long(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}m68k_incpc(6);
@@ -5413,10 +5241,9 @@ unsigned long REGPARAM2 CPUFUNC(op_ef9_0)(uae_u32 opcode) /* CAS */
 {	int flgs = ((uae_s32)(m68k_dreg(regs, rc))) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(m68k_dreg(regs, rc))) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 	if (GET_ZFLG){	put_long(dsta,(m68k_dreg(regs, ru)));
 }else{m68k_dreg(regs, rc) = dst;
 }}}}}}}}m68k_incpc(8);
@@ -5433,19 +5260,17 @@ unsigned long REGPARAM2 CPUFUNC(op_efc_0)(uae_u32 opcode) /* CAS2 */
 {	int flgs = ((uae_s32)(m68k_dreg(regs, (extra >> 16) & 7))) < 0;
 	int flgo = ((uae_s32)(dst1)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(m68k_dreg(regs, (extra >> 16) & 7))) > ((uae_u32)(dst1)));
-	SET_NFLG (flgn != 0);
 	if (GET_ZFLG) {
 {uae_u32 newv = ((uae_s32)(dst2)) - ((uae_s32)(m68k_dreg(regs, extra & 7)));
 {	int flgs = ((uae_s32)(m68k_dreg(regs, extra & 7))) < 0;
 	int flgo = ((uae_s32)(dst2)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(m68k_dreg(regs, extra & 7))) > ((uae_u32)(dst2)));
-	SET_NFLG (flgn != 0);
 	if (GET_ZFLG) {
 	put_long(rn1, m68k_dreg(regs, (extra >> 22) & 7));
 	put_long(rn1, m68k_dreg(regs, (extra >> 6) & 7));
@@ -5464,8 +5289,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1000_0)(uae_u32 opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 4;  
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(2);
 return 4;
@@ -5477,8 +5301,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1008_0)(uae_u32 opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 4;  
 {{	uae_s8 src = m68k_areg(regs, srcreg);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(2);
 return 4;
@@ -5491,8 +5314,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1010_0)(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 return 8;
@@ -5506,8 +5328,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1018_0)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 return 8;
@@ -5521,8 +5342,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1020_0)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 return 10;
@@ -5535,8 +5355,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1028_0)(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 12;
@@ -5551,8 +5370,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1030_0)(uae_u32 opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	uae_s8 src = get_byte(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}return 14;
 }
@@ -5563,8 +5381,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1038_0)(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 12;
@@ -5576,8 +5393,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1039_0)(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(6);
 return 16;
@@ -5590,8 +5406,7 @@ unsigned long REGPARAM2 CPUFUNC(op_103a_0)(uae_u32 opcode) /* MOVE */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 12;
@@ -5606,8 +5421,7 @@ unsigned long REGPARAM2 CPUFUNC(op_103b_0)(uae_u32 opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	uae_s8 src = get_byte(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}return 14;
 }
@@ -5617,8 +5431,7 @@ unsigned long REGPARAM2 CPUFUNC(op_103c_0)(uae_u32 opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 8;  
 {{	uae_s8 src = get_ibyte(2);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 return 8;
@@ -5631,8 +5444,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1080_0)(uae_u32 opcode) /* MOVE */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}m68k_incpc(2);
 return 8;
@@ -5645,8 +5457,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1088_0)(uae_u32 opcode) /* MOVE */
 {{	uae_s8 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}m68k_incpc(2);
 return 8;
@@ -5660,8 +5471,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1090_0)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -5676,8 +5486,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1098_0)(uae_u32 opcode) /* MOVE */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -5692,8 +5501,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10a0_0)(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 14;
@@ -5707,8 +5515,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10a8_0)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -5724,8 +5531,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10b0_0)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}}return 18;
 }
@@ -5737,8 +5543,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10b8_0)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -5751,8 +5556,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10b9_0)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -5766,8 +5570,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10ba_0)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -5783,8 +5586,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10bb_0)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}}return 18;
 }
@@ -5795,8 +5597,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10bc_0)(uae_u32 opcode) /* MOVE */
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}m68k_incpc(4);
 return 12;
@@ -5810,8 +5611,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10c0_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}m68k_incpc(2);
 return 8;
@@ -5825,8 +5625,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10c8_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}m68k_incpc(2);
 return 8;
@@ -5841,8 +5640,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10d0_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -5858,8 +5656,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10d8_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -5875,8 +5672,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10e0_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 14;
@@ -5891,8 +5687,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10e8_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -5909,8 +5704,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10f0_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}}return 18;
 }
@@ -5923,8 +5717,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10f8_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -5938,8 +5731,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10f9_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -5954,8 +5746,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10fa_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -5972,8 +5763,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10fb_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}}return 18;
 }
@@ -5985,8 +5775,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10fc_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}m68k_incpc(4);
 return 12;
@@ -6000,8 +5789,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1100_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}m68k_incpc(2);
 return 8;
@@ -6015,8 +5803,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1108_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}m68k_incpc(2);
 return 8;
@@ -6031,8 +5818,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1110_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -6048,8 +5834,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1118_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -6065,8 +5850,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1120_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 14;
@@ -6081,8 +5865,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1128_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -6099,8 +5882,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1130_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}}return 18;
 }
@@ -6113,8 +5895,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1138_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -6128,8 +5909,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1139_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -6144,8 +5924,7 @@ unsigned long REGPARAM2 CPUFUNC(op_113a_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -6162,8 +5941,7 @@ unsigned long REGPARAM2 CPUFUNC(op_113b_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}}return 18;
 }
@@ -6175,8 +5953,7 @@ unsigned long REGPARAM2 CPUFUNC(op_113c_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}m68k_incpc(4);
 return 12;
@@ -6189,8 +5966,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1140_0)(uae_u32 opcode) /* MOVE */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}m68k_incpc(4);
 return 12;
@@ -6203,8 +5979,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1148_0)(uae_u32 opcode) /* MOVE */
 {{	uae_s8 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}m68k_incpc(4);
 return 12;
@@ -6218,8 +5993,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1150_0)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -6234,8 +6008,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1158_0)(uae_u32 opcode) /* MOVE */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -6250,8 +6023,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1160_0)(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -6265,8 +6037,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1168_0)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -6282,8 +6053,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1170_0)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(0);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}}m68k_incpc(2);
 return 22;
@@ -6296,8 +6066,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1178_0)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -6310,8 +6079,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1179_0)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 return 24;
@@ -6325,8 +6093,7 @@ unsigned long REGPARAM2 CPUFUNC(op_117a_0)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -6342,8 +6109,7 @@ unsigned long REGPARAM2 CPUFUNC(op_117b_0)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(0);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}}m68k_incpc(2);
 return 22;
@@ -6355,8 +6121,7 @@ unsigned long REGPARAM2 CPUFUNC(op_117c_0)(uae_u32 opcode) /* MOVE */
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}m68k_incpc(6);
 return 16;
@@ -6371,8 +6136,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1180_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}return 14;
 }
@@ -6386,8 +6150,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1188_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}return 14;
 }
@@ -6402,8 +6165,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1190_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}}return 18;
 }
@@ -6419,8 +6181,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1198_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}}return 18;
 }
@@ -6436,8 +6197,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11a0_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}}return 20;
 }
@@ -6452,8 +6212,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11a8_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}}return 22;
 }
@@ -6469,8 +6228,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11b0_0)(uae_u32 opcode) /* MOVE */
 {{	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}}}return 24;
 }
@@ -6484,8 +6242,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11b8_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}}return 22;
 }
@@ -6499,8 +6256,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11b9_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}}return 26;
 }
@@ -6515,8 +6271,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11ba_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}}return 22;
 }
@@ -6532,8 +6287,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11bb_0)(uae_u32 opcode) /* MOVE */
 {{	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}}}return 24;
 }
@@ -6546,8 +6300,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11bc_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}return 18;
 }
@@ -6558,8 +6311,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11c0_0)(uae_u32 opcode) /* MOVE */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}m68k_incpc(4);
 return 12;
@@ -6571,8 +6323,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11c8_0)(uae_u32 opcode) /* MOVE */
 {{	uae_s8 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}m68k_incpc(4);
 return 12;
@@ -6585,8 +6336,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11d0_0)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -6600,8 +6350,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11d8_0)(uae_u32 opcode) /* MOVE */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -6615,8 +6364,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11e0_0)(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -6629,8 +6377,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11e8_0)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -6645,8 +6392,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11f0_0)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(0);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}}m68k_incpc(2);
 return 22;
@@ -6658,8 +6404,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11f8_0)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -6671,8 +6416,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11f9_0)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 return 24;
@@ -6685,8 +6429,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11fa_0)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -6701,8 +6444,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11fb_0)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(0);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}}m68k_incpc(2);
 return 22;
@@ -6713,8 +6455,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11fc_0)(uae_u32 opcode) /* MOVE */
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}m68k_incpc(6);
 return 16;
@@ -6726,8 +6467,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13c0_0)(uae_u32 opcode) /* MOVE */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = get_ilong(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}m68k_incpc(6);
 return 16;
@@ -6739,8 +6479,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13c8_0)(uae_u32 opcode) /* MOVE */
 {{	uae_s8 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = get_ilong(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}m68k_incpc(6);
 return 16;
@@ -6753,8 +6492,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13d0_0)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -6768,8 +6506,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13d8_0)(uae_u32 opcode) /* MOVE */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = get_ilong(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -6783,8 +6520,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13e0_0)(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = get_ilong(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -6797,8 +6533,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13e8_0)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 return 24;
@@ -6813,8 +6548,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13f0_0)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(0);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}}m68k_incpc(4);
 return 26;
@@ -6826,8 +6560,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13f8_0)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 return 24;
@@ -6839,8 +6572,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13f9_0)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(6);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(10);
 return 28;
@@ -6853,8 +6585,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13fa_0)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 return 24;
@@ -6869,8 +6600,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13fb_0)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(0);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}}m68k_incpc(4);
 return 26;
@@ -6881,8 +6611,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13fc_0)(uae_u32 opcode) /* MOVE */
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = get_ilong(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}m68k_incpc(8);
 return 20;
@@ -6894,8 +6623,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2000_0)(uae_u32 opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 4;  
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 return 4;
@@ -6907,8 +6635,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2008_0)(uae_u32 opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 4;  
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 return 4;
@@ -6921,8 +6648,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2010_0)(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 return 12;
@@ -6936,8 +6662,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2018_0)(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 return 12;
@@ -6951,8 +6676,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2020_0)(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 return 14;
@@ -6965,8 +6689,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2028_0)(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 16;
@@ -6981,8 +6704,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2030_0)(uae_u32 opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	uae_s32 src = get_long(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}return 18;
 }
@@ -6993,8 +6715,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2038_0)(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 16;
@@ -7006,8 +6727,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2039_0)(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(6);
 return 20;
@@ -7020,8 +6740,7 @@ unsigned long REGPARAM2 CPUFUNC(op_203a_0)(uae_u32 opcode) /* MOVE */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 16;
@@ -7036,8 +6755,7 @@ unsigned long REGPARAM2 CPUFUNC(op_203b_0)(uae_u32 opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	uae_s32 src = get_long(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}return 18;
 }
@@ -7047,8 +6765,7 @@ unsigned long REGPARAM2 CPUFUNC(op_203c_0)(uae_u32 opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
 {{	uae_s32 src = get_ilong(2);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 return 12;
@@ -7203,8 +6920,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2080_0)(uae_u32 opcode) /* MOVE */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}m68k_incpc(2);
 return 12;
@@ -7217,8 +6933,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2088_0)(uae_u32 opcode) /* MOVE */
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}m68k_incpc(2);
 return 12;
@@ -7232,8 +6947,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2090_0)(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 20;
@@ -7248,8 +6962,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2098_0)(uae_u32 opcode) /* MOVE */
 	m68k_areg(regs, srcreg) += 4;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 20;
@@ -7264,8 +6977,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20a0_0)(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 22;
@@ -7279,8 +6991,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20a8_0)(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 24;
@@ -7296,8 +7007,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20b0_0)(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}}return 26;
 }
@@ -7309,8 +7019,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20b8_0)(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 24;
@@ -7323,8 +7032,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20b9_0)(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 28;
@@ -7338,8 +7046,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20ba_0)(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 24;
@@ -7355,8 +7062,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20bb_0)(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}}return 26;
 }
@@ -7367,8 +7073,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20bc_0)(uae_u32 opcode) /* MOVE */
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}m68k_incpc(6);
 return 20;
@@ -7382,8 +7087,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20c0_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}m68k_incpc(2);
 return 12;
@@ -7397,8 +7101,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20c8_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}m68k_incpc(2);
 return 12;
@@ -7413,8 +7116,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20d0_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 20;
@@ -7430,8 +7132,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20d8_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 20;
@@ -7447,8 +7148,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20e0_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 22;
@@ -7463,8 +7163,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20e8_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 24;
@@ -7481,8 +7180,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20f0_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}}return 26;
 }
@@ -7495,8 +7193,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20f8_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 24;
@@ -7510,8 +7207,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20f9_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 28;
@@ -7526,8 +7222,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20fa_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 24;
@@ -7544,8 +7239,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20fb_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}}return 26;
 }
@@ -7557,8 +7251,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20fc_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}m68k_incpc(6);
 return 20;
@@ -7572,8 +7265,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2100_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}m68k_incpc(2);
 return 12;
@@ -7587,8 +7279,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2108_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}m68k_incpc(2);
 return 12;
@@ -7603,8 +7294,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2110_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 20;
@@ -7620,8 +7310,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2118_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 20;
@@ -7637,8 +7326,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2120_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 22;
@@ -7653,8 +7341,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2128_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 24;
@@ -7671,8 +7358,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2130_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}}return 26;
 }
@@ -7685,8 +7371,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2138_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 24;
@@ -7703,8 +7388,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2139_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 28;
@@ -7719,8 +7403,7 @@ unsigned long REGPARAM2 CPUFUNC(op_213a_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 24;
@@ -7737,8 +7420,7 @@ unsigned long REGPARAM2 CPUFUNC(op_213b_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}}return 26;
 }
@@ -7750,8 +7432,7 @@ unsigned long REGPARAM2 CPUFUNC(op_213c_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}m68k_incpc(6);
 return 20;
@@ -7764,8 +7445,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2140_0)(uae_u32 opcode) /* MOVE */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}m68k_incpc(4);
 return 16;
@@ -7778,8 +7458,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2148_0)(uae_u32 opcode) /* MOVE */
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}m68k_incpc(4);
 return 16;
@@ -7793,8 +7472,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2150_0)(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 24;
@@ -7809,8 +7487,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2158_0)(uae_u32 opcode) /* MOVE */
 	m68k_areg(regs, srcreg) += 4;
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 24;
@@ -7825,8 +7502,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2160_0)(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 26;
@@ -7840,8 +7516,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2168_0)(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 28;
@@ -7857,8 +7532,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2170_0)(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(0);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}}m68k_incpc(2);
 return 30;
@@ -7871,8 +7545,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2178_0)(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 28;
@@ -7885,8 +7558,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2179_0)(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 32;
@@ -7900,8 +7572,7 @@ unsigned long REGPARAM2 CPUFUNC(op_217a_0)(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 28;
@@ -7917,8 +7588,7 @@ unsigned long REGPARAM2 CPUFUNC(op_217b_0)(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(0);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}}m68k_incpc(2);
 return 30;
@@ -7930,8 +7600,7 @@ unsigned long REGPARAM2 CPUFUNC(op_217c_0)(uae_u32 opcode) /* MOVE */
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}m68k_incpc(8);
 return 24;
@@ -7946,8 +7615,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2180_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}return 18;
 }
@@ -7961,8 +7629,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2188_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}return 18;
 }
@@ -7977,8 +7644,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2190_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}}return 26;
 }
@@ -7994,8 +7660,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2198_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}}return 26;
 }
@@ -8011,8 +7676,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21a0_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}}return 28;
 }
@@ -8027,8 +7691,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21a8_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}}return 30;
 }
@@ -8044,8 +7707,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21b0_0)(uae_u32 opcode) /* MOVE */
 {{	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}}}return 32;
 }
@@ -8059,8 +7721,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21b8_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}}return 30;
 }
@@ -8074,8 +7735,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21b9_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}}return 34;
 }
@@ -8090,8 +7750,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21ba_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}}return 30;
 }
@@ -8107,8 +7766,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21bb_0)(uae_u32 opcode) /* MOVE */
 {{	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}}}return 32;
 }
@@ -8121,8 +7779,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21bc_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}return 26;
 }
@@ -8133,8 +7790,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21c0_0)(uae_u32 opcode) /* MOVE */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}m68k_incpc(4);
 return 16;
@@ -8146,8 +7802,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21c8_0)(uae_u32 opcode) /* MOVE */
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}m68k_incpc(4);
 return 16;
@@ -8160,8 +7815,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21d0_0)(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 24;
@@ -8175,8 +7829,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21d8_0)(uae_u32 opcode) /* MOVE */
 	m68k_areg(regs, srcreg) += 4;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 24;
@@ -8190,8 +7843,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21e0_0)(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 26;
@@ -8204,8 +7856,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21e8_0)(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 28;
@@ -8220,8 +7871,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21f0_0)(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(0);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}}m68k_incpc(2);
 return 30;
@@ -8233,8 +7883,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21f8_0)(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 28;
@@ -8246,8 +7895,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21f9_0)(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 32;
@@ -8260,8 +7908,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21fa_0)(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 28;
@@ -8276,8 +7923,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21fb_0)(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(0);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}}m68k_incpc(2);
 return 30;
@@ -8288,8 +7934,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21fc_0)(uae_u32 opcode) /* MOVE */
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}m68k_incpc(8);
 return 24;
@@ -8301,8 +7946,7 @@ unsigned long REGPARAM2 CPUFUNC(op_23c0_0)(uae_u32 opcode) /* MOVE */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = get_ilong(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}m68k_incpc(6);
 return 20;
@@ -8314,8 +7958,7 @@ unsigned long REGPARAM2 CPUFUNC(op_23c8_0)(uae_u32 opcode) /* MOVE */
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = get_ilong(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}m68k_incpc(6);
 return 20;
@@ -8328,8 +7971,7 @@ unsigned long REGPARAM2 CPUFUNC(op_23d0_0)(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 28;
@@ -8343,8 +7985,7 @@ unsigned long REGPARAM2 CPUFUNC(op_23d8_0)(uae_u32 opcode) /* MOVE */
 	m68k_areg(regs, srcreg) += 4;
 {	uaecptr dsta = get_ilong(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 28;
@@ -8358,8 +7999,7 @@ unsigned long REGPARAM2 CPUFUNC(op_23e0_0)(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = get_ilong(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 30;
@@ -8372,8 +8012,7 @@ unsigned long REGPARAM2 CPUFUNC(op_23e8_0)(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 32;
@@ -8388,8 +8027,7 @@ unsigned long REGPARAM2 CPUFUNC(op_23f0_0)(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(0);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}}m68k_incpc(4);
 return 34;
@@ -8401,8 +8039,7 @@ unsigned long REGPARAM2 CPUFUNC(op_23f8_0)(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 32;
@@ -8414,8 +8051,7 @@ unsigned long REGPARAM2 CPUFUNC(op_23f9_0)(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(6);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(10);
 return 36;
@@ -8428,8 +8064,7 @@ unsigned long REGPARAM2 CPUFUNC(op_23fa_0)(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 32;
@@ -8444,8 +8079,7 @@ unsigned long REGPARAM2 CPUFUNC(op_23fb_0)(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(0);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}}m68k_incpc(4);
 return 34;
@@ -8456,8 +8090,7 @@ unsigned long REGPARAM2 CPUFUNC(op_23fc_0)(uae_u32 opcode) /* MOVE */
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = get_ilong(6);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}m68k_incpc(10);
 return 28;
@@ -8469,8 +8102,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3000_0)(uae_u32 opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 4;  
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 return 4;
@@ -8482,8 +8114,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3008_0)(uae_u32 opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 4;  
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 return 4;
@@ -8496,8 +8127,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3010_0)(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 return 8;
@@ -8511,8 +8141,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3018_0)(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 return 8;
@@ -8526,8 +8155,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3020_0)(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 return 10;
@@ -8540,8 +8168,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3028_0)(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 12;
@@ -8556,8 +8183,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3030_0)(uae_u32 opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	uae_s16 src = get_word(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}return 14;
 }
@@ -8568,8 +8194,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3038_0)(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 12;
@@ -8581,8 +8206,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3039_0)(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(6);
 return 16;
@@ -8595,8 +8219,7 @@ unsigned long REGPARAM2 CPUFUNC(op_303a_0)(uae_u32 opcode) /* MOVE */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 12;
@@ -8611,8 +8234,7 @@ unsigned long REGPARAM2 CPUFUNC(op_303b_0)(uae_u32 opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	uae_s16 src = get_word(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}return 14;
 }
@@ -8622,8 +8244,7 @@ unsigned long REGPARAM2 CPUFUNC(op_303c_0)(uae_u32 opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 8;  
 {{	uae_s16 src = get_iword(2);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 return 8;
@@ -8778,8 +8399,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3080_0)(uae_u32 opcode) /* MOVE */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}m68k_incpc(2);
 return 8;
@@ -8792,8 +8412,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3088_0)(uae_u32 opcode) /* MOVE */
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}m68k_incpc(2);
 return 8;
@@ -8807,8 +8426,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3090_0)(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -8823,8 +8441,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3098_0)(uae_u32 opcode) /* MOVE */
 	m68k_areg(regs, srcreg) += 2;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -8839,8 +8456,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30a0_0)(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 14;
@@ -8854,8 +8470,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30a8_0)(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -8871,8 +8486,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30b0_0)(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}}return 18;
 }
@@ -8884,8 +8498,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30b8_0)(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -8898,8 +8511,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30b9_0)(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -8913,8 +8525,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30ba_0)(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -8930,8 +8541,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30bb_0)(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}}return 18;
 }
@@ -8942,8 +8552,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30bc_0)(uae_u32 opcode) /* MOVE */
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 return 12;
@@ -8957,8 +8566,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30c0_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}m68k_incpc(2);
 return 8;
@@ -8972,8 +8580,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30c8_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}m68k_incpc(2);
 return 8;
@@ -8988,8 +8595,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30d0_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -9005,8 +8611,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30d8_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -9022,8 +8627,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30e0_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 14;
@@ -9038,8 +8642,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30e8_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -9056,8 +8659,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30f0_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}}return 18;
 }
@@ -9070,8 +8672,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30f8_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -9085,8 +8686,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30f9_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -9101,8 +8701,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30fa_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -9119,8 +8718,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30fb_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}}return 18;
 }
@@ -9132,8 +8730,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30fc_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 return 12;
@@ -9147,8 +8744,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3100_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}m68k_incpc(2);
 return 8;
@@ -9162,8 +8758,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3108_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}m68k_incpc(2);
 return 8;
@@ -9178,8 +8773,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3110_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -9195,8 +8789,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3118_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -9212,8 +8805,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3120_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 14;
@@ -9228,8 +8820,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3128_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -9246,8 +8837,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3130_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}}return 18;
 }
@@ -9260,8 +8850,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3138_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -9275,8 +8864,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3139_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -9291,8 +8879,7 @@ unsigned long REGPARAM2 CPUFUNC(op_313a_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -9309,8 +8896,7 @@ unsigned long REGPARAM2 CPUFUNC(op_313b_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}}return 18;
 }
@@ -9322,8 +8908,7 @@ unsigned long REGPARAM2 CPUFUNC(op_313c_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 return 12;
@@ -9336,8 +8921,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3140_0)(uae_u32 opcode) /* MOVE */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 return 12;
@@ -9350,8 +8934,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3148_0)(uae_u32 opcode) /* MOVE */
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 return 12;
@@ -9365,8 +8948,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3150_0)(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -9381,8 +8963,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3158_0)(uae_u32 opcode) /* MOVE */
 	m68k_areg(regs, srcreg) += 2;
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -9397,8 +8978,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3160_0)(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -9412,8 +8992,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3168_0)(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -9429,8 +9008,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3170_0)(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(0);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}}m68k_incpc(2);
 return 22;
@@ -9443,8 +9021,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3178_0)(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -9457,8 +9034,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3179_0)(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 return 24;
@@ -9472,8 +9048,7 @@ unsigned long REGPARAM2 CPUFUNC(op_317a_0)(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -9489,8 +9064,7 @@ unsigned long REGPARAM2 CPUFUNC(op_317b_0)(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(0);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}}m68k_incpc(2);
 return 22;
@@ -9502,8 +9076,7 @@ unsigned long REGPARAM2 CPUFUNC(op_317c_0)(uae_u32 opcode) /* MOVE */
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}m68k_incpc(6);
 return 16;
@@ -9518,8 +9091,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3180_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}return 14;
 }
@@ -9533,8 +9105,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3188_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}return 14;
 }
@@ -9549,8 +9120,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3190_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}}return 18;
 }
@@ -9566,8 +9136,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3198_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}}return 18;
 }
@@ -9583,8 +9152,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31a0_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}}return 20;
 }
@@ -9599,8 +9167,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31a8_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}}return 22;
 }
@@ -9616,8 +9183,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31b0_0)(uae_u32 opcode) /* MOVE */
 {{	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}}}return 24;
 }
@@ -9631,8 +9197,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31b8_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}}return 22;
 }
@@ -9646,8 +9211,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31b9_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}}return 26;
 }
@@ -9662,8 +9226,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31ba_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}}return 22;
 }
@@ -9679,8 +9242,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31bb_0)(uae_u32 opcode) /* MOVE */
 {{	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}}}return 24;
 }
@@ -9693,8 +9255,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31bc_0)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_020(m68k_areg(regs, dstreg), next_iword());
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}return 18;
 }
@@ -9705,8 +9266,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31c0_0)(uae_u32 opcode) /* MOVE */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 return 12;
@@ -9718,8 +9278,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31c8_0)(uae_u32 opcode) /* MOVE */
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 return 12;
@@ -9732,8 +9291,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31d0_0)(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -9747,8 +9305,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31d8_0)(uae_u32 opcode) /* MOVE */
 	m68k_areg(regs, srcreg) += 2;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -9762,8 +9319,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31e0_0)(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -9776,8 +9332,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31e8_0)(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -9792,8 +9347,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31f0_0)(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(0);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}}m68k_incpc(2);
 return 22;
@@ -9805,8 +9359,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31f8_0)(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -9818,8 +9371,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31f9_0)(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 return 24;
@@ -9832,8 +9384,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31fa_0)(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -9848,8 +9399,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31fb_0)(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(0);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}}m68k_incpc(2);
 return 22;
@@ -9860,8 +9410,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31fc_0)(uae_u32 opcode) /* MOVE */
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}m68k_incpc(6);
 return 16;
@@ -9873,8 +9422,7 @@ unsigned long REGPARAM2 CPUFUNC(op_33c0_0)(uae_u32 opcode) /* MOVE */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = get_ilong(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}m68k_incpc(6);
 return 16;
@@ -9886,8 +9434,7 @@ unsigned long REGPARAM2 CPUFUNC(op_33c8_0)(uae_u32 opcode) /* MOVE */
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = get_ilong(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}m68k_incpc(6);
 return 16;
@@ -9900,8 +9447,7 @@ unsigned long REGPARAM2 CPUFUNC(op_33d0_0)(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -9915,8 +9461,7 @@ unsigned long REGPARAM2 CPUFUNC(op_33d8_0)(uae_u32 opcode) /* MOVE */
 	m68k_areg(regs, srcreg) += 2;
 {	uaecptr dsta = get_ilong(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -9930,8 +9475,7 @@ unsigned long REGPARAM2 CPUFUNC(op_33e0_0)(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = get_ilong(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -9944,8 +9488,7 @@ unsigned long REGPARAM2 CPUFUNC(op_33e8_0)(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 return 24;
@@ -9960,8 +9503,7 @@ unsigned long REGPARAM2 CPUFUNC(op_33f0_0)(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(0);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}}m68k_incpc(4);
 return 26;
@@ -9973,8 +9515,7 @@ unsigned long REGPARAM2 CPUFUNC(op_33f8_0)(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 return 24;
@@ -9986,8 +9527,7 @@ unsigned long REGPARAM2 CPUFUNC(op_33f9_0)(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(6);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(10);
 return 28;
@@ -10000,8 +9540,7 @@ unsigned long REGPARAM2 CPUFUNC(op_33fa_0)(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 return 24;
@@ -10016,8 +9555,7 @@ unsigned long REGPARAM2 CPUFUNC(op_33fb_0)(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(0);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}}m68k_incpc(4);
 return 26;
@@ -10028,8 +9566,7 @@ unsigned long REGPARAM2 CPUFUNC(op_33fc_0)(uae_u32 opcode) /* MOVE */
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = get_ilong(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}m68k_incpc(8);
 return 20;
@@ -11013,8 +10550,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4200_0)(uae_u32 opcode) /* CLR */
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 4;  
 {{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+	SET_NZFLG (((uae_s8)(0)));
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((0) & 0xff);
 }}m68k_incpc(2);
 return 4;
@@ -11026,8 +10562,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4210_0)(uae_u32 opcode) /* CLR */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+	SET_NZFLG (((uae_s8)(0)));
 	put_byte(srca,0);
 }}m68k_incpc(2);
 return 12;
@@ -11040,8 +10575,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4218_0)(uae_u32 opcode) /* CLR */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+	SET_NZFLG (((uae_s8)(0)));
 	put_byte(srca,0);
 }}m68k_incpc(2);
 return 12;
@@ -11054,8 +10588,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4220_0)(uae_u32 opcode) /* CLR */
 	m68k_areg (regs, srcreg) = srca;
 	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+	SET_NZFLG (((uae_s8)(0)));
 	put_byte(srca,0);
 }}m68k_incpc(2);
 return 14;
@@ -11067,8 +10600,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4228_0)(uae_u32 opcode) /* CLR */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+	SET_NZFLG (((uae_s8)(0)));
 	put_byte(srca,0);
 }}m68k_incpc(4);
 return 16;
@@ -11082,8 +10614,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4230_0)(uae_u32 opcode) /* CLR */
 	BusCyclePenalty += 2;
 	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+	SET_NZFLG (((uae_s8)(0)));
 	put_byte(srca,0);
 }}}return 18;
 }
@@ -11093,8 +10624,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4238_0)(uae_u32 opcode) /* CLR */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+	SET_NZFLG (((uae_s8)(0)));
 	put_byte(srca,0);
 }}m68k_incpc(4);
 return 16;
@@ -11105,8 +10635,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4239_0)(uae_u32 opcode) /* CLR */
 {{	uaecptr srca = get_ilong(2);
 	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+	SET_NZFLG (((uae_s8)(0)));
 	put_byte(srca,0);
 }}m68k_incpc(6);
 return 20;
@@ -11116,8 +10645,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4240_0)(uae_u32 opcode) /* CLR */
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 4;  
 {{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+	SET_NZFLG (((uae_s16)(0)));
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((0) & 0xffff);
 }}m68k_incpc(2);
 return 4;
@@ -11129,8 +10657,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4250_0)(uae_u32 opcode) /* CLR */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 	uae_s16 src = get_word(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+	SET_NZFLG (((uae_s16)(0)));
 	put_word(srca,0);
 }}m68k_incpc(2);
 return 12;
@@ -11143,8 +10670,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4258_0)(uae_u32 opcode) /* CLR */
 	m68k_areg(regs, srcreg) += 2;
 	uae_s16 src = get_word(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+	SET_NZFLG (((uae_s16)(0)));
 	put_word(srca,0);
 }}m68k_incpc(2);
 return 12;
@@ -11157,8 +10683,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4260_0)(uae_u32 opcode) /* CLR */
 	m68k_areg (regs, srcreg) = srca;
 	uae_s16 src = get_word(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+	SET_NZFLG (((uae_s16)(0)));
 	put_word(srca,0);
 }}m68k_incpc(2);
 return 14;
@@ -11170,8 +10695,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4268_0)(uae_u32 opcode) /* CLR */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 	uae_s16 src = get_word(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+	SET_NZFLG (((uae_s16)(0)));
 	put_word(srca,0);
 }}m68k_incpc(4);
 return 16;
@@ -11188,8 +10712,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4270_0)(uae_u32 opcode) /* CLR */
 	BusCyclePenalty += 2;
 	uae_s16 src = get_word(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+	SET_NZFLG (((uae_s16)(0)));
 	put_word(srca,0);
 }}}return 18;
 }
@@ -11199,8 +10722,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4278_0)(uae_u32 opcode) /* CLR */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 	uae_s16 src = get_word(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+	SET_NZFLG (((uae_s16)(0)));
 	put_word(srca,0);
 }}m68k_incpc(4);
 return 16;
@@ -11211,8 +10733,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4279_0)(uae_u32 opcode) /* CLR */
 {{	uaecptr srca = get_ilong(2);
 	uae_s16 src = get_word(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+	SET_NZFLG (((uae_s16)(0)));
 	put_word(srca,0);
 }}m68k_incpc(6);
 return 20;
@@ -11222,8 +10743,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4280_0)(uae_u32 opcode) /* CLR */
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 6;  
 {{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+	SET_NZFLG (((uae_s32)(0)));
 	m68k_dreg(regs, srcreg) = (0);
 }}m68k_incpc(2);
 return 6;
@@ -11235,8 +10755,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4290_0)(uae_u32 opcode) /* CLR */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 	uae_s32 src = get_long(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+	SET_NZFLG (((uae_s32)(0)));
 	put_long(srca,0);
 }}m68k_incpc(2);
 return 20;
@@ -11249,8 +10768,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4298_0)(uae_u32 opcode) /* CLR */
 	m68k_areg(regs, srcreg) += 4;
 	uae_s32 src = get_long(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+	SET_NZFLG (((uae_s32)(0)));
 	put_long(srca,0);
 }}m68k_incpc(2);
 return 20;
@@ -11263,8 +10781,7 @@ unsigned long REGPARAM2 CPUFUNC(op_42a0_0)(uae_u32 opcode) /* CLR */
 	m68k_areg (regs, srcreg) = srca;
 	uae_s32 src = get_long(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+	SET_NZFLG (((uae_s32)(0)));
 	put_long(srca,0);
 }}m68k_incpc(2);
 return 22;
@@ -11276,8 +10793,7 @@ unsigned long REGPARAM2 CPUFUNC(op_42a8_0)(uae_u32 opcode) /* CLR */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 	uae_s32 src = get_long(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+	SET_NZFLG (((uae_s32)(0)));
 	put_long(srca,0);
 }}m68k_incpc(4);
 return 24;
@@ -11291,8 +10807,7 @@ unsigned long REGPARAM2 CPUFUNC(op_42b0_0)(uae_u32 opcode) /* CLR */
 	BusCyclePenalty += 2;
 	uae_s32 src = get_long(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+	SET_NZFLG (((uae_s32)(0)));
 	put_long(srca,0);
 }}}return 26;
 }
@@ -11302,8 +10817,7 @@ unsigned long REGPARAM2 CPUFUNC(op_42b8_0)(uae_u32 opcode) /* CLR */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 	uae_s32 src = get_long(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+	SET_NZFLG (((uae_s32)(0)));
 	put_long(srca,0);
 }}m68k_incpc(4);
 return 24;
@@ -11314,8 +10828,7 @@ unsigned long REGPARAM2 CPUFUNC(op_42b9_0)(uae_u32 opcode) /* CLR */
 {{	uaecptr srca = get_ilong(2);
 	uae_s32 src = get_long(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+	SET_NZFLG (((uae_s32)(0)));
 	put_long(srca,0);
 }}m68k_incpc(6);
 return 28;
@@ -11410,11 +10923,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4400_0)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
+	SET_NZFLG (((uae_s8)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((dst) & 0xff);
 }}}}}m68k_incpc(2);
 return 4;
@@ -11430,11 +10942,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4410_0)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
+	SET_NZFLG (((uae_s8)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(srca,dst);
 }}}}}}m68k_incpc(2);
 return 12;
@@ -11451,11 +10962,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4418_0)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
+	SET_NZFLG (((uae_s8)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(srca,dst);
 }}}}}}m68k_incpc(2);
 return 12;
@@ -11472,11 +10982,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4420_0)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
+	SET_NZFLG (((uae_s8)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(srca,dst);
 }}}}}}m68k_incpc(2);
 return 14;
@@ -11492,11 +11001,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4428_0)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
+	SET_NZFLG (((uae_s8)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(srca,dst);
 }}}}}}m68k_incpc(4);
 return 16;
@@ -11514,11 +11022,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4430_0)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
+	SET_NZFLG (((uae_s8)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(srca,dst);
 }}}}}}}return 18;
 }
@@ -11532,11 +11039,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4438_0)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
+	SET_NZFLG (((uae_s8)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(srca,dst);
 }}}}}}m68k_incpc(4);
 return 16;
@@ -11551,11 +11057,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4439_0)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
+	SET_NZFLG (((uae_s8)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(srca,dst);
 }}}}}}m68k_incpc(6);
 return 20;
@@ -11570,11 +11075,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4440_0)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
+	SET_NZFLG (((uae_s16)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
 }}}}}m68k_incpc(2);
 return 4;
@@ -11590,11 +11094,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4450_0)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
+	SET_NZFLG (((uae_s16)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(srca,dst);
 }}}}}}m68k_incpc(2);
 return 12;
@@ -11611,11 +11114,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4458_0)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
+	SET_NZFLG (((uae_s16)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(srca,dst);
 }}}}}}m68k_incpc(2);
 return 12;
@@ -11632,11 +11134,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4460_0)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
+	SET_NZFLG (((uae_s16)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(srca,dst);
 }}}}}}m68k_incpc(2);
 return 14;
@@ -11652,11 +11153,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4468_0)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
+	SET_NZFLG (((uae_s16)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(srca,dst);
 }}}}}}m68k_incpc(4);
 return 16;
@@ -11674,11 +11174,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4470_0)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
+	SET_NZFLG (((uae_s16)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(srca,dst);
 }}}}}}}return 18;
 }
@@ -11692,11 +11191,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4478_0)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
+	SET_NZFLG (((uae_s16)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(srca,dst);
 }}}}}}m68k_incpc(4);
 return 16;
@@ -11711,11 +11209,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4479_0)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
+	SET_NZFLG (((uae_s16)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(srca,dst);
 }}}}}}m68k_incpc(6);
 return 20;
@@ -11730,11 +11227,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4480_0)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
+	SET_NZFLG (((uae_s32)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, srcreg) = (dst);
 }}}}}m68k_incpc(2);
 return 6;
@@ -11750,11 +11246,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4490_0)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
+	SET_NZFLG (((uae_s32)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(srca,dst);
 }}}}}}m68k_incpc(2);
 return 20;
@@ -11771,11 +11266,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4498_0)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
+	SET_NZFLG (((uae_s32)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(srca,dst);
 }}}}}}m68k_incpc(2);
 return 20;
@@ -11792,11 +11286,10 @@ unsigned long REGPARAM2 CPUFUNC(op_44a0_0)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
+	SET_NZFLG (((uae_s32)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(srca,dst);
 }}}}}}m68k_incpc(2);
 return 22;
@@ -11812,11 +11305,10 @@ unsigned long REGPARAM2 CPUFUNC(op_44a8_0)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
+	SET_NZFLG (((uae_s32)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(srca,dst);
 }}}}}}m68k_incpc(4);
 return 24;
@@ -11834,11 +11326,10 @@ unsigned long REGPARAM2 CPUFUNC(op_44b0_0)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
+	SET_NZFLG (((uae_s32)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(srca,dst);
 }}}}}}}return 26;
 }
@@ -11852,11 +11343,10 @@ unsigned long REGPARAM2 CPUFUNC(op_44b8_0)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
+	SET_NZFLG (((uae_s32)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(srca,dst);
 }}}}}}m68k_incpc(4);
 return 24;
@@ -11871,11 +11361,10 @@ unsigned long REGPARAM2 CPUFUNC(op_44b9_0)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
+	SET_NZFLG (((uae_s32)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(srca,dst);
 }}}}}}m68k_incpc(6);
 return 28;
@@ -12030,8 +11519,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4600_0)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	SET_NZFLG (((uae_s8)(dst)));
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((dst) & 0xff);
 }}}m68k_incpc(2);
 return 4;
@@ -12045,8 +11533,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4610_0)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	SET_NZFLG (((uae_s8)(dst)));
 	put_byte(srca,dst);
 }}}}m68k_incpc(2);
 return 12;
@@ -12061,8 +11548,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4618_0)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	SET_NZFLG (((uae_s8)(dst)));
 	put_byte(srca,dst);
 }}}}m68k_incpc(2);
 return 12;
@@ -12077,8 +11563,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4620_0)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	SET_NZFLG (((uae_s8)(dst)));
 	put_byte(srca,dst);
 }}}}m68k_incpc(2);
 return 14;
@@ -12092,8 +11577,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4628_0)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	SET_NZFLG (((uae_s8)(dst)));
 	put_byte(srca,dst);
 }}}}m68k_incpc(4);
 return 16;
@@ -12109,8 +11593,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4630_0)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	SET_NZFLG (((uae_s8)(dst)));
 	put_byte(srca,dst);
 }}}}}return 18;
 }
@@ -12122,8 +11605,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4638_0)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	SET_NZFLG (((uae_s8)(dst)));
 	put_byte(srca,dst);
 }}}}m68k_incpc(4);
 return 16;
@@ -12136,8 +11618,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4639_0)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	SET_NZFLG (((uae_s8)(dst)));
 	put_byte(srca,dst);
 }}}}m68k_incpc(6);
 return 20;
@@ -12150,8 +11631,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4640_0)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	SET_NZFLG (((uae_s16)(dst)));
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
 }}}m68k_incpc(2);
 return 4;
@@ -12165,8 +11645,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4650_0)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	SET_NZFLG (((uae_s16)(dst)));
 	put_word(srca,dst);
 }}}}m68k_incpc(2);
 return 12;
@@ -12181,8 +11660,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4658_0)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	SET_NZFLG (((uae_s16)(dst)));
 	put_word(srca,dst);
 }}}}m68k_incpc(2);
 return 12;
@@ -12197,8 +11675,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4660_0)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	SET_NZFLG (((uae_s16)(dst)));
 	put_word(srca,dst);
 }}}}m68k_incpc(2);
 return 14;
@@ -12212,8 +11689,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4668_0)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	SET_NZFLG (((uae_s16)(dst)));
 	put_word(srca,dst);
 }}}}m68k_incpc(4);
 return 16;
@@ -12229,8 +11705,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4670_0)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	SET_NZFLG (((uae_s16)(dst)));
 	put_word(srca,dst);
 }}}}}return 18;
 }
@@ -12242,8 +11717,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4678_0)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	SET_NZFLG (((uae_s16)(dst)));
 	put_word(srca,dst);
 }}}}m68k_incpc(4);
 return 16;
@@ -12256,8 +11730,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4679_0)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	SET_NZFLG (((uae_s16)(dst)));
 	put_word(srca,dst);
 }}}}m68k_incpc(6);
 return 20;
@@ -12270,8 +11743,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4680_0)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_NZFLG (((uae_s32)(dst)));
 	m68k_dreg(regs, srcreg) = (dst);
 }}}m68k_incpc(2);
 return 6;
@@ -12285,8 +11757,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4690_0)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_NZFLG (((uae_s32)(dst)));
 	put_long(srca,dst);
 }}}}m68k_incpc(2);
 return 20;
@@ -12301,8 +11772,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4698_0)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_NZFLG (((uae_s32)(dst)));
 	put_long(srca,dst);
 }}}}m68k_incpc(2);
 return 20;
@@ -12317,8 +11787,7 @@ unsigned long REGPARAM2 CPUFUNC(op_46a0_0)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_NZFLG (((uae_s32)(dst)));
 	put_long(srca,dst);
 }}}}m68k_incpc(2);
 return 22;
@@ -12332,8 +11801,7 @@ unsigned long REGPARAM2 CPUFUNC(op_46a8_0)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_NZFLG (((uae_s32)(dst)));
 	put_long(srca,dst);
 }}}}m68k_incpc(4);
 return 24;
@@ -12349,8 +11817,7 @@ unsigned long REGPARAM2 CPUFUNC(op_46b0_0)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_NZFLG (((uae_s32)(dst)));
 	put_long(srca,dst);
 }}}}}return 26;
 }
@@ -12362,8 +11829,7 @@ unsigned long REGPARAM2 CPUFUNC(op_46b8_0)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_NZFLG (((uae_s32)(dst)));
 	put_long(srca,dst);
 }}}}m68k_incpc(4);
 return 24;
@@ -12376,8 +11842,7 @@ unsigned long REGPARAM2 CPUFUNC(op_46b9_0)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_NZFLG (((uae_s32)(dst)));
 	put_long(srca,dst);
 }}}}m68k_incpc(6);
 return 28;
@@ -12713,8 +12178,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4840_0)(uae_u32 opcode) /* SWAP */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_u32 dst = ((src >> 16)&0xFFFF) | ((src&0xFFFF)<<16);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_NZFLG (((uae_s32)(dst)));
 	m68k_dreg(regs, srcreg) = (dst);
 }}}m68k_incpc(2);
 return 4;
@@ -12811,8 +12275,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4880_0)(uae_u32 opcode) /* EXT */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_u16 dst = (uae_s16)(uae_s8)src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	SET_NZFLG (((uae_s16)(dst)));
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
 }}}m68k_incpc(2);
 return 4;
@@ -12908,8 +12371,7 @@ unsigned long REGPARAM2 CPUFUNC(op_48c0_0)(uae_u32 opcode) /* EXT */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_u32 dst = (uae_s32)(uae_s16)src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_NZFLG (((uae_s32)(dst)));
 	m68k_dreg(regs, srcreg) = (dst);
 }}}m68k_incpc(2);
 return 4;
@@ -13005,8 +12467,7 @@ unsigned long REGPARAM2 CPUFUNC(op_49c0_0)(uae_u32 opcode) /* EXT */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_u32 dst = (uae_s32)(uae_s8)src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_NZFLG (((uae_s32)(dst)));
 	m68k_dreg(regs, srcreg) = (dst);
 }}}m68k_incpc(2);
 return 4;
@@ -13017,8 +12478,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a00_0)(uae_u32 opcode) /* TST */
 	OpcodeFamily = 20; CurrentInstrCycles = 4;  
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 }}m68k_incpc(2);
 return 4;
 }
@@ -13029,8 +12489,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a10_0)(uae_u32 opcode) /* TST */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 }}}m68k_incpc(2);
 return 8;
 }
@@ -13042,8 +12501,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a18_0)(uae_u32 opcode) /* TST */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 }}}m68k_incpc(2);
 return 8;
 }
@@ -13055,8 +12513,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a20_0)(uae_u32 opcode) /* TST */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 }}}m68k_incpc(2);
 return 10;
 }
@@ -13067,8 +12524,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a28_0)(uae_u32 opcode) /* TST */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 }}}m68k_incpc(4);
 return 12;
 }
@@ -13081,8 +12537,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a30_0)(uae_u32 opcode) /* TST */
 	BusCyclePenalty += 2;
 {	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 }}}}return 14;
 }
 unsigned long REGPARAM2 CPUFUNC(op_4a38_0)(uae_u32 opcode) /* TST */
@@ -13091,8 +12546,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a38_0)(uae_u32 opcode) /* TST */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 }}}m68k_incpc(4);
 return 12;
 }
@@ -13102,8 +12556,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a39_0)(uae_u32 opcode) /* TST */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 }}}m68k_incpc(6);
 return 16;
 }
@@ -13114,8 +12567,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a3a_0)(uae_u32 opcode) /* TST */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 }}}m68k_incpc(4);
 return 12;
 }
@@ -13128,8 +12580,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a3b_0)(uae_u32 opcode) /* TST */
 	BusCyclePenalty += 2;
 {	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 }}}}return 14;
 }
 unsigned long REGPARAM2 CPUFUNC(op_4a3c_0)(uae_u32 opcode) /* TST */
@@ -13137,8 +12588,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a3c_0)(uae_u32 opcode) /* TST */
 	OpcodeFamily = 20; CurrentInstrCycles = 8;  
 {{	uae_s8 src = get_ibyte(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 }}m68k_incpc(4);
 return 8;
 }
@@ -13148,8 +12598,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a40_0)(uae_u32 opcode) /* TST */
 	OpcodeFamily = 20; CurrentInstrCycles = 4;  
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 }}m68k_incpc(2);
 return 4;
 }
@@ -13159,8 +12608,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a48_0)(uae_u32 opcode) /* TST */
 	OpcodeFamily = 20; CurrentInstrCycles = 4;  
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 }}m68k_incpc(2);
 return 4;
 }
@@ -13171,8 +12619,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a50_0)(uae_u32 opcode) /* TST */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 }}}m68k_incpc(2);
 return 8;
 }
@@ -13184,8 +12631,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a58_0)(uae_u32 opcode) /* TST */
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 }}}m68k_incpc(2);
 return 8;
 }
@@ -13197,8 +12643,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a60_0)(uae_u32 opcode) /* TST */
 {	uae_s16 src = get_word(srca);
 	m68k_areg (regs, srcreg) = srca;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 }}}m68k_incpc(2);
 return 10;
 }
@@ -13209,8 +12654,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a68_0)(uae_u32 opcode) /* TST */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 }}}m68k_incpc(4);
 return 12;
 }
@@ -13223,8 +12667,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a70_0)(uae_u32 opcode) /* TST */
 	BusCyclePenalty += 2;
 {	uae_s16 src = get_word(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 }}}}return 14;
 }
 unsigned long REGPARAM2 CPUFUNC(op_4a78_0)(uae_u32 opcode) /* TST */
@@ -13233,8 +12676,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a78_0)(uae_u32 opcode) /* TST */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 }}}m68k_incpc(4);
 return 12;
 }
@@ -13244,8 +12686,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a79_0)(uae_u32 opcode) /* TST */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 }}}m68k_incpc(6);
 return 16;
 }
@@ -13256,8 +12697,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a7a_0)(uae_u32 opcode) /* TST */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 }}}m68k_incpc(4);
 return 12;
 }
@@ -13270,8 +12710,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a7b_0)(uae_u32 opcode) /* TST */
 	BusCyclePenalty += 2;
 {	uae_s16 src = get_word(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 }}}}return 14;
 }
 unsigned long REGPARAM2 CPUFUNC(op_4a7c_0)(uae_u32 opcode) /* TST */
@@ -13279,8 +12718,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a7c_0)(uae_u32 opcode) /* TST */
 	OpcodeFamily = 20; CurrentInstrCycles = 8;  
 {{	uae_s16 src = get_iword(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 }}m68k_incpc(4);
 return 8;
 }
@@ -13290,8 +12728,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a80_0)(uae_u32 opcode) /* TST */
 	OpcodeFamily = 20; CurrentInstrCycles = 4;  
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 }}m68k_incpc(2);
 return 4;
 }
@@ -13301,8 +12738,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a88_0)(uae_u32 opcode) /* TST */
 	OpcodeFamily = 20; CurrentInstrCycles = 4;  
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 }}m68k_incpc(2);
 return 4;
 }
@@ -13313,8 +12749,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a90_0)(uae_u32 opcode) /* TST */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 }}}m68k_incpc(2);
 return 12;
 }
@@ -13326,8 +12761,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a98_0)(uae_u32 opcode) /* TST */
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 }}}m68k_incpc(2);
 return 12;
 }
@@ -13339,8 +12773,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4aa0_0)(uae_u32 opcode) /* TST */
 {	uae_s32 src = get_long(srca);
 	m68k_areg (regs, srcreg) = srca;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 }}}m68k_incpc(2);
 return 14;
 }
@@ -13351,8 +12784,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4aa8_0)(uae_u32 opcode) /* TST */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 }}}m68k_incpc(4);
 return 16;
 }
@@ -13365,8 +12797,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4ab0_0)(uae_u32 opcode) /* TST */
 	BusCyclePenalty += 2;
 {	uae_s32 src = get_long(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 }}}}return 18;
 }
 unsigned long REGPARAM2 CPUFUNC(op_4ab8_0)(uae_u32 opcode) /* TST */
@@ -13375,8 +12806,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4ab8_0)(uae_u32 opcode) /* TST */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 }}}m68k_incpc(4);
 return 16;
 }
@@ -13386,8 +12816,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4ab9_0)(uae_u32 opcode) /* TST */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 }}}m68k_incpc(6);
 return 20;
 }
@@ -13398,8 +12827,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4aba_0)(uae_u32 opcode) /* TST */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 }}}m68k_incpc(4);
 return 16;
 }
@@ -13412,8 +12840,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4abb_0)(uae_u32 opcode) /* TST */
 	BusCyclePenalty += 2;
 {	uae_s32 src = get_long(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 }}}}return 18;
 }
 unsigned long REGPARAM2 CPUFUNC(op_4abc_0)(uae_u32 opcode) /* TST */
@@ -13421,8 +12848,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4abc_0)(uae_u32 opcode) /* TST */
 	OpcodeFamily = 20; CurrentInstrCycles = 12; 
 {{	uae_s32 src = get_ilong(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 }}m68k_incpc(6);
 return 12;
 }
@@ -13432,8 +12858,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4ac0_0)(uae_u32 opcode) /* TAS */
 	OpcodeFamily = 98; CurrentInstrCycles = 4;  
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	src |= 0x80;
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((src) & 0xff);
 }}m68k_incpc(2);
@@ -13446,8 +12871,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4ad0_0)(uae_u32 opcode) /* TAS */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(2);
@@ -13461,8 +12885,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4ad8_0)(uae_u32 opcode) /* TAS */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(2);
@@ -13476,8 +12899,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4ae0_0)(uae_u32 opcode) /* TAS */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(2);
@@ -13490,8 +12912,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4ae8_0)(uae_u32 opcode) /* TAS */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(4);
@@ -13506,8 +12927,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4af0_0)(uae_u32 opcode) /* TAS */
 	BusCyclePenalty += 2;
 {	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	src |= 0x80;
 	put_byte(srca,src);
 }}}}return 20;
@@ -13518,8 +12938,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4af8_0)(uae_u32 opcode) /* TAS */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(4);
@@ -13531,8 +12950,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4af9_0)(uae_u32 opcode) /* TAS */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(6);
@@ -14347,11 +13765,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5000_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}m68k_incpc(2);
 return 4;
@@ -14369,11 +13786,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5010_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(2);
 return 12;
@@ -14392,11 +13808,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5018_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(2);
 return 12;
@@ -14418,11 +13833,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5020_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(2);
 return 14;
@@ -14440,11 +13854,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5028_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 16;
@@ -14464,11 +13877,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5030_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}}return 18;
 }
@@ -14484,11 +13896,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5038_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 16;
@@ -14505,11 +13916,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5039_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(6);
 return 20;
@@ -14526,11 +13936,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5040_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}m68k_incpc(2);
 return 4;
@@ -14560,11 +13969,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5050_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(2);
 return 12;
@@ -14583,11 +13991,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5058_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(2);
 return 12;
@@ -14606,11 +14013,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5060_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(2);
 return 14;
@@ -14628,11 +14034,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5068_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 16;
@@ -14652,11 +14057,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5070_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}}return 18;
 }
@@ -14672,11 +14076,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5078_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 16;
@@ -14693,11 +14096,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5079_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(6);
 return 20;
@@ -14714,11 +14116,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5080_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}m68k_incpc(2);
 return 8;
@@ -14748,11 +14149,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5090_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(2);
 return 20;
@@ -14771,11 +14171,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5098_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(2);
 return 20;
@@ -14794,11 +14193,10 @@ unsigned long REGPARAM2 CPUFUNC(op_50a0_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(2);
 return 22;
@@ -14816,11 +14214,10 @@ unsigned long REGPARAM2 CPUFUNC(op_50a8_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 24;
@@ -14840,11 +14237,10 @@ unsigned long REGPARAM2 CPUFUNC(op_50b0_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}}return 26;
 }
@@ -14860,11 +14256,10 @@ unsigned long REGPARAM2 CPUFUNC(op_50b8_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 24;
@@ -14881,11 +14276,10 @@ unsigned long REGPARAM2 CPUFUNC(op_50b9_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(6);
 return 28;
@@ -15029,11 +14423,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5100_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}m68k_incpc(2);
 return 4;
@@ -15051,11 +14444,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5110_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(2);
 return 12;
@@ -15074,11 +14466,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5118_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(2);
 return 12;
@@ -15097,11 +14488,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5120_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(2);
 return 14;
@@ -15119,11 +14509,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5128_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 16;
@@ -15143,11 +14532,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5130_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}}return 18;
 }
@@ -15163,11 +14551,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5138_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 16;
@@ -15184,11 +14571,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5139_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(6);
 return 20;
@@ -15205,11 +14591,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5140_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}m68k_incpc(2);
 return 4;
@@ -15239,11 +14624,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5150_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(2);
 return 12;
@@ -15262,11 +14646,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5158_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(2);
 return 12;
@@ -15285,11 +14668,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5160_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(2);
 return 14;
@@ -15307,11 +14689,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5168_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 16;
@@ -15331,11 +14712,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5170_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}}return 18;
 }
@@ -15351,11 +14731,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5178_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 16;
@@ -15372,11 +14751,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5179_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(6);
 return 20;
@@ -15393,11 +14771,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5180_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}m68k_incpc(2);
 return 8;
@@ -15427,11 +14804,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5190_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(2);
 return 20;
@@ -15450,11 +14826,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5198_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(2);
 return 20;
@@ -15473,11 +14848,10 @@ unsigned long REGPARAM2 CPUFUNC(op_51a0_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(2);
 return 22;
@@ -15495,11 +14869,10 @@ unsigned long REGPARAM2 CPUFUNC(op_51a8_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 24;
@@ -15519,11 +14892,10 @@ unsigned long REGPARAM2 CPUFUNC(op_51b0_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}}return 26;
 }
@@ -15539,11 +14911,10 @@ unsigned long REGPARAM2 CPUFUNC(op_51b8_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 24;
@@ -15560,11 +14931,10 @@ unsigned long REGPARAM2 CPUFUNC(op_51b9_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(6);
 return 28;
@@ -18064,8 +17434,7 @@ unsigned long REGPARAM2 CPUFUNC(op_7000_0)(uae_u32 opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 4;  
 {{	uae_u32 src = srcreg;
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 return 4;
@@ -18080,8 +17449,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8000_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(2);
 return 4;
@@ -18097,8 +17465,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8010_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 return 8;
@@ -18115,8 +17482,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8018_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 return 8;
@@ -18133,8 +17499,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8020_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 return 10;
@@ -18150,8 +17515,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8028_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 12;
@@ -18169,8 +17533,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8030_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}return 14;
 }
@@ -18184,8 +17547,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8038_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 12;
@@ -18200,8 +17562,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8039_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(6);
 return 16;
@@ -18217,8 +17578,7 @@ unsigned long REGPARAM2 CPUFUNC(op_803a_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 12;
@@ -18236,8 +17596,7 @@ unsigned long REGPARAM2 CPUFUNC(op_803b_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}return 14;
 }
@@ -18250,8 +17609,7 @@ unsigned long REGPARAM2 CPUFUNC(op_803c_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 return 8;
@@ -18266,8 +17624,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8040_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 return 4;
@@ -18283,8 +17640,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8050_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 return 8;
@@ -18301,8 +17657,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8058_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 return 8;
@@ -18319,8 +17674,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8060_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 return 10;
@@ -18336,8 +17690,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8068_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 12;
@@ -18355,8 +17708,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8070_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}return 14;
 }
@@ -18370,8 +17722,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8078_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 12;
@@ -18386,8 +17737,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8079_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(6);
 return 16;
@@ -18403,8 +17753,7 @@ unsigned long REGPARAM2 CPUFUNC(op_807a_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 12;
@@ -18422,8 +17771,7 @@ unsigned long REGPARAM2 CPUFUNC(op_807b_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}return 14;
 }
@@ -18436,8 +17784,7 @@ unsigned long REGPARAM2 CPUFUNC(op_807c_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 return 8;
@@ -18452,8 +17799,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8080_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 return 8;
@@ -18469,8 +17815,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8090_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 return 14;
@@ -18487,8 +17832,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8098_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 return 14;
@@ -18505,8 +17849,7 @@ unsigned long REGPARAM2 CPUFUNC(op_80a0_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 return 16;
@@ -18522,8 +17865,7 @@ unsigned long REGPARAM2 CPUFUNC(op_80a8_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 18;
@@ -18541,8 +17883,7 @@ unsigned long REGPARAM2 CPUFUNC(op_80b0_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}return 20;
 }
@@ -18556,8 +17897,7 @@ unsigned long REGPARAM2 CPUFUNC(op_80b8_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 18;
@@ -18572,8 +17912,7 @@ unsigned long REGPARAM2 CPUFUNC(op_80b9_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(6);
 return 22;
@@ -18589,8 +17928,7 @@ unsigned long REGPARAM2 CPUFUNC(op_80ba_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 18;
@@ -18608,8 +17946,7 @@ unsigned long REGPARAM2 CPUFUNC(op_80bb_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}return 20;
 }
@@ -18622,8 +17959,7 @@ unsigned long REGPARAM2 CPUFUNC(op_80bc_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 return 16;
@@ -18644,8 +17980,7 @@ m68k_incpc(2);
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -18671,8 +18006,7 @@ m68k_incpc(2);
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -18699,8 +18033,7 @@ m68k_incpc(2);
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -18727,8 +18060,7 @@ m68k_incpc(2);
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -18754,8 +18086,7 @@ m68k_incpc(4);
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -18782,8 +18113,7 @@ unsigned long REGPARAM2 CPUFUNC(op_80f0_0)(uae_u32 opcode) /* DIVU */
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -18808,8 +18138,7 @@ m68k_incpc(4);
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -18834,8 +18163,7 @@ m68k_incpc(6);
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -18861,8 +18189,7 @@ m68k_incpc(4);
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -18889,8 +18216,7 @@ unsigned long REGPARAM2 CPUFUNC(op_80fb_0)(uae_u32 opcode) /* DIVU */
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -18914,8 +18240,7 @@ m68k_incpc(4);
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -18985,8 +18310,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8110_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -19003,8 +18327,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8118_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -19021,8 +18344,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8120_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 14;
@@ -19038,8 +18360,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8128_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -19057,8 +18378,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8130_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}}return 18;
 }
@@ -19072,8 +18392,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8138_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -19088,8 +18407,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8139_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -19130,8 +18448,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8150_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -19148,8 +18465,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8158_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -19166,8 +18482,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8160_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 14;
@@ -19183,8 +18498,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8168_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -19202,8 +18516,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8170_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}}return 18;
 }
@@ -19217,8 +18530,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8178_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -19233,8 +18545,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8179_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -19277,8 +18588,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8190_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 20;
@@ -19295,8 +18605,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8198_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 20;
@@ -19313,8 +18622,7 @@ unsigned long REGPARAM2 CPUFUNC(op_81a0_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 22;
@@ -19330,8 +18638,7 @@ unsigned long REGPARAM2 CPUFUNC(op_81a8_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 24;
@@ -19349,8 +18656,7 @@ unsigned long REGPARAM2 CPUFUNC(op_81b0_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}}return 26;
 }
@@ -19364,8 +18670,7 @@ unsigned long REGPARAM2 CPUFUNC(op_81b8_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 24;
@@ -19380,8 +18685,7 @@ unsigned long REGPARAM2 CPUFUNC(op_81b9_0)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 28;
@@ -19403,8 +18707,7 @@ m68k_incpc(2);
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -19431,8 +18734,7 @@ m68k_incpc(2);
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -19460,8 +18762,7 @@ m68k_incpc(2);
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -19489,8 +18790,7 @@ m68k_incpc(2);
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -19517,8 +18817,7 @@ m68k_incpc(4);
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -19546,8 +18845,7 @@ unsigned long REGPARAM2 CPUFUNC(op_81f0_0)(uae_u32 opcode) /* DIVS */
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -19573,8 +18871,7 @@ m68k_incpc(4);
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -19600,8 +18897,7 @@ m68k_incpc(6);
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -19628,8 +18924,7 @@ m68k_incpc(4);
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -19657,8 +18952,7 @@ unsigned long REGPARAM2 CPUFUNC(op_81fb_0)(uae_u32 opcode) /* DIVS */
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -19683,8 +18977,7 @@ m68k_incpc(4);
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -19705,11 +18998,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9000_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}m68k_incpc(2);
 return 4;
@@ -19727,11 +19019,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9010_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(2);
 return 8;
@@ -19750,11 +19041,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9018_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(2);
 return 8;
@@ -19773,11 +19063,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9020_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(2);
 return 10;
@@ -19795,11 +19084,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9028_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(4);
 return 12;
@@ -19819,11 +19107,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9030_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}}return 14;
 }
@@ -19839,11 +19126,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9038_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(4);
 return 12;
@@ -19860,11 +19146,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9039_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(6);
 return 16;
@@ -19882,11 +19167,10 @@ unsigned long REGPARAM2 CPUFUNC(op_903a_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(4);
 return 12;
@@ -19906,11 +19190,10 @@ unsigned long REGPARAM2 CPUFUNC(op_903b_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}}return 14;
 }
@@ -19925,11 +19208,10 @@ unsigned long REGPARAM2 CPUFUNC(op_903c_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}m68k_incpc(4);
 return 8;
@@ -19946,11 +19228,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9040_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}m68k_incpc(2);
 return 4;
@@ -19967,11 +19248,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9048_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}m68k_incpc(2);
 return 4;
@@ -19989,11 +19269,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9050_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}m68k_incpc(2);
 return 8;
@@ -20012,11 +19291,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9058_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}m68k_incpc(2);
 return 8;
@@ -20035,11 +19313,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9060_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}m68k_incpc(2);
 return 10;
@@ -20057,11 +19334,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9068_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}m68k_incpc(4);
 return 12;
@@ -20081,11 +19357,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9070_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}return 14;
 }
@@ -20101,11 +19376,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9078_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}m68k_incpc(4);
 return 12;
@@ -20122,11 +19396,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9079_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}m68k_incpc(6);
 return 16;
@@ -20144,11 +19417,10 @@ unsigned long REGPARAM2 CPUFUNC(op_907a_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}m68k_incpc(4);
 return 12;
@@ -20168,11 +19440,10 @@ unsigned long REGPARAM2 CPUFUNC(op_907b_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}return 14;
 }
@@ -20187,11 +19458,10 @@ unsigned long REGPARAM2 CPUFUNC(op_907c_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}m68k_incpc(4);
 return 8;
@@ -20208,11 +19478,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9080_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}m68k_incpc(2);
 return 8;
@@ -20229,11 +19498,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9088_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}m68k_incpc(2);
 return 8;
@@ -20251,11 +19519,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9090_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}m68k_incpc(2);
 return 14;
@@ -20274,11 +19541,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9098_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}m68k_incpc(2);
 return 14;
@@ -20297,11 +19563,10 @@ unsigned long REGPARAM2 CPUFUNC(op_90a0_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}m68k_incpc(2);
 return 16;
@@ -20319,11 +19584,10 @@ unsigned long REGPARAM2 CPUFUNC(op_90a8_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}m68k_incpc(4);
 return 18;
@@ -20343,11 +19607,10 @@ unsigned long REGPARAM2 CPUFUNC(op_90b0_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}}return 20;
 }
@@ -20363,11 +19626,10 @@ unsigned long REGPARAM2 CPUFUNC(op_90b8_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}m68k_incpc(4);
 return 18;
@@ -20384,11 +19646,10 @@ unsigned long REGPARAM2 CPUFUNC(op_90b9_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}m68k_incpc(6);
 return 22;
@@ -20406,11 +19667,10 @@ unsigned long REGPARAM2 CPUFUNC(op_90ba_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}m68k_incpc(4);
 return 18;
@@ -20430,11 +19690,10 @@ unsigned long REGPARAM2 CPUFUNC(op_90bb_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}}return 20;
 }
@@ -20449,11 +19708,10 @@ unsigned long REGPARAM2 CPUFUNC(op_90bc_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}m68k_incpc(6);
 return 16;
@@ -20669,11 +19927,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9110_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(2);
 return 12;
@@ -20692,11 +19949,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9118_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(2);
 return 12;
@@ -20715,11 +19971,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9120_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(2);
 return 14;
@@ -20737,11 +19992,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9128_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 16;
@@ -20761,11 +20015,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9130_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}}return 18;
 }
@@ -20781,11 +20034,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9138_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 16;
@@ -20802,11 +20054,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9139_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(6);
 return 20;
@@ -20868,11 +20119,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9150_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(2);
 return 12;
@@ -20891,11 +20141,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9158_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(2);
 return 12;
@@ -20914,11 +20163,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9160_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(2);
 return 14;
@@ -20936,11 +20184,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9168_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 16;
@@ -20960,11 +20207,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9170_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}}return 18;
 }
@@ -20980,11 +20226,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9178_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 16;
@@ -21001,11 +20246,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9179_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(6);
 return 20;
@@ -21067,11 +20311,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9190_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(2);
 return 20;
@@ -21090,11 +20333,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9198_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(2);
 return 20;
@@ -21113,11 +20355,10 @@ unsigned long REGPARAM2 CPUFUNC(op_91a0_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(2);
 return 22;
@@ -21135,11 +20376,10 @@ unsigned long REGPARAM2 CPUFUNC(op_91a8_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 24;
@@ -21159,11 +20399,10 @@ unsigned long REGPARAM2 CPUFUNC(op_91b0_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}}return 26;
 }
@@ -21179,11 +20418,10 @@ unsigned long REGPARAM2 CPUFUNC(op_91b8_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 24;
@@ -21200,11 +20438,10 @@ unsigned long REGPARAM2 CPUFUNC(op_91b9_0)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(6);
 return 28;
@@ -21374,10 +20611,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b000_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}m68k_incpc(2);
 return 4;
 }
@@ -21393,10 +20629,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b010_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(2);
 return 8;
 }
@@ -21413,10 +20648,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b018_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(2);
 return 8;
 }
@@ -21433,10 +20667,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b020_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(2);
 return 10;
 }
@@ -21452,10 +20685,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b028_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(4);
 return 12;
 }
@@ -21473,10 +20705,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b030_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}return 14;
 }
 unsigned long REGPARAM2 CPUFUNC(op_b038_0)(uae_u32 opcode) /* CMP */
@@ -21490,10 +20721,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b038_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(4);
 return 12;
 }
@@ -21508,10 +20738,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b039_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(6);
 return 16;
 }
@@ -21527,10 +20756,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b03a_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(4);
 return 12;
 }
@@ -21548,10 +20776,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b03b_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}return 14;
 }
 #endif
@@ -21567,10 +20794,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b03c_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}m68k_incpc(4);
 return 8;
 }
@@ -21585,10 +20811,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b040_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}m68k_incpc(2);
 return 4;
 }
@@ -21603,10 +20828,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b048_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}m68k_incpc(2);
 return 4;
 }
@@ -21622,10 +20846,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b050_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(2);
 return 8;
 }
@@ -21642,10 +20865,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b058_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(2);
 return 8;
 }
@@ -21662,10 +20884,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b060_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(2);
 return 10;
 }
@@ -21681,10 +20902,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b068_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(4);
 return 12;
 }
@@ -21702,10 +20922,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b070_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}return 14;
 }
 unsigned long REGPARAM2 CPUFUNC(op_b078_0)(uae_u32 opcode) /* CMP */
@@ -21719,10 +20938,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b078_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(4);
 return 12;
 }
@@ -21737,10 +20955,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b079_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(6);
 return 16;
 }
@@ -21756,10 +20973,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b07a_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(4);
 return 12;
 }
@@ -21777,10 +20993,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b07b_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}return 14;
 }
 unsigned long REGPARAM2 CPUFUNC(op_b07c_0)(uae_u32 opcode) /* CMP */
@@ -21793,10 +21008,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b07c_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}m68k_incpc(4);
 return 8;
 }
@@ -21811,10 +21025,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b080_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}m68k_incpc(2);
 return 6;
 }
@@ -21829,10 +21042,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b088_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}m68k_incpc(2);
 return 6;
 }
@@ -21848,10 +21060,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b090_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(2);
 return 14;
 }
@@ -21868,10 +21079,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b098_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(2);
 return 14;
 }
@@ -21888,10 +21098,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0a0_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(2);
 return 16;
 }
@@ -21907,10 +21116,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0a8_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(4);
 return 18;
 }
@@ -21928,10 +21136,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0b0_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}return 20;
 }
 unsigned long REGPARAM2 CPUFUNC(op_b0b8_0)(uae_u32 opcode) /* CMP */
@@ -21945,10 +21152,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0b8_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(4);
 return 18;
 }
@@ -21963,10 +21169,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0b9_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(6);
 return 22;
 }
@@ -21982,10 +21187,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0ba_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(4);
 return 18;
 }
@@ -22003,10 +21207,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0bb_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}return 20;
 }
 unsigned long REGPARAM2 CPUFUNC(op_b0bc_0)(uae_u32 opcode) /* CMP */
@@ -22019,10 +21222,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0bc_0)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}m68k_incpc(6);
 return 14;
 }
@@ -22037,10 +21239,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0c0_0)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}m68k_incpc(2);
 return 6;
 }
@@ -22055,10 +21256,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0c8_0)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}m68k_incpc(2);
 return 6;
 }
@@ -22074,10 +21274,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0d0_0)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(2);
 return 10;
 }
@@ -22094,10 +21293,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0d8_0)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(2);
 return 10;
 }
@@ -22114,10 +21312,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0e0_0)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(2);
 return 12;
 }
@@ -22133,10 +21330,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0e8_0)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(4);
 return 14;
 }
@@ -22154,10 +21350,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0f0_0)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}return 16;
 }
 unsigned long REGPARAM2 CPUFUNC(op_b0f8_0)(uae_u32 opcode) /* CMPA */
@@ -22171,10 +21366,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0f8_0)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(4);
 return 14;
 }
@@ -22189,10 +21383,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0f9_0)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(6);
 return 18;
 }
@@ -22208,10 +21401,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0fa_0)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(4);
 return 14;
 }
@@ -22229,10 +21421,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0fb_0)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}return 16;
 }
 unsigned long REGPARAM2 CPUFUNC(op_b0fc_0)(uae_u32 opcode) /* CMPA */
@@ -22245,10 +21436,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0fc_0)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}m68k_incpc(4);
 return 10;
 }
@@ -22262,8 +21452,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b100_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(2);
 return 4;
@@ -22283,10 +21472,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b108_0)(uae_u32 opcode) /* CMPM */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(2);
 return 12;
 }
@@ -22301,8 +21489,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b110_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -22319,8 +21506,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b118_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -22337,8 +21523,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b120_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 14;
@@ -22354,8 +21539,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b128_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -22373,8 +21557,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b130_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}}return 18;
 }
@@ -22388,8 +21571,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b138_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -22404,8 +21586,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b139_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -22420,8 +21601,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b140_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 return 4;
@@ -22441,10 +21621,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b148_0)(uae_u32 opcode) /* CMPM */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(2);
 return 12;
 }
@@ -22459,8 +21638,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b150_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -22477,8 +21655,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b158_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -22495,8 +21672,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b160_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 14;
@@ -22512,8 +21688,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b168_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -22531,8 +21706,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b170_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}}return 18;
 }
@@ -22546,8 +21720,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b178_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -22562,8 +21735,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b179_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -22578,8 +21750,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b180_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 return 8;
@@ -22599,10 +21770,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b188_0)(uae_u32 opcode) /* CMPM */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(2);
 return 20;
 }
@@ -22617,8 +21787,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b190_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 20;
@@ -22635,8 +21804,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b198_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 20;
@@ -22653,8 +21821,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b1a0_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 22;
@@ -22670,8 +21837,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b1a8_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 24;
@@ -22689,8 +21855,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b1b0_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}}return 26;
 }
@@ -22704,8 +21869,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b1b8_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 24;
@@ -22720,8 +21884,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b1b9_0)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 28;
@@ -22737,10 +21900,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b1c0_0)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}m68k_incpc(2);
 return 6;
 }
@@ -22755,10 +21917,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b1c8_0)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}m68k_incpc(2);
 return 6;
 }
@@ -22774,10 +21935,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b1d0_0)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(2);
 return 14;
 }
@@ -22794,10 +21954,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b1d8_0)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(2);
 return 14;
 }
@@ -22814,10 +21973,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b1e0_0)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(2);
 return 16;
 }
@@ -22833,10 +21991,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b1e8_0)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(4);
 return 18;
 }
@@ -22854,10 +22011,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b1f0_0)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}return 20;
 }
 unsigned long REGPARAM2 CPUFUNC(op_b1f8_0)(uae_u32 opcode) /* CMPA */
@@ -22871,10 +22027,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b1f8_0)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(4);
 return 18;
 }
@@ -22889,10 +22044,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b1f9_0)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(6);
 return 22;
 }
@@ -22908,10 +22062,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b1fa_0)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(4);
 return 18;
 }
@@ -22929,10 +22082,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b1fb_0)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}return 20;
 }
 unsigned long REGPARAM2 CPUFUNC(op_b1fc_0)(uae_u32 opcode) /* CMPA */
@@ -22945,10 +22097,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b1fc_0)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}m68k_incpc(6);
 return 14;
 }
@@ -22962,8 +22113,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c000_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(2);
 return 4;
@@ -22979,8 +22129,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c010_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 return 8;
@@ -22997,8 +22146,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c018_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 return 8;
@@ -23015,8 +22163,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c020_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 return 10;
@@ -23032,8 +22179,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c028_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 12;
@@ -23051,8 +22197,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c030_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}return 14;
 }
@@ -23066,8 +22211,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c038_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 12;
@@ -23082,8 +22226,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c039_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(6);
 return 16;
@@ -23099,8 +22242,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c03a_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 12;
@@ -23118,8 +22260,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c03b_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}}return 14;
 }
@@ -23132,8 +22273,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c03c_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 return 8;
@@ -23148,8 +22288,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c040_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 return 4;
@@ -23165,8 +22304,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c050_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 return 8;
@@ -23183,8 +22321,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c058_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 return 8;
@@ -23201,8 +22338,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c060_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 return 10;
@@ -23218,8 +22354,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c068_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 12;
@@ -23237,8 +22372,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c070_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}return 14;
 }
@@ -23252,8 +22386,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c078_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 12;
@@ -23268,8 +22401,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c079_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(6);
 return 16;
@@ -23285,8 +22417,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c07a_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 12;
@@ -23304,8 +22435,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c07b_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}return 14;
 }
@@ -23318,8 +22448,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c07c_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 return 8;
@@ -23334,8 +22463,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c080_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 return 8;
@@ -23351,8 +22479,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c090_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 return 14;
@@ -23369,8 +22496,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c098_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 return 14;
@@ -23387,8 +22513,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0a0_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 return 16;
@@ -23404,8 +22529,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0a8_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 18;
@@ -23423,8 +22547,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0b0_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}return 20;
 }
@@ -23438,8 +22561,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0b8_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 18;
@@ -23454,8 +22576,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0b9_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(6);
 return 22;
@@ -23471,8 +22592,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0ba_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 18;
@@ -23490,8 +22610,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0bb_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}return 20;
 }
@@ -23504,8 +22623,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0bc_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 return 16;
@@ -23520,8 +22638,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0c0_0)(uae_u32 opcode) /* MULU */
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
 }}}}m68k_incpc(2);
@@ -23538,8 +22655,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0d0_0)(uae_u32 opcode) /* MULU */
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
 }}}}}m68k_incpc(2);
@@ -23557,8 +22673,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0d8_0)(uae_u32 opcode) /* MULU */
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
 }}}}}m68k_incpc(2);
@@ -23576,8 +22691,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0e0_0)(uae_u32 opcode) /* MULU */
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
 }}}}}m68k_incpc(2);
@@ -23594,8 +22708,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0e8_0)(uae_u32 opcode) /* MULU */
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
 }}}}}m68k_incpc(4);
@@ -23614,8 +22727,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0f0_0)(uae_u32 opcode) /* MULU */
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
 }}}}}} return (48+retcycles*2);
@@ -23630,8 +22742,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0f8_0)(uae_u32 opcode) /* MULU */
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
 }}}}}m68k_incpc(4);
@@ -23647,8 +22758,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0f9_0)(uae_u32 opcode) /* MULU */
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
 }}}}}m68k_incpc(6);
@@ -23665,8 +22775,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0fa_0)(uae_u32 opcode) /* MULU */
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
 }}}}}m68k_incpc(4);
@@ -23685,8 +22794,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0fb_0)(uae_u32 opcode) /* MULU */
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
 }}}}}} return (48+retcycles*2);
@@ -23700,8 +22808,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0fc_0)(uae_u32 opcode) /* MULU */
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
 }}}}m68k_incpc(4);
@@ -23768,8 +22875,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c110_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -23786,8 +22892,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c118_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -23804,8 +22909,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c120_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 14;
@@ -23821,8 +22925,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c128_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -23840,8 +22943,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c130_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}}return 18;
 }
@@ -23855,8 +22957,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c138_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -23871,8 +22972,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c139_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -23912,8 +23012,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c150_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -23930,8 +23029,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c158_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 12;
@@ -23948,8 +23046,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c160_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 14;
@@ -23965,8 +23062,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c168_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -23984,8 +23080,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c170_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}}return 18;
 }
@@ -23999,8 +23094,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c178_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 16;
@@ -24015,8 +23109,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c179_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 20;
@@ -24044,8 +23137,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c190_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 20;
@@ -24062,8 +23154,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c198_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 20;
@@ -24080,8 +23171,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1a0_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 22;
@@ -24097,8 +23187,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1a8_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 24;
@@ -24116,8 +23205,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1b0_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}}return 26;
 }
@@ -24131,8 +23219,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1b8_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 24;
@@ -24147,8 +23234,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1b9_0)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 28;
@@ -24164,8 +23250,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1c0_0)(uae_u32 opcode) /* MULS */
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
 	uae_u32 src2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -24184,8 +23269,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1d0_0)(uae_u32 opcode) /* MULS */
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
 	uae_u32 src2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -24205,8 +23289,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1d8_0)(uae_u32 opcode) /* MULS */
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
 	uae_u32 src2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -24226,8 +23309,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1e0_0)(uae_u32 opcode) /* MULS */
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
 	uae_u32 src2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -24246,8 +23328,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1e8_0)(uae_u32 opcode) /* MULS */
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
 	uae_u32 src2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -24268,8 +23349,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1f0_0)(uae_u32 opcode) /* MULS */
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
 	uae_u32 src2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -24286,8 +23366,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1f8_0)(uae_u32 opcode) /* MULS */
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
 	uae_u32 src2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -24305,8 +23384,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1f9_0)(uae_u32 opcode) /* MULS */
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
 	uae_u32 src2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -24325,8 +23403,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1fa_0)(uae_u32 opcode) /* MULS */
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
 	uae_u32 src2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -24347,8 +23424,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1fb_0)(uae_u32 opcode) /* MULS */
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
 	uae_u32 src2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -24364,8 +23440,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1fc_0)(uae_u32 opcode) /* MULS */
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
 	uae_u32 src2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -24384,11 +23459,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d000_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}m68k_incpc(2);
 return 4;
@@ -24406,11 +23480,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d010_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(2);
 return 8;
@@ -24429,11 +23502,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d018_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(2);
 return 8;
@@ -24452,11 +23524,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d020_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(2);
 return 10;
@@ -24474,11 +23545,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d028_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(4);
 return 12;
@@ -24498,11 +23568,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d030_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}}return 14;
 }
@@ -24518,11 +23587,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d038_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(4);
 return 12;
@@ -24539,11 +23607,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d039_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(6);
 return 16;
@@ -24561,11 +23628,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d03a_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(4);
 return 12;
@@ -24585,11 +23651,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d03b_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}}return 14;
 }
@@ -24604,11 +23669,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d03c_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}m68k_incpc(4);
 return 8;
@@ -24625,11 +23689,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d040_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}m68k_incpc(2);
 return 4;
@@ -24646,11 +23709,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d048_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}m68k_incpc(2);
 return 4;
@@ -24668,11 +23730,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d050_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}m68k_incpc(2);
 return 8;
@@ -24691,11 +23752,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d058_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}m68k_incpc(2);
 return 8;
@@ -24714,11 +23774,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d060_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}m68k_incpc(2);
 return 10;
@@ -24736,11 +23795,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d068_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}m68k_incpc(4);
 return 12;
@@ -24760,11 +23818,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d070_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}return 14;
 }
@@ -24780,11 +23837,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d078_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}m68k_incpc(4);
 return 12;
@@ -24801,11 +23857,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d079_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}m68k_incpc(6);
 return 16;
@@ -24823,11 +23878,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d07a_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}m68k_incpc(4);
 return 12;
@@ -24847,11 +23901,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d07b_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}return 14;
 }
@@ -24866,11 +23919,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d07c_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}m68k_incpc(4);
 return 8;
@@ -24887,11 +23939,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d080_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}m68k_incpc(2);
 return 8;
@@ -24908,11 +23959,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d088_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}m68k_incpc(2);
 return 8;
@@ -24930,11 +23980,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d090_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}m68k_incpc(2);
 return 14;
@@ -24953,11 +24002,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d098_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}m68k_incpc(2);
 return 14;
@@ -24976,11 +24024,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d0a0_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}m68k_incpc(2);
 return 16;
@@ -24998,11 +24045,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d0a8_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}m68k_incpc(4);
 return 18;
@@ -25022,11 +24068,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d0b0_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}}return 20;
 }
@@ -25042,11 +24087,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d0b8_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}m68k_incpc(4);
 return 18;
@@ -25063,11 +24107,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d0b9_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}m68k_incpc(6);
 return 22;
@@ -25085,11 +24128,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d0ba_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}m68k_incpc(4);
 return 18;
@@ -25109,11 +24151,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d0bb_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}}return 20;
 }
@@ -25128,11 +24169,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d0bc_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}m68k_incpc(6);
 return 16;
@@ -25348,11 +24388,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d110_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(2);
 return 12;
@@ -25371,11 +24410,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d118_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(2);
 return 12;
@@ -25394,11 +24432,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d120_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(2);
 return 14;
@@ -25416,11 +24453,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d128_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 16;
@@ -25440,11 +24476,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d130_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}}return 18;
 }
@@ -25460,11 +24495,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d138_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 16;
@@ -25481,11 +24515,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d139_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(6);
 return 20;
@@ -25547,11 +24580,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d150_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(2);
 return 12;
@@ -25570,11 +24602,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d158_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(2);
 return 12;
@@ -25593,11 +24624,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d160_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(2);
 return 14;
@@ -25615,11 +24645,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d168_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 16;
@@ -25639,11 +24668,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d170_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}}return 18;
 }
@@ -25659,11 +24687,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d178_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 16;
@@ -25680,11 +24707,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d179_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(6);
 return 20;
@@ -25746,11 +24772,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d190_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(2);
 return 20;
@@ -25769,11 +24794,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d198_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(2);
 return 20;
@@ -25792,11 +24816,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d1a0_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(2);
 return 22;
@@ -25814,11 +24837,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d1a8_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 24;
@@ -25838,11 +24860,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d1b0_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}}return 26;
 }
@@ -25858,11 +24879,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d1b8_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 24;
@@ -25879,11 +24899,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d1b9_0)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(6);
 return 28;
@@ -26070,8 +25089,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e000_0)(uae_u32 opcode) /* ASR */
 		val |= (0xff << (8 - cnt)) & (uae_u32)-sign;
 		val &= 0xff;
 	}
-	SET_ZFLG (((uae_s8)(val)) == 0);
-	SET_NFLG (((uae_s8)(val)) < 0);
+	SET_NZFLG (((uae_s8)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
@@ -26098,8 +25116,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e008_0)(uae_u32 opcode) /* LSR */
 	COPY_CARRY;
 		val >>= 1;
 	}
-	SET_ZFLG (((uae_s8)(val)) == 0);
-	SET_NFLG (((uae_s8)(val)) < 0);
+	SET_NZFLG (((uae_s8)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
@@ -26129,8 +25146,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e010_0)(uae_u32 opcode) /* ROXR */
 	val &= 0xff;
 	} }
 	SET_CFLG (GET_XFLG);
-	SET_ZFLG (((uae_s8)(val)) == 0);
-	SET_NFLG (((uae_s8)(val)) < 0);
+	SET_NZFLG (((uae_s8)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
@@ -26155,8 +25171,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e018_0)(uae_u32 opcode) /* ROR */
 	val &= 0xff;
 	SET_CFLG ((val & 0x80) >> 7);
 	}
-	SET_ZFLG (((uae_s8)(val)) == 0);
-	SET_NFLG (((uae_s8)(val)) < 0);
+	SET_NZFLG (((uae_s8)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
@@ -26186,8 +25201,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e020_0)(uae_u32 opcode) /* ASR */
 		val |= (0xff << (8 - cnt)) & (uae_u32)-sign;
 		val &= 0xff;
 	}
-	SET_ZFLG (((uae_s8)(val)) == 0);
-	SET_NFLG (((uae_s8)(val)) < 0);
+	SET_NZFLG (((uae_s8)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
@@ -26214,8 +25228,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e028_0)(uae_u32 opcode) /* LSR */
 	COPY_CARRY;
 		val >>= 1;
 	}
-	SET_ZFLG (((uae_s8)(val)) == 0);
-	SET_NFLG (((uae_s8)(val)) < 0);
+	SET_NZFLG (((uae_s8)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
@@ -26249,8 +25262,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e030_0)(uae_u32 opcode) /* ROXR */
 	val &= 0xff;
 	} }
 	SET_CFLG (GET_XFLG);
-	SET_ZFLG (((uae_s8)(val)) == 0);
-	SET_NFLG (((uae_s8)(val)) < 0);
+	SET_NZFLG (((uae_s8)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
@@ -26275,8 +25287,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e038_0)(uae_u32 opcode) /* ROR */
 	val &= 0xff;
 	SET_CFLG ((val & 0x80) >> 7);
 	}
-	SET_ZFLG (((uae_s8)(val)) == 0);
-	SET_NFLG (((uae_s8)(val)) < 0);
+	SET_NZFLG (((uae_s8)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
@@ -26306,8 +25317,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e040_0)(uae_u32 opcode) /* ASR */
 		val |= (0xffff << (16 - cnt)) & (uae_u32)-sign;
 		val &= 0xffff;
 	}
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
@@ -26334,8 +25344,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e048_0)(uae_u32 opcode) /* LSR */
 	COPY_CARRY;
 		val >>= 1;
 	}
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
@@ -26365,8 +25374,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e050_0)(uae_u32 opcode) /* ROXR */
 	val &= 0xffff;
 	} }
 	SET_CFLG (GET_XFLG);
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
@@ -26391,8 +25399,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e058_0)(uae_u32 opcode) /* ROR */
 	val &= 0xffff;
 	SET_CFLG ((val & 0x8000) >> 15);
 	}
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
@@ -26422,8 +25429,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e060_0)(uae_u32 opcode) /* ASR */
 		val |= (0xffff << (16 - cnt)) & (uae_u32)-sign;
 		val &= 0xffff;
 	}
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
@@ -26450,8 +25456,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e068_0)(uae_u32 opcode) /* LSR */
 	COPY_CARRY;
 		val >>= 1;
 	}
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
@@ -26484,8 +25489,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e070_0)(uae_u32 opcode) /* ROXR */
 	val &= 0xffff;
 	} }
 	SET_CFLG (GET_XFLG);
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
@@ -26510,8 +25514,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e078_0)(uae_u32 opcode) /* ROR */
 	val &= 0xffff;
 	SET_CFLG ((val & 0x8000) >> 15);
 	}
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
@@ -26541,8 +25544,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e080_0)(uae_u32 opcode) /* ASR */
 		val |= (0xffffffff << (32 - cnt)) & (uae_u32)-sign;
 		val &= 0xffffffff;
 	}
-	SET_ZFLG (((uae_s32)(val)) == 0);
-	SET_NFLG (((uae_s32)(val)) < 0);
+	SET_NZFLG (((uae_s32)(val)));
 	m68k_dreg(regs, dstreg) = (val);
 }}}}m68k_incpc(2);
  return (8+retcycles*2);
@@ -26569,8 +25571,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e088_0)(uae_u32 opcode) /* LSR */
 	COPY_CARRY;
 		val >>= 1;
 	}
-	SET_ZFLG (((uae_s32)(val)) == 0);
-	SET_NFLG (((uae_s32)(val)) < 0);
+	SET_NZFLG (((uae_s32)(val)));
 	m68k_dreg(regs, dstreg) = (val);
 }}}}m68k_incpc(2);
  return (8+retcycles*2);
@@ -26600,8 +25601,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e090_0)(uae_u32 opcode) /* ROXR */
 	val &= 0xffffffff;
 	} }
 	SET_CFLG (GET_XFLG);
-	SET_ZFLG (((uae_s32)(val)) == 0);
-	SET_NFLG (((uae_s32)(val)) < 0);
+	SET_NZFLG (((uae_s32)(val)));
 	m68k_dreg(regs, dstreg) = (val);
 }}}}m68k_incpc(2);
  return (8+retcycles*2);
@@ -26626,8 +25626,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e098_0)(uae_u32 opcode) /* ROR */
 	val &= 0xffffffff;
 	SET_CFLG ((val & 0x80000000) >> 31);
 	}
-	SET_ZFLG (((uae_s32)(val)) == 0);
-	SET_NFLG (((uae_s32)(val)) < 0);
+	SET_NZFLG (((uae_s32)(val)));
 	m68k_dreg(regs, dstreg) = (val);
 }}}}m68k_incpc(2);
  return (8+retcycles*2);
@@ -26657,8 +25656,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e0a0_0)(uae_u32 opcode) /* ASR */
 		val |= (0xffffffff << (32 - cnt)) & (uae_u32)-sign;
 		val &= 0xffffffff;
 	}
-	SET_ZFLG (((uae_s32)(val)) == 0);
-	SET_NFLG (((uae_s32)(val)) < 0);
+	SET_NZFLG (((uae_s32)(val)));
 	m68k_dreg(regs, dstreg) = (val);
 }}}}m68k_incpc(2);
  return (8+retcycles*2);
@@ -26685,8 +25683,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e0a8_0)(uae_u32 opcode) /* LSR */
 	COPY_CARRY;
 		val >>= 1;
 	}
-	SET_ZFLG (((uae_s32)(val)) == 0);
-	SET_NFLG (((uae_s32)(val)) < 0);
+	SET_NZFLG (((uae_s32)(val)));
 	m68k_dreg(regs, dstreg) = (val);
 }}}}m68k_incpc(2);
  return (8+retcycles*2);
@@ -26718,8 +25715,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e0b0_0)(uae_u32 opcode) /* ROXR */
 	val &= 0xffffffff;
 	} }
 	SET_CFLG (GET_XFLG);
-	SET_ZFLG (((uae_s32)(val)) == 0);
-	SET_NFLG (((uae_s32)(val)) < 0);
+	SET_NZFLG (((uae_s32)(val)));
 	m68k_dreg(regs, dstreg) = (val);
 }}}}m68k_incpc(2);
  return (8+retcycles*2);
@@ -26744,8 +25740,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e0b8_0)(uae_u32 opcode) /* ROR */
 	val &= 0xffffffff;
 	SET_CFLG ((val & 0x80000000) >> 31);
 	}
-	SET_ZFLG (((uae_s32)(val)) == 0);
-	SET_NFLG (((uae_s32)(val)) < 0);
+	SET_NZFLG (((uae_s32)(val)));
 	m68k_dreg(regs, dstreg) = (val);
 }}}}m68k_incpc(2);
  return (8+retcycles*2);
@@ -26761,8 +25756,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e0d0_0)(uae_u32 opcode) /* ASRW */
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -26781,8 +25775,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e0d8_0)(uae_u32 opcode) /* ASRW */
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -26801,8 +25794,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e0e0_0)(uae_u32 opcode) /* ASRW */
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -26820,8 +25812,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e0e8_0)(uae_u32 opcode) /* ASRW */
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -26841,8 +25832,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e0f0_0)(uae_u32 opcode) /* ASRW */
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -26858,8 +25848,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e0f8_0)(uae_u32 opcode) /* ASRW */
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -26876,8 +25865,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e0f9_0)(uae_u32 opcode) /* ASRW */
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -26910,8 +25898,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e100_0)(uae_u32 opcode) /* ASL */
 		val <<= 1;
 		val &= 0xff;
 	}
-	SET_ZFLG (((uae_s8)(val)) == 0);
-	SET_NFLG (((uae_s8)(val)) < 0);
+	SET_NZFLG (((uae_s8)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
@@ -26939,8 +25926,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e108_0)(uae_u32 opcode) /* LSL */
 		val <<= 1;
 	val &= 0xff;
 	}
-	SET_ZFLG (((uae_s8)(val)) == 0);
-	SET_NFLG (((uae_s8)(val)) < 0);
+	SET_NZFLG (((uae_s8)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
@@ -26967,8 +25953,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e110_0)(uae_u32 opcode) /* ROXL */
 	val &= 0xff;
 	} }
 	SET_CFLG (GET_XFLG);
-	SET_ZFLG (((uae_s8)(val)) == 0);
-	SET_NFLG (((uae_s8)(val)) < 0);
+	SET_NZFLG (((uae_s8)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
@@ -26993,8 +25978,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e118_0)(uae_u32 opcode) /* ROL */
 	val &= 0xff;
 	SET_CFLG (val & 1);
 }
-	SET_ZFLG (((uae_s8)(val)) == 0);
-	SET_NFLG (((uae_s8)(val)) < 0);
+	SET_NZFLG (((uae_s8)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
@@ -27025,8 +26009,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e120_0)(uae_u32 opcode) /* ASL */
 		val <<= 1;
 		val &= 0xff;
 	}
-	SET_ZFLG (((uae_s8)(val)) == 0);
-	SET_NFLG (((uae_s8)(val)) < 0);
+	SET_NZFLG (((uae_s8)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
@@ -27054,8 +26037,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e128_0)(uae_u32 opcode) /* LSL */
 		val <<= 1;
 	val &= 0xff;
 	}
-	SET_ZFLG (((uae_s8)(val)) == 0);
-	SET_NFLG (((uae_s8)(val)) < 0);
+	SET_NZFLG (((uae_s8)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
@@ -27086,8 +26068,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e130_0)(uae_u32 opcode) /* ROXL */
 	val &= 0xff;
 	} }
 	SET_CFLG (GET_XFLG);
-	SET_ZFLG (((uae_s8)(val)) == 0);
-	SET_NFLG (((uae_s8)(val)) < 0);
+	SET_NZFLG (((uae_s8)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
@@ -27113,8 +26094,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e138_0)(uae_u32 opcode) /* ROL */
 	val &= 0xff;
 	SET_CFLG (val & 1);
 }
-	SET_ZFLG (((uae_s8)(val)) == 0);
-	SET_NFLG (((uae_s8)(val)) < 0);
+	SET_NZFLG (((uae_s8)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
@@ -27145,8 +26125,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e140_0)(uae_u32 opcode) /* ASL */
 		val <<= 1;
 		val &= 0xffff;
 	}
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
@@ -27174,8 +26153,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e148_0)(uae_u32 opcode) /* LSL */
 		val <<= 1;
 	val &= 0xffff;
 	}
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
@@ -27202,8 +26180,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e150_0)(uae_u32 opcode) /* ROXL */
 	val &= 0xffff;
 	} }
 	SET_CFLG (GET_XFLG);
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
@@ -27228,8 +26205,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e158_0)(uae_u32 opcode) /* ROL */
 	val &= 0xffff;
 	SET_CFLG (val & 1);
 }
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
@@ -27260,8 +26236,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e160_0)(uae_u32 opcode) /* ASL */
 		val <<= 1;
 		val &= 0xffff;
 	}
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
@@ -27289,8 +26264,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e168_0)(uae_u32 opcode) /* LSL */
 		val <<= 1;
 	val &= 0xffff;
 	}
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
@@ -27320,8 +26294,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e170_0)(uae_u32 opcode) /* ROXL */
 	val &= 0xffff;
 	} }
 	SET_CFLG (GET_XFLG);
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
@@ -27347,8 +26320,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e178_0)(uae_u32 opcode) /* ROL */
 	val &= 0xffff;
 	SET_CFLG (val & 1);
 }
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
 }}}}m68k_incpc(2);
  return (6+retcycles*2);
@@ -27379,8 +26351,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e180_0)(uae_u32 opcode) /* ASL */
 		val <<= 1;
 		val &= 0xffffffff;
 	}
-	SET_ZFLG (((uae_s32)(val)) == 0);
-	SET_NFLG (((uae_s32)(val)) < 0);
+	SET_NZFLG (((uae_s32)(val)));
 	m68k_dreg(regs, dstreg) = (val);
 }}}}m68k_incpc(2);
  return (8+retcycles*2);
@@ -27408,8 +26379,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e188_0)(uae_u32 opcode) /* LSL */
 		val <<= 1;
 	val &= 0xffffffff;
 	}
-	SET_ZFLG (((uae_s32)(val)) == 0);
-	SET_NFLG (((uae_s32)(val)) < 0);
+	SET_NZFLG (((uae_s32)(val)));
 	m68k_dreg(regs, dstreg) = (val);
 }}}}m68k_incpc(2);
  return (8+retcycles*2);
@@ -27436,8 +26406,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e190_0)(uae_u32 opcode) /* ROXL */
 	val &= 0xffffffff;
 	} }
 	SET_CFLG (GET_XFLG);
-	SET_ZFLG (((uae_s32)(val)) == 0);
-	SET_NFLG (((uae_s32)(val)) < 0);
+	SET_NZFLG (((uae_s32)(val)));
 	m68k_dreg(regs, dstreg) = (val);
 }}}}m68k_incpc(2);
  return (8+retcycles*2);
@@ -27462,8 +26431,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e198_0)(uae_u32 opcode) /* ROL */
 	val &= 0xffffffff;
 	SET_CFLG (val & 1);
 }
-	SET_ZFLG (((uae_s32)(val)) == 0);
-	SET_NFLG (((uae_s32)(val)) < 0);
+	SET_NZFLG (((uae_s32)(val)));
 	m68k_dreg(regs, dstreg) = (val);
 }}}}m68k_incpc(2);
  return (8+retcycles*2);
@@ -27494,8 +26462,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e1a0_0)(uae_u32 opcode) /* ASL */
 		val <<= 1;
 		val &= 0xffffffff;
 	}
-	SET_ZFLG (((uae_s32)(val)) == 0);
-	SET_NFLG (((uae_s32)(val)) < 0);
+	SET_NZFLG (((uae_s32)(val)));
 	m68k_dreg(regs, dstreg) = (val);
 }}}}m68k_incpc(2);
  return (8+retcycles*2);
@@ -27523,8 +26490,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e1a8_0)(uae_u32 opcode) /* LSL */
 		val <<= 1;
 	val &= 0xffffffff;
 	}
-	SET_ZFLG (((uae_s32)(val)) == 0);
-	SET_NFLG (((uae_s32)(val)) < 0);
+	SET_NZFLG (((uae_s32)(val)));
 	m68k_dreg(regs, dstreg) = (val);
 }}}}m68k_incpc(2);
  return (8+retcycles*2);
@@ -27553,8 +26519,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e1b0_0)(uae_u32 opcode) /* ROXL */
 	val &= 0xffffffff;
 	} }
 	SET_CFLG (GET_XFLG);
-	SET_ZFLG (((uae_s32)(val)) == 0);
-	SET_NFLG (((uae_s32)(val)) < 0);
+	SET_NZFLG (((uae_s32)(val)));
 	m68k_dreg(regs, dstreg) = (val);
 }}}}m68k_incpc(2);
  return (8+retcycles*2);
@@ -27580,8 +26545,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e1b8_0)(uae_u32 opcode) /* ROL */
 	val &= 0xffffffff;
 	SET_CFLG (val & 1);
 }
-	SET_ZFLG (((uae_s32)(val)) == 0);
-	SET_NFLG (((uae_s32)(val)) < 0);
+	SET_NZFLG (((uae_s32)(val)));
 	m68k_dreg(regs, dstreg) = (val);
 }}}}m68k_incpc(2);
  return (8+retcycles*2);
@@ -27597,8 +26561,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e1d0_0)(uae_u32 opcode) /* ASLW */
 	uae_u32 sign2;
 	val <<= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -27619,8 +26582,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e1d8_0)(uae_u32 opcode) /* ASLW */
 	uae_u32 sign2;
 	val <<= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -27641,8 +26603,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e1e0_0)(uae_u32 opcode) /* ASLW */
 	uae_u32 sign2;
 	val <<= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -27662,8 +26623,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e1e8_0)(uae_u32 opcode) /* ASLW */
 	uae_u32 sign2;
 	val <<= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -27685,8 +26645,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e1f0_0)(uae_u32 opcode) /* ASLW */
 	uae_u32 sign2;
 	val <<= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -27704,8 +26663,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e1f8_0)(uae_u32 opcode) /* ASLW */
 	uae_u32 sign2;
 	val <<= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -27724,8 +26682,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e1f9_0)(uae_u32 opcode) /* ASLW */
 	uae_u32 sign2;
 	val <<= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -27744,8 +26701,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e2d0_0)(uae_u32 opcode) /* LSRW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -27763,8 +26719,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e2d8_0)(uae_u32 opcode) /* LSRW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -27782,8 +26737,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e2e0_0)(uae_u32 opcode) /* LSRW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -27800,8 +26754,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e2e8_0)(uae_u32 opcode) /* LSRW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -27820,8 +26773,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e2f0_0)(uae_u32 opcode) /* LSRW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -27836,8 +26788,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e2f8_0)(uae_u32 opcode) /* LSRW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -27853,8 +26804,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e2f9_0)(uae_u32 opcode) /* LSRW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -27871,8 +26821,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e3d0_0)(uae_u32 opcode) /* LSLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -27890,8 +26839,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e3d8_0)(uae_u32 opcode) /* LSLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -27909,8 +26857,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e3e0_0)(uae_u32 opcode) /* LSLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -27927,8 +26874,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e3e8_0)(uae_u32 opcode) /* LSLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -27947,8 +26893,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e3f0_0)(uae_u32 opcode) /* LSLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -27963,8 +26908,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e3f8_0)(uae_u32 opcode) /* LSLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -27980,8 +26924,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e3f9_0)(uae_u32 opcode) /* LSLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -27999,8 +26942,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e4d0_0)(uae_u32 opcode) /* ROXRW */
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -28019,8 +26961,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e4d8_0)(uae_u32 opcode) /* ROXRW */
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -28039,8 +26980,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e4e0_0)(uae_u32 opcode) /* ROXRW */
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -28058,8 +26998,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e4e8_0)(uae_u32 opcode) /* ROXRW */
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -28079,8 +27018,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e4f0_0)(uae_u32 opcode) /* ROXRW */
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -28096,8 +27034,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e4f8_0)(uae_u32 opcode) /* ROXRW */
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -28114,8 +27051,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e4f9_0)(uae_u32 opcode) /* ROXRW */
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -28133,8 +27069,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e5d0_0)(uae_u32 opcode) /* ROXLW */
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -28153,8 +27088,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e5d8_0)(uae_u32 opcode) /* ROXLW */
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -28173,8 +27107,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e5e0_0)(uae_u32 opcode) /* ROXLW */
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -28192,8 +27125,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e5e8_0)(uae_u32 opcode) /* ROXLW */
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -28213,8 +27145,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e5f0_0)(uae_u32 opcode) /* ROXLW */
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -28230,8 +27161,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e5f8_0)(uae_u32 opcode) /* ROXLW */
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -28248,8 +27178,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e5f9_0)(uae_u32 opcode) /* ROXLW */
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -28267,8 +27196,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e6d0_0)(uae_u32 opcode) /* RORW */
 	val >>= 1;
 	if (carry) val |= 0x8000;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(2);
@@ -28286,8 +27214,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e6d8_0)(uae_u32 opcode) /* RORW */
 	val >>= 1;
 	if (carry) val |= 0x8000;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(2);
@@ -28305,8 +27232,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e6e0_0)(uae_u32 opcode) /* RORW */
 	val >>= 1;
 	if (carry) val |= 0x8000;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(2);
@@ -28323,8 +27249,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e6e8_0)(uae_u32 opcode) /* RORW */
 	val >>= 1;
 	if (carry) val |= 0x8000;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(4);
@@ -28343,8 +27268,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e6f0_0)(uae_u32 opcode) /* RORW */
 	val >>= 1;
 	if (carry) val |= 0x8000;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}}return 18;
@@ -28359,8 +27283,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e6f8_0)(uae_u32 opcode) /* RORW */
 	val >>= 1;
 	if (carry) val |= 0x8000;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(4);
@@ -28376,8 +27299,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e6f9_0)(uae_u32 opcode) /* RORW */
 	val >>= 1;
 	if (carry) val |= 0x8000;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(6);
@@ -28394,8 +27316,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e7d0_0)(uae_u32 opcode) /* ROLW */
 	val <<= 1;
 	if (carry)  val |= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(2);
@@ -28413,8 +27334,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e7d8_0)(uae_u32 opcode) /* ROLW */
 	val <<= 1;
 	if (carry)  val |= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(2);
@@ -28432,8 +27352,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e7e0_0)(uae_u32 opcode) /* ROLW */
 	val <<= 1;
 	if (carry)  val |= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(2);
@@ -28450,8 +27369,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e7e8_0)(uae_u32 opcode) /* ROLW */
 	val <<= 1;
 	if (carry)  val |= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(4);
@@ -28470,8 +27388,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e7f0_0)(uae_u32 opcode) /* ROLW */
 	val <<= 1;
 	if (carry)  val |= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}}return 18;
@@ -28486,8 +27403,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e7f8_0)(uae_u32 opcode) /* ROLW */
 	val <<= 1;
 	if (carry)  val |= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(4);
@@ -28503,8 +27419,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e7f9_0)(uae_u32 opcode) /* ROLW */
 	val <<= 1;
 	if (carry)  val |= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(6);
@@ -30558,8 +29473,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30_3)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -30575,8 +29489,7 @@ unsigned long REGPARAM2 CPUFUNC(op_70_3)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -30592,8 +29505,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b0_3)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 34;
@@ -30737,8 +29649,7 @@ unsigned long REGPARAM2 CPUFUNC(op_230_3)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -30754,8 +29665,7 @@ unsigned long REGPARAM2 CPUFUNC(op_270_3)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -30771,8 +29681,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2b0_3)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 34;
@@ -30790,11 +29699,10 @@ unsigned long REGPARAM2 CPUFUNC(op_430_3)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(6);
 return 22;
@@ -30812,11 +29720,10 @@ unsigned long REGPARAM2 CPUFUNC(op_470_3)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(6);
 return 22;
@@ -30834,11 +29741,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4b0_3)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(8);
 return 34;
@@ -30856,11 +29762,10 @@ unsigned long REGPARAM2 CPUFUNC(op_630_3)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(6);
 return 22;
@@ -30878,11 +29783,10 @@ unsigned long REGPARAM2 CPUFUNC(op_670_3)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(6);
 return 22;
@@ -30900,11 +29804,10 @@ unsigned long REGPARAM2 CPUFUNC(op_6b0_3)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(8);
 return 34;
@@ -31040,8 +29943,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a30_3)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -31057,8 +29959,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a70_3)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -31077,8 +29978,7 @@ unsigned long REGPARAM2 CPUFUNC(op_ab0_3)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 34;
@@ -31095,10 +29995,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c30_3)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(6);
 return 18;
 }
@@ -31115,10 +30014,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c3b_3)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(6);
 return 18;
 }
@@ -31134,10 +30032,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c70_3)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(6);
 return 18;
 }
@@ -31154,10 +30051,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c7b_3)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(6);
 return 18;
 }
@@ -31173,10 +30069,9 @@ unsigned long REGPARAM2 CPUFUNC(op_cb0_3)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(8);
 return 26;
 }
@@ -31193,10 +30088,9 @@ unsigned long REGPARAM2 CPUFUNC(op_cbb_3)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(8);
 return 26;
 }
@@ -31209,8 +30103,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1030_3)(uae_u32 opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	uae_s8 src = get_byte(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 14;
@@ -31224,8 +30117,7 @@ unsigned long REGPARAM2 CPUFUNC(op_103b_3)(uae_u32 opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	uae_s8 src = get_byte(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 14;
@@ -31240,8 +30132,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10b0_3)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -31256,8 +30147,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10bb_3)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -31273,8 +30163,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10f0_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -31290,8 +30179,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10fb_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -31307,8 +30195,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1130_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -31324,8 +30211,7 @@ unsigned long REGPARAM2 CPUFUNC(op_113b_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -31340,8 +30226,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1170_3)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -31356,8 +30241,7 @@ unsigned long REGPARAM2 CPUFUNC(op_117b_3)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -31371,8 +30255,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1180_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}m68k_incpc(4);
 return 14;
@@ -31386,8 +30269,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1188_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}m68k_incpc(4);
 return 14;
@@ -31402,8 +30284,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1190_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -31419,8 +30300,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1198_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -31436,8 +30316,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11a0_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 20;
@@ -31452,8 +30331,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11a8_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -31469,8 +30347,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11b0_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 24;
@@ -31484,8 +30361,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11b8_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -31499,8 +30375,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11b9_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 return 26;
@@ -31515,8 +30390,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11ba_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -31532,8 +30406,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11bb_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 24;
@@ -31546,8 +30419,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11bc_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}m68k_incpc(6);
 return 18;
@@ -31561,8 +30433,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11f0_3)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -31576,8 +30447,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11fb_3)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -31591,8 +30461,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13f0_3)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 return 26;
@@ -31606,8 +30475,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13fb_3)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 return 26;
@@ -31621,8 +30489,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2030_3)(uae_u32 opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	uae_s32 src = get_long(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 18;
@@ -31636,8 +30503,7 @@ unsigned long REGPARAM2 CPUFUNC(op_203b_3)(uae_u32 opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	uae_s32 src = get_long(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 18;
@@ -31678,8 +30544,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20b0_3)(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 26;
@@ -31694,8 +30559,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20bb_3)(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 26;
@@ -31711,8 +30575,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20f0_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 26;
@@ -31728,8 +30591,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20fb_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 26;
@@ -31745,8 +30607,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2130_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 26;
@@ -31765,8 +30626,7 @@ unsigned long REGPARAM2 CPUFUNC(op_213b_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 26;
@@ -31781,8 +30641,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2170_3)(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 30;
@@ -31797,8 +30656,7 @@ unsigned long REGPARAM2 CPUFUNC(op_217b_3)(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 30;
@@ -31812,8 +30670,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2180_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}m68k_incpc(4);
 return 18;
@@ -31827,8 +30684,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2188_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}m68k_incpc(4);
 return 18;
@@ -31843,8 +30699,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2190_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 26;
@@ -31860,8 +30715,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2198_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 26;
@@ -31877,8 +30731,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21a0_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 28;
@@ -31893,8 +30746,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21a8_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 30;
@@ -31910,8 +30762,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21b0_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 32;
@@ -31925,8 +30776,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21b8_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 30;
@@ -31940,8 +30790,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21b9_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 34;
@@ -31956,8 +30805,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21ba_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 30;
@@ -31973,8 +30821,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21bb_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 32;
@@ -31987,8 +30834,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21bc_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}m68k_incpc(8);
 return 26;
@@ -32002,8 +30848,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21f0_3)(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 30;
@@ -32017,8 +30862,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21fb_3)(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 30;
@@ -32032,8 +30876,7 @@ unsigned long REGPARAM2 CPUFUNC(op_23f0_3)(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 34;
@@ -32047,8 +30890,7 @@ unsigned long REGPARAM2 CPUFUNC(op_23fb_3)(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 34;
@@ -32062,8 +30904,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3030_3)(uae_u32 opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	uae_s16 src = get_word(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 14;
@@ -32077,8 +30918,7 @@ unsigned long REGPARAM2 CPUFUNC(op_303b_3)(uae_u32 opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	uae_s16 src = get_word(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 14;
@@ -32119,8 +30959,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30b0_3)(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -32135,8 +30974,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30bb_3)(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -32152,8 +30990,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30f0_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -32169,8 +31006,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30fb_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -32186,8 +31022,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3130_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -32203,8 +31038,7 @@ unsigned long REGPARAM2 CPUFUNC(op_313b_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -32219,8 +31053,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3170_3)(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -32235,8 +31068,7 @@ unsigned long REGPARAM2 CPUFUNC(op_317b_3)(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -32250,8 +31082,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3180_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 return 14;
@@ -32265,8 +31096,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3188_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 return 14;
@@ -32281,8 +31111,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3190_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -32298,8 +31127,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3198_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -32315,8 +31143,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31a0_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 20;
@@ -32331,8 +31158,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31a8_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -32348,8 +31174,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31b0_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 24;
@@ -32363,8 +31188,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31b8_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -32378,8 +31202,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31b9_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 return 26;
@@ -32394,8 +31217,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31ba_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -32411,8 +31233,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31bb_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 24;
@@ -32425,8 +31246,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31bc_3)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}m68k_incpc(6);
 return 18;
@@ -32440,8 +31260,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31f0_3)(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -32455,8 +31274,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31fb_3)(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 22;
@@ -32470,8 +31288,7 @@ unsigned long REGPARAM2 CPUFUNC(op_33f0_3)(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 return 26;
@@ -32485,8 +31302,7 @@ unsigned long REGPARAM2 CPUFUNC(op_33fb_3)(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 return 26;
@@ -32629,8 +31445,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4230_3)(uae_u32 opcode) /* CLR */
 	BusCyclePenalty += 2;
 	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+	SET_NZFLG (((uae_s8)(0)));
 	put_byte(srca,0);
 }}m68k_incpc(4);
 return 18;
@@ -32646,8 +31461,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4270_3)(uae_u32 opcode) /* CLR */
 	BusCyclePenalty += 2;
 	uae_s16 src = get_word(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+	SET_NZFLG (((uae_s16)(0)));
 	put_word(srca,0);
 }}m68k_incpc(4);
 return 18;
@@ -32660,8 +31474,7 @@ unsigned long REGPARAM2 CPUFUNC(op_42b0_3)(uae_u32 opcode) /* CLR */
 	BusCyclePenalty += 2;
 	uae_s32 src = get_long(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+	SET_NZFLG (((uae_s32)(0)));
 	put_long(srca,0);
 }}m68k_incpc(4);
 return 26;
@@ -32689,11 +31502,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4430_3)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
+	SET_NZFLG (((uae_s8)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(srca,dst);
 }}}}}}m68k_incpc(4);
 return 18;
@@ -32710,11 +31522,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4470_3)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
+	SET_NZFLG (((uae_s16)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(srca,dst);
 }}}}}}m68k_incpc(4);
 return 18;
@@ -32731,11 +31542,10 @@ unsigned long REGPARAM2 CPUFUNC(op_44b0_3)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
+	SET_NZFLG (((uae_s32)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(srca,dst);
 }}}}}}m68k_incpc(4);
 return 26;
@@ -32778,8 +31588,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4630_3)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	SET_NZFLG (((uae_s8)(dst)));
 	put_byte(srca,dst);
 }}}}m68k_incpc(4);
 return 18;
@@ -32794,8 +31603,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4670_3)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	SET_NZFLG (((uae_s16)(dst)));
 	put_word(srca,dst);
 }}}}m68k_incpc(4);
 return 18;
@@ -32810,8 +31618,7 @@ unsigned long REGPARAM2 CPUFUNC(op_46b0_3)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_NZFLG (((uae_s32)(dst)));
 	put_long(srca,dst);
 }}}}m68k_incpc(4);
 return 26;
@@ -32928,8 +31735,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a30_3)(uae_u32 opcode) /* TST */
 	BusCyclePenalty += 2;
 {	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 }}}m68k_incpc(4);
 return 14;
 }
@@ -32941,8 +31747,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a3b_3)(uae_u32 opcode) /* TST */
 	BusCyclePenalty += 2;
 {	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 }}}m68k_incpc(4);
 return 14;
 }
@@ -32954,8 +31759,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a70_3)(uae_u32 opcode) /* TST */
 	BusCyclePenalty += 2;
 {	uae_s16 src = get_word(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 }}}m68k_incpc(4);
 return 14;
 }
@@ -32967,8 +31771,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a7b_3)(uae_u32 opcode) /* TST */
 	BusCyclePenalty += 2;
 {	uae_s16 src = get_word(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 }}}m68k_incpc(4);
 return 14;
 }
@@ -32980,8 +31783,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4ab0_3)(uae_u32 opcode) /* TST */
 	BusCyclePenalty += 2;
 {	uae_s32 src = get_long(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 }}}m68k_incpc(4);
 return 18;
 }
@@ -32993,8 +31795,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4abb_3)(uae_u32 opcode) /* TST */
 	BusCyclePenalty += 2;
 {	uae_s32 src = get_long(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 }}}m68k_incpc(4);
 return 18;
 }
@@ -33006,8 +31807,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4af0_3)(uae_u32 opcode) /* TAS */
 	BusCyclePenalty += 2;
 {	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(4);
@@ -33130,11 +31930,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5030_3)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 18;
@@ -33153,11 +31952,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5070_3)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 18;
@@ -33176,11 +31974,10 @@ unsigned long REGPARAM2 CPUFUNC(op_50b0_3)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 26;
@@ -33210,11 +32007,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5130_3)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 18;
@@ -33233,11 +32029,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5170_3)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 18;
@@ -33256,11 +32051,10 @@ unsigned long REGPARAM2 CPUFUNC(op_51b0_3)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 26;
@@ -33700,8 +32494,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8030_3)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 14;
@@ -33718,8 +32511,7 @@ unsigned long REGPARAM2 CPUFUNC(op_803b_3)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 14;
@@ -33736,8 +32528,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8070_3)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 14;
@@ -33754,8 +32545,7 @@ unsigned long REGPARAM2 CPUFUNC(op_807b_3)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 14;
@@ -33772,8 +32562,7 @@ unsigned long REGPARAM2 CPUFUNC(op_80b0_3)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 20;
@@ -33790,8 +32579,7 @@ unsigned long REGPARAM2 CPUFUNC(op_80bb_3)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 20;
@@ -33814,8 +32602,7 @@ m68k_incpc(4);
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -33842,8 +32629,7 @@ m68k_incpc(4);
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -33864,8 +32650,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8130_3)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -33882,8 +32667,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8170_3)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -33900,8 +32684,7 @@ unsigned long REGPARAM2 CPUFUNC(op_81b0_3)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 26;
@@ -33925,8 +32708,7 @@ m68k_incpc(4);
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -33954,8 +32736,7 @@ m68k_incpc(4);
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -33978,11 +32759,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9030_3)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(4);
 return 14;
@@ -34001,11 +32781,10 @@ unsigned long REGPARAM2 CPUFUNC(op_903b_3)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(4);
 return 14;
@@ -34024,11 +32803,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9070_3)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}m68k_incpc(4);
 return 14;
@@ -34047,11 +32825,10 @@ unsigned long REGPARAM2 CPUFUNC(op_907b_3)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}m68k_incpc(4);
 return 14;
@@ -34070,11 +32847,10 @@ unsigned long REGPARAM2 CPUFUNC(op_90b0_3)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}m68k_incpc(4);
 return 20;
@@ -34093,11 +32869,10 @@ unsigned long REGPARAM2 CPUFUNC(op_90bb_3)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}m68k_incpc(4);
 return 20;
@@ -34144,11 +32919,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9130_3)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 18;
@@ -34167,11 +32941,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9170_3)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 18;
@@ -34190,11 +32963,10 @@ unsigned long REGPARAM2 CPUFUNC(op_91b0_3)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 26;
@@ -34240,10 +33012,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b030_3)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(4);
 return 14;
 }
@@ -34260,10 +33031,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b03b_3)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(4);
 return 14;
 }
@@ -34283,10 +33053,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b070_3)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(4);
 return 14;
 }
@@ -34303,10 +33072,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b07b_3)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(4);
 return 14;
 }
@@ -34323,10 +33091,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0b0_3)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(4);
 return 20;
 }
@@ -34343,10 +33110,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0bb_3)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(4);
 return 20;
 }
@@ -34363,10 +33129,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0f0_3)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(4);
 return 16;
 }
@@ -34383,10 +33148,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0fb_3)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(4);
 return 16;
 }
@@ -34402,8 +33166,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b130_3)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -34420,8 +33183,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b170_3)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -34438,8 +33200,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b1b0_3)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 26;
@@ -34457,10 +33218,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b1f0_3)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(4);
 return 20;
 }
@@ -34477,10 +33237,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b1fb_3)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(4);
 return 20;
 }
@@ -34496,8 +33255,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c030_3)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 14;
@@ -34514,8 +33272,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c03b_3)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 14;
@@ -34532,8 +33289,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c070_3)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 14;
@@ -34550,8 +33306,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c07b_3)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 14;
@@ -34568,8 +33323,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0b0_3)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 20;
@@ -34586,8 +33340,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0bb_3)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 20;
@@ -34604,8 +33357,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0f0_3)(uae_u32 opcode) /* MULU */
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
 }}}}}m68k_incpc(4);
@@ -34623,8 +33375,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0fb_3)(uae_u32 opcode) /* MULU */
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
 }}}}}m68k_incpc(4);
@@ -34642,8 +33393,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c130_3)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -34660,8 +33410,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c170_3)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 18;
@@ -34678,8 +33427,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1b0_3)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 26;
@@ -34697,8 +33445,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1f0_3)(uae_u32 opcode) /* MULS */
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
 	uae_u32 src2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -34718,8 +33465,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1fb_3)(uae_u32 opcode) /* MULS */
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
 	uae_u32 src2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -34740,11 +33486,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d030_3)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(4);
 return 14;
@@ -34763,11 +33508,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d03b_3)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(4);
 return 14;
@@ -34786,11 +33530,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d070_3)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}m68k_incpc(4);
 return 14;
@@ -34809,11 +33552,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d07b_3)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}m68k_incpc(4);
 return 14;
@@ -34832,11 +33574,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d0b0_3)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}m68k_incpc(4);
 return 20;
@@ -34855,11 +33596,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d0bb_3)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}m68k_incpc(4);
 return 20;
@@ -34906,11 +33646,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d130_3)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_byte(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 18;
@@ -34929,11 +33668,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d170_3)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_word(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 18;
@@ -34952,11 +33690,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d1b0_3)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	put_long(dsta,newv);
 }}}}}}}m68k_incpc(4);
 return 26;
@@ -35004,8 +33741,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e0f0_3)(uae_u32 opcode) /* ASRW */
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35024,8 +33760,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e1f0_3)(uae_u32 opcode) /* ASLW */
 	uae_u32 sign2;
 	val <<= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -35045,8 +33780,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e2f0_3)(uae_u32 opcode) /* LSRW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35064,8 +33798,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e3f0_3)(uae_u32 opcode) /* LSLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35084,8 +33817,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e4f0_3)(uae_u32 opcode) /* ROXRW */
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35104,8 +33836,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e5f0_3)(uae_u32 opcode) /* ROXLW */
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -35124,8 +33855,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e6f0_3)(uae_u32 opcode) /* RORW */
 	val >>= 1;
 	if (carry) val |= 0x8000;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(4);
@@ -35143,8 +33873,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e7f0_3)(uae_u32 opcode) /* ROLW */
 	val <<= 1;
 	if (carry)  val |= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(4);
@@ -35305,8 +34034,7 @@ unsigned long REGPARAM2 CPUFUNC(op_0_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -35322,8 +34050,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -35340,8 +34067,7 @@ unsigned long REGPARAM2 CPUFUNC(op_18_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -35358,8 +34084,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -35375,8 +34100,7 @@ unsigned long REGPARAM2 CPUFUNC(op_28_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -35393,8 +34117,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -35409,8 +34132,7 @@ unsigned long REGPARAM2 CPUFUNC(op_38_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -35425,8 +34147,7 @@ unsigned long REGPARAM2 CPUFUNC(op_39_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -35453,8 +34174,7 @@ unsigned long REGPARAM2 CPUFUNC(op_40_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -35477,8 +34197,7 @@ unsigned long REGPARAM2 CPUFUNC(op_50_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -35503,8 +34222,7 @@ unsigned long REGPARAM2 CPUFUNC(op_58_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -35529,8 +34247,7 @@ unsigned long REGPARAM2 CPUFUNC(op_60_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -35554,8 +34271,7 @@ unsigned long REGPARAM2 CPUFUNC(op_68_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -35580,8 +34296,7 @@ unsigned long REGPARAM2 CPUFUNC(op_70_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -35604,8 +34319,7 @@ unsigned long REGPARAM2 CPUFUNC(op_78_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -35628,8 +34342,7 @@ unsigned long REGPARAM2 CPUFUNC(op_79_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -35658,8 +34371,7 @@ unsigned long REGPARAM2 CPUFUNC(op_80_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 fill_prefetch_0 ();
@@ -35682,8 +34394,7 @@ unsigned long REGPARAM2 CPUFUNC(op_90_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -35708,8 +34419,7 @@ unsigned long REGPARAM2 CPUFUNC(op_98_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -35734,8 +34444,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a0_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -35759,8 +34468,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a8_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -35785,8 +34493,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b0_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -35809,8 +34516,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b8_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -35833,8 +34539,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b9_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(10);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -36554,8 +35259,7 @@ unsigned long REGPARAM2 CPUFUNC(op_200_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -36571,8 +35275,7 @@ unsigned long REGPARAM2 CPUFUNC(op_210_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -36589,8 +35292,7 @@ unsigned long REGPARAM2 CPUFUNC(op_218_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -36607,8 +35309,7 @@ unsigned long REGPARAM2 CPUFUNC(op_220_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -36624,8 +35325,7 @@ unsigned long REGPARAM2 CPUFUNC(op_228_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -36642,8 +35342,7 @@ unsigned long REGPARAM2 CPUFUNC(op_230_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -36658,8 +35357,7 @@ unsigned long REGPARAM2 CPUFUNC(op_238_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -36674,8 +35372,7 @@ unsigned long REGPARAM2 CPUFUNC(op_239_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -36702,8 +35399,7 @@ unsigned long REGPARAM2 CPUFUNC(op_240_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -36726,8 +35422,7 @@ unsigned long REGPARAM2 CPUFUNC(op_250_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -36752,8 +35447,7 @@ unsigned long REGPARAM2 CPUFUNC(op_258_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -36778,8 +35472,7 @@ unsigned long REGPARAM2 CPUFUNC(op_260_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -36803,8 +35496,7 @@ unsigned long REGPARAM2 CPUFUNC(op_268_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -36829,8 +35521,7 @@ unsigned long REGPARAM2 CPUFUNC(op_270_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -36853,8 +35544,7 @@ unsigned long REGPARAM2 CPUFUNC(op_278_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -36877,8 +35567,7 @@ unsigned long REGPARAM2 CPUFUNC(op_279_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -36907,8 +35596,7 @@ unsigned long REGPARAM2 CPUFUNC(op_280_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 fill_prefetch_0 ();
@@ -36931,8 +35619,7 @@ unsigned long REGPARAM2 CPUFUNC(op_290_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -36957,8 +35644,7 @@ unsigned long REGPARAM2 CPUFUNC(op_298_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -36983,8 +35669,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2a0_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -37008,8 +35693,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2a8_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -37034,8 +35718,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2b0_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -37058,8 +35741,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2b8_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -37082,8 +35764,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2b9_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(10);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -37101,11 +35782,10 @@ unsigned long REGPARAM2 CPUFUNC(op_400_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -37123,11 +35803,10 @@ unsigned long REGPARAM2 CPUFUNC(op_410_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,newv);
@@ -37146,11 +35825,10 @@ unsigned long REGPARAM2 CPUFUNC(op_418_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,newv);
@@ -37169,11 +35847,10 @@ unsigned long REGPARAM2 CPUFUNC(op_420_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,newv);
@@ -37191,11 +35868,10 @@ unsigned long REGPARAM2 CPUFUNC(op_428_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,newv);
@@ -37214,11 +35890,10 @@ unsigned long REGPARAM2 CPUFUNC(op_430_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,newv);
@@ -37235,11 +35910,10 @@ unsigned long REGPARAM2 CPUFUNC(op_438_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,newv);
@@ -37256,11 +35930,10 @@ unsigned long REGPARAM2 CPUFUNC(op_439_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_byte(dsta,newv);
@@ -37277,11 +35950,10 @@ unsigned long REGPARAM2 CPUFUNC(op_440_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -37306,11 +35978,10 @@ unsigned long REGPARAM2 CPUFUNC(op_450_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,newv);
@@ -37337,11 +36008,10 @@ unsigned long REGPARAM2 CPUFUNC(op_458_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,newv);
@@ -37368,11 +36038,10 @@ unsigned long REGPARAM2 CPUFUNC(op_460_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,newv);
@@ -37398,11 +36067,10 @@ unsigned long REGPARAM2 CPUFUNC(op_468_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,newv);
@@ -37429,11 +36097,10 @@ unsigned long REGPARAM2 CPUFUNC(op_470_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,newv);
@@ -37458,11 +36125,10 @@ unsigned long REGPARAM2 CPUFUNC(op_478_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,newv);
@@ -37487,11 +36153,10 @@ unsigned long REGPARAM2 CPUFUNC(op_479_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_word(dsta,newv);
@@ -37509,11 +36174,10 @@ unsigned long REGPARAM2 CPUFUNC(op_480_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
@@ -37538,11 +36202,10 @@ unsigned long REGPARAM2 CPUFUNC(op_490_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,newv);
@@ -37569,11 +36232,10 @@ unsigned long REGPARAM2 CPUFUNC(op_498_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,newv);
@@ -37600,11 +36262,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4a0_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,newv);
@@ -37630,11 +36291,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4a8_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_long(dsta,newv);
@@ -37661,11 +36321,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4b0_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_long(dsta,newv);
@@ -37690,11 +36349,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4b8_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_long(dsta,newv);
@@ -37719,11 +36377,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4b9_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(10);
 fill_prefetch_0 ();
 	put_long(dsta,newv);
@@ -37741,11 +36398,10 @@ unsigned long REGPARAM2 CPUFUNC(op_600_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -37763,11 +36419,10 @@ unsigned long REGPARAM2 CPUFUNC(op_610_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,newv);
@@ -37786,11 +36441,10 @@ unsigned long REGPARAM2 CPUFUNC(op_618_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,newv);
@@ -37809,11 +36463,10 @@ unsigned long REGPARAM2 CPUFUNC(op_620_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,newv);
@@ -37831,11 +36484,10 @@ unsigned long REGPARAM2 CPUFUNC(op_628_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,newv);
@@ -37854,11 +36506,10 @@ unsigned long REGPARAM2 CPUFUNC(op_630_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,newv);
@@ -37875,11 +36526,10 @@ unsigned long REGPARAM2 CPUFUNC(op_638_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,newv);
@@ -37896,11 +36546,10 @@ unsigned long REGPARAM2 CPUFUNC(op_639_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_byte(dsta,newv);
@@ -37917,11 +36566,10 @@ unsigned long REGPARAM2 CPUFUNC(op_640_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -37946,11 +36594,10 @@ unsigned long REGPARAM2 CPUFUNC(op_650_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,newv);
@@ -37977,11 +36624,10 @@ unsigned long REGPARAM2 CPUFUNC(op_658_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,newv);
@@ -38008,11 +36654,10 @@ unsigned long REGPARAM2 CPUFUNC(op_660_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,newv);
@@ -38038,11 +36683,10 @@ unsigned long REGPARAM2 CPUFUNC(op_668_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,newv);
@@ -38069,11 +36713,10 @@ unsigned long REGPARAM2 CPUFUNC(op_670_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,newv);
@@ -38098,11 +36741,10 @@ unsigned long REGPARAM2 CPUFUNC(op_678_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,newv);
@@ -38127,11 +36769,10 @@ unsigned long REGPARAM2 CPUFUNC(op_679_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_word(dsta,newv);
@@ -38149,11 +36790,10 @@ unsigned long REGPARAM2 CPUFUNC(op_680_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
@@ -38178,11 +36818,10 @@ unsigned long REGPARAM2 CPUFUNC(op_690_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,newv);
@@ -38209,11 +36848,10 @@ unsigned long REGPARAM2 CPUFUNC(op_698_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,newv);
@@ -38240,11 +36878,10 @@ unsigned long REGPARAM2 CPUFUNC(op_6a0_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,newv);
@@ -38270,11 +36907,10 @@ unsigned long REGPARAM2 CPUFUNC(op_6a8_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_long(dsta,newv);
@@ -38301,11 +36937,10 @@ unsigned long REGPARAM2 CPUFUNC(op_6b0_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_long(dsta,newv);
@@ -38330,11 +36965,10 @@ unsigned long REGPARAM2 CPUFUNC(op_6b8_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_long(dsta,newv);
@@ -38359,11 +36993,10 @@ unsigned long REGPARAM2 CPUFUNC(op_6b9_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(10);
 fill_prefetch_0 ();
 	put_long(dsta,newv);
@@ -38983,8 +37616,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a00_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -39000,8 +37632,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a10_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -39018,8 +37649,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a18_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -39036,8 +37666,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a20_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -39053,8 +37682,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a28_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -39071,8 +37699,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a30_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -39087,8 +37714,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a38_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -39103,8 +37729,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a39_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -39131,8 +37756,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a40_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -39155,8 +37779,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a50_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -39181,8 +37804,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a58_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -39207,8 +37829,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a60_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -39232,8 +37853,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a68_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -39258,8 +37878,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a70_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -39282,8 +37901,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a78_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -39306,8 +37924,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a79_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -39339,8 +37956,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a80_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 fill_prefetch_0 ();
@@ -39363,8 +37979,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a90_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -39389,8 +38004,7 @@ unsigned long REGPARAM2 CPUFUNC(op_a98_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -39415,8 +38029,7 @@ unsigned long REGPARAM2 CPUFUNC(op_aa0_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -39440,8 +38053,7 @@ unsigned long REGPARAM2 CPUFUNC(op_aa8_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -39466,8 +38078,7 @@ unsigned long REGPARAM2 CPUFUNC(op_ab0_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -39490,8 +38101,7 @@ unsigned long REGPARAM2 CPUFUNC(op_ab8_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -39514,8 +38124,7 @@ unsigned long REGPARAM2 CPUFUNC(op_ab9_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(10);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -39532,10 +38141,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c00_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 8;
@@ -39551,10 +38159,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c10_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 12;
@@ -39571,10 +38178,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c18_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 12;
@@ -39591,10 +38197,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c20_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 14;
@@ -39610,10 +38215,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c28_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 return 16;
@@ -39630,10 +38234,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c30_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 return 18;
@@ -39648,10 +38251,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c38_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 return 16;
@@ -39666,10 +38268,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c39_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(8);
 fill_prefetch_0 ();
 return 20;
@@ -39686,10 +38287,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c3a_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 return 16;
@@ -39707,10 +38307,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c3b_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 return 18;
@@ -39725,10 +38324,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c40_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 8;
@@ -39751,10 +38349,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c50_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2378: ;
@@ -39779,10 +38376,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c58_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2379: ;
@@ -39807,10 +38403,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c60_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2380: ;
@@ -39834,10 +38429,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c68_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 endlabel2381: ;
@@ -39862,10 +38456,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c70_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 endlabel2382: ;
@@ -39888,10 +38481,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c78_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 endlabel2383: ;
@@ -39914,10 +38506,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c79_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(8);
 fill_prefetch_0 ();
 endlabel2384: ;
@@ -39942,10 +38533,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c7a_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 endlabel2385: ;
@@ -39971,10 +38561,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c7b_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 endlabel2386: ;
@@ -39990,10 +38579,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c80_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 return 14;
@@ -40016,10 +38604,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c90_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 endlabel2388: ;
@@ -40044,10 +38631,9 @@ unsigned long REGPARAM2 CPUFUNC(op_c98_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 endlabel2389: ;
@@ -40072,10 +38658,9 @@ unsigned long REGPARAM2 CPUFUNC(op_ca0_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 endlabel2390: ;
@@ -40099,10 +38684,9 @@ unsigned long REGPARAM2 CPUFUNC(op_ca8_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(8);
 fill_prefetch_0 ();
 endlabel2391: ;
@@ -40127,10 +38711,9 @@ unsigned long REGPARAM2 CPUFUNC(op_cb0_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(8);
 fill_prefetch_0 ();
 endlabel2392: ;
@@ -40153,10 +38736,9 @@ unsigned long REGPARAM2 CPUFUNC(op_cb8_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(8);
 fill_prefetch_0 ();
 endlabel2393: ;
@@ -40179,10 +38761,9 @@ unsigned long REGPARAM2 CPUFUNC(op_cb9_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(10);
 fill_prefetch_0 ();
 endlabel2394: ;
@@ -40207,10 +38788,9 @@ unsigned long REGPARAM2 CPUFUNC(op_cba_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(8);
 fill_prefetch_0 ();
 endlabel2395: ;
@@ -40236,10 +38816,9 @@ unsigned long REGPARAM2 CPUFUNC(op_cbb_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(8);
 fill_prefetch_0 ();
 endlabel2396: ;
@@ -40252,8 +38831,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1000_5)(uae_u32 opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 4;  
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -40266,8 +38844,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1008_5)(uae_u32 opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 4;  
 {{	uae_s8 src = m68k_areg(regs, srcreg);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -40281,8 +38858,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1010_5)(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -40297,8 +38873,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1018_5)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -40313,8 +38888,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1020_5)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -40328,8 +38902,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1028_5)(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword_prefetch(2);
 {	uae_s8 src = get_byte(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -40344,8 +38917,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1030_5)(uae_u32 opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	uae_s8 src = get_byte(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -40358,8 +38930,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1038_5)(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_prefetch(2);
 {	uae_s8 src = get_byte(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -40372,8 +38943,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1039_5)(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_ilong_prefetch(2);
 {	uae_s8 src = get_byte(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(6);
 fill_prefetch_0 ();
@@ -40387,8 +38957,7 @@ unsigned long REGPARAM2 CPUFUNC(op_103a_5)(uae_u32 opcode) /* MOVE */
 	srca += (uae_s32)(uae_s16)get_iword_prefetch(2);
 {	uae_s8 src = get_byte(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -40403,8 +38972,7 @@ unsigned long REGPARAM2 CPUFUNC(op_103b_5)(uae_u32 opcode) /* MOVE */
 	BusCyclePenalty += 2;
 {	uae_s8 src = get_byte(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -40416,8 +38984,7 @@ unsigned long REGPARAM2 CPUFUNC(op_103c_5)(uae_u32 opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 8;  
 {{	uae_s8 src = get_ibyte_prefetch(2);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -40431,8 +38998,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1080_5)(uae_u32 opcode) /* MOVE */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(dsta,src);
@@ -40446,8 +39012,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1088_5)(uae_u32 opcode) /* MOVE */
 {{	uae_s8 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(dsta,src);
@@ -40462,8 +39027,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1090_5)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(dsta,src);
@@ -40479,8 +39043,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1098_5)(uae_u32 opcode) /* MOVE */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(dsta,src);
@@ -40496,8 +39059,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10a0_5)(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(dsta,src);
@@ -40512,8 +39074,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10a8_5)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -40529,8 +39090,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10b0_5)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -40544,8 +39104,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10b8_5)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -40559,8 +39118,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10b9_5)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -40575,8 +39133,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10ba_5)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -40592,8 +39149,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10bb_5)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -40606,8 +39162,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10bc_5)(uae_u32 opcode) /* MOVE */
 {{	uae_s8 src = get_ibyte_prefetch(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -40622,8 +39177,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10c0_5)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(dsta,src);
@@ -40638,8 +39192,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10c8_5)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(dsta,src);
@@ -40655,8 +39208,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10d0_5)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(dsta,src);
@@ -40673,8 +39225,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10d8_5)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(dsta,src);
@@ -40691,8 +39242,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10e0_5)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(dsta,src);
@@ -40708,8 +39258,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10e8_5)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -40726,8 +39275,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10f0_5)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -40742,8 +39290,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10f8_5)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -40758,8 +39305,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10f9_5)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -40775,8 +39321,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10fa_5)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -40793,8 +39338,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10fb_5)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -40808,8 +39352,7 @@ unsigned long REGPARAM2 CPUFUNC(op_10fc_5)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -40824,8 +39367,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1100_5)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(dsta,src);
@@ -40840,8 +39382,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1108_5)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(dsta,src);
@@ -40857,8 +39398,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1110_5)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(dsta,src);
@@ -40875,8 +39415,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1118_5)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(dsta,src);
@@ -40893,8 +39432,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1120_5)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(dsta,src);
@@ -40910,8 +39448,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1128_5)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -40928,8 +39465,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1130_5)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -40944,8 +39480,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1138_5)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -40960,8 +39495,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1139_5)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -40977,8 +39511,7 @@ unsigned long REGPARAM2 CPUFUNC(op_113a_5)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -40995,8 +39528,7 @@ unsigned long REGPARAM2 CPUFUNC(op_113b_5)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41010,8 +39542,7 @@ unsigned long REGPARAM2 CPUFUNC(op_113c_5)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41025,8 +39556,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1140_5)(uae_u32 opcode) /* MOVE */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword_prefetch(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41040,8 +39570,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1148_5)(uae_u32 opcode) /* MOVE */
 {{	uae_s8 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword_prefetch(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41056,8 +39585,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1150_5)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword_prefetch(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41073,8 +39601,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1158_5)(uae_u32 opcode) /* MOVE */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword_prefetch(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41090,8 +39617,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1160_5)(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword_prefetch(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41106,8 +39632,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1168_5)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword_prefetch(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41123,8 +39648,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1170_5)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword_prefetch(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41138,8 +39662,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1178_5)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword_prefetch(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41153,8 +39676,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1179_5)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword_prefetch(6);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41169,8 +39691,7 @@ unsigned long REGPARAM2 CPUFUNC(op_117a_5)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword_prefetch(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41186,8 +39707,7 @@ unsigned long REGPARAM2 CPUFUNC(op_117b_5)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword_prefetch(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41200,8 +39720,7 @@ unsigned long REGPARAM2 CPUFUNC(op_117c_5)(uae_u32 opcode) /* MOVE */
 {{	uae_s8 src = get_ibyte_prefetch(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword_prefetch(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41216,8 +39735,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1180_5)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword_prefetch(2));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41232,8 +39750,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1188_5)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword_prefetch(2));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41249,8 +39766,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1190_5)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword_prefetch(2));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41267,8 +39783,7 @@ unsigned long REGPARAM2 CPUFUNC(op_1198_5)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword_prefetch(2));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41285,8 +39800,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11a0_5)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword_prefetch(2));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41302,8 +39816,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11a8_5)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword_prefetch(4));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41320,8 +39833,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11b0_5)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword_prefetch(4));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41336,8 +39848,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11b8_5)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword_prefetch(4));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41352,8 +39863,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11b9_5)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword_prefetch(6));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41369,8 +39879,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11ba_5)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword_prefetch(4));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41387,8 +39896,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11bb_5)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword_prefetch(4));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41402,8 +39910,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11bc_5)(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword_prefetch(4));
 	BusCyclePenalty += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41416,8 +39923,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11c0_5)(uae_u32 opcode) /* MOVE */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_prefetch(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41430,8 +39936,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11c8_5)(uae_u32 opcode) /* MOVE */
 {{	uae_s8 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_prefetch(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41445,8 +39950,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11d0_5)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_prefetch(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41461,8 +39965,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11d8_5)(uae_u32 opcode) /* MOVE */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_prefetch(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41477,8 +39980,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11e0_5)(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_prefetch(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41492,8 +39994,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11e8_5)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_prefetch(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41508,8 +40009,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11f0_5)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_prefetch(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41522,8 +40022,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11f8_5)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_prefetch(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41536,8 +40035,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11f9_5)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_prefetch(6);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41551,8 +40049,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11fa_5)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_prefetch(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41567,8 +40064,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11fb_5)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_prefetch(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41580,8 +40076,7 @@ unsigned long REGPARAM2 CPUFUNC(op_11fc_5)(uae_u32 opcode) /* MOVE */
 {{	uae_s8 src = get_ibyte_prefetch(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword_prefetch(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41594,8 +40089,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13c0_5)(uae_u32 opcode) /* MOVE */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = get_ilong_prefetch(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41608,8 +40102,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13c8_5)(uae_u32 opcode) /* MOVE */
 {{	uae_s8 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = get_ilong_prefetch(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41623,8 +40116,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13d0_5)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong_prefetch(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41639,8 +40131,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13d8_5)(uae_u32 opcode) /* MOVE */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = get_ilong_prefetch(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41655,8 +40146,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13e0_5)(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = get_ilong_prefetch(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41670,8 +40160,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13e8_5)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong_prefetch(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41686,8 +40175,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13f0_5)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong_prefetch(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41700,8 +40188,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13f8_5)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong_prefetch(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41714,8 +40201,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13f9_5)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong_prefetch(6);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(10);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41729,8 +40215,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13fa_5)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong_prefetch(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41745,8 +40230,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13fb_5)(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong_prefetch(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41758,8 +40242,7 @@ unsigned long REGPARAM2 CPUFUNC(op_13fc_5)(uae_u32 opcode) /* MOVE */
 {{	uae_s8 src = get_ibyte_prefetch(2);
 {	uaecptr dsta = get_ilong_prefetch(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -41772,8 +40255,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2000_5)(uae_u32 opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 4;  
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -41786,8 +40268,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2008_5)(uae_u32 opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 4;  
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -41808,8 +40289,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2010_5)(uae_u32 opcode) /* MOVE */
 	}
 {{	uae_s32 src = get_long(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -41832,8 +40312,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2018_5)(uae_u32 opcode) /* MOVE */
 {{	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -41856,8 +40335,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2020_5)(uae_u32 opcode) /* MOVE */
 {{	uae_s32 src = get_long(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -41879,8 +40357,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2028_5)(uae_u32 opcode) /* MOVE */
 	}
 {{	uae_s32 src = get_long(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -41903,8 +40380,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2030_5)(uae_u32 opcode) /* MOVE */
 	}
 {{	uae_s32 src = get_long(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -41925,8 +40401,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2038_5)(uae_u32 opcode) /* MOVE */
 	}
 {{	uae_s32 src = get_long(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -41947,8 +40422,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2039_5)(uae_u32 opcode) /* MOVE */
 	}
 {{	uae_s32 src = get_long(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(6);
 fill_prefetch_0 ();
@@ -41970,8 +40444,7 @@ unsigned long REGPARAM2 CPUFUNC(op_203a_5)(uae_u32 opcode) /* MOVE */
 	}
 {{	uae_s32 src = get_long(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -41994,8 +40467,7 @@ unsigned long REGPARAM2 CPUFUNC(op_203b_5)(uae_u32 opcode) /* MOVE */
 	}
 {{	uae_s32 src = get_long(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -42008,8 +40480,7 @@ unsigned long REGPARAM2 CPUFUNC(op_203c_5)(uae_u32 opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 12; 
 {{	uae_s32 src = get_ilong_prefetch(2);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 fill_prefetch_0 ();
@@ -42256,8 +40727,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2080_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2517;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(dsta,src);
@@ -42279,8 +40749,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2088_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2518;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(dsta,src);
@@ -42310,8 +40779,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2090_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2519;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(dsta,src);
@@ -42342,8 +40810,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2098_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2520;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(dsta,src);
@@ -42374,8 +40841,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20a0_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2521;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(dsta,src);
@@ -42405,8 +40871,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20a8_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2522;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -42437,8 +40902,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20b0_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2523;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -42467,8 +40931,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20b8_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2524;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -42497,8 +40960,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20b9_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2525;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -42528,8 +40990,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20ba_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2526;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -42560,8 +41021,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20bb_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2527;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -42582,8 +41042,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20bc_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2528;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -42606,8 +41065,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20c0_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg(regs, dstreg) += 4;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(dsta,src);
@@ -42630,8 +41088,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20c8_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg(regs, dstreg) += 4;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(dsta,src);
@@ -42662,8 +41119,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20d0_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg(regs, dstreg) += 4;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(dsta,src);
@@ -42695,8 +41151,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20d8_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg(regs, dstreg) += 4;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(dsta,src);
@@ -42728,8 +41183,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20e0_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg(regs, dstreg) += 4;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(dsta,src);
@@ -42760,8 +41214,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20e8_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg(regs, dstreg) += 4;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -42793,8 +41246,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20f0_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg(regs, dstreg) += 4;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -42824,8 +41276,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20f8_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg(regs, dstreg) += 4;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -42855,8 +41306,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20f9_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg(regs, dstreg) += 4;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -42887,8 +41337,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20fa_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg(regs, dstreg) += 4;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -42920,8 +41369,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20fb_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg(regs, dstreg) += 4;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -42943,8 +41391,7 @@ unsigned long REGPARAM2 CPUFUNC(op_20fc_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg(regs, dstreg) += 4;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -42967,8 +41414,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2100_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(dsta,src);
@@ -42991,8 +41437,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2108_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(dsta,src);
@@ -43023,8 +41468,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2110_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(dsta,src);
@@ -43056,8 +41500,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2118_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(dsta,src);
@@ -43089,8 +41532,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2120_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(dsta,src);
@@ -43121,8 +41563,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2128_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -43154,8 +41595,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2130_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -43185,8 +41625,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2138_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -43219,8 +41658,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2139_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -43251,8 +41689,7 @@ unsigned long REGPARAM2 CPUFUNC(op_213a_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -43284,8 +41721,7 @@ unsigned long REGPARAM2 CPUFUNC(op_213b_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -43307,8 +41743,7 @@ unsigned long REGPARAM2 CPUFUNC(op_213c_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -43330,8 +41765,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2140_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2553;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -43353,8 +41787,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2148_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2554;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -43384,8 +41817,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2150_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2555;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -43416,8 +41848,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2158_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2556;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -43448,8 +41879,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2160_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2557;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -43479,8 +41909,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2168_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2558;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -43511,8 +41940,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2170_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2559;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -43541,8 +41969,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2178_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2560;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -43571,8 +41998,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2179_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2561;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -43602,8 +42028,7 @@ unsigned long REGPARAM2 CPUFUNC(op_217a_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2562;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -43634,8 +42059,7 @@ unsigned long REGPARAM2 CPUFUNC(op_217b_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2563;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -43656,8 +42080,7 @@ unsigned long REGPARAM2 CPUFUNC(op_217c_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2564;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -43680,8 +42103,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2180_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2565;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -43704,8 +42126,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2188_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2566;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -43736,8 +42157,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2190_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2567;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -43769,8 +42189,7 @@ unsigned long REGPARAM2 CPUFUNC(op_2198_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2568;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -43802,8 +42221,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21a0_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2569;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -43834,8 +42252,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21a8_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2570;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -43867,8 +42284,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21b0_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2571;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -43898,8 +42314,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21b8_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2572;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -43929,8 +42344,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21b9_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2573;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -43961,8 +42375,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21ba_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2574;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -43994,8 +42407,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21bb_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2575;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -44017,8 +42429,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21bc_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2576;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -44039,8 +42450,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21c0_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2577;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -44061,8 +42471,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21c8_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2578;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -44091,8 +42500,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21d0_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2579;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -44122,8 +42530,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21d8_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2580;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -44153,8 +42560,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21e0_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2581;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -44183,8 +42589,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21e8_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2582;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -44214,8 +42619,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21f0_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2583;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -44243,8 +42647,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21f8_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2584;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -44272,8 +42675,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21f9_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2585;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -44302,8 +42704,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21fa_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2586;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -44333,8 +42734,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21fb_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2587;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -44354,8 +42754,7 @@ unsigned long REGPARAM2 CPUFUNC(op_21fc_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2588;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -44376,8 +42775,7 @@ unsigned long REGPARAM2 CPUFUNC(op_23c0_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2589;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -44398,8 +42796,7 @@ unsigned long REGPARAM2 CPUFUNC(op_23c8_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2590;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -44428,8 +42825,7 @@ unsigned long REGPARAM2 CPUFUNC(op_23d0_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2591;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -44459,8 +42855,7 @@ unsigned long REGPARAM2 CPUFUNC(op_23d8_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2592;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -44490,8 +42885,7 @@ unsigned long REGPARAM2 CPUFUNC(op_23e0_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2593;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -44520,8 +42914,7 @@ unsigned long REGPARAM2 CPUFUNC(op_23e8_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2594;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -44551,8 +42944,7 @@ unsigned long REGPARAM2 CPUFUNC(op_23f0_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2595;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -44580,8 +42972,7 @@ unsigned long REGPARAM2 CPUFUNC(op_23f8_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2596;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -44609,8 +43000,7 @@ unsigned long REGPARAM2 CPUFUNC(op_23f9_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2597;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(10);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -44639,8 +43029,7 @@ unsigned long REGPARAM2 CPUFUNC(op_23fa_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2598;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -44670,8 +43059,7 @@ unsigned long REGPARAM2 CPUFUNC(op_23fb_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2599;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -44691,8 +43079,7 @@ unsigned long REGPARAM2 CPUFUNC(op_23fc_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2600;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(10);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -44706,8 +43093,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3000_5)(uae_u32 opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 4;  
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -44720,8 +43106,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3008_5)(uae_u32 opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 4;  
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -44742,8 +43127,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3010_5)(uae_u32 opcode) /* MOVE */
 	}
 {{	uae_s16 src = get_word(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -44766,8 +43150,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3018_5)(uae_u32 opcode) /* MOVE */
 {{	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -44790,8 +43173,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3020_5)(uae_u32 opcode) /* MOVE */
 {{	uae_s16 src = get_word(srca);
 	m68k_areg (regs, srcreg) = srca;
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -44813,8 +43195,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3028_5)(uae_u32 opcode) /* MOVE */
 	}
 {{	uae_s16 src = get_word(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -44837,8 +43218,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3030_5)(uae_u32 opcode) /* MOVE */
 	}
 {{	uae_s16 src = get_word(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -44859,8 +43239,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3038_5)(uae_u32 opcode) /* MOVE */
 	}
 {{	uae_s16 src = get_word(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -44881,8 +43260,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3039_5)(uae_u32 opcode) /* MOVE */
 	}
 {{	uae_s16 src = get_word(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(6);
 fill_prefetch_0 ();
@@ -44904,8 +43282,7 @@ unsigned long REGPARAM2 CPUFUNC(op_303a_5)(uae_u32 opcode) /* MOVE */
 	}
 {{	uae_s16 src = get_word(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -44928,8 +43305,7 @@ unsigned long REGPARAM2 CPUFUNC(op_303b_5)(uae_u32 opcode) /* MOVE */
 	}
 {{	uae_s16 src = get_word(srca);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -44942,8 +43318,7 @@ unsigned long REGPARAM2 CPUFUNC(op_303c_5)(uae_u32 opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 8;  
 {{	uae_s16 src = get_iword_prefetch(2);
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -45190,8 +43565,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3080_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2625;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(dsta,src);
@@ -45213,8 +43587,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3088_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2626;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(dsta,src);
@@ -45244,8 +43617,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3090_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2627;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(dsta,src);
@@ -45276,8 +43648,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3098_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2628;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(dsta,src);
@@ -45308,8 +43679,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30a0_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2629;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(dsta,src);
@@ -45339,8 +43709,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30a8_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2630;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -45371,8 +43740,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30b0_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2631;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -45401,8 +43769,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30b8_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2632;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -45431,8 +43798,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30b9_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2633;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -45462,8 +43828,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30ba_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2634;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -45494,8 +43859,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30bb_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2635;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -45516,8 +43880,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30bc_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2636;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -45540,8 +43903,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30c0_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg(regs, dstreg) += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(dsta,src);
@@ -45564,8 +43926,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30c8_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg(regs, dstreg) += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(dsta,src);
@@ -45596,8 +43957,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30d0_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg(regs, dstreg) += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(dsta,src);
@@ -45629,8 +43989,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30d8_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg(regs, dstreg) += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(dsta,src);
@@ -45662,8 +44021,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30e0_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg(regs, dstreg) += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(dsta,src);
@@ -45694,8 +44052,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30e8_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg(regs, dstreg) += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -45727,8 +44084,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30f0_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg(regs, dstreg) += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -45758,8 +44114,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30f8_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg(regs, dstreg) += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -45789,8 +44144,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30f9_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg(regs, dstreg) += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -45821,8 +44175,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30fa_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg(regs, dstreg) += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -45854,8 +44207,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30fb_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg(regs, dstreg) += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -45877,8 +44229,7 @@ unsigned long REGPARAM2 CPUFUNC(op_30fc_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg(regs, dstreg) += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -45901,8 +44252,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3100_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(dsta,src);
@@ -45925,8 +44275,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3108_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(dsta,src);
@@ -45957,8 +44306,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3110_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(dsta,src);
@@ -45990,8 +44338,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3118_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(dsta,src);
@@ -46023,8 +44370,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3120_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(dsta,src);
@@ -46055,8 +44401,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3128_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -46088,8 +44433,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3130_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -46119,8 +44463,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3138_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -46150,8 +44493,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3139_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -46182,8 +44524,7 @@ unsigned long REGPARAM2 CPUFUNC(op_313a_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -46215,8 +44556,7 @@ unsigned long REGPARAM2 CPUFUNC(op_313b_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -46238,8 +44578,7 @@ unsigned long REGPARAM2 CPUFUNC(op_313c_5)(uae_u32 opcode) /* MOVE */
 	}
 {	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -46261,8 +44600,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3140_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2661;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -46284,8 +44622,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3148_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2662;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -46315,8 +44652,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3150_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2663;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -46347,8 +44683,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3158_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2664;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -46379,8 +44714,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3160_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2665;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -46410,8 +44744,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3168_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2666;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -46442,8 +44775,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3170_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2667;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -46472,8 +44804,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3178_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2668;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -46502,8 +44833,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3179_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2669;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -46533,8 +44863,7 @@ unsigned long REGPARAM2 CPUFUNC(op_317a_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2670;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -46565,8 +44894,7 @@ unsigned long REGPARAM2 CPUFUNC(op_317b_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2671;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -46587,8 +44915,7 @@ unsigned long REGPARAM2 CPUFUNC(op_317c_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2672;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -46611,8 +44938,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3180_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2673;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -46635,8 +44961,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3188_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2674;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -46667,8 +44992,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3190_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2675;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -46700,8 +45024,7 @@ unsigned long REGPARAM2 CPUFUNC(op_3198_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2676;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -46733,8 +45056,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31a0_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2677;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -46765,8 +45087,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31a8_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2678;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -46798,8 +45119,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31b0_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2679;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -46829,8 +45149,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31b8_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2680;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -46860,8 +45179,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31b9_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2681;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -46892,8 +45210,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31ba_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2682;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -46925,8 +45242,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31bb_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2683;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -46948,8 +45264,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31bc_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2684;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -46970,8 +45285,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31c0_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2685;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -46992,8 +45306,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31c8_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2686;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -47022,8 +45335,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31d0_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2687;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -47053,8 +45365,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31d8_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2688;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -47084,8 +45395,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31e0_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2689;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -47114,8 +45424,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31e8_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2690;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -47145,8 +45454,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31f0_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2691;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -47174,8 +45482,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31f8_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2692;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -47203,8 +45510,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31f9_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2693;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -47233,8 +45539,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31fa_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2694;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -47264,8 +45569,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31fb_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2695;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -47285,8 +45589,7 @@ unsigned long REGPARAM2 CPUFUNC(op_31fc_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2696;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -47307,8 +45610,7 @@ unsigned long REGPARAM2 CPUFUNC(op_33c0_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2697;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -47329,8 +45631,7 @@ unsigned long REGPARAM2 CPUFUNC(op_33c8_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2698;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -47359,8 +45660,7 @@ unsigned long REGPARAM2 CPUFUNC(op_33d0_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2699;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -47390,8 +45690,7 @@ unsigned long REGPARAM2 CPUFUNC(op_33d8_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2700;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -47421,8 +45720,7 @@ unsigned long REGPARAM2 CPUFUNC(op_33e0_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2701;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -47451,8 +45749,7 @@ unsigned long REGPARAM2 CPUFUNC(op_33e8_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2702;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -47482,8 +45779,7 @@ unsigned long REGPARAM2 CPUFUNC(op_33f0_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2703;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -47511,8 +45807,7 @@ unsigned long REGPARAM2 CPUFUNC(op_33f8_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2704;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -47540,8 +45835,7 @@ unsigned long REGPARAM2 CPUFUNC(op_33f9_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2705;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(10);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -47570,8 +45864,7 @@ unsigned long REGPARAM2 CPUFUNC(op_33fa_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2706;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -47601,8 +45894,7 @@ unsigned long REGPARAM2 CPUFUNC(op_33fb_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2707;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -47622,8 +45914,7 @@ unsigned long REGPARAM2 CPUFUNC(op_33fc_5)(uae_u32 opcode) /* MOVE */
 		goto endlabel2708;
 	}
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(8);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -48710,8 +47001,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4200_5)(uae_u32 opcode) /* CLR */
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 4;  
 {{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+	SET_NZFLG (((uae_s8)(0)));
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((0) & 0xff);
 }}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -48724,8 +47014,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4210_5)(uae_u32 opcode) /* CLR */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+	SET_NZFLG (((uae_s8)(0)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(srca,0);
@@ -48739,8 +47028,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4218_5)(uae_u32 opcode) /* CLR */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+	SET_NZFLG (((uae_s8)(0)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(srca,0);
@@ -48754,8 +47042,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4220_5)(uae_u32 opcode) /* CLR */
 	m68k_areg (regs, srcreg) = srca;
 	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+	SET_NZFLG (((uae_s8)(0)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(srca,0);
@@ -48768,8 +47055,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4228_5)(uae_u32 opcode) /* CLR */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword_prefetch(2);
 	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+	SET_NZFLG (((uae_s8)(0)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(srca,0);
@@ -48783,8 +47069,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4230_5)(uae_u32 opcode) /* CLR */
 	BusCyclePenalty += 2;
 	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+	SET_NZFLG (((uae_s8)(0)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(srca,0);
@@ -48796,8 +47081,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4238_5)(uae_u32 opcode) /* CLR */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_prefetch(2);
 	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+	SET_NZFLG (((uae_s8)(0)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(srca,0);
@@ -48809,8 +47093,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4239_5)(uae_u32 opcode) /* CLR */
 {{	uaecptr srca = get_ilong_prefetch(2);
 	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+	SET_NZFLG (((uae_s8)(0)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(srca,0);
@@ -48821,8 +47104,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4240_5)(uae_u32 opcode) /* CLR */
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 4;  
 {{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+	SET_NZFLG (((uae_s16)(0)));
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((0) & 0xffff);
 }}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -48842,8 +47124,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4250_5)(uae_u32 opcode) /* CLR */
 	}
 {	uae_s16 src = get_word(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+	SET_NZFLG (((uae_s16)(0)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(srca,0);
@@ -48865,8 +47146,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4258_5)(uae_u32 opcode) /* CLR */
 {	m68k_areg(regs, srcreg) += 2;
 	uae_s16 src = get_word(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+	SET_NZFLG (((uae_s16)(0)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(srca,0);
@@ -48888,8 +47168,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4260_5)(uae_u32 opcode) /* CLR */
 {	m68k_areg (regs, srcreg) = srca;
 	uae_s16 src = get_word(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+	SET_NZFLG (((uae_s16)(0)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(srca,0);
@@ -48910,8 +47189,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4268_5)(uae_u32 opcode) /* CLR */
 	}
 {	uae_s16 src = get_word(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+	SET_NZFLG (((uae_s16)(0)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(srca,0);
@@ -48936,8 +47214,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4270_5)(uae_u32 opcode) /* CLR */
 	}
 {	uae_s16 src = get_word(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+	SET_NZFLG (((uae_s16)(0)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(srca,0);
@@ -48957,8 +47234,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4278_5)(uae_u32 opcode) /* CLR */
 	}
 {	uae_s16 src = get_word(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+	SET_NZFLG (((uae_s16)(0)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(srca,0);
@@ -48978,8 +47254,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4279_5)(uae_u32 opcode) /* CLR */
 	}
 {	uae_s16 src = get_word(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+	SET_NZFLG (((uae_s16)(0)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(srca,0);
@@ -48991,8 +47266,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4280_5)(uae_u32 opcode) /* CLR */
 	uae_u32 srcreg = (opcode & 7);
 	OpcodeFamily = 18; CurrentInstrCycles = 6;  
 {{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+	SET_NZFLG (((uae_s32)(0)));
 	m68k_dreg(regs, srcreg) = (0);
 }}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -49012,8 +47286,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4290_5)(uae_u32 opcode) /* CLR */
 	}
 {	uae_s32 src = get_long(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+	SET_NZFLG (((uae_s32)(0)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(srca,0);
@@ -49035,8 +47308,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4298_5)(uae_u32 opcode) /* CLR */
 {	m68k_areg(regs, srcreg) += 4;
 	uae_s32 src = get_long(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+	SET_NZFLG (((uae_s32)(0)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(srca,0);
@@ -49058,8 +47330,7 @@ unsigned long REGPARAM2 CPUFUNC(op_42a0_5)(uae_u32 opcode) /* CLR */
 {	m68k_areg (regs, srcreg) = srca;
 	uae_s32 src = get_long(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+	SET_NZFLG (((uae_s32)(0)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(srca,0);
@@ -49080,8 +47351,7 @@ unsigned long REGPARAM2 CPUFUNC(op_42a8_5)(uae_u32 opcode) /* CLR */
 	}
 {	uae_s32 src = get_long(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+	SET_NZFLG (((uae_s32)(0)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(srca,0);
@@ -49103,8 +47373,7 @@ unsigned long REGPARAM2 CPUFUNC(op_42b0_5)(uae_u32 opcode) /* CLR */
 	}
 {	uae_s32 src = get_long(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+	SET_NZFLG (((uae_s32)(0)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(srca,0);
@@ -49124,8 +47393,7 @@ unsigned long REGPARAM2 CPUFUNC(op_42b8_5)(uae_u32 opcode) /* CLR */
 	}
 {	uae_s32 src = get_long(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+	SET_NZFLG (((uae_s32)(0)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(srca,0);
@@ -49145,8 +47413,7 @@ unsigned long REGPARAM2 CPUFUNC(op_42b9_5)(uae_u32 opcode) /* CLR */
 	}
 {	uae_s32 src = get_long(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+	SET_NZFLG (((uae_s32)(0)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(srca,0);
@@ -49163,11 +47430,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4400_5)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
+	SET_NZFLG (((uae_s8)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((dst) & 0xff);
 }}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -49184,11 +47450,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4410_5)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
+	SET_NZFLG (((uae_s8)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(srca,dst);
@@ -49206,11 +47471,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4418_5)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
+	SET_NZFLG (((uae_s8)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(srca,dst);
@@ -49228,11 +47492,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4420_5)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
+	SET_NZFLG (((uae_s8)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(srca,dst);
@@ -49249,11 +47512,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4428_5)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
+	SET_NZFLG (((uae_s8)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(srca,dst);
@@ -49271,11 +47533,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4430_5)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
+	SET_NZFLG (((uae_s8)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(srca,dst);
@@ -49291,11 +47552,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4438_5)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
+	SET_NZFLG (((uae_s8)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(srca,dst);
@@ -49311,11 +47571,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4439_5)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(0)) < 0;
 	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
+	SET_NZFLG (((uae_s8)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(srca,dst);
@@ -49331,11 +47590,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4440_5)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
+	SET_NZFLG (((uae_s16)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
 }}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -49359,11 +47617,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4450_5)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
+	SET_NZFLG (((uae_s16)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(srca,dst);
@@ -49389,11 +47646,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4458_5)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
+	SET_NZFLG (((uae_s16)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(srca,dst);
@@ -49419,11 +47675,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4460_5)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
+	SET_NZFLG (((uae_s16)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(srca,dst);
@@ -49448,11 +47703,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4468_5)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
+	SET_NZFLG (((uae_s16)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(srca,dst);
@@ -49478,11 +47732,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4470_5)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
+	SET_NZFLG (((uae_s16)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(srca,dst);
@@ -49506,11 +47759,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4478_5)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
+	SET_NZFLG (((uae_s16)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(srca,dst);
@@ -49534,11 +47786,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4479_5)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(0)) < 0;
 	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
+	SET_NZFLG (((uae_s16)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(srca,dst);
@@ -49555,11 +47806,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4480_5)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
+	SET_NZFLG (((uae_s32)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, srcreg) = (dst);
 }}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -49583,11 +47833,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4490_5)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
+	SET_NZFLG (((uae_s32)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(srca,dst);
@@ -49613,11 +47862,10 @@ unsigned long REGPARAM2 CPUFUNC(op_4498_5)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
+	SET_NZFLG (((uae_s32)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(srca,dst);
@@ -49643,11 +47891,10 @@ unsigned long REGPARAM2 CPUFUNC(op_44a0_5)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
+	SET_NZFLG (((uae_s32)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(srca,dst);
@@ -49672,11 +47919,10 @@ unsigned long REGPARAM2 CPUFUNC(op_44a8_5)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
+	SET_NZFLG (((uae_s32)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(srca,dst);
@@ -49702,11 +47948,10 @@ unsigned long REGPARAM2 CPUFUNC(op_44b0_5)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
+	SET_NZFLG (((uae_s32)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(srca,dst);
@@ -49730,11 +47975,10 @@ unsigned long REGPARAM2 CPUFUNC(op_44b8_5)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
+	SET_NZFLG (((uae_s32)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(srca,dst);
@@ -49758,11 +48002,10 @@ unsigned long REGPARAM2 CPUFUNC(op_44b9_5)(uae_u32 opcode) /* NEG */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(0)) < 0;
 	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
+	SET_NZFLG (((uae_s32)(dst)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(srca,dst);
@@ -50002,8 +48245,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4600_5)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	SET_NZFLG (((uae_s8)(dst)));
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((dst) & 0xff);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -50018,8 +48260,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4610_5)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	SET_NZFLG (((uae_s8)(dst)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(srca,dst);
@@ -50035,8 +48276,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4618_5)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	SET_NZFLG (((uae_s8)(dst)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(srca,dst);
@@ -50052,8 +48292,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4620_5)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	SET_NZFLG (((uae_s8)(dst)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(srca,dst);
@@ -50068,8 +48307,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4628_5)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	SET_NZFLG (((uae_s8)(dst)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(srca,dst);
@@ -50085,8 +48323,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4630_5)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	SET_NZFLG (((uae_s8)(dst)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(srca,dst);
@@ -50100,8 +48337,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4638_5)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	SET_NZFLG (((uae_s8)(dst)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(srca,dst);
@@ -50115,8 +48351,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4639_5)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	SET_NZFLG (((uae_s8)(dst)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(srca,dst);
@@ -50130,8 +48365,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4640_5)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	SET_NZFLG (((uae_s16)(dst)));
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -50153,8 +48387,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4650_5)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	SET_NZFLG (((uae_s16)(dst)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(srca,dst);
@@ -50178,8 +48411,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4658_5)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	SET_NZFLG (((uae_s16)(dst)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(srca,dst);
@@ -50203,8 +48435,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4660_5)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	SET_NZFLG (((uae_s16)(dst)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(srca,dst);
@@ -50227,8 +48458,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4668_5)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	SET_NZFLG (((uae_s16)(dst)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(srca,dst);
@@ -50252,8 +48482,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4670_5)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	SET_NZFLG (((uae_s16)(dst)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(srca,dst);
@@ -50275,8 +48504,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4678_5)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	SET_NZFLG (((uae_s16)(dst)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(srca,dst);
@@ -50298,8 +48526,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4679_5)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	SET_NZFLG (((uae_s16)(dst)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(srca,dst);
@@ -50314,8 +48541,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4680_5)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_NZFLG (((uae_s32)(dst)));
 	m68k_dreg(regs, srcreg) = (dst);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -50337,8 +48563,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4690_5)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_NZFLG (((uae_s32)(dst)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(srca,dst);
@@ -50362,8 +48587,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4698_5)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_NZFLG (((uae_s32)(dst)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(srca,dst);
@@ -50387,8 +48611,7 @@ unsigned long REGPARAM2 CPUFUNC(op_46a0_5)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_NZFLG (((uae_s32)(dst)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(srca,dst);
@@ -50411,8 +48634,7 @@ unsigned long REGPARAM2 CPUFUNC(op_46a8_5)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_NZFLG (((uae_s32)(dst)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(srca,dst);
@@ -50436,8 +48658,7 @@ unsigned long REGPARAM2 CPUFUNC(op_46b0_5)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_NZFLG (((uae_s32)(dst)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(srca,dst);
@@ -50459,8 +48680,7 @@ unsigned long REGPARAM2 CPUFUNC(op_46b8_5)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_NZFLG (((uae_s32)(dst)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(srca,dst);
@@ -50482,8 +48702,7 @@ unsigned long REGPARAM2 CPUFUNC(op_46b9_5)(uae_u32 opcode) /* NOT */
 {	refill_prefetch (m68k_getpc(), 2);
 	uae_u32 dst = ~src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_NZFLG (((uae_s32)(dst)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(srca,dst);
@@ -50889,8 +49108,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4840_5)(uae_u32 opcode) /* SWAP */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_u32 dst = ((src >> 16)&0xFFFF) | ((src&0xFFFF)<<16);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_NZFLG (((uae_s32)(dst)));
 	m68k_dreg(regs, srcreg) = (dst);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -51043,8 +49261,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4880_5)(uae_u32 opcode) /* EXT */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_u16 dst = (uae_s16)(uae_s8)src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	SET_NZFLG (((uae_s16)(dst)));
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -51195,8 +49412,7 @@ unsigned long REGPARAM2 CPUFUNC(op_48c0_5)(uae_u32 opcode) /* EXT */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_u32 dst = (uae_s32)(uae_s16)src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_NZFLG (((uae_s32)(dst)));
 	m68k_dreg(regs, srcreg) = (dst);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -51346,8 +49562,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a00_5)(uae_u32 opcode) /* TST */
 	OpcodeFamily = 20; CurrentInstrCycles = 4;  
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 }}m68k_incpc(2);
 fill_prefetch_2 ();
 return 4;
@@ -51359,8 +49574,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a10_5)(uae_u32 opcode) /* TST */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 8;
@@ -51373,8 +49587,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a18_5)(uae_u32 opcode) /* TST */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 8;
@@ -51387,8 +49600,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a20_5)(uae_u32 opcode) /* TST */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 10;
@@ -51400,8 +49612,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a28_5)(uae_u32 opcode) /* TST */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword_prefetch(2);
 {	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 }}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 12;
@@ -51414,8 +49625,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a30_5)(uae_u32 opcode) /* TST */
 	BusCyclePenalty += 2;
 {	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 }}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 14;
@@ -51426,8 +49636,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a38_5)(uae_u32 opcode) /* TST */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_prefetch(2);
 {	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 }}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 12;
@@ -51438,8 +49647,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a39_5)(uae_u32 opcode) /* TST */
 {{	uaecptr srca = get_ilong_prefetch(2);
 {	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 }}}m68k_incpc(6);
 fill_prefetch_0 ();
 return 16;
@@ -51451,8 +49659,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a3a_5)(uae_u32 opcode) /* TST */
 	srca += (uae_s32)(uae_s16)get_iword_prefetch(2);
 {	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 }}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 12;
@@ -51465,8 +49672,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a3b_5)(uae_u32 opcode) /* TST */
 	BusCyclePenalty += 2;
 {	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 }}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 14;
@@ -51476,8 +49682,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a3c_5)(uae_u32 opcode) /* TST */
 	OpcodeFamily = 20; CurrentInstrCycles = 8;  
 {{	uae_s8 src = get_ibyte_prefetch(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 }}m68k_incpc(4);
 fill_prefetch_0 ();
 return 8;
@@ -51488,8 +49693,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a40_5)(uae_u32 opcode) /* TST */
 	OpcodeFamily = 20; CurrentInstrCycles = 4;  
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 }}m68k_incpc(2);
 fill_prefetch_2 ();
 return 4;
@@ -51500,8 +49704,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a48_5)(uae_u32 opcode) /* TST */
 	OpcodeFamily = 20; CurrentInstrCycles = 4;  
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 }}m68k_incpc(2);
 fill_prefetch_2 ();
 return 4;
@@ -51520,8 +49723,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a50_5)(uae_u32 opcode) /* TST */
 	}
 {{	uae_s16 src = get_word(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel2896: ;
@@ -51542,8 +49744,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a58_5)(uae_u32 opcode) /* TST */
 {{	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel2897: ;
@@ -51564,8 +49765,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a60_5)(uae_u32 opcode) /* TST */
 {{	uae_s16 src = get_word(srca);
 	m68k_areg (regs, srcreg) = srca;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel2898: ;
@@ -51585,8 +49785,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a68_5)(uae_u32 opcode) /* TST */
 	}
 {{	uae_s16 src = get_word(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2899: ;
@@ -51607,8 +49806,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a70_5)(uae_u32 opcode) /* TST */
 	}
 {{	uae_s16 src = get_word(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2900: ;
@@ -51627,8 +49825,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a78_5)(uae_u32 opcode) /* TST */
 	}
 {{	uae_s16 src = get_word(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2901: ;
@@ -51647,8 +49844,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a79_5)(uae_u32 opcode) /* TST */
 	}
 {{	uae_s16 src = get_word(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 }}}}m68k_incpc(6);
 fill_prefetch_0 ();
 endlabel2902: ;
@@ -51668,8 +49864,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a7a_5)(uae_u32 opcode) /* TST */
 	}
 {{	uae_s16 src = get_word(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2903: ;
@@ -51690,8 +49885,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a7b_5)(uae_u32 opcode) /* TST */
 	}
 {{	uae_s16 src = get_word(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2904: ;
@@ -51702,8 +49896,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a7c_5)(uae_u32 opcode) /* TST */
 	OpcodeFamily = 20; CurrentInstrCycles = 8;  
 {{	uae_s16 src = get_iword_prefetch(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 }}m68k_incpc(4);
 fill_prefetch_0 ();
 return 8;
@@ -51714,8 +49907,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a80_5)(uae_u32 opcode) /* TST */
 	OpcodeFamily = 20; CurrentInstrCycles = 4;  
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 }}m68k_incpc(2);
 fill_prefetch_2 ();
 return 4;
@@ -51726,8 +49918,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a88_5)(uae_u32 opcode) /* TST */
 	OpcodeFamily = 20; CurrentInstrCycles = 4;  
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 }}m68k_incpc(2);
 fill_prefetch_2 ();
 return 4;
@@ -51746,8 +49937,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a90_5)(uae_u32 opcode) /* TST */
 	}
 {{	uae_s32 src = get_long(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel2908: ;
@@ -51768,8 +49958,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4a98_5)(uae_u32 opcode) /* TST */
 {{	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel2909: ;
@@ -51790,8 +49979,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4aa0_5)(uae_u32 opcode) /* TST */
 {{	uae_s32 src = get_long(srca);
 	m68k_areg (regs, srcreg) = srca;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel2910: ;
@@ -51811,8 +49999,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4aa8_5)(uae_u32 opcode) /* TST */
 	}
 {{	uae_s32 src = get_long(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2911: ;
@@ -51833,8 +50020,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4ab0_5)(uae_u32 opcode) /* TST */
 	}
 {{	uae_s32 src = get_long(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2912: ;
@@ -51853,8 +50039,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4ab8_5)(uae_u32 opcode) /* TST */
 	}
 {{	uae_s32 src = get_long(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2913: ;
@@ -51873,8 +50058,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4ab9_5)(uae_u32 opcode) /* TST */
 	}
 {{	uae_s32 src = get_long(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 }}}}m68k_incpc(6);
 fill_prefetch_0 ();
 endlabel2914: ;
@@ -51894,8 +50078,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4aba_5)(uae_u32 opcode) /* TST */
 	}
 {{	uae_s32 src = get_long(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2915: ;
@@ -51916,8 +50099,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4abb_5)(uae_u32 opcode) /* TST */
 	}
 {{	uae_s32 src = get_long(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel2916: ;
@@ -51928,8 +50110,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4abc_5)(uae_u32 opcode) /* TST */
 	OpcodeFamily = 20; CurrentInstrCycles = 12; 
 {{	uae_s32 src = get_ilong_prefetch(2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 }}m68k_incpc(6);
 fill_prefetch_0 ();
 return 12;
@@ -51940,8 +50121,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4ac0_5)(uae_u32 opcode) /* TAS */
 	OpcodeFamily = 98; CurrentInstrCycles = 4;  
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	src |= 0x80;
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((src) & 0xff);
 }}m68k_incpc(2);
@@ -51955,8 +50135,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4ad0_5)(uae_u32 opcode) /* TAS */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	src |= 0x80;
 m68k_incpc(2);
 fill_prefetch_2 ();
@@ -51971,8 +50150,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4ad8_5)(uae_u32 opcode) /* TAS */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	src |= 0x80;
 m68k_incpc(2);
 fill_prefetch_2 ();
@@ -51987,8 +50165,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4ae0_5)(uae_u32 opcode) /* TAS */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	src |= 0x80;
 m68k_incpc(2);
 fill_prefetch_2 ();
@@ -52002,8 +50179,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4ae8_5)(uae_u32 opcode) /* TAS */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword_prefetch(2);
 {	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	src |= 0x80;
 m68k_incpc(4);
 fill_prefetch_0 ();
@@ -52018,8 +50194,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4af0_5)(uae_u32 opcode) /* TAS */
 	BusCyclePenalty += 2;
 {	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	src |= 0x80;
 m68k_incpc(4);
 fill_prefetch_0 ();
@@ -52032,8 +50207,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4af8_5)(uae_u32 opcode) /* TAS */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword_prefetch(2);
 {	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	src |= 0x80;
 m68k_incpc(4);
 fill_prefetch_0 ();
@@ -52046,8 +50220,7 @@ unsigned long REGPARAM2 CPUFUNC(op_4af9_5)(uae_u32 opcode) /* TAS */
 {{	uaecptr srca = get_ilong_prefetch(2);
 {	uae_s8 src = get_byte(srca);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	src |= 0x80;
 m68k_incpc(6);
 fill_prefetch_0 ();
@@ -52864,11 +51037,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5000_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -52887,11 +51059,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5010_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(dsta,newv);
@@ -52911,11 +51082,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5018_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(dsta,newv);
@@ -52938,11 +51108,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5020_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(dsta,newv);
@@ -52961,11 +51130,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5028_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,newv);
@@ -52985,11 +51153,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5030_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,newv);
@@ -53007,11 +51174,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5038_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,newv);
@@ -53029,11 +51195,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5039_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,newv);
@@ -53051,11 +51216,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5040_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -53094,11 +51258,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5050_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(dsta,newv);
@@ -53126,11 +51289,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5058_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(dsta,newv);
@@ -53158,11 +51320,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5060_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(dsta,newv);
@@ -53189,11 +51350,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5068_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,newv);
@@ -53221,11 +51381,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5070_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,newv);
@@ -53251,11 +51410,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5078_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,newv);
@@ -53281,11 +51439,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5079_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,newv);
@@ -53304,11 +51461,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5080_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -53347,11 +51503,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5090_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(dsta,newv);
@@ -53379,11 +51534,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5098_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(dsta,newv);
@@ -53411,11 +51565,10 @@ unsigned long REGPARAM2 CPUFUNC(op_50a0_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(dsta,newv);
@@ -53442,11 +51595,10 @@ unsigned long REGPARAM2 CPUFUNC(op_50a8_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,newv);
@@ -53474,11 +51626,10 @@ unsigned long REGPARAM2 CPUFUNC(op_50b0_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,newv);
@@ -53504,11 +51655,10 @@ unsigned long REGPARAM2 CPUFUNC(op_50b8_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,newv);
@@ -53534,11 +51684,10 @@ unsigned long REGPARAM2 CPUFUNC(op_50b9_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,newv);
@@ -53674,11 +51823,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5100_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -53697,11 +51845,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5110_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(dsta,newv);
@@ -53721,11 +51868,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5118_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(dsta,newv);
@@ -53745,11 +51891,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5120_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(dsta,newv);
@@ -53768,11 +51913,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5128_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,newv);
@@ -53792,11 +51936,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5130_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,newv);
@@ -53814,11 +51957,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5138_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,newv);
@@ -53836,11 +51978,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5139_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,newv);
@@ -53858,11 +51999,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5140_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -53901,11 +52041,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5150_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(dsta,newv);
@@ -53933,11 +52072,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5158_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(dsta,newv);
@@ -53965,11 +52103,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5160_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(dsta,newv);
@@ -53996,11 +52133,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5168_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,newv);
@@ -54028,11 +52164,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5170_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,newv);
@@ -54058,11 +52193,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5178_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,newv);
@@ -54088,11 +52222,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5179_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,newv);
@@ -54111,11 +52244,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5180_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -54154,11 +52286,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5190_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(dsta,newv);
@@ -54186,11 +52317,10 @@ unsigned long REGPARAM2 CPUFUNC(op_5198_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(dsta,newv);
@@ -54218,11 +52348,10 @@ unsigned long REGPARAM2 CPUFUNC(op_51a0_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(dsta,newv);
@@ -54249,11 +52378,10 @@ unsigned long REGPARAM2 CPUFUNC(op_51a8_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,newv);
@@ -54281,11 +52409,10 @@ unsigned long REGPARAM2 CPUFUNC(op_51b0_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,newv);
@@ -54311,11 +52438,10 @@ unsigned long REGPARAM2 CPUFUNC(op_51b8_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,newv);
@@ -54341,11 +52467,10 @@ unsigned long REGPARAM2 CPUFUNC(op_51b9_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,newv);
@@ -57108,8 +55233,7 @@ unsigned long REGPARAM2 CPUFUNC(op_7000_5)(uae_u32 opcode) /* MOVE */
 	OpcodeFamily = 30; CurrentInstrCycles = 4;  
 {{	uae_u32 src = srcreg;
 {	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -57125,8 +55249,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8000_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -57143,8 +55266,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8010_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -57162,8 +55284,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8018_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -57181,8 +55302,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8020_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -57199,8 +55319,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8028_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -57218,8 +55337,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8030_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -57235,8 +55353,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8038_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -57252,8 +55369,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8039_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(6);
 fill_prefetch_0 ();
@@ -57270,8 +55386,7 @@ unsigned long REGPARAM2 CPUFUNC(op_803a_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -57289,8 +55404,7 @@ unsigned long REGPARAM2 CPUFUNC(op_803b_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -57305,8 +55419,7 @@ unsigned long REGPARAM2 CPUFUNC(op_803c_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -57322,8 +55435,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8040_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -57347,8 +55459,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8050_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -57374,8 +55485,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8058_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -57401,8 +55511,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8060_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -57427,8 +55536,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8068_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -57454,8 +55562,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8070_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -57479,8 +55586,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8078_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -57504,8 +55610,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8079_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(6);
 fill_prefetch_0 ();
@@ -57530,8 +55635,7 @@ unsigned long REGPARAM2 CPUFUNC(op_807a_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -57557,8 +55661,7 @@ unsigned long REGPARAM2 CPUFUNC(op_807b_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -57574,8 +55677,7 @@ unsigned long REGPARAM2 CPUFUNC(op_807c_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -57591,8 +55693,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8080_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -57616,8 +55717,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8090_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -57643,8 +55743,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8098_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -57670,8 +55769,7 @@ unsigned long REGPARAM2 CPUFUNC(op_80a0_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -57696,8 +55794,7 @@ unsigned long REGPARAM2 CPUFUNC(op_80a8_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -57723,8 +55820,7 @@ unsigned long REGPARAM2 CPUFUNC(op_80b0_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -57748,8 +55844,7 @@ unsigned long REGPARAM2 CPUFUNC(op_80b8_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -57773,8 +55868,7 @@ unsigned long REGPARAM2 CPUFUNC(op_80b9_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(6);
 fill_prefetch_0 ();
@@ -57799,8 +55893,7 @@ unsigned long REGPARAM2 CPUFUNC(op_80ba_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -57826,8 +55919,7 @@ unsigned long REGPARAM2 CPUFUNC(op_80bb_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -57843,8 +55935,7 @@ unsigned long REGPARAM2 CPUFUNC(op_80bc_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 fill_prefetch_0 ();
@@ -57867,8 +55958,7 @@ fill_prefetch_2 ();
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -57902,8 +55992,7 @@ fill_prefetch_2 ();
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -57938,8 +56027,7 @@ fill_prefetch_2 ();
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -57974,8 +56062,7 @@ fill_prefetch_2 ();
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -58009,8 +56096,7 @@ fill_prefetch_0 ();
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -58045,8 +56131,7 @@ fill_prefetch_0 ();
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -58079,8 +56164,7 @@ fill_prefetch_0 ();
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -58113,8 +56197,7 @@ fill_prefetch_0 ();
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -58148,8 +56231,7 @@ fill_prefetch_0 ();
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -58184,8 +56266,7 @@ fill_prefetch_0 ();
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -58210,8 +56291,7 @@ fill_prefetch_0 ();
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -58283,8 +56363,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8110_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(dsta,src);
@@ -58302,8 +56381,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8118_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(dsta,src);
@@ -58321,8 +56399,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8120_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(dsta,src);
@@ -58339,8 +56416,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8128_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -58358,8 +56434,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8130_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -58375,8 +56450,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8138_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -58392,8 +56466,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8139_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -58417,8 +56490,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8150_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(dsta,src);
@@ -58444,8 +56516,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8158_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(dsta,src);
@@ -58471,8 +56542,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8160_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(dsta,src);
@@ -58497,8 +56567,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8168_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -58524,8 +56593,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8170_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -58549,8 +56617,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8178_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -58574,8 +56641,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8179_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -58600,8 +56666,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8190_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(dsta,src);
@@ -58627,8 +56692,7 @@ unsigned long REGPARAM2 CPUFUNC(op_8198_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(dsta,src);
@@ -58654,8 +56718,7 @@ unsigned long REGPARAM2 CPUFUNC(op_81a0_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(dsta,src);
@@ -58680,8 +56743,7 @@ unsigned long REGPARAM2 CPUFUNC(op_81a8_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -58707,8 +56769,7 @@ unsigned long REGPARAM2 CPUFUNC(op_81b0_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -58732,8 +56793,7 @@ unsigned long REGPARAM2 CPUFUNC(op_81b8_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -58757,8 +56817,7 @@ unsigned long REGPARAM2 CPUFUNC(op_81b9_5)(uae_u32 opcode) /* OR */
 	src |= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -58783,8 +56842,7 @@ fill_prefetch_2 ();
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -58819,8 +56877,7 @@ fill_prefetch_2 ();
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -58856,8 +56913,7 @@ fill_prefetch_2 ();
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -58893,8 +56949,7 @@ fill_prefetch_2 ();
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -58929,8 +56984,7 @@ fill_prefetch_0 ();
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -58966,8 +57020,7 @@ fill_prefetch_0 ();
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -59001,8 +57054,7 @@ fill_prefetch_0 ();
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -59036,8 +57088,7 @@ fill_prefetch_0 ();
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -59072,8 +57123,7 @@ fill_prefetch_0 ();
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -59109,8 +57159,7 @@ fill_prefetch_0 ();
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -59136,8 +57185,7 @@ fill_prefetch_0 ();
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -59158,11 +57206,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9000_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -59181,11 +57228,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9010_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -59205,11 +57251,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9018_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -59229,11 +57274,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9020_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -59252,11 +57296,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9028_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -59276,11 +57319,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9030_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -59298,11 +57340,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9038_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -59320,11 +57361,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9039_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
@@ -59343,11 +57383,10 @@ unsigned long REGPARAM2 CPUFUNC(op_903a_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -59367,11 +57406,10 @@ unsigned long REGPARAM2 CPUFUNC(op_903b_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -59388,11 +57426,10 @@ unsigned long REGPARAM2 CPUFUNC(op_903c_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -59410,11 +57447,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9040_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -59432,11 +57468,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9048_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -59462,11 +57497,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9050_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -59494,11 +57528,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9058_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -59526,11 +57559,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9060_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -59557,11 +57589,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9068_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -59589,11 +57620,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9070_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -59619,11 +57649,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9078_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -59649,11 +57678,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9079_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
@@ -59680,11 +57708,10 @@ unsigned long REGPARAM2 CPUFUNC(op_907a_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -59712,11 +57739,10 @@ unsigned long REGPARAM2 CPUFUNC(op_907b_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -59734,11 +57760,10 @@ unsigned long REGPARAM2 CPUFUNC(op_907c_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -59756,11 +57781,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9080_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -59778,11 +57802,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9088_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -59808,11 +57831,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9090_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -59840,11 +57862,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9098_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -59872,11 +57893,10 @@ unsigned long REGPARAM2 CPUFUNC(op_90a0_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -59903,11 +57923,10 @@ unsigned long REGPARAM2 CPUFUNC(op_90a8_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -59935,11 +57954,10 @@ unsigned long REGPARAM2 CPUFUNC(op_90b0_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -59965,11 +57983,10 @@ unsigned long REGPARAM2 CPUFUNC(op_90b8_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -59995,11 +58012,10 @@ unsigned long REGPARAM2 CPUFUNC(op_90b9_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
@@ -60026,11 +58042,10 @@ unsigned long REGPARAM2 CPUFUNC(op_90ba_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -60058,11 +58073,10 @@ unsigned long REGPARAM2 CPUFUNC(op_90bb_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -60080,11 +58094,10 @@ unsigned long REGPARAM2 CPUFUNC(op_90bc_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
@@ -60387,11 +58400,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9110_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(dsta,newv);
@@ -60411,11 +58423,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9118_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(dsta,newv);
@@ -60435,11 +58446,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9120_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(dsta,newv);
@@ -60458,11 +58468,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9128_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,newv);
@@ -60482,11 +58491,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9130_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,newv);
@@ -60504,11 +58512,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9138_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,newv);
@@ -60526,11 +58533,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9139_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,newv);
@@ -60617,11 +58623,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9150_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(dsta,newv);
@@ -60649,11 +58654,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9158_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(dsta,newv);
@@ -60681,11 +58685,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9160_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(dsta,newv);
@@ -60712,11 +58715,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9168_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,newv);
@@ -60744,11 +58746,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9170_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,newv);
@@ -60774,11 +58775,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9178_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,newv);
@@ -60804,11 +58804,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9179_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,newv);
@@ -60896,11 +58895,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9190_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(dsta,newv);
@@ -60928,11 +58926,10 @@ unsigned long REGPARAM2 CPUFUNC(op_9198_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(dsta,newv);
@@ -60960,11 +58957,10 @@ unsigned long REGPARAM2 CPUFUNC(op_91a0_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(dsta,newv);
@@ -60991,11 +58987,10 @@ unsigned long REGPARAM2 CPUFUNC(op_91a8_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,newv);
@@ -61023,11 +59018,10 @@ unsigned long REGPARAM2 CPUFUNC(op_91b0_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,newv);
@@ -61053,11 +59047,10 @@ unsigned long REGPARAM2 CPUFUNC(op_91b8_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,newv);
@@ -61083,11 +59076,10 @@ unsigned long REGPARAM2 CPUFUNC(op_91b9_5)(uae_u32 opcode) /* SUB */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,newv);
@@ -61343,10 +59335,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b000_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 4;
@@ -61363,10 +59354,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b010_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 8;
@@ -61384,10 +59374,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b018_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 8;
@@ -61405,10 +59394,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b020_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 10;
@@ -61425,10 +59413,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b028_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 12;
@@ -61446,10 +59433,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b030_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 14;
@@ -61465,10 +59451,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b038_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 12;
@@ -61484,10 +59469,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b039_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 return 16;
@@ -61504,10 +59488,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b03a_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 12;
@@ -61525,10 +59508,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b03b_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 14;
@@ -61546,10 +59528,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b03c_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 8;
@@ -61565,10 +59546,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b040_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 4;
@@ -61584,10 +59564,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b048_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 4;
@@ -61611,10 +59590,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b050_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel3391: ;
@@ -61640,10 +59618,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b058_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel3392: ;
@@ -61669,10 +59646,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b060_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel3393: ;
@@ -61697,10 +59673,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b068_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel3394: ;
@@ -61726,10 +59701,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b070_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel3395: ;
@@ -61753,10 +59727,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b078_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel3396: ;
@@ -61780,10 +59753,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b079_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 endlabel3397: ;
@@ -61808,10 +59780,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b07a_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel3398: ;
@@ -61837,10 +59808,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b07b_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel3399: ;
@@ -61856,10 +59826,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b07c_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 8;
@@ -61875,10 +59844,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b080_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 6;
@@ -61894,10 +59862,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b088_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 6;
@@ -61921,10 +59888,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b090_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel3403: ;
@@ -61950,10 +59916,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b098_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel3404: ;
@@ -61979,10 +59944,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0a0_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel3405: ;
@@ -62007,10 +59971,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0a8_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel3406: ;
@@ -62036,10 +59999,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0b0_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel3407: ;
@@ -62063,10 +60025,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0b8_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel3408: ;
@@ -62090,10 +60051,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0b9_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 endlabel3409: ;
@@ -62118,10 +60078,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0ba_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel3410: ;
@@ -62147,10 +60106,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0bb_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel3411: ;
@@ -62166,10 +60124,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0bc_5)(uae_u32 opcode) /* CMP */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 return 14;
@@ -62185,10 +60142,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0c0_5)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 6;
@@ -62204,10 +60160,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0c8_5)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 6;
@@ -62231,10 +60186,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0d0_5)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel3415: ;
@@ -62260,10 +60214,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0d8_5)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel3416: ;
@@ -62289,10 +60242,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0e0_5)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel3417: ;
@@ -62317,10 +60269,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0e8_5)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel3418: ;
@@ -62346,10 +60297,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0f0_5)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel3419: ;
@@ -62373,10 +60323,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0f8_5)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel3420: ;
@@ -62400,10 +60349,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0f9_5)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 endlabel3421: ;
@@ -62428,10 +60376,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0fa_5)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel3422: ;
@@ -62457,10 +60404,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0fb_5)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel3423: ;
@@ -62476,10 +60422,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b0fc_5)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 return 10;
@@ -62494,8 +60439,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b100_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -62516,10 +60460,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b108_5)(uae_u32 opcode) /* CMPM */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 12;
@@ -62535,8 +60478,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b110_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(dsta,src);
@@ -62554,8 +60496,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b118_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(dsta,src);
@@ -62573,8 +60514,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b120_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(dsta,src);
@@ -62591,8 +60531,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b128_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -62610,8 +60549,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b130_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -62627,8 +60565,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b138_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -62644,8 +60581,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b139_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -62661,8 +60597,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b140_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -62697,10 +60632,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b148_5)(uae_u32 opcode) /* CMPM */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel3435: ;
@@ -62724,8 +60658,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b150_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(dsta,src);
@@ -62751,8 +60684,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b158_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(dsta,src);
@@ -62778,8 +60710,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b160_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(dsta,src);
@@ -62804,8 +60735,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b168_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -62831,8 +60761,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b170_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -62856,8 +60785,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b178_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -62881,8 +60809,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b179_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -62899,8 +60826,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b180_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -62935,10 +60861,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b188_5)(uae_u32 opcode) /* CMPM */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel3444: ;
@@ -62962,8 +60887,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b190_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(dsta,src);
@@ -62989,8 +60913,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b198_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(dsta,src);
@@ -63016,8 +60939,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b1a0_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(dsta,src);
@@ -63042,8 +60964,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b1a8_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -63069,8 +60990,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b1b0_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -63094,8 +61014,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b1b8_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -63119,8 +61038,7 @@ unsigned long REGPARAM2 CPUFUNC(op_b1b9_5)(uae_u32 opcode) /* EOR */
 	src ^= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -63138,10 +61056,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b1c0_5)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 6;
@@ -63157,10 +61074,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b1c8_5)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 return 6;
@@ -63184,10 +61100,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b1d0_5)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel3454: ;
@@ -63213,10 +61128,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b1d8_5)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel3455: ;
@@ -63242,10 +61156,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b1e0_5)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
 endlabel3456: ;
@@ -63270,10 +61183,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b1e8_5)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel3457: ;
@@ -63299,10 +61211,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b1f0_5)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel3458: ;
@@ -63326,10 +61237,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b1f8_5)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel3459: ;
@@ -63353,10 +61263,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b1f9_5)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 endlabel3460: ;
@@ -63381,10 +61290,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b1fa_5)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel3461: ;
@@ -63410,10 +61318,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b1fb_5)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
 endlabel3462: ;
@@ -63429,10 +61336,9 @@ unsigned long REGPARAM2 CPUFUNC(op_b1fc_5)(uae_u32 opcode) /* CMPA */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs != flgo) && (flgn != flgo));
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
 }}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
 return 14;
@@ -63447,8 +61353,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c000_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -63465,8 +61370,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c010_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -63484,8 +61388,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c018_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -63503,8 +61406,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c020_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -63521,8 +61423,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c028_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -63540,8 +61441,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c030_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -63557,8 +61457,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c038_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -63574,8 +61473,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c039_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(6);
 fill_prefetch_0 ();
@@ -63592,8 +61490,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c03a_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -63611,8 +61508,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c03b_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -63627,8 +61523,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c03c_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -63644,8 +61539,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c040_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -63669,8 +61563,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c050_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -63696,8 +61589,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c058_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -63723,8 +61615,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c060_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -63749,8 +61640,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c068_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -63776,8 +61666,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c070_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -63801,8 +61690,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c078_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -63826,8 +61714,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c079_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(6);
 fill_prefetch_0 ();
@@ -63852,8 +61739,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c07a_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -63879,8 +61765,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c07b_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -63896,8 +61781,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c07c_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -63913,8 +61797,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c080_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -63938,8 +61821,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c090_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -63965,8 +61847,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c098_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -63992,8 +61873,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0a0_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -64018,8 +61898,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0a8_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -64045,8 +61924,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0b0_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -64070,8 +61948,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0b8_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -64095,8 +61972,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0b9_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(6);
 fill_prefetch_0 ();
@@ -64121,8 +61997,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0ba_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -64148,8 +62023,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0bb_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -64165,8 +62039,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0bc_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 fill_prefetch_0 ();
@@ -64182,8 +62055,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0c0_5)(uae_u32 opcode) /* MULU */
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
 }}}}m68k_incpc(2);
@@ -64208,8 +62080,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0d0_5)(uae_u32 opcode) /* MULU */
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
 }}}}}}m68k_incpc(2);
@@ -64236,8 +62107,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0d8_5)(uae_u32 opcode) /* MULU */
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
 }}}}}}m68k_incpc(2);
@@ -64264,8 +62134,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0e0_5)(uae_u32 opcode) /* MULU */
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
 }}}}}}m68k_incpc(2);
@@ -64291,8 +62160,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0e8_5)(uae_u32 opcode) /* MULU */
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
 }}}}}}m68k_incpc(4);
@@ -64319,8 +62187,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0f0_5)(uae_u32 opcode) /* MULU */
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
 }}}}}}m68k_incpc(4);
@@ -64345,8 +62212,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0f8_5)(uae_u32 opcode) /* MULU */
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
 }}}}}}m68k_incpc(4);
@@ -64371,8 +62237,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0f9_5)(uae_u32 opcode) /* MULU */
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
 }}}}}}m68k_incpc(6);
@@ -64398,8 +62263,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0fa_5)(uae_u32 opcode) /* MULU */
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
 }}}}}}m68k_incpc(4);
@@ -64426,8 +62290,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0fb_5)(uae_u32 opcode) /* MULU */
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
 }}}}}}m68k_incpc(4);
@@ -64444,8 +62307,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c0fc_5)(uae_u32 opcode) /* MULU */
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	while (src) { if (src & 1) retcycles++; src = (uae_u16)src >> 1; }
 }}}}m68k_incpc(4);
@@ -64515,8 +62377,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c110_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(dsta,src);
@@ -64534,8 +62395,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c118_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(dsta,src);
@@ -64553,8 +62413,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c120_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(dsta,src);
@@ -64571,8 +62430,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c128_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -64590,8 +62448,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c130_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -64607,8 +62464,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c138_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -64624,8 +62480,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c139_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_NZFLG (((uae_s8)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,src);
@@ -64675,8 +62530,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c150_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(dsta,src);
@@ -64702,8 +62556,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c158_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(dsta,src);
@@ -64729,8 +62582,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c160_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(dsta,src);
@@ -64755,8 +62607,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c168_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -64782,8 +62633,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c170_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -64807,8 +62657,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c178_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -64832,8 +62681,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c179_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_NZFLG (((uae_s16)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,src);
@@ -64871,8 +62719,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c190_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(dsta,src);
@@ -64898,8 +62745,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c198_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(dsta,src);
@@ -64925,8 +62771,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1a0_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(dsta,src);
@@ -64951,8 +62796,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1a8_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -64978,8 +62822,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1b0_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -65003,8 +62846,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1b8_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -65028,8 +62870,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1b9_5)(uae_u32 opcode) /* AND */
 	src &= dst;
 	refill_prefetch (m68k_getpc(), 2);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_NZFLG (((uae_s32)(src)));
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,src);
@@ -65047,8 +62888,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1c0_5)(uae_u32 opcode) /* MULS */
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
 	uae_u32 src2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -65075,8 +62915,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1d0_5)(uae_u32 opcode) /* MULS */
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
 	uae_u32 src2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -65105,8 +62944,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1d8_5)(uae_u32 opcode) /* MULS */
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
 	uae_u32 src2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -65135,8 +62973,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1e0_5)(uae_u32 opcode) /* MULS */
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
 	uae_u32 src2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -65164,8 +63001,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1e8_5)(uae_u32 opcode) /* MULS */
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
 	uae_u32 src2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -65194,8 +63030,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1f0_5)(uae_u32 opcode) /* MULS */
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
 	uae_u32 src2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -65222,8 +63057,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1f8_5)(uae_u32 opcode) /* MULS */
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
 	uae_u32 src2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -65250,8 +63084,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1f9_5)(uae_u32 opcode) /* MULS */
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
 	uae_u32 src2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -65279,8 +63112,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1fa_5)(uae_u32 opcode) /* MULS */
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
 	uae_u32 src2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -65309,8 +63141,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1fb_5)(uae_u32 opcode) /* MULS */
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
 	uae_u32 src2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -65329,8 +63160,7 @@ unsigned long REGPARAM2 CPUFUNC(op_c1fc_5)(uae_u32 opcode) /* MULS */
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
 	uae_u32 src2;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	m68k_dreg(regs, dstreg) = (newv);
 	src2 = ((uae_u32)src) << 1;
 	while (src2) { if ( ( (src2 & 3) == 1 ) || ( (src2 & 3) == 2 ) ) retcycles++; src2 >>= 1; }
@@ -65350,11 +63180,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d000_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -65373,11 +63202,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d010_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -65397,11 +63225,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d018_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -65421,11 +63248,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d020_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -65444,11 +63270,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d028_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -65468,11 +63293,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d030_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -65490,11 +63314,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d038_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -65512,11 +63335,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d039_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
@@ -65535,11 +63357,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d03a_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -65559,11 +63380,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d03b_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -65580,11 +63400,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d03c_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
 }}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -65602,11 +63421,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d040_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -65624,11 +63442,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d048_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -65654,11 +63471,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d050_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -65686,11 +63502,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d058_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -65718,11 +63533,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d060_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -65749,11 +63563,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d068_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -65781,11 +63594,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d070_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -65811,11 +63623,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d078_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -65841,11 +63652,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d079_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
@@ -65872,11 +63682,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d07a_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -65904,11 +63713,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d07b_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -65926,11 +63734,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d07c_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
 }}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -65948,11 +63755,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d080_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -65970,11 +63776,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d088_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -66000,11 +63805,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d090_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -66032,11 +63836,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d098_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -66064,11 +63867,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d0a0_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -66095,11 +63897,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d0a8_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -66127,11 +63928,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d0b0_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -66157,11 +63957,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d0b8_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -66187,11 +63986,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d0b9_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
@@ -66218,11 +64016,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d0ba_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -66250,11 +64047,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d0bb_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}}}m68k_incpc(4);
 fill_prefetch_0 ();
@@ -66272,11 +64068,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d0bc_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}m68k_incpc(6);
 fill_prefetch_0 ();
@@ -66579,11 +64374,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d110_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(dsta,newv);
@@ -66603,11 +64397,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d118_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(dsta,newv);
@@ -66627,11 +64420,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d120_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_byte(dsta,newv);
@@ -66650,11 +64442,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d128_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,newv);
@@ -66674,11 +64465,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d130_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,newv);
@@ -66696,11 +64486,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d138_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_byte(dsta,newv);
@@ -66718,11 +64507,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d139_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s8)(src)) < 0;
 	int flgo = ((uae_s8)(dst)) < 0;
 	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_NZFLG (((uae_s8)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_byte(dsta,newv);
@@ -66809,11 +64597,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d150_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(dsta,newv);
@@ -66841,11 +64628,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d158_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(dsta,newv);
@@ -66873,11 +64659,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d160_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_word(dsta,newv);
@@ -66904,11 +64689,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d168_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,newv);
@@ -66936,11 +64720,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d170_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,newv);
@@ -66966,11 +64749,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d178_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_word(dsta,newv);
@@ -66996,11 +64778,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d179_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s16)(src)) < 0;
 	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NZFLG (((uae_s16)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_word(dsta,newv);
@@ -67088,11 +64869,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d190_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(dsta,newv);
@@ -67120,11 +64900,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d198_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(dsta,newv);
@@ -67152,11 +64931,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d1a0_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(2);
 fill_prefetch_2 ();
 	put_long(dsta,newv);
@@ -67183,11 +64961,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d1a8_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,newv);
@@ -67215,11 +64992,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d1b0_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,newv);
@@ -67245,11 +65021,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d1b8_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(4);
 fill_prefetch_0 ();
 	put_long(dsta,newv);
@@ -67275,11 +65050,10 @@ unsigned long REGPARAM2 CPUFUNC(op_d1b9_5)(uae_u32 opcode) /* ADD */
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NZFLG (((uae_s32)(newv)));
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
 m68k_incpc(6);
 fill_prefetch_0 ();
 	put_long(dsta,newv);
@@ -67552,8 +65326,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e000_5)(uae_u32 opcode) /* ASR */
 		val |= (0xff << (8 - cnt)) & (uae_u32)-sign;
 		val &= 0xff;
 	}
-	SET_ZFLG (((uae_s8)(val)) == 0);
-	SET_NFLG (((uae_s8)(val)) < 0);
+	SET_NZFLG (((uae_s8)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -67581,8 +65354,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e008_5)(uae_u32 opcode) /* LSR */
 	COPY_CARRY;
 		val >>= 1;
 	}
-	SET_ZFLG (((uae_s8)(val)) == 0);
-	SET_NFLG (((uae_s8)(val)) < 0);
+	SET_NZFLG (((uae_s8)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -67613,8 +65385,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e010_5)(uae_u32 opcode) /* ROXR */
 	val &= 0xff;
 	} }
 	SET_CFLG (GET_XFLG);
-	SET_ZFLG (((uae_s8)(val)) == 0);
-	SET_NFLG (((uae_s8)(val)) < 0);
+	SET_NZFLG (((uae_s8)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -67640,8 +65411,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e018_5)(uae_u32 opcode) /* ROR */
 	val &= 0xff;
 	SET_CFLG ((val & 0x80) >> 7);
 	}
-	SET_ZFLG (((uae_s8)(val)) == 0);
-	SET_NFLG (((uae_s8)(val)) < 0);
+	SET_NZFLG (((uae_s8)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -67672,8 +65442,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e020_5)(uae_u32 opcode) /* ASR */
 		val |= (0xff << (8 - cnt)) & (uae_u32)-sign;
 		val &= 0xff;
 	}
-	SET_ZFLG (((uae_s8)(val)) == 0);
-	SET_NFLG (((uae_s8)(val)) < 0);
+	SET_NZFLG (((uae_s8)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -67701,8 +65470,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e028_5)(uae_u32 opcode) /* LSR */
 	COPY_CARRY;
 		val >>= 1;
 	}
-	SET_ZFLG (((uae_s8)(val)) == 0);
-	SET_NFLG (((uae_s8)(val)) < 0);
+	SET_NZFLG (((uae_s8)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -67737,8 +65505,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e030_5)(uae_u32 opcode) /* ROXR */
 	val &= 0xff;
 	} }
 	SET_CFLG (GET_XFLG);
-	SET_ZFLG (((uae_s8)(val)) == 0);
-	SET_NFLG (((uae_s8)(val)) < 0);
+	SET_NZFLG (((uae_s8)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -67764,8 +65531,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e038_5)(uae_u32 opcode) /* ROR */
 	val &= 0xff;
 	SET_CFLG ((val & 0x80) >> 7);
 	}
-	SET_ZFLG (((uae_s8)(val)) == 0);
-	SET_NFLG (((uae_s8)(val)) < 0);
+	SET_NZFLG (((uae_s8)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -67796,8 +65562,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e040_5)(uae_u32 opcode) /* ASR */
 		val |= (0xffff << (16 - cnt)) & (uae_u32)-sign;
 		val &= 0xffff;
 	}
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -67825,8 +65590,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e048_5)(uae_u32 opcode) /* LSR */
 	COPY_CARRY;
 		val >>= 1;
 	}
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -67857,8 +65621,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e050_5)(uae_u32 opcode) /* ROXR */
 	val &= 0xffff;
 	} }
 	SET_CFLG (GET_XFLG);
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -67884,8 +65647,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e058_5)(uae_u32 opcode) /* ROR */
 	val &= 0xffff;
 	SET_CFLG ((val & 0x8000) >> 15);
 	}
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -67916,8 +65678,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e060_5)(uae_u32 opcode) /* ASR */
 		val |= (0xffff << (16 - cnt)) & (uae_u32)-sign;
 		val &= 0xffff;
 	}
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -67945,8 +65706,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e068_5)(uae_u32 opcode) /* LSR */
 	COPY_CARRY;
 		val >>= 1;
 	}
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -67980,8 +65740,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e070_5)(uae_u32 opcode) /* ROXR */
 	val &= 0xffff;
 	} }
 	SET_CFLG (GET_XFLG);
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -68007,8 +65766,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e078_5)(uae_u32 opcode) /* ROR */
 	val &= 0xffff;
 	SET_CFLG ((val & 0x8000) >> 15);
 	}
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -68039,8 +65797,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e080_5)(uae_u32 opcode) /* ASR */
 		val |= (0xffffffff << (32 - cnt)) & (uae_u32)-sign;
 		val &= 0xffffffff;
 	}
-	SET_ZFLG (((uae_s32)(val)) == 0);
-	SET_NFLG (((uae_s32)(val)) < 0);
+	SET_NZFLG (((uae_s32)(val)));
 	m68k_dreg(regs, dstreg) = (val);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -68068,8 +65825,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e088_5)(uae_u32 opcode) /* LSR */
 	COPY_CARRY;
 		val >>= 1;
 	}
-	SET_ZFLG (((uae_s32)(val)) == 0);
-	SET_NFLG (((uae_s32)(val)) < 0);
+	SET_NZFLG (((uae_s32)(val)));
 	m68k_dreg(regs, dstreg) = (val);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -68100,8 +65856,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e090_5)(uae_u32 opcode) /* ROXR */
 	val &= 0xffffffff;
 	} }
 	SET_CFLG (GET_XFLG);
-	SET_ZFLG (((uae_s32)(val)) == 0);
-	SET_NFLG (((uae_s32)(val)) < 0);
+	SET_NZFLG (((uae_s32)(val)));
 	m68k_dreg(regs, dstreg) = (val);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -68127,8 +65882,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e098_5)(uae_u32 opcode) /* ROR */
 	val &= 0xffffffff;
 	SET_CFLG ((val & 0x80000000) >> 31);
 	}
-	SET_ZFLG (((uae_s32)(val)) == 0);
-	SET_NFLG (((uae_s32)(val)) < 0);
+	SET_NZFLG (((uae_s32)(val)));
 	m68k_dreg(regs, dstreg) = (val);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -68159,8 +65913,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e0a0_5)(uae_u32 opcode) /* ASR */
 		val |= (0xffffffff << (32 - cnt)) & (uae_u32)-sign;
 		val &= 0xffffffff;
 	}
-	SET_ZFLG (((uae_s32)(val)) == 0);
-	SET_NFLG (((uae_s32)(val)) < 0);
+	SET_NZFLG (((uae_s32)(val)));
 	m68k_dreg(regs, dstreg) = (val);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -68188,8 +65941,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e0a8_5)(uae_u32 opcode) /* LSR */
 	COPY_CARRY;
 		val >>= 1;
 	}
-	SET_ZFLG (((uae_s32)(val)) == 0);
-	SET_NFLG (((uae_s32)(val)) < 0);
+	SET_NZFLG (((uae_s32)(val)));
 	m68k_dreg(regs, dstreg) = (val);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -68222,8 +65974,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e0b0_5)(uae_u32 opcode) /* ROXR */
 	val &= 0xffffffff;
 	} }
 	SET_CFLG (GET_XFLG);
-	SET_ZFLG (((uae_s32)(val)) == 0);
-	SET_NFLG (((uae_s32)(val)) < 0);
+	SET_NZFLG (((uae_s32)(val)));
 	m68k_dreg(regs, dstreg) = (val);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -68249,8 +66000,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e0b8_5)(uae_u32 opcode) /* ROR */
 	val &= 0xffffffff;
 	SET_CFLG ((val & 0x80000000) >> 31);
 	}
-	SET_ZFLG (((uae_s32)(val)) == 0);
-	SET_NFLG (((uae_s32)(val)) < 0);
+	SET_NZFLG (((uae_s32)(val)));
 	m68k_dreg(regs, dstreg) = (val);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -68274,8 +66024,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e0d0_5)(uae_u32 opcode) /* ASRW */
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	SET_CFLG (cflg);
 	COPY_CARRY;
 m68k_incpc(2);
@@ -68303,8 +66052,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e0d8_5)(uae_u32 opcode) /* ASRW */
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	SET_CFLG (cflg);
 	COPY_CARRY;
 m68k_incpc(2);
@@ -68332,8 +66080,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e0e0_5)(uae_u32 opcode) /* ASRW */
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	SET_CFLG (cflg);
 	COPY_CARRY;
 m68k_incpc(2);
@@ -68360,8 +66107,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e0e8_5)(uae_u32 opcode) /* ASRW */
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	SET_CFLG (cflg);
 	COPY_CARRY;
 m68k_incpc(4);
@@ -68389,8 +66135,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e0f0_5)(uae_u32 opcode) /* ASRW */
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	SET_CFLG (cflg);
 	COPY_CARRY;
 m68k_incpc(4);
@@ -68416,8 +66161,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e0f8_5)(uae_u32 opcode) /* ASRW */
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	SET_CFLG (cflg);
 	COPY_CARRY;
 m68k_incpc(4);
@@ -68443,8 +66187,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e0f9_5)(uae_u32 opcode) /* ASRW */
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	SET_CFLG (cflg);
 	COPY_CARRY;
 m68k_incpc(6);
@@ -68479,8 +66222,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e100_5)(uae_u32 opcode) /* ASL */
 		val <<= 1;
 		val &= 0xff;
 	}
-	SET_ZFLG (((uae_s8)(val)) == 0);
-	SET_NFLG (((uae_s8)(val)) < 0);
+	SET_NZFLG (((uae_s8)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -68509,8 +66251,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e108_5)(uae_u32 opcode) /* LSL */
 		val <<= 1;
 	val &= 0xff;
 	}
-	SET_ZFLG (((uae_s8)(val)) == 0);
-	SET_NFLG (((uae_s8)(val)) < 0);
+	SET_NZFLG (((uae_s8)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -68538,8 +66279,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e110_5)(uae_u32 opcode) /* ROXL */
 	val &= 0xff;
 	} }
 	SET_CFLG (GET_XFLG);
-	SET_ZFLG (((uae_s8)(val)) == 0);
-	SET_NFLG (((uae_s8)(val)) < 0);
+	SET_NZFLG (((uae_s8)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -68565,8 +66305,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e118_5)(uae_u32 opcode) /* ROL */
 	val &= 0xff;
 	SET_CFLG (val & 1);
 }
-	SET_ZFLG (((uae_s8)(val)) == 0);
-	SET_NFLG (((uae_s8)(val)) < 0);
+	SET_NZFLG (((uae_s8)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -68598,8 +66337,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e120_5)(uae_u32 opcode) /* ASL */
 		val <<= 1;
 		val &= 0xff;
 	}
-	SET_ZFLG (((uae_s8)(val)) == 0);
-	SET_NFLG (((uae_s8)(val)) < 0);
+	SET_NZFLG (((uae_s8)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -68628,8 +66366,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e128_5)(uae_u32 opcode) /* LSL */
 		val <<= 1;
 	val &= 0xff;
 	}
-	SET_ZFLG (((uae_s8)(val)) == 0);
-	SET_NFLG (((uae_s8)(val)) < 0);
+	SET_NZFLG (((uae_s8)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -68661,8 +66398,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e130_5)(uae_u32 opcode) /* ROXL */
 	val &= 0xff;
 	} }
 	SET_CFLG (GET_XFLG);
-	SET_ZFLG (((uae_s8)(val)) == 0);
-	SET_NFLG (((uae_s8)(val)) < 0);
+	SET_NZFLG (((uae_s8)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -68689,8 +66425,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e138_5)(uae_u32 opcode) /* ROL */
 	val &= 0xff;
 	SET_CFLG (val & 1);
 }
-	SET_ZFLG (((uae_s8)(val)) == 0);
-	SET_NFLG (((uae_s8)(val)) < 0);
+	SET_NZFLG (((uae_s8)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -68722,8 +66457,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e140_5)(uae_u32 opcode) /* ASL */
 		val <<= 1;
 		val &= 0xffff;
 	}
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -68752,8 +66486,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e148_5)(uae_u32 opcode) /* LSL */
 		val <<= 1;
 	val &= 0xffff;
 	}
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -68781,8 +66514,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e150_5)(uae_u32 opcode) /* ROXL */
 	val &= 0xffff;
 	} }
 	SET_CFLG (GET_XFLG);
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -68808,8 +66540,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e158_5)(uae_u32 opcode) /* ROL */
 	val &= 0xffff;
 	SET_CFLG (val & 1);
 }
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -68841,8 +66572,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e160_5)(uae_u32 opcode) /* ASL */
 		val <<= 1;
 		val &= 0xffff;
 	}
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -68871,8 +66601,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e168_5)(uae_u32 opcode) /* LSL */
 		val <<= 1;
 	val &= 0xffff;
 	}
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -68903,8 +66632,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e170_5)(uae_u32 opcode) /* ROXL */
 	val &= 0xffff;
 	} }
 	SET_CFLG (GET_XFLG);
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -68931,8 +66659,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e178_5)(uae_u32 opcode) /* ROL */
 	val &= 0xffff;
 	SET_CFLG (val & 1);
 }
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -68964,8 +66691,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e180_5)(uae_u32 opcode) /* ASL */
 		val <<= 1;
 		val &= 0xffffffff;
 	}
-	SET_ZFLG (((uae_s32)(val)) == 0);
-	SET_NFLG (((uae_s32)(val)) < 0);
+	SET_NZFLG (((uae_s32)(val)));
 	m68k_dreg(regs, dstreg) = (val);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -68994,8 +66720,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e188_5)(uae_u32 opcode) /* LSL */
 		val <<= 1;
 	val &= 0xffffffff;
 	}
-	SET_ZFLG (((uae_s32)(val)) == 0);
-	SET_NFLG (((uae_s32)(val)) < 0);
+	SET_NZFLG (((uae_s32)(val)));
 	m68k_dreg(regs, dstreg) = (val);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -69023,8 +66748,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e190_5)(uae_u32 opcode) /* ROXL */
 	val &= 0xffffffff;
 	} }
 	SET_CFLG (GET_XFLG);
-	SET_ZFLG (((uae_s32)(val)) == 0);
-	SET_NFLG (((uae_s32)(val)) < 0);
+	SET_NZFLG (((uae_s32)(val)));
 	m68k_dreg(regs, dstreg) = (val);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -69050,8 +66774,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e198_5)(uae_u32 opcode) /* ROL */
 	val &= 0xffffffff;
 	SET_CFLG (val & 1);
 }
-	SET_ZFLG (((uae_s32)(val)) == 0);
-	SET_NFLG (((uae_s32)(val)) < 0);
+	SET_NZFLG (((uae_s32)(val)));
 	m68k_dreg(regs, dstreg) = (val);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -69083,8 +66806,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e1a0_5)(uae_u32 opcode) /* ASL */
 		val <<= 1;
 		val &= 0xffffffff;
 	}
-	SET_ZFLG (((uae_s32)(val)) == 0);
-	SET_NFLG (((uae_s32)(val)) < 0);
+	SET_NZFLG (((uae_s32)(val)));
 	m68k_dreg(regs, dstreg) = (val);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -69113,8 +66835,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e1a8_5)(uae_u32 opcode) /* LSL */
 		val <<= 1;
 	val &= 0xffffffff;
 	}
-	SET_ZFLG (((uae_s32)(val)) == 0);
-	SET_NFLG (((uae_s32)(val)) < 0);
+	SET_NZFLG (((uae_s32)(val)));
 	m68k_dreg(regs, dstreg) = (val);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -69144,8 +66865,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e1b0_5)(uae_u32 opcode) /* ROXL */
 	val &= 0xffffffff;
 	} }
 	SET_CFLG (GET_XFLG);
-	SET_ZFLG (((uae_s32)(val)) == 0);
-	SET_NFLG (((uae_s32)(val)) < 0);
+	SET_NZFLG (((uae_s32)(val)));
 	m68k_dreg(regs, dstreg) = (val);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -69172,8 +66892,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e1b8_5)(uae_u32 opcode) /* ROL */
 	val &= 0xffffffff;
 	SET_CFLG (val & 1);
 }
-	SET_ZFLG (((uae_s32)(val)) == 0);
-	SET_NFLG (((uae_s32)(val)) < 0);
+	SET_NZFLG (((uae_s32)(val)));
 	m68k_dreg(regs, dstreg) = (val);
 }}}}m68k_incpc(2);
 fill_prefetch_2 ();
@@ -69197,8 +66916,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e1d0_5)(uae_u32 opcode) /* ASLW */
 	uae_u32 sign2;
 	val <<= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -69228,8 +66946,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e1d8_5)(uae_u32 opcode) /* ASLW */
 	uae_u32 sign2;
 	val <<= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -69259,8 +66976,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e1e0_5)(uae_u32 opcode) /* ASLW */
 	uae_u32 sign2;
 	val <<= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -69289,8 +67005,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e1e8_5)(uae_u32 opcode) /* ASLW */
 	uae_u32 sign2;
 	val <<= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -69320,8 +67035,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e1f0_5)(uae_u32 opcode) /* ASLW */
 	uae_u32 sign2;
 	val <<= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -69349,8 +67063,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e1f8_5)(uae_u32 opcode) /* ASLW */
 	uae_u32 sign2;
 	val <<= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -69378,8 +67091,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e1f9_5)(uae_u32 opcode) /* ASLW */
 	uae_u32 sign2;
 	val <<= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -69407,8 +67119,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e2d0_5)(uae_u32 opcode) /* LSRW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 	COPY_CARRY;
 m68k_incpc(2);
@@ -69435,8 +67146,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e2d8_5)(uae_u32 opcode) /* LSRW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 	COPY_CARRY;
 m68k_incpc(2);
@@ -69463,8 +67173,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e2e0_5)(uae_u32 opcode) /* LSRW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 	COPY_CARRY;
 m68k_incpc(2);
@@ -69490,8 +67199,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e2e8_5)(uae_u32 opcode) /* LSRW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 	COPY_CARRY;
 m68k_incpc(4);
@@ -69518,8 +67226,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e2f0_5)(uae_u32 opcode) /* LSRW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 	COPY_CARRY;
 m68k_incpc(4);
@@ -69544,8 +67251,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e2f8_5)(uae_u32 opcode) /* LSRW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 	COPY_CARRY;
 m68k_incpc(4);
@@ -69570,8 +67276,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e2f9_5)(uae_u32 opcode) /* LSRW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 	COPY_CARRY;
 m68k_incpc(6);
@@ -69597,8 +67302,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e3d0_5)(uae_u32 opcode) /* LSLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 m68k_incpc(2);
@@ -69625,8 +67329,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e3d8_5)(uae_u32 opcode) /* LSLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 m68k_incpc(2);
@@ -69653,8 +67356,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e3e0_5)(uae_u32 opcode) /* LSLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 m68k_incpc(2);
@@ -69680,8 +67382,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e3e8_5)(uae_u32 opcode) /* LSLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 m68k_incpc(4);
@@ -69708,8 +67409,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e3f0_5)(uae_u32 opcode) /* LSLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 m68k_incpc(4);
@@ -69734,8 +67434,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e3f8_5)(uae_u32 opcode) /* LSLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 m68k_incpc(4);
@@ -69760,8 +67459,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e3f9_5)(uae_u32 opcode) /* LSLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 m68k_incpc(6);
@@ -69788,8 +67486,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e4d0_5)(uae_u32 opcode) /* ROXRW */
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 	COPY_CARRY;
 m68k_incpc(2);
@@ -69817,8 +67514,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e4d8_5)(uae_u32 opcode) /* ROXRW */
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 	COPY_CARRY;
 m68k_incpc(2);
@@ -69846,8 +67542,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e4e0_5)(uae_u32 opcode) /* ROXRW */
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 	COPY_CARRY;
 m68k_incpc(2);
@@ -69874,8 +67569,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e4e8_5)(uae_u32 opcode) /* ROXRW */
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 	COPY_CARRY;
 m68k_incpc(4);
@@ -69903,8 +67597,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e4f0_5)(uae_u32 opcode) /* ROXRW */
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 	COPY_CARRY;
 m68k_incpc(4);
@@ -69930,8 +67623,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e4f8_5)(uae_u32 opcode) /* ROXRW */
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 	COPY_CARRY;
 m68k_incpc(4);
@@ -69957,8 +67649,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e4f9_5)(uae_u32 opcode) /* ROXRW */
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 	COPY_CARRY;
 m68k_incpc(6);
@@ -69985,8 +67676,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e5d0_5)(uae_u32 opcode) /* ROXLW */
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 m68k_incpc(2);
@@ -70014,8 +67704,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e5d8_5)(uae_u32 opcode) /* ROXLW */
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 m68k_incpc(2);
@@ -70043,8 +67732,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e5e0_5)(uae_u32 opcode) /* ROXLW */
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 m68k_incpc(2);
@@ -70071,8 +67759,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e5e8_5)(uae_u32 opcode) /* ROXLW */
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 m68k_incpc(4);
@@ -70100,8 +67787,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e5f0_5)(uae_u32 opcode) /* ROXLW */
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 m68k_incpc(4);
@@ -70127,8 +67813,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e5f8_5)(uae_u32 opcode) /* ROXLW */
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 m68k_incpc(4);
@@ -70154,8 +67839,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e5f9_5)(uae_u32 opcode) /* ROXLW */
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 m68k_incpc(6);
@@ -70182,8 +67866,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e6d0_5)(uae_u32 opcode) /* RORW */
 	val >>= 1;
 	if (carry) val |= 0x8000;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 m68k_incpc(2);
 fill_prefetch_2 ();
@@ -70210,8 +67893,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e6d8_5)(uae_u32 opcode) /* RORW */
 	val >>= 1;
 	if (carry) val |= 0x8000;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 m68k_incpc(2);
 fill_prefetch_2 ();
@@ -70238,8 +67920,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e6e0_5)(uae_u32 opcode) /* RORW */
 	val >>= 1;
 	if (carry) val |= 0x8000;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 m68k_incpc(2);
 fill_prefetch_2 ();
@@ -70265,8 +67946,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e6e8_5)(uae_u32 opcode) /* RORW */
 	val >>= 1;
 	if (carry) val |= 0x8000;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 m68k_incpc(4);
 fill_prefetch_0 ();
@@ -70293,8 +67973,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e6f0_5)(uae_u32 opcode) /* RORW */
 	val >>= 1;
 	if (carry) val |= 0x8000;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 m68k_incpc(4);
 fill_prefetch_0 ();
@@ -70319,8 +67998,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e6f8_5)(uae_u32 opcode) /* RORW */
 	val >>= 1;
 	if (carry) val |= 0x8000;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 m68k_incpc(4);
 fill_prefetch_0 ();
@@ -70345,8 +68023,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e6f9_5)(uae_u32 opcode) /* RORW */
 	val >>= 1;
 	if (carry) val |= 0x8000;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry);
 m68k_incpc(6);
 fill_prefetch_0 ();
@@ -70372,8 +68049,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e7d0_5)(uae_u32 opcode) /* ROLW */
 	val <<= 1;
 	if (carry)  val |= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 m68k_incpc(2);
 fill_prefetch_2 ();
@@ -70400,8 +68076,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e7d8_5)(uae_u32 opcode) /* ROLW */
 	val <<= 1;
 	if (carry)  val |= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 m68k_incpc(2);
 fill_prefetch_2 ();
@@ -70428,8 +68103,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e7e0_5)(uae_u32 opcode) /* ROLW */
 	val <<= 1;
 	if (carry)  val |= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 m68k_incpc(2);
 fill_prefetch_2 ();
@@ -70455,8 +68129,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e7e8_5)(uae_u32 opcode) /* ROLW */
 	val <<= 1;
 	if (carry)  val |= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 m68k_incpc(4);
 fill_prefetch_0 ();
@@ -70483,8 +68156,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e7f0_5)(uae_u32 opcode) /* ROLW */
 	val <<= 1;
 	if (carry)  val |= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 m68k_incpc(4);
 fill_prefetch_0 ();
@@ -70509,8 +68181,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e7f8_5)(uae_u32 opcode) /* ROLW */
 	val <<= 1;
 	if (carry)  val |= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 m68k_incpc(4);
 fill_prefetch_0 ();
@@ -70535,8 +68206,7 @@ unsigned long REGPARAM2 CPUFUNC(op_e7f9_5)(uae_u32 opcode) /* ROLW */
 	val <<= 1;
 	if (carry)  val |= 1;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_NZFLG (((uae_s16)(val)));
 SET_CFLG (carry >> 15);
 m68k_incpc(6);
 fill_prefetch_0 ();
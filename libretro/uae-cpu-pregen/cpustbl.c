@@ -8,6 +8,7 @@
 #ifdef NOFLAGS
 #include "noflags.h"
 #endif
+#if !CPU_68000_ONLY
 const struct cputbl CPUFUNC(op_smalltbl_0)[] = {
 { CPUFUNC(op_0_0), 0, 0 }, /* OR */
 { CPUFUNC(op_10_0), 0, 16 }, /* OR */
@@ -7136,6 +7137,7 @@ const struct cputbl CPUFUNC(op_smalltbl_3)[] = {
 { CPUFUNC(op_e7f8_0), 0, 59384 }, /* ROLW */
 { CPUFUNC(op_e7f9_0), 0, 59385 }, /* ROLW */
 { 0, 0, 0 }};
+#endif
 const struct cputbl CPUFUNC(op_smalltbl_4)[] = {
 { CPUFUNC(op_0_0), 0, 0 }, /* OR */
 { CPUFUNC(op_10_0), 0, 16 }, /* OR */
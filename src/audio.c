@@ -31,18 +31,46 @@ int SdlAudioBufferSize = 0;			/* in ms (0 = use default) */
 int pulse_swallowing_count = 0;			/* Sound disciplined emulation rate controlled by  */
 						/*  window comparator and pulse swallowing counter */
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Copy len samples from the ring filled by the sound emulation,
+ * pad with silence if there are not enough of them.
+ */
+static void Audio_CopyFromRing(Sint16 *pBuffer, int len)
+{
+	Sint16 *pSamples;
+	int n;
+
+	while (len > 0 && (n = Sound_RingPeek(&pSamples)) > 0)
+	{
+		if (n > len)
+			n = len;
+		memcpy(pBuffer, pSamples, n * 4);
+		Sound_RingAdvance(n);
+		pBuffer += n * 2;
+		len -= n;
+	}
+	memset(pBuffer, 0, len * 4);
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * SDL audio callback function - copy emulation sound to audio system.
+ * The samples come from a lock-free ring, so the emulation never has
+ * to block this callback while generating sound.
  */
 static void Audio_CallBack(void *userdata, Uint8 *stream, int len)
 {
 	Sint16 *pBuffer;
-	int i, window, nSamplesPerFrame;
+	int window, nSamplesPerFrame, nAvailable;
 
 	pBuffer = (Sint16 *)stream;
 	len = len / 4;  // Use length in samples (16 bit stereo), not in bytes
 
+	/* Ring fill level is the feedback for the emulation rate */
+	nAvailable = Sound_RingFill();
+
 	/* Adjust emulation rate within +/- 0.58% (10 cents) occasionally,
 	 * to synchronize sound. Note that an octave (frequency doubling)
 	 * has 12 semitones (12th root of two for a semitone), and that
@@ -63,50 +91,18 @@ static void Audio_CallBack(void *userdata, Uint8 *stream, int len)
 		window = (nSamplesPerFrame > SoundBufferSize) ? nSamplesPerFrame : SoundBufferSize;
 
 		/* Window Comparator for SoundBufferSize */
-		if (nGeneratedSamples < window + (window >> 1))
+		if (nAvailable < window + (window >> 1))
 		/* Increase emulation rate to maintain sound synchronization */
 			pulse_swallowing_count = -5793 / nScreenRefreshRate;
 		else
-		if (nGeneratedSamples > (window << 1) + (window >> 2))
+		if (nAvailable > (window << 1) + (window >> 2))
 		/* Decrease emulation rate to maintain sound synchronization */
 			pulse_swallowing_count = 5793 / nScreenRefreshRate;
 
 		/* Otherwise emulation rate is unaltered. */
 	}
 
-	if (nGeneratedSamples >= len)
-	{
-		/* Enough samples available: Pass completed buffer to audio system
-		 * by write samples into sound buffer and by converting them from
-		 * 'signed' to 'unsigned' */
-		for (i = 0; i < len; i++)
-		{
-			*pBuffer++ = MixBuffer[(CompleteSndBufIdx + i) % MIXBUFFER_SIZE][0];
-			*pBuffer++ = MixBuffer[(CompleteSndBufIdx + i) % MIXBUFFER_SIZE][1];
-		}
-		CompleteSndBufIdx += len;
-		nGeneratedSamples -= len;
-	}
-	else  /* Not enough samples available: */
-	{
-		for (i = 0; i < nGeneratedSamples; i++)
-		{
-			*pBuffer++ = MixBuffer[(CompleteSndBufIdx + i) % MIXBUFFER_SIZE][0];
-			*pBuffer++ = MixBuffer[(CompleteSndBufIdx + i) % MIXBUFFER_SIZE][1];
-		}
-		/* If the buffer is filled more than 50%, mirror sample buffer to fake the
-		 * missing samples */
-		if (nGeneratedSamples >= len/2)
-		{
-			int remaining = len - nGeneratedSamples;
-			memcpy(pBuffer, stream+(nGeneratedSamples-remaining)*4, remaining*4);
-		}
-		CompleteSndBufIdx += nGeneratedSamples;
-		nGeneratedSamples = 0;
-		
-	}
-
-	CompleteSndBufIdx = CompleteSndBufIdx % MIXBUFFER_SIZE;
+	Audio_CopyFromRing(pBuffer, len);
 }
 
 
@@ -185,8 +181,8 @@ void Audio_Init(void)
 #endif
 	/* All OK */
 	bSoundWorking = true;
-	/* And begin */
-	Audio_EnableAudio(true);
+	/* And begin, unless nobody listens */
+	Audio_EnableAudio(!bVideoHeadless);
 }
 
 
@@ -208,25 +204,6 @@ void Audio_UnInit(void)
 }
 
 
-/*-----------------------------------------------------------------------*/
-/**
- * Lock the audio sub system so that the callback function will not be called.
- */
-void Audio_Lock(void)
-{
-	SDL_LockAudio();
-}
-
-
-/*-----------------------------------------------------------------------*/
-/**
- * Unlock the audio sub system so that the callback function will be called again.
- */
-void Audio_Unlock(void)
-{
-	SDL_UnlockAudio();
-}
-
 #ifdef __LIBRETRO__
 extern int CHANGE_RATE;
 extern float SAMPLERATE;
@@ -241,8 +218,10 @@ void Audio_SetOutputAudioFreq(int nNewFrequency)
 	/* Do not reset sound system if nothing has changed! */
 	if (nNewFrequency != nAudioFrequency)
 	{
-		/* Set new frequency */
+		/* Set new frequency (after the sound thread is done with the old one) */
+		Sound_ThreadSync();
 		nAudioFrequency = nNewFrequency;
+		Sound_FrequencyChanged();
 
 #ifdef __LIBRETRO__
 		float tmp=(float)nAudioFrequency;
@@ -22,7 +22,13 @@
      with recent computers.
 
   PNG compression will often give a x20 ratio when compared to BMP and should
-  be used if you have a powerful enough cpu.
+  be used if you have a powerful enough cpu. PNG frames are compressed with
+  zlib directly, so libpng isn't needed.
+
+  On each VBL, the emulation thread only copies the cropped screen and the
+  new sound samples to the file writer queue. Frames are then encoded in
+  parallel by the pool of file writer threads (see --avi-threads) and
+  written to the file in order.
 
   Sound is saved as 16 bits pcm stereo, using the current Hatari sound output
   frequency. For best accuracy, sound frequency should be a multiple of the
@@ -62,16 +68,16 @@ const char AVIRecord_fileid[] = "Hatari avi_record.c : " __DATE__ " " __TIME__;
 #include "version.h"
 #include "audio.h"
 #include "configuration.h"
+#include "fileWriter.h"
 #include "log.h"
 #include "screen.h"
-#include "screenSnapShot.h"
 #include "sound.h"
 #include "statusbar.h"
 #include "avi_record.h"
 
 /* after above that brings in config.h */
-#if HAVE_LIBPNG
-#include <png.h>
+#if HAVE_LIBZ
+#include <zlib.h>
 #endif
 
 #include "pixel_convert.h"				/* inline functions */
@@ -262,9 +268,18 @@ typedef struct {
 #define	AVIIF_KEYFRAME				0x00000010			/* frame is a keyframe */
 
 
+/* Video codec : frames are encoded to a complete chunk on the file writer threads */
+typedef struct {
+  int		Codec;					/* AVI_RECORD_VIDEO_CODEC_xxx */
+  const char	*FourCC;				/* NULL for uncompressed RGB */
+  FILEWRITER_ENCODE Encode;
+} AVI_VIDEO_CODEC;
+
+
 typedef struct {
   /* Input params to start recording */
   int		VideoCodec;
+  const AVI_VIDEO_CODEC *pVideoCodec;
   int		VideoCodecCompressionLevel;					/* 0-9 for png compression */
 
   SDL_Surface	*Surface;
@@ -292,6 +307,12 @@ typedef struct {
 } RECORD_AVI_PARAMS;
 
 
+/* Video frame queued to the file writer, followed by the cropped pixels */
+typedef struct {
+  SDL_Color	Colors[ 256 ];				/* palette for 8 bit surfaces */
+} AVI_VIDEO_JOB;
+
+
 
 bool		bRecordingAvi = false;
 
@@ -307,11 +328,18 @@ static Uint32	Avi_ReadU32 ( Uint8 *p );
 
 static int	Avi_GetBmpSize ( int Width , int Height , int BitCount );
 
-static bool	Avi_RecordVideoStream_BMP ( RECORD_AVI_PARAMS *pAviParams );
-#if HAVE_LIBPNG
-static bool	Avi_RecordVideoStream_PNG ( RECORD_AVI_PARAMS *pAviParams );
+static bool	Avi_EncodeFrame_BMP ( Uint8 *pData , int Size , FILEWRITER_BUFFER *pOut , void *pParam );
+#if HAVE_LIBZ
+static bool	Avi_EncodeFrame_PNG ( Uint8 *pData , int Size , FILEWRITER_BUFFER *pOut , void *pParam );
+#endif
+static bool	Avi_WriteChunk ( Uint8 *pData , int Size , void *pParam );
+
+static const AVI_VIDEO_CODEC	AviVideoCodecs[] = {
+	{ AVI_RECORD_VIDEO_CODEC_BMP , NULL , Avi_EncodeFrame_BMP },
+#if HAVE_LIBZ
+	{ AVI_RECORD_VIDEO_CODEC_PNG , VIDEO_STREAM_PNG , Avi_EncodeFrame_PNG },
 #endif
-static bool	Avi_RecordAudioStream_PCM ( RECORD_AVI_PARAMS *pAviParams , Sint16 pSamples[][2], int SampleIndex, int SampleLength );
+};
 
 static void	Avi_BuildFileHeader ( RECORD_AVI_PARAMS *pAviParams , AVI_FILE_HEADER *pAviFileHeader );
 static bool	Avi_BuildIndex ( RECORD_AVI_PARAMS *pAviParams );
@@ -361,142 +389,279 @@ static int	Avi_GetBmpSize ( int Width , int Height , int BitCount )
 
 
 
-static bool	Avi_RecordVideoStream_BMP ( RECORD_AVI_PARAMS *pAviParams )
+/*-----------------------------------------------------------------------*/
+/**
+ * Convert one line of the copied frame to 24 bits (BGR order for BMP,
+ * RGB order for PNG).
+ */
+static void	Avi_ConvertLine ( RECORD_AVI_PARAMS *pAviParams , AVI_VIDEO_JOB *pJob , Uint8 *pOut , Uint8 *pIn , bool Bgr )
 {
-	AVI_CHUNK	Chunk;
+	SDL_PixelFormat	*fmt = pAviParams->Surface->format;
+	int		w = pAviParams->Width;
+
+	switch ( fmt->BytesPerPixel ) {
+		case 1 :	if ( Bgr )	PixelConvert_8to24Bits_BGR(pOut, pIn, w, pJob->Colors);
+				else		PixelConvert_8to24Bits(pOut, pIn, w, pJob->Colors);
+				break;
+		case 2 :	if ( Bgr )	PixelConvert_16to24Bits_BGR(pOut, (Uint16 *)pIn, w, fmt);
+				else		PixelConvert_16to24Bits(pOut, (Uint16 *)pIn, w, fmt);
+				break;
+		case 3 :	if ( Bgr )	PixelConvert_24to24Bits_BGR(pOut, pIn, w);
+				else		memcpy ( pOut , pIn , w * 3 );
+				break;
+		case 4 :	if ( Bgr )	PixelConvert_32to24Bits_BGR(pOut, (Uint32 *)pIn, w, fmt);
+				else		PixelConvert_32to24Bits(pOut, (Uint32 *)pIn, w, fmt);
+				break;
+	}
+}
+
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Encode a video frame as an uncompressed BMP chunk (called by the file writer)
+ */
+static bool	Avi_EncodeFrame_BMP ( Uint8 *pData , int Size , FILEWRITER_BUFFER *pOut , void *pParam )
+{
+	RECORD_AVI_PARAMS *pAviParams = (RECORD_AVI_PARAMS *)pParam;
+	AVI_VIDEO_JOB	*pJob = (AVI_VIDEO_JOB *)pData;
+	AVI_CHUNK	*pChunk;
 	int		SizeImage;
-	Uint8		LineBuf[ 3 * pAviParams->Width ];			/* temp buffer to convert to 24-bit BGR format */
+	int		LineSize = pAviParams->Width * pAviParams->Surface->format->BytesPerPixel;
 	Uint8		*pBitmapIn , *pBitmapOut;
 	int		y;
-	int		NeedLock;
 	
 	SizeImage = Avi_GetBmpSize ( pAviParams->Width , pAviParams->Height , pAviParams->BitCount );
-
-	/* Write the video frame header */
-	Avi_Store4cc ( Chunk.ChunkName , "00db" );				/* stream 0, uncompressed DIB bytes */
-	Avi_StoreU32 ( Chunk.ChunkSize , SizeImage );					/* max size of RGB image */
-	if ( fwrite ( &Chunk , sizeof ( Chunk ) , 1 , pAviParams->FileOut ) != 1 )
+	pChunk = (AVI_CHUNK *)FileWriter_Reserve ( pOut , sizeof ( AVI_CHUNK ) + SizeImage );
+	if ( !pChunk )
 	{
-		perror ( "Avi_RecordVideoStream_BMP" );
-		Log_AlertDlg ( LOG_ERROR, "AVI recording : failed to write bmp frame header" );
+		Log_Printf ( LOG_ERROR, "AVI recording : not enough memory to encode bmp video frame\n" );
 		return false;
 	}
 
+	/* Video frame header */
+	Avi_Store4cc ( pChunk->ChunkName , "00db" );				/* stream 0, uncompressed DIB bytes */
+	Avi_StoreU32 ( pChunk->ChunkSize , SizeImage );				/* max size of RGB image */
 
-	/* Write the video frame data */
-	NeedLock = SDL_MUSTLOCK( pAviParams->Surface );
-
-	/* Points to the top left pixel after cropping borders */
+	/* Video frame data */
 	/* For BMP format, frame is stored from bottom to top (origin is in bottom left corner) */
 	/* and bytes are in BGR order (not RGB) */
-	pBitmapIn = (Uint8 *)pAviParams->Surface->pixels
-			+ pAviParams->Surface->pitch * ( pAviParams->CropTop + pAviParams->Height )
-			+ pAviParams->CropLeft * pAviParams->Surface->format->BytesPerPixel;
-
+	pBitmapIn = (Uint8 *)( pJob + 1 ) + ( pAviParams->Height - 1 ) * LineSize;
+	pBitmapOut = (Uint8 *)( pChunk + 1 );
 	for ( y=0 ; y<pAviParams->Height ; y++ )
 	{
-		if ( NeedLock )
-			SDL_LockSurface ( pAviParams->Surface );
-
-		pBitmapOut = LineBuf;
-		switch ( pAviParams->Surface->format->BytesPerPixel ) {
-			case 1 :	PixelConvert_8to24Bits_BGR(LineBuf, pBitmapIn, pAviParams->Width, pAviParams->Surface->format->palette->colors);
-					break;
-			case 2 :	PixelConvert_16to24Bits_BGR(LineBuf, (Uint16 *)pBitmapIn, pAviParams->Width, pAviParams->Surface->format);
-					break;
-			case 3 :	PixelConvert_24to24Bits_BGR(LineBuf, pBitmapIn, pAviParams->Width);
-					break;
-			case 4 :	PixelConvert_32to24Bits_BGR(LineBuf, (Uint32 *)pBitmapIn, pAviParams->Width, pAviParams->Surface->format);
-					break;
-		}
+		Avi_ConvertLine ( pAviParams , pJob , pBitmapOut , pBitmapIn , true );
+		pBitmapIn -= LineSize;						/* go from bottom to top */
+		pBitmapOut += pAviParams->Width * 3;
+	}
 
-		if ( NeedLock )
-			SDL_UnlockSurface ( pAviParams->Surface );
+	pOut->nSize += sizeof ( AVI_CHUNK ) + SizeImage;
+	return true;
+}
 
-		if ( (int)fwrite ( pBitmapOut , 1 , pAviParams->Width*3 , pAviParams->FileOut ) != pAviParams->Width*3 )
-		{
-			perror ( "Avi_RecordVideoStream_BMP" );
-			Log_AlertDlg ( LOG_ERROR, "AVI recording : failed to write bmp video frame" );
-			return false;
-		}
 
-		pBitmapIn -= pAviParams->Surface->pitch;			/* go from bottom to top */
-	}
 
-	return true;
+#if HAVE_LIBZ
+static void	Avi_StoreU32_BE ( Uint8 *p , Uint32 val )
+{
+	p[0] = val >> 24;
+	p[1] = val >> 16;
+	p[2] = val >> 8;
+	p[3] = val;
 }
 
 
+/**
+ * Store a PNG chunk header and return where its data starts
+ */
+static Uint8	*Avi_PNG_BeginChunk ( Uint8 *p , const char *Type , int Len )
+{
+	Avi_StoreU32_BE ( p , Len );
+	Avi_Store4cc ( p + 4 , Type );
+	return p + 8;
+}
 
-#if HAVE_LIBPNG
-static bool	Avi_RecordVideoStream_PNG ( RECORD_AVI_PARAMS *pAviParams )
+/**
+ * Store the CRC of a PNG chunk (over type and data) and return where the next chunk starts
+ */
+static Uint8	*Avi_PNG_EndChunk ( Uint8 *pChunkData , int Len )
 {
-	AVI_CHUNK	Chunk;
-	int		SizeImage;
-	long		ChunkPos;
-	Uint8	TempSize[4];
-	
+	Avi_StoreU32_BE ( pChunkData + Len , crc32 ( 0 , pChunkData - 4 , Len + 4 ) );
+	return pChunkData + Len + 4;
+}
 
-	/* Write the video frame header */
-	ChunkPos = ftell ( pAviParams->FileOut );
-	Avi_Store4cc ( Chunk.ChunkName , "00dc" );				/* stream 0, compressed DIB bytes */
-	Avi_StoreU32 ( Chunk.ChunkSize , 0 );					/* size of PNG image (-> completed later) */
-	if ( fwrite ( &Chunk , sizeof ( Chunk ) , 1 , pAviParams->FileOut ) != 1 )
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Encode a video frame as a PNG chunk (called by the file writer).
+ * The image is compressed with zlib directly, each line using the PNG
+ * "up" filter, which works well for the large flat areas of ST screens.
+ */
+static bool	Avi_EncodeFrame_PNG ( Uint8 *pData , int Size , FILEWRITER_BUFFER *pOut , void *pParam )
+{
+	static const Uint8 PngSignature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+	RECORD_AVI_PARAMS *pAviParams = (RECORD_AVI_PARAMS *)pParam;
+	AVI_VIDEO_JOB	*pJob = (AVI_VIDEO_JOB *)pData;
+	int		LineSize = pAviParams->Width * pAviParams->Surface->format->BytesPerPixel;
+	int		RowBytes = pAviParams->Width * 3;
+	Uint8		Rows[ 2 ][ RowBytes ];				/* current and previous 24 bits lines */
+	Uint8		Filtered[ 1 + RowBytes ];
+	Uint8		*pBitmapIn , *pChunkStart , *p , *pIdat;
+	AVI_CHUNK	*pChunk;
+	z_stream	Stream;
+	uLong		MaxCompressed;
+	int		SizeImage , x , y;
+
+	memset ( &Stream , 0 , sizeof ( Stream ) );
+	if ( deflateInit ( &Stream , pAviParams->VideoCodecCompressionLevel ) != Z_OK )
 		goto png_error;
+	MaxCompressed = deflateBound ( &Stream , ( 1 + RowBytes ) * pAviParams->Height );
 
-	/* Write the video frame data */
-	SizeImage = ScreenSnapShot_SavePNG_ToFile ( pAviParams->Surface , pAviParams->FileOut ,
-		pAviParams->VideoCodecCompressionLevel , PNG_FILTER_NONE ,
-		pAviParams->CropLeft , pAviParams->CropRight , pAviParams->CropTop , pAviParams->CropBottom );
-	if ( SizeImage <= 0 )
+	/* chunk header, signature, IHDR, IDAT, IEND and padding byte */
+	pChunkStart = FileWriter_Reserve ( pOut , sizeof ( AVI_CHUNK ) + 8 + 25 + 12 + MaxCompressed + 12 + 1 );
+	if ( !pChunkStart )
+	{
+		deflateEnd ( &Stream );
 		goto png_error;
-	if ( SizeImage & 1 )
+	}
+	pChunk = (AVI_CHUNK *)pChunkStart;
+	p = pChunkStart + sizeof ( AVI_CHUNK );
+
+	memcpy ( p , PngSignature , sizeof ( PngSignature ) );
+	p += sizeof ( PngSignature );
+
+	p = Avi_PNG_BeginChunk ( p , "IHDR" , 13 );
+	Avi_StoreU32_BE ( p , pAviParams->Width );
+	Avi_StoreU32_BE ( p + 4 , pAviParams->Height );
+	p[8] = 8;								/* bit depth */
+	p[9] = 2;								/* RGB */
+	p[10] = p[11] = p[12] = 0;						/* deflate, adaptive filters, no interlace */
+	p = Avi_PNG_EndChunk ( p , 13 );
+
+	pIdat = Avi_PNG_BeginChunk ( p , "IDAT" , 0 );				/* size completed below */
+	Stream.next_out = pIdat;
+	Stream.avail_out = MaxCompressed;
+
+	pBitmapIn = (Uint8 *)( pJob + 1 );
+	memset ( Rows[ 1 ] , 0 , RowBytes );
+	for ( y=0 ; y<pAviParams->Height ; y++ )
 	{
-		SizeImage++;							/* add an extra '\0' byte to get an even size */
-		fputc ( '\0' , pAviParams->FileOut );				/* next chunk must be aligned on 16 bits boundary */
+		Uint8 *pCur = Rows[ y & 1 ] , *pPrev = Rows[ ( y & 1 ) ^ 1 ];
+
+		Avi_ConvertLine ( pAviParams , pJob , pCur , pBitmapIn , false );
+		pBitmapIn += LineSize;
+
+		Filtered[ 0 ] = 2;						/* "up" filter */
+		for ( x=0 ; x<RowBytes ; x++ )
+			Filtered[ 1 + x ] = pCur[ x ] - pPrev[ x ];
+
+		Stream.next_in = Filtered;
+		Stream.avail_in = 1 + RowBytes;
+		if ( deflate ( &Stream , y == pAviParams->Height - 1 ? Z_FINISH : Z_NO_FLUSH ) == Z_STREAM_ERROR )
+		{
+			deflateEnd ( &Stream );
+			goto png_error;
+		}
 	}
+	Avi_StoreU32_BE ( pIdat - 8 , Stream.total_out );
+	p = Avi_PNG_EndChunk ( pIdat , Stream.total_out );
+	deflateEnd ( &Stream );
 
-	/* Update the size of the video chunk */
-	Avi_StoreU32 ( TempSize , SizeImage );
-	if ( fseek ( pAviParams->FileOut , ChunkPos+4 , SEEK_SET ) != 0 )
-		goto png_error;
-	if ( fwrite ( TempSize , sizeof ( TempSize ) , 1 , pAviParams->FileOut ) != 1 )
-		goto png_error;
+	p = Avi_PNG_BeginChunk ( p , "IEND" , 0 );
+	p = Avi_PNG_EndChunk ( p , 0 );
 
-	/* Go to the end of the video frame data */
-	if ( fseek ( pAviParams->FileOut , 0 , SEEK_END ) != 0 )
-		goto png_error;
+	SizeImage = p - (Uint8 *)( pChunk + 1 );
+	if ( SizeImage & 1 )
+	{
+		*p = '\0';							/* next chunk must be aligned on 16 bits boundary */
+		SizeImage++;
+	}
+
+	/* Video frame header */
+	Avi_Store4cc ( pChunk->ChunkName , "00dc" );				/* stream 0, compressed DIB bytes */
+	Avi_StoreU32 ( pChunk->ChunkSize , SizeImage );
+	pOut->nSize += sizeof ( AVI_CHUNK ) + SizeImage;
 	return true;
 
 png_error:
-	perror ( "Avi_RecordVideoStream_PNG" );
-	Log_AlertDlg ( LOG_ERROR, "AVI recording : failed to write png frame" );
+	Log_Printf ( LOG_ERROR, "AVI recording : failed to encode png frame\n" );
 	return false;
 }
-#endif  /* HAVE_LIBPNG */
+#endif  /* HAVE_LIBZ */
+
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Write a video or audio chunk (called by the file writer)
+ */
+static bool	Avi_WriteChunk ( Uint8 *pData , int Size , void *pParam )
+{
+	RECORD_AVI_PARAMS *pAviParams = (RECORD_AVI_PARAMS *)pParam;
+
+	if ( fwrite ( pData , Size , 1 , pAviParams->FileOut ) != 1 )
+	{
+		perror ( "Avi_WriteChunk" );
+		Log_Printf ( LOG_ERROR, "AVI recording : failed to write chunk\n" );
+		return false;
+	}
+
+	return true;
+}
 
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Copy the cropped screen to the file writer queue, to be encoded
+ * by the selected codec on one of the writer threads
+ */
 bool	Avi_RecordVideoStream ( void )
 {
-	if ( AviParams.VideoCodec == AVI_RECORD_VIDEO_CODEC_BMP )
+	AVI_VIDEO_JOB	*pJob;
+	SDL_Surface	*pSurface = AviParams.Surface;
+	Uint8		*pBitmapIn , *pBitmapOut;
+	int		LineSize , y;
+	int		NeedLock;
+
+	LineSize = AviParams.Width * pSurface->format->BytesPerPixel;
+	pJob = (AVI_VIDEO_JOB *)FileWriter_Begin ( sizeof ( AVI_VIDEO_JOB ) + LineSize * AviParams.Height );
+	if ( !pJob )
 	{
-		if ( Avi_RecordVideoStream_BMP ( &AviParams ) == false )
-		{
-			return false;
-		}
+		Log_AlertDlg ( LOG_ERROR, "AVI recording : not enough memory to queue video frame" );
+		return false;
 	}
-#if HAVE_LIBPNG
-	else if ( AviParams.VideoCodec == AVI_RECORD_VIDEO_CODEC_PNG )
+
+	NeedLock = SDL_MUSTLOCK( pSurface );
+	if ( NeedLock )
+		SDL_LockSurface ( pSurface );
+
+	if ( pSurface->format->palette )
+		memcpy ( pJob->Colors , pSurface->format->palette->colors ,
+			 sizeof ( SDL_Color ) * ( pSurface->format->palette->ncolors < 256 ? pSurface->format->palette->ncolors : 256 ) );
+
+	/* Points to the top left pixel after cropping borders */
+	pBitmapIn = (Uint8 *)pSurface->pixels + pSurface->pitch * AviParams.CropTop
+			+ AviParams.CropLeft * pSurface->format->BytesPerPixel;
+	pBitmapOut = (Uint8 *)( pJob + 1 );
+	if ( pSurface->pitch == LineSize )
+		memcpy ( pBitmapOut , pBitmapIn , LineSize * AviParams.Height );
+	else
 	{
-		if ( Avi_RecordVideoStream_PNG ( &AviParams ) == false )
+		for ( y=0 ; y<AviParams.Height ; y++ )
 		{
-			return false;
+			memcpy ( pBitmapOut , pBitmapIn , LineSize );
+			pBitmapIn += pSurface->pitch;
+			pBitmapOut += LineSize;
 		}
 	}
-#endif
-	else
+
+	if ( NeedLock )
+		SDL_UnlockSurface ( pSurface );
+
+	if ( !FileWriter_CommitEncode ( AviParams.pVideoCodec->Encode , Avi_WriteChunk , &AviParams ) )
 	{
+		Log_AlertDlg ( LOG_ERROR, "AVI recording : failed to write video frame" );
 		return false;
 	}
 
@@ -515,48 +680,41 @@ bool	Avi_RecordVideoStream ( void )
 
 
 
-static bool	Avi_RecordAudioStream_PCM ( RECORD_AVI_PARAMS *pAviParams , Sint16 pSamples[][2] , int SampleIndex , int SampleLength )
+/*-----------------------------------------------------------------------*/
+/**
+ * Copy the new sound samples to the file writer queue
+ */
+bool	Avi_RecordAudioStream ( Sint16 pSamples[][2] , int SampleIndex , int SampleLength )
 {
-	AVI_CHUNK	Chunk;
-	Sint16		sample[2];
+	AVI_CHUNK	*pChunk;
+	Sint16		*pSample;
 	int		i;
 
-	/* Write the audio frame header */
-	Avi_Store4cc ( Chunk.ChunkName , "01wb" );				/* stream 1, wave bytes */
-	Avi_StoreU32 ( Chunk.ChunkSize , SampleLength * 4 );			/* 16 bits, stereo -> 4 bytes */
-	if ( fwrite ( &Chunk , sizeof ( Chunk ) , 1 , pAviParams->FileOut ) != 1 )
-	{
-		perror ( "Avi_RecordAudioStream_PCM" );
-		Log_AlertDlg ( LOG_ERROR, "AVI recording : failed to write pcm frame header" );
-		return false;
-	}
-
-	/* Write the audio frame data */
-	for ( i = 0 ; i < SampleLength; i++ )
+	if ( AviParams.AudioCodec == AVI_RECORD_AUDIO_CODEC_PCM )
 	{
-		/* Convert sample to little endian */
-		sample[0] = SDL_SwapLE16 ( pSamples[ (SampleIndex+i) % MIXBUFFER_SIZE ][0]);
-		sample[1] = SDL_SwapLE16 ( pSamples[ (SampleIndex+i) % MIXBUFFER_SIZE ][1]);
-		/* And store */
-		if ( fwrite ( &sample , sizeof ( sample ) , 1 , pAviParams->FileOut ) != 1 )
+		pChunk = (AVI_CHUNK *)FileWriter_Begin ( sizeof ( AVI_CHUNK ) + SampleLength * 4 );
+		if ( !pChunk )
 		{
-			perror ( "Avi_RecordAudioStream_PCM" );
-			Log_AlertDlg ( LOG_ERROR, "AVI recording : failed to write pcm frame" );
+			Log_AlertDlg ( LOG_ERROR, "AVI recording : not enough memory to queue pcm frame" );
 			return false;
 		}
-	}
-
-	return true;
-}
 
+		/* Audio frame header */
+		Avi_Store4cc ( pChunk->ChunkName , "01wb" );			/* stream 1, wave bytes */
+		Avi_StoreU32 ( pChunk->ChunkSize , SampleLength * 4 );		/* 16 bits, stereo -> 4 bytes */
 
+		/* Audio frame data */
+		pSample = (Sint16 *)( pChunk + 1 );
+		for ( i = 0 ; i < SampleLength; i++ )
+		{
+			/* Convert sample to little endian */
+			*pSample++ = SDL_SwapLE16 ( pSamples[ (SampleIndex+i) % MIXBUFFER_SIZE ][0]);
+			*pSample++ = SDL_SwapLE16 ( pSamples[ (SampleIndex+i) % MIXBUFFER_SIZE ][1]);
+		}
 
-bool	Avi_RecordAudioStream ( Sint16 pSamples[][2] , int SampleIndex , int SampleLength )
-{
-	if ( AviParams.AudioCodec == AVI_RECORD_AUDIO_CODEC_PCM )
-	{
-		if ( Avi_RecordAudioStream_PCM ( &AviParams , pSamples , SampleIndex , SampleLength ) == false )
+		if ( !FileWriter_Commit ( Avi_WriteChunk , &AviParams ) )
 		{
+			Log_AlertDlg ( LOG_ERROR, "AVI recording : failed to write pcm frame" );
 			return false;
 		}
 	}
@@ -586,11 +744,7 @@ static void	Avi_BuildFileHeader ( RECORD_AVI_PARAMS *pAviParams , AVI_FILE_HEADE
 	Fps_scale = pAviParams->Fps_scale;
 	AudioFreq = pAviParams->AudioFreq;
 
-	SizeImage = 0;
-	if ( pAviParams->VideoCodec == AVI_RECORD_VIDEO_CODEC_BMP )
-		SizeImage = Avi_GetBmpSize ( Width , Height , BitCount );		/* size of a BMP image */
-	else if ( pAviParams->VideoCodec == AVI_RECORD_VIDEO_CODEC_PNG )
-		SizeImage = Avi_GetBmpSize ( Width , Height , BitCount );		/* max size of a PNG image */
+	SizeImage = Avi_GetBmpSize ( Width , Height , BitCount );		/* size of a BMP image, max size if compressed */
 
 
 	/* RIFF / AVI headers */
@@ -629,10 +783,10 @@ static void	Avi_BuildFileHeader ( RECORD_AVI_PARAMS *pAviParams , AVI_FILE_HEADE
 	Avi_Store4cc ( pAviFileHeader->VideoStream.Header.ChunkName , "strh" );
 	Avi_StoreU32 ( pAviFileHeader->VideoStream.Header.ChunkSize , sizeof ( AVI_STREAM_HEADER ) - 8 );
 	Avi_Store4cc ( pAviFileHeader->VideoStream.Header.stream_type , "vids" );
-	if ( pAviParams->VideoCodec == AVI_RECORD_VIDEO_CODEC_BMP )
+	if ( pAviParams->pVideoCodec->FourCC == NULL )
 		Avi_StoreU32 ( pAviFileHeader->VideoStream.Header.stream_handler , VIDEO_STREAM_RGB );
-	else if ( pAviParams->VideoCodec == AVI_RECORD_VIDEO_CODEC_PNG )
-		Avi_Store4cc ( pAviFileHeader->VideoStream.Header.stream_handler , VIDEO_STREAM_PNG );
+	else
+		Avi_Store4cc ( pAviFileHeader->VideoStream.Header.stream_handler , pAviParams->pVideoCodec->FourCC );
 	Avi_StoreU32 ( pAviFileHeader->VideoStream.Header.flags , 0 );
 	Avi_StoreU16 ( pAviFileHeader->VideoStream.Header.priority , 0 );
 	Avi_StoreU16 ( pAviFileHeader->VideoStream.Header.language , 0 );
@@ -651,34 +805,20 @@ static void	Avi_BuildFileHeader ( RECORD_AVI_PARAMS *pAviParams , AVI_FILE_HEADE
 
 	Avi_Store4cc ( pAviFileHeader->VideoStream.Format.ChunkName , "strf" );
 	Avi_StoreU32 ( pAviFileHeader->VideoStream.Format.ChunkSize , sizeof ( AVI_STREAM_FORMAT_VIDS ) - 8 );
-	if ( pAviParams->VideoCodec == AVI_RECORD_VIDEO_CODEC_BMP )
-	{
-		Avi_StoreU32 ( pAviFileHeader->VideoStream.Format.size , sizeof ( AVI_STREAM_FORMAT_VIDS ) - 8 );
-		Avi_StoreU32 ( pAviFileHeader->VideoStream.Format.width , Width );
-		Avi_StoreU32 ( pAviFileHeader->VideoStream.Format.height , Height );
-		Avi_StoreU16 ( pAviFileHeader->VideoStream.Format.planes , 1 );			/* always 1 */
-		Avi_StoreU16 ( pAviFileHeader->VideoStream.Format.bit_count , BitCount );
+	Avi_StoreU32 ( pAviFileHeader->VideoStream.Format.size , sizeof ( AVI_STREAM_FORMAT_VIDS ) - 8 );
+	Avi_StoreU32 ( pAviFileHeader->VideoStream.Format.width , Width );
+	Avi_StoreU32 ( pAviFileHeader->VideoStream.Format.height , Height );
+	Avi_StoreU16 ( pAviFileHeader->VideoStream.Format.planes , 1 );			/* always 1 */
+	Avi_StoreU16 ( pAviFileHeader->VideoStream.Format.bit_count , BitCount );
+	if ( pAviParams->pVideoCodec->FourCC == NULL )
 		Avi_StoreU32 ( pAviFileHeader->VideoStream.Format.compression , VIDEO_STREAM_RGB );
-		Avi_StoreU32 ( pAviFileHeader->VideoStream.Format.size_image , SizeImage );
-		Avi_StoreU32 ( pAviFileHeader->VideoStream.Format.xpels_meter , 0 );
-		Avi_StoreU32 ( pAviFileHeader->VideoStream.Format.ypels_meter , 0 );
-		Avi_StoreU32 ( pAviFileHeader->VideoStream.Format.clr_used , 0 );		/* no color map */
-		Avi_StoreU32 ( pAviFileHeader->VideoStream.Format.clr_important , 0 );		/* no color map */
-	}
-	else if ( pAviParams->VideoCodec == AVI_RECORD_VIDEO_CODEC_PNG )
-	{
-		Avi_StoreU32 ( pAviFileHeader->VideoStream.Format.size , sizeof ( AVI_STREAM_FORMAT_VIDS ) - 8 );
-		Avi_StoreU32 ( pAviFileHeader->VideoStream.Format.width , Width );
-		Avi_StoreU32 ( pAviFileHeader->VideoStream.Format.height , Height );
-		Avi_StoreU16 ( pAviFileHeader->VideoStream.Format.planes , 1 );			/* always 1 */
-		Avi_StoreU16 ( pAviFileHeader->VideoStream.Format.bit_count , BitCount );
-		Avi_Store4cc ( pAviFileHeader->VideoStream.Format.compression , VIDEO_STREAM_PNG );
-		Avi_StoreU32 ( pAviFileHeader->VideoStream.Format.size_image , SizeImage );	/* max size if uncompressed */
-		Avi_StoreU32 ( pAviFileHeader->VideoStream.Format.xpels_meter , 0 );
-		Avi_StoreU32 ( pAviFileHeader->VideoStream.Format.ypels_meter , 0 );
-		Avi_StoreU32 ( pAviFileHeader->VideoStream.Format.clr_used , 0 );		/* no color map */
-		Avi_StoreU32 ( pAviFileHeader->VideoStream.Format.clr_important , 0 );		/* no color map */
-	}
+	else
+		Avi_Store4cc ( pAviFileHeader->VideoStream.Format.compression , pAviParams->pVideoCodec->FourCC );
+	Avi_StoreU32 ( pAviFileHeader->VideoStream.Format.size_image , SizeImage );	/* max size if compressed */
+	Avi_StoreU32 ( pAviFileHeader->VideoStream.Format.xpels_meter , 0 );
+	Avi_StoreU32 ( pAviFileHeader->VideoStream.Format.ypels_meter , 0 );
+	Avi_StoreU32 ( pAviFileHeader->VideoStream.Format.clr_used , 0 );		/* no color map */
+	Avi_StoreU32 ( pAviFileHeader->VideoStream.Format.clr_important , 0 );		/* no color map */
 
 
 	/* Audio Stream */
@@ -790,6 +930,7 @@ static bool	Avi_StartRecording_WithParams ( RECORD_AVI_PARAMS *pAviParams , char
 	char			InfoString[ 100 ];
 	int			Len , Len_rounded;
 	AVI_STREAM_LIST_MOVI	ListMovi;
+	int			i;
 
 
 	if ( bRecordingAvi == true )						/* already recording ? */
@@ -800,14 +941,18 @@ static bool	Avi_StartRecording_WithParams ( RECORD_AVI_PARAMS *pAviParams , char
 	pAviParams->Height = pAviParams->Surface->h - pAviParams->CropTop - pAviParams->CropBottom;
 	pAviParams->BitCount = 24;
 	
-#if !HAVE_LIBPNG
-	if ( pAviParams->VideoCodec == AVI_RECORD_VIDEO_CODEC_PNG )
+	pAviParams->pVideoCodec = NULL;
+	for ( i = 0 ; i < (int)( sizeof ( AviVideoCodecs ) / sizeof ( AviVideoCodecs[0] ) ) ; i++ )
+		if ( AviVideoCodecs[i].Codec == pAviParams->VideoCodec )
+			pAviParams->pVideoCodec = &AviVideoCodecs[i];
+	if ( pAviParams->pVideoCodec == NULL )
 	{
-		perror ( "AviStartRecording" );
-		Log_AlertDlg ( LOG_ERROR, "AVI recording : Hatari was not built with libpng support" );
+		Log_AlertDlg ( LOG_ERROR, "AVI recording : Hatari was not built with support for this video codec (png needs zlib)" );
 		return false;
 	}
-#endif
+
+	/* Encode frames on several threads */
+	FileWriter_SetThreads ( ConfigureParams.Video.AviRecordThreads );
 
 	/* Open the file */
 	pAviParams->FileOut = fopen ( AviFileName , "wb+" );
@@ -883,6 +1028,10 @@ static bool	Avi_StopRecording_WithParams ( RECORD_AVI_PARAMS *pAviParams )
 	if ( bRecordingAvi == false )						/* no recording ? */
 		return true;
 
+	/* Wait for the queued frames */
+	if ( ! FileWriter_Flush () )
+		Log_AlertDlg ( LOG_ERROR, "AVI recording : some frames failed to be written" );
+
 	/* Update the size of the 'movi' chunk */
 	fseek ( pAviParams->FileOut , 0 , SEEK_END );				/* go to the end of the 'movi' chunk */
 	pAviParams->MoviChunkPosEnd = ftell ( pAviParams->FileOut );
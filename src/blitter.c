@@ -40,6 +40,7 @@ const char Blitter_fileid[] = "Hatari blitter.c : " __DATE__ " " __TIME__;
 #include "memorySnapShot.h"
 #include "stMemory.h"
 #include "screen.h"
+#include "stats.h"
 #include "video.h"
 
 /* Cycles to run for in non-hog mode */
@@ -127,6 +128,7 @@ static Uint16		BlitterHalftone[16];
 
 static BLITTER_OP_FUNC Blitter_ComputeHOP;
 static BLITTER_OP_FUNC Blitter_ComputeLOP;
+static bool Blitter_UseLineKernel;
 
 /*-----------------------------------------------------------------------*/
 /**
@@ -143,6 +145,40 @@ static void Blitter_AddCycles(int cycles)
 	nWaitStateCycles = 0;
 }
 
+/* Same as calling Blitter_AddCycles(4) for each of the bus accesses */
+static void Blitter_AddAccessCycles(int accesses)
+{
+	BlitterVars.op_cycles += 4 * accesses + nWaitStateCycles;
+
+	nCyclesMainCounter += ((4 + nWaitStateCycles) >> nCpuFreqShift)
+		+ (accesses - 1) * (4 >> nCpuFreqShift);
+	nWaitStateCycles = 0;
+}
+
+/*
+ * Whether given additional cycles can be run before pending cycles
+ * need to be flushed, because an interrupt is due or non-hog mode
+ * bus time ends.
+ */
+static bool Blitter_CyclesFit(int cycles)
+{
+	Sint64 pending = BlitterVars.op_cycles + cycles;
+
+	if (!BlitterVars.hog && BlitterVars.pass_cycles + pending >= NONHOG_CYCLES)
+		return false;
+
+	return INT_CONVERT_TO_INTERNAL(pending, INT_CPU_CYCLE) < PendingInterruptCount;
+}
+
+/*
+ * Whether next blitter word accesses only ST RAM, i.e. there are
+ * no I/O side-effects that would depend on the flushed cycles
+ */
+static bool Blitter_NextInRam(void)
+{
+	return BlitterRegs.src_addr < STRamEnd && BlitterRegs.dst_addr < STRamEnd;
+}
+
 static void Blitter_FlushCycles(void)
 {
 	int op_cycles = INT_CONVERT_TO_INTERNAL(BlitterVars.op_cycles, INT_CPU_CYCLE);
@@ -152,7 +188,8 @@ static void Blitter_FlushCycles(void)
 
 	PendingInterruptCount -= op_cycles;
 	while (PendingInterruptCount <= 0 && PendingInterruptFunction)
-		CALL_VAR(PendingInterruptFunction);
+		CycInt_CallPendingHandler();
+	CycInt_HandlersDone();
 }
 
 /*-----------------------------------------------------------------------*/
@@ -427,6 +464,7 @@ static void Blitter_ProcessWord(void)
 							: Blitter_ComputeLOP());
 
 	Blitter_WriteWord(BlitterRegs.dst_addr, dst_data);
+	Stats_Add(STATS_BLITTER_WORDS, 1);
 
 	if (BlitterRegs.words == 1)
 	{
@@ -503,6 +541,164 @@ static void Blitter_Step(void)
 	}
 }
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Blitter emulation - line kernels
+ *
+ * Whole lines of the most common blits (copy, fill and source AND/XOR/OR
+ * dest, with contiguous words in ST RAM) are done in one go, without the
+ * per word HOP/LOP calls and cycle flushing.  Results, bus accesses and
+ * cycles are the same as with Blitter_Step(), cycles are just flushed
+ * only at the end of the line.
+ */
+
+/* Whether the line kernel handles current HOP/LOP/increments combination */
+static bool Blitter_LineKernelOp(void)
+{
+	if (BlitterRegs.dst_x_incr != 2)
+		return false;
+
+	switch (BlitterRegs.lop)
+	{
+	 case 0x0:
+	 case 0xF:
+		/* source isn't used */
+		return true;
+	 case 0x1:
+	 case 0x3:
+	 case 0x4:
+	 case 0x6:
+	 case 0x7:
+		return BlitterRegs.hop == 2 && BlitterRegs.src_x_incr == 2;
+	}
+	return false;
+}
+
+/* Whether the LOP reads the destination */
+static bool Blitter_LineReadsDest(void)
+{
+	return BlitterRegs.lop != 0x0 && BlitterRegs.lop != 0x3 && BlitterRegs.lop != 0xF;
+}
+
+/* Whether the LOP uses the source */
+static bool Blitter_LineUsesSource(void)
+{
+	return BlitterRegs.lop != 0x0 && BlitterRegs.lop != 0xF;
+}
+
+/**
+ * Return number of bus accesses for the whole current line, or zero
+ * if the line kernel can't be used for it.
+ */
+static int Blitter_LineAccesses(void)
+{
+	Uint32 words = BlitterVars.dst_words_reset;
+	Uint32 fetches = 0;
+	int reads;
+
+	if (BlitterRegs.words != words)
+		return 0;
+
+	/* ST RAM without wait states or supervisor/ROM checks */
+	if (BlitterRegs.dst_addr < 0x800 || BlitterRegs.dst_addr + 2 * words > STRamEnd)
+		return 0;
+
+	if (Blitter_LineUsesSource())
+	{
+		fetches = BlitterVars.src_words_reset;
+		if (BlitterRegs.src_addr < 0x800 || BlitterRegs.src_addr + 2 * fetches > STRamEnd)
+			return 0;
+	}
+
+	if (Blitter_LineReadsDest())
+		reads = words;
+	else if (words == 1)
+		reads = (BlitterVars.nfsr || BlitterRegs.end_mask_1 != 0xFFFF);
+	else
+		reads = (BlitterRegs.end_mask_1 != 0xFFFF)
+			+ (words - 2) * (BlitterRegs.end_mask_2 != 0xFFFF)
+			+ (BlitterVars.nfsr || BlitterRegs.end_mask_3 != 0xFFFF);
+
+	return fetches + reads + words;
+}
+
+static void Blitter_Line(void)
+{
+	Uint32 words = BlitterVars.dst_words_reset;
+	Uint32 src_addr = BlitterRegs.src_addr;
+	Uint32 dst_addr = BlitterRegs.dst_addr;
+	Uint32 buffer = BlitterVars.buffer;
+	bool use_src = Blitter_LineUsesSource();
+	bool read_dst = Blitter_LineReadsDest();
+	Uint16 src = 0, dst = 0, result = 0, end_mask;
+	Uint8 nfsr;
+	Uint32 i;
+
+	for (i = 0; i < words; i++)
+	{
+		if (i == 0)
+			end_mask = BlitterRegs.end_mask_1;
+		else if (i == words - 1)
+			end_mask = BlitterRegs.end_mask_3;
+		else
+			end_mask = BlitterRegs.end_mask_2;
+		nfsr = (i == words - 1) ? BlitterVars.nfsr : 0;
+
+		if (use_src)
+		{
+			if (i == 0 && BlitterVars.fxsr)
+			{
+				buffer = (buffer << 16) | (Uint16)get_word(src_addr);
+				src_addr += 2;
+			}
+			buffer <<= 16;
+			if (!nfsr)
+			{
+				buffer |= (Uint16)get_word(src_addr);
+				src_addr += 2;
+			}
+			src = (Uint16)(buffer >> BlitterVars.skew);
+		}
+
+		if (read_dst || nfsr || end_mask != 0xFFFF)
+			dst = (Uint16)get_word(dst_addr);
+
+		switch (BlitterRegs.lop)
+		{
+		 case 0x0: result = 0; break;
+		 case 0x1: result = src & dst; break;
+		 case 0x3: result = src; break;
+		 case 0x4: result = ~src & dst; break;
+		 case 0x6: result = src ^ dst; break;
+		 case 0x7: result = src | dst; break;
+		 case 0xF: result = 0xFFFF; break;
+		}
+
+		/* when NFSR, a read-modify-write is always performed */
+		if (nfsr || end_mask != 0xFFFF)
+			result = (result & end_mask) | (dst & ~end_mask);
+
+		put_word(dst_addr, result);
+		dst_addr += 2;
+	}
+
+	/* last fetch / write advance to the next line instead */
+	if (use_src && src_addr != BlitterRegs.src_addr)
+	{
+		BlitterRegs.src_addr = src_addr - 2 + BlitterRegs.src_y_incr;
+		BlitterVars.src_words = 1;
+	}
+	else
+	{
+		BlitterVars.src_words = BlitterVars.src_words_reset;
+	}
+	BlitterRegs.dst_addr = dst_addr - 2 + BlitterRegs.dst_y_incr;
+	BlitterVars.buffer = buffer;
+
+	Stats_Add(STATS_BLITTER_WORDS, words);
+	Blitter_EndLine();
+}
+
 /*-----------------------------------------------------------------------*/
 /**
  * Let's do the blit.
@@ -520,6 +716,7 @@ static void Blitter_Start(void)
 	BlitterVars.pass_cycles = 0;
 	BlitterVars.op_cycles = 0;
 	BlitterVars.src_words_reset = BlitterVars.dst_words_reset + BlitterVars.fxsr - BlitterVars.nfsr;
+	Blitter_UseLineKernel = Blitter_LineKernelOp();
 
 	/* bus arbitration */
 	BusMode = BUS_MODE_BLITTER;		/* bus is now owned by the blitter */
@@ -529,11 +726,28 @@ static void Blitter_Start(void)
 	/* Now we enter the main blitting loop */
 	do
 	{
-		Blitter_Step();
-		Blitter_FlushCycles();
+		int accesses = Blitter_UseLineKernel ? Blitter_LineAccesses() : 0;
+
+		/* whole line needs to fit before next interrupt / end of non-hog time */
+		if (accesses && Blitter_CyclesFit(4 * accesses + nWaitStateCycles))
+		{
+			Blitter_Line();
+			Blitter_AddAccessCycles(accesses);
+		}
+		else
+		{
+			Blitter_Step();
+		}
+
+		/* Cycles of consecutive words are posted as a block, at the point
+		 * where flushing them after each word would have run an interrupt,
+		 * ended the non-hog bus time or mattered for an I/O access.
+		 */
+		if (!Blitter_CyclesFit(0) || BlitterRegs.lines == 0 || !Blitter_NextInRam())
+			Blitter_FlushCycles();
 	}
 	while (BlitterRegs.lines > 0
-	       && (BlitterVars.hog || BlitterVars.pass_cycles < NONHOG_CYCLES));
+	       && (BlitterVars.hog || BlitterVars.pass_cycles + BlitterVars.op_cycles < NONHOG_CYCLES));
 
 	/* bus arbitration */
 	Blitter_AddCycles(4);
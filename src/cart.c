@@ -164,4 +164,9 @@ void Cart_ResetImage(void)
 		cpufunctbl[NATFEAT_ID_OPCODE] = cpufunctbl[ 0x4afc ];	/* 0x7300 */
 		cpufunctbl[NATFEAT_CALL_OPCODE] = cpufunctbl[ 0x4afc ];	/* 0x7300 */
 	}
+
+#if ENABLE_COMPACT_DISPATCH && !ENABLE_WINUAE_CPU
+	/* old UAE core dispatches through a compacted copy of cpufunctbl */
+	build_cpufunc_dispatch();
+#endif
 }
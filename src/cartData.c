@@ -37,7 +37,7 @@ const Uint8 Cart_data[] =
 0x21,0x1f,0x21,0x1f,0x21,0x1f,0x21,0x1f,0x4a,0x80,0x67,0x04,0x58,0x4f,0x60,0xaa,
 0x4e,0x75,0x2f,0x2e,0x00,0x0a,0x2f,0x2e,0x00,0x06,0x42,0xa7,0x3f,0x3c,0x00,0x05,
 0x3f,0x3c,0x00,0x4b,0x4e,0x41,0x4f,0xef,0x00,0x10,0x4a,0x80,0x6b,0x02,0x4e,0x75,
-0x58,0x4f,0x60,0x86,0x48,0xe7,0x03,0x1c,0x2a,0x40,0x42,0x67,0x2f,0x2e,0x00,0x02,
+0x58,0x4f,0x60,0x86,0x4e,0xb9,0x00,0xfa,0x38,0xe2,0x42,0x67,0x2f,0x2e,0x00,0x02,
 0x3f,0x3c,0x00,0x3d,0x4e,0x41,0x50,0x4f,0x2c,0x00,0x48,0x6d,0x01,0x00,0x48,0x78,
 0x00,0x1c,0x3f,0x06,0x3f,0x3c,0x00,0x3f,0x4e,0x41,0x4f,0xef,0x00,0x0c,0xb0,0xbc,
 0x00,0x00,0x00,0x1c,0x66,0x00,0x00,0xd4,0x47,0xed,0x01,0x00,0x0c,0x53,0x60,0x1a,
@@ -930,5 +930,7 @@ const Uint8 Cart_data[] =
 0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,
 0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,
 0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,0x00,0x82,
-0x00,0x82
+0x00,0x82,0x2f,0x00,0x2f,0x00,0x2f,0x2e,0x00,0x02,0x3f,0x3c,0x48,0x46,0x3f,0x3c,
+0x00,0x4b,0x4e,0x41,0x4f,0xef,0x00,0x0c,0x4a,0x80,0x66,0x0c,0x20,0x1f,0x20,0x5f,
+0x48,0xe7,0x03,0x1c,0x2a,0x40,0x4e,0xd0,0x50,0x8f,0x4e,0x75
 };
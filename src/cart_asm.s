@@ -154,8 +154,7 @@ pexecerr:
 
 
 load_n_reloc:
-	movem.l	a3-a5/d6-d7,-(sp)
-	move.l	d0,a5		; Basepage in a5
+	jsr	fast_load.l	; Try loading on the host first (6 bytes, like the replaced code)
 	clr 	-(sp)
 	move.l	2(a6),-(sp)
 	move	#$3d,-(sp)	; Fopen
@@ -348,4 +347,29 @@ hatarix32:
 
 infoprgend:
 
+
+; Let Hatari load and relocate the program with the private Pexec mode
+; $4846 (--fast-pexec option). This is at the end of the cartridge so that
+; the addresses of the code above stay the same.
+; Returns to the caller of load_n_reloc with the basepage in d0 when
+; done, otherwise continues with the 68000 code of load_n_reloc.
+fast_load:
+	move.l	d0,-(sp)	; Keep basepage
+	move.l	d0,-(sp)	; Basepage
+	move.l	2(a6),-(sp)	; Program file name
+	move	#$4846,-(sp)	; Private mode: load into basepage
+	move	#$4b,-(sp)	; Pexec
+	trap	#1		; Gemdos
+	lea	12(sp),sp
+	tst.l	d0
+	bne.s	fast_done
+	move.l	(sp)+,d0	; Basepage
+	move.l	(sp)+,a0	; Return address into load_n_reloc
+	movem.l	a3-a5/d6-d7,-(sp)
+	move.l	d0,a5		; Basepage in a5
+	jmp	(a0)
+fast_done:
+	addq.l	#8,sp		; Drop basepage and return address into load_n_reloc
+	rts
+
 	END
@@ -32,6 +32,7 @@ const char Change_fileid[] = "Hatari change.c : " __DATE__ " " __TIME__;
 #include "printer.h"
 #include "reset.h"
 #include "rs232.h"
+#include "rowPool.h"
 #include "screen.h"
 #include "sound.h"
 #include "statusbar.h"
@@ -81,6 +82,10 @@ bool Change_DoNeedReset(CNF_PARAMS *current, CNF_PARAMS *changed)
 	if (strcmp(changed->Rom.szTosImageFileName, current->Rom.szTosImageFileName))
 		return true;
 
+	/* Did change IKBD ROM image? */
+	if (strcmp(changed->Rom.szIkbdRomFileName, current->Rom.szIkbdRomFileName))
+		return true;
+
 	/* Did change ACSI hard disk image? */
 	for (i = 0; i < MAX_ACSI_DEVS; i++)
 	{
@@ -100,6 +105,10 @@ bool Change_DoNeedReset(CNF_PARAMS *current, CNF_PARAMS *changed)
 	    || strcmp(changed->HardDisk.szIdeSlaveHardDiskImage, current->HardDisk.szIdeSlaveHardDiskImage))
 		return true;
 
+	/* Did change hard disk image overlay directory? */
+	if (strcmp(changed->HardDisk.szOverlayDir, current->HardDisk.szOverlayDir))
+		return true;
+
 	/* Did change GEMDOS drive Atari/host location or enabling? */
 	if (changed->HardDisk.nHardDiskDrive != current->HardDisk.nHardDiskDrive
 	    || changed->HardDisk.bUseHardDiskDirectories != current->HardDisk.bUseHardDiskDirectories
@@ -275,6 +284,14 @@ void Change_CopyChangedParamsToConfiguration(CNF_PARAMS *current, CNF_PARAMS *ch
 			bReInitAcsiEmu = true;
 		}
 	}
+	/* Did change HD image overlay directory? */
+	if (strcmp(changed->HardDisk.szOverlayDir, current->HardDisk.szOverlayDir))
+	{
+		Dprintf("- HD overlays>\n");
+		bReInitAcsiEmu = true;
+		Ide_UnInit();
+		bReInitIDEEmu = true;
+	}
 	if (bReInitAcsiEmu)
 		HDC_UnInit();
 
@@ -350,7 +367,12 @@ void Change_CopyChangedParamsToConfiguration(CNF_PARAMS *current, CNF_PARAMS *ch
 		Dprintf("- DSP<\n");
 		DSP_Init();
 	}
+	DSP_SetQuantum(ConfigureParams.System.nDSPQuantum);
+	DSP_EnableThread(ConfigureParams.System.bDSPThread);
 #endif
+	Sound_EnableThread(ConfigureParams.Sound.bSoundThread);
+	Screen_EnableRenderThread(ConfigureParams.Screen.bRenderThread);
+	RowPool_SetThreads(ConfigureParams.Screen.nConvertThreads);
 
 	/* Set keyboard remap file */
 	if (ConfigureParams.Keyboard.nKeymapType == KEYMAP_LOADED)
@@ -14,6 +14,7 @@ const char Configuration_fileid[] = "Hatari configuration.c : " __DATE__ " " __T
 #include "SDL.h"
 #endif
 #include <SDL_keyboard.h>
+#include <assert.h>
 
 #include "main.h"
 #include "configuration.h"
@@ -27,7 +28,9 @@ const char Configuration_fileid[] = "Hatari configuration.c : " __DATE__ " " __T
 #include "paths.h"
 #include "screen.h"
 #include "statusbar.h"
+#include "stMemory.h"
 #include "vdi.h"
+#include "vdiAccel.h"
 #include "video.h"
 #include "avi_record.h"
 #include "clocks_timings.h"
@@ -49,6 +52,7 @@ static const struct Config_Tag configs_Log[] =
 	{ "nAlertDlgLogLevel", Int_Tag, &ConfigureParams.Log.nAlertDlgLogLevel },
 	{ "bConfirmQuit", Bool_Tag, &ConfigureParams.Log.bConfirmQuit },
 	{ "bNatFeats", Bool_Tag, &ConfigureParams.Log.bNatFeats },
+	{ "bNatFeatsBulk", Bool_Tag, &ConfigureParams.Log.bNatFeatsBulk },
 	{ "bConsoleWindow", Bool_Tag, &ConfigureParams.Log.bConsoleWindow },
 	{ NULL , Error_Tag, NULL }
 };
@@ -69,17 +73,21 @@ static const struct Config_Tag configs_Screen[] =
 {
 	{ "nMonitorType", Int_Tag, &ConfigureParams.Screen.nMonitorType },
 	{ "nFrameSkips", Int_Tag, &ConfigureParams.Screen.nFrameSkips },
+	{ "bAdaptiveFrameSkip", Bool_Tag, &ConfigureParams.Screen.bAdaptiveFrameSkip },
 	{ "bFullScreen", Bool_Tag, &ConfigureParams.Screen.bFullScreen },
 	{ "bKeepResolution", Bool_Tag, &ConfigureParams.Screen.bKeepResolution },
 	{ "bKeepResolutionST", Bool_Tag, &ConfigureParams.Screen.bKeepResolutionST },
 	{ "bAllowOverscan", Bool_Tag, &ConfigureParams.Screen.bAllowOverscan },
 	{ "nSpec512Threshold", Int_Tag, &ConfigureParams.Screen.nSpec512Threshold },
+	{ "bRenderThread", Bool_Tag, &ConfigureParams.Screen.bRenderThread },
 	{ "nForceBpp", Int_Tag, &ConfigureParams.Screen.nForceBpp },
 	{ "bAspectCorrect", Bool_Tag, &ConfigureParams.Screen.bAspectCorrect },
+	{ "nConvertThreads", Int_Tag, &ConfigureParams.Screen.nConvertThreads },
 	{ "bUseExtVdiResolutions", Bool_Tag, &ConfigureParams.Screen.bUseExtVdiResolutions },
 	{ "nVdiWidth", Int_Tag, &ConfigureParams.Screen.nVdiWidth },
 	{ "nVdiHeight", Int_Tag, &ConfigureParams.Screen.nVdiHeight },
 	{ "nVdiColors", Int_Tag, &ConfigureParams.Screen.nVdiColors },
+	{ "bVdiAccel", Bool_Tag, &ConfigureParams.Screen.bVdiAccel },
 	{ "bShowStatusbar", Bool_Tag, &ConfigureParams.Screen.bShowStatusbar },
 	{ "bShowDriveLed", Bool_Tag, &ConfigureParams.Screen.bShowDriveLed },
 	{ "bCrop", Bool_Tag, &ConfigureParams.Screen.bCrop },
@@ -249,12 +257,15 @@ static const struct Config_Tag configs_ShortCutWithoutMod[] =
 static const struct Config_Tag configs_Sound[] =
 {
 	{ "bEnableMicrophone", Bool_Tag, &ConfigureParams.Sound.bEnableMicrophone },
+	{ "nMicrophoneLatency", Int_Tag, &ConfigureParams.Sound.nMicrophoneLatency },
 	{ "bEnableSound", Bool_Tag, &ConfigureParams.Sound.bEnableSound },
 	{ "bEnableSoundSync", Bool_Tag, &ConfigureParams.Sound.bEnableSoundSync },
 	{ "nPlaybackFreq", Int_Tag, &ConfigureParams.Sound.nPlaybackFreq },
 	{ "nSdlAudioBufferSize", Int_Tag, &ConfigureParams.Sound.SdlAudioBufferSize },
 	{ "szYMCaptureFileName", String_Tag, ConfigureParams.Sound.szYMCaptureFileName },
 	{ "YmVolumeMixing", Int_Tag, &ConfigureParams.Sound.YmVolumeMixing },
+	{ "bYmBlepSynthesis", Bool_Tag, &ConfigureParams.Sound.bYmBlepSynthesis },
+	{ "bSoundThread", Bool_Tag, &ConfigureParams.Sound.bSoundThread },
 	{ NULL , Error_Tag, NULL }
 };
 
@@ -263,6 +274,7 @@ static const struct Config_Tag configs_Memory[] =
 {
 	{ "nMemorySize", Int_Tag, &ConfigureParams.Memory.nMemorySize },
 	{ "bAutoSave", Bool_Tag, &ConfigureParams.Memory.bAutoSave },
+	{ "bHugePages", Bool_Tag, &ConfigureParams.Memory.bHugePages },
 	{ "szMemoryCaptureFileName", String_Tag, ConfigureParams.Memory.szMemoryCaptureFileName },
 	{ "szAutoSaveFileName", String_Tag, ConfigureParams.Memory.szAutoSaveFileName },
 	{ NULL , Error_Tag, NULL }
@@ -274,6 +286,7 @@ static const struct Config_Tag configs_Floppy[] =
 {
 	{ "bAutoInsertDiskB", Bool_Tag, &ConfigureParams.DiskImage.bAutoInsertDiskB },
 	{ "FastFloppy", Bool_Tag, &ConfigureParams.DiskImage.FastFloppy },
+	{ "TurboFloppy", Bool_Tag, &ConfigureParams.DiskImage.TurboFloppy },
 	{ "EnableDriveA", Bool_Tag, &ConfigureParams.DiskImage.EnableDriveA },
 	{ "DriveA_NumberOfHeads", Int_Tag, &ConfigureParams.DiskImage.DriveA_NumberOfHeads },
 	{ "EnableDriveB", Bool_Tag, &ConfigureParams.DiskImage.EnableDriveB },
@@ -295,6 +308,7 @@ static const struct Config_Tag configs_HardDisk[] =
 	{ "bUseHardDiskDirectory", Bool_Tag, &ConfigureParams.HardDisk.bUseHardDiskDirectories },
 	{ "szHardDiskDirectory", String_Tag, ConfigureParams.HardDisk.szHardDiskDirectories[DRIVE_C] },
 	{ "nGemdosCase", Int_Tag, &ConfigureParams.HardDisk.nGemdosCase },
+	{ "bFastPexec", Bool_Tag, &ConfigureParams.HardDisk.bFastPexec },
 	{ "nWriteProtection", Int_Tag, &ConfigureParams.HardDisk.nWriteProtection },
 	{ "bUseHardDiskImage", Bool_Tag, &ConfigureParams.Acsi[0].bUseDevice },
 	{ "szHardDiskImage", String_Tag, ConfigureParams.Acsi[0].sDeviceFile },
@@ -302,6 +316,7 @@ static const struct Config_Tag configs_HardDisk[] =
 	{ "bUseIdeSlaveHardDiskImage", Bool_Tag, &ConfigureParams.HardDisk.bUseIdeSlaveHardDiskImage },
 	{ "szIdeMasterHardDiskImage", String_Tag, ConfigureParams.HardDisk.szIdeMasterHardDiskImage },
 	{ "szIdeSlaveHardDiskImage", String_Tag, ConfigureParams.HardDisk.szIdeSlaveHardDiskImage },
+	{ "szOverlayDirectory", String_Tag, ConfigureParams.HardDisk.szOverlayDir },
 	{ NULL , Error_Tag, NULL }
 };
 
@@ -333,6 +348,7 @@ static const struct Config_Tag configs_Rom[] =
 	{ "szTosImageFileName", String_Tag, ConfigureParams.Rom.szTosImageFileName },
 	{ "bPatchTos", Bool_Tag, &ConfigureParams.Rom.bPatchTos },
 	{ "szCartridgeImageFileName", String_Tag, ConfigureParams.Rom.szCartridgeImageFileName },
+	{ "szIkbdRomFileName", String_Tag, ConfigureParams.Rom.szIkbdRomFileName },
 	{ NULL , Error_Tag, NULL }
 };
 
@@ -371,10 +387,13 @@ static const struct Config_Tag configs_System[] =
 	{ "nMachineType", Int_Tag, &ConfigureParams.System.nMachineType },
 	{ "bBlitter", Bool_Tag, &ConfigureParams.System.bBlitter },
 	{ "nDSPType", Int_Tag, &ConfigureParams.System.nDSPType },
+	{ "bDSPThread", Bool_Tag, &ConfigureParams.System.bDSPThread },
+	{ "nDSPQuantum", Int_Tag, &ConfigureParams.System.nDSPQuantum },
 	{ "bRealTimeClock", Bool_Tag, &ConfigureParams.System.bRealTimeClock },
 	{ "bPatchTimerD", Bool_Tag, &ConfigureParams.System.bPatchTimerD },
 	{ "bFastBoot", Bool_Tag, &ConfigureParams.System.bFastBoot },
 	{ "bFastForward", Bool_Tag, &ConfigureParams.System.bFastForward },
+	{ "bDeterministic", Bool_Tag, &ConfigureParams.System.bDeterministic },
 
 #if ENABLE_WINUAE_CPU
 	{ "bAddressSpace24", Bool_Tag, &ConfigureParams.System.bAddressSpace24 },
@@ -391,6 +410,7 @@ static const struct Config_Tag configs_Video[] =
 {
 	{ "AviRecordVcodec", Int_Tag, &ConfigureParams.Video.AviRecordVcodec },
 	{ "AviRecordFps", Int_Tag, &ConfigureParams.Video.AviRecordFps },
+	{ "AviRecordThreads", Int_Tag, &ConfigureParams.Video.AviRecordThreads },
 	{ "AviRecordFile", String_Tag, ConfigureParams.Video.AviRecordFile },
 	{ NULL , Error_Tag, NULL }
 };
@@ -420,6 +440,7 @@ void Configuration_SetDefault(void)
 	ConfigureParams.Log.nAlertDlgLogLevel = LOG_ERROR;
 	ConfigureParams.Log.bConfirmQuit = true;
 	ConfigureParams.Log.bNatFeats = false;
+	ConfigureParams.Log.bNatFeatsBulk = false;
 	ConfigureParams.Log.bConsoleWindow = false;
 
 	/* Set defaults for debugger */
@@ -433,6 +454,7 @@ void Configuration_SetDefault(void)
 	/* Set defaults for floppy disk images */
 	ConfigureParams.DiskImage.bAutoInsertDiskB = true;
 	ConfigureParams.DiskImage.FastFloppy = false;
+	ConfigureParams.DiskImage.TurboFloppy = false;
 	ConfigureParams.DiskImage.nWriteProtection = WRITEPROT_OFF;
 
 	ConfigureParams.DiskImage.EnableDriveA = true;
@@ -456,6 +478,7 @@ void Configuration_SetDefault(void)
 	/* Set defaults for hard disks */
 	ConfigureParams.HardDisk.bBootFromHardDisk = false;
 	ConfigureParams.HardDisk.nGemdosCase = GEMDOS_NOP;
+	ConfigureParams.HardDisk.bFastPexec = false;
 	ConfigureParams.HardDisk.nWriteProtection = WRITEPROT_OFF;
 	ConfigureParams.HardDisk.nHardDiskDrive = DRIVE_C;
 	ConfigureParams.HardDisk.bUseHardDiskDirectories = false;
@@ -468,6 +491,7 @@ void Configuration_SetDefault(void)
 	strcpy(ConfigureParams.HardDisk.szIdeMasterHardDiskImage, psWorkingDir);
 	ConfigureParams.HardDisk.bUseIdeSlaveHardDiskImage = false;
 	strcpy(ConfigureParams.HardDisk.szIdeSlaveHardDiskImage, psWorkingDir);
+	ConfigureParams.HardDisk.szOverlayDir[0] = '\0';
 
 	/* ACSI */
 	for (i = 0; i < MAX_ACSI_DEVS; i++)
@@ -528,6 +552,7 @@ void Configuration_SetDefault(void)
 	/* Set defaults for Memory */
 	ConfigureParams.Memory.nMemorySize = 1;     /* 1 MiB */
 	ConfigureParams.Memory.bAutoSave = false;
+	ConfigureParams.Memory.bHugePages = false;
 	sprintf(ConfigureParams.Memory.szMemoryCaptureFileName, "%s%chatari.sav",
 	        psHomeDir, PATHSEP);
 	sprintf(ConfigureParams.Memory.szAutoSaveFileName, "%s%cauto.sav",
@@ -553,15 +578,19 @@ void Configuration_SetDefault(void)
 	ConfigureParams.Screen.bKeepResolution = true;
 	ConfigureParams.Screen.bKeepResolutionST = false;
 	ConfigureParams.Screen.nFrameSkips = AUTO_FRAMESKIP_LIMIT;
+	ConfigureParams.Screen.bAdaptiveFrameSkip = false;
 	ConfigureParams.Screen.bAllowOverscan = true;
 	ConfigureParams.Screen.nSpec512Threshold = 1;
+	ConfigureParams.Screen.bRenderThread = false;
 	ConfigureParams.Screen.nForceBpp = 0;
 	ConfigureParams.Screen.bAspectCorrect = true;
+	ConfigureParams.Screen.nConvertThreads = 1;
 	ConfigureParams.Screen.nMonitorType = MONITOR_TYPE_RGB;
 	ConfigureParams.Screen.bUseExtVdiResolutions = false;
 	ConfigureParams.Screen.nVdiWidth = 640;
 	ConfigureParams.Screen.nVdiHeight = 480;
 	ConfigureParams.Screen.nVdiColors = GEMCOLOR_16;
+	ConfigureParams.Screen.bVdiAccel = false;
 	ConfigureParams.Screen.bShowStatusbar = true;
 	ConfigureParams.Screen.bShowDriveLed = true;
 	ConfigureParams.Screen.bCrop = false;
@@ -572,6 +601,7 @@ void Configuration_SetDefault(void)
 
 	/* Set defaults for Sound */
 	ConfigureParams.Sound.bEnableMicrophone = true;
+	ConfigureParams.Sound.nMicrophoneLatency = 0;
 	ConfigureParams.Sound.bEnableSound = true;
 	ConfigureParams.Sound.bEnableSoundSync = false;
 	ConfigureParams.Sound.nPlaybackFreq = 44100;
@@ -579,12 +609,15 @@ void Configuration_SetDefault(void)
 	        psWorkingDir, PATHSEP);
 	ConfigureParams.Sound.SdlAudioBufferSize = 0;
 	ConfigureParams.Sound.YmVolumeMixing = YM_TABLE_MIXING;
+	ConfigureParams.Sound.bYmBlepSynthesis = false;
+	ConfigureParams.Sound.bSoundThread = false;
 
 	/* Set defaults for Rom */
 	sprintf(ConfigureParams.Rom.szTosImageFileName, "%s%ctos.img",
 	        Paths_GetDataDir(), PATHSEP);
 	ConfigureParams.Rom.bPatchTos = true;
 	strcpy(ConfigureParams.Rom.szCartridgeImageFileName, "");
+	strcpy(ConfigureParams.Rom.szIkbdRomFileName, "");
 
 	/* Set defaults for System */
 #if ENABLE_WINUAE_CPU
@@ -611,14 +644,18 @@ void Configuration_SetDefault(void)
 	ConfigureParams.System.bFastBoot = true;
 	ConfigureParams.System.bRealTimeClock = false;
 	ConfigureParams.System.bFastForward = false;
+	ConfigureParams.System.bDeterministic = false;
+	ConfigureParams.System.bDSPThread = false;
+	ConfigureParams.System.nDSPQuantum = 0;
 
 	/* Set defaults for Video */
-#if HAVE_LIBPNG
+#if HAVE_LIBZ
 	ConfigureParams.Video.AviRecordVcodec = AVI_RECORD_VIDEO_CODEC_PNG;
 #else
 	ConfigureParams.Video.AviRecordVcodec = AVI_RECORD_VIDEO_CODEC_BMP;
 #endif
 	ConfigureParams.Video.AviRecordFps = 0;			/* automatic FPS */
+	ConfigureParams.Video.AviRecordThreads = 2;
 	sprintf(ConfigureParams.Video.AviRecordFile, "%s%chatari.avi", psWorkingDir, PATHSEP);
 
 	/* Initialize the configuration file name */
@@ -647,6 +684,7 @@ void Configuration_Apply(bool bReset)
 	{
 		/* Set resolution change */
 		bUseVDIRes = ConfigureParams.Screen.bUseExtVdiResolutions;
+		bVdiAccel = bUseVDIRes && ConfigureParams.Screen.bVdiAccel;
 		bUseHighRes = ((!bUseVDIRes) && ConfigureParams.Screen.nMonitorType == MONITOR_TYPE_MONO)
 			|| (bUseVDIRes && ConfigureParams.Screen.nVdiColors == GEMCOLOR_2);
 		if (bUseHighRes)
@@ -666,6 +704,9 @@ void Configuration_Apply(bool bReset)
 		nFrameSkips = ConfigureParams.Screen.nFrameSkips;
 	}
 
+	/* Host memory pages for ST-RAM (and TT-RAM at the next reset) */
+	STMemory_SetHugePages(ConfigureParams.Memory.bHugePages);
+
 	/* Init clocks for this machine */
 	ClocksTimings_InitMachine ( ConfigureParams.System.nMachineType );
 
@@ -685,11 +726,19 @@ void Configuration_Apply(bool bReset)
 	/* YM Mixing */
 	if ( ( ConfigureParams.Sound.YmVolumeMixing != YM_LINEAR_MIXING )
 	  && ( ConfigureParams.Sound.YmVolumeMixing != YM_TABLE_MIXING  )
-	  && ( ConfigureParams.Sound.YmVolumeMixing != YM_MODEL_MIXING ) )
+	  && ( ConfigureParams.Sound.YmVolumeMixing != YM_MODEL_MIXING )
+	  && ( ConfigureParams.Sound.YmVolumeMixing != YM_COMPACT_MIXING ) )
 		ConfigureParams.Sound.YmVolumeMixing = YM_TABLE_MIXING;
 
-	YmVolumeMixing = ConfigureParams.Sound.YmVolumeMixing;
-	Sound_SetYmVolumeMixing();
+	/* Only wait for the audio worker (which uses these) when they change */
+	if (YmVolumeMixing != ConfigureParams.Sound.YmVolumeMixing
+	    || UseBlepSynthesis != ConfigureParams.Sound.bYmBlepSynthesis)
+	{
+		Sound_ThreadSync();
+		YmVolumeMixing = ConfigureParams.Sound.YmVolumeMixing;
+		UseBlepSynthesis = ConfigureParams.Sound.bYmBlepSynthesis;
+	}
+	Sound_SetYmVolumeMixing();			/* also follows the machine type */
 
 	/* Check/constrain CPU settings and change corresponding
 	 * UAE cpu_level & cpu_compatible variables
@@ -700,6 +749,8 @@ void Configuration_Apply(bool bReset)
 	File_MakeAbsoluteName(ConfigureParams.Rom.szTosImageFileName);
 	if (strlen(ConfigureParams.Rom.szCartridgeImageFileName) > 0)
 		File_MakeAbsoluteName(ConfigureParams.Rom.szCartridgeImageFileName);
+	if (strlen(ConfigureParams.Rom.szIkbdRomFileName) > 0)
+		File_MakeAbsoluteName(ConfigureParams.Rom.szIkbdRomFileName);
 	File_CleanFileName(ConfigureParams.HardDisk.szHardDiskDirectories[0]);
 	File_MakeAbsoluteName(ConfigureParams.HardDisk.szHardDiskDirectories[0]);
 	File_MakeAbsoluteName(ConfigureParams.Memory.szMemoryCaptureFileName);
@@ -860,62 +911,89 @@ void Configuration_Save(void)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Save/restore a configuration variable, on restore note in
+ * bSnapShotParamsChanged whether its value changed.
+ */
+static bool bSnapShotParamsChanged;
+
+static void Configuration_StoreParam(void *pData, int nSize)
+{
+	Uint8 OldValue[FILENAME_MAX];
+
+	assert(nSize <= (int)sizeof(OldValue));
+	memcpy(OldValue, pData, nSize);
+	MemorySnapShot_Store(pData, nSize);
+	if (memcmp(OldValue, pData, nSize) != 0)
+		bSnapShotParamsChanged = true;
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Save/restore snapshot of configuration variables
- * ('MemorySnapShot_Store' handles type)
+ * ('MemorySnapShot_Store' handles type).
+ * On restore, return true if the restored configuration differs from
+ * the one the emulation currently runs with.
  */
-void Configuration_MemorySnapShot_Capture(bool bSave)
+bool Configuration_MemorySnapShot_Capture(bool bSave)
 {
 	int i;
 
-	MemorySnapShot_Store(ConfigureParams.Rom.szTosImageFileName, sizeof(ConfigureParams.Rom.szTosImageFileName));
-	MemorySnapShot_Store(ConfigureParams.Rom.szCartridgeImageFileName, sizeof(ConfigureParams.Rom.szCartridgeImageFileName));
+	bSnapShotParamsChanged = false;
+
+	Configuration_StoreParam(ConfigureParams.Rom.szTosImageFileName, sizeof(ConfigureParams.Rom.szTosImageFileName));
+	Configuration_StoreParam(ConfigureParams.Rom.szCartridgeImageFileName, sizeof(ConfigureParams.Rom.szCartridgeImageFileName));
+	Configuration_StoreParam(ConfigureParams.Rom.szIkbdRomFileName, sizeof(ConfigureParams.Rom.szIkbdRomFileName));
 
-	MemorySnapShot_Store(&ConfigureParams.Memory.nMemorySize, sizeof(ConfigureParams.Memory.nMemorySize));
+	Configuration_StoreParam(&ConfigureParams.Memory.nMemorySize, sizeof(ConfigureParams.Memory.nMemorySize));
 
-	MemorySnapShot_Store(&ConfigureParams.DiskImage.szDiskFileName[0], sizeof(ConfigureParams.DiskImage.szDiskFileName[0]));
-	MemorySnapShot_Store(&ConfigureParams.DiskImage.szDiskZipPath[0], sizeof(ConfigureParams.DiskImage.szDiskZipPath[0]));
-	MemorySnapShot_Store(&ConfigureParams.DiskImage.EnableDriveA, sizeof(ConfigureParams.DiskImage.EnableDriveA));
-	MemorySnapShot_Store(&ConfigureParams.DiskImage.DriveA_NumberOfHeads, sizeof(ConfigureParams.DiskImage.DriveA_NumberOfHeads));
-	MemorySnapShot_Store(&ConfigureParams.DiskImage.szDiskFileName[1], sizeof(ConfigureParams.DiskImage.szDiskFileName[1]));
-	MemorySnapShot_Store(&ConfigureParams.DiskImage.szDiskZipPath[1], sizeof(ConfigureParams.DiskImage.szDiskZipPath[1]));
-	MemorySnapShot_Store(&ConfigureParams.DiskImage.EnableDriveB, sizeof(ConfigureParams.DiskImage.EnableDriveB));
-	MemorySnapShot_Store(&ConfigureParams.DiskImage.DriveB_NumberOfHeads, sizeof(ConfigureParams.DiskImage.DriveB_NumberOfHeads));
+	Configuration_StoreParam(&ConfigureParams.DiskImage.szDiskFileName[0], sizeof(ConfigureParams.DiskImage.szDiskFileName[0]));
+	Configuration_StoreParam(&ConfigureParams.DiskImage.szDiskZipPath[0], sizeof(ConfigureParams.DiskImage.szDiskZipPath[0]));
+	Configuration_StoreParam(&ConfigureParams.DiskImage.EnableDriveA, sizeof(ConfigureParams.DiskImage.EnableDriveA));
+	Configuration_StoreParam(&ConfigureParams.DiskImage.DriveA_NumberOfHeads, sizeof(ConfigureParams.DiskImage.DriveA_NumberOfHeads));
+	Configuration_StoreParam(&ConfigureParams.DiskImage.szDiskFileName[1], sizeof(ConfigureParams.DiskImage.szDiskFileName[1]));
+	Configuration_StoreParam(&ConfigureParams.DiskImage.szDiskZipPath[1], sizeof(ConfigureParams.DiskImage.szDiskZipPath[1]));
+	Configuration_StoreParam(&ConfigureParams.DiskImage.EnableDriveB, sizeof(ConfigureParams.DiskImage.EnableDriveB));
+	Configuration_StoreParam(&ConfigureParams.DiskImage.DriveB_NumberOfHeads, sizeof(ConfigureParams.DiskImage.DriveB_NumberOfHeads));
 
-	MemorySnapShot_Store(&ConfigureParams.HardDisk.bUseHardDiskDirectories, sizeof(ConfigureParams.HardDisk.bUseHardDiskDirectories));
-	MemorySnapShot_Store(ConfigureParams.HardDisk.szHardDiskDirectories[DRIVE_C], sizeof(ConfigureParams.HardDisk.szHardDiskDirectories[DRIVE_C]));
+	Configuration_StoreParam(&ConfigureParams.HardDisk.bUseHardDiskDirectories, sizeof(ConfigureParams.HardDisk.bUseHardDiskDirectories));
+	Configuration_StoreParam(ConfigureParams.HardDisk.szHardDiskDirectories[DRIVE_C], sizeof(ConfigureParams.HardDisk.szHardDiskDirectories[DRIVE_C]));
 	for (i = 0; i < MAX_ACSI_DEVS; i++)
 	{
-		MemorySnapShot_Store(&ConfigureParams.Acsi[i].bUseDevice, sizeof(ConfigureParams.Acsi[i].bUseDevice));
-		MemorySnapShot_Store(ConfigureParams.Acsi[i].sDeviceFile, sizeof(ConfigureParams.Acsi[i].sDeviceFile));
+		Configuration_StoreParam(&ConfigureParams.Acsi[i].bUseDevice, sizeof(ConfigureParams.Acsi[i].bUseDevice));
+		Configuration_StoreParam(ConfigureParams.Acsi[i].sDeviceFile, sizeof(ConfigureParams.Acsi[i].sDeviceFile));
 	}
 
-	MemorySnapShot_Store(&ConfigureParams.Screen.nMonitorType, sizeof(ConfigureParams.Screen.nMonitorType));
-	MemorySnapShot_Store(&ConfigureParams.Screen.bUseExtVdiResolutions, sizeof(ConfigureParams.Screen.bUseExtVdiResolutions));
-	MemorySnapShot_Store(&ConfigureParams.Screen.nVdiWidth, sizeof(ConfigureParams.Screen.nVdiWidth));
-	MemorySnapShot_Store(&ConfigureParams.Screen.nVdiHeight, sizeof(ConfigureParams.Screen.nVdiHeight));
-	MemorySnapShot_Store(&ConfigureParams.Screen.nVdiColors, sizeof(ConfigureParams.Screen.nVdiColors));
-
-	MemorySnapShot_Store(&ConfigureParams.System.nCpuLevel, sizeof(ConfigureParams.System.nCpuLevel));
-	MemorySnapShot_Store(&ConfigureParams.System.nCpuFreq, sizeof(ConfigureParams.System.nCpuFreq));
-	MemorySnapShot_Store(&ConfigureParams.System.bCompatibleCpu, sizeof(ConfigureParams.System.bCompatibleCpu));
-	MemorySnapShot_Store(&ConfigureParams.System.nMachineType, sizeof(ConfigureParams.System.nMachineType));
-	MemorySnapShot_Store(&ConfigureParams.System.bBlitter, sizeof(ConfigureParams.System.bBlitter));
-	MemorySnapShot_Store(&ConfigureParams.System.nDSPType, sizeof(ConfigureParams.System.nDSPType));
-	MemorySnapShot_Store(&ConfigureParams.System.bRealTimeClock, sizeof(ConfigureParams.System.bRealTimeClock));
-	MemorySnapShot_Store(&ConfigureParams.System.bPatchTimerD, sizeof(ConfigureParams.System.bPatchTimerD));
+	Configuration_StoreParam(&ConfigureParams.Screen.nMonitorType, sizeof(ConfigureParams.Screen.nMonitorType));
+	Configuration_StoreParam(&ConfigureParams.Screen.bUseExtVdiResolutions, sizeof(ConfigureParams.Screen.bUseExtVdiResolutions));
+	Configuration_StoreParam(&ConfigureParams.Screen.nVdiWidth, sizeof(ConfigureParams.Screen.nVdiWidth));
+	Configuration_StoreParam(&ConfigureParams.Screen.nVdiHeight, sizeof(ConfigureParams.Screen.nVdiHeight));
+	Configuration_StoreParam(&ConfigureParams.Screen.nVdiColors, sizeof(ConfigureParams.Screen.nVdiColors));
+
+	Configuration_StoreParam(&ConfigureParams.System.nCpuLevel, sizeof(ConfigureParams.System.nCpuLevel));
+	Configuration_StoreParam(&ConfigureParams.System.nCpuFreq, sizeof(ConfigureParams.System.nCpuFreq));
+	Configuration_StoreParam(&ConfigureParams.System.bCompatibleCpu, sizeof(ConfigureParams.System.bCompatibleCpu));
+	Configuration_StoreParam(&ConfigureParams.System.nMachineType, sizeof(ConfigureParams.System.nMachineType));
+	Configuration_StoreParam(&ConfigureParams.System.bBlitter, sizeof(ConfigureParams.System.bBlitter));
+	Configuration_StoreParam(&ConfigureParams.System.nDSPType, sizeof(ConfigureParams.System.nDSPType));
+	Configuration_StoreParam(&ConfigureParams.System.bRealTimeClock, sizeof(ConfigureParams.System.bRealTimeClock));
+	Configuration_StoreParam(&ConfigureParams.System.bPatchTimerD, sizeof(ConfigureParams.System.bPatchTimerD));
 
 #if ENABLE_WINUAE_CPU
-	MemorySnapShot_Store(&ConfigureParams.System.bAddressSpace24, sizeof(ConfigureParams.System.bAddressSpace24));
-	MemorySnapShot_Store(&ConfigureParams.System.bCycleExactCpu, sizeof(ConfigureParams.System.bCycleExactCpu));
-	MemorySnapShot_Store(&ConfigureParams.System.n_FPUType, sizeof(ConfigureParams.System.n_FPUType));
-	MemorySnapShot_Store(&ConfigureParams.System.bCompatibleFPU, sizeof(ConfigureParams.System.bCompatibleFPU));
-	MemorySnapShot_Store(&ConfigureParams.System.bMMU, sizeof(ConfigureParams.System.bMMU));
+	Configuration_StoreParam(&ConfigureParams.System.bAddressSpace24, sizeof(ConfigureParams.System.bAddressSpace24));
+	Configuration_StoreParam(&ConfigureParams.System.bCycleExactCpu, sizeof(ConfigureParams.System.bCycleExactCpu));
+	Configuration_StoreParam(&ConfigureParams.System.n_FPUType, sizeof(ConfigureParams.System.n_FPUType));
+	Configuration_StoreParam(&ConfigureParams.System.bCompatibleFPU, sizeof(ConfigureParams.System.bCompatibleFPU));
+	Configuration_StoreParam(&ConfigureParams.System.bMMU, sizeof(ConfigureParams.System.bMMU));
 #endif
 
-	MemorySnapShot_Store(&ConfigureParams.DiskImage.FastFloppy, sizeof(ConfigureParams.DiskImage.FastFloppy));
+	Configuration_StoreParam(&ConfigureParams.DiskImage.FastFloppy, sizeof(ConfigureParams.DiskImage.FastFloppy));
+	Configuration_StoreParam(&ConfigureParams.DiskImage.TurboFloppy, sizeof(ConfigureParams.DiskImage.TurboFloppy));
 
 	if (!bSave)
 		Configuration_Apply(true);
+
+	return bSnapShotParamsChanged;
 }
@@ -367,21 +367,50 @@ void Control_ProcessBuffer(const char *orig)
 /* socket from which control command line options are read */
 static int ControlSocket;
 
+/* commands read from the socket, the last one possibly incomplete */
+static char ControlBuffer[4096];
+static int nControlBuffered;
+
 /* pre-declared local functions */
 static int Control_GetUISocket(void);
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Execute the complete (newline terminated) commands in ControlBuffer
+ * and keep the incomplete remainder for the next read.  If the buffer
+ * is full without any newline, execute its contents as one command.
+ */
+static void Control_ProcessControlBuffer(void)
+{
+	char *end;
+
+	ControlBuffer[nControlBuffered] = '\0';
+	end = strrchr(ControlBuffer, '\n');
+	if (!end) {
+		if (nControlBuffered < (int)sizeof(ControlBuffer)-1) {
+			return;
+		}
+		end = ControlBuffer + nControlBuffered - 1;
+	}
+	*end++ = '\0';
+	Control_ProcessBuffer(ControlBuffer);
+
+	nControlBuffered -= end - ControlBuffer;
+	memmove(ControlBuffer, end, nControlBuffered);
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Check ControlSocket for new commands and execute them.
- * Commands should be separated by newlines.
+ * Commands should be separated by newlines.  Everything sent since
+ * the previous check is processed, not just a single read's worth.
  * 
  * Return true if remote pause ON (and connected), false otherwise
  */
 bool Control_CheckUpdates(void)
 {
-	/* just using all trace options with +/- are about 300 chars */
-	char buffer[400];
 	struct timeval tv;
 	fd_set readfds;
 	ssize_t bytes;
@@ -427,25 +456,29 @@ bool Control_CheckUpdates(void)
 			return bRemotePaused;
 		}
 		
-		/* assume whole command can be read in one go */
-		bytes = read(sock, buffer, sizeof(buffer)-1);
+		bytes = read(sock, ControlBuffer + nControlBuffered,
+			     sizeof(ControlBuffer) - 1 - nControlBuffered);
 		if (bytes < 0)
 		{
 			perror("Control socket read");
 			return false;
 		}
 		if (bytes == 0) {
-			/* closed */
+			/* closed, run what's left */
+			if (nControlBuffered) {
+				ControlBuffer[nControlBuffered] = '\0';
+				nControlBuffered = 0;
+				Control_ProcessBuffer(ControlBuffer);
+			}
 			close(ControlSocket);
 			ControlSocket = 0;
 			return false;
 		}
-		buffer[bytes] = '\0';
-		Control_ProcessBuffer(buffer);
+		nControlBuffered += bytes;
+		Control_ProcessControlBuffer();
 
-	} while (bRemotePaused);
-	
-	return false;
+		/* loop until nothing more is pending */
+	} while (true);
 }
 
 
@@ -481,6 +514,7 @@ const char *Control_SetSocket(const char *socketpath)
 		close(ControlSocket);
 	}
 	ControlSocket = newsock;
+	nControlBuffered = 0;
 	Log_Printf(LOG_INFO, "new control socket is '%s'\n", socketpath);
 	return NULL;
 }
@@ -52,15 +52,26 @@ static void ConvertLowRes_320x16Bit(void)
 				LOW_BUILD_PIXELS_3 ;      /* Generate 'ecx' as pixels [0,1,2,3] */
 				PLOT_LOW_320_16BIT(0) ;
 #else
-				/* Plot pixels */
-				LOW_BUILD_PIXELS_0 ;      /* Generate 'ecx' as pixels [4,5,6,7] */
-				PLOT_LOW_320_16BIT(4) ;
-				LOW_BUILD_PIXELS_1 ;      /* Generate 'ecx' as pixels [12,13,14,15] */
-				PLOT_LOW_320_16BIT(12) ;
-				LOW_BUILD_PIXELS_2 ;      /* Generate 'ecx' as pixels [0,1,2,3] */
-				PLOT_LOW_320_16BIT(0) ;
-				LOW_BUILD_PIXELS_3 ;      /* Generate 'ecx' as pixels [8,9,10,11] */
-				PLOT_LOW_320_16BIT(8) ;
+#if CONVERT_SIMD
+				if (bConvertUseSimd)
+				{
+					Uint32 pixelspace[4];
+					LOW_BUILD_PIXELSPACE;
+					Convert_SimdPlot16Bit(esi, pixelspace, 1, 0);
+				}
+				else
+#endif
+				{
+					/* Plot pixels */
+					LOW_BUILD_PIXELS_0 ;      /* Generate 'ecx' as pixels [4,5,6,7] */
+					PLOT_LOW_320_16BIT(4) ;
+					LOW_BUILD_PIXELS_1 ;      /* Generate 'ecx' as pixels [12,13,14,15] */
+					PLOT_LOW_320_16BIT(12) ;
+					LOW_BUILD_PIXELS_2 ;      /* Generate 'ecx' as pixels [0,1,2,3] */
+					PLOT_LOW_320_16BIT(0) ;
+					LOW_BUILD_PIXELS_3 ;      /* Generate 'ecx' as pixels [8,9,10,11] */
+					PLOT_LOW_320_16BIT(8) ;
+				}
 #endif
 			}
 
@@ -57,6 +57,16 @@ static void Line_ConvertLowRes_640x16Bit(Uint32 *edi, Uint32 *ebp, Uint32 *esi,
 			}
 #else
 			/* Plot in 'wrong-order', as ebx is 68000 endian */
+#if CONVERT_SIMD
+			if (bConvertUseSimd)
+			{
+				Uint32 pixelspace[4];
+				LOW_BUILD_PIXELSPACE;
+				Convert_SimdPlot16Bit((Uint16 *)esi, pixelspace, 2,
+				                      bScrDoubleY ? Screen4BytesPerLine * 2 : 0);
+			}
+			else
+#endif
 			if (!bScrDoubleY)                  /* Double on Y? */
 			{
 				/* Plot pixels */
@@ -162,6 +162,25 @@ static const Uint32 Remap_1_Plane[16] = {
 }
 
 
+/* Build the color indexes of all 16 pixels into 'pixelspace' in pixel
+ * order, one per byte, for the SIMD lookup (little endian hosts only)
+ */
+#define LOW_BUILD_PIXELSPACE \
+{ \
+ LOW_BUILD_PIXELS_0; pixelspace[1] = ecx; \
+ LOW_BUILD_PIXELS_1; pixelspace[3] = ecx; \
+ LOW_BUILD_PIXELS_2; pixelspace[0] = ecx; \
+ LOW_BUILD_PIXELS_3; pixelspace[2] = ecx; \
+}
+
+#define MED_BUILD_PIXELSPACE \
+{ \
+ MED_BUILD_PIXELS_0; pixelspace[1] = ecx; \
+ MED_BUILD_PIXELS_1; pixelspace[3] = ecx; \
+ MED_BUILD_PIXELS_2; pixelspace[0] = ecx; \
+ MED_BUILD_PIXELS_3; pixelspace[2] = ecx; \
+}
+
 /* Routines to create 'ecx' pixels - MUST be called in this order */
 #define HIGH_BUILD_PIXELS_0 \
 { \
@@ -82,6 +82,16 @@ static void Line_ConvertMediumRes_640x32Bit(Uint32 *edi, Uint32 *ebp, Uint32 *es
 			}
 #else
 			/* Plot in 'wrong-order', as ebx is 68000 endian */
+#if CONVERT_SIMD
+			if (bConvertUseSimd)
+			{
+				Uint32 pixelspace[4];
+				MED_BUILD_PIXELSPACE;
+				Convert_SimdPlot32Bit(esi, pixelspace, 1,
+				                      bScrDoubleY ? Screen4BytesPerLine : 0);
+			}
+			else
+#endif
 			if (!bScrDoubleY)                     /* Double on Y? */
 			{
 				MED_BUILD_PIXELS_0 ;              /* Generate 'ecx' as pixels [4,5,6,7] */
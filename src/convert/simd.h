@@ -0,0 +1,291 @@
+/*
+  Hatari - simd.h
+
+  SIMD palette lookup for the screen conversion routines.
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+
+  The 16 entry palette fits into a single vector register when it is split
+  into byte planes, so the colors of 16 pixels can be looked up at once with
+  a byte shuffle (pshufb on x86 with SSSE3, vtbl on ARM NEON) instead of one
+  table load and store per pixel. The pixel doubling of the 640 wide modes
+  is done in the registers too, by interleaving the looked up pixels with
+  themselves.
+
+  The plane to chunky conversion itself is still done with the Remap_2_Planes
+  tables (see macros.h), only the 4 resulting 'ecx' values are gathered into
+  pixel order (little endian hosts only) and handed to the functions here.
+  The Spectrum 512 routines are not handled: their palette changes every
+  few pixels, so there is nothing for a per-line table to win.
+*/
+
+#ifndef HATARI_CONVERTSIMD_H
+#define HATARI_CONVERTSIMD_H
+
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+# if defined(__SSSE3__)
+#  include <tmmintrin.h>
+#  define CONVERT_SIMD_SSSE3 1
+#  define CONVERT_SIMD_TARGET
+# elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+/* SSSE3 isn't part of the x86-64 baseline, so it's checked at run time */
+#  include <tmmintrin.h>
+#  define CONVERT_SIMD_SSSE3 1
+#  define CONVERT_SIMD_TARGET __attribute__((target("ssse3")))
+#  define CONVERT_SIMD_CPUCHECK 1
+# elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#  include <arm_neon.h>
+#  define CONVERT_SIMD_NEON 1
+#  define CONVERT_SIMD_TARGET
+# endif
+#endif
+
+#if defined(CONVERT_SIMD_SSSE3) || defined(CONVERT_SIMD_NEON)
+#define CONVERT_SIMD 1
+
+static bool bConvertUseSimd;			/* SIMD lookup available and verified */
+static Uint8 ConvertSimdPalette[4][16];	/* STRGBPalette split into bytes, LSB first */
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Split given 16 entry palette into the byte tables used for lookup.
+ * For 16-bit modes only the two lowest bytes are used.
+ */
+static void Convert_SimdSetPalette(const Uint32 *pPalette)
+{
+	int i;
+
+	for (i = 0; i < 16; i++)
+	{
+		ConvertSimdPalette[0][i] = pPalette[i];
+		ConvertSimdPalette[1][i] = pPalette[i] >> 8;
+		ConvertSimdPalette[2][i] = pPalette[i] >> 16;
+		ConvertSimdPalette[3][i] = pPalette[i] >> 24;
+	}
+}
+
+
+#if CONVERT_SIMD_SSSE3
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Convert 16 color indexes (pixel order, one per byte) to 16-bit pixels.
+ * With nWidth 2 every pixel is written twice. If nLineOffset isn't zero,
+ * the pixels are written also that many pixels further (double Y).
+ */
+static CONVERT_SIMD_TARGET void Convert_SimdPlot16Bit(Uint16 *pDst, const Uint32 *pIndexes,
+                                                      int nWidth, int nLineOffset)
+{
+	__m128i idx = _mm_loadu_si128((const __m128i *)pIndexes);
+	__m128i lo = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)ConvertSimdPalette[0]), idx);
+	__m128i hi = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)ConvertSimdPalette[1]), idx);
+	__m128i px[4];
+	int i, n;
+
+	px[0] = _mm_unpacklo_epi8(lo, hi);	/* pixels 0-7 */
+	px[1] = _mm_unpackhi_epi8(lo, hi);	/* pixels 8-15 */
+	if (nWidth == 2)
+	{
+		px[3] = _mm_unpackhi_epi16(px[1], px[1]);
+		px[2] = _mm_unpacklo_epi16(px[1], px[1]);
+		px[1] = _mm_unpackhi_epi16(px[0], px[0]);
+		px[0] = _mm_unpacklo_epi16(px[0], px[0]);
+		n = 4;
+	}
+	else
+		n = 2;
+	for (i = 0; i < n; i++)
+	{
+		_mm_storeu_si128((__m128i *)(pDst + 8*i), px[i]);
+		if (nLineOffset)
+			_mm_storeu_si128((__m128i *)(pDst + nLineOffset + 8*i), px[i]);
+	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Convert 16 color indexes (pixel order, one per byte) to 32-bit pixels.
+ * Parameters as for Convert_SimdPlot16Bit().
+ */
+static CONVERT_SIMD_TARGET void Convert_SimdPlot32Bit(Uint32 *pDst, const Uint32 *pIndexes,
+                                                      int nWidth, int nLineOffset)
+{
+	__m128i idx = _mm_loadu_si128((const __m128i *)pIndexes);
+	__m128i b0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)ConvertSimdPalette[0]), idx);
+	__m128i b1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)ConvertSimdPalette[1]), idx);
+	__m128i b2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)ConvertSimdPalette[2]), idx);
+	__m128i b3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)ConvertSimdPalette[3]), idx);
+	__m128i w01lo = _mm_unpacklo_epi8(b0, b1), w01hi = _mm_unpackhi_epi8(b0, b1);
+	__m128i w23lo = _mm_unpacklo_epi8(b2, b3), w23hi = _mm_unpackhi_epi8(b2, b3);
+	__m128i px[8];
+	int i, n;
+
+	px[0] = _mm_unpacklo_epi16(w01lo, w23lo);	/* pixels 0-3 */
+	px[1] = _mm_unpackhi_epi16(w01lo, w23lo);	/* pixels 4-7 */
+	px[2] = _mm_unpacklo_epi16(w01hi, w23hi);	/* pixels 8-11 */
+	px[3] = _mm_unpackhi_epi16(w01hi, w23hi);	/* pixels 12-15 */
+	if (nWidth == 2)
+	{
+		for (i = 3; i >= 0; i--)
+		{
+			px[2*i+1] = _mm_unpackhi_epi32(px[i], px[i]);
+			px[2*i] = _mm_unpacklo_epi32(px[i], px[i]);
+		}
+		n = 8;
+	}
+	else
+		n = 4;
+	for (i = 0; i < n; i++)
+	{
+		_mm_storeu_si128((__m128i *)(pDst + 4*i), px[i]);
+		if (nLineOffset)
+			_mm_storeu_si128((__m128i *)(pDst + nLineOffset + 4*i), px[i]);
+	}
+}
+
+#else	/* CONVERT_SIMD_NEON */
+
+/**
+ * Look up 16 bytes from given 16 byte table
+ */
+static inline uint8x16_t Convert_SimdLookup(const Uint8 *pTable, uint8x16_t idx)
+{
+#if defined(__aarch64__)
+	return vqtbl1q_u8(vld1q_u8(pTable), idx);
+#else
+	uint8x8x2_t tbl = { { vld1_u8(pTable), vld1_u8(pTable + 8) } };
+	return vcombine_u8(vtbl2_u8(tbl, vget_low_u8(idx)), vtbl2_u8(tbl, vget_high_u8(idx)));
+#endif
+}
+
+static void Convert_SimdPlot16Bit(Uint16 *pDst, const Uint32 *pIndexes,
+                                  int nWidth, int nLineOffset)
+{
+	uint8x16_t idx = vld1q_u8((const Uint8 *)pIndexes);
+	uint8x16x2_t z = vzipq_u8(Convert_SimdLookup(ConvertSimdPalette[0], idx),
+	                          Convert_SimdLookup(ConvertSimdPalette[1], idx));
+	uint16x8_t px[4];
+	uint16x8x2_t d;
+	int i, n;
+
+	px[0] = vreinterpretq_u16_u8(z.val[0]);	/* pixels 0-7 */
+	px[1] = vreinterpretq_u16_u8(z.val[1]);	/* pixels 8-15 */
+	if (nWidth == 2)
+	{
+		d = vzipq_u16(px[1], px[1]);
+		px[2] = d.val[0];
+		px[3] = d.val[1];
+		d = vzipq_u16(px[0], px[0]);
+		px[0] = d.val[0];
+		px[1] = d.val[1];
+		n = 4;
+	}
+	else
+		n = 2;
+	for (i = 0; i < n; i++)
+	{
+		vst1q_u16(pDst + 8*i, px[i]);
+		if (nLineOffset)
+			vst1q_u16(pDst + nLineOffset + 8*i, px[i]);
+	}
+}
+
+static void Convert_SimdPlot32Bit(Uint32 *pDst, const Uint32 *pIndexes,
+                                  int nWidth, int nLineOffset)
+{
+	uint8x16_t idx = vld1q_u8((const Uint8 *)pIndexes);
+	uint8x16x2_t z01 = vzipq_u8(Convert_SimdLookup(ConvertSimdPalette[0], idx),
+	                            Convert_SimdLookup(ConvertSimdPalette[1], idx));
+	uint8x16x2_t z23 = vzipq_u8(Convert_SimdLookup(ConvertSimdPalette[2], idx),
+	                            Convert_SimdLookup(ConvertSimdPalette[3], idx));
+	uint16x8x2_t q0 = vzipq_u16(vreinterpretq_u16_u8(z01.val[0]), vreinterpretq_u16_u8(z23.val[0]));
+	uint16x8x2_t q1 = vzipq_u16(vreinterpretq_u16_u8(z01.val[1]), vreinterpretq_u16_u8(z23.val[1]));
+	uint32x4_t px[8];
+	uint32x4x2_t d;
+	int i, n;
+
+	px[0] = vreinterpretq_u32_u16(q0.val[0]);	/* pixels 0-3 */
+	px[1] = vreinterpretq_u32_u16(q0.val[1]);	/* pixels 4-7 */
+	px[2] = vreinterpretq_u32_u16(q1.val[0]);	/* pixels 8-11 */
+	px[3] = vreinterpretq_u32_u16(q1.val[1]);	/* pixels 12-15 */
+	if (nWidth == 2)
+	{
+		for (i = 3; i >= 0; i--)
+		{
+			d = vzipq_u32(px[i], px[i]);
+			px[2*i] = d.val[0];
+			px[2*i+1] = d.val[1];
+		}
+		n = 8;
+	}
+	else
+		n = 4;
+	for (i = 0; i < n; i++)
+	{
+		vst1q_u32(pDst + 4*i, px[i]);
+		if (nLineOffset)
+			vst1q_u32(pDst + nLineOffset + 4*i, px[i]);
+	}
+}
+
+#endif	/* CONVERT_SIMD_NEON */
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Check that the CPU supports the lookup functions and that they give
+ * the same results as plain palette lookup, and enable them if they do.
+ */
+static void Convert_SimdInit(void)
+{
+	Uint32 palette[16], idx[4], out[2*32], ref[2*32];
+	Uint8 *pIdx = (Uint8 *)idx;
+	int i, width, bpp;
+
+	bConvertUseSimd = false;
+#if CONVERT_SIMD_CPUCHECK
+	if (!__builtin_cpu_supports("ssse3"))
+		return;
+#endif
+	for (i = 0; i < 16; i++)
+	{
+		palette[i] = 0x01234567u * (i + 1) ^ (0x89abcdefu >> i);
+		pIdx[i] = (i * 7) & 15;
+	}
+	Convert_SimdSetPalette(palette);
+
+	for (bpp = 16; bpp <= 32; bpp += 16)
+	{
+		for (width = 1; width <= 2; width++)
+		{
+			memset(out, 0, sizeof(out));
+			memset(ref, 0, sizeof(ref));
+			for (i = 0; i < 16 * width; i++)
+			{
+				if (bpp == 16)
+				{
+					((Uint16 *)ref)[i] = palette[pIdx[i / width]];
+					((Uint16 *)ref)[64 + i] = palette[pIdx[i / width]];
+				}
+				else
+				{
+					ref[i] = ref[32 + i] = palette[pIdx[i / width]];
+				}
+			}
+			if (bpp == 16)
+				Convert_SimdPlot16Bit((Uint16 *)out, idx, width, 64);
+			else
+				Convert_SimdPlot32Bit(out, idx, width, 32);
+			if (memcmp(out, ref, sizeof(out)) != 0)
+				return;
+		}
+	}
+	bConvertUseSimd = true;
+}
+
+#endif	/* CONVERT_SIMD_SSSE3 || CONVERT_SIMD_NEON */
+
+#endif	/* HATARI_CONVERTSIMD_H */
@@ -13,16 +13,18 @@ static void ConvertVDIRes_16Colour(void)
 	Uint32 *esi;
 	Uint32 eax, edx;	/* set & used by macros */
 	Uint32 ebx, ecx;
-	int y, x, update;
+	int y, x, update, end;
 
 	/* Get screen addresses, 'edi'-ST screen, 'ebp'-Previous ST screen,
 	 * 'esi'-PC screen */
 
-	edi = (Uint32 *)pSTScreen;        /* ST format screen 4-plane 16 colors */
-	ebp = (Uint32 *)pSTScreenCopy;    /* Previous ST format screen */
 	update = ScrUpdateFlag & PALETTEMASK_UPDATEMASK;
+	y = Screen_GetVDIRows(update, &end);
 
-	for (y = 0; y < VDIHeight; y++)
+	edi = (Uint32 *)(pSTScreen + y*STScreenWidthBytes);        /* ST format screen 4-plane 16 colors */
+	ebp = (Uint32 *)(pSTScreenCopy + y*STScreenWidthBytes);    /* Previous ST format screen */
+
+	for ( ; y < end; y++)
 	{
 
 		esi = (Uint32 *)pPCScreenDest;  /* PC format screen, byte per pixel 256 colors */
@@ -38,7 +40,7 @@ static void ConvertVDIRes_16Colour(void)
 			/* Full update? or just test changes? */
 			if (update || ebx != *ebp || ecx != *(ebp+1))   /* Does differ? */
 			{
-				bScreenContentsChanged = true;
+				Screen_VDIRowChanged(y);
 
 #if SDL_BYTEORDER == SDL_BIG_ENDIAN
 				/* Plot pixels */
@@ -13,13 +13,15 @@ static void ConvertVDIRes_2Colour(void)
 	Uint16 *edi, *ebp;
 	Uint32 *esi;
 	Uint16 eax, ebx;
-	int y, x, update;
+	int y, x, update, end;
 
-	edi = (Uint16 *)pSTScreen;            /* ST format screen */
-	ebp = (Uint16 *)pSTScreenCopy;        /* Previous ST format screen */
 	update = ScrUpdateFlag & PALETTEMASK_UPDATEMASK;
+	y = Screen_GetVDIRows(update, &end);
 
-	for (y = 0; y < VDIHeight; y++)
+	edi = (Uint16 *)(pSTScreen + y*STScreenWidthBytes);            /* ST format screen */
+	ebp = (Uint16 *)(pSTScreenCopy + y*STScreenWidthBytes);        /* Previous ST format screen */
+
+	for ( ; y < end; y++)
 	{
 
 		esi = (Uint32 *)pPCScreenDest;  /* PC format screen, byte per pixel 256 colors */
@@ -33,7 +35,7 @@ static void ConvertVDIRes_2Colour(void)
 
 			if (update || ebx != *ebp)  /* Does differ? */
 			{
-				bScreenContentsChanged = true;
+				Screen_VDIRowChanged(y);
 
 #if SDL_BYTEORDER == SDL_BIG_ENDIAN
 				/* Plot in 'right-order' on big endian systems */
@@ -13,14 +13,16 @@ static void ConvertVDIRes_4Colour(void)
 	Uint32 *edi, *ebp;
 	Uint32 *esi;
 	Uint32 eax, ebx, ecx;
-	int y, x, update;
+	int y, x, update, end;
 
 	/* Get screen addresses, 'edi'-ST screen, 'ebp'-Previous ST screen, 'esi'-PC screen */
-	edi = (Uint32 *)pSTScreen;          /* ST format screen 2-plane 4 colors */
-	ebp = (Uint32 *)pSTScreenCopy;      /* Previous ST format screen */
 	update = ScrUpdateFlag & PALETTEMASK_UPDATEMASK;
+	y = Screen_GetVDIRows(update, &end);
 
-	for (y = 0; y < VDIHeight; y++)
+	edi = (Uint32 *)(pSTScreen + y*STScreenWidthBytes);          /* ST format screen 2-plane 4 colors */
+	ebp = (Uint32 *)(pSTScreenCopy + y*STScreenWidthBytes);      /* Previous ST format screen */
+
+	for ( ; y < end; y++)
 	{
 
 		esi = (Uint32 *)pPCScreenDest;  /* PC format screen, byte per pixel 256 colors */
@@ -34,7 +36,7 @@ static void ConvertVDIRes_4Colour(void)
 
 			if (update || ebx != *ebp)  /* Update? */
 			{
-				bScreenContentsChanged = true;
+				Screen_VDIRowChanged(y);
 
 				/* Plot pixels */
 #if SDL_BYTEORDER == SDL_BIG_ENDIAN
@@ -59,6 +59,9 @@ char table_letter[4] = {'A','B','C','D'};
 /* ATC struct */
 #define ATC030_NUM_ENTRIES  22
 
+/* Host side lookup table in front of the ATC, must be a power of 2 */
+#define ATC030_FRONT_ENTRIES  64
+
 typedef struct {
     struct {
         uaecptr addr;
@@ -105,6 +108,15 @@ struct {
     
     /* Address translation cache */
     MMU030_ATC_LINE atc[ATC030_NUM_ENTRIES];
+    int atc_mru_count;  /* number of set history bits */
+    
+    /* Direct mapped (FC, logical page) -> ATC entry lookup. It only
+     * remembers which entry the linear ATC search found, so it has to
+     * be dropped whenever that entry is invalidated or replaced. */
+    struct {
+        uae_u64 key;    /* 0 = unused */
+        int line;
+    } atc_front[ATC030_FRONT_ENTRIES];
     
     /* Condition */
     bool enabled;
@@ -207,6 +219,7 @@ void mmu_op30_pmove (uaecptr pc, uae_u32 opcode, uae_u16 next, uaecptr extra)
             else {
                 tc_030 = x_get_long (extra);
                 mmu030_decode_tc(tc_030);
+                mmu030_atc_front_clear();
             }
             break;
         case 0x12: // SRP
@@ -241,6 +254,7 @@ void mmu_op30_pmove (uaecptr pc, uae_u32 opcode, uae_u16 next, uaecptr extra)
             else {
                 tt0_030 = x_get_long (extra);
                 mmu030.transparent.tt0 = mmu030_decode_tt(tt0_030);
+                mmu030_atc_front_clear();
             }
             break;
         case 0x03: // TT1
@@ -249,6 +263,7 @@ void mmu_op30_pmove (uaecptr pc, uae_u32 opcode, uae_u16 next, uaecptr extra)
             else {
                 tt1_030 = x_get_long (extra);
                 mmu030.transparent.tt1 = mmu030_decode_tt(tt1_030);
+                mmu030_atc_front_clear();
             }
             break;
         default:
@@ -393,6 +408,30 @@ uae_u32 mmu_op30_helper_get_fc(uae_u16 next) {
 }
 
 
+/* -- ATC front lookup -- */
+
+static inline uae_u64 mmu030_atc_front_key(uaecptr addr, uae_u32 fc) {
+    return ((uae_u64)(addr & ~mmu030.translation.page.mask) << 4) | (fc << 1) | 1;
+}
+
+static inline int mmu030_atc_front_index(uaecptr addr, uae_u32 fc) {
+    return ((addr >> mmu030.translation.page.size) ^ fc) & (ATC030_FRONT_ENTRIES-1);
+}
+
+/* This function forgets the front lookup of an ATC entry, it has to
+ * be called before the entry is invalidated or overwritten */
+static void mmu030_atc_front_drop(int l) {
+    int slot = mmu030_atc_front_index(mmu030.atc[l].logical.addr, mmu030.atc[l].logical.fc);
+    if (mmu030.atc_front[slot].line == l) {
+        mmu030.atc_front[slot].key = 0;
+    }
+}
+
+void mmu030_atc_front_clear(void) {
+    memset(mmu030.atc_front, 0, sizeof(mmu030.atc_front));
+}
+
+
 /* -- ATC flushing functions -- */
 
 /* This function flushes ATC entries depending on their function code */
@@ -401,6 +440,7 @@ void mmu030_flush_atc_fc(uae_u32 fc_base, uae_u32 fc_mask) {
     for (i=0; i<ATC030_NUM_ENTRIES; i++) {
         if (((fc_base&fc_mask)==(mmu030.atc[i].logical.fc&fc_mask)) &&
             mmu030.atc[i].logical.valid) {
+            mmu030_atc_front_drop(i);
             mmu030.atc[i].logical.valid = false;
             write_log("ATC: Flushing %08X\n", mmu030.atc[i].physical.addr);
         }
@@ -415,6 +455,7 @@ void mmu030_flush_atc_page_fc(uaecptr logical_addr, uae_u32 fc_base, uae_u32 fc_
         if (((fc_base&fc_mask)==(mmu030.atc[i].logical.fc&fc_mask)) &&
             (mmu030.atc[i].logical.addr == logical_addr) &&
             mmu030.atc[i].logical.valid) {
+            mmu030_atc_front_drop(i);
             mmu030.atc[i].logical.valid = false;
             write_log("ATC: Flushing %08X\n", mmu030.atc[i].physical.addr);
         }
@@ -427,6 +468,7 @@ void mmu030_flush_atc_page(uaecptr logical_addr) {
     for (i=0; i<ATC030_NUM_ENTRIES; i++) {
         if ((mmu030.atc[i].logical.addr == logical_addr) &&
             mmu030.atc[i].logical.valid) {
+            mmu030_atc_front_drop(i);
             mmu030.atc[i].logical.valid = false;
             write_log("ATC: Flushing %08X\n", mmu030.atc[i].physical.addr);
         }
@@ -442,6 +484,7 @@ void mmu030_flush_atc_all(void) {
     for (i=0; i<ATC030_NUM_ENTRIES; i++) {
         mmu030.atc[i].logical.valid = false;
     }
+    mmu030_atc_front_clear();
 }
 
 
@@ -546,6 +589,10 @@ int mmu030_match_ttr(uaecptr addr, uae_u32 fc, bool write)
 
     bool cache_inhibit = false; /* TODO: pass to memory access function */
     
+    if (!((tt0_030|tt1_030)&TT_ENABLE)) {
+        return TT_NO_MATCH;
+    }
+    
     tt0 = mmu030_do_match_ttr(tt0_030, mmu030.transparent.tt0, addr, fc, write);
     if (tt0&TT_OK_MATCH) {
         cache_inhibit = (tt0_030&TT_CI) ? true : false;
@@ -1017,7 +1064,7 @@ uae_u32 mmu030_table_search(uaecptr addr, uae_u32 fc, bool write, int level) {
     int descr_num = 0;
     bool early_termination = false;
 
-    int i;
+    int i, slot;
     int old_regs_s;   /* Supervisor status when this function has been called */
 
     old_regs_s = regs.s;
@@ -1374,7 +1421,13 @@ uae_u32 mmu030_table_search(uaecptr addr, uae_u32 fc, bool write, int level) {
     }
     mmu030_atc_handle_history_bit(i);
     
-    /* Create ATC entry */
+    /* Create ATC entry, the linear search may now find it before the
+     * one remembered in the front lookup */
+    mmu030_atc_front_drop(i);
+    slot = mmu030_atc_front_index(addr, fc);
+    if (mmu030.atc_front[slot].key == mmu030_atc_front_key(addr, fc)) {
+        mmu030.atc_front[slot].key = 0;
+    }
     mmu030.atc[i].logical.addr = addr & (~mmu030.translation.page.mask); /* delete page index bits */
     mmu030.atc[i].logical.fc = fc;
     mmu030.atc[i].logical.valid = true;
@@ -1631,8 +1684,19 @@ int mmu030_logical_is_in_atc(uaecptr addr, uae_u32 fc, bool write) {
     uaecptr logical_addr = 0;
     uae_u32 addr_mask = ~mmu030.translation.page.mask;
     uae_u32 page_index = addr & mmu030.translation.page.mask;
+    uae_u64 key = mmu030_atc_front_key(addr, fc);
+    int slot = mmu030_atc_front_index(addr, fc);
     
     int i, j;
+    
+    /* Try the entry found by the last search for this page first */
+    i = mmu030.atc_front[slot].line;
+    if (mmu030.atc_front[slot].key == key &&
+        (mmu030.atc[i].physical.modified || !write)) {
+        mmu030_atc_handle_history_bit(i);
+        return i;
+    }
+    
     for (i=0; i<ATC030_NUM_ENTRIES; i++) {
         logical_addr = mmu030.atc[i].logical.addr;
         /* If actual address matches address in ATC */
@@ -1644,8 +1708,11 @@ int mmu030_logical_is_in_atc(uaecptr addr, uae_u32 fc, bool write) {
             if (mmu030.atc[i].physical.modified || !write) {
                 /* Maintain history bit */
                 mmu030_atc_handle_history_bit(i);
+                mmu030.atc_front[slot].key = key;
+                mmu030.atc_front[slot].line = i;
                 return i;
             } else {
+                mmu030_atc_front_drop(i);
                 mmu030.atc[i].logical.valid = false;
             }
         }
@@ -1655,17 +1722,17 @@ int mmu030_logical_is_in_atc(uaecptr addr, uae_u32 fc, bool write) {
 
 void mmu030_atc_handle_history_bit(int entry_num) {
     int j;
-    mmu030.atc[entry_num].mru = 1;
-    for (j=0; j<ATC030_NUM_ENTRIES; j++) {
-        if (!mmu030.atc[j].mru)
-            break;
+    if (!mmu030.atc[entry_num].mru) {
+        mmu030.atc[entry_num].mru = 1;
+        mmu030.atc_mru_count++;
     }
     /* If there are no more zero-bits, reset all */
-    if (j==ATC030_NUM_ENTRIES) {
+    if (mmu030.atc_mru_count==ATC030_NUM_ENTRIES) {
         for (j=0; j<ATC030_NUM_ENTRIES; j++) {
             mmu030.atc[j].mru = 0;
         }
         mmu030.atc[entry_num].mru = 1;
+        mmu030.atc_mru_count = 1;
 #if MMU030_ATC_DBG_MSG
         write_log("ATC: No more history zero-bits. Reset all.\n");
 #endif
@@ -236,10 +236,10 @@ static void returncycles (const char *s, int cycles)
 		// The next "else" should be removed too and only the printf line should be keept.
 		if (instr_table == TABLE_FALCON_CYCLES && table_falcon_cycles[instr_index].cache_cycles == 0) {
 			// set a temporary false value for this instruction cycles timing.
-			printf ("\tregs.ce030_instr_cycles = table_falcon_cycles[0];\n");
+			printf ("\tregs.ce030_instr_cycles = &table_falcon_cycles[0];\n");
 		}
 		else {
-			printf ("%s\tregs.ce030_instr_cycles = %s[%d];\n", s, falcon_cycles_tables[instr_table], instr_table_index);
+			printf ("%s\tregs.ce030_instr_cycles = &%s[%d];\n", s, falcon_cycles_tables[instr_table], instr_table_index);
 		}
 
 		printf ("%s\treturn;\n", s);
@@ -2607,7 +2607,7 @@ static void gen_opcode (unsigned long int opcode)
 
 		printf ("\t\tif (src) {\n");
 		if (using_ce020 == 2)
-			printf ("\t\t\tregs.ce030_instr_cycles = table_falcon_cycles_DBcc[0];\n");
+			printf ("\t\t\tregs.ce030_instr_cycles = &table_falcon_cycles_DBcc[0];\n");
 
 		if (using_exception_3) {
 			printf ("\t\t\tif (offs & 1) {\n");
@@ -2623,10 +2623,10 @@ static void gen_opcode (unsigned long int opcode)
 			printf ("\t\t\treturn;\n");
 		printf ("\t\t}\n");
 		if (using_ce020 == 2)
-			printf ("\t\tregs.ce030_instr_cycles = table_falcon_cycles_DBcc[1];\n");
+			printf ("\t\tregs.ce030_instr_cycles = &table_falcon_cycles_DBcc[1];\n");
 		printf ("\t} else {\n");
 		if (using_ce020 == 2)
-			printf ("\t\tregs.ce030_instr_cycles = table_falcon_cycles_DBcc[2];\n");
+			printf ("\t\tregs.ce030_instr_cycles = &table_falcon_cycles_DBcc[2];\n");
 
 		addcycles000_2 ("\t\t", 2);
 		printf ("\t}\n");
@@ -2874,11 +2874,11 @@ static void gen_opcode (unsigned long int opcode)
 		else {
 			if (using_ce020 == 2){
 				no_return_cycles = true;
-				printf ("\t\tregs.ce030_instr_cycles = table_falcon_cycles_ASR[1];\n");
+				printf ("\t\tregs.ce030_instr_cycles = &table_falcon_cycles_ASR[1];\n");
 			}
 			printf ("\t} else if (cnt > 0) {\n");
 			if (using_ce020 == 2)
-				printf ("\t\tregs.ce030_instr_cycles = table_falcon_cycles_ASR[0];\n");
+				printf ("\t\tregs.ce030_instr_cycles = &table_falcon_cycles_ASR[0];\n");
 		}
 		printf ("\t\tval >>= cnt - 1;\n");
 		printf ("\t\tSET_CFLG (val & 1);\n");
@@ -2956,11 +2956,11 @@ static void gen_opcode (unsigned long int opcode)
 		else {
 			if (using_ce020 == 2){
 				no_return_cycles = true;
-				printf ("\t\tregs.ce030_instr_cycles = table_falcon_cycles_LSD[1];\n");
+				printf ("\t\tregs.ce030_instr_cycles = &table_falcon_cycles_LSD[1];\n");
 			}
 			printf ("\t} else if (cnt > 0) {\n");
 			if (using_ce020 == 2)
-				printf ("\t\tregs.ce030_instr_cycles = table_falcon_cycles_LSD[0];\n");
+				printf ("\t\tregs.ce030_instr_cycles = &table_falcon_cycles_LSD[0];\n");
 		}
 		printf ("\t\tval >>= cnt - 1;\n");
 		printf ("\t\tSET_CFLG (val & 1);\n");
@@ -2994,11 +2994,11 @@ static void gen_opcode (unsigned long int opcode)
 		else {
 			if (using_ce020 == 2){
 				no_return_cycles = true;
-				printf ("\t\tregs.ce030_instr_cycles = table_falcon_cycles_LSD[1];\n");
+				printf ("\t\tregs.ce030_instr_cycles = &table_falcon_cycles_LSD[1];\n");
 			}
 			printf ("\t} else if (cnt > 0) {\n");
 			if (using_ce020 == 2)
-				printf ("\t\tregs.ce030_instr_cycles = table_falcon_cycles_LSD[0];\n");
+				printf ("\t\tregs.ce030_instr_cycles = &table_falcon_cycles_LSD[0];\n");
 		}
 		printf ("\t\tval <<= (cnt - 1);\n");
 		printf ("\t\tSET_CFLG ((val & %s) >> %d);\n", cmask (curi->size), bit_size (curi->size) - 1);
@@ -3300,9 +3300,9 @@ static void gen_opcode (unsigned long int opcode)
 		if (using_ce020 == 2) {
 			no_return_cycles = true;
 			printf ("\tif((src & 0xFFF) < 3)\n");
-			printf ("\t\tregs.ce030_instr_cycles = table_falcon_cycles_MOVEC[1];\n");
+			printf ("\t\tregs.ce030_instr_cycles = &table_falcon_cycles_MOVEC[1];\n");
 			printf ("\telse\n");
-			printf ("\t\tregs.ce030_instr_cycles = table_falcon_cycles_MOVEC[0];\n");
+			printf ("\t\tregs.ce030_instr_cycles = &table_falcon_cycles_MOVEC[0];\n");
 		}
 		break;
 	case i_CAS:
@@ -3338,13 +3338,13 @@ static void gen_opcode (unsigned long int opcode)
 			start_brace ();
 			genastore ("(m68k_dreg (regs, ru))", curi->dmode, "dstreg", curi->size, "dst");
 			if (using_ce020 == 2)
-				printf ("\tregs.ce030_instr_cycles = %s[%d];\n", falcon_cycles_tables[instr_table], instr_table_index);
+				printf ("\tregs.ce030_instr_cycles = &%s[%d];\n", falcon_cycles_tables[instr_table], instr_table_index);
 			pop_braces (old_brace_level);
 			printf ("else");
 			start_brace ();
 			printf ("m68k_dreg (regs, rc) = dst;\n");
 			if (using_ce020 == 2)
-				printf ("\tregs.ce030_instr_cycles = %s[%d];\n", falcon_cycles_tables[instr_table], instr_table_index + 1);
+				printf ("\tregs.ce030_instr_cycles = &%s[%d];\n", falcon_cycles_tables[instr_table], instr_table_index + 1);
 			pop_braces (old_brace_level);
 		}
 		break;
@@ -3446,9 +3446,9 @@ static void gen_opcode (unsigned long int opcode)
 		if (using_ce020 == 2) {
 			no_return_cycles = true;
 			printf ("\tif (extra & 0x800)\n");
-			printf ("\t\tregs.ce030_instr_cycles = table_falcon_cycles_DIVS_L[%d];\n", divl_index);
+			printf ("\t\tregs.ce030_instr_cycles = &table_falcon_cycles_DIVS_L[%d];\n", divl_index);
 			printf ("\telse\n");
-			printf ("\t\tregs.ce030_instr_cycles = table_falcon_cycles_DIVU_L[%d];\n", divl_index);
+			printf ("\t\tregs.ce030_instr_cycles = &table_falcon_cycles_DIVU_L[%d];\n", divl_index);
 			divl_index ++;
 		}
 		break;
@@ -37,6 +37,7 @@ static int illegal_count = 50;
 
 static uae_u32 STmem_size, TTmem_size = 0;
 static uae_u32 TTmem_mask;
+static uae_u32 TTmem_allocated;
 
 #define STmem_start  0x00000000
 #define ROMmem_start 0x00E00000
@@ -60,6 +61,9 @@ addrbank *mem_banks[65536];
 addrbank mem_banks[65536];
 #endif
 
+uae_u8 *mem_read_host[65536];
+uae_u8 *mem_write_host[65536];
+
 #ifdef NO_INLINE_MEMORY_ACCESS
 __inline__ uae_u32 longget (uaecptr addr)
 {
@@ -384,6 +388,143 @@ static void SysMem_bput(uaecptr addr, uae_u32 b)
 }
 
 
+/*
+ * **** ST RAM with dirty page tracking ****
+ * These banks replace the normal ST RAM banks while dirty page tracking
+ * is enabled (see STMemory_SetDirtyTracking()), so that the normal RAM
+ * write paths don't need to check for it.
+ */
+static void STmem_dirty_lput(uaecptr addr, uae_u32 l)
+{
+    STMemory_MarkDirtyPage(addr);
+    STMemory_MarkDirtyPage(addr + 3);
+    STmem_lput(addr, l);
+}
+
+static void STmem_dirty_wput(uaecptr addr, uae_u32 w)
+{
+    STMemory_MarkDirtyPage(addr);
+    STMemory_MarkDirtyPage(addr + 1);
+    STmem_wput(addr, w);
+}
+
+static void STmem_dirty_bput(uaecptr addr, uae_u32 b)
+{
+    STMemory_MarkDirtyPage(addr);
+    STmem_bput(addr, b);
+}
+
+static void SysMem_dirty_lput(uaecptr addr, uae_u32 l)
+{
+    STMemory_MarkDirtyPage(addr);
+    STMemory_MarkDirtyPage(addr + 3);
+    SysMem_lput(addr, l);
+}
+
+static void SysMem_dirty_wput(uaecptr addr, uae_u32 w)
+{
+    STMemory_MarkDirtyPage(addr);
+    STMemory_MarkDirtyPage(addr + 1);
+    SysMem_wput(addr, w);
+}
+
+static void SysMem_dirty_bput(uaecptr addr, uae_u32 b)
+{
+    STMemory_MarkDirtyPage(addr);
+    SysMem_bput(addr, b);
+}
+
+
+/*
+ * **** Memory write watching and access recording ****
+ * Watched (24-bit) banks are replaced by the WatchMem bank, which forwards
+ * all accesses to the original bank and reports writes to the watch
+ * handler, see memory_watch_bank().  While an access handler is set, all
+ * ST RAM and IO banks are replaced by it too, and it reports all their
+ * reads and writes to the access handler, see memory_set_access_handler().
+ * Other banks keep their full speed.
+ */
+static void (*watch_handler)(uaecptr addr, int size);
+static void (*access_handler)(uaecptr addr, int size, bool bWrite);
+static addrbank *watch_orig_banks[0x100];	/* NULL when bank isn't replaced */
+static bool watch_writes[0x100];		/* bank is watched for writes */
+
+#define watch_orig(addr) (watch_orig_banks[bankindex(addr) & 0xff])
+
+static inline void watch_access(uaecptr addr, int size, bool bWrite)
+{
+    if (access_handler)
+	access_handler(addr, size, bWrite);
+}
+
+static inline void watch_write(uaecptr addr, int size)
+{
+    if (watch_writes[bankindex(addr) & 0xff])
+	watch_handler(addr, size);
+}
+
+static uae_u32 WatchMem_lget(uaecptr addr)
+{
+    watch_access(addr, 4, false);
+    return watch_orig(addr)->lget(addr);
+}
+
+static uae_u32 WatchMem_wget(uaecptr addr)
+{
+    watch_access(addr, 2, false);
+    return watch_orig(addr)->wget(addr);
+}
+
+static uae_u32 WatchMem_bget(uaecptr addr)
+{
+    watch_access(addr, 1, false);
+    return watch_orig(addr)->bget(addr);
+}
+
+static uae_u32 WatchMem_lgeti(uaecptr addr)
+{
+    watch_access(addr, 4, false);
+    return watch_orig(addr)->lgeti(addr);
+}
+
+static uae_u32 WatchMem_wgeti(uaecptr addr)
+{
+    watch_access(addr, 2, false);
+    return watch_orig(addr)->wgeti(addr);
+}
+
+static void WatchMem_lput(uaecptr addr, uae_u32 l)
+{
+    watch_orig(addr)->lput(addr, l);
+    watch_access(addr, 4, true);
+    watch_write(addr, 4);
+}
+
+static void WatchMem_wput(uaecptr addr, uae_u32 w)
+{
+    watch_orig(addr)->wput(addr, w);
+    watch_access(addr, 2, true);
+    watch_write(addr, 2);
+}
+
+static void WatchMem_bput(uaecptr addr, uae_u32 b)
+{
+    watch_orig(addr)->bput(addr, b);
+    watch_access(addr, 1, true);
+    watch_write(addr, 1);
+}
+
+static int WatchMem_check(uaecptr addr, uae_u32 size)
+{
+    return watch_orig(addr)->check(addr, size);
+}
+
+static uae_u8 *WatchMem_xlate(uaecptr addr)
+{
+    return watch_orig(addr)->xlateaddr(addr);
+}
+
+
 /*
  * **** Void memory ****
  * Between the ST-RAM end and the 4 MB barrier, there is a void memory space:
@@ -636,6 +777,22 @@ static addrbank SysMem_bank =
     SysMem_lget, SysMem_wget, ABFLAG_ROM
 };
 
+static addrbank STmem_dirty_bank =
+{
+    STmem_lget, STmem_wget, STmem_bget,
+    STmem_dirty_lput, STmem_dirty_wput, STmem_dirty_bput,
+    STmem_xlate, STmem_check, NULL, "ST memory",
+    STmem_lget, STmem_wget, ABFLAG_RAM
+};
+
+static addrbank SysMem_dirty_bank =
+{
+    SysMem_lget, SysMem_wget, SysMem_bget,
+    SysMem_dirty_lput, SysMem_dirty_wput, SysMem_dirty_bput,
+    STmem_xlate, STmem_check, NULL, "Sys memory",
+    SysMem_lget, SysMem_wget, ABFLAG_ROM
+};
+
 static addrbank VoidMem_bank =
 {
     VoidMem_lget, VoidMem_wget, VoidMem_bget,
@@ -676,6 +833,137 @@ static addrbank IOmem_bank =
     IoMem_lget, IoMem_wget, ABFLAG_RAM
 };
 
+static addrbank WatchMem_bank =
+{
+    WatchMem_lget, WatchMem_wget, WatchMem_bget,
+    WatchMem_lput, WatchMem_wput, WatchMem_bput,
+    WatchMem_xlate, WatchMem_check, NULL, "Watched memory",
+    WatchMem_lgeti, WatchMem_wgeti, ABFLAG_NONE
+};
+
+
+
+static bool bDirtyTracking;
+
+/*
+ * Return true if accesses to the given bank are recorded, i.e. it's
+ * ST RAM or IO memory and there's an access handler.
+ */
+static bool access_bank(int bnr)
+{
+    return access_handler
+	   && ((uae_u32)bnr << 16 < STmem_size || bnr == (IOmem_start >> 16 & 0xff));
+}
+
+/*
+ * Replace the given bank with the WatchMem bank, unless it already is.
+ */
+static void watch_bank(int bnr)
+{
+    if (watch_orig_banks[bnr])
+	return;
+    watch_orig_banks[bnr] = &get_mem_bank(bnr << 16);
+    map_banks(&WatchMem_bank, bnr, 1);
+}
+
+/*
+ * Restore the original bank on replaced banks which aren't watched
+ * or recorded anymore.
+ */
+static void unwatch_banks(void)
+{
+    int bnr;
+
+    for (bnr = 0; bnr < 0x100; bnr++) {
+	if (watch_orig_banks[bnr] && !watch_writes[bnr] && !access_bank(bnr)) {
+	    map_banks(watch_orig_banks[bnr], bnr, 1);
+	    watch_orig_banks[bnr] = NULL;
+	}
+    }
+}
+
+/*
+ * Put the WatchMem bank back on watched banks which were re-mapped,
+ * they now forward to the newly mapped bank.  Recorded banks are
+ * replaced too.
+ */
+static void rewatch_banks(void)
+{
+    int bnr;
+
+    for (bnr = 0; bnr < 0x100; bnr++) {
+	if (!watch_orig_banks[bnr] || &get_mem_bank(bnr << 16) == &WatchMem_bank)
+	    continue;
+	watch_orig_banks[bnr] = &get_mem_bank(bnr << 16);
+	map_banks(&WatchMem_bank, bnr, 1);
+    }
+    for (bnr = 0; bnr < 0x100; bnr++) {
+	if (access_bank(bnr))
+	    watch_bank(bnr);
+    }
+}
+
+/*
+ * Map ST system RAM and main ST RAM banks, with or without dirty page tracking.
+ */
+static void map_STram_banks(void)
+{
+    map_banks(bDirtyTracking ? &SysMem_dirty_bank : &SysMem_bank, 0x00, 1);
+    map_banks(bDirtyTracking ? &STmem_dirty_bank : &STmem_bank, 0x01, (STmem_size >> 16) - 1);
+
+    rewatch_banks();
+}
+
+/*
+ * Enable/disable dirty page tracking for CPU writes to ST RAM.
+ */
+void memory_set_dirty_tracking(bool bEnable)
+{
+    bDirtyTracking = bEnable;
+    if (STmem_size)
+	map_STram_banks();
+}
+
+/*
+ * Set the function called after every CPU write to a watched bank,
+ * with the written address and size.  Any previously watched banks
+ * are restored to their original bank, NULL handler disables watching.
+ */
+void memory_set_watch_handler(void (*handler)(uaecptr addr, int size))
+{
+    memset(watch_writes, 0, sizeof(watch_writes));
+    unwatch_banks();
+    watch_handler = handler;
+}
+
+/*
+ * Watch CPU writes to the 64 KiB bank containing the given address.
+ * Writes which don't go through the memory banks (e.g. DMA) aren't seen.
+ */
+void memory_watch_bank(uaecptr addr)
+{
+    int bnr = bankindex(addr) & 0xff;
+
+    if (!watch_handler || watch_writes[bnr])
+	return;
+    watch_writes[bnr] = true;
+    watch_bank(bnr);
+}
+
+/*
+ * Set the function called on every CPU read and write of ST RAM and
+ * IO memory, with the accessed address, size and whether it was
+ * a write.  Reads include the instruction fetches, but accesses which
+ * don't go through the memory banks (e.g. DMA) aren't seen.
+ * NULL handler disables recording.
+ */
+void memory_set_access_handler(void (*handler)(uaecptr addr, int size, bool bWrite))
+{
+    access_handler = handler;
+    unwatch_banks();
+    if (STmem_size)
+	rewatch_banks();
+}
 
 
 static void init_mem_banks (void)
@@ -683,6 +971,8 @@ static void init_mem_banks (void)
     int i;
     for (i = 0; i < 65536; i++)
 	put_mem_bank (i<<16, &dummy_bank);
+    memset(mem_read_host, 0, sizeof(mem_read_host));
+    memset(mem_write_host, 0, sizeof(mem_write_host));
 }
 
 
@@ -735,23 +1025,30 @@ void memory_init(uae_u32 nNewSTMemSize, uae_u32 nNewTTMemSize, uae_u32 nNewRomMe
 
     init_mem_banks();
 
-    /* Map the ST system RAM: */
-    map_banks(&SysMem_bank, 0x00, 1);
     /* Between STRamEnd and 4MB barrier, there is void space: */
     map_banks(&VoidMem_bank, 0x08, 0x38);
     /* Space between 4MB barrier and TOS ROM causes a bus error: */
     map_banks(&BusErrMem_bank, 0x400000 >> 16, 0xA0);
-    /* Now map main ST RAM, overwriting the void and bus error regions if necessary: */
-    map_banks(&STmem_bank, 0x01, (STmem_size >> 16) - 1);
-
-    /* TT memory isn't really supported yet */
-    if (TTmem_size > 0)
-	TTmemory = (uae_u8 *)malloc (TTmem_size);
-    if (TTmemory != 0)
-	map_banks (&TTmem_bank, TTmem_start >> 16, TTmem_size >> 16);
-    else
+    /* Now map ST system RAM and main ST RAM, overwriting the void and bus error regions if necessary: */
+    map_STram_banks();
+
+    /* TT memory isn't really supported yet. It's kept over resets when
+     * its size doesn't change, and then cleared by giving its pages back
+     * to the host, so only the parts which get used cost host memory. */
+    if (TTmemory && TTmem_size != TTmem_allocated) {
+	STMemory_FreeLarge(TTmemory, TTmem_allocated);
+	TTmemory = NULL;
+    }
+    if (TTmemory)
+	STMemory_ClearLarge(TTmemory, TTmem_size);
+    else if (TTmem_size > 0)
+	TTmemory = (uae_u8 *)STMemory_AllocLarge(TTmem_size);
+    TTmem_allocated = TTmemory ? TTmem_size : 0;
+    if (TTmemory == 0)
 	TTmem_size = 0;
     TTmem_mask = TTmem_size - 1;
+    if (TTmem_size > 0)
+	map_banks (&TTmem_bank, TTmem_start >> 16, TTmem_size >> 16);
 
     /* ROM memory: */
     /* Depending on which ROM version we are using, the other ROM region is illegal! */
@@ -782,6 +1079,9 @@ void memory_init(uae_u32 nNewSTMemSize, uae_u32 nNewTTMemSize, uae_u32 nNewRomMe
     /* Illegal memory regions cause a bus error on the ST: */
     map_banks(&BusErrMem_bank, 0xF10000 >> 16, 0x9);
 
+    /* Debugger memory watches: */
+    rewatch_banks();
+
     illegal_count = 50;
 }
 
@@ -792,10 +1092,9 @@ void memory_init(uae_u32 nNewSTMemSize, uae_u32 nNewTTMemSize, uae_u32 nNewRomMe
 void memory_uninit (void)
 {
     /* Here, we free allocated memory from memory_init */
-    if (TTmem_size > 0) {
-	free(TTmemory);
-	TTmemory = NULL;
-    }
+    STMemory_FreeLarge(TTmemory, TTmem_allocated);
+    TTmemory = NULL;
+    TTmem_allocated = 0;
 
 #if ENABLE_SMALL_MEM
 
@@ -813,22 +1112,43 @@ void memory_uninit (void)
 }
 
 
+/*
+ * Set the host memory pointers of a bank, for the banks whose accesses
+ * have no side effects (no bus errors, write protection, dirty page
+ * tracking or watches).
+ */
+static void map_host_bank(addrbank *bank, int bnr)
+{
+    uaecptr addr = bnr << 16;
+    bool bRead, bWrite;
+
+    bWrite = (bank == &STmem_bank || bank == &TTmem_bank);
+    bRead = (bWrite || bank == &STmem_dirty_bank || bank == &ROMmem_bank);
+
+    mem_read_host[bnr] = bRead ? bank->xlateaddr(addr) : NULL;
+    mem_write_host[bnr] = bWrite ? bank->xlateaddr(addr) : NULL;
+}
+
 void map_banks (addrbank *bank, int start, int size)
 {
     int bnr;
     unsigned long int hioffs = 0, endhioffs = 0x100;
 
     if (start >= 0x100) {
-	for (bnr = start; bnr < start + size; bnr++)
+	for (bnr = start; bnr < start + size; bnr++) {
 	    put_mem_bank (bnr << 16, bank);
+	    map_host_bank (bank, bnr);
+	}
 	return;
     }
     /* Some ROMs apparently require a 24 bit address space... */
     if (currprefs.address_space_24)
 	endhioffs = 0x10000;
     for (hioffs = 0; hioffs < endhioffs; hioffs += 0x100)
-	for (bnr = start; bnr < start+size; bnr++)
+	for (bnr = start; bnr < start+size; bnr++) {
 	    put_mem_bank ((bnr + hioffs) << 16, bank);
+	    map_host_bank (bank, bnr + hioffs);
+	}
 }
 
 void memory_hardreset (void)
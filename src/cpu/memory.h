@@ -91,8 +91,19 @@ extern addrbank mem_banks[65536];
 #define put_mem_bank(addr, b) (mem_banks[bankindex(addr)] = *(b))
 #endif
 
+/* Host memory behind the banks which can be accessed directly (RAM and
+ * ROM reads without side effects), NULL when the bank functions need to
+ * be called.  Entries point to the start of the 64 KiB bank and are
+ * updated by map_banks(). */
+extern uae_u8 *mem_read_host[65536];
+extern uae_u8 *mem_write_host[65536];
+
 extern void memory_init(uae_u32 nNewSTMemSize, uae_u32 nNewTTMemSize, uae_u32 nNewRomMemStart);
 extern void memory_uninit (void);
+extern void memory_set_dirty_tracking(bool bEnable);
+extern void memory_set_watch_handler(void (*handler)(uaecptr addr, int size));
+extern void memory_watch_bank(uaecptr addr);
+extern void memory_set_access_handler(void (*handler)(uaecptr addr, int size, bool bWrite));
 extern void map_banks(addrbank *bank, int first, int count);
 
 #ifndef NO_INLINE_MEMORY_ACCESS
@@ -128,32 +139,53 @@ extern void byteput(uaecptr addr, uae_u32 b);
 
 static inline uae_u32 get_long(uaecptr addr)
 {
+    uae_u8 *host = mem_read_host[bankindex(addr)];
+    if (host)
+	return do_get_mem_long(host + (addr & 0xffff));
     return longget(addr);
 }
 
 static inline uae_u32 get_word(uaecptr addr)
 {
+    uae_u8 *host = mem_read_host[bankindex(addr)];
+    if (host)
+	return do_get_mem_word(host + (addr & 0xffff));
     return wordget(addr);
 }
 
 static inline uae_u32 get_byte(uaecptr addr)
 {
+    uae_u8 *host = mem_read_host[bankindex(addr)];
+    if (host)
+	return host[addr & 0xffff];
     return byteget(addr);
 }
 
 static inline void put_long(uaecptr addr, uae_u32 l)
 {
-    longput(addr, l);
+    uae_u8 *host = mem_write_host[bankindex(addr)];
+    if (host)
+	do_put_mem_long(host + (addr & 0xffff), l);
+    else
+	longput(addr, l);
 }
 
 static inline void put_word(uaecptr addr, uae_u32 w)
 {
-    wordput(addr, w);
+    uae_u8 *host = mem_write_host[bankindex(addr)];
+    if (host)
+	do_put_mem_word(host + (addr & 0xffff), w);
+    else
+	wordput(addr, w);
 }
 
 static inline void put_byte(uaecptr addr, uae_u32 b)
 {
-    byteput(addr, b);
+    uae_u8 *host = mem_write_host[bankindex(addr)];
+    if (host)
+	host[addr & 0xffff] = b;
+    else
+	byteput(addr, b);
 }
 
 static inline uae_u8 *get_real_address(uaecptr addr)
@@ -168,11 +200,17 @@ static inline int valid_address(uaecptr addr, uae_u32 size)
 
 static inline uae_u32 get_longi(uaecptr addr)
 {
+	uae_u8 *host = mem_read_host[bankindex(addr)];
+	if (host)
+		return do_get_mem_long(host + (addr & 0xffff));
 	return longgeti (addr);
 }
 
 static inline uae_u32 get_wordi(uaecptr addr)
 {
+	uae_u8 *host = mem_read_host[bankindex(addr)];
+	if (host)
+		return do_get_mem_word(host + (addr & 0xffff));
 	return wordgeti (addr);
 }
 
@@ -74,6 +74,13 @@ unsigned long irqcycles[15];
 int irqdelay[15];
 int mmu_enabled, mmu_triggered;
 int cpu_cycles;
+
+/* Set when m68k_go() returned at the end of a frame, before the
+ * processing of the current instruction was complete */
+static bool frame_ended;
+/* Run function that was interrupted by the end of the frame */
+static void (*frame_run_func)(void);
+
 static int baseclock;
 int cpucycleunit;
 
@@ -86,8 +93,6 @@ int movem_next[256];
 
 cpuop_func *cpufunctbl[65536];
 
-int OpcodeFamily;
-int BusCyclePenalty = 0;
 
 
 /* Amiga's specific variables, required to compile until all Amiga stuffs are ignored */
@@ -108,9 +113,27 @@ uae_u16 mmusr_030;
 static struct cache020 caches020[CACHELINES020];
 static struct cache030 icaches030[CACHELINES030];
 static struct cache030 dcaches030[CACHELINES030];
+/* 68030 cache generations, kept in the unused tag bits 1-7 so that
+ * lines filled before the last cache clear don't match any more */
+#define CACHE030_GEN_STEP 0x02
+#define CACHE030_GEN_MASK 0xfe
+static uae_u32 icache030_gen, dcache030_gen;
 static struct cache040 caches040[CACHESETS040];
 static void InterruptAddJitter (int Level , int Pending);
 
+/* Invalidate all lines of a 68030 cache by starting a new generation,
+ * the lines only need clearing when the generation wraps around */
+static void flush_cache030 (struct cache030 *cp, uae_u32 *gen)
+{
+	int i;
+
+	*gen = (*gen + CACHE030_GEN_STEP) & CACHE030_GEN_MASK;
+	if (*gen == 0) {
+		for (i = 0; i < CACHELINES030; i++)
+			cp[i].valid = 0;
+	}
+}
+
 static void m68k_disasm_2 (FILE *f, uaecptr addr, uaecptr *nextpc, int cnt, uae_u32 *seaddr, uae_u32 *deaddr, int safemode);
 
 
@@ -274,28 +297,18 @@ static void set_cpu_caches (void)
 	} else if (currprefs.cpu_model == 68030) {
 		//regs.cacr |= 0x100;
 		if (regs.cacr & 0x08) { // clear instr cache
-			for (i = 0; i < CACHELINES030; i++) {
-				icaches030[i].valid[0] = 0;
-				icaches030[i].valid[1] = 0;
-				icaches030[i].valid[2] = 0;
-				icaches030[i].valid[3] = 0;
-			}
+			flush_cache030 (icaches030, &icache030_gen);
 		}
 		if (regs.cacr & 0x04) { // clear entry in instr cache
-			icaches030[(caar >> 4) & (CACHELINES030 - 1)].valid[(caar >> 2) & 3] = 0;
+			icaches030[(caar >> 4) & (CACHELINES030 - 1)].valid &= ~(1 << ((caar >> 2) & 3));
 			regs.cacr &= ~0x04;
 		}
 		if (regs.cacr & 0x800) { // clear data cache
-			for (i = 0; i < CACHELINES030; i++) {
-				dcaches030[i].valid[0] = 0;
-				dcaches030[i].valid[1] = 0;
-				dcaches030[i].valid[2] = 0;
-				dcaches030[i].valid[3] = 0;
-			}
+			flush_cache030 (dcaches030, &dcache030_gen);
 			regs.cacr &= ~0x800;
 		}
 		if (regs.cacr & 0x400) { // clear entry in data cache
-			dcaches030[(caar >> 4) & (CACHELINES030 - 1)].valid[(caar >> 2) & 3] = 0;
+			dcaches030[(caar >> 4) & (CACHELINES030 - 1)].valid &= ~(1 << ((caar >> 2) & 3));
 			regs.cacr &= ~0x400;
 		}
 	} else if (currprefs.cpu_model == 68040) {
@@ -1456,6 +1469,7 @@ static void Exception_ce000 (int nr, uaecptr oldpc)
 			VDI_OldPC = currpc;
 			currpc = CART_VDI_OPCODE_ADDR;
 		}
+		else if (bVdiAesIntercept && VDI_Accelerate())  return;
 	}
 	else if (nr == 0x2d) {
 		/* Intercept BIOS (Trap #13) calls */
@@ -1688,6 +1702,7 @@ static void Exception_normal (int nr, uaecptr oldpc, int ExceptionSource)
 				VDI_OldPC = currpc;
 				currpc = CART_VDI_OPCODE_ADDR;
 			}
+			else if (bVdiAesIntercept && VDI_Accelerate())  return;
 		}
 		else if (nr == 0x2d) {
 			/* Intercept BIOS (Trap #13) calls */
@@ -1938,7 +1953,8 @@ void REGPARAM2 Exception (int nr, uaecptr oldpc, int ExceptionSource)
 		M68000_AddCycles(CPU_IACK_CYCLES_MFP);
 		CPU_IACK = true;
 		while (PendingInterruptCount <= 0 && PendingInterruptFunction)
-			CALL_VAR(PendingInterruptFunction);
+			CycInt_CallPendingHandler();
+		CycInt_HandlersDone();
 		nr = MFP_ProcessIACK(nr);
 		CPU_IACK = false;
 	}
@@ -1947,7 +1963,8 @@ void REGPARAM2 Exception (int nr, uaecptr oldpc, int ExceptionSource)
 		M68000_AddCycles(CPU_IACK_CYCLES_VIDEO);
 		CPU_IACK = true;
 		while (PendingInterruptCount <= 0 && PendingInterruptFunction)
-			CALL_VAR(PendingInterruptFunction);
+			CycInt_CallPendingHandler();
+		CycInt_HandlersDone();
 		if (MFP_UpdateNeeded == true)
 			MFP_UpdateIRQ(0);			/* update MFP's state if some internal timers related to MFP expired */
 		pendingInterrupts &= ~(1 << (nr - 24));		/* clear HBL or VBL pending bit */
@@ -2426,6 +2443,7 @@ void m68k_reset (int hardreset)
 {
 	regs.spcflags &= SPCFLAG_MODE_CHANGE | SPCFLAG_BRK;
 	regs.ipl = regs.ipl_pin = 0;
+	regs.ce030_instr_cycles = &table_falcon_cycles[0];
 #ifdef SAVESTATE
 	if (savestate_state == STATE_RESTORE || savestate_state == STATE_REWIND) {
 		m68k_setpc (regs.pc);
@@ -2769,69 +2787,20 @@ static bool do_specialties_interrupt (int Pending)
     return false;					/* no interrupt was found */
 }
 
-STATIC_INLINE int do_specialties (int cycles)
+/* Wait in the STOP state for the next matching interrupt.
+ * Returns 1 if the CPU core has to return first (quit, mode change
+ * or end of frame). */
+static int do_specialties_stop (void)
 {
-#ifdef JIT
-	unset_special (SPCFLAG_END_COMPILE);   /* has done its job */
-#endif
-
-#if AMIGA_ONLY
-	while ((regs.spcflags & SPCFLAG_BLTNASTY) && dmaen (DMA_BLITTER) && cycles > 0 && !currprefs.blitter_cycle_exact) {
-		/* Laurent : I don't know if our blitter code should be called here ! */
-		int c = blitnasty ();
-		if (c > 0) {
-			cycles -= c * CYCLE_UNIT * 2;
-			if (cycles < CYCLE_UNIT)
-				cycles = 0;
-		} else
-			c = 4;
-		do_cycles (c * CYCLE_UNIT);
-
-		if (regs.spcflags & SPCFLAG_COPPER)
-			do_copper ();
-	}
-#endif
-
-	if (regs.spcflags & SPCFLAG_BUSERROR) {
-		/* We can not execute bus errors directly in the memory handler
-		* functions since the PC should point to the address of the next
-		* instruction, so we're executing the bus errors here: */
-		unset_special(SPCFLAG_BUSERROR);
-		Exception(2, BusErrorPC, M68000_EXC_SRC_CPU);
-	}
-
-	if(regs.spcflags & SPCFLAG_EXTRA_CYCLES) {
-		/* Add some extra cycles to simulate a wait state */
-		unset_special(SPCFLAG_EXTRA_CYCLES);
-		M68000_AddCycles(nWaitStateCycles);
-		nWaitStateCycles = 0;
-	}
-
-	if (regs.spcflags & SPCFLAG_DOTRACE)
-		Exception (9, last_trace_ad, M68000_EXC_SRC_CPU);
-
-	if (regs.spcflags & SPCFLAG_TRAP) {
-		unset_special (SPCFLAG_TRAP);
-		Exception (3, 0, M68000_EXC_SRC_CPU);
-	}
-
-	/* Handle the STOP instruction */
-	if ( regs.spcflags & SPCFLAG_STOP ) {
-	    /* We first test if there's a pending interrupt that would */
-	    /* allow to immediately leave the STOP state */
-	    if ( do_specialties_interrupt(true) ) {		/* test if there's an interrupt and add pending jitter */
-	        regs.stopped = 0;
-	        unset_special (SPCFLAG_STOP);
-	    }
-
-	    while (regs.spcflags & SPCFLAG_STOP) {
+	while (regs.spcflags & SPCFLAG_STOP) {
 		do_cycles (currprefs.cpu_cycle_exact ? 2 * CYCLE_UNIT : 4 * CYCLE_UNIT);
 		M68000_AddCycles(4);
 
 		/* It is possible one or more ints happen at the same time */
 		/* We must process them during the same cpu cycle then choose the highest priority one */
 		while ( ( PendingInterruptCount <= 0 ) && ( PendingInterruptFunction ) )
-		    CALL_VAR(PendingInterruptFunction);
+		    CycInt_CallPendingHandler();
+		CycInt_HandlersDone();
 		if ( MFP_UpdateNeeded == true )
 		    MFP_UpdateIRQ ( 0 );
 
@@ -2861,6 +2830,9 @@ STATIC_INLINE int do_specialties (int cycles)
 		}
 #endif
 		}
+		/* End of frame: stay in the STOP state, m68k_go() resumes it */
+		if (frame_ended)
+			return 1;
 		if ((regs.spcflags & (SPCFLAG_BRK | SPCFLAG_MODE_CHANGE))) {
 			unset_special (SPCFLAG_BRK | SPCFLAG_MODE_CHANGE);
 			// SPCFLAG_BRK breaks STOP condition, need to prefetch
@@ -2888,7 +2860,68 @@ STATIC_INLINE int do_specialties (int cycles)
 				}
 			}
 		}
+	}
+
+	return 0;
+}
+
+STATIC_INLINE int do_specialties (int cycles)
+{
+#ifdef JIT
+	unset_special (SPCFLAG_END_COMPILE);   /* has done its job */
+#endif
+
+#if AMIGA_ONLY
+	while ((regs.spcflags & SPCFLAG_BLTNASTY) && dmaen (DMA_BLITTER) && cycles > 0 && !currprefs.blitter_cycle_exact) {
+		/* Laurent : I don't know if our blitter code should be called here ! */
+		int c = blitnasty ();
+		if (c > 0) {
+			cycles -= c * CYCLE_UNIT * 2;
+			if (cycles < CYCLE_UNIT)
+				cycles = 0;
+		} else
+			c = 4;
+		do_cycles (c * CYCLE_UNIT);
+
+		if (regs.spcflags & SPCFLAG_COPPER)
+			do_copper ();
+	}
+#endif
+
+	if (regs.spcflags & SPCFLAG_BUSERROR) {
+		/* We can not execute bus errors directly in the memory handler
+		* functions since the PC should point to the address of the next
+		* instruction, so we're executing the bus errors here: */
+		unset_special(SPCFLAG_BUSERROR);
+		Exception(2, BusErrorPC, M68000_EXC_SRC_CPU);
+	}
+
+	if(regs.spcflags & SPCFLAG_EXTRA_CYCLES) {
+		/* Add some extra cycles to simulate a wait state */
+		unset_special(SPCFLAG_EXTRA_CYCLES);
+		M68000_AddCycles(nWaitStateCycles);
+		nWaitStateCycles = 0;
+	}
+
+	if (regs.spcflags & SPCFLAG_DOTRACE)
+		Exception (9, last_trace_ad, M68000_EXC_SRC_CPU);
+
+	if (regs.spcflags & SPCFLAG_TRAP) {
+		unset_special (SPCFLAG_TRAP);
+		Exception (3, 0, M68000_EXC_SRC_CPU);
+	}
+
+	/* Handle the STOP instruction */
+	if ( regs.spcflags & SPCFLAG_STOP ) {
+	    /* We first test if there's a pending interrupt that would */
+	    /* allow to immediately leave the STOP state */
+	    if ( do_specialties_interrupt(true) ) {		/* test if there's an interrupt and add pending jitter */
+	        regs.stopped = 0;
+	        unset_special (SPCFLAG_STOP);
 	    }
+
+	    if (do_specialties_stop ())
+		return 1;
 	}
 
 	if (regs.spcflags & SPCFLAG_TRACE)
@@ -3066,7 +3099,8 @@ static void m68k_run_1 (void)
 	        if ( PendingInterruptCount <= 0 )
 		{
 			while ( ( PendingInterruptCount <= 0 ) && ( PendingInterruptFunction ) && ( ( regs.spcflags & SPCFLAG_STOP ) == 0 ) )
-				CALL_VAR(PendingInterruptFunction);		/* call the interrupt handler */
+				CycInt_CallPendingHandler();		/* call the interrupt handler */
+			CycInt_HandlersDone();
 			if ( MFP_UpdateNeeded == true )
 				MFP_UpdateIRQ ( 0 );
 		}
@@ -3126,7 +3160,8 @@ static void m68k_run_1_ce (void)
 	        if ( PendingInterruptCount <= 0 )
 		{
 			while ( ( PendingInterruptCount <= 0 ) && ( PendingInterruptFunction ) && ( ( regs.spcflags & SPCFLAG_STOP ) == 0 ) )
-				CALL_VAR(PendingInterruptFunction);		/* call the interrupt handler */
+				CycInt_CallPendingHandler();		/* call the interrupt handler */
+			CycInt_HandlersDone();
 			if ( MFP_UpdateNeeded == true )
 				MFP_UpdateIRQ ( 0 );
 		}
@@ -3286,6 +3321,7 @@ static void m68k_run_mmu040 (void)
 	uaecptr pc = 0;
 	uaecptr fault = 0;
 	m68k_exception save_except;
+	bool leave = false;
 
 	for (;;) {
 	TRY (prb) {
@@ -3349,15 +3385,20 @@ static void m68k_run_mmu040 (void)
 	        	if ( PendingInterruptCount <= 0 )
 			{
 				while ( ( PendingInterruptCount <= 0 ) && ( PendingInterruptFunction ) && ( ( regs.spcflags & SPCFLAG_STOP ) == 0 ) )
-					CALL_VAR(PendingInterruptFunction);		/* call the interrupt handler */
+					CycInt_CallPendingHandler();		/* call the interrupt handler */
+				CycInt_HandlersDone();
 				if ( MFP_UpdateNeeded == true )
 					MFP_UpdateIRQ ( 0 );
 			}
 
 			if (regs.spcflags) {
 				do_specialties_interrupt(false);		/* test if there's an mfp/video interrupt and add non pending jitter */
-				if (do_specialties (cpu_cycles / CYCLE_UNIT))
-					return;
+				/* Leave through the end of the TRY block, returning
+				 * from inside it would leak a try stack entry */
+				if (do_specialties (cpu_cycles / CYCLE_UNIT)) {
+					leave = true;
+					break;
+				}
 			}
 
 			/* Run DSP 56k code if necessary */
@@ -3392,6 +3433,8 @@ static void m68k_run_mmu040 (void)
 
 		Exception_mmu (save_except, oldpc);
 	} ENDTRY
+	if (leave)
+		return;
 	} /* end for ;; */
 }
 
@@ -3402,7 +3445,7 @@ static void m68k_run_2ce (void)
 	struct regstruct *r = &regs;
 	int curr_cycles = 0;
 
-	struct falcon_cycles_t falcon_instr_cycle;
+	const struct falcon_cycles_t *falcon_instr_cycle;
 
 	ipl_fetch ();
 
@@ -3436,15 +3479,15 @@ static void m68k_run_2ce (void)
 		falcon_instr_cycle = regs.ce030_instr_cycles;
 
 		if ((currprefs.cpu_model == 68030) && ((r->cacr & 3) == 1) && (CpuInstruction.iCacheMisses == 0)) { // not frozen and enabled
-			if (falcon_instr_cycle.head < CpuInstruction.iSave_instr_tail)
-				curr_cycles = (falcon_instr_cycle.cache_cycles - falcon_instr_cycle.head);
+			if (falcon_instr_cycle->head < CpuInstruction.iSave_instr_tail)
+				curr_cycles = (falcon_instr_cycle->cache_cycles - falcon_instr_cycle->head);
 			else
-				curr_cycles = (falcon_instr_cycle.cache_cycles - CpuInstruction.iSave_instr_tail);
+				curr_cycles = (falcon_instr_cycle->cache_cycles - CpuInstruction.iSave_instr_tail);
 
-			CpuInstruction.iSave_instr_tail = falcon_instr_cycle.tail;
+			CpuInstruction.iSave_instr_tail = falcon_instr_cycle->tail;
 		}
 		else {
-			curr_cycles = falcon_instr_cycle.noncache_cycles;
+			curr_cycles = falcon_instr_cycle->noncache_cycles;
 		}
 
 		curr_cycles += regs.ce030_instr_addcycles;
@@ -3466,7 +3509,8 @@ static void m68k_run_2ce (void)
 	        if ( PendingInterruptCount <= 0 )
 		{
 			while ( ( PendingInterruptCount <= 0 ) && ( PendingInterruptFunction ) && ( ( regs.spcflags & SPCFLAG_STOP ) == 0 ) )
-				CALL_VAR(PendingInterruptFunction);		/* call the interrupt handler */
+				CycInt_CallPendingHandler();		/* call the interrupt handler */
+			CycInt_HandlersDone();
 			if ( MFP_UpdateNeeded == true )
 				MFP_UpdateIRQ ( 0 );
 		}
@@ -3547,7 +3591,8 @@ static void m68k_run_2p (void)
 	        if ( PendingInterruptCount <= 0 )
 		{
 			while ( ( PendingInterruptCount <= 0 ) && ( PendingInterruptFunction ) && ( ( regs.spcflags & SPCFLAG_STOP ) == 0 ) )
-				CALL_VAR(PendingInterruptFunction);		/* call the interrupt handler */
+				CycInt_CallPendingHandler();		/* call the interrupt handler */
+			CycInt_HandlersDone();
 			if ( MFP_UpdateNeeded == true )
 				MFP_UpdateIRQ ( 0 );
 		}
@@ -3618,7 +3663,8 @@ static void m68k_run_2 (void)
 	        if ( PendingInterruptCount <= 0 )
 		{
 			while ( ( PendingInterruptCount <= 0 ) && ( PendingInterruptFunction ) && ( ( regs.spcflags & SPCFLAG_STOP ) == 0 ) )
-				CALL_VAR(PendingInterruptFunction);		/* call the interrupt handler */
+				CycInt_CallPendingHandler();		/* call the interrupt handler */
+			CycInt_HandlersDone();
 			if ( MFP_UpdateNeeded == true )
 				MFP_UpdateIRQ ( 0 );
 		}
@@ -3670,6 +3716,31 @@ static void m68k_run_mmu (void)
 
 int in_m68k_go = 0;
 
+/* Make m68k_go() return at the end of the current instruction, it can
+ * then be called again to run the next frame */
+void m68k_end_frame (void)
+{
+	frame_ended = true;
+	set_special (SPCFLAG_BRK);
+}
+
+/* Complete the instruction during which the previous frame ended: the
+ * CPU may still be waiting in the STOP state and the DSP has not run
+ * the cycles of this instruction yet (with the run functions that run it) */
+static void m68k_resume_frame (void (*run_func)(void))
+{
+	unset_special (SPCFLAG_BRK);
+	if ((regs.spcflags & SPCFLAG_STOP) && (do_specialties_stop () || do_specialties (0)))
+		return;
+
+	if (!bDspEnabled)
+		return;
+	if (run_func == m68k_run_2ce)
+		DSP_Run(Cycles_GetCounter(CYCLES_COUNTER_CPU) * 2);
+	else if (run_func == m68k_run_2 || run_func == m68k_run_2p || run_func == m68k_run_mmu040)
+		DSP_Run(cpu_cycles * 2 / CYCLE_UNIT);
+}
+
 static void exception2_handle (uaecptr addr, uaecptr fault)
 {
 	last_addr_for_exception_3 = addr;
@@ -3686,10 +3757,14 @@ void m68k_go (int may_quit)
 		abort ();
 	}
 
-	reset_frame_rate_hack ();
-	update_68k_cycles ();
-
 	in_m68k_go++;
+	if (frame_ended) {
+		frame_ended = false;
+		m68k_resume_frame (frame_run_func);
+	} else {
+		reset_frame_rate_hack ();
+		update_68k_cycles ();
+	}
 	for (;;) {
 		void (*run_func)(void);
 
@@ -3740,6 +3815,12 @@ void m68k_go (int may_quit)
 				currprefs.cpu_compatible ? m68k_run_2p : m68k_run_2;
 		}
 		run_func ();
+
+		/* End of frame? */
+		if (frame_ended) {
+			frame_run_func = run_func;
+			break;
+		}
 	}
 	in_m68k_go--;
 }
@@ -4765,7 +4846,7 @@ uae_u32 get_word_ce020_prefetch (int o)
 }
 
 // 68030 caches aren't so simple as 68020 cache..
-STATIC_INLINE struct cache030 *getcache030 (struct cache030 *cp, uaecptr addr, uae_u32 *tagp, int *lwsp)
+STATIC_INLINE struct cache030 *getcache030 (struct cache030 *cp, uae_u32 gen, uaecptr addr, uae_u32 *tagp, int *lwsp)
 {
 	int index, lws;
 	uae_u32 tag;
@@ -4773,7 +4854,7 @@ STATIC_INLINE struct cache030 *getcache030 (struct cache030 *cp, uaecptr addr, u
 
 	addr &= ~3;
 	index = (addr >> 4) & (CACHELINES030 - 1);
-	tag = regs.s | (addr & ~((CACHELINES030 << 4) - 1));
+	tag = regs.s | gen | (addr & ~((CACHELINES030 << 4) - 1));
 	lws = (addr >> 2) & 3;
 	c = &cp[index];
 	*tagp = tag;
@@ -4784,9 +4865,9 @@ STATIC_INLINE struct cache030 *getcache030 (struct cache030 *cp, uaecptr addr, u
 STATIC_INLINE void update_cache030 (struct cache030 *c, uae_u32 val, uae_u32 tag, int lws)
 {
 	if (c->tag != tag)
-		c->valid[0] = c->valid[1] = c->valid[2] = c->valid[3] = false;
+		c->valid = 0;
 	c->tag = tag;
-	c->valid[lws] = true;
+	c->valid |= 1 << lws;
 	c->data[lws] = val;
 }
 
@@ -4798,8 +4879,8 @@ STATIC_INLINE void fill_icache030 (uae_u32 addr, int idx)
 	struct cache030 *c;
 
 	addr &= ~3;
-	c = getcache030 (icaches030, addr, &tag, &lws);
-	if (c->valid[lws] && c->tag == tag) {
+	c = getcache030 (icaches030, icache030_gen, addr, &tag, &lws);
+	if (c->tag == tag && (c->valid & (1 << lws))) {
 		// cache hit
 		regs.prefetch020addr[idx] = addr;
 		regs.prefetch020data[idx] = c->data[lws];
@@ -4811,12 +4892,12 @@ STATIC_INLINE void fill_icache030 (uae_u32 addr, int idx)
 	if ((regs.cacr & 3) == 1) { // not frozen and enabled
 		update_cache030 (c, data, tag, lws);
 #if 0
-		if ((regs.cacr & 0x11) == 0x11 && lws == 0 && !c->valid[0] && !c->valid[1] && !c->valid[2] && !c->valid[3] && ce_banktype[addr >> 16] == CE_MEMBANK_FAST) {
+		if ((regs.cacr & 0x11) == 0x11 && lws == 0 && !c->valid && ce_banktype[addr >> 16] == CE_MEMBANK_FAST) {
 			// do burst fetch if cache enabled, not frozen, all slots invalid, no chip ram
 			c->data[1] = mem_access_delay_long_read_ce020 (addr + 4);
 			c->data[2] = mem_access_delay_long_read_ce020 (addr + 8);
 			c->data[3] = mem_access_delay_long_read_ce020 (addr + 12);
-			c->valid[1] = c->valid[2] = c->valid[3] = true;
+			c->valid = 0xf;
 		}
 #endif
 	}
@@ -4842,9 +4923,9 @@ void write_dcache030 (uaecptr addr, uae_u32 val, int size)
 	if (!cancache030 (addr))
 		return;
 
-	c1 = getcache030 (dcaches030, addr, &tag1, &lws1);
+	c1 = getcache030 (dcaches030, dcache030_gen, addr, &tag1, &lws1);
 	if (!(regs.cacr & 0x2000)) { // write allocate
-		if (c1->tag != tag1 || c1->valid[lws1] == false)
+		if (c1->tag != tag1 || !(c1->valid & (1 << lws1)))
 			return;
 	}
 
@@ -4861,40 +4942,40 @@ void write_dcache030 (uaecptr addr, uae_u32 val, int size)
 	if (size == 2 && aligned == 0) {
 		update_cache030 (c1, val, tag1, lws1);
 #if 0
-		if ((regs.cacr & 0x1100) == 0x1100 && lws1 == 0 && !c1->valid[0] && !c1->valid[1] && !c1->valid[2] && !c1->valid[3] && ce_banktype[addr >> 16] == CE_MEMBANK_FAST) {
+		if ((regs.cacr & 0x1100) == 0x1100 && lws1 == 0 && !c1->valid && ce_banktype[addr >> 16] == CE_MEMBANK_FAST) {
 			// do burst fetch if cache enabled, not frozen, all slots invalid, no chip ram
 			c1->data[1] = mem_access_delay_long_read_ce020 (addr + 4);
 			c1->data[2] = mem_access_delay_long_read_ce020 (addr + 8);
 			c1->data[3] = mem_access_delay_long_read_ce020 (addr + 12);
-			c1->valid[1] = c1->valid[2] = c1->valid[3] = true;
+			c1->valid = 0xf;
 		}
 #endif
 		return;
 	}
 	// argh!! merge partial write
-	c2 = getcache030 (dcaches030, addr + 4, &tag2, &lws2);
+	c2 = getcache030 (dcaches030, dcache030_gen, addr + 4, &tag2, &lws2);
 	if (size == 2) {
-		if (c1->valid[lws1] && c1->tag == tag1) {
+		if (c1->tag == tag1 && (c1->valid & (1 << lws1))) {
 			c1->data[lws1] &= ~(0xffffffff >> (aligned * 8));
 			c1->data[lws1] |= val >> (aligned * 8);
 		}
-		if (c2->valid[lws2] && c2->tag == tag2) {
+		if (c2->tag == tag2 && (c2->valid & (1 << lws2))) {
 			c2->data[lws2] &= 0xffffffff >> ((4 - aligned) * 8);
 			c2->data[lws2] |= val << ((4 - aligned) * 8);
 		}
 	} else if (size == 1) {
 		val <<= 16;
-		if (c1->valid[lws1] && c1->tag == tag1) {
+		if (c1->tag == tag1 && (c1->valid & (1 << lws1))) {
 			c1->data[lws1] &= ~(0xffff0000 >> (aligned * 8));
 			c1->data[lws1] |= val >> (aligned * 8);
 		}
-		if (c2->valid[lws2] && c2->tag == tag2 && aligned == 3) {
+		if (c2->tag == tag2 && (c2->valid & (1 << lws2)) && aligned == 3) {
 			c2->data[lws2] &= 0x00ffffff;
 			c2->data[lws2] |= val << 8;
 		}
 	} else if (size == 0) {
 		val <<= 24;
-		if (c1->valid[lws1] && c1->tag == tag1) {
+		if (c1->tag == tag1 && (c1->valid & (1 << lws1))) {
 			c1->data[lws1] &= ~(0xff000000 >> (aligned * 8));
 			c1->data[lws1] |= val >> (aligned * 8);
 		}
@@ -4919,9 +5000,9 @@ uae_u32 read_dcache030 (uaecptr addr, int size)
 			return mem_access_delay_byte_read_ce020 (addr);
 	}
 
-	c1 = getcache030 (dcaches030, addr, &tag1, &lws1);
+	c1 = getcache030 (dcaches030, dcache030_gen, addr, &tag1, &lws1);
 	addr &= ~3;
-	if (!c1->valid[lws1] || c1->tag != tag1) {
+	if (c1->tag != tag1 || !(c1->valid & (1 << lws1))) {
 		v1 = mem_access_delay_long_read_ce020 (addr);
 		update_cache030 (c1, v1, tag1, lws1);
 	} else {
@@ -4944,8 +5025,8 @@ uae_u32 read_dcache030 (uaecptr addr, int size)
 	}
 	// need two longs
 	addr += 4;
-	c2 = getcache030 (dcaches030, addr, &tag2, &lws2);
-	if (!c2->valid[lws2] || c2->tag != tag2) {
+	c2 = getcache030 (dcaches030, dcache030_gen, addr, &tag2, &lws2);
+	if (c2->tag != tag2 || !(c2->valid & (1 << lws2))) {
 		v2 = mem_access_delay_long_read_ce020 (addr);
 		update_cache030 (c2, v2, tag2, lws2);
 	} else {
@@ -5005,16 +5086,10 @@ uae_u32 get_word_ce030_prefetch (int o)
 
 void flush_dcache (uaecptr addr, int size)
 {
-	int i;
 	if (!currprefs.cpu_cycle_exact)
 		return;
 	if (currprefs.cpu_model >= 68030) {
-		for (i = 0; i < CACHELINES030; i++) {
-			dcaches030[i].valid[0] = 0;
-			dcaches030[i].valid[1] = 0;
-			dcaches030[i].valid[2] = 0;
-			dcaches030[i].valid[3] = 0;
-		}
+		flush_cache030 (dcaches030, &dcache030_gen);
 	}
 }
 
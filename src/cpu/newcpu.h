@@ -79,7 +79,10 @@ extern int fpp_movem_index2[256];
 extern int fpp_movem_next[256];
 #endif
 
-extern int OpcodeFamily;
+#include "hotState.h"
+
+/* Family of the latest instruction executed (to check for pairing) */
+#define OpcodeFamily HotState.OpcodeFamily	/* see instrmnem in readcpu.h */
 
 typedef struct falcon_cycles_t falcon_cycles;
 
@@ -138,8 +141,8 @@ struct cache020
 struct cache030
 {
 	uae_u32 data[4];
-	bool valid[4];
-	uae_u32 tag;
+	uae_u32 tag;	/* address, cache generation and supervisor bit */
+	uae_u8 valid;	/* bit per long word */
 };
 
 #define CACHESETS040 64
@@ -215,7 +218,7 @@ struct regstruct
 	uae_u32 prefetch020data[CPU_PIPELINE_MAX];
 	uae_u32 prefetch020addr[CPU_PIPELINE_MAX];
 	int ce020memcycles;
-	struct falcon_cycles_t ce030_instr_cycles;
+	const struct falcon_cycles_t *ce030_instr_cycles;	/* set by each instruction in 030 CE mode */
 	int ce030_instr_addcycles;
 };
 
@@ -399,6 +402,7 @@ extern void m68k_mull (uae_u32, uae_u32, uae_u16);
 extern void init_m68k (void);
 extern void init_m68k_full (void);
 extern void m68k_go (int);
+extern void m68k_end_frame (void);
 extern void m68k_dumpstate (FILE *, uaecptr *);
 extern void m68k_disasm (FILE *, uaecptr, uaecptr *, int);
 extern void sm68k_disasm (TCHAR*, TCHAR*, uaecptr addr, uaecptr *nextpc);
@@ -478,11 +482,8 @@ struct cpum2c {
 };
 extern struct cpum2c m2cregs[];
 
-/* Family of the latest instruction executed (to check for pairing) */
-extern int OpcodeFamily;			/* see instrmnem in readcpu.h */
-
 /* How many cycles to add to the current instruction in case a "misaligned" bus acces is made */
 /* (used when addressing mode is d8(an,ix)) */
-extern int BusCyclePenalty;
+#define BusCyclePenalty HotState.BusCyclePenalty
 
 #endif
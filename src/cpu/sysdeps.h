@@ -32,6 +32,7 @@
 #endif
 
 #include <stdarg.h>
+#include <stdint.h>
 
 #ifdef HAVE_SYS_TYPES_H
 #include <sys/types.h>
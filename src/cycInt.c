@@ -6,11 +6,14 @@
 
   This code handles our table with callbacks for cycle accurate program
   interruption. We add any pending callback handler into a table so that we do
-  not need to test for every possible interrupt event. We then scan
-  the list if used entries in the table and copy the one with the least cycle
-  count into the global 'PendingInterruptCount' variable. This is then
-  decremented by the execution loop - rather than decrement each and every
-  entry (as the others cannot occur before this one).
+  not need to test for every possible interrupt event. The used entries are
+  kept in a binary heap ordered by their cycle count, and the one with the
+  least cycle count is copied into the global 'PendingInterruptCount'
+  variable. This is then decremented by the execution loop - rather than
+  decrement each and every entry (as the others cannot occur before this one).
+  Used entries store the cycle count as an absolute time stamp, so when an
+  interrupt occurs only the common time base needs to be advanced instead of
+  adjusting each entry.
   We have two methods of adding interrupts; Absolute and Relative.
   Absolute will set values from the time of the previous interrupt (e.g., add
   HBL every 512 cycles), and Relative will add from the current cycle time.
@@ -56,22 +59,26 @@ const char CycInt_fileid[] = "Hatari cycInt.c : " __DATE__ " " __TIME__;
 #include "dmaSnd.h"
 #include "crossbar.h"
 #include "fdc.h"
+#include "hdc.h"
+#include "ide.h"
 #include "ikbd.h"
 #include "cycInt.h"
 #include "m68000.h"
 #include "mfp.h"
 #include "midi.h"
 #include "memorySnapShot.h"
+#include "profile.h"
 #include "sound.h"
+#include "stats.h"
 #include "screen.h"
 #include "video.h"
 #include "acia.h"
 
 
-void (*PendingInterruptFunction)(void);
-int PendingInterruptCount;
+interrupt_id RunningInterrupt;	/* acknowledged interrupt whose handler still runs */
 
 static int nCyclesOver;
+static int nRunningCyclesOver;	/* nCyclesOver when RunningInterrupt was acknowledged */
 
 /* List of possible interrupt handlers to be store in 'PendingInterruptTable',
  * used for 'MemorySnapShot' */
@@ -94,11 +101,20 @@ static void (* const pIntHandlerFunctions[MAX_INTERRUPTS])(void) =
 	FDC_InterruptHandler_Update,
 	Blitter_InterruptHandler,
 	Midi_InterruptHandler_Update,
-
+	HDC_InterruptHandler,
+	Ide_InterruptHandler,
+	Profile_CpuSample,
+	Profile_DspSample,
 };
 
-/* Event timer structure - keeps next timer to occur in structure so don't need
- * to check all entries */
+/* Event timer structure.
+ * For active interrupts, 'Cycles' is an absolute timestamp in internal
+ * cycles (relative to 'CyclesBase', which is advanced as time passes),
+ * so that the whole table doesn't need to be rebased each time an
+ * interrupt occurs. For inactive interrupts, 'Cycles' keeps the
+ * remaining (relative) count frozen at the time they were stopped,
+ * so that they can be resumed later.
+ */
 typedef struct
 {
 	bool bUsed;                   /* Is interrupt active? */
@@ -109,8 +125,172 @@ typedef struct
 static INTERRUPTHANDLER InterruptHandlers[MAX_INTERRUPTS];
 static int ActiveInterrupt=0;
 
+/* Internal cycles passed at the time of the last update */
+static Sint64 CyclesBase;
+/* Rebase absolute timestamps before they could overflow */
+#define CYCLES_BASE_MAX		((Sint64)1 << 62)
+
+/* Binary min-heap of the active interrupts, ordered by their timestamp
+ * (and handler ID for equal timestamps, like the earlier linear scan) */
+static interrupt_id IntHeap[MAX_INTERRUPTS];
+static int IntHeapPos[MAX_INTERRUPTS];	/* position in IntHeap, -1 if not there */
+static int IntHeapSize;
+
 static void CycInt_SetNewInterrupt(void);
 
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return number of internal cycles until given interrupt happens
+ */
+static inline Sint64 CycInt_GetCycles(interrupt_id Handler)
+{
+	if (InterruptHandlers[Handler].bUsed)
+		return InterruptHandlers[Handler].Cycles - CyclesBase;
+	return InterruptHandlers[Handler].Cycles;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return true if heap entry at position a should be before position b
+ */
+static inline bool CycInt_HeapLess(int a, int b)
+{
+	Sint64 CyclesA = InterruptHandlers[IntHeap[a]].Cycles;
+	Sint64 CyclesB = InterruptHandlers[IntHeap[b]].Cycles;
+
+	return CyclesA < CyclesB || (CyclesA == CyclesB && IntHeap[a] < IntHeap[b]);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Swap two heap entries
+ */
+static inline void CycInt_HeapSwap(int a, int b)
+{
+	interrupt_id tmp = IntHeap[a];
+
+	IntHeap[a] = IntHeap[b];
+	IntHeap[b] = tmp;
+	IntHeapPos[IntHeap[a]] = a;
+	IntHeapPos[IntHeap[b]] = b;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Restore heap order after the timestamp of entry at given position changed
+ */
+static void CycInt_HeapFix(int pos)
+{
+	int child;
+
+	/* move up */
+	while (pos > 0 && CycInt_HeapLess(pos, (pos - 1) / 2))
+	{
+		CycInt_HeapSwap(pos, (pos - 1) / 2);
+		pos = (pos - 1) / 2;
+	}
+	/* move down */
+	for (;;)
+	{
+		child = 2 * pos + 1;
+		if (child >= IntHeapSize)
+			break;
+		if (child + 1 < IntHeapSize && CycInt_HeapLess(child + 1, child))
+			child++;
+		if (!CycInt_HeapLess(child, pos))
+			break;
+		CycInt_HeapSwap(pos, child);
+		pos = child;
+	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Set interrupt active and to happen after given number of internal
+ * cycles, add or move it in the heap
+ */
+static void CycInt_SetActive(interrupt_id Handler, Sint64 Cycles)
+{
+	InterruptHandlers[Handler].bUsed = true;
+	InterruptHandlers[Handler].Cycles = CyclesBase + Cycles;
+
+	if (IntHeapPos[Handler] < 0)
+	{
+		IntHeap[IntHeapSize] = Handler;
+		IntHeapPos[Handler] = IntHeapSize++;
+	}
+	CycInt_HeapFix(IntHeapPos[Handler]);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Stop interrupt, keeping its remaining cycles, and remove it from heap
+ */
+static void CycInt_SetInactive(interrupt_id Handler)
+{
+	int pos = IntHeapPos[Handler];
+
+	InterruptHandlers[Handler].Cycles = CycInt_GetCycles(Handler);
+	InterruptHandlers[Handler].bUsed = false;
+
+	if (pos < 0)
+		return;
+	IntHeapPos[Handler] = -1;
+	if (pos != --IntHeapSize)
+	{
+		IntHeap[pos] = IntHeap[IntHeapSize];
+		IntHeapPos[IntHeap[pos]] = pos;
+		CycInt_HeapFix(pos);
+	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Convert timestamps of active interrupts so that CyclesBase is 0 again
+ */
+static void CycInt_Rebase(void)
+{
+	int i;
+
+	for (i = 0; i < MAX_INTERRUPTS; i++)
+	{
+		if (InterruptHandlers[i].bUsed)
+			InterruptHandlers[i].Cycles -= CyclesBase;
+	}
+	CyclesBase = 0;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Rebuild interrupt heap from the table (after reset or restore)
+ */
+static void CycInt_BuildHeap(void)
+{
+	int i;
+
+	IntHeapSize = 0;
+	for (i = 0; i < MAX_INTERRUPTS; i++)
+	{
+		IntHeapPos[i] = -1;
+		if (InterruptHandlers[i].bUsed)
+		{
+			IntHeap[IntHeapSize] = i;
+			IntHeapPos[i] = IntHeapSize++;
+		}
+	}
+	for (i = IntHeapSize / 2 - 1; i >= 0; i--)
+		CycInt_HeapFix(i);
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Reset interrupts, handlers
@@ -121,8 +301,10 @@ void CycInt_Reset(void)
 
 	/* Reset counts */
 	PendingInterruptCount = 0;
+	RunningInterrupt = INTERRUPT_NULL;
 	ActiveInterrupt = 0;
 	nCyclesOver = 0;
+	CyclesBase = 0;
 
 	/* Reset interrupt table */
 	for (i=0; i<MAX_INTERRUPTS; i++)
@@ -131,6 +313,7 @@ void CycInt_Reset(void)
 		InterruptHandlers[i].Cycles = INT_MAX;
 		InterruptHandlers[i].pFunction = pIntHandlerFunctions[i];
 	}
+	CycInt_BuildHeap();
 }
 
 
@@ -172,11 +355,18 @@ static void ( *CycInt_IDToHandlerFunction(int ID) )( void )
 /*-----------------------------------------------------------------------*/
 /**
  * Save/Restore snapshot of local variables('MemorySnapShot_Store' handles type)
+ * Cycles are stored relative to current time, as with the earlier
+ * scheduler, to keep the snapshot format compatible.
  */
 void CycInt_MemorySnapShot_Capture(bool bSave)
 {
 	int i,ID;
 
+	if (bSave)
+		CycInt_Rebase();
+	else
+		CyclesBase = 0;
+
 	/* Save/Restore details */
 	for (i=0; i<MAX_INTERRUPTS; i++)
 	{
@@ -212,7 +402,11 @@ void CycInt_MemorySnapShot_Capture(bool bSave)
 
 
 	if (!bSave)
+	{
+		CycInt_BuildHeap();
 		CycInt_SetNewInterrupt();	/* when restoring snapshot, compute current state after */
+		RunningInterrupt = INTERRUPT_NULL;
+	}
 }
 
 
@@ -230,28 +424,17 @@ void CycInt_MemorySnapShot_Capture(bool bSave)
  */
 static void CycInt_SetNewInterrupt(void)
 {
-	Sint64 LowestCycleCount = INT_MAX;
-	interrupt_id LowestInterrupt = INTERRUPT_NULL, i;
+	interrupt_id LowestInterrupt = INTERRUPT_NULL;
 
 	LOG_TRACE(TRACE_INT, "int set new in video_cyc=%d active_int=%d pending_count=%d\n",
 	          Cycles_GetCounter(CYCLES_COUNTER_VIDEO), ActiveInterrupt, PendingInterruptCount);
 
-	/* Find next interrupt to go off */
-	for (i = INTERRUPT_NULL+1; i < MAX_INTERRUPTS; i++)
-	{
-		/* Is interrupt pending? */
-		if (InterruptHandlers[i].bUsed)
-		{
-			if (InterruptHandlers[i].Cycles < LowestCycleCount)
-			{
-				LowestCycleCount = InterruptHandlers[i].Cycles;
-				LowestInterrupt = i;
-			}
-		}
-	}
+	/* Next interrupt to go off is at the top of the heap */
+	if (IntHeapSize > 0 && CycInt_GetCycles(IntHeap[0]) < INT_MAX)
+		LowestInterrupt = IntHeap[0];
 
 	/* Set new counts, active interrupt */
-	PendingInterruptCount = InterruptHandlers[LowestInterrupt].Cycles;
+	PendingInterruptCount = CycInt_GetCycles(LowestInterrupt);
 	PendingInterruptFunction = InterruptHandlers[LowestInterrupt].pFunction;
 	ActiveInterrupt = LowestInterrupt;
 
@@ -263,23 +446,22 @@ static void CycInt_SetNewInterrupt(void)
 /*-----------------------------------------------------------------------*/
 /**
  * Adjust all interrupt timings, MUST call CycInt_SetNewInterrupt after this.
+ * As active interrupts use absolute timestamps, this only needs to
+ * advance the time base.
  */
 static void CycInt_UpdateInterrupt(void)
 {
 	Sint64 CycleSubtract;
-	int i;
 
 	/* Find out how many cycles we went over (<=0) */
 	nCyclesOver = PendingInterruptCount;
 	/* Calculate how many cycles have passed, included time we went over */
-	CycleSubtract = InterruptHandlers[ActiveInterrupt].Cycles - nCyclesOver;
+	CycleSubtract = CycInt_GetCycles(ActiveInterrupt) - nCyclesOver;
 
 	/* Adjust table */
-	for (i = 0; i < MAX_INTERRUPTS; i++)
-	{
-		if (InterruptHandlers[i].bUsed)
-			InterruptHandlers[i].Cycles -= CycleSubtract;
-	}
+	CyclesBase += CycleSubtract;
+	if (CyclesBase > CYCLES_BASE_MAX)
+		CycInt_Rebase();
 
 	LOG_TRACE(TRACE_INT, "int upd video_cyc=%d cycle_over=%d cycle_sub=%"PRId64"\n",
 	          Cycles_GetCounter(CYCLES_COUNTER_VIDEO), nCyclesOver, CycleSubtract);
@@ -296,14 +478,28 @@ void CycInt_AcknowledgeInterrupt(void)
 	/* Update list cycle counts */
 	CycInt_UpdateInterrupt();
 
+	Stats_AddInterrupt(ActiveInterrupt);
+	RunningInterrupt = ActiveInterrupt;
+	nRunningCyclesOver = nCyclesOver;
+
 	/* Disable interrupt entry which has just occurred */
-	InterruptHandlers[ActiveInterrupt].bUsed = false;
+	CycInt_SetInactive(ActiveInterrupt);
 
 	/* Set new */
 	CycInt_SetNewInterrupt();
 
 	LOG_TRACE(TRACE_INT, "int ack video_cyc=%d active_int=%d active_cyc=%d pending_count=%d\n",
-	               Cycles_GetCounter(CYCLES_COUNTER_VIDEO), ActiveInterrupt, (int)InterruptHandlers[ActiveInterrupt].Cycles, PendingInterruptCount );
+	               Cycles_GetCounter(CYCLES_COUNTER_VIDEO), ActiveInterrupt, (int)CycInt_GetCycles(ActiveInterrupt), PendingInterruptCount );
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return the interrupt whose handler is PendingInterruptFunction
+ */
+interrupt_id CycInt_GetActiveInterrupt(void)
+{
+	return ActiveInterrupt;
 }
 
 
@@ -320,15 +516,14 @@ void CycInt_AddAbsoluteInterrupt(int CycleTime, int CycleType, interrupt_id Hand
 	if ( ActiveInterrupt > 0 )
 		CycInt_UpdateInterrupt();
 
-	InterruptHandlers[Handler].bUsed = true;
-	InterruptHandlers[Handler].Cycles = INT_CONVERT_TO_INTERNAL((Sint64)CycleTime , CycleType) + nCyclesOver;
+	CycInt_SetActive(Handler, INT_CONVERT_TO_INTERNAL((Sint64)CycleTime , CycleType) + nCyclesOver);
 
 	/* Set new active int and compute a new value for PendingInterruptCount*/
 	CycInt_SetNewInterrupt();
 
 	LOG_TRACE(TRACE_INT, "int add abs video_cyc=%d handler=%d handler_cyc=%"PRId64" pending_count=%d\n",
 	          Cycles_GetCounter(CYCLES_COUNTER_VIDEO), Handler,
-	          InterruptHandlers[Handler].Cycles, PendingInterruptCount );
+	          CycInt_GetCycles(Handler), PendingInterruptCount );
 }
 
 
@@ -355,14 +550,13 @@ void CycInt_AddRelativeInterruptNoOffset(int CycleTime, int CycleType, interrupt
 		CycInt_UpdateInterrupt();
 
 //  nCyclesOver = 0;
-	InterruptHandlers[Handler].bUsed = true;
-	InterruptHandlers[Handler].Cycles = INT_CONVERT_TO_INTERNAL((Sint64)CycleTime , CycleType) + PendingInterruptCount;
+	CycInt_SetActive(Handler, INT_CONVERT_TO_INTERNAL((Sint64)CycleTime , CycleType) + PendingInterruptCount);
 
 	/* Set new */
 	CycInt_SetNewInterrupt();
 
 	LOG_TRACE(TRACE_INT, "int add rel no_off video_cyc=%d handler=%d handler_cyc=%"PRId64" pending_count=%d\n",
-	               Cycles_GetCounter(CYCLES_COUNTER_VIDEO), Handler, InterruptHandlers[Handler].Cycles, PendingInterruptCount );
+	               Cycles_GetCounter(CYCLES_COUNTER_VIDEO), Handler, CycInt_GetCycles(Handler), PendingInterruptCount );
 }
 #endif
 
@@ -385,15 +579,14 @@ void CycInt_AddRelativeInterruptWithOffset(int CycleTime, int CycleType, interru
 	if ( ActiveInterrupt > 0 )
 		CycInt_UpdateInterrupt();
 
-	InterruptHandlers[Handler].bUsed = true;
-	InterruptHandlers[Handler].Cycles = INT_CONVERT_TO_INTERNAL((Sint64)CycleTime , CycleType) + CycleOffset;
+	CycInt_SetActive(Handler, INT_CONVERT_TO_INTERNAL((Sint64)CycleTime , CycleType) + CycleOffset);
 
 	/* Set new active int and compute a new value for PendingInterruptCount*/
 	CycInt_SetNewInterrupt();
 
 	LOG_TRACE(TRACE_INT, "int add rel offset video_cyc=%d handler=%d handler_cyc=%"PRId64" offset_cyc=%d pending_count=%d\n",
 	          Cycles_GetCounter(CYCLES_COUNTER_VIDEO), Handler,
-	          InterruptHandlers[Handler].Cycles, CycleOffset, PendingInterruptCount);
+	          CycInt_GetCycles(Handler), CycleOffset, PendingInterruptCount);
 }
 
 
@@ -412,13 +605,15 @@ void CycInt_ModifyInterrupt(int CycleTime, int CycleType, interrupt_id Handler)
 		CycInt_UpdateInterrupt();
 
 	InterruptHandlers[Handler].Cycles += INT_CONVERT_TO_INTERNAL((Sint64)CycleTime , CycleType);
+	if (IntHeapPos[Handler] >= 0)
+		CycInt_HeapFix(IntHeapPos[Handler]);
 
 	/* Set new active int and compute a new value for PendingInterruptCount*/
 	CycInt_SetNewInterrupt();
 
 	LOG_TRACE(TRACE_INT, "int modify video_cyc=%d handler=%d handler_cyc=%"PRId64" pending_count=%d\n",
 	          Cycles_GetCounter(CYCLES_COUNTER_VIDEO), Handler,
-	          InterruptHandlers[Handler].Cycles, PendingInterruptCount );
+	          CycInt_GetCycles(Handler), PendingInterruptCount );
 }
 
 
@@ -433,14 +628,14 @@ void CycInt_RemovePendingInterrupt(interrupt_id Handler)
 	CycInt_UpdateInterrupt();
 
 	/* Stop interrupt after CycInt_UpdateInterrupt, for CycInt_ResumeStoppedInterrupt */
-	InterruptHandlers[Handler].bUsed = false;
+	CycInt_SetInactive(Handler);
 
 	/* Set new */
 	CycInt_SetNewInterrupt();
 
 	LOG_TRACE(TRACE_INT, "int remove pending video_cyc=%d handler=%d handler_cyc=%"PRId64" pending_count=%d\n",
 	          Cycles_GetCounter(CYCLES_COUNTER_VIDEO), Handler,
-	          InterruptHandlers[Handler].Cycles, PendingInterruptCount);
+	          CycInt_GetCycles(Handler), PendingInterruptCount);
 }
 
 
@@ -451,7 +646,8 @@ void CycInt_RemovePendingInterrupt(interrupt_id Handler)
 void CycInt_ResumeStoppedInterrupt(interrupt_id Handler)
 {
 	/* Restart interrupt */
-	InterruptHandlers[Handler].bUsed = true;
+	if (!InterruptHandlers[Handler].bUsed)
+		CycInt_SetActive(Handler, InterruptHandlers[Handler].Cycles);
 
 	/* Update list cycle counts */
 	CycInt_UpdateInterrupt();
@@ -460,7 +656,7 @@ void CycInt_ResumeStoppedInterrupt(interrupt_id Handler)
 
 	LOG_TRACE(TRACE_INT, "int resume stopped video_cyc=%d handler=%d handler_cyc=%"PRId64" pending_count=%d\n",
 	          Cycles_GetCounter(CYCLES_COUNTER_VIDEO), Handler,
-	          InterruptHandlers[Handler].Cycles, PendingInterruptCount);
+	          CycInt_GetCycles(Handler), PendingInterruptCount);
 }
 
 
@@ -486,8 +682,8 @@ int CycInt_FindCyclesPassed(interrupt_id Handler, int CycleType)
 {
 	Sint64 CyclesPassed, CyclesFromLastInterrupt;
 
-	CyclesFromLastInterrupt = InterruptHandlers[ActiveInterrupt].Cycles - PendingInterruptCount;
-	CyclesPassed = InterruptHandlers[Handler].Cycles - CyclesFromLastInterrupt;
+	CyclesFromLastInterrupt = CycInt_GetCycles(ActiveInterrupt) - PendingInterruptCount;
+	CyclesPassed = CycInt_GetCycles(Handler) - CyclesFromLastInterrupt;
 
 	LOG_TRACE(TRACE_INT, "int find passed cyc video_cyc=%d handler=%d last_cyc=%"PRId64" passed_cyc=%"PRId64"\n",
 	          Cycles_GetCounter(CYCLES_COUNTER_VIDEO), Handler,
@@ -495,3 +691,36 @@ int CycInt_FindCyclesPassed(interrupt_id Handler, int CycleType)
 
 	return INT_CONVERT_FROM_INTERNAL ( CyclesPassed , CycleType ) ;
 }
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Like CycInt_FindCyclesPassed, but when called from an interrupt handler,
+ * count from the time this interrupt was due instead of the current time
+ * (which can be later by up to one instruction). The ID of the running
+ * handler (or INTERRUPT_NULL) is returned in 'pRunning', so that callers
+ * can order events due at the same time like the interrupt table does.
+ */
+int CycInt_FindCyclesPassedInHandler(interrupt_id Handler, int CycleType, interrupt_id *pRunning)
+{
+	Sint64 CyclesPassed, CyclesFromLastInterrupt;
+	int CyclesOver = 0;
+
+	*pRunning = INTERRUPT_NULL;
+	if ( RunningInterrupt != INTERRUPT_NULL )
+	{
+		*pRunning = RunningInterrupt;
+		CyclesOver = nRunningCyclesOver;
+	}
+	else if ( ( PendingInterruptCount <= 0 ) && ( PendingInterruptFunction ) )
+	{
+		/* Handler called, but not acknowledged yet */
+		*pRunning = ActiveInterrupt;
+		CyclesOver = PendingInterruptCount;
+	}
+
+	CyclesFromLastInterrupt = CycInt_GetCycles(ActiveInterrupt) - PendingInterruptCount + CyclesOver;
+	CyclesPassed = CycInt_GetCycles(Handler) - CyclesFromLastInterrupt;
+
+	return INT_CONVERT_FROM_INTERNAL ( CyclesPassed , CycleType ) ;
+}
@@ -6,9 +6,9 @@
 
   Here we take care of cycle counters. For performance reasons we don't increase
   all counters after each 68k instruction, but only one main counter.
-  When we need to read one of the normal counters (currently only for video
-  and sound cycles), we simply update these counters with the main counter
-  before returning the current counter value.
+  This main counter is folded into a 64-bit clock when a counter is accessed,
+  and each counter (currently video, sound and cpu cycles) is only stored as
+  the clock value at which it was 0, so reading it is a subtraction.
 */
 
 
@@ -25,6 +25,8 @@
 /*			'Bird Mad Girl Show' demo's loader/protection)			*/
 /* 2012/08/19	[NP]	Add a global counter CyclesGlobalClockCounter to count cycles	*/
 /*			since the last reset.						*/
+/* 2026/10/15		Store counters as base values of a 64-bit main clock instead	*/
+/*			of adding nCyclesMainCounter to each of them on every access.	*/
 
 
 const char Cycles_fileid[] = "Hatari cycles.c : " __DATE__ " " __TIME__;
@@ -35,13 +37,9 @@ const char Cycles_fileid[] = "Hatari cycles.c : " __DATE__ " " __TIME__;
 #include "cycles.h"
 
 
-int	nCyclesMainCounter;			/* Main cycles counter since previous Cycles_UpdateCounters() */
+static Uint64 CyclesMainClock;			/* Sum of nCyclesMainCounter, never reset */
+static Uint64 CyclesCounterBase[CYCLES_COUNTER_MAX];	/* Value of CyclesMainClock when each counter was 0 */
 
-static int nCyclesCounter[CYCLES_COUNTER_MAX];	/* Array with all counters */
-
-Uint64	CyclesGlobalClockCounter = 0;		/* Global clock counter since starting Hatari (it's never reset afterwards) */
-
-int	CurrentInstrCycles;
 int	MovepByteNbr = 0;			/* Number of the byte currently transferred in a movep (1..2 or 1..4) */
 						/* 0 means current instruction is not a movep */
 
@@ -58,27 +56,34 @@ static int	Cycles_GetInternalCycleOnWriteAccess(void);
  */
 void Cycles_MemorySnapShot_Capture(bool bSave)
 {
+	int nCyclesCounter[CYCLES_COUNTER_MAX];
+	int i;
+
+	/* Counters are stored by value, independently of CyclesMainClock */
+	for (i = 0; i < CYCLES_COUNTER_MAX; i++)
+		nCyclesCounter[i] = CyclesMainClock - CyclesCounterBase[i];
+
 	/* Save/Restore details */
 	MemorySnapShot_Store(&nCyclesMainCounter, sizeof(nCyclesMainCounter));
 	MemorySnapShot_Store(nCyclesCounter, sizeof(nCyclesCounter));
 	MemorySnapShot_Store(&CyclesGlobalClockCounter, sizeof(CyclesGlobalClockCounter));
 	MemorySnapShot_Store(&CurrentInstrCycles, sizeof(CurrentInstrCycles));
+
+	if (!bSave)
+	{
+		for (i = 0; i < CYCLES_COUNTER_MAX; i++)
+			CyclesCounterBase[i] = CyclesMainClock - nCyclesCounter[i];
+	}
 }
 
 
 /*-----------------------------------------------------------------------*/
 /**
- * Update all cycles counters with the current value of nCyclesMainCounter.
+ * Add the current value of nCyclesMainCounter to the main clock.
  */
-static void Cycles_UpdateCounters(void)
+static inline void Cycles_UpdateCounters(void)
 {
-	int i;
-
-	for (i = 0; i < CYCLES_COUNTER_MAX; i++)
-	{
-		nCyclesCounter[i] += nCyclesMainCounter;
-	}
-
+	CyclesMainClock += nCyclesMainCounter;
 	nCyclesMainCounter = 0;
 }
 
@@ -93,7 +98,7 @@ void Cycles_SetCounter(int nId, int nValue)
 	Cycles_UpdateCounters();
 
 	/* Now set the new value: */
-	nCyclesCounter[nId] = nValue;
+	CyclesCounterBase[nId] = CyclesMainClock - nValue;
 }
 
 
@@ -106,7 +111,7 @@ int Cycles_GetCounter(int nId)
 	/* Update counters first so we read an up-to-date value */
 	Cycles_UpdateCounters();
 
-	return nCyclesCounter[nId];
+	return (int)(CyclesMainClock - CyclesCounterBase[nId]);
 }
 
 
@@ -132,7 +137,11 @@ static int Cycles_GetInternalCycleOnReadAccess(void)
 		/* We don't read the opcode if PC is located in the IO region (rare cases */
 		/* used in some games/demos protections) as this can create recursive calls */
 		/* (protection of the "Union Demo" runs at $ff8240) */
-		if ( ( ( BusErrorPC & 0xffffff ) < 0xff0000 ) || ( ( BusErrorPC & 0xffffff ) > 0xffffff ) )
+		/* The only opcode checked below is a move, so other families don't need */
+		/* to fetch it again on each access */
+		if ( OpcodeFamily != i_MOVE )
+			Opcode = -1;
+		else if ( ( ( BusErrorPC & 0xffffff ) < 0xff0000 ) || ( ( BusErrorPC & 0xffffff ) > 0xffffff ) )
 			Opcode = get_word(BusErrorPC);					/* BusErrorPC points to the current opcode */
 		else
 			Opcode = -1;
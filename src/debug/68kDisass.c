@@ -122,8 +122,40 @@ static int				disSymbolCounts;
 static disSymbolEntry	*disSymbolEntries;
 
 
+// Disassembled lines, checked against the current instruction words when used,
+// so that the profiler, history and debugger output don't decode the same code
+// again and again. The generation changes with the disassembly options.
+#define DISASM_CACHE_SIZE	4096	// entries, must be a power of 2
+#define DISASM_CACHE_WORDS	11		// longest cached instruction (68030 + FPU)
+
+typedef struct {
+	long	addr;
+	int		len;				// 0 = unused entry
+	Uint32	generation;
+	unsigned short	words[DISASM_CACHE_WORDS];
+	char	label[48];
+	char	opcode[16];
+	char	operand[72];
+	char	comment[64];
+} disCacheEntry;
+
+static disCacheEntry	*disCache;
+static Uint32			disCacheGeneration = 1;
+
+// instruction words given by Disasm_Words() instead of the emulated memory
+static const Uint16	*disWords;
+static long		disWordsAddr;
+static int		disWordsCount;
+
 static inline unsigned short	Disass68kGetWord(long addr)
 {
+	if ( disWords )
+	{
+		long	i = ( addr - disWordsAddr ) / 2;
+		if ( addr < disWordsAddr || i >= disWordsCount )
+			return 0;
+		return disWords[i];
+	}
 	if ( ! valid_address ( addr , 2 ) )
 		return 0;
 
@@ -2422,6 +2454,56 @@ more:
 	return 2;
 }
 
+/***
+ *	Disass68k() through the cache of disassembled lines
+ ***/
+static int	Disass68kCached(long addr, char *labelBuffer, char *opcodeBuffer, char *operandBuffer, char *commentBuffer)
+{
+	disCacheEntry	*dce;
+	int		len, i;
+
+	if(!disCache)
+	{
+		disCache = calloc(DISASM_CACHE_SIZE, sizeof(*disCache));
+		if(!disCache)
+			return Disass68k(addr, labelBuffer, opcodeBuffer, operandBuffer, commentBuffer);
+	}
+
+	dce = &disCache[(addr >> 1) & (DISASM_CACHE_SIZE - 1)];
+	if(dce->len && dce->addr == addr && dce->generation == disCacheGeneration)
+	{
+		for(i=0; i<dce->len/2 && dce->words[i] == Disass68kGetWord(addr+i*2); ++i)
+			;
+		if(i == dce->len/2)
+		{
+			strcpy(labelBuffer, dce->label);
+			strcpy(opcodeBuffer, dce->opcode);
+			strcpy(operandBuffer, dce->operand);
+			strcpy(commentBuffer, dce->comment);
+			return dce->len;
+		}
+	}
+
+	len = Disass68k(addr, labelBuffer, opcodeBuffer, operandBuffer, commentBuffer);
+
+	// long data lines and long texts aren't cached
+	if(len <= 0 || (len & 1) || len > DISASM_CACHE_WORDS*2
+	   || strlen(labelBuffer) >= sizeof(dce->label) || strlen(opcodeBuffer) >= sizeof(dce->opcode)
+	   || strlen(operandBuffer) >= sizeof(dce->operand) || strlen(commentBuffer) >= sizeof(dce->comment))
+		return len;
+
+	dce->addr = addr;
+	dce->len = len;
+	dce->generation = disCacheGeneration;
+	for(i=0; i<len/2; ++i)
+		dce->words[i] = Disass68kGetWord(addr+i*2);
+	strcpy(dce->label, labelBuffer);
+	strcpy(dce->opcode, opcodeBuffer);
+	strcpy(dce->operand, operandBuffer);
+	strcpy(dce->comment, commentBuffer);
+	return len;
+}
+
 static void		Disass68kComposeStr(char *dbuf, const char *str, int position, int maxPos)
 {
 	int		i;
@@ -2457,7 +2539,7 @@ static void Disass68k_loop (FILE *f, uaecptr addr, uaecptr *nextpc, int cnt)
 		char	commentBuffer[256];
 		int	plen, len, j;
 
-		len = Disass68k(addr, labelBuffer, opcodeBuffer, operandBuffer, commentBuffer);
+		len = Disass68kCached(addr, labelBuffer, opcodeBuffer, operandBuffer, commentBuffer);
 		if(!len) break;
 
 		sprintf(addressBuffer, "$%*.*x :", addrWidth,addrWidth, addr);
@@ -2550,6 +2632,20 @@ void Disasm (FILE *f, uaecptr addr, uaecptr *nextpc, int cnt)
 		Disass68k_loop (f, addr, nextpc, cnt);
 }
 
+/**
+ * Disassemble one instruction at given address from the given words
+ * (e.g. recorded in an instruction trace) instead of the emulated memory.
+ * Always uses the stand alone disassembler.
+ */
+void Disasm_Words(FILE *f, uaecptr addr, const Uint16 *words, int count)
+{
+	disWords = words;
+	disWordsAddr = addr;
+	disWordsCount = count;
+	Disass68k_loop (f, addr, NULL, 1);
+	disWords = NULL;
+}
+
 static void Disasm_CheckOptionEngine(void)
 {
 	if (ConfigureParams.Debugger.bDisasmUAE)
@@ -2628,6 +2724,7 @@ int Disasm_GetOptions(void)
 void Disasm_SetCPUType ( int CPU , int FPU )
 {
 	optionCPUTypeMask = 0;
+	disCacheGeneration++;
 
 	if ( ( FPU == 68881 ) || ( FPU == 68882 ) )
 		optionCPUTypeMask |= MC_FPU;
@@ -2700,6 +2797,7 @@ const char *Disasm_ParseOption(const char *arg)
 		}
 		fprintf(stderr, "Changed CPU disassembly output flags from %d to %d.\n", options, newopt);
 		ConfigureParams.Debugger.nDisasmOptions = options = newopt;
+		disCacheGeneration++;
 		Disasm_CheckOptionEngine();
 		return NULL;
 	}
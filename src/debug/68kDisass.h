@@ -9,6 +9,7 @@
 
 extern Uint32 Disasm_GetNextPC(Uint32 pc);
 extern void Disasm (FILE *f, uaecptr addr, uaecptr *nextpc, int cnt);
+extern void Disasm_Words(FILE *f, uaecptr addr, const Uint16 *words, int count);
 
 enum {
 	DISASM_COLUMN_ADDRESS = 0,
@@ -66,7 +66,7 @@ static inline bool is_register_type(value_t vtype) {
 	return (vtype == VALUE_TYPE_REG16 || vtype == VALUE_TYPE_REG32);
 }
 
-typedef struct {
+typedef struct bc_value {
 	bool is_indirect;
 	char dsp_space;	/* DSP has P, X, Y address spaces, zero if not DSP */
 	value_t valuetype;	/* Hatari value variable type */
@@ -79,6 +79,7 @@ typedef struct {
 	} value;
 	Uint32 bits;	/* CPU has 8/16/32 bit address widths */
 	Uint32 mask;	/* <width mask> && <value mask> */
+	Uint32 (*get)(const struct bc_value *bc_value);	/* set by BreakCond_Compile() */
 } bc_value_t;
 
 typedef struct {
@@ -104,6 +105,9 @@ typedef struct {
 	bc_condition_t *conditions;
 	int ccount;	/* condition count */
 	int hits;	/* how many times breakpoint hit */
+	bool pc_anchored;	/* a condition is "pc = <pc_value>" */
+	Uint32 pc_value;
+	bool mem_watched;	/* tracks values only at fixed memory addresses */
 } bc_breakpoint_t;
 
 static bc_breakpoint_t *BreakPointsCpu;
@@ -111,10 +115,29 @@ static bc_breakpoint_t *BreakPointsDsp;
 static int BreakPointCpuCount, BreakPointCpuAllocated;
 static int BreakPointDspCount, BreakPointDspAllocated;
 
+/* index of CPU breakpoints: a bit is set for each (24-bit) PC value
+ * of the PC anchored breakpoints, others need always to be checked
+ */
+#define BC_PCMAP_BYTES ((1<<24)/8)
+static Uint8 *BreakPointsCpuPcMap;
+static int BreakPointCpuUnanchoredCount;
+
+/* memory areas read by the memory watching CPU breakpoints, these
+ * breakpoints are checked only after CPU has written to one of them
+ */
+typedef struct {
+	Uint32 addr;
+	Uint32 size;
+} bc_watch_t;
+static bc_watch_t *BreakPointCpuWatches;
+static int BreakPointCpuWatchCount;
+static bool BreakPointCpuWatchWritten;
+
 
 /* forward declarations */
 static bool BreakCond_Remove(int position, bool bForDsp);
 static void BreakCond_Print(bc_breakpoint_t *bp);
+static Uint32 GetCpuPC(void);
 
 
 /**
@@ -244,6 +267,26 @@ static Uint32 BreakCond_GetValue(const bc_value_t *bc_value)
 	return (value & bc_value->mask);
 }
 
+/* Accessors for the bc_value_t types which don't need a type switch
+ * or indirection, set for each value by BreakCond_Compile()
+ */
+static Uint32 BreakCond_GetNumber(const bc_value_t *bc_value)
+{
+	return bc_value->value.number & bc_value->mask;
+}
+static Uint32 BreakCond_GetFunction32(const bc_value_t *bc_value)
+{
+	return bc_value->value.func32() & bc_value->mask;
+}
+static Uint32 BreakCond_GetReg16(const bc_value_t *bc_value)
+{
+	return *(bc_value->value.reg16) & bc_value->mask;
+}
+static Uint32 BreakCond_GetReg32(const bc_value_t *bc_value)
+{
+	return *(bc_value->value.reg32) & bc_value->mask;
+}
+
 
 /**
  * Show & update rvalue for a tracked breakpoint condition to lvalue
@@ -268,9 +311,10 @@ static void BreakCond_UpdateTracked(bc_condition_t *condition, Uint32 value)
 
 
 /**
- * Return true if all of the given breakpoint's conditions match
+ * Return true if all of the given breakpoint's conditions match.
+ * Tracked values are updated only if 'track' is set.
  */
-static bool BreakCond_MatchConditions(bc_condition_t *condition, int count)
+static bool BreakCond_MatchConditions(bc_condition_t *condition, int count, bool track)
 {
 	Uint32 lvalue, rvalue;
 	bool hit = false;
@@ -278,8 +322,8 @@ static bool BreakCond_MatchConditions(bc_condition_t *condition, int count)
 	
 	for (i = 0; i < count; condition++, i++) {
 
-		lvalue = BreakCond_GetValue(&(condition->lvalue));
-		rvalue = BreakCond_GetValue(&(condition->rvalue));
+		lvalue = condition->lvalue.get(&(condition->lvalue));
+		rvalue = condition->rvalue.get(&(condition->rvalue));
 
 		switch (condition->comparison) {
 		case '<':
@@ -302,7 +346,7 @@ static bool BreakCond_MatchConditions(bc_condition_t *condition, int count)
 		if (!hit) {
 			return false;
 		}
-		if (condition->track) {
+		if (condition->track && track) {
 			BreakCond_UpdateTracked(condition, lvalue);
 		}
 	}
@@ -312,17 +356,25 @@ static bool BreakCond_MatchConditions(bc_condition_t *condition, int count)
 
 
 /**
- * Show all breakpoints which conditions matched and return which matched
+ * Show all breakpoints which conditions matched and return which matched.
+ * Breakpoints anchored to another PC value than given one are skipped,
+ * as are memory watching ones when their memory wasn't written.
  * @return	index to last matching (non-tracing) breakpoint,
  *		or zero if none matched
  */
-static int BreakCond_MatchBreakPoints(bc_breakpoint_t *bp, int count, const char *name)
+static int BreakCond_MatchBreakPoints(bc_breakpoint_t *bp, int count, const char *name, Uint32 pc, bool written)
 {
 	int i, ret = 0;
 
 	for (i = 0; i < count; bp++, i++) {
 
-		if (BreakCond_MatchConditions(bp->conditions, bp->ccount)) {
+		if (bp->pc_anchored && bp->pc_value != pc) {
+			continue;
+		}
+		if (bp->mem_watched && !written) {
+			continue;
+		}
+		if (BreakCond_MatchConditions(bp->conditions, bp->ccount, true)) {
 			bool for_dsp;
 
 			bp->hits++;
@@ -380,7 +432,42 @@ static int BreakCond_MatchBreakPoints(bc_breakpoint_t *bp, int count, const char
  */
 int BreakCond_MatchCpu(void)
 {
-	return BreakCond_MatchBreakPoints(BreakPointsCpu, BreakPointCpuCount, "CPU");
+	Uint32 pc = M68000_GetPC();
+	bool written = BreakPointCpuWatchWritten;
+
+	/* only PC anchored and memory watching breakpoints,
+	 * and none of them for this PC or written memory?
+	 */
+	if (!BreakPointCpuUnanchoredCount && !written &&
+	    !(BreakPointsCpuPcMap[(pc & 0xffffff) >> 3] & (1 << (pc & 7)))) {
+		return 0;
+	}
+	BreakPointCpuWatchWritten = false;
+	return BreakCond_MatchBreakPoints(BreakPointsCpu, BreakPointCpuCount, "CPU", pc, written);
+}
+
+/**
+ * Return index of first (non-tracing) CPU breakpoint matching now, or zero.
+ * Unlike BreakCond_MatchCpu(), this has no side effects: hits aren't
+ * counted, nothing is shown, breakpoint options aren't acted on and
+ * tracked values aren't updated (used by reverse execution to search
+ * for earlier breakpoint hits).
+ */
+int BreakCond_CheckCpu(void)
+{
+	bc_breakpoint_t *bp = BreakPointsCpu;
+	Uint32 pc = M68000_GetPC();
+	int i;
+
+	for (i = 0; i < BreakPointCpuCount; bp++, i++) {
+		if (bp->options.trace || (bp->pc_anchored && bp->pc_value != pc)) {
+			continue;
+		}
+		if (BreakCond_MatchConditions(bp->conditions, bp->ccount, false)) {
+			return i + 1;
+		}
+	}
+	return 0;
 }
 
 /**
@@ -388,7 +475,7 @@ int BreakCond_MatchCpu(void)
  */
 int BreakCond_MatchDsp(void)
 {
-	return BreakCond_MatchBreakPoints(BreakPointsDsp, BreakPointDspCount, "DSP");
+	return BreakCond_MatchBreakPoints(BreakPointsDsp, BreakPointDspCount, "DSP", 0, false);
 }
 
 /**
@@ -647,6 +734,27 @@ bool BreakCond_GetHatariVariable(const char *name, Uint32 *value)
 	return true;
 }
 
+/**
+ * If given string is a Hatari variable name, set either pointer to
+ * the variable or to its accessor function (other one is set to NULL)
+ * and return true, otherwise return false.
+ */
+bool BreakCond_GetHatariVariableAccess(const char *name, Uint32 **var, Uint32 (**func)(void))
+{
+	bc_value_t bc_value;
+	if (!BreakCond_ParseVariable(name, &bc_value)) {
+		return false;
+	}
+	if (bc_value.valuetype == VALUE_TYPE_FUNCTION32) {
+		*func = bc_value.value.func32;
+		*var = NULL;
+	} else {
+		*var = bc_value.value.reg32;
+		*func = NULL;
+	}
+	return true;
+}
+
 
 /**
  * If given string matches a suitable symbol, set bc_value
@@ -1384,6 +1492,223 @@ static void BreakCond_CheckTracking(bc_breakpoint_t *bp)
 }
 
 
+/**
+ * Set accessor for given value, so that matching doesn't need
+ * to switch on its type.
+ */
+static void BreakCond_CompileValue(bc_value_t *bc_value)
+{
+	if (bc_value->is_indirect) {
+		bc_value->get = BreakCond_GetValue;
+		return;
+	}
+	switch (bc_value->valuetype) {
+	case VALUE_TYPE_NUMBER:
+		bc_value->get = BreakCond_GetNumber;
+		break;
+	case VALUE_TYPE_FUNCTION32:
+		bc_value->get = BreakCond_GetFunction32;
+		break;
+	case VALUE_TYPE_REG16:
+		bc_value->get = BreakCond_GetReg16;
+		break;
+	default:
+		bc_value->get = BreakCond_GetReg32;
+		break;
+	}
+}
+
+/**
+ * Return true if given value is the full CPU PC register
+ */
+static bool BreakCond_IsCpuPC(const bc_value_t *bc_value)
+{
+	return (!bc_value->is_indirect && !bc_value->dsp_space &&
+		bc_value->valuetype == VALUE_TYPE_FUNCTION32 &&
+		bc_value->value.func32 == GetCpuPC &&
+		bc_value->mask == BITMASK(32));
+}
+
+/**
+ * Return true if given value is a number or CPU memory at a fixed address
+ */
+static bool BreakCond_IsFixed(const bc_value_t *bc_value)
+{
+	return (bc_value->valuetype == VALUE_TYPE_NUMBER && !bc_value->dsp_space);
+}
+
+/**
+ * Return true if given CPU breakpoint conditions depend only on CPU memory
+ * at fixed addresses and at least one of them tracks value changes.
+ * Matching such a breakpoint again can't succeed before something is
+ * written to those addresses, so it needs to be checked only after that.
+ */
+static bool BreakCond_IsMemWatchable(const bc_breakpoint_t *bp)
+{
+	const bc_condition_t *condition;
+	bool track = false;
+	int i;
+
+	condition = bp->conditions;
+	for (i = 0; i < bp->ccount; condition++, i++) {
+		if (!(BreakCond_IsFixed(&(condition->lvalue)) &&
+		      BreakCond_IsFixed(&(condition->rvalue)))) {
+			return false;
+		}
+		if (condition->track && condition->lvalue.is_indirect) {
+			track = true;
+		}
+	}
+	return track;
+}
+
+/**
+ * Set accessors for all the values of given breakpoint conditions.
+ * For CPU, check also whether one of the conditions is a PC equality
+ * with a number, the breakpoint can then match only at that PC value,
+ * and whether it can be checked only after writes to its memory.
+ */
+static void BreakCond_Compile(bc_breakpoint_t *bp, bool bForDsp)
+{
+	bc_condition_t *condition;
+	const bc_value_t *number;
+	int i;
+
+	bp->pc_anchored = false;
+	bp->mem_watched = !bForDsp && BreakCond_IsMemWatchable(bp);
+	condition = bp->conditions;
+	for (i = 0; i < bp->ccount; condition++, i++) {
+
+		BreakCond_CompileValue(&(condition->lvalue));
+		BreakCond_CompileValue(&(condition->rvalue));
+
+		if (bForDsp || bp->pc_anchored || condition->comparison != '=') {
+			continue;
+		}
+		if (BreakCond_IsCpuPC(&(condition->lvalue))) {
+			number = &(condition->rvalue);
+		} else if (BreakCond_IsCpuPC(&(condition->rvalue))) {
+			number = &(condition->lvalue);
+		} else {
+			continue;
+		}
+		if (number->valuetype == VALUE_TYPE_NUMBER && !number->is_indirect) {
+			bp->pc_anchored = true;
+			bp->pc_value = number->value.number & number->mask;
+		}
+	}
+}
+
+/**
+ * Called by the memory banks after CPU writes to watched memory
+ */
+static void BreakCond_MemWritten(uaecptr addr, int size)
+{
+	const bc_watch_t *watch = BreakPointCpuWatches;
+	int i;
+
+	addr &= 0x00ffffff;
+	for (i = 0; i < BreakPointCpuWatchCount; watch++, i++) {
+		if (addr < watch->addr + watch->size && watch->addr < addr + size) {
+			BreakPointCpuWatchWritten = true;
+			return;
+		}
+	}
+}
+
+/**
+ * Add memory area of given value to watched ones, if it's indirect
+ * @return	next free watch
+ */
+static bc_watch_t *BreakCond_WatchValue(bc_watch_t *watch, const bc_value_t *bc_value)
+{
+	if (!bc_value->is_indirect) {
+		return watch;
+	}
+	watch->addr = bc_value->value.number & 0x00ffffff;
+	watch->size = bc_value->bits / 8;
+	memory_watch_bank(watch->addr);
+	memory_watch_bank(watch->addr + watch->size - 1);
+	return watch + 1;
+}
+
+/**
+ * Collect memory areas of the memory watching CPU breakpoints
+ * and set memory banks to watch writes to them
+ */
+static void BreakCond_WatchCpu(void)
+{
+	const bc_condition_t *condition;
+	bc_watch_t *watch;
+	int i, j, count = 0;
+
+	memory_set_watch_handler(NULL);
+	BreakPointCpuWatchWritten = false;
+	BreakPointCpuWatchCount = 0;
+	free(BreakPointCpuWatches);
+	BreakPointCpuWatches = NULL;
+
+	for (i = 0; i < BreakPointCpuCount; i++) {
+		if (BreakPointsCpu[i].mem_watched) {
+			count += 2 * BreakPointsCpu[i].ccount;
+		}
+	}
+	if (!count) {
+		return;
+	}
+	BreakPointCpuWatches = malloc(count * sizeof(bc_watch_t));
+	assert(BreakPointCpuWatches);
+
+	memory_set_watch_handler(BreakCond_MemWritten);
+	watch = BreakPointCpuWatches;
+	for (i = 0; i < BreakPointCpuCount; i++) {
+		if (!BreakPointsCpu[i].mem_watched) {
+			continue;
+		}
+		condition = BreakPointsCpu[i].conditions;
+		for (j = 0; j < BreakPointsCpu[i].ccount; condition++, j++) {
+			watch = BreakCond_WatchValue(watch, &(condition->lvalue));
+			watch = BreakCond_WatchValue(watch, &(condition->rvalue));
+		}
+	}
+	BreakPointCpuWatchCount = watch - BreakPointCpuWatches;
+}
+
+/**
+ * Rebuild CPU breakpoints index after breakpoints were added or removed
+ */
+static void BreakCond_IndexCpu(void)
+{
+	Uint32 pc;
+	int i;
+
+	BreakCond_WatchCpu();
+	BreakPointCpuUnanchoredCount = 0;
+	if (!BreakPointCpuCount) {
+		free(BreakPointsCpuPcMap);
+		BreakPointsCpuPcMap = NULL;
+		return;
+	}
+	if (!BreakPointsCpuPcMap) {
+		BreakPointsCpuPcMap = malloc(BC_PCMAP_BYTES);
+		assert(BreakPointsCpuPcMap);
+	}
+	memset(BreakPointsCpuPcMap, 0, BC_PCMAP_BYTES);
+
+	for (i = 0; i < BreakPointCpuCount; i++) {
+		if (BreakPointsCpu[i].mem_watched) {
+			continue;
+		}
+		if (!BreakPointsCpu[i].pc_anchored) {
+			BreakPointCpuUnanchoredCount++;
+			continue;
+		}
+		pc = BreakPointsCpu[i].pc_value & 0xffffff;
+		BreakPointsCpuPcMap[pc >> 3] |= 1 << (pc & 7);
+	}
+}
+
+
 /**
  * Parse given breakpoint expression and store it.
  * Return true for success and false for failure.
@@ -1447,6 +1772,10 @@ static bool BreakCond_Parse(const char *expression, bc_options_t *options, bool
 			}
 		}
 		BreakCond_CheckTracking(bp);
+		BreakCond_Compile(bp, bForDsp);
+		if (!bForDsp) {
+			BreakCond_IndexCpu();
+		}
 
 		bp->options.quiet = options->quiet;
 		bp->options.skip = options->skip;
@@ -1573,9 +1902,44 @@ static bool BreakCond_Remove(int position, bool bForDsp)
 			(*bcount-position)*sizeof(bc_breakpoint_t));
 	}
 	(*bcount)--;
+	if (!bForDsp) {
+		BreakCond_IndexCpu();
+	}
 	return true;
 }
 
+/**
+ * Remove first breakpoint matching given expression, comparison
+ * is done with the normalized expression form.
+ * Return true if such breakpoint was found and removed.
+ */
+bool BreakCond_RemoveExpression(const char *expression, bool bForDsp)
+{
+	parser_state_t pstate;
+	bc_breakpoint_t *bp;
+	const char *name;
+	char *normalized;
+	int *bcount, i;
+	bool removed = false;
+
+	normalized = BreakCond_TokenizeExpression(expression, &pstate);
+	if (pstate.argv) {
+		free(pstate.argv);
+	}
+	if (!normalized) {
+		return false;
+	}
+	bcount = BreakCond_GetListInfo(&bp, &name, bForDsp);
+	for (i = 0; i < *bcount; i++) {
+		if (strcmp(bp[i].expression, normalized) == 0) {
+			removed = BreakCond_Remove(i+1, bForDsp);
+			break;
+		}
+	}
+	free(normalized);
+	return removed;
+}
+
 
 /**
  * Remove all condition breakpoints
@@ -1628,6 +1992,9 @@ static void BreakCond_Help(void)
 "  inequality ('!') comparison, the breakpoint will additionally track\n"
 "  all further changes for the given address/register expression value.\n"
 "  (This is useful for tracking register and memory value changes.)\n"
+"  Tracking breakpoints using only memory at fixed addresses are checked\n"
+"  only after CPU or blitter writes to that memory, which is much faster,\n"
+"  but changes done by DMA or by the emulated hardware aren't noticed.\n"
 "\n"
 "  M68k addresses can have byte (b), word (w) or long (l, default) width.\n"
 "  DSP addresses belong to different address spaces: P, X or Y. Note that\n"
@@ -15,16 +15,21 @@ extern char *BreakCond_MatchDspVariable(const char *text, int state);
 
 /* for evaluate.c */
 extern bool BreakCond_GetHatariVariable(const char *name, Uint32 *value);
+extern bool BreakCond_GetHatariVariableAccess(const char *name, Uint32 **var, Uint32 (**func)(void));
 
 /* for debugcpu.c & debugdsp.c */
 extern const char BreakCond_Description[];
 extern const char BreakAddr_Description[];
 
 extern int BreakCond_MatchCpu(void);
+/* for reverse.c */
+extern int BreakCond_CheckCpu(void);
 extern int BreakCond_MatchDsp(void);
 extern int BreakCond_BreakPointCount(bool bForDsp);
 extern bool BreakCond_Command(const char *expression, bool bForDsp);
 extern bool BreakAddr_Command(char *expression, bool bforDsp);
+/* for gdbstub.c */
+extern bool BreakCond_RemoveExpression(const char *expression, bool bForDsp);
 
 /* extra functions exported for the test code */
 extern int BreakCond_MatchCpuExpression(int position, const char *expression);
@@ -32,6 +32,9 @@ const char DebugInfo_fileid[] = "Hatari debuginfo.c : " __DATE__ " " __TIME__;
 #include "m68000.h"
 #include "psg.h"
 #include "stMemory.h"
+#include "stats.h"
+#include "perf.h"
+#include "fileWriter.h"
 #include "tos.h"
 #include "screen.h"
 #include "vdi.h"
@@ -611,11 +614,14 @@ static const struct {
 	{ true, "history",   History_Show,         NULL, "Show history of last <count> instructions" },
 	{ true, "memdump",   DebugInfo_CpuMemDump, NULL, "Dump CPU memory from given <address>" },
 	{ false,"osheader",  DebugInfo_OSHeader,   NULL, "Show TOS OS header contents" },
+	{ false,"perf",      Perf_Info,            NULL, "Show host time percentiles of the frame stages (enables timing)" },
 	{ true, "regaddr",   DebugInfo_RegAddr, DebugInfo_RegAddrArgs, "Show <disasm|memdump> from CPU/DSP address pointed by <register>" },
 	{ true, "registers", DebugInfo_CpuRegister,NULL, "Show CPU register contents" },
+	{ false,"stats",     Stats_Info,           NULL, "Show hot path counters of the last frame (enables them)" },
 	{ false,"vdi",       VDI_Info,             NULL, "Show VDI vector contents (with <value>, show opcodes)" },
 	{ false,"videl",     Videl_Info,           NULL, "Show Falcon Videl register contents" },
 	{ false,"video",     Video_Info,           NULL, "Show Video information" },
+	{ false,"writer",    FileWriter_Info,      NULL, "Show recording file writer statistics" },
 	{ false,"xbios",     XBios_Info,           NULL, "Show XBIOS opcodes" },
 	{ false,"ym",        PSG_Info,             NULL, "Show YM-2149 register contents" },
 };
@@ -26,7 +26,9 @@ const char DebugCpu_fileid[] = "Hatari debugcpu.c : " __DATE__ " " __TIME__;
 #include "log.h"
 #include "m68000.h"
 #include "memorySnapShot.h"
+#include "opcount.h"
 #include "profile.h"
+#include "reverse.h"
 #include "stMemory.h"
 #include "str.h"
 #include "symbols.h"
@@ -486,6 +488,15 @@ static int DebugCpu_Step(int nArgc, char *psArgv[])
 	return DEBUGGER_END;
 }
 
+/**
+ * Set how many CPU instructions to run before entering debugger,
+ * zero for running until something else invokes it.
+ */
+void DebugCpu_SetSteps(int steps)
+{
+	nCpuSteps = steps;
+}
+
 
 /**
  * Readline match callback to list next command opcode types.
@@ -608,10 +619,18 @@ Uint32 DebugCpu_InstrCount(void)
 void DebugCpu_Check(void)
 {
 	nCpuInstructions++;
+	if (Reverse_IsEnabled() && Reverse_CpuUpdate())
+	{
+		return;
+	}
 	if (bCpuProfiling)
 	{
 		Profile_CpuUpdate();
 	}
+	if (OpCount_Enabled())
+	{
+		OpCount_AddCpu();
+	}
 	if (LOG_TRACE_LEVEL((TRACE_CPU_DISASM|TRACE_CPU_SYMBOLS)))
 	{
 		DebugCpu_ShowAddressInfo(M68000_GetPC());
@@ -638,6 +657,10 @@ void DebugCpu_Check(void)
 	{
 		History_AddCpu();
 	}
+	if (History_RecordingCpu())
+	{
+		History_RecordCpu();
+	}
 	if (ConOutDevice != CONOUT_DEVICE_NONE)
 	{
 		Console_Check();
@@ -654,7 +677,9 @@ void DebugCpu_SetDebugging(void)
 	bCpuProfiling = Profile_CpuStart();
 	nCpuActiveCBs = BreakCond_BreakPointCount(false);
 
-	if (nCpuActiveCBs || nCpuSteps || bCpuProfiling || History_TrackCpu()
+	if (nCpuActiveCBs || nCpuSteps || bCpuProfiling || OpCount_Enabled()
+	    || History_TrackCpu()
+	    || History_RecordingCpu() || Reverse_IsEnabled()
 	    || LOG_TRACE_LEVEL((TRACE_CPU_DISASM|TRACE_CPU_SYMBOLS))
 	    || ConOutDevice != CONOUT_DEVICE_NONE)
 	{
@@ -692,6 +717,11 @@ static const dbgcommand_t cpucommands[] =
 	  "profile CPU code",
 	  Profile_Description,
 	  false },
+	{ OpCount_Parse, OpCount_Match,
+	  "opcodes", "",
+	  "count executed CPU opcodes and opcode pairs",
+	  OpCount_Description,
+	  false },
 	{ DebugCpu_Register, DebugCpu_MatchRegister,
 	  "cpureg", "r",
 	  "dump register values or set register to value",
@@ -730,6 +760,11 @@ static const dbgcommand_t cpucommands[] =
 	  "load CPU symbols & their addresses",
 	  Symbols_Description,
 	  false },
+	{ Reverse_Parse, Reverse_Match,
+	  "reverse", "",
+	  "step/continue CPU backwards using checkpoints",
+	  Reverse_Description,
+	  false },
 	{ DebugCpu_Step, NULL,
 	  "step", "s",
 	  "single-step CPU",
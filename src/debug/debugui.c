@@ -28,9 +28,11 @@ const char DebugUI_fileid[] = "Hatari debugui.c : " __DATE__ " " __TIME__;
 #include "log.h"
 #include "m68000.h"
 #include "memorySnapShot.h"
+#include "movie.h"
 #include "options.h"
 #include "reset.h"
 #include "screen.h"
+#include "screenSnapShot.h"
 #include "statusbar.h"
 #include "str.h"
 
@@ -42,8 +44,11 @@ const char DebugUI_fileid[] = "Hatari debugui.c : " __DATE__ " " __TIME__;
 #include "debugInfo.h"
 #include "debugui.h"
 #include "evaluate.h"
+#include "gdbstub.h"
+#include "heatmap.h"
 #include "history.h"
 #include "symbols.h"
+#include "timeline.h"
 
 #ifdef VITA
 #include "retro_files.h"
@@ -313,6 +318,30 @@ static int DebugUI_DoMemorySnap(int argc, char *argv[])
 }
 
 
+#ifdef __LIBRETRO__
+/**
+ * Command: Record or play input movie
+ */
+static char *DebugUI_MatchMovie(const char *text, int state)
+{
+	static const char* cmds[] = { "play", "record", "stop" };
+	return DebugUI_MatchHelper(cmds, ARRAYSIZE(cmds), text, state);
+}
+static int DebugUI_Movie(int argc, char *argv[])
+{
+	if (argc == 2 && strcmp(argv[1], "stop") == 0)
+		Movie_Stop();
+	else if (argc == 3 && strcmp(argv[1], "record") == 0)
+		Movie_Record(argv[2]);
+	else if (argc == 3 && strcmp(argv[1], "play") == 0)
+		Movie_Play(argv[2]);
+	else
+		return DebugUI_PrintCmdHelp(argv[0]);
+	return DEBUGGER_CMDDONE;
+}
+#endif
+
+
 /**
  * Command: Set command line and debugger options
  */
@@ -418,6 +447,19 @@ static int DebugUI_Rename(int argc, char *argv[])
 }
 
 
+/**
+ * Command: Save screenshot
+ */
+static int DebugUI_ScreenShot(int argc, char *argv[])
+{
+	if (argc != 1)
+		return DebugUI_PrintCmdHelp(argv[0]);
+
+	ScreenSnapShot_SaveScreen();
+	return DEBUGGER_CMDDONE;
+}
+
+
 /**
  * Command: Reset emulation
  */
@@ -874,21 +916,42 @@ static const dbgcommand_t uicommand[] =
 	  "\tResult value is shown as binary, decimal and hexadecimal.\n"
 	  "\tAfter this, '$' will TAB-complete to last result value.",
 	  true },
+	{ GdbStub_Parse, GdbStub_Match,
+	  "gdbserver", "",
+	  "start/stop GDB remote protocol server",
+	  GdbStub_Description,
+	  false },
 	{ DebugUI_Help, DebugUI_MatchCommand,
 	  "help", "h",
 	  "print help",
 	  "[command]\n"
 	  "\tPrint help text for available commands.",
 	  false },
+	{ HeatMap_Parse, HeatMap_Match,
+	  "heatmap", "",
+	  "count CPU accesses to ST RAM and IO memory",
+	  "on [interval]|off|<count>|save <file>|frames <file>\n"
+	  "\t'on' starts counting every <interval>th (default 1) CPU read\n"
+	  "\tand write per 256 byte block of ST RAM and per IO address.\n"
+	  "\tGiving just count shows that many most accessed blocks and\n"
+	  "\tIO addresses.  'save' writes all counts to a CSV file, 'frames'\n"
+	  "\twrites the counts changed during each frame to a CSV file until\n"
+	  "\tcounting is turned off.",
+	  false },
 	{ History_Parse, History_Match,
 	  "history", "hi",
 	  "show last CPU/DSP PC values & executed instructions",
 	  "cpu|dsp|on|off|<count> [limit]|save <file>\n"
+	  "\t|record <file> [regs]|record off|decode <trace> <file>\n"
 	  "\t'cpu' and 'dsp' enable instruction history tracking for just given\n"
 	  "\tprocessor, 'on' tracks them both, 'off' will disable history.\n"
 	  "\tOptional 'limit' will set how many past instructions are tracked.\n"
 	  "\tGiving just count will show (at max) given number of last saved PC\n"
-	  "\tvalues and instructions currently at corresponding RAM addresses.",
+	  "\tvalues and instructions currently at corresponding RAM addresses.\n"
+	  "\t'record' writes every executed CPU instruction (cycles, PC, SR,\n"
+	  "\tinstruction words and with 'regs' also registers) to a compressed\n"
+	  "\tbinary trace file, until 'record off'.  'decode' disassembles\n"
+	  "\ta recorded trace file to a text file.",
 	  false },
 	{ DebugInfo_Command, DebugInfo_MatchInfo,
 	  "info", "i",
@@ -911,6 +974,17 @@ static const dbgcommand_t uicommand[] =
 	  "\tOpen log file, no argument closes the log file. Output of\n"
 	  "\tregister & memory dumps and disassembly will be written to it.",
 	  false },
+#ifdef __LIBRETRO__
+	{ DebugUI_Movie, DebugUI_MatchMovie,
+	  "movie", "",
+	  "record or play input movie",
+	  "record <file>|play <file>|stop\n"
+	  "\tStart recording the input, with the emulation state hash of\n"
+	  "\tevery frame, or playing it back from the recorded starting\n"
+	  "\tstate and checking the hashes, on the next frame boundary.\n"
+	  "\tNeeds deterministic mode.",
+	  false },
+#endif
 	{ DebugUI_CommandsFromFile, NULL,
 	  "parse", "p",
 	  "get debugger commands from file",
@@ -928,6 +1002,13 @@ static const dbgcommand_t uicommand[] =
 	  "reset emulation",
 	  "<soft|hard>\n",
 	  false },
+	{ DebugUI_ScreenShot, NULL,
+	  "screenshot", "",
+	  "save screenshot",
+	  "\n"
+	  "\tSave screenshot of the shown screen, or of the next frame\n"
+	  "\tin headless mode, to the screenshot directory.",
+	  false },
 	{ DebugUI_SetOptions, Opt_MatchOption,
 	  "setopt", "o",
 	  "set Hatari command line and debugger options",
@@ -948,6 +1029,15 @@ static const dbgcommand_t uicommand[] =
 	  "[filename]\n"
 	  "\tSave emulation snapshot to default or given file",
 	  false },
+	{ Timeline_Parse, Timeline_Match,
+	  "timeline", "",
+	  "record CycInt handler timeline",
+	  "on [events]|off|save <file>\n"
+	  "\t'on' starts recording emulated cycle, host time and duration\n"
+	  "\tof every CycInt handler call, keeping the given number of\n"
+	  "\tlatest events.  'save' writes them to a Chrome trace JSON\n"
+	  "\tfile, which can be viewed with Perfetto or chrome://tracing.",
+	  false },
 	{ DebugUI_SetTracing, Log_MatchTrace,
 	  "trace", "t",
 	  "select Hatari tracing settings",
@@ -1029,6 +1119,16 @@ void DebugUI(debug_reason_t reason)
 		"\nYou have entered debug mode. Type c to continue emulation, h for help.\n";
 
 	History_Mark(reason);
+	Log_FlushTrace();
+
+	/* remote debugger takes over from console */
+	if (GdbStub_IsConnected())
+	{
+		GdbStub_Stopped(reason);
+		DebugCpu_SetDebugging();
+		DebugDsp_SetDebugging();
+		return;
+	}
 
 	if (bInFullScreen)
 		Screen_ReturnFromFullScreen();
@@ -11,6 +11,12 @@
   ST RAM value addressing.
 
   Originally based on code from my Clac calculator MiNT filter version.
+
+  While an expression is parsed & evaluated, it's also compiled to
+  a postfix form where register, variable and symbol names are already
+  resolved.  That is cached by the expression string, so that repeated
+  evaluation of the same expression (e.g. in debugger scripts) doesn't
+  need to re-parse it.
 */
 const char Eval_fileid[] = "Hatari calculate.c : " __DATE__ " " __TIME__;
 
@@ -54,6 +60,51 @@ const char Eval_fileid[] = "Hatari calculate.c : " __DATE__ " " __TIME__;
 /* operation with lowest precedence, used to finish calculations */
 #define LOWEST_PREDECENCE '|'
 
+/* compiled expression item types, in addition to binary operators	*/
+#define ITEM_NUMBER	'N'		/* constant / symbol address	*/
+#define ITEM_VAR32	'R'		/* 32-bit register / variable	*/
+#define ITEM_VAR16	'r'		/* 16-bit register		*/
+#define ITEM_FUNC32	'F'		/* variable accessor function	*/
+#define ITEM_CPU_PC	'P'
+#define ITEM_CPU_SR	'S'
+#define ITEM_NEGATE	'n'		/* '-' prefix			*/
+#define ITEM_INVERT	'~'		/* '~' prefix			*/
+#define ITEM_INDIRECT	'('		/* long from ST RAM address	*/
+
+/* size of compiled expression cache, needs to be power of 2 */
+#define EVAL_CACHE_SIZE	64
+
+/* compiled (postfix) expression item */
+typedef struct {
+	char type;			/* ITEM_* or operator		*/
+	union {
+		Uint32 number;
+		Uint32 *var32;
+		Uint16 *var16;
+		Uint32 (*func32)(void);
+	} value;
+	Uint32 mask;
+} eval_item_t;
+
+/* cached compiled expression */
+typedef struct {
+	char *expression;
+	bool bForDsp;			/* register/symbol namespace	*/
+	int base;			/* default number base used	*/
+	int length;			/* parsed length of expression	*/
+	int count;
+	eval_item_t *items;
+} eval_cache_t;
+
+static eval_cache_t cache[EVAL_CACHE_SIZE];
+
+/* expression being compiled while evaluated */
+static struct {
+	int idx;
+	int max;
+	eval_item_t *buf;
+} prog = {0, 0, NULL};
+
 /* globals + function identifier stack(s)				*/
 static struct {
 	const char *error;		/* global error code		*/
@@ -108,6 +159,9 @@ static int get_level(int stk_offset);
 /* evaluate operation		*/
 static long long apply_op(char op, long long x, long long y);
 
+/* parse, evaluate & compile expression */
+static const char* parse_expression(const char *in, Uint32 *out, int *erroff, bool bForDsp);
+
 /* increase parenthesis level	*/
 static void open_bracket(void);
 /* decrease parenthesis level	*/
@@ -195,15 +249,17 @@ static int getNumber(const char *str, Uint32 *number, int *nbase)
 
 
 /**
- * Parse unsigned register/symbol/number value and set it to "number"
- * and the number base used for parsing to "base".
+ * Parse unsigned register/symbol/number value and set "item" to
+ * specify how it's accessed and the number base used for parsing
+ * to "base".
  * Return how many characters were parsed or zero for error.
  */
-static int getValue(const char *str, Uint32 *number, int *base, bool bForDsp)
+static int parseValue(const char *str, eval_item_t *item, int *base, bool bForDsp)
 {
 	char name[64];
 	const char *end;
 	Uint32 mask, *addr;
+	Uint32 (*func)(void);
 	int len;
 
 	for (end = str; *end == '_' || isalnum((unsigned char)*end); end++);
@@ -217,9 +273,18 @@ static int getValue(const char *str, Uint32 *number, int *base, bool bForDsp)
 	name[len] = '\0';
 
 	*base = 0; /* no base (e.g. variable) */
+	item->type = ITEM_NUMBER;
+	item->mask = 0xffffffff;
 
 	/* internal Hatari variable? */
-	if (BreakCond_GetHatariVariable(name, number)) {
+	if (BreakCond_GetHatariVariableAccess(name, &addr, &func)) {
+		if (func) {
+			item->type = ITEM_FUNC32;
+			item->value.func32 = func;
+		} else {
+			item->type = ITEM_VAR32;
+			item->value.var32 = addr;
+		}
 		return len;
 	}
 
@@ -228,38 +293,81 @@ static int getValue(const char *str, Uint32 *number, int *base, bool bForDsp)
 		/* DSP register or symbol? */
 		switch (regsize) {
 		case 16:
-			*number = (*((Uint16*)addr) & mask);
+			item->type = ITEM_VAR16;
+			item->value.var16 = (Uint16*)addr;
+			item->mask = mask;
 			return len;
 		case 32:
-			*number = (*addr & mask);
+			item->type = ITEM_VAR32;
+			item->value.var32 = addr;
+			item->mask = mask;
 			return len;
 		default:
-			if (Symbols_GetDspAddress(SYMTYPE_ALL, name, number)) {
+			if (Symbols_GetDspAddress(SYMTYPE_ALL, name, &(item->value.number))) {
 				return len;
 			}
 		}
 	} else {
 		/* a special case CPU register? */
 		if (strcasecmp(name, "PC") == 0) {
-			*number = M68000_GetPC();
+			item->type = ITEM_CPU_PC;
 			return len;
 		}
 		if (strcasecmp(name, "SR") == 0) {
-			*number = M68000_GetSR();
+			item->type = ITEM_CPU_SR;
 			return len;
 		}
 		/* a normal CPU  register or symbol? */
 		if (DebugCpu_GetRegisterAddress(name, &addr)) {
-			*number = *addr;
+			item->type = ITEM_VAR32;
+			item->value.var32 = addr;
 			return len;
 		}
-		if (Symbols_GetCpuAddress(SYMTYPE_ALL, name, number)) {
+		if (Symbols_GetCpuAddress(SYMTYPE_ALL, name, &(item->value.number))) {
 			return len;
 		}
 	}
 
 	/* none of above, assume it's a number */
-	return getNumber(str, number, base);
+	return getNumber(str, &(item->value.number), base);
+}
+
+/**
+ * Return current value of given (parsed) value item
+ */
+static Uint32 getItemValue(const eval_item_t *item)
+{
+	switch (item->type) {
+	case ITEM_VAR32:
+		return *(item->value.var32) & item->mask;
+	case ITEM_VAR16:
+		return *(item->value.var16) & item->mask;
+	case ITEM_FUNC32:
+		return item->value.func32();
+	case ITEM_CPU_PC:
+		return M68000_GetPC();
+	case ITEM_CPU_SR:
+		return M68000_GetSR();
+	default:
+		return item->value.number;
+	}
+}
+
+/**
+ * Parse unsigned register/symbol/number value and set it to "number"
+ * and the number base used for parsing to "base".
+ * Return how many characters were parsed or zero for error.
+ */
+static int getValue(const char *str, Uint32 *number, int *base, bool bForDsp)
+{
+	eval_item_t item;
+	int len;
+
+	len = parseValue(str, &item, base, bForDsp);
+	if (len) {
+		*number = getItemValue(&item);
+	}
+	return len;
 }
 
 
@@ -376,12 +484,162 @@ int Eval_Range(char *str1, Uint32 *lower, Uint32 *upper, bool fordsp)
 }
 
 
+/* ==================================================================== */
+/*			compiled expression cache			*/
+/* ==================================================================== */
+
+/**
+ * Add item to the expression being compiled (if any)
+ */
+static void emit(const eval_item_t *item)
+{
+	if (prog.idx < prog.max) {
+		prog.buf[prog.idx++] = *item;
+	}
+}
+
+static void emit_op(char oper)
+{
+	eval_item_t item;
+
+	item.type = oper;
+	emit(&item);
+}
+
+/**
+ * Return cache slot for given expression string
+ */
+static eval_cache_t *cache_slot(const char *expression)
+{
+	Uint32 hash = 2166136261u;
+
+	while (*expression) {
+		hash = (hash ^ (Uint8)*expression++) * 16777619u;
+	}
+	return &cache[hash & (EVAL_CACHE_SIZE-1)];
+}
+
+/**
+ * Free compiled expression in given cache slot
+ */
+static void cache_free(eval_cache_t *entry)
+{
+	free(entry->expression);
+	free(entry->items);
+	entry->expression = NULL;
+	entry->items = NULL;
+	entry->count = 0;
+}
+
+/**
+ * Drop all compiled expressions.  Needs to be called when symbols
+ * change, as their values are resolved at compile time.
+ */
+void Eval_FlushCache(void)
+{
+	int i;
+
+	for (i = 0; i < EVAL_CACHE_SIZE; i++) {
+		cache_free(&cache[i]);
+	}
+}
+
+/**
+ * Evaluate given compiled expression
+ * Return error string or NULL for success.
+ */
+static const char *eval_compiled(const eval_cache_t *entry, Uint32 *out)
+{
+	long long stack[VSTACK_MAX + 1];
+	const eval_item_t *item = entry->items;
+	int i, sp = -1;
+	Uint32 addr;
+
+	id.error = NULL;
+	for (i = 0; i < entry->count; item++, i++) {
+		switch (item->type) {
+		case ITEM_NUMBER:
+		case ITEM_VAR32:
+		case ITEM_VAR16:
+		case ITEM_FUNC32:
+		case ITEM_CPU_PC:
+		case ITEM_CPU_SR:
+			stack[++sp] = getItemValue(item);
+			break;
+		case ITEM_NEGATE:
+			stack[sp] = -stack[sp];
+			break;
+		case ITEM_INVERT:
+			stack[sp] = ~stack[sp];
+			break;
+		case ITEM_INDIRECT:
+			addr = stack[sp];
+			stack[sp] = STMemory_ReadLong(addr);
+			fprintf(stderr, "  value in RAM at ($%x).l = $%llx\n", addr, stack[sp]);
+			break;
+		default:
+			sp--;
+			stack[sp] = apply_op(item->type, stack[sp], stack[sp + 1]);
+		}
+	}
+	*out = stack[0];
+	return id.error;
+}
+
 /**
  * Evaluate expression. bForDsp determines which registers and symbols
  * are interpreted. Sets given value and parsing offset.
  * Return error string or NULL for success.
  */
 const char* Eval_Expression(const char *in, Uint32 *out, int *erroff, bool bForDsp)
+{
+	int base = ConfigureParams.Debugger.nNumberBase;
+	eval_cache_t *entry = cache_slot(in);
+	eval_item_t *items;
+	const char *error;
+
+	if (entry->expression && entry->bForDsp == bForDsp &&
+	    entry->base == base && strcmp(entry->expression, in) == 0) {
+		*erroff = entry->length;
+		if ((error = eval_compiled(entry, out))) {
+			*out = 0;
+		}
+		return error;
+	}
+
+	/* every item takes at least one char of the expression */
+	prog.max = strlen(in) + 1;
+	prog.buf = items = malloc(prog.max * sizeof(eval_item_t));
+	prog.idx = 0;
+	if (!items) {
+		prog.max = 0;
+	}
+	error = parse_expression(in, out, erroff, bForDsp);
+
+	if (error || !items || prog.idx >= prog.max) {
+		free(items);
+	} else {
+		cache_free(entry);
+		entry->expression = strdup(in);
+		entry->bForDsp = bForDsp;
+		entry->base = base;
+		entry->length = *erroff;
+		entry->count = prog.idx;
+		entry->items = items;
+	}
+	prog.buf = NULL;
+	prog.idx = prog.max = 0;
+	return error;
+}
+
+
+/**
+ * Parse and evaluate expression, compile it while at it.
+ * bForDsp determines which registers and symbols are interpreted.
+ * Sets given value and parsing offset.
+ * Return error string or NULL for success.
+ */
+static const char* parse_expression(const char *in, Uint32 *out, int *erroff, bool bForDsp)
 {
 	/* in	 : expression to evaluate				*/
 	/* out	 : final parsed value					*/
@@ -452,14 +710,15 @@ const char* Eval_Expression(const char *in, Uint32 *out, int *erroff, bool bForD
 		default:
 			/* register/symbol/number value needed? */
 			if (id.valid == false) {
-				Uint32 tmp;
+				eval_item_t item;
 				int consumed;
-				consumed = getValue(&(in[offset]), &tmp, &dummy, bForDsp);
+				consumed = parseValue(&(in[offset]), &item, &dummy, bForDsp);
 				/* number parsed? */
 				if (consumed) {
 					offset += consumed;
 					id.valid = true;
-					value = tmp;
+					value = getItemValue(&item);
+					emit(&item);
 					break;
 				}
 			}
@@ -572,9 +831,11 @@ static void apply_prefix(void)
 	switch(op.buf[op.idx]) {
 	case '-':
 		value = (-value);
+		emit_op(ITEM_NEGATE);
 		break;
 	case '~':
 		value = (~value);
+		emit_op(ITEM_INVERT);
 		break;
 	default:
 		id.error = CLAC_PRG_ERR;
@@ -599,6 +860,7 @@ static void eval_stack (void)
 		/* + calculate resulting value	*/
 		op.idx -= 1;
 		val.idx -= 1;
+		emit_op(op.buf[op.idx]);
 		val.buf[val.idx] = apply_op(op.buf[op.idx],
 			val.buf[val.idx], val.buf[val.idx + 1]);
 
@@ -725,6 +987,7 @@ static long long close_bracket (long long value)
 			/* fetch the indirect ST RAM value */
 			addr = val.buf[val.idx];
 			value = STMemory_ReadLong(addr);
+			emit_op(ITEM_INDIRECT);
 			fprintf(stderr, "  value in RAM at ($%x).l = $%llx\n", addr, value);
 			/* restore state before parenthesis */
 			op.idx = par.opx[par.idx] - 1;
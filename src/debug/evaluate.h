@@ -11,5 +11,6 @@
 extern bool Eval_Number(const char *value, Uint32 *number);
 extern int Eval_Range(char *str, Uint32 *lower, Uint32 *upper, bool bForDsp);
 extern const char* Eval_Expression(const char *expression, Uint32 *result, int *offset, bool bForDsp);
+extern void Eval_FlushCache(void);
 
 #endif
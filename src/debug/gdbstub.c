@@ -0,0 +1,784 @@
+/*
+ * Hatari - gdbstub.c
+ *
+ * This file is distributed under the GNU General Public License, version 2
+ * or at your option any later version. Read the file gpl.txt for details.
+ *
+ * gdbstub.c - GDB remote serial protocol server for the CPU.
+ *
+ * The server socket is polled once per VBL.  Queries that don't need
+ * the emulation to be stopped (register & memory reads/writes, breakpoint
+ * changes, general queries) are served right away, all of the packets
+ * received since the previous poll in one go, and emulation continues.
+ * Packets that need a stopped target ('?', 'c', 's'...) are left pending,
+ * the CPU is stopped after the next instruction and the debugger entry
+ * then serves the remote debugger instead of the console until it
+ * resumes the emulation.
+ *
+ * Breakpoints ('Z0'/'Z1') and write watchpoints ('Z2') are normal
+ * (quiet) conditional breakpoints, so they use the same PC and
+ * memory write indexing as the ones set from the console.
+ */
+const char GdbStub_fileid[] = "Hatari gdbstub.c : " __DATE__ " " __TIME__;
+
+#include "config.h"
+
+#if HAVE_INET_SOCKETS
+# include <sys/types.h>
+# include <sys/socket.h>
+# include <sys/select.h>
+# include <netinet/in.h>
+# include <netinet/tcp.h>
+# include <fcntl.h>
+# include <errno.h>
+#endif
+#include <unistd.h>
+#include <ctype.h>
+
+#include "main.h"
+#include "breakcond.h"
+#include "debugcpu.h"
+#include "debugui.h"
+#include "debug_priv.h"
+#include "gdbstub.h"
+#include "m68000.h"
+#include "stMemory.h"
+
+#define GDB_PACKET_MAX	0x4000	/* advertised packet size */
+#define GDB_REGS	18	/* D0-D7, A0-A7, SR, PC */
+
+#define GDB_SIGINT	2
+#define GDB_SIGTRAP	5
+#define GDB_SIGSEGV	11
+
+bool GdbStubActive;
+
+#if HAVE_INET_SOCKETS
+
+# ifndef MSG_NOSIGNAL
+#  define MSG_NOSIGNAL 0
+# endif
+
+static struct {
+	int listen;		/* server socket, -1 when not listening */
+	int sock;		/* connected client, -1 when none */
+	bool noack;		/* QStartNoAckMode negotiated */
+	bool stopped;		/* serving client from debugger entry */
+	bool reply;		/* client waits for a stop reply */
+	bool interrupt;		/* stop requested with ^C */
+	int resume;		/* packet resuming emulation, 0 for none */
+	int rxlen;
+	char rx[2*GDB_PACKET_MAX];
+	char tx[GDB_PACKET_MAX+4];
+} Gdb = { -1, -1 };
+
+static const char hexchars[] = "0123456789abcdef";
+
+
+/**
+ * Close client connection (if any)
+ */
+static void GdbStub_Disconnect(void)
+{
+	if (Gdb.sock >= 0) {
+		close(Gdb.sock);
+		Gdb.sock = -1;
+		fprintf(stderr, "GDB client disconnected.\n");
+	}
+	Gdb.noack = Gdb.reply = Gdb.interrupt = false;
+	Gdb.rxlen = 0;
+	GdbStubActive = (Gdb.listen >= 0);
+}
+
+/**
+ * Close client connection and server socket
+ */
+void GdbStub_Close(void)
+{
+	GdbStub_Disconnect();
+	if (Gdb.listen >= 0) {
+		close(Gdb.listen);
+		Gdb.listen = -1;
+	}
+	GdbStubActive = false;
+}
+
+/**
+ * Start listening for GDB connections on given TCP port (localhost only)
+ * Return true for success
+ */
+static bool GdbStub_Listen(int port)
+{
+	struct sockaddr_in addr;
+	int sock, on = 1;
+
+	GdbStub_Close();
+
+	sock = socket(AF_INET, SOCK_STREAM, 0);
+	if (sock < 0) {
+		perror("ERROR: GDB server socket");
+		return false;
+	}
+	setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	addr.sin_port = htons(port);
+	if (bind(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0 ||
+	    listen(sock, 1) < 0) {
+		perror("ERROR: GDB server bind/listen");
+		close(sock);
+		return false;
+	}
+	fcntl(sock, F_SETFL, fcntl(sock, F_GETFL) | O_NONBLOCK);
+
+	Gdb.listen = sock;
+	GdbStubActive = true;
+	fprintf(stderr, "GDB server listening on localhost:%d.\n", port);
+	return true;
+}
+
+/**
+ * Accept pending client connection, if there's no client yet
+ */
+static void GdbStub_Accept(void)
+{
+	int sock, on = 1;
+
+	if (Gdb.sock >= 0 || Gdb.listen < 0) {
+		return;
+	}
+	sock = accept(Gdb.listen, NULL, NULL);
+	if (sock < 0) {
+		return;
+	}
+	fcntl(sock, F_SETFL, fcntl(sock, F_GETFL) | O_NONBLOCK);
+	setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+	Gdb.sock = sock;
+	Gdb.rxlen = 0;
+	fprintf(stderr, "GDB client connected.\n");
+}
+
+/**
+ * Read what's available from the client, and wait for data if 'block'.
+ * Return false if connection was closed.
+ */
+static bool GdbStub_Receive(bool block)
+{
+	fd_set readfds;
+	ssize_t bytes;
+	int space;
+
+	space = sizeof(Gdb.rx) - Gdb.rxlen;
+	if (!space) {
+		/* garbage instead of packets */
+		Gdb.rxlen = 0;
+		space = sizeof(Gdb.rx);
+	}
+	if (block) {
+		FD_ZERO(&readfds);
+		FD_SET(Gdb.sock, &readfds);
+		if (select(Gdb.sock+1, &readfds, NULL, NULL, NULL) < 0 && errno != EINTR) {
+			return false;
+		}
+	}
+	bytes = recv(Gdb.sock, Gdb.rx + Gdb.rxlen, space, 0);
+	if (bytes == 0) {
+		return false;
+	}
+	if (bytes < 0) {
+		return (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR);
+	}
+	Gdb.rxlen += bytes;
+	return true;
+}
+
+/**
+ * Write all given data to the client
+ */
+static void GdbStub_Write(const char *data, int len)
+{
+	fd_set writefds;
+	ssize_t bytes;
+
+	while (len > 0 && Gdb.sock >= 0) {
+		bytes = send(Gdb.sock, data, len, MSG_NOSIGNAL);
+		if (bytes > 0) {
+			data += bytes;
+			len -= bytes;
+			continue;
+		}
+		if (bytes < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
+			FD_ZERO(&writefds);
+			FD_SET(Gdb.sock, &writefds);
+			select(Gdb.sock+1, NULL, &writefds, NULL, NULL);
+			continue;
+		}
+		GdbStub_Disconnect();
+	}
+}
+
+/**
+ * Send given reply payload as a packet
+ */
+static void GdbStub_Send(const char *payload)
+{
+	Uint8 sum = 0;
+	int len;
+
+	Gdb.tx[0] = '$';
+	for (len = 1; *payload && len < GDB_PACKET_MAX; len++) {
+		sum += *payload;
+		Gdb.tx[len] = *payload++;
+	}
+	Gdb.tx[len++] = '#';
+	Gdb.tx[len++] = hexchars[sum >> 4];
+	Gdb.tx[len++] = hexchars[sum & 0xf];
+	GdbStub_Write(Gdb.tx, len);
+}
+
+/**
+ * Send stop reply with given signal
+ */
+static void GdbStub_SendStop(int signal)
+{
+	char reply[4];
+
+	reply[0] = 'S';
+	reply[1] = hexchars[signal >> 4];
+	reply[2] = hexchars[signal & 0xf];
+	reply[3] = '\0';
+	GdbStub_Send(reply);
+}
+
+
+/* ------------------ packet contents helpers ------------------ */
+
+static int GdbStub_HexDigit(char c)
+{
+	if (c >= '0' && c <= '9')
+		return c - '0';
+	c = tolower((unsigned char)c);
+	if (c >= 'a' && c <= 'f')
+		return c - 'a' + 10;
+	return -1;
+}
+
+/**
+ * Parse hex number from given string, advance it past the number.
+ * Return number of digits parsed.
+ */
+static int GdbStub_ParseHex(const char **str, Uint32 *value)
+{
+	int digit, count = 0;
+
+	*value = 0;
+	while ((digit = GdbStub_HexDigit(**str)) >= 0) {
+		*value = (*value << 4) | digit;
+		(*str)++;
+		count++;
+	}
+	return count;
+}
+
+/**
+ * Parse "<addr>,<len>" from given string, advance past it
+ */
+static bool GdbStub_ParseAddrLen(const char **str, Uint32 *addr, Uint32 *len)
+{
+	if (!GdbStub_ParseHex(str, addr) || **str != ',') {
+		return false;
+	}
+	(*str)++;
+	return GdbStub_ParseHex(str, len) > 0;
+}
+
+static char *GdbStub_PutLong(char *out, Uint32 value)
+{
+	int shift;
+
+	for (shift = 28; shift >= 0; shift -= 4) {
+		*out++ = hexchars[(value >> shift) & 0xf];
+	}
+	return out;
+}
+
+/**
+ * Get/set register in GDB m68k register numbering
+ */
+static Uint32 GdbStub_GetRegister(int reg)
+{
+	if (reg < 16)
+		return Regs[REG_D0 + reg];
+	if (reg == 16)
+		return M68000_GetSR();
+	return M68000_GetPC();
+}
+
+static void GdbStub_SetRegister(int reg, Uint32 value)
+{
+	if (reg < 16)
+		Regs[REG_D0 + reg] = value;
+	else if (reg == 16)
+		M68000_SetSR(value);
+	else
+		M68000_SetPC(value);
+}
+
+
+/* ------------------ packet handlers ------------------ */
+
+/**
+ * 'g': read all registers
+ */
+static void GdbStub_ReadRegisters(char *reply)
+{
+	int reg;
+
+	for (reg = 0; reg < GDB_REGS; reg++) {
+		reply = GdbStub_PutLong(reply, GdbStub_GetRegister(reg));
+	}
+	*reply = '\0';
+}
+
+/**
+ * 'G': write all registers
+ */
+static const char *GdbStub_WriteRegisters(const char *args)
+{
+	Uint32 value;
+	int reg, i, digit;
+
+	for (reg = 0; reg < GDB_REGS && *args; reg++) {
+		value = 0;
+		for (i = 0; i < 8; i++) {
+			if ((digit = GdbStub_HexDigit(*args++)) < 0) {
+				return "E01";
+			}
+			value = (value << 4) | digit;
+		}
+		GdbStub_SetRegister(reg, value);
+	}
+	return "OK";
+}
+
+/**
+ * 'm': read memory.  Reads go directly to emulated RAM/ROM, so
+ * they're side-effect free also while emulation is running.
+ */
+static const char *GdbStub_ReadMemory(const char *args, char *reply)
+{
+	Uint32 addr, len;
+	Uint8 value;
+
+	if (!GdbStub_ParseAddrLen(&args, &addr, &len)) {
+		return "E01";
+	}
+	if (len > (GDB_PACKET_MAX-4)/2) {
+		len = (GDB_PACKET_MAX-4)/2;
+	}
+	while (len--) {
+		value = STMemory_ReadByte(addr++);
+		*reply++ = hexchars[value >> 4];
+		*reply++ = hexchars[value & 0xf];
+	}
+	*reply = '\0';
+	return NULL;
+}
+
+/**
+ * 'M' (hex) & 'X' (binary): write memory
+ */
+static const char *GdbStub_WriteMemory(const char *args, const char *end, bool binary)
+{
+	Uint32 addr, len;
+	int hi, lo;
+
+	if (!GdbStub_ParseAddrLen(&args, &addr, &len) || *args++ != ':') {
+		return "E01";
+	}
+	for (; len; len--) {
+		if (binary) {
+			if (args >= end) {
+				return "E01";
+			}
+			if (*args == '}') {
+				args++;
+				STMemory_WriteByte(addr++, *args++ ^ 0x20);
+			} else {
+				STMemory_WriteByte(addr++, *args++);
+			}
+			continue;
+		}
+		hi = GdbStub_HexDigit(*args++);
+		lo = (hi < 0 ? -1 : GdbStub_HexDigit(*args++));
+		if (lo < 0) {
+			return "E01";
+		}
+		STMemory_WriteByte(addr++, (hi << 4) | lo);
+	}
+	return "OK";
+}
+
+/**
+ * 'Z'/'z': insert/remove breakpoint or write watchpoint as
+ * a quiet conditional breakpoint
+ */
+static const char *GdbStub_Breakpoint(const char *args, bool insert)
+{
+	static const char sizes[] = { 0, 'b', 'w', 0, 'l' };
+	char expression[64];
+	Uint32 type, addr, kind;
+	bool ok;
+
+	if (!GdbStub_ParseHex(&args, &type) || *args++ != ',' ||
+	    !GdbStub_ParseAddrLen(&args, &addr, &kind)) {
+		return "E01";
+	}
+	addr &= 0x00ffffff;
+	switch (type) {
+	case 0:	/* software breakpoint */
+	case 1:	/* hardware breakpoint */
+		sprintf(expression, "pc=$%x", addr);
+		break;
+	case 2:	/* write watchpoint, tracks value changes */
+		if (kind > 4 || !sizes[kind]) {
+			return "E01";
+		}
+		sprintf(expression, "($%x).%c ! ($%x).%c",
+			addr, sizes[kind], addr, sizes[kind]);
+		break;
+	default:
+		/* read/access watchpoints aren't supported */
+		return "";
+	}
+	if (insert) {
+		strcat(expression, " :quiet");
+		ok = BreakCond_Command(expression, false);
+	} else {
+		ok = BreakCond_RemoveExpression(expression, false);
+	}
+	DebugCpu_SetDebugging();
+	return ok ? "OK" : "E01";
+}
+
+/**
+ * 'q'/'Q': general queries & settings
+ */
+static const char *GdbStub_Query(const char *packet)
+{
+	if (strncmp(packet, "qSupported", 10) == 0) {
+		static char features[48];
+		sprintf(features, "PacketSize=%x;QStartNoAckMode+", GDB_PACKET_MAX);
+		return features;
+	}
+	if (strcmp(packet, "QStartNoAckMode") == 0) {
+		Gdb.noack = true;
+		return "OK";
+	}
+	if (strcmp(packet, "qAttached") == 0) {
+		return "1";
+	}
+	if (strcmp(packet, "qC") == 0) {
+		return "QC1";
+	}
+	if (strcmp(packet, "qfThreadInfo") == 0) {
+		return "m1";
+	}
+	if (strcmp(packet, "qsThreadInfo") == 0) {
+		return "l";
+	}
+	if (strncmp(packet, "qOffsets", 8) == 0) {
+		return "Text=0;Data=0;Bss=0";
+	}
+	return "";
+}
+
+/**
+ * Whether given packet needs emulation to be stopped
+ */
+static bool GdbStub_NeedsStop(char cmd)
+{
+	switch (cmd) {
+	case '?':
+	case 'c':
+	case 's':
+	case 'C':
+	case 'S':
+	case 'D':
+	case 'k':
+		return true;
+	}
+	return false;
+}
+
+/**
+ * Handle single packet payload (terminated at 'end')
+ */
+static void GdbStub_HandlePacket(char *packet, char *end)
+{
+	static char reply[GDB_PACKET_MAX];
+	const char *result = "";
+	Uint32 reg, value;
+	const char *args = packet + 1;
+
+	*end = '\0';
+	switch (packet[0]) {
+	case '?':
+		result = NULL;
+		GdbStub_SendStop(GDB_SIGTRAP);
+		break;
+	case 'g':
+		GdbStub_ReadRegisters(reply);
+		result = reply;
+		break;
+	case 'G':
+		result = GdbStub_WriteRegisters(args);
+		break;
+	case 'p':
+		if (GdbStub_ParseHex(&args, &reg) && reg < GDB_REGS) {
+			*GdbStub_PutLong(reply, GdbStub_GetRegister(reg)) = '\0';
+			result = reply;
+		} else {
+			result = "E01";
+		}
+		break;
+	case 'P':
+		if (GdbStub_ParseHex(&args, &reg) && *args++ == '=' &&
+		    GdbStub_ParseHex(&args, &value) && reg < GDB_REGS) {
+			GdbStub_SetRegister(reg, value);
+			result = "OK";
+		} else {
+			result = "E01";
+		}
+		break;
+	case 'm':
+		if (!(result = GdbStub_ReadMemory(args, reply))) {
+			result = reply;
+		}
+		break;
+	case 'M':
+		result = GdbStub_WriteMemory(args, end, false);
+		break;
+	case 'X':
+		result = GdbStub_WriteMemory(args, end, true);
+		break;
+	case 'Z':
+	case 'z':
+		result = GdbStub_Breakpoint(args, packet[0] == 'Z');
+		break;
+	case 'q':
+	case 'Q':
+		result = GdbStub_Query(packet);
+		break;
+	case 'H':
+	case 'T':
+		result = "OK";
+		break;
+	case 'c':
+	case 'C':
+	case 's':
+	case 'S':
+		/* resume, reply comes when emulation stops again */
+		Gdb.resume = tolower((unsigned char)packet[0]);
+		Gdb.reply = true;
+		result = NULL;
+		break;
+	case 'D':
+		GdbStub_Send("OK");
+		/* fall through */
+	case 'k':
+		GdbStub_Disconnect();
+		Gdb.resume = 'c';
+		result = NULL;
+		break;
+	}
+	if (result) {
+		GdbStub_Send(result);
+	}
+}
+
+/**
+ * Process complete packets from receive buffer.  When emulation
+ * is running, stop at first packet needing stopped emulation and
+ * return true.  When stopped, stop after packet resuming emulation.
+ */
+static bool GdbStub_ProcessPackets(void)
+{
+	char *start, *end, *buf = Gdb.rx;
+	int sum, i, len, used = 0;
+	bool stop = false;
+
+	while (used < Gdb.rxlen && Gdb.sock >= 0 && !Gdb.resume) {
+		start = buf + used;
+		len = Gdb.rxlen - used;
+		if (*start == '\x03') {
+			/* interrupt */
+			used++;
+			if (!Gdb.stopped) {
+				Gdb.interrupt = Gdb.reply = true;
+				stop = true;
+			}
+			continue;
+		}
+		if (*start != '$') {
+			/* acks & garbage */
+			used++;
+			continue;
+		}
+		end = memchr(start, '#', len);
+		if (!end || end + 3 > start + len) {
+			break;	/* incomplete */
+		}
+		if (!Gdb.stopped && GdbStub_NeedsStop(start[1])) {
+			stop = true;
+			break;
+		}
+		used = end + 3 - buf;
+		if (!Gdb.noack) {
+			for (sum = 0, i = 1; start + i < end; i++) {
+				sum += (Uint8)start[i];
+			}
+			if ((sum & 0xff) != (GdbStub_HexDigit(end[1]) << 4 | GdbStub_HexDigit(end[2]))) {
+				GdbStub_Write("-", 1);
+				continue;
+			}
+			GdbStub_Write("+", 1);
+		}
+		GdbStub_HandlePacket(start + 1, end);
+	}
+	if (Gdb.sock < 0) {
+		return false;
+	}
+	Gdb.rxlen -= used;
+	memmove(Gdb.rx, Gdb.rx + used, Gdb.rxlen);
+	return stop;
+}
+
+/**
+ * Called once per VBL: accept connections and serve queries
+ * from the client without stopping emulation.
+ */
+void GdbStub_Update(void)
+{
+	GdbStub_Accept();
+	if (Gdb.sock < 0) {
+		return;
+	}
+	if (!GdbStub_Receive(false)) {
+		GdbStub_Disconnect();
+		return;
+	}
+	if (GdbStub_ProcessPackets()) {
+		/* enter debugger (and serve client) after next instruction */
+		DebugCpu_SetSteps(1);
+		DebugCpu_SetDebugging();
+	}
+}
+
+/**
+ * Return true if remote debugger is connected
+ */
+bool GdbStub_IsConnected(void)
+{
+	return Gdb.sock >= 0;
+}
+
+/**
+ * Called on debugger entry when client is connected.  Serve it
+ * until it resumes emulation or disconnects.
+ */
+void GdbStub_Stopped(debug_reason_t reason)
+{
+	int signal;
+
+	if (Gdb.reply) {
+		if (Gdb.interrupt) {
+			signal = GDB_SIGINT;
+		} else if (reason == REASON_CPU_EXCEPTION) {
+			signal = GDB_SIGSEGV;
+		} else {
+			signal = GDB_SIGTRAP;
+		}
+		GdbStub_SendStop(signal);
+	}
+	Gdb.reply = Gdb.interrupt = false;
+	Gdb.stopped = true;
+	Gdb.resume = 0;
+	DebugCpu_SetSteps(0);
+
+	while (Gdb.sock >= 0) {
+		GdbStub_ProcessPackets();
+		if (Gdb.resume) {
+			break;
+		}
+		if (!GdbStub_Receive(true)) {
+			GdbStub_Disconnect();
+		}
+	}
+	if (Gdb.resume == 's') {
+		DebugCpu_SetSteps(1);
+	}
+	Gdb.resume = 0;
+	Gdb.stopped = false;
+}
+
+#else /* !HAVE_INET_SOCKETS */
+
+void GdbStub_Close(void) { }
+void GdbStub_Update(void) { }
+bool GdbStub_IsConnected(void) { return false; }
+void GdbStub_Stopped(debug_reason_t reason) { }
+
+#endif /* HAVE_INET_SOCKETS */
+
+
+const char GdbStub_Description[] =
+	"[<port>|off]\n"
+	"\tStart GDB remote protocol server on given localhost TCP <port>\n"
+	"\t(default 1234), or stop it with 'off'.  Connect to it from\n"
+	"\tm68k GDB with 'target remote localhost:<port>'.\n"
+	"\n"
+	"\tMemory and register queries and breakpoint changes are served\n"
+	"\tonce per VBL without stopping emulation.  GDB breakpoints and\n"
+	"\twrite watchpoints show up as quiet conditional breakpoints.\n"
+	"\tWhile a client is connected, breakpoint hits stop to it\n"
+	"\tinstead of the console debugger.";
+
+/**
+ * Readline match callback for gdbserver command.
+ * STATE = 0 -> different text from previous one.
+ * Return next match or NULL if no matches.
+ */
+char *GdbStub_Match(const char *text, int state)
+{
+	static const char *cmds[] = { "off" };
+	return DebugUI_MatchHelper(cmds, ARRAYSIZE(cmds), text, state);
+}
+
+/**
+ * Command: start/stop GDB server
+ */
+int GdbStub_Parse(int nArgc, char *psArgs[])
+{
+	int port = GDBSTUB_PORT_DEF;
+
+	if (nArgc > 1 && strcmp(psArgs[1], "off") == 0) {
+		GdbStub_Close();
+		fprintf(stderr, "GDB server stopped.\n");
+		return DEBUGGER_CMDDONE;
+	}
+#if HAVE_INET_SOCKETS
+	if (nArgc > 1) {
+		port = atoi(psArgs[1]);
+		if (port <= 0 || port > 0xffff) {
+			return DebugUI_PrintCmdHelp(psArgs[0]);
+		}
+	}
+	GdbStub_Listen(port);
+#else
+	fprintf(stderr, "ERROR: no socket support, can't listen port %d!\n", port);
+#endif
+	return DEBUGGER_CMDDONE;
+}
@@ -0,0 +1,31 @@
+/*
+  Hatari - gdbstub.h
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+*/
+
+#ifndef HATARI_GDBSTUB_H
+#define HATARI_GDBSTUB_H
+
+#define GDBSTUB_PORT_DEF	1234
+
+extern bool GdbStubActive;
+
+static inline bool GdbStub_IsActive(void)
+{
+	return GdbStubActive;
+}
+
+/* for main.c */
+extern void GdbStub_Update(void);
+extern void GdbStub_Close(void);
+
+/* for debugui.c */
+extern bool GdbStub_IsConnected(void);
+extern void GdbStub_Stopped(debug_reason_t reason);
+extern const char GdbStub_Description[];
+extern char *GdbStub_Match(const char *text, int state);
+extern int GdbStub_Parse(int nArgc, char *psArgs[]);
+
+#endif
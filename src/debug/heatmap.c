@@ -0,0 +1,349 @@
+/*
+ * Hatari - heatmap.c
+ *
+ * This file is distributed under the GNU General Public License, version 2
+ * or at your option any later version. Read the file gpl.txt for details.
+ *
+ * heatmap.c - CPU ST RAM and IO memory access heat map
+ *
+ * When enabled from the debugger, the memory banks report every CPU read
+ * and write of ST RAM and IO memory (see memory_set_access_handler()),
+ * and every Nth of them is counted, per 256 byte block of ST RAM and per
+ * IO register address. The counts can be saved over the whole session,
+ * or written per frame, as CSV. They tell how large the dirty tracking
+ * pages and the direct ST RAM access ranges should be, and which IO
+ * registers are accessed often enough to need faster handling.
+ */
+const char HeatMap_fileid[] = "Hatari heatmap.c : " __DATE__ " " __TIME__;
+
+#include <errno.h>
+#include <inttypes.h>
+#include "main.h"
+#include "debugui.h"
+#include "debug_priv.h"
+#include "file.h"
+#include "heatmap.h"
+#include "m68000.h"
+#include "screen.h"
+#include "video.h"
+
+#define HEATMAP_BLOCK_SHIFT	8	/* ST RAM counted per 256 bytes */
+#define HEATMAP_RAM_BLOCKS	(0x1000000 >> HEATMAP_BLOCK_SHIFT)
+#define HEATMAP_IO_START	0xff0000	/* IO counted per address */
+#define HEATMAP_IO_SIZE		0x10000
+#define HEATMAP_ENTRIES		(HEATMAP_RAM_BLOCKS + HEATMAP_IO_SIZE)
+
+typedef struct {
+	Uint64 nReads;
+	Uint64 nWrites;
+} heat_t;
+
+static heat_t *pHeat;		/* ST RAM blocks, followed by IO addresses */
+static heat_t *pHeatFrame;	/* counts at previous VBL, for the frame file */
+static FILE *HeatFrameFile;
+static Uint32 nHeatInterval, nHeatCountdown;
+static bool bHeatRecording;
+
+
+/**
+ * Return heat map index of given address
+ */
+static inline Uint32 HeatMap_Index(uaecptr addr)
+{
+	addr &= 0xffffff;
+	if (addr >= HEATMAP_IO_START)
+		return HEATMAP_RAM_BLOCKS + addr - HEATMAP_IO_START;
+	return addr >> HEATMAP_BLOCK_SHIFT;
+}
+
+/**
+ * Return start address of given heat map index
+ */
+static Uint32 HeatMap_Address(Uint32 idx)
+{
+	if (idx >= HEATMAP_RAM_BLOCKS)
+		return HEATMAP_IO_START + idx - HEATMAP_RAM_BLOCKS;
+	return idx << HEATMAP_BLOCK_SHIFT;
+}
+
+
+/**
+ * Memory access handler: count every Nth access
+ */
+static void HeatMap_Access(uaecptr addr, int size, bool bWrite)
+{
+	heat_t *heat;
+
+	if (--nHeatCountdown)
+		return;
+	nHeatCountdown = nHeatInterval;
+
+	heat = &pHeat[HeatMap_Index(addr)];
+	if (bWrite)
+		heat->nWrites++;
+	else
+		heat->nReads++;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Start counting from zero, every given number of accesses.
+ * Return false if allocation failed.
+ */
+static bool HeatMap_Start(Uint32 interval)
+{
+	if (!pHeat)
+	{
+		pHeat = malloc(HEATMAP_ENTRIES * sizeof(heat_t));
+		if (!pHeat)
+		{
+			fprintf(stderr, "ERROR: heat map allocation failed!\n");
+			return false;
+		}
+	}
+	memset(pHeat, 0, HEATMAP_ENTRIES * sizeof(heat_t));
+	if (pHeatFrame)
+		memset(pHeatFrame, 0, HEATMAP_ENTRIES * sizeof(heat_t));
+
+	nHeatInterval = nHeatCountdown = interval;
+	if (!bHeatRecording)
+		memory_set_access_handler(HeatMap_Access);
+	bHeatRecording = true;
+	fprintf(stderr, "Counting every %u. ST RAM & IO access.\n", interval);
+	return true;
+}
+
+/**
+ * Stop counting and writing the frame file
+ */
+static void HeatMap_Stop(void)
+{
+	if (bHeatRecording)
+		memory_set_access_handler(NULL);
+	bHeatRecording = false;
+
+	if (HeatFrameFile)
+	{
+		if (fclose(HeatFrameFile) != 0)
+			fprintf(stderr, "ERROR: writing heat map frames failed (%d).\n", errno);
+		HeatFrameFile = NULL;
+	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Write counts which changed during the frame to the frame file.
+ * Called on VBL.
+ */
+void HeatMap_VBL(void)
+{
+	Uint32 i;
+
+	if (!HeatFrameFile)
+		return;
+
+	for (i = 0; i < HEATMAP_ENTRIES; i++)
+	{
+		heat_t *now = &pHeat[i], *prev = &pHeatFrame[i];
+
+		if (now->nReads == prev->nReads && now->nWrites == prev->nWrites)
+			continue;
+		fprintf(HeatFrameFile, "%d,%s,0x%06x,%"PRIu64",%"PRIu64"\n", nVBLs,
+		        i < HEATMAP_RAM_BLOCKS ? "ram" : "io", HeatMap_Address(i),
+		        now->nReads - prev->nReads, now->nWrites - prev->nWrites);
+		*prev = *now;
+	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Start writing per frame counts to given file, and counting every
+ * access if counting isn't already on.
+ */
+static void HeatMap_SetFrameFile(const char *name)
+{
+	if (HeatFrameFile)
+	{
+		fprintf(stderr, "ERROR: heat map frames are already being written.\n");
+		return;
+	}
+	if (File_Exists(name))
+	{
+		fprintf(stderr, "ERROR: file '%s' already exists!\n", name);
+		return;
+	}
+	if (!pHeatFrame)
+	{
+		pHeatFrame = malloc(HEATMAP_ENTRIES * sizeof(heat_t));
+		if (!pHeatFrame)
+		{
+			fprintf(stderr, "ERROR: heat map allocation failed!\n");
+			return;
+		}
+	}
+	if (!bHeatRecording && !HeatMap_Start(1))
+		return;
+
+	HeatFrameFile = fopen(name, "w");
+	if (!HeatFrameFile)
+	{
+		fprintf(stderr, "ERROR: opening '%s' failed (%d).\n", name, errno);
+		return;
+	}
+	memcpy(pHeatFrame, pHeat, HEATMAP_ENTRIES * sizeof(heat_t));
+	fprintf(HeatFrameFile, "vbl,area,address,reads,writes\n");
+	fprintf(stderr, "Writing heat map changes on every VBL to '%s'.\n", name);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Save all non-zero counts to given CSV file
+ */
+static void HeatMap_Save(const char *name)
+{
+	Uint32 i, count = 0;
+	FILE *fp;
+
+	if (File_Exists(name))
+	{
+		fprintf(stderr, "ERROR: file '%s' already exists!\n", name);
+		return;
+	}
+	fp = fopen(name, "w");
+	if (!fp)
+	{
+		fprintf(stderr, "ERROR: opening '%s' failed (%d).\n", name, errno);
+		return;
+	}
+
+	fprintf(fp, "area,address,reads,writes\n");
+	for (i = 0; i < HEATMAP_ENTRIES; i++)
+	{
+		if (!pHeat[i].nReads && !pHeat[i].nWrites)
+			continue;
+		fprintf(fp, "%s,0x%06x,%"PRIu64",%"PRIu64"\n",
+		        i < HEATMAP_RAM_BLOCKS ? "ram" : "io", HeatMap_Address(i),
+		        pHeat[i].nReads, pHeat[i].nWrites);
+		count++;
+	}
+
+	if (fclose(fp) == 0)
+		fprintf(stderr, "%u heat map entries saved to '%s'.\n", count, name);
+	else
+		fprintf(stderr, "ERROR: writing '%s' failed (%d).\n", name, errno);
+}
+
+
+/*-----------------------------------------------------------------------*/
+
+static int HeatMap_Compare(const void *a, const void *b)
+{
+	const heat_t *x = &pHeat[*(const Uint32 *)a], *y = &pHeat[*(const Uint32 *)b];
+	Uint64 nx = x->nReads + x->nWrites, ny = y->nReads + y->nWrites;
+	return nx < ny ? 1 : nx > ny ? -1 : 0;
+}
+
+/**
+ * Show given number of most accessed entries between given indexes
+ */
+static void HeatMap_ShowArea(const char *title, Uint32 first, Uint32 last, int count)
+{
+	Uint32 *sorted, i, n = 0;
+	Uint64 nReads = 0, nWrites = 0;
+
+	sorted = malloc((last - first) * sizeof(*sorted));
+	if (!sorted)
+	{
+		fprintf(stderr, "ERROR: allocation failed!\n");
+		return;
+	}
+	for (i = first; i < last; i++)
+	{
+		if (!pHeat[i].nReads && !pHeat[i].nWrites)
+			continue;
+		nReads += pHeat[i].nReads;
+		nWrites += pHeat[i].nWrites;
+		sorted[n++] = i;
+	}
+	qsort(sorted, n, sizeof(*sorted), HeatMap_Compare);
+
+	fprintf(stderr, "%s: %"PRIu64" reads, %"PRIu64" writes in %u %s:\n",
+	        title, nReads, nWrites, n,
+	        first < HEATMAP_RAM_BLOCKS ? "256 byte blocks" : "addresses");
+	for (i = 0; i < n && i < (Uint32)count; i++)
+	{
+		fprintf(stderr, "- $%06x %12"PRIu64" reads %12"PRIu64" writes\n",
+		        HeatMap_Address(sorted[i]), pHeat[sorted[i]].nReads,
+		        pHeat[sorted[i]].nWrites);
+	}
+	free(sorted);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Stop counting and free the heat map
+ */
+void HeatMap_UnInit(void)
+{
+	HeatMap_Stop();
+	free(pHeatFrame);
+	pHeatFrame = NULL;
+	free(pHeat);
+	pHeat = NULL;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Readline match callback for heatmap command
+ */
+char *HeatMap_Match(const char *text, int state)
+{
+	static const char* cmds[] = { "frames", "off", "on", "save" };
+	return DebugUI_MatchHelper(cmds, ARRAYSIZE(cmds), text, state);
+}
+
+/**
+ * Command: Count ST RAM and IO memory accesses
+ */
+int HeatMap_Parse(int nArgc, char *psArgs[])
+{
+	int count;
+
+	if (nArgc < 2) {
+		return DebugUI_PrintCmdHelp(psArgs[0]);
+	}
+	if (strcmp(psArgs[1], "on") == 0) {
+		count = nArgc > 2 ? atoi(psArgs[2]) : 0;
+		HeatMap_Start(count > 0 ? count : 1);
+		return DEBUGGER_CMDDONE;
+	}
+	if (strcmp(psArgs[1], "off") == 0) {
+		HeatMap_Stop();
+		return DEBUGGER_CMDDONE;
+	}
+	if (nArgc == 3 && strcmp(psArgs[1], "frames") == 0) {
+		HeatMap_SetFrameFile(psArgs[2]);
+		return DEBUGGER_CMDDONE;
+	}
+	if (!pHeat) {
+		fprintf(stderr, "ERROR: no memory accesses counted.\n");
+		return DEBUGGER_CMDDONE;
+	}
+	if (nArgc == 3 && strcmp(psArgs[1], "save") == 0) {
+		HeatMap_Save(psArgs[2]);
+		return DEBUGGER_CMDDONE;
+	}
+	count = atoi(psArgs[1]);
+	if (count > 0) {
+		HeatMap_ShowArea("ST RAM", 0, HEATMAP_RAM_BLOCKS, count);
+		HeatMap_ShowArea("IO", HEATMAP_RAM_BLOCKS, HEATMAP_ENTRIES, count);
+		return DEBUGGER_CMDDONE;
+	}
+	return DebugUI_PrintCmdHelp(psArgs[0]);
+}
@@ -0,0 +1,19 @@
+/*
+  Hatari - heatmap.h
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+*/
+
+#ifndef HATARI_HEATMAP_H
+#define HATARI_HEATMAP_H
+
+/* for video.c & main.c */
+extern void HeatMap_VBL(void);
+extern void HeatMap_UnInit(void);
+
+/* for debugui */
+extern char *HeatMap_Match(const char *text, int state);
+extern int HeatMap_Parse(int nArgc, char *psArgs[]);
+
+#endif
@@ -7,18 +7,33 @@
  * or at your option any later version. Read the file gpl.txt for details.
  *
  * history.c - functions for debugger entry & breakpoint history
+ *
+ * CPU instruction history can also be recorded to a binary file.
+ * Each instruction is stored as a fixed size record (cycle counter, PC,
+ * SR, instruction words and optionally the registers) in a memory buffer
+ * without any locking, and when it's full, the buffer is handed to the
+ * file writer, whose threads compress it and append it to the file.
+ * Recorded files are decoded back to text with the debugger.
  */
 const char History_fileid[] = "Hatari history.c : " __DATE__ " " __TIME__;
 
 #include <assert.h>
 #include <errno.h>
+#include <inttypes.h>
+#include <stddef.h>
+#include <SDL_endian.h>
 #include "main.h"
+#if HAVE_LIBZ
+#include <zlib.h>
+#endif
+#include "cycles.h"
 #include "debugui.h"
 #include "debug_priv.h"
 #include "dsp.h"
 #include "dsp_core.h"
 #include "evaluate.h"
 #include "file.h"
+#include "fileWriter.h"
 #include "history.h"
 #include "m68000.h"
 #include "68kDisass.h"
@@ -26,6 +41,7 @@ const char History_fileid[] = "Hatari history.c : " __DATE__ " " __TIME__;
 #define HISTORY_ITEMS_MIN 64
 
 history_type_t HistoryTracking;
+bool HistoryRecording;
 
 typedef struct {
 	bool shown:1;
@@ -240,12 +256,360 @@ static void History_Save(const char *name)
 	}
 }
 
+
+/* binary instruction trace file:
+ * - header: "HTRC" id, version & flags words, record size long
+ * - blocks: raw & stored size longs, followed by the records
+ *   compressed with zlib (or as-is when sizes are equal)
+ * All values are big endian.
+ */
+#define HISTORY_REC_ID       "HTRC"
+#define HISTORY_REC_VERSION  1
+#define HISTORY_REC_REGS     1	/* flag: records include D0-D7/A0-A7 */
+#define HISTORY_REC_WORDS    5	/* enough for any 68000 instruction */
+#define HISTORY_REC_CHUNK    16384	/* records per compressed block */
+
+typedef struct {
+	Uint32 cycles_hi;	/* CPU cycle counter */
+	Uint32 cycles_lo;
+	Uint32 pc;
+	Uint16 sr;
+	Uint16 words[HISTORY_REC_WORDS];
+	Uint32 regs[16];	/* only with HISTORY_REC_REGS */
+} hist_record_t;
+
+#define HISTORY_REC_SIZE(flags) \
+	((flags) & HISTORY_REC_REGS ? sizeof(hist_record_t) : offsetof(hist_record_t, regs))
+
+static struct {
+	FILE *fp;
+	Uint16 flags;
+	int size;          /* record size */
+	int count;         /* records in buffer */
+	Uint8 *buffer;     /* HISTORY_REC_CHUNK records */
+	Uint64 records;    /* records written */
+} Record;
+
+
+/**
+ * Convert records to big endian and compress them into given output
+ * block (called by the file writer threads)
+ */
+static bool History_RecEncode(Uint8 *data, int size, FILEWRITER_BUFFER *out, void *param)
+{
+	hist_record_t *rec;
+	Uint8 *block;
+	Uint32 stored;
+	int i, j;
+
+	for (i = 0; i < size; i += Record.size) {
+		rec = (hist_record_t *)(data + i);
+		rec->cycles_hi = SDL_SwapBE32(rec->cycles_hi);
+		rec->cycles_lo = SDL_SwapBE32(rec->cycles_lo);
+		rec->pc = SDL_SwapBE32(rec->pc);
+		rec->sr = SDL_SwapBE16(rec->sr);
+		for (j = 0; j < HISTORY_REC_WORDS; j++) {
+			rec->words[j] = SDL_SwapBE16(rec->words[j]);
+		}
+		if (Record.flags & HISTORY_REC_REGS) {
+			for (j = 0; j < 16; j++) {
+				rec->regs[j] = SDL_SwapBE32(rec->regs[j]);
+			}
+		}
+	}
+#if HAVE_LIBZ
+	{
+		uLongf len = compressBound(size);
+		block = FileWriter_Reserve(out, 8 + len);
+		if (!block || compress2(block + 8, &len, data, size, 1) != Z_OK) {
+			return false;
+		}
+		/* equal sizes mean stored as-is */
+		if (len >= (uLongf)size) {
+			memcpy(block + 8, data, size);
+			len = size;
+		}
+		stored = len;
+	}
+#else
+	block = FileWriter_Reserve(out, 8 + size);
+	if (!block) {
+		return false;
+	}
+	memcpy(block + 8, data, size);
+	stored = size;
+#endif
+	((Uint32 *)block)[0] = SDL_SwapBE32(size);
+	((Uint32 *)block)[1] = SDL_SwapBE32(stored);
+	out->nSize += 8 + stored;
+	return true;
+}
+
+/**
+ * Append compressed block to the trace file (called by the file writer)
+ */
+static bool History_RecWrite(Uint8 *data, int size, void *param)
+{
+	return fwrite(data, 1, size, Record.fp) == (size_t)size;
+}
+
+/**
+ * Queue recorded instructions for compression & writing.
+ * Return false on error.
+ */
+static bool History_RecFlush(void)
+{
+	int size = Record.count * Record.size;
+	Uint8 *data;
+
+	if (!Record.count) {
+		return true;
+	}
+	data = FileWriter_Begin(size);
+	if (!data) {
+		return false;
+	}
+	memcpy(data, Record.buffer, size);
+	Record.records += Record.count;
+	Record.count = 0;
+	return FileWriter_CommitEncode(History_RecEncode, History_RecWrite, NULL);
+}
+
+/**
+ * Stop instruction recording, write the remaining records
+ * and close the trace file
+ */
+void History_RecordStop(void)
+{
+	bool ok;
+
+	if (!Record.fp) {
+		return;
+	}
+	HistoryRecording = false;
+	ok = History_RecFlush();
+	ok = FileWriter_Flush() && ok;
+	fclose(Record.fp);
+	free(Record.buffer);
+	if (ok) {
+		fprintf(stderr, "%"PRIu64" instructions recorded.\n", Record.records);
+	} else {
+		fprintf(stderr, "ERROR: writing instruction trace failed!\n");
+	}
+	memset(&Record, 0, sizeof(Record));
+}
+
+/**
+ * Start recording CPU instructions to given file,
+ * optionally with register contents
+ */
+static void History_RecordStart(const char *name, bool regs)
+{
+	Uint8 header[12];
+
+	History_RecordStop();
+	if (File_Exists(name)) {
+		fprintf(stderr, "ERROR: file '%s' already exists!\n", name);
+		return;
+	}
+	Record.flags = regs ? HISTORY_REC_REGS : 0;
+	Record.size = HISTORY_REC_SIZE(Record.flags);
+	Record.buffer = malloc(HISTORY_REC_CHUNK * Record.size);
+	if (!Record.buffer) {
+		fprintf(stderr, "ERROR: instruction trace buffer allocation failed!\n");
+		return;
+	}
+	Record.fp = fopen(name, "wb");
+	if (!Record.fp) {
+		fprintf(stderr, "ERROR: opening '%s' failed (%d).\n", name, errno);
+		free(Record.buffer);
+		Record.buffer = NULL;
+		return;
+	}
+	memcpy(header, HISTORY_REC_ID, 4);
+	header[4] = 0;
+	header[5] = HISTORY_REC_VERSION;
+	header[6] = Record.flags >> 8;
+	header[7] = Record.flags;
+	header[8] = Record.size >> 24;
+	header[9] = Record.size >> 16;
+	header[10] = Record.size >> 8;
+	header[11] = Record.size;
+	if (fwrite(header, sizeof(header), 1, Record.fp) != 1) {
+		fprintf(stderr, "ERROR: writing '%s' failed (%d).\n", name, errno);
+		History_RecordStop();
+		return;
+	}
+	HistoryRecording = true;
+	fprintf(stderr, "Recording CPU instructions%s to '%s'.\n",
+		regs ? " & registers" : "", name);
+}
+
+/**
+ * Record CPU instruction at current PC
+ */
+void History_RecordCpu(void)
+{
+	hist_record_t *rec = (hist_record_t *)(Record.buffer + Record.count * Record.size);
+	Uint32 pc = M68000_GetPC();
+	int i;
+
+	rec->cycles_hi = CyclesGlobalClockCounter >> 32;
+	rec->cycles_lo = CyclesGlobalClockCounter;
+	rec->pc = pc;
+	rec->sr = M68000_GetSR();
+	if (valid_address(pc, 2 * HISTORY_REC_WORDS)) {
+		for (i = 0; i < HISTORY_REC_WORDS; i++) {
+			rec->words[i] = get_word(pc + 2 * i);
+		}
+	} else {
+		memset(rec->words, 0, sizeof(rec->words));
+	}
+	if (Record.flags & HISTORY_REC_REGS) {
+		memcpy(rec->regs, Regs, sizeof(rec->regs));
+	}
+	if (++Record.count == HISTORY_REC_CHUNK && !History_RecFlush()) {
+		fprintf(stderr, "ERROR: writing instruction trace failed, recording stopped!\n");
+		History_RecordStop();
+	}
+}
+
+/**
+ * Read big endian long from given bytes
+ */
+static Uint32 History_GetLong(const Uint8 *p)
+{
+	return (Uint32)p[0] << 24 | p[1] << 16 | p[2] << 8 | p[3];
+}
+
+/**
+ * Decode records in given (uncompressed) block to text
+ */
+static void History_DecodeBlock(const Uint8 *data, Uint32 size, int recsize, Uint16 flags, FILE *fp)
+{
+	Uint16 words[HISTORY_REC_WORDS];
+	const Uint8 *p;
+	Uint64 cycles;
+	Uint32 pc, regs[16];
+	Uint16 sr;
+	int i;
+
+	for (p = data; p + recsize <= data + size; p += recsize) {
+		cycles = (Uint64)History_GetLong(p) << 32 | History_GetLong(p + 4);
+		pc = History_GetLong(p + 8);
+		sr = p[12] << 8 | p[13];
+		for (i = 0; i < HISTORY_REC_WORDS; i++) {
+			words[i] = p[14 + 2*i] << 8 | p[15 + 2*i];
+		}
+		fprintf(fp, "%12"PRIu64" %04x ", cycles, sr);
+		Disasm_Words(fp, pc, words, HISTORY_REC_WORDS);
+		if (!(flags & HISTORY_REC_REGS)) {
+			continue;
+		}
+		for (i = 0; i < 16; i++) {
+			regs[i] = History_GetLong(p + offsetof(hist_record_t, regs) + 4*i);
+		}
+		fprintf(fp, "  D0-D7: %08x %08x %08x %08x %08x %08x %08x %08x\n",
+			regs[0], regs[1], regs[2], regs[3], regs[4], regs[5], regs[6], regs[7]);
+		fprintf(fp, "  A0-A7: %08x %08x %08x %08x %08x %08x %08x %08x\n",
+			regs[8], regs[9], regs[10], regs[11], regs[12], regs[13], regs[14], regs[15]);
+	}
+}
+
+/**
+ * Decode recorded instruction trace file to a disassembly text file
+ */
+static void History_Decode(const char *name, const char *outname)
+{
+	Uint8 header[12], *data = NULL, *stored = NULL;
+	Uint32 size, len, blocks = 0;
+	FILE *fp, *out;
+	Uint16 flags;
+	int recsize;
+	bool ok = false;
+
+	if (File_Exists(outname)) {
+		fprintf(stderr, "ERROR: file '%s' already exists!\n", outname);
+		return;
+	}
+	if (!(fp = fopen(name, "rb"))) {
+		fprintf(stderr, "ERROR: opening '%s' failed (%d).\n", name, errno);
+		return;
+	}
+	if (fread(header, sizeof(header), 1, fp) != 1 ||
+	    memcmp(header, HISTORY_REC_ID, 4) != 0 ||
+	    header[5] != HISTORY_REC_VERSION) {
+		fprintf(stderr, "ERROR: '%s' isn't a Hatari instruction trace file!\n", name);
+		fclose(fp);
+		return;
+	}
+	flags = header[6] << 8 | header[7];
+	recsize = History_GetLong(header + 8);
+	if (recsize != (int)HISTORY_REC_SIZE(flags)) {
+		fprintf(stderr, "ERROR: unsupported record size %d in '%s'!\n", recsize, name);
+		fclose(fp);
+		return;
+	}
+	if (!(out = fopen(outname, "w"))) {
+		fprintf(stderr, "ERROR: opening '%s' failed (%d).\n", outname, errno);
+		fclose(fp);
+		return;
+	}
+	while (fread(header, 8, 1, fp) == 1) {
+		size = History_GetLong(header);
+		len = History_GetLong(header + 4);
+		free(data);
+		free(stored);
+		data = malloc(size);
+		stored = malloc(len);
+		if (!data || !stored || fread(stored, len, 1, fp) != 1) {
+			break;
+		}
+		if (len != size) {
+#if HAVE_LIBZ
+			z_stream zs;
+			int ret;
+
+			memset(&zs, 0, sizeof(zs));
+			if (inflateInit(&zs) != Z_OK) {
+				break;
+			}
+			zs.next_in = stored;
+			zs.avail_in = len;
+			zs.next_out = data;
+			zs.avail_out = size;
+			ret = inflate(&zs, Z_FINISH);
+			inflateEnd(&zs);
+			if (ret != Z_STREAM_END || zs.avail_out) {
+				break;
+			}
+#else
+			fprintf(stderr, "ERROR: Hatari was built without zlib, can't decode compressed trace!\n");
+			break;
+#endif
+		} else {
+			memcpy(data, stored, size);
+		}
+		History_DecodeBlock(data, size, recsize, flags, out);
+		blocks++;
+	}
+	ok = feof(fp);
+	free(data);
+	free(stored);
+	fclose(out);
+	fclose(fp);
+	if (!ok) {
+		fprintf(stderr, "ERROR: reading block %d of '%s' failed!\n", blocks, name);
+	}
+	fprintf(stderr, "%d instruction trace blocks decoded to '%s'.\n", blocks, outname);
+}
+
 /*
  * Readline callback
  */
 char *History_Match(const char *text, int state)
 {
-	static const char* cmds[] = { "cpu", "dsp", "off", "save" };
+	static const char* cmds[] = { "cpu", "decode", "dsp", "off", "record", "save" };
 	return DebugUI_MatchHelper(cmds, ARRAYSIZE(cmds), text, state);
 }
 
@@ -293,6 +657,18 @@ int History_Parse(int nArgc, char *psArgs[])
 			History_Save(psArgs[2]);
 			return DEBUGGER_CMDDONE;
 		}
+		if (nArgc >= 3 && strcmp(psArgs[1], "record") == 0) {
+			if (strcmp(psArgs[2], "off") == 0) {
+				History_RecordStop();
+			} else {
+				History_RecordStart(psArgs[2], nArgc > 3 && strcmp(psArgs[3], "regs") == 0);
+			}
+			return DEBUGGER_CMDDONE;
+		}
+		if (nArgc == 4 && strcmp(psArgs[1], "decode") == 0) {
+			History_Decode(psArgs[2], psArgs[3]);
+			return DEBUGGER_CMDDONE;
+		}
 		fprintf(stderr,  "History range is 1-<limit>\n");
 		return DebugUI_PrintCmdHelp(psArgs[0]);
 	}
@@ -17,6 +17,7 @@ typedef enum {
 } history_type_t;
 
 extern history_type_t HistoryTracking;
+extern bool HistoryRecording;
 
 static inline bool History_TrackCpu(void)
 {
@@ -26,10 +27,18 @@ static inline bool History_TrackDsp(void)
 {
 	return HistoryTracking & HISTORY_TRACK_DSP;
 }
+static inline bool History_RecordingCpu(void)
+{
+	return HistoryRecording;
+}
 
 /* for debugcpu/dsp.c */
 extern void History_AddCpu(void);
 extern void History_AddDsp(void);
+extern void History_RecordCpu(void);
+
+/* for main.c */
+extern void History_RecordStop(void);
 
 /* for debugInfo.c */
 extern void History_Show(Uint32 count);
@@ -149,6 +149,12 @@ Uint64	LogTraceFlags = TRACE_NONE;
 FILE *TraceFile = NULL;
 
 static FILE *hLogFile = NULL;
+
+/* Traces going to a file are written through a large stdio buffer
+ * instead of being flushed line by line, so enabling a busy trace
+ * doesn't turn every traced event into a write() system call.
+ */
+#define TRACE_BUFFER_SIZE	(1024*1024)
 static LOGTYPE TextLogLevel;
 static LOGTYPE AlertDlgLogLevel;
 
@@ -175,6 +181,8 @@ int Log_Init(void)
 
 	hLogFile = File_Open(ConfigureParams.Log.sLogFileName, "w");
 	TraceFile = File_Open(ConfigureParams.Log.sTraceFileName, "w");
+	if (TraceFile && TraceFile != stderr && TraceFile != stdout)
+		setvbuf(TraceFile, NULL, _IOFBF, TRACE_BUFFER_SIZE);
    
 	return (hLogFile && TraceFile);
 }
@@ -203,6 +211,18 @@ void Log_UnInit(void)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Write out buffered trace output, e.g. before the user gets to
+ * look at it in the debugger.
+ */
+void Log_FlushTrace(void)
+{
+	if (TraceFile)
+		fflush(TraceFile);
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Output string to log file
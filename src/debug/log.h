@@ -78,6 +78,7 @@ extern void Log_AlertDlg(LOGTYPE nType, const char *psFormat, ...)
 extern LOGTYPE Log_ParseOptions(const char *OptionStr);
 extern const char* Log_SetTraceOptions(const char *OptionsStr);
 extern char *Log_MatchTrace(const char *text, int state);
+extern void Log_FlushTrace(void);
 
 #ifndef __GNUC__
 #undef __attribute__
@@ -200,7 +201,7 @@ extern Uint64 LogTraceFlags;
 
 #ifndef _VCWIN_
 #define	LOG_TRACE(level, args...) \
-	if (unlikely(LogTraceFlags & level)) { fprintf(TraceFile, args); fflush(TraceFile); }
+	if (unlikely(LogTraceFlags & level)) { fprintf(TraceFile, args); }
 #endif
 #define LOG_TRACE_LEVEL( level )	(unlikely(LogTraceFlags & level))
 
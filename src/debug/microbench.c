@@ -0,0 +1,639 @@
+/*
+ * Hatari - microbench.c
+ *
+ * This file is distributed under the GNU General Public License, version 2
+ * or at your option any later version. Read the file gpl.txt for details.
+ *
+ * microbench.c - micro-benchmarks for the emulation hot kernels
+ *
+ * With the "--microbench" option, Hatari runs the selected kernels
+ * (screen conversion, YM2149 and DMA sound generation, blitter, DSP,
+ * CycInt scheduler, MSA and STX decoding) on synthetic input right
+ * after initialization, without booting TOS, and writes one JSON line
+ * of results per kernel before exiting. This allows measuring changes
+ * to a single kernel in isolation, the end-to-end "--benchmark" runs
+ * show how they add up.
+ *
+ * Each kernel is run in batches for MICROBENCH_USECS of host time,
+ * after one warm-up batch. Kernels needing another machine type are
+ * reported as skipped. The emulated machine state is left undefined.
+ */
+const char MicroBench_fileid[] = "Hatari microbench.c : " __DATE__ " " __TIME__;
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "main.h"
+#include "configuration.h"
+#include "blitter.h"
+#include "cycInt.h"
+#include "dmaSnd.h"
+#include "dsp.h"
+#include "floppy.h"
+#include "floppy_stx.h"
+#include "ioMem.h"
+#include "msa.h"
+#include "screen.h"
+#include "sound.h"
+#include "stMemory.h"
+#include "vdi.h"
+#include "video.h"
+#include "videl.h"
+#include "microbench.h"
+
+#define MICROBENCH_USECS	1000000
+
+typedef struct {
+	const char *name;
+	const char *unit;		/* what the returned work counts are */
+	/* prepare the kernel, return reason when it can't be run, else NULL */
+	const char *(*setup)(void);
+	/* run one batch, return the number of work units done */
+	Uint32 (*run)(void);
+	void (*cleanup)(void);
+} MICROBENCH_KERNEL;
+
+static Uint32 MicroBenchMask;		/* kernels selected, bit per table index */
+
+
+/* Set IO register like the emulated CPU would, through its write handler */
+static void MicroBench_WriteIoByte(Uint32 addr, Uint8 value, void (*handler)(void))
+{
+	IoMem_WriteByte(addr, value);
+	handler();
+}
+
+static void MicroBench_WriteIoWord(Uint32 addr, Uint16 value, void (*handler)(void))
+{
+	IoMem_WriteWord(addr, value);
+	handler();
+}
+
+
+/* ----------------------------------------------------------------------- */
+/* Screen conversion: convert a full frame of the current resolution */
+
+static const char *MicroBench_ConvertSetup(void)
+{
+	Uint32 addr;
+	int i;
+
+	Screen_EnableRenderThread(false);
+	if (bUseVDIRes)
+		return NULL;
+
+	if (ConfigureParams.System.nMachineType == MACHINE_FALCON)
+	{
+		/* TOS hasn't set a video mode, use 640x480 in 8 bitplanes */
+		ConfigureParams.Screen.bAllowOverscan = false;
+		IoMem_WriteByte(0xff8201, 0x01);
+		IoMem_WriteByte(0xff8203, 0x00);
+		IoMem_WriteByte(0xff820d, 0x00);
+		IoMem_WriteWord(0xff820e, 0);
+		IoMem_WriteWord(0xff8210, 640 * 8 / 16);
+		MicroBench_WriteIoWord(0xff8266, 0x0010, VIDEL_Falcon_ShiftMode_WriteWord);
+		IoMem_WriteWord(0xff82a8, 0);
+		IoMem_WriteWord(0xff82aa, 2 * 480);
+		IoMem_WriteWord(0xff82c2, 0);
+		for (addr = 0x10000; addr < 0x10000 + 640 * 480; addr += 2)
+			STMemory_WriteWord(addr, addr * 0x9e37);
+	}
+	else if (ConfigureParams.System.nMachineType != MACHINE_TT)
+	{
+		/* planar pattern for the ST/STE shifter converters */
+		for (i = 0; i < SCREENBYTES_LINE * NUM_VISIBLE_LINES; i++)
+			pFrameBuffer->pSTScreen[i] = i * 0x35 + (i >> 8);
+		if (!VideoBase)
+			VideoBase = 0x78000;
+	}
+	return NULL;
+}
+
+static Uint32 MicroBench_ConvertRun(void)
+{
+	bool bDrawn;
+
+	Screen_SetFullUpdate();
+	if (ConfigureParams.System.nMachineType == MACHINE_FALCON && !bUseVDIRes)
+		bDrawn = VIDEL_renderScreen();
+	else if (ConfigureParams.System.nMachineType == MACHINE_TT && !bUseVDIRes)
+		bDrawn = Video_RenderTTScreen();
+	else
+		bDrawn = Screen_Draw();
+	return bDrawn;
+}
+
+
+/* ----------------------------------------------------------------------- */
+/* YM2149 synthesis: all channels with tone, noise and envelope */
+
+#define MICROBENCH_SAMPLES	4096
+
+static const char *MicroBench_YmSetup(void)
+{
+	static const Uint8 Regs[14] = {
+		0x1c, 0x01, 0xfd, 0x00, 0x77, 0x02,	/* tone periods */
+		0x07,					/* noise period */
+		0x30,					/* mixer: tones, noise on A */
+		0x0f, 0x0c, 0x10,			/* volumes, envelope on C */
+		0x00, 0x08, 0x0e			/* envelope period and shape */
+	};
+	int i;
+
+	Sound_EnableThread(false);
+	for (i = 0; i < 14; i++)
+		Sound_WriteReg(i, Regs[i]);
+	return NULL;
+}
+
+static Uint32 MicroBench_YmRun(void)
+{
+	Sound_GenerateYMSamples(MICROBENCH_SAMPLES);
+	return MICROBENCH_SAMPLES;
+}
+
+
+/* ----------------------------------------------------------------------- */
+/* STE DMA sound: looping 8-bit stereo frame at 25 kHz, mixed with the YM */
+
+static const char *MicroBench_DmaSndSetup(void)
+{
+	const Uint32 start = 0x20000, end = 0x30000;
+	Uint32 addr;
+
+	if (ConfigureParams.System.nMachineType == MACHINE_ST
+	    || ConfigureParams.System.nMachineType == MACHINE_FALCON)
+		return "needs STE, Mega STE or TT";
+
+	Sound_EnableThread(false);
+	for (addr = start; addr < end; addr += 2)
+		STMemory_WriteWord(addr, addr * 0x9e37);
+
+	MicroBench_WriteIoByte(0xff8903, start >> 16, DmaSnd_FrameStartHigh_WriteByte);
+	MicroBench_WriteIoByte(0xff8905, (start >> 8) & 0xff, DmaSnd_FrameStartMed_WriteByte);
+	MicroBench_WriteIoByte(0xff8907, start & 0xff, DmaSnd_FrameStartLow_WriteByte);
+	MicroBench_WriteIoByte(0xff890f, end >> 16, DmaSnd_FrameEndHigh_WriteByte);
+	MicroBench_WriteIoByte(0xff8911, (end >> 8) & 0xff, DmaSnd_FrameEndMed_WriteByte);
+	MicroBench_WriteIoByte(0xff8913, end & 0xff, DmaSnd_FrameEndLow_WriteByte);
+	MicroBench_WriteIoByte(0xff8921, 0x02, DmaSnd_SoundModeCtrl_WriteByte);
+	IoMem_WriteWord(0xff8900, 0x0003);	/* play, loop */
+	DmaSnd_SoundControl_WriteWord();
+	return NULL;
+}
+
+static Uint32 MicroBench_DmaSndRun(void)
+{
+	DmaSnd_GenerateSamples(0, MICROBENCH_SAMPLES);
+	return MICROBENCH_SAMPLES;
+}
+
+
+/* ----------------------------------------------------------------------- */
+/* Blitter: HOG mode blits of 80 words x 200 lines with different setups */
+
+#define MICROBENCH_BLIT_WORDS	80
+#define MICROBENCH_BLIT_LINES	200
+
+static const char *MicroBench_BlitterSetup(void)
+{
+	Uint32 addr;
+
+	if (!ConfigureParams.System.bBlitter
+	    && ConfigureParams.System.nMachineType == MACHINE_ST)
+		return "needs a blitter";
+
+	for (addr = 0x10000; addr < 0x20000; addr += 2)
+		STMemory_WriteWord(addr, addr * 0x9e37);
+	return NULL;
+}
+
+static Uint32 MicroBench_BlitterRun(void)
+{
+	/* plain copy, shifted masked xor, halftone fill */
+	static const struct {
+		Uint8 hop, lop, skew;
+		Uint16 mask1, mask3;
+	} Setups[3] = {
+		{ 2, 3, 0x00, 0xffff, 0xffff },
+		{ 2, 6, 0x85, 0x0fff, 0xfff0 },
+		{ 1, 7, 0x00, 0xffff, 0xffff }
+	};
+	static int n;
+	int i = n++ % 3;
+
+	/* no other events, the blit runs in one go */
+	CycInt_Reset();
+
+	MicroBench_WriteIoWord(0xff8a20, 2, Blitter_SourceXInc_WriteWord);
+	MicroBench_WriteIoWord(0xff8a22, 2, Blitter_SourceYInc_WriteWord);
+	IoMem_WriteLong(0xff8a24, 0x10000);
+	Blitter_SourceAddr_WriteLong();
+	MicroBench_WriteIoWord(0xff8a28, Setups[i].mask1, Blitter_Endmask1_WriteWord);
+	MicroBench_WriteIoWord(0xff8a2a, 0xffff, Blitter_Endmask2_WriteWord);
+	MicroBench_WriteIoWord(0xff8a2c, Setups[i].mask3, Blitter_Endmask3_WriteWord);
+	MicroBench_WriteIoWord(0xff8a2e, 2, Blitter_DestXInc_WriteWord);
+	MicroBench_WriteIoWord(0xff8a30, 2, Blitter_DestYInc_WriteWord);
+	IoMem_WriteLong(0xff8a32, 0x40000);
+	Blitter_DestAddr_WriteLong();
+	MicroBench_WriteIoWord(0xff8a36, MICROBENCH_BLIT_WORDS, Blitter_WordsPerLine_WriteWord);
+	MicroBench_WriteIoWord(0xff8a38, MICROBENCH_BLIT_LINES, Blitter_LinesPerBitblock_WriteWord);
+	MicroBench_WriteIoByte(0xff8a3a, Setups[i].hop, Blitter_HalftoneOp_WriteByte);
+	MicroBench_WriteIoByte(0xff8a3b, Setups[i].lop, Blitter_LogOp_WriteByte);
+	MicroBench_WriteIoByte(0xff8a3d, Setups[i].skew, Blitter_Skew_WriteByte);
+	MicroBench_WriteIoByte(0xff8a3c, 0xc0, Blitter_Control_WriteByte);
+
+	/* start right away instead of after the CPU cycles */
+	Blitter_InterruptHandler();
+	return MICROBENCH_BLIT_WORDS * MICROBENCH_BLIT_LINES;
+}
+
+
+/* ----------------------------------------------------------------------- */
+/* DSP: loop of ALU instructions in internal P memory */
+
+#if ENABLE_DSP_EMU
+#define MICROBENCH_DSP_CYCLES	100000
+
+static const char *MicroBench_DspSetup(void)
+{
+	static const Uint32 Loop[] = {
+		0x200040,	/* add x0,a */
+		0x200032,	/* asl a */
+		0x200040,	/* add x0,a */
+		0x200032,	/* asl a */
+		0x0c0000	/* jmp $0 */
+	};
+
+	if (!bDspEnabled)
+		return "needs Falcon with DSP emulation";
+
+	DSP_EnableThread(false);
+	memcpy(dsp_core.ramint[2], Loop, sizeof(Loop));
+	dsp_core.pc = 0;
+	dsp_core.running = 1;
+	return NULL;
+}
+
+static Uint32 MicroBench_DspRun(void)
+{
+	/* host cycles are half of the DSP cycles */
+	DSP_Run(MICROBENCH_DSP_CYCLES / 2);
+	return MICROBENCH_DSP_CYCLES;
+}
+#else
+static const char *MicroBench_DspSetup(void)
+{
+	return "DSP emulation not compiled in";
+}
+
+static Uint32 MicroBench_DspRun(void)
+{
+	return 0;
+}
+#endif
+
+
+/* ----------------------------------------------------------------------- */
+/* CycInt: acknowledge / add cycle with 8 pending events of mixed delays */
+
+#define MICROBENCH_CYCINT_EVENTS	8
+#define MICROBENCH_CYCINT_LOOPS		4096
+
+static Uint32 MicroBenchRandom;
+
+static int MicroBench_CycIntDelay(void)
+{
+	MicroBenchRandom = MicroBenchRandom * 1103515245 + 12345;
+	return 4 + ((MicroBenchRandom >> 16) & 0x3ff);
+}
+
+static const char *MicroBench_CycIntSetup(void)
+{
+	int i;
+
+	CycInt_Reset();
+	MicroBenchRandom = 1;
+	for (i = 1; i <= MICROBENCH_CYCINT_EVENTS; i++)
+		CycInt_AddRelativeInterrupt(MicroBench_CycIntDelay(), INT_CPU_CYCLE, i);
+	return NULL;
+}
+
+static Uint32 MicroBench_CycIntRun(void)
+{
+	int i, id;
+
+	for (i = 0; i < MICROBENCH_CYCINT_LOOPS; i++)
+	{
+		/* the earliest event is due, acknowledge it like its handler */
+		PendingInterruptCount = 0;
+		CycInt_AcknowledgeInterrupt();
+
+		/* and replace it, with a pseudo random delay */
+		for (id = 1; CycInt_InterruptActive(id); id++)
+			;
+		CycInt_AddRelativeInterrupt(MicroBench_CycIntDelay(), INT_CPU_CYCLE, id);
+	}
+	return MICROBENCH_CYCINT_LOOPS;
+}
+
+static void MicroBench_CycIntCleanup(void)
+{
+	CycInt_Reset();
+}
+
+
+/* ----------------------------------------------------------------------- */
+/* MSA and STX: 80 tracks, 2 sides, 9 sectors with mixed content */
+
+#define MICROBENCH_TRACKS	160
+#define MICROBENCH_SECTORS	9
+
+static Uint8 *pMicroBenchImage;
+static long nMicroBenchImageBytes;
+
+/* Fill sector with pseudo random data or (for even sectors) a constant */
+static void MicroBench_FillSector(Uint8 *p, int track, int sector)
+{
+	Uint32 seed = track * MICROBENCH_SECTORS + sector + 1;
+	int i;
+
+	for (i = 0; i < NUMBYTESPERSECTOR; i++)
+	{
+		seed = seed * 1103515245 + 12345;
+		p[i] = sector & 1 ? seed >> 16 : 0xe5;
+	}
+}
+
+static void MicroBench_FreeImage(void)
+{
+	free(pMicroBenchImage);
+	pMicroBenchImage = NULL;
+}
+
+static const char *MicroBench_MsaSetup(void)
+{
+	Uint8 sector[NUMBYTESPERSECTOR];
+	Uint8 *p, *pTrack;
+	int track, s, i;
+
+	p = pMicroBenchImage = malloc(10 + MICROBENCH_TRACKS
+	                              * (2 + MICROBENCH_SECTORS * NUMBYTESPERSECTOR * 4));
+	if (!p)
+		return "out of memory";
+
+	/* header: ID, sectors per track, sides-1, first and last track */
+	do_put_mem_word(p, 0x0E0F);
+	do_put_mem_word(p + 2, MICROBENCH_SECTORS);
+	do_put_mem_word(p + 4, 1);
+	do_put_mem_word(p + 6, 0);
+	do_put_mem_word(p + 8, MICROBENCH_TRACKS / 2 - 1);
+	p += 10;
+
+	for (track = 0; track < MICROBENCH_TRACKS; track++)
+	{
+		pTrack = p;
+		p += 2;
+		for (s = 0; s < MICROBENCH_SECTORS; s++)
+		{
+			MicroBench_FillSector(sector, track, s);
+			if (!(s & 1))
+			{
+				/* run of one byte */
+				*p++ = 0xe5;
+				*p++ = sector[0];
+				do_put_mem_word(p, NUMBYTESPERSECTOR);
+				p += 2;
+				continue;
+			}
+			for (i = 0; i < NUMBYTESPERSECTOR; i++)
+			{
+				*p++ = sector[i];
+				if (sector[i] == 0xe5)
+				{
+					/* escaped marker byte */
+					*p++ = 0xe5;
+					do_put_mem_word(p, 1);
+					p += 2;
+				}
+			}
+		}
+		do_put_mem_word(pTrack, p - pTrack - 2);
+	}
+	nMicroBenchImageBytes = p - pMicroBenchImage;
+
+	/* the lazy decoding goes through drive B */
+	Floppy_EjectDiskFromDrive(1);
+	return NULL;
+}
+
+static Uint32 MicroBench_MsaRun(void)
+{
+	Uint8 *pMsa, *pBuffer;
+	long nImageBytes;
+
+	pMsa = malloc(nMicroBenchImageBytes);
+	if (!pMsa)
+		return 0;
+	memcpy(pMsa, pMicroBenchImage, nMicroBenchImageBytes);
+
+	pBuffer = MSA_UnCompress(1, pMsa, nMicroBenchImageBytes, &nImageBytes);
+	if (!pBuffer)
+		return 0;
+	EmulationDrives[1].pBuffer = pBuffer;
+	Floppy_LoadImage(1, 0, -1);
+	EmulationDrives[1].pBuffer = NULL;
+	free(pBuffer);
+	return MICROBENCH_TRACKS;
+}
+
+/* STX files are little endian */
+static void MicroBench_PutLE(Uint8 *p, Uint32 value, int bytes)
+{
+	for (; bytes > 0; bytes--, value >>= 8)
+		*p++ = value;
+}
+
+static const char *MicroBench_StxSetup(void)
+{
+	const int nTrackBytes = 16 + MICROBENCH_SECTORS * (16 + NUMBYTESPERSECTOR);
+	Uint8 *p;
+	int track, s;
+
+	p = pMicroBenchImage = calloc(1, 16 + MICROBENCH_TRACKS * nTrackBytes);
+	if (!p)
+		return "out of memory";
+
+	/* header: ID, version 3, revision 0 */
+	memcpy(p, "RSY", 4);
+	p[4] = 3;
+	p[10] = MICROBENCH_TRACKS;
+	p += 16;
+
+	for (track = 0; track < MICROBENCH_TRACKS; track++)
+	{
+		/* track header: block size, sector count, flags, MFM size, number */
+		MicroBench_PutLE(p, nTrackBytes, 4);
+		p[8] = MICROBENCH_SECTORS;
+		p[10] = STX_TRACK_FLAG_SECTOR_BLOCK;
+		MicroBench_PutLE(p + 12, 6250, 2);
+		p[14] = (track >> 1) | (track & 1) << 7;
+		p += 16;
+
+		/* sector descriptors, one sector with variable timings */
+		for (s = 0; s < MICROBENCH_SECTORS; s++)
+		{
+			MicroBench_PutLE(p, s * NUMBYTESPERSECTOR, 4);
+			MicroBench_PutLE(p + 4, (100 + s * 690) * 8, 2);
+			p[8] = track >> 1;
+			p[9] = track & 1;
+			p[10] = s + 1;
+			p[11] = 2;
+			p[14] = s == 4 ? STX_SECTOR_FLAG_VARIABLE_TIME : 0;
+			p += 16;
+		}
+		for (s = 0; s < MICROBENCH_SECTORS; s++)
+		{
+			MicroBench_FillSector(p, track, s);
+			p += NUMBYTESPERSECTOR;
+		}
+	}
+	return NULL;
+}
+
+static Uint32 MicroBench_StxRun(void)
+{
+	STX_MAIN_STRUCT *pStxMain;
+
+	pStxMain = STX_BuildStruct(pMicroBenchImage, 0);
+	if (!pStxMain)
+		return 0;
+	/* a prefetched structure is the only one freed from outside */
+	STX_SetPrefetched(pMicroBenchImage, pStxMain);
+	STX_SetPrefetched(NULL, NULL);
+	return MICROBENCH_TRACKS;
+}
+
+
+/* ----------------------------------------------------------------------- */
+
+static const MICROBENCH_KERNEL MicroBenchKernels[] = {
+	{ "convert", "frames", MicroBench_ConvertSetup, MicroBench_ConvertRun, NULL },
+	{ "ym", "samples", MicroBench_YmSetup, MicroBench_YmRun, NULL },
+	{ "dmasnd", "samples", MicroBench_DmaSndSetup, MicroBench_DmaSndRun, NULL },
+	{ "blitter", "words", MicroBench_BlitterSetup, MicroBench_BlitterRun, MicroBench_CycIntCleanup },
+	{ "dsp", "cycles", MicroBench_DspSetup, MicroBench_DspRun, NULL },
+	{ "cycint", "events", MicroBench_CycIntSetup, MicroBench_CycIntRun, MicroBench_CycIntCleanup },
+	{ "msa", "tracks", MicroBench_MsaSetup, MicroBench_MsaRun, MicroBench_FreeImage },
+	{ "stx", "tracks", MicroBench_StxSetup, MicroBench_StxRun, MicroBench_FreeImage }
+};
+
+#define MICROBENCH_KERNELS	(int)(sizeof(MicroBenchKernels) / sizeof(MicroBenchKernels[0]))
+
+
+/**
+ * Select kernels to run from comma separated list of their names,
+ * or "all". Return false for an unknown name.
+ */
+bool MicroBench_SetKernels(const char *list)
+{
+	const char *end;
+	size_t len;
+	int i;
+
+	for (; *list; list = *end ? end + 1 : end)
+	{
+		end = strchr(list, ',');
+		if (!end)
+			end = list + strlen(list);
+		len = end - list;
+
+		if (len == 3 && strncmp(list, "all", len) == 0)
+		{
+			MicroBenchMask = (1 << MICROBENCH_KERNELS) - 1;
+			continue;
+		}
+		for (i = 0; i < MICROBENCH_KERNELS; i++)
+		{
+			if (strlen(MicroBenchKernels[i].name) == len
+			    && strncmp(list, MicroBenchKernels[i].name, len) == 0)
+				break;
+		}
+		if (i == MICROBENCH_KERNELS)
+			return false;
+		MicroBenchMask |= 1 << i;
+	}
+	return MicroBenchMask != 0;
+}
+
+/**
+ * Return true if micro-benchmarks should be run instead of the emulation
+ */
+bool MicroBench_IsRequested(void)
+{
+	return MicroBenchMask != 0;
+}
+
+/**
+ * Run the selected kernels and write their results as JSON lines to fp.
+ * Return exit code, non-zero if a kernel failed.
+ */
+int MicroBench_Run(FILE *fp)
+{
+	const MICROBENCH_KERNEL *k;
+	const char *reason;
+	Sint64 start, usecs;
+	Uint64 units, batches;
+	Uint32 done;
+	int i, ret = 0;
+
+	for (i = 0; i < MICROBENCH_KERNELS; i++)
+	{
+		if (!(MicroBenchMask & (1 << i)))
+			continue;
+		k = &MicroBenchKernels[i];
+
+		reason = k->setup();
+		if (reason)
+		{
+			fprintf(fp, "{\"kernel\": \"%s\", \"skipped\": \"%s\"}\n", k->name, reason);
+			continue;
+		}
+
+		/* warm up caches and lazily set up state */
+		if (k->run() == 0)
+		{
+			fprintf(fp, "{\"kernel\": \"%s\", \"failed\": true}\n", k->name);
+			if (k->cleanup)
+				k->cleanup();
+			ret = 1;
+			continue;
+		}
+
+		units = batches = 0;
+		start = Time_GetTicks();
+		do
+		{
+			done = k->run();
+			units += done;
+			batches++;
+			usecs = Time_GetTicks() - start;
+		}
+		while (done && usecs < MICROBENCH_USECS);
+
+		if (k->cleanup)
+			k->cleanup();
+		if (!done)
+		{
+			fprintf(fp, "{\"kernel\": \"%s\", \"failed\": true}\n", k->name);
+			ret = 1;
+			continue;
+		}
+		fprintf(fp, "{\"kernel\": \"%s\", \"unit\": \"%s\", \"batches\": %"PRIu64
+		        ", \"units\": %"PRIu64", \"seconds\": %.3f, \"ns_per_unit\": %.2f}\n",
+		        k->name, k->unit, batches, units, usecs / 1000000.0,
+		        usecs * 1000.0 / units);
+		fflush(fp);
+	}
+	return ret;
+}
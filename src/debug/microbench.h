@@ -0,0 +1,15 @@
+/*
+  Hatari - microbench.h
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+*/
+
+#ifndef HATARI_MICROBENCH_H
+#define HATARI_MICROBENCH_H
+
+extern bool MicroBench_SetKernels(const char *list);
+extern bool MicroBench_IsRequested(void);
+extern int MicroBench_Run(FILE *fp);
+
+#endif
@@ -14,6 +14,9 @@
 const char Natfeats_fileid[] = "Hatari natfeats.c : " __DATE__ " " __TIME__;
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
 #include "main.h"
 #include "version.h"
 #include "configuration.h"
@@ -22,6 +25,8 @@ const char Natfeats_fileid[] = "Hatari natfeats.c : " __DATE__ " " __TIME__;
 #include "natfeats.h"
 #include "control.h"
 #include "log.h"
+#include "screenSnapShot.h"
+#include "memorySnapShot.h"
 
 
 /* whether to allow XBIOS(255) style
@@ -34,6 +39,33 @@ const char Natfeats_fileid[] = "Hatari natfeats.c : " __DATE__ " " __TIME__;
  * - clipboard and hostfs native features?
  */
 
+/* Batch mode: the jobs are command lines given to a guest job runner
+ * through NF_BATCH. The machine state when the runner asks for its first
+ * job is kept, and restored after each job's NF_EXIT, so that every job
+ * starts from the same booted machine without restarting Hatari.
+ */
+#define BATCH_LINE_MAX 256
+
+typedef enum {
+	BATCH_OFF,
+	BATCH_START,	/* waiting for the runner's first NF_BATCH */
+	BATCH_CAPTURE,	/* state to be kept on next VBL */
+	BATCH_RESTORE,	/* state to be restored on next VBL */
+	BATCH_READY,	/* next job can be given to the runner */
+	BATCH_RUNNING	/* job given, waiting for its NF_EXIT */
+} batch_state_t;
+
+static struct {
+	batch_state_t state;
+	char **jobs;
+	int count;
+	int current;
+	int failed;
+	int exitval;	/* exit value of the first failed job */
+	void *base;	/* machine state before the first job */
+	int size;
+} Batch;
+
 
 /* ----------------------------------
  * Native Features shared with Aranym
@@ -132,10 +164,69 @@ static bool nf_exit(Uint32 stack, Uint32 subid, Uint32 *retval)
 	ConfigureParams.Log.bConfirmQuit = false;
 	exitval = STMemory_ReadLong(stack);
 	LOG_TRACE(TRACE_NATFEATS, "NF_EXIT(%d)\n", exitval);
+
+	if (Batch.state == BATCH_RUNNING) {
+		fprintf(stderr, "Batch job %d/%d '%s' exit value: %d\n",
+			Batch.current + 1, Batch.count, Batch.jobs[Batch.current], exitval);
+		if (exitval && !Batch.failed++)
+			Batch.exitval = exitval;
+		if (++Batch.current < Batch.count) {
+			Batch.state = BATCH_RESTORE;
+			return true;
+		}
+		fprintf(stderr, "Batch done, %d/%d jobs failed.\n", Batch.failed, Batch.count);
+		Batch.state = BATCH_OFF;
+		exitval = Batch.exitval;
+	}
 	Main_RequestQuit(exitval);
 	return true;
 }
 
+/**
+ * NF_BATCH - get the command line of the next batch job
+ * Stack arguments are:
+ * - pointer to buffer for the command line, and
+ * - uint32_t for its size
+ * Returns its length, 0 when there are no (more) jobs, or -1 when
+ * the runner needs to wait for a VBL and call again.  The job's
+ * NF_EXIT value is recorded, and the machine is then brought back to
+ * the state it had when the runner first asked for a job.
+ */
+static bool nf_batch(Uint32 stack, Uint32 subid, Uint32 *retval)
+{
+	Uint32 ptr, len;
+	char *buf;
+
+	ptr = STMemory_ReadLong(stack);
+	len = STMemory_ReadLong(stack + SIZE_LONG);
+	LOG_TRACE(TRACE_NATFEATS, "NF_BATCH(0x%x, %d)\n", ptr, len);
+
+	switch (Batch.state) {
+	case BATCH_OFF:
+	case BATCH_RUNNING:
+		*retval = 0;
+		return true;
+	case BATCH_START:
+		Batch.state = BATCH_CAPTURE;
+		/* fall through */
+	case BATCH_CAPTURE:
+	case BATCH_RESTORE:
+		*retval = (Uint32)-1;
+		return true;
+	case BATCH_READY:
+		break;
+	}
+
+	if (!STMemory_ValidArea(ptr, len)) {
+		M68000_BusError(ptr, BUS_ERROR_WRITE);
+		return false;
+	}
+	buf = (char *)STRAM_ADDR(ptr);
+	*retval = snprintf(buf, len, "%s", Batch.jobs[Batch.current]);
+	Batch.state = BATCH_RUNNING;
+	return true;
+}
+
 /**
  * NF_DEBUGGER - invoke debugger
  */
@@ -162,6 +253,203 @@ static bool nf_fastforward(Uint32 stack, Uint32 subid, Uint32 *retval)
 	return true;
 }
 
+/**
+ * NF_SCREENSHOT - save screenshot of next frame (drawn also in headless mode)
+ */
+static bool nf_screenshot(Uint32 stack, Uint32 subid, Uint32 *retval)
+{
+	LOG_TRACE(TRACE_NATFEATS, "NF_SCREENSHOT()\n");
+	ScreenSnapShot_SaveScreen();
+	return true;
+}
+
+/* ----------------------------------
+ * Bulk operations done by the host. They complete instantly, which
+ * changes the emulated timing, so they're available only when enabled
+ * with the --natfeats-bulk option.
+ */
+
+/**
+ * Return host pointer to given guest memory area,
+ * or NULL if it isn't (completely) in ST RAM or ROM
+ */
+static Uint8 *nf_bulk_area(Uint32 addr, Uint32 len)
+{
+	addr &= 0xffffff;
+	if (len > 0xffffff || !STMemory_ValidArea(addr, len))
+		return NULL;
+	return (Uint8 *)STRAM_ADDR(addr);
+}
+
+/**
+ * NF_MEMCPY - copy memory area, the areas may overlap
+ * Stack arguments are:
+ * - pointer to destination
+ * - pointer to source
+ * - uint32_t for the size
+ * Returns the size
+ */
+static bool nf_memcpy(Uint32 stack, Uint32 subid, Uint32 *retval)
+{
+	Uint32 dst, src, len;
+	Uint8 *pdst, *psrc;
+
+	dst = STMemory_ReadLong(stack);
+	src = STMemory_ReadLong(stack + SIZE_LONG);
+	len = STMemory_ReadLong(stack + 2*SIZE_LONG);
+	LOG_TRACE(TRACE_NATFEATS, "NF_MEMCPY(0x%x, 0x%x, %d)\n", dst, src, len);
+
+	if (!(psrc = nf_bulk_area(src, len))) {
+		M68000_BusError(src, BUS_ERROR_READ);
+		return false;
+	}
+	if (!(pdst = nf_bulk_area(dst, len))) {
+		M68000_BusError(dst, BUS_ERROR_WRITE);
+		return false;
+	}
+	STMemory_MarkDirty(dst, len);
+	memmove(pdst, psrc, len);
+	*retval = len;
+	return true;
+}
+
+/**
+ * NF_MEMSET - fill memory area with given byte
+ * Stack arguments are:
+ * - pointer to destination
+ * - uint32_t byte value
+ * - uint32_t for the size
+ * Returns the size
+ */
+static bool nf_memset(Uint32 stack, Uint32 subid, Uint32 *retval)
+{
+	Uint32 dst, val, len;
+	Uint8 *pdst;
+
+	dst = STMemory_ReadLong(stack);
+	val = STMemory_ReadLong(stack + SIZE_LONG);
+	len = STMemory_ReadLong(stack + 2*SIZE_LONG);
+	LOG_TRACE(TRACE_NATFEATS, "NF_MEMSET(0x%x, 0x%x, %d)\n", dst, val, len);
+
+	if (!(pdst = nf_bulk_area(dst, len))) {
+		M68000_BusError(dst, BUS_ERROR_WRITE);
+		return false;
+	}
+	STMemory_MarkDirty(dst, len);
+	memset(pdst, val, len);
+	*retval = len;
+	return true;
+}
+
+/**
+ * NF_CRC32 / NF_ADLER32 - update checksum with memory area
+ * Stack arguments are:
+ * - pointer to the data
+ * - uint32_t for its size
+ * - uint32_t checksum so far (0 for CRC32 and 1 for Adler-32 to start)
+ * Returns the updated checksum
+ */
+static bool nf_checksum(const char *name, Uint32 stack, Uint32 *retval, bool bAdler)
+{
+	Uint32 ptr, len, sum;
+	Uint8 *buf;
+
+	ptr = STMemory_ReadLong(stack);
+	len = STMemory_ReadLong(stack + SIZE_LONG);
+	sum = STMemory_ReadLong(stack + 2*SIZE_LONG);
+	LOG_TRACE(TRACE_NATFEATS, "%s(0x%x, %d, 0x%x)\n", name, ptr, len, sum);
+
+	if (!(buf = nf_bulk_area(ptr, len))) {
+		M68000_BusError(ptr, BUS_ERROR_READ);
+		return false;
+	}
+	if (bAdler)
+		*retval = adler32(sum, buf, len);
+	else
+		*retval = crc32(sum, buf, len);
+	return true;
+}
+
+static bool nf_crc32(Uint32 stack, Uint32 subid, Uint32 *retval)
+{
+	return nf_checksum("NF_CRC32", stack, retval, false);
+}
+
+static bool nf_adler32(Uint32 stack, Uint32 subid, Uint32 *retval)
+{
+	return nf_checksum("NF_ADLER32", stack, retval, true);
+}
+
+/**
+ * NF_DEFLATE / NF_INFLATE - compress to zlib format, or decompress
+ * zlib or gzip format data, between (non-overlapping) memory areas.
+ * For NF_DEFLATE, subid gives the compression level (0 for default).
+ * Stack arguments are:
+ * - pointer to destination
+ * - uint32_t for its size
+ * - pointer to source
+ * - uint32_t for its size
+ * Returns the size of the result, or -1 if the source data is invalid
+ * or the result doesn't fit to the destination
+ */
+static bool nf_zlib(const char *name, Uint32 stack, Uint32 subid, Uint32 *retval, bool bDeflate)
+{
+	Uint32 dst, dstlen, src, srclen;
+	Uint8 *pdst, *psrc;
+	z_stream zs;
+	int ret;
+
+	dst = STMemory_ReadLong(stack);
+	dstlen = STMemory_ReadLong(stack + SIZE_LONG);
+	src = STMemory_ReadLong(stack + 2*SIZE_LONG);
+	srclen = STMemory_ReadLong(stack + 3*SIZE_LONG);
+	LOG_TRACE(TRACE_NATFEATS, "%s[%d](0x%x, %d, 0x%x, %d)\n", name, subid,
+		  dst, dstlen, src, srclen);
+
+	if (!(psrc = nf_bulk_area(src, srclen))) {
+		M68000_BusError(src, BUS_ERROR_READ);
+		return false;
+	}
+	if (!(pdst = nf_bulk_area(dst, dstlen))) {
+		M68000_BusError(dst, BUS_ERROR_WRITE);
+		return false;
+	}
+
+	memset(&zs, 0, sizeof(zs));
+	if (bDeflate)
+		ret = deflateInit(&zs, subid ? (int)(subid < 9 ? subid : 9) : Z_DEFAULT_COMPRESSION);
+	else
+		ret = inflateInit2(&zs, 15 + 32);	/* zlib or gzip header */
+	if (ret != Z_OK) {
+		*retval = (Uint32)-1;
+		return true;
+	}
+	zs.next_in = psrc;
+	zs.avail_in = srclen;
+	zs.next_out = pdst;
+	zs.avail_out = dstlen;
+	STMemory_MarkDirty(dst, dstlen);
+	if (bDeflate) {
+		ret = deflate(&zs, Z_FINISH);
+		deflateEnd(&zs);
+	} else {
+		ret = inflate(&zs, Z_FINISH);
+		inflateEnd(&zs);
+	}
+	*retval = ret == Z_STREAM_END ? zs.total_out : (Uint32)-1;
+	return true;
+}
+
+static bool nf_deflate(Uint32 stack, Uint32 subid, Uint32 *retval)
+{
+	return nf_zlib("NF_DEFLATE", stack, subid, retval, true);
+}
+
+static bool nf_inflate(Uint32 stack, Uint32 subid, Uint32 *retval)
+{
+	return nf_zlib("NF_INFLATE", stack, subid, retval, false);
+}
+
 #if NF_COMMAND
 /**
  * NF_COMMAND - execute Hatari (cli / debugger) command
@@ -195,6 +483,7 @@ static const struct {
 	const char *name;	/* feature name */
 	bool super;		/* should be called only in supervisor mode */
 	bool (*cb)(Uint32 stack, Uint32 subid, Uint32 *retval);
+	bool bulk;		/* available only with --natfeats-bulk */
 } features[] = {
 #if NF_COMMAND
 	{ "NF_COMMAND",  false, nf_command },
@@ -205,7 +494,15 @@ static const struct {
 	{ "NF_SHUTDOWN", true,  nf_shutdown },
 	{ "NF_EXIT",     false, nf_exit },
 	{ "NF_DEBUGGER", false, nf_debugger },
-	{ "NF_FASTFORWARD", false,  nf_fastforward }
+	{ "NF_FASTFORWARD", false,  nf_fastforward },
+	{ "NF_SCREENSHOT", false,  nf_screenshot },
+	{ "NF_BATCH",    false, nf_batch },
+	{ "NF_MEMCPY",   false, nf_memcpy,  true },
+	{ "NF_MEMSET",   false, nf_memset,  true },
+	{ "NF_CRC32",    false, nf_crc32,   true },
+	{ "NF_ADLER32",  false, nf_adler32, true },
+	{ "NF_DEFLATE",  false, nf_deflate, true },
+	{ "NF_INFLATE",  false, nf_inflate, true }
 };
 
 /* macros from Aranym */
@@ -238,6 +535,8 @@ bool NatFeat_ID(Uint32 stack, Uint32 *retval)
 	LOG_TRACE(TRACE_NATFEATS, "NF ID(0x%x \"%s\")\n", ptr, name);
 
 	for (i = 0; i < ARRAYSIZE(features); i++) {
+		if (features[i].bulk && !ConfigureParams.Log.bNatFeatsBulk)
+			continue;
 		if (strcmp(features[i].name, name) == 0) {
 			*retval = IDX2MASTERID(i);
 			return true;
@@ -265,6 +564,10 @@ bool NatFeat_Call(Uint32 stack, bool super, Uint32 *retval)
 		LOG_TRACE(TRACE_NATFEATS, "ERROR: invalid NF ID %d requested\n", idx);
 		return true; /* undefined */
 	}
+	if (features[idx].bulk && !ConfigureParams.Log.bNatFeatsBulk) {
+		LOG_TRACE(TRACE_NATFEATS, "ERROR: NF function %d called without bulk operations enabled\n", idx);
+		return true; /* undefined */
+	}
 	if (features[idx].super && !super) {
 		LOG_TRACE(TRACE_NATFEATS, "ERROR: NF function %d called without supervisor mode\n", idx);
 		Exception(8, 0, M68000_EXC_SRC_CPU);
@@ -273,3 +576,79 @@ bool NatFeat_Call(Uint32 stack, bool super, Uint32 *retval)
 	stack += SIZE_LONG;
 	return features[idx].cb(stack, subid, retval);
 }
+
+
+/* ---------------------------- */
+
+/**
+ * Read batch job command lines from given file, one per line, and enable
+ * Native Features and fast forward for running them.
+ * Return false if the file can't be read or has no jobs.
+ */
+bool NatFeat_SetBatchFile(const char *path)
+{
+	char line[BATCH_LINE_MAX];
+	char **jobs;
+	size_t len;
+	FILE *fp;
+
+	fp = fopen(path, "r");
+	if (!fp) {
+		fprintf(stderr, "ERROR: batch job file '%s' missing.\n", path);
+		return false;
+	}
+	while (fgets(line, sizeof(line), fp)) {
+		len = strcspn(line, "\r\n");
+		line[len] = '\0';
+		if (!len || line[0] == '#')
+			continue;
+		jobs = realloc(Batch.jobs, (Batch.count + 1) * sizeof(*jobs));
+		if (!jobs || !(jobs[Batch.count] = strdup(line))) {
+			Batch.jobs = jobs;
+			break;
+		}
+		Batch.jobs = jobs;
+		Batch.count++;
+	}
+	fclose(fp);
+
+	if (!Batch.count) {
+		fprintf(stderr, "ERROR: no batch jobs in '%s'.\n", path);
+		return false;
+	}
+	fprintf(stderr, "%d batch jobs from '%s'.\n", Batch.count, path);
+	ConfigureParams.Log.bNatFeats = true;
+	ConfigureParams.System.bFastForward = true;
+	Batch.state = BATCH_START;
+	Batch.current = 0;
+	return true;
+}
+
+/**
+ * Called on each VBL, keeps or restores the machine state for the batch
+ * jobs (snapshots can't be done in the middle of an NF call)
+ */
+void NatFeat_BatchUpdate(void)
+{
+	if (Batch.state == BATCH_CAPTURE) {
+		Batch.size = MemorySnapShot_Size();
+		Batch.base = malloc(Batch.size);
+		if (Batch.base)
+			Batch.size = MemorySnapShot_CaptureMem(Batch.base, Batch.size);
+		if (!Batch.base || Batch.size < 0) {
+			fprintf(stderr, "ERROR: can't keep the machine state for batch jobs.\n");
+			Batch.state = BATCH_OFF;
+			Main_RequestQuit(1);
+			return;
+		}
+		Batch.state = BATCH_READY;
+	} else if (Batch.state == BATCH_RESTORE) {
+		if (!MemorySnapShot_RestoreMem(Batch.base, Batch.size)) {
+			fprintf(stderr, "ERROR: can't restore the machine state for batch jobs.\n");
+			Batch.state = BATCH_OFF;
+			Main_RequestQuit(1);
+			return;
+		}
+		Batch.state = BATCH_READY;
+	}
+}
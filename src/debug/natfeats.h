@@ -10,5 +10,7 @@
 
 extern bool NatFeat_ID(Uint32, Uint32 *retval);
 extern bool NatFeat_Call(Uint32, bool isSuper, Uint32 *retval);
+extern bool NatFeat_SetBatchFile(const char *path);
+extern void NatFeat_BatchUpdate(void);
 
 #endif /* HATARI_NATFEATS_H */
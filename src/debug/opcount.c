@@ -0,0 +1,347 @@
+/*
+ * Hatari - opcount.c
+ *
+ * This file is distributed under the GNU General Public License, version 2
+ * or at your option any later version. Read the file gpl.txt for details.
+ *
+ * opcount.c - CPU opcode and opcode pair execution counts
+ *
+ * When enabled from the debugger, every executed CPU opcode is counted,
+ * and every Nth instruction the (previous, current) pair of opcode
+ * handlers is added to a fixed size hash table. The counts summed per
+ * opcode handler can be saved in the "frequent.68k" format read by
+ * gencpu, which then generates the most used handlers first. The most
+ * frequent handler pairs follow it in the file, for choosing which
+ * instructions to fuse or specialise.
+ */
+const char OpCount_fileid[] = "Hatari opcount.c : " __DATE__ " " __TIME__;
+
+#include <errno.h>
+#include <inttypes.h>
+#include "main.h"
+#include "debugui.h"
+#include "debug_priv.h"
+#include "file.h"
+#include "m68000.h"
+#include "opcount.h"
+#include "stMemory.h"
+
+#define OPCOUNT_INTERVAL	16	/* default pair sampling interval */
+#define OPCOUNT_PAIRS		65536	/* pair table size, power of 2 */
+#define OPCOUNT_PROBES		16	/* pair table entries tried */
+#define OPCOUNT_SAVE_PAIRS	256	/* default pairs saved */
+
+typedef struct {
+	Uint32 key;	/* handler opcodes, first << 16 | second */
+	Uint32 count;	/* zero for unused entry */
+} opcount_pair_t;
+
+bool bOpCounting;
+
+static Uint64 OpCounts[65536];
+static opcount_pair_t *pOpPairs;
+static Uint64 nPairsSampled, nPairsDropped;
+static Uint32 nPairInterval, nPairCountdown;
+static Uint16 nPrevOpcode;
+
+
+/**
+ * Return opcode whose handler executes given opcode
+ */
+static inline Uint16 OpCount_Handler(Uint16 opcode)
+{
+	long handler = table68k[opcode].handler;
+	return handler == -1 ? opcode : handler;
+}
+
+/**
+ * Return mnemonic of given opcode
+ */
+static const char *OpCount_Name(Uint16 opcode)
+{
+	const struct mnemolookup *lookup;
+
+	for (lookup = lookuptab; lookup->mnemo != table68k[opcode].mnemo; lookup++)
+		;
+	return lookup->name;
+}
+
+
+/**
+ * Count CPU instruction at PC, sample opcode pair every Nth one
+ */
+void OpCount_AddCpu(void)
+{
+	Uint16 opcode = STMemory_ReadWord(M68000_GetPC());
+	Uint32 key, idx;
+	int i;
+
+	OpCounts[opcode]++;
+	if (--nPairCountdown)
+	{
+		nPrevOpcode = opcode;
+		return;
+	}
+	nPairCountdown = nPairInterval;
+	nPairsSampled++;
+
+	key = OpCount_Handler(nPrevOpcode) << 16 | OpCount_Handler(opcode);
+	nPrevOpcode = opcode;
+	idx = (key * 2654435761u) >> 16;
+	for (i = 0; i < OPCOUNT_PROBES; i++, idx++)
+	{
+		opcount_pair_t *pair = &pOpPairs[idx & (OPCOUNT_PAIRS - 1)];
+		if (pair->key == key || !pair->count)
+		{
+			pair->key = key;
+			pair->count++;
+			return;
+		}
+	}
+	nPairsDropped++;
+}
+
+
+/**
+ * Start counting from zero, sampling pairs at given interval
+ */
+static void OpCount_Start(Uint32 interval)
+{
+	if (!pOpPairs)
+	{
+		pOpPairs = malloc(OPCOUNT_PAIRS * sizeof(*pOpPairs));
+		if (!pOpPairs)
+		{
+			fprintf(stderr, "ERROR: opcode pair table allocation failed!\n");
+			return;
+		}
+	}
+	memset(OpCounts, 0, sizeof(OpCounts));
+	memset(pOpPairs, 0, OPCOUNT_PAIRS * sizeof(*pOpPairs));
+	nPairsSampled = nPairsDropped = 0;
+	nPairInterval = nPairCountdown = interval;
+	nPrevOpcode = 0;
+	bOpCounting = true;
+	fprintf(stderr, "Counting CPU opcodes, pairs sampled every %u instructions.\n",
+	        interval);
+}
+
+
+/*-----------------------------------------------------------------------*/
+
+static Uint64 *pSortCounts;
+
+static int OpCount_CompareHandlers(const void *a, const void *b)
+{
+	Uint64 x = pSortCounts[*(const Uint16 *)a], y = pSortCounts[*(const Uint16 *)b];
+	return x < y ? 1 : x > y ? -1 : 0;
+}
+
+static int OpCount_ComparePairs(const void *a, const void *b)
+{
+	Uint32 x = ((const opcount_pair_t *)a)->count, y = ((const opcount_pair_t *)b)->count;
+	return x < y ? 1 : x > y ? -1 : 0;
+}
+
+/**
+ * Sum opcode counts per handler to 'counts' and sort the executed
+ * handlers to 'handlers' by their count. Return number of handlers
+ * and set 'total' to the sum of all counts.
+ */
+static int OpCount_SortHandlers(Uint64 *counts, Uint16 *handlers, Uint64 *total)
+{
+	int i, n = 0;
+
+	memset(counts, 0, 65536 * sizeof(*counts));
+	*total = 0;
+	for (i = 0; i < 65536; i++)
+	{
+		if (!OpCounts[i])
+			continue;
+		counts[OpCount_Handler(i)] += OpCounts[i];
+		*total += OpCounts[i];
+	}
+	for (i = 0; i < 65536; i++)
+	{
+		/* gencpu doesn't generate handlers for illegal opcodes */
+		if (counts[i] && table68k[i].mnemo != i_ILLG)
+			handlers[n++] = i;
+	}
+	pSortCounts = counts;
+	qsort(handlers, n, sizeof(*handlers), OpCount_CompareHandlers);
+	return n;
+}
+
+/**
+ * Copy used pair table entries to 'pairs' sorted by their count,
+ * return their number
+ */
+static int OpCount_SortPairs(opcount_pair_t *pairs)
+{
+	int i, n = 0;
+
+	for (i = 0; i < OPCOUNT_PAIRS; i++)
+	{
+		if (pOpPairs[i].count)
+			pairs[n++] = pOpPairs[i];
+	}
+	qsort(pairs, n, sizeof(*pairs), OpCount_ComparePairs);
+	return n;
+}
+
+
+/**
+ * Show given number of most executed handlers and pairs
+ */
+static void OpCount_Show(int count)
+{
+	opcount_pair_t *pairs = malloc(OPCOUNT_PAIRS * sizeof(*pairs));
+	Uint64 *counts = malloc(65536 * sizeof(*counts));
+	Uint16 *handlers = malloc(65536 * sizeof(*handlers));
+	Uint64 total;
+	int i, n;
+
+	if (!pairs || !counts || !handlers)
+	{
+		fprintf(stderr, "ERROR: allocation failed!\n");
+		goto out;
+	}
+
+	n = OpCount_SortHandlers(counts, handlers, &total);
+	fprintf(stderr, "%"PRIu64" instructions, %d opcode handlers used:\n", total, n);
+	for (i = 0; i < n && i < count; i++)
+	{
+		fprintf(stderr, "- $%04x %-8s %12"PRIu64" %5.2f%%\n", handlers[i],
+		        OpCount_Name(handlers[i]), counts[handlers[i]],
+		        100.0 * counts[handlers[i]] / total);
+	}
+
+	n = OpCount_SortPairs(pairs);
+	fprintf(stderr, "%"PRIu64" pairs sampled (%"PRIu64" dropped), %d different:\n",
+	        nPairsSampled, nPairsDropped, n);
+	for (i = 0; i < n && i < count; i++)
+	{
+		fprintf(stderr, "- $%04x %-8s $%04x %-8s %10u %5.2f%%\n",
+		        pairs[i].key >> 16, OpCount_Name(pairs[i].key >> 16),
+		        pairs[i].key & 0xffff, OpCount_Name(pairs[i].key & 0xffff),
+		        pairs[i].count, 100.0 * pairs[i].count / nPairsSampled);
+	}
+out:
+	free(handlers);
+	free(counts);
+	free(pairs);
+}
+
+
+/**
+ * Save handler counts in the gencpu "frequent.68k" format, followed
+ * by given number of most frequent handler pairs
+ */
+static void OpCount_Save(const char *name, int maxpairs)
+{
+	opcount_pair_t *pairs = malloc(OPCOUNT_PAIRS * sizeof(*pairs));
+	Uint64 *counts = malloc(65536 * sizeof(*counts));
+	Uint16 *handlers = malloc(65536 * sizeof(*handlers));
+	Uint64 total;
+	FILE *fp = NULL;
+	int i, n, nHandlers;
+
+	if (!pairs || !counts || !handlers)
+	{
+		fprintf(stderr, "ERROR: allocation failed!\n");
+		goto out;
+	}
+	if (File_Exists(name))
+	{
+		fprintf(stderr, "ERROR: file '%s' already exists!\n", name);
+		goto out;
+	}
+	fp = fopen(name, "w");
+	if (!fp)
+	{
+		fprintf(stderr, "ERROR: opening '%s' failed (%d).\n", name, errno);
+		goto out;
+	}
+
+	nHandlers = OpCount_SortHandlers(counts, handlers, &total);
+	fprintf(fp, "Total: %"PRIu64"\n", total);
+	for (i = 0; i < nHandlers; i++)
+		fprintf(fp, "%04x: %"PRIu64" %s\n", handlers[i], counts[handlers[i]],
+		        OpCount_Name(handlers[i]));
+
+	/* gencpu stops reading at this line */
+	n = OpCount_SortPairs(pairs);
+	fprintf(fp, "Pairs: %"PRIu64" sampled every %u\n", nPairsSampled, nPairInterval);
+	for (i = 0; i < n && i < maxpairs; i++)
+		fprintf(fp, "%04x %04x: %u %s %s\n", pairs[i].key >> 16, pairs[i].key & 0xffff,
+		        pairs[i].count, OpCount_Name(pairs[i].key >> 16),
+		        OpCount_Name(pairs[i].key & 0xffff));
+
+	if (fclose(fp) == 0)
+		fprintf(stderr, "%d opcode handlers and %d pairs saved to '%s'.\n",
+		        nHandlers, n < maxpairs ? n : maxpairs, name);
+	else
+		fprintf(stderr, "ERROR: writing '%s' failed (%d).\n", name, errno);
+out:
+	free(handlers);
+	free(counts);
+	free(pairs);
+}
+
+
+/*-----------------------------------------------------------------------*/
+
+const char OpCount_Description[] =
+	"on [interval]|off|<count>|save <file> [pairs]\n"
+	"\t'on' starts counting executed CPU opcodes from zero, and\n"
+	"\tsamples the pair of consecutive opcode handlers every\n"
+	"\t<interval> instructions (default 16). 'off' stops counting.\n"
+	"\tGiving just count shows that many most executed opcode handlers\n"
+	"\tand handler pairs. 'save' writes the handler counts in the\n"
+	"\t'frequent.68k' format read by gencpu (see its --counts option),\n"
+	"\tfollowed by the given number of most frequent pairs (default 256).";
+
+/**
+ * Readline match callback for opcodes command
+ */
+char *OpCount_Match(const char *text, int state)
+{
+	static const char* cmds[] = { "off", "on", "save" };
+	return DebugUI_MatchHelper(cmds, ARRAYSIZE(cmds), text, state);
+}
+
+/**
+ * Command: Count executed CPU opcodes and opcode pairs
+ */
+int OpCount_Parse(int nArgc, char *psArgs[])
+{
+	int count;
+
+	if (nArgc < 2) {
+		return DebugUI_PrintCmdHelp(psArgs[0]);
+	}
+	if (strcmp(psArgs[1], "on") == 0) {
+		count = nArgc > 2 ? atoi(psArgs[2]) : 0;
+		OpCount_Start(count > 0 ? count : OPCOUNT_INTERVAL);
+		return DEBUGGER_CMDDONE;
+	}
+	if (strcmp(psArgs[1], "off") == 0) {
+		bOpCounting = false;
+		return DEBUGGER_CMDDONE;
+	}
+	if (!pOpPairs) {
+		fprintf(stderr, "ERROR: no opcodes counted.\n");
+		return DEBUGGER_CMDDONE;
+	}
+	if (nArgc >= 3 && strcmp(psArgs[1], "save") == 0) {
+		count = nArgc > 3 ? atoi(psArgs[3]) : OPCOUNT_SAVE_PAIRS;
+		OpCount_Save(psArgs[2], count > 0 ? count : 0);
+		return DEBUGGER_CMDDONE;
+	}
+	count = atoi(psArgs[1]);
+	if (count > 0) {
+		OpCount_Show(count);
+		return DEBUGGER_CMDDONE;
+	}
+	return DebugUI_PrintCmdHelp(psArgs[0]);
+}
@@ -0,0 +1,24 @@
+/*
+  Hatari - opcount.h
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+*/
+
+#ifndef HATARI_OPCOUNT_H
+#define HATARI_OPCOUNT_H
+
+extern bool bOpCounting;
+
+static inline bool OpCount_Enabled(void)
+{
+	return bOpCounting;
+}
+
+/* for debugcpu.c */
+extern void OpCount_AddCpu(void);
+extern char *OpCount_Match(const char *text, int state);
+extern int OpCount_Parse(int nArgc, char *psArgs[]);
+extern const char OpCount_Description[];
+
+#endif
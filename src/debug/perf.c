@@ -0,0 +1,242 @@
+/*
+ * Hatari - perf.c
+ *
+ * This file is distributed under the GNU General Public License, version 2
+ * or at your option any later version. Read the file gpl.txt for details.
+ *
+ * perf.c - host time breakdown of the emulated frames
+ *
+ * When enabled, the DSP, CycInt handlers, screen conversion, sound
+ * generation and the libretro overlays and presentation mark the host
+ * time they take with Perf_Begin() / Perf_End(). These can nest, and time
+ * is only given to the innermost stage, the rest of the frame counts as
+ * CPU emulation. The stage times of the last PERF_FRAMES frames are kept,
+ * from which the debugger "info perf" command and the libretro on-screen
+ * message show percentiles, to tell which stage makes frames late.
+ */
+const char Perf_fileid[] = "Hatari perf.c : " __DATE__ " " __TIME__;
+
+#include "main.h"
+#include "perf.h"
+
+#define PERF_FRAMES	512	/* frames in the percentiles */
+#define PERF_DEPTH	8	/* nesting levels tracked */
+#define PERF_TOTAL	PERF_MAX	/* history index of the frame total */
+
+bool Perf_bEnabled;
+
+static perf_stage_t PerfStage;		/* stage host time goes to now */
+static perf_stage_t PerfStack[PERF_DEPTH];
+static int nPerfDepth;
+static Sint64 nPerfLast;		/* when time was last accounted */
+static Sint64 PerfCurrent[PERF_MAX];	/* ns per stage in current frame */
+
+/* microseconds per stage and in total, for the last frames */
+static Uint32 PerfHistory[PERF_FRAMES][PERF_MAX+1];
+static int nPerfNext;
+static int nPerfFrames;
+
+static const char * const PerfNames[PERF_MAX+1] = {
+	"CPU & other",
+	"DSP",
+	"CycInt handlers",
+	"Screen convert",
+	"Audio",
+	"Overlay",
+	"Presentation",
+	"Frame total"
+};
+
+static const char * const PerfShortNames[PERF_MAX+1] = {
+	"cpu", "dsp", "int", "scr", "snd", "ovl", "pres", "frame"
+};
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Give host time since previous call to the current stage
+ */
+static inline void Perf_Account(void)
+{
+	Sint64 now = Perf_GetNs();
+
+	PerfCurrent[PerfStage] += now - nPerfLast;
+	nPerfLast = now;
+}
+
+/**
+ * Switch to given stage, remembering the current one
+ */
+void Perf_Push(perf_stage_t stage)
+{
+	if (nPerfDepth++ < PERF_DEPTH)
+	{
+		Perf_Account();
+		PerfStack[nPerfDepth-1] = PerfStage;
+		PerfStage = stage;
+	}
+}
+
+/**
+ * Return to the stage active at the matching Perf_Push()
+ */
+void Perf_Pop(void)
+{
+	/* enabled between Perf_Begin() and Perf_End()? */
+	if (!nPerfDepth)
+		return;
+	if (--nPerfDepth < PERF_DEPTH)
+	{
+		Perf_Account();
+		PerfStage = PerfStack[nPerfDepth];
+	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Enable or disable timing. Collected times are cleared on enabling.
+ */
+void Perf_Enable(bool bEnable)
+{
+	if (bEnable && !Perf_bEnabled)
+	{
+		memset(PerfCurrent, 0, sizeof(PerfCurrent));
+		nPerfNext = nPerfFrames = 0;
+		nPerfDepth = 0;
+		PerfStage = PERF_CPU;
+		nPerfLast = Perf_GetNs();
+	}
+	Perf_bEnabled = bEnable;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Called when emulation of a frame starts after a wait for the host
+ * (frontend or VBL sync), which isn't accounted to any stage.
+ */
+void Perf_FrameStart(void)
+{
+	if (Perf_bEnabled)
+		nPerfLast = Perf_GetNs();
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Called when a frame is complete: add its stage times to the history.
+ */
+void Perf_FrameDone(void)
+{
+	Uint32 *pFrame;
+	Sint64 nTotal = 0;
+	int i;
+
+	if (!Perf_bEnabled)
+		return;
+
+	Perf_Account();
+	pFrame = PerfHistory[nPerfNext];
+	for (i = 0; i < PERF_MAX; i++)
+	{
+		pFrame[i] = PerfCurrent[i] / 1000;
+		nTotal += PerfCurrent[i];
+		PerfCurrent[i] = 0;
+	}
+	pFrame[PERF_TOTAL] = nTotal / 1000;
+
+	nPerfNext = (nPerfNext + 1) % PERF_FRAMES;
+	if (nPerfFrames < PERF_FRAMES)
+		nPerfFrames++;
+}
+
+
+/*-----------------------------------------------------------------------*/
+
+static int Perf_CompareUint32(const void *a, const void *b)
+{
+	Uint32 x = *(const Uint32 *)a, y = *(const Uint32 *)b;
+	return x < y ? -1 : x > y;
+}
+
+/**
+ * Sort the times of given stage in the history to 'sorted',
+ * return number of frames in it.
+ */
+static int Perf_SortStage(int stage, Uint32 *sorted)
+{
+	int i;
+
+	for (i = 0; i < nPerfFrames; i++)
+		sorted[i] = PerfHistory[i][stage];
+	qsort(sorted, nPerfFrames, sizeof(Uint32), Perf_CompareUint32);
+	return nPerfFrames;
+}
+
+/**
+ * Return given percentile from sorted times
+ */
+static Uint32 Perf_Percentile(const Uint32 *sorted, int count, int percent)
+{
+	if (!count)
+		return 0;
+	return sorted[(count - 1) * percent / 100];
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Write one line summary of the frame time percentiles, and the 95th
+ * percentile of each stage (that took any time), to given buffer.
+ * Return snprintf() result.
+ */
+int Perf_Summary(char *buf, size_t size)
+{
+	Uint32 sorted[PERF_FRAMES];
+	int i, count, len;
+
+	count = Perf_SortStage(PERF_TOTAL, sorted);
+	len = snprintf(buf, size, "frame us p50 %u p95 %u p99 %u, p95:",
+	               Perf_Percentile(sorted, count, 50),
+	               Perf_Percentile(sorted, count, 95),
+	               Perf_Percentile(sorted, count, 99));
+	for (i = 0; i < PERF_MAX && len >= 0 && (size_t)len < size; i++)
+	{
+		Perf_SortStage(i, sorted);
+		if ((count && sorted[count - 1]) || i == PERF_CPU)
+			len += snprintf(buf + len, size - len, " %s %u", PerfShortNames[i],
+			                Perf_Percentile(sorted, count, 95));
+	}
+	return len;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Show host time percentiles of the frame stages (for the debugger
+ * "info" command). Timing is enabled on first use.
+ */
+void Perf_Info(Uint32 dummy)
+{
+	Uint32 sorted[PERF_FRAMES];
+	int i, count;
+
+	if (!Perf_bEnabled)
+	{
+		Perf_Enable(true);
+		fprintf(stderr, "Frame timing enabled, available after next frame.\n");
+		return;
+	}
+	fprintf(stderr, "Host time per frame over last %d frames (us):\n", nPerfFrames);
+	fprintf(stderr, "  %-16s %8s %8s %8s %8s\n", "", "p50", "p95", "p99", "max");
+	for (i = 0; i <= PERF_MAX; i++)
+	{
+		count = Perf_SortStage(i, sorted);
+		fprintf(stderr, "- %-16s %8u %8u %8u %8u\n", PerfNames[i],
+		        Perf_Percentile(sorted, count, 50),
+		        Perf_Percentile(sorted, count, 95),
+		        Perf_Percentile(sorted, count, 99),
+		        Perf_Percentile(sorted, count, 100));
+	}
+}
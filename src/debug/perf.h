@@ -0,0 +1,63 @@
+/*
+  Hatari - perf.h
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+*/
+
+#ifndef HATARI_PERF_H
+#define HATARI_PERF_H
+
+/* stages between which the host time of a frame is split */
+typedef enum {
+	PERF_CPU,		/* everything not in the other stages */
+	PERF_DSP,
+	PERF_CYCINT,
+	PERF_SCREEN,
+	PERF_AUDIO,
+	PERF_OVERLAY,
+	PERF_PRESENT,
+	PERF_MAX
+} perf_stage_t;
+
+extern bool Perf_bEnabled;
+
+/**
+ * Return host time in nanoseconds. Many of the timed calls take less
+ * than a microsecond, so use the monotonic clock whenever it's available,
+ * not just when Time_GetTicks() does.
+ */
+static inline Sint64 Perf_GetNs(void)
+{
+#ifdef CLOCK_MONOTONIC
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (Sint64)now.tv_sec * 1000000000 + now.tv_nsec;
+#else
+	return Time_GetTicks() * 1000;
+#endif
+}
+
+extern void Perf_Push(perf_stage_t stage);
+extern void Perf_Pop(void);
+
+/* Host time until the matching Perf_End() goes to given stage */
+static inline void Perf_Begin(perf_stage_t stage)
+{
+	if (unlikely(Perf_bEnabled))
+		Perf_Push(stage);
+}
+
+static inline void Perf_End(void)
+{
+	if (unlikely(Perf_bEnabled))
+		Perf_Pop();
+}
+
+extern void Perf_Enable(bool bEnable);
+extern void Perf_FrameStart(void);
+extern void Perf_FrameDone(void);
+extern int Perf_Summary(char *buf, size_t size);
+extern void Perf_Info(Uint32 dummy);
+
+#endif
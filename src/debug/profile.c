@@ -497,7 +497,7 @@ char *Profile_Match(const char *text, int state)
 {
 	static const char *names[] = {
 		"addresses", "callers", "counts", "cycles", "loops", "misses",
-		"off", "on", "save", "stack", "stats", "symbols"
+		"off", "on", "sample", "save", "stack", "stats", "stream", "symbols"
 	};
 	return DebugUI_MatchHelper(names, ARRAYSIZE(names), text, state);
 }
@@ -508,6 +508,7 @@ const char Profile_Description[] =
 	"\tSubcommands:\n"
 	"\t- on\n"
 	"\t- off\n"
+	"\t- sample <cycles>\n"
 	"\t- counts [count]\n"
 	"\t- cycles [count]\n"
 	"\t- misses [count]\n"
@@ -517,12 +518,18 @@ const char Profile_Description[] =
 	"\t- stack\n"
 	"\t- stats\n"
 	"\t- save <file>\n"
+	"\t- stream [file] [VBLs]\n"
 	"\t- loops <file> [CPU limit] [DSP limit]\n"
 	"\n"
 	"\t'on' & 'off' enable and disable profiling.  Data is collected\n"
 	"\tuntil debugger is entered again at which point you get profiling\n"
 	"\tstatistics ('stats') summary.\n"
 	"\n"
+	"\tWith non-zero 'sample' interval, profiling only records the PC\n"
+	"\tevery given number of (CPU or DSP) cycles instead of profiling\n"
+	"\tevery instruction.  This runs at nearly full speed, but counts\n"
+	"\tare then sample counts and callers/loops info isn't collected.\n"
+	"\n"
 	"\tThen you can ask for list of the PC addresses, sorted either by\n"
 	"\texecution 'counts', used 'cycles' or cache 'misses'. First can\n"
 	"\tbe limited just to named addresses with 'symbols'.  Optional\n"
@@ -534,12 +541,19 @@ const char Profile_Description[] =
 	"\tspecify the starting address.\n"
 	"\n"
 	"\t'callers' shows (raw) caller information for addresses which\n"
-	"\thad symbol(s) associated with them.  'stack' shows the current\n"
-	"\tprofile stack (this is useful only with :noinit breakpoints).\n"
+	"\thad symbol(s) associated with them, and for DSP, DO loop costs.\n"
+	"\t'stack' shows the current profile stack (this is useful only\n"
+	"\twith :noinit breakpoints).\n"
 	"\n"
 	"\tProfile address and callers information can be saved with\n"
 	"\t'save' command.\n"
 	"\n"
+	"\tProfile data can also be streamed in callgrind format to\n"
+	"\tgiven file with 'stream'.  Costs collected during profiling are\n"
+	"\tappended to it and zeroed every given number of VBLs (default\n"
+	"\t50), so that profiles of long runs don't need to be kept in\n"
+	"\tmemory.  Without arguments, streaming is stopped.\n"
+	"\n"
 	"\tDetailed (spin) looping information can be collected by\n"
 	"\tspecifying to which file it should be saved, with optional\n"
 	"\tlimit(s) on how many bytes first and last instruction\n"
@@ -685,6 +699,23 @@ int Profile_Command(int nArgc, char *psArgs[], bool bForDsp)
 		*enabled = false;
 		fprintf(stderr, "Profiling disabled.\n");
 	
+	} else if (strcmp(psArgs[1], "sample") == 0) {
+		if (nArgc > 2 && atoi(psArgs[2]) >= 0) {
+			const char *proc = (bForDsp ? "DSP" : "CPU");
+			int cycles = atoi(psArgs[2]);
+			if (bForDsp) {
+				Profile_DspSetSampling(cycles);
+			} else {
+				Profile_CpuSetSampling(cycles);
+			}
+			if (cycles) {
+				fprintf(stderr, "%s profiling will sample PC every %d cycles.\n", proc, cycles);
+			} else {
+				fprintf(stderr, "%s profiling will profile every instruction.\n", proc);
+			}
+		} else {
+			DebugUI_PrintCmdHelp(psArgs[0]);
+		}
 	} else if (strcmp(psArgs[1], "stats") == 0) {
 		if (bForDsp) {
 			Profile_DspShowStats();
@@ -727,6 +758,29 @@ int Profile_Command(int nArgc, char *psArgs[], bool bForDsp)
 	} else if (strcmp(psArgs[1], "save") == 0) {
 		Profile_Save(psArgs[2], bForDsp);
 
+	} else if (strcmp(psArgs[1], "stream") == 0) {
+		const char *proc = (bForDsp ? "DSP" : "CPU");
+		if (nArgc > 2) {
+			int interval = (nArgc > 3 ? atoi(psArgs[3]) : 50);
+			bool ok;
+			if (interval < 1) {
+				interval = 1;
+			}
+			if (bForDsp) {
+				ok = Profile_DspStreamStart(psArgs[2], interval);
+			} else {
+				ok = Profile_CpuStreamStart(psArgs[2], interval);
+			}
+			if (ok) {
+				fprintf(stderr, "Streaming %s profile every %d VBLs to '%s'.\n",
+					proc, interval, psArgs[2]);
+			} else {
+				fprintf(stderr, "ERROR: opening '%s' for writing failed!\n", psArgs[2]);
+				perror(NULL);
+			}
+		} else if (bForDsp ? Profile_DspStreamStop() : Profile_CpuStreamStop()) {
+			fprintf(stderr, "%s profile streaming stopped.\n", proc);
+		}
 	} else if (strcmp(psArgs[1], "loops") == 0) {
 		Profile_Loops(nArgc, psArgs);
 
@@ -30,6 +30,7 @@ extern int Profile_Command(int nArgc, char *psArgs[], bool bForDsp);
 extern bool Profile_CpuStart(void);
 extern void Profile_CpuUpdate(void);
 extern void Profile_CpuStop(void);
+extern void Profile_CpuSample(void);
 
 /* CPU profile results */
 extern bool Profile_CpuAddressData(Uint32 addr, float *percentage, Uint32 *count, Uint32 *cycles, Uint32 *misses);
@@ -38,6 +39,7 @@ extern bool Profile_CpuAddressData(Uint32 addr, float *percentage, Uint32 *count
 extern bool Profile_DspStart(void);
 extern void Profile_DspUpdate(void);
 extern void Profile_DspStop(void);
+extern void Profile_DspSample(void);
 
 /* DSP profile results */
 extern bool Profile_DspAddressData(Uint16 addr, float *percentage, Uint64 *count, Uint64 *cycles, Uint16 *cycle_diff);
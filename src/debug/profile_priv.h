@@ -79,7 +79,13 @@ extern bool Profile_LoopReset(void);
 
 /* parser helpers */
 extern void Profile_CpuGetPointers(bool **enabled, Uint32 **disasm_addr);
+extern void Profile_CpuSetSampling(Uint32 cycles);
+extern bool Profile_CpuStreamStart(const char *filename, int interval);
+extern bool Profile_CpuStreamStop(void);
 extern void Profile_DspGetPointers(bool **enabled, Uint32 **disasm_addr);
+extern void Profile_DspSetSampling(Uint32 cycles);
+extern bool Profile_DspStreamStart(const char *filename, int interval);
+extern bool Profile_DspStreamStop(void);
 extern void Profile_CpuGetCallinfo(callinfo_t **callinfo, const char* (**get_symbol)(Uint32));
 extern void Profile_DspGetCallinfo(callinfo_t **callinfo, const char* (**get_symbol)(Uint32));
 
@@ -19,6 +19,7 @@ const char Profilecpu_fileid[] = "Hatari profilecpu.c : " __DATE__ " " __TIME__;
 #include "debugInfo.h"
 #include "dsp.h"
 #include "m68000.h"
+#include "cycInt.h"
 #include "68kDisass.h"
 #include "profile.h"
 #include "profile_priv.h"
@@ -27,6 +28,7 @@ const char Profilecpu_fileid[] = "Hatari profilecpu.c : " __DATE__ " " __TIME__;
 #include "tos.h"
 #include "screen.h"
 #include "video.h"
+#include "version.h"
 
 
 /* cartridge area */
@@ -65,11 +67,19 @@ typedef struct {
 
 #define MAX_MISS 4
 
+/* profile data items are allocated lazily in pages covering 64KB of
+ * instruction addresses, so that unused RAM & ROM areas don't take space
+ */
+#define CPU_PROFILE_PAGE_SHIFT	15
+#define CPU_PROFILE_PAGE_ITEMS	(1 << CPU_PROFILE_PAGE_SHIFT)
+#define CPU_PROFILE_PAGE_MASK	(CPU_PROFILE_PAGE_ITEMS - 1)
+
 static struct {
 	counters_t all;       /* total counts for all areas */
 	Uint32 miss_counts[MAX_MISS];  /* cache miss counts */
-	cpu_profile_item_t *data; /* profile data items */
-	Uint32 size;          /* number of allocated profile data items */
+	cpu_profile_item_t **pages; /* profile data item pages */
+	Uint32 pagecount;     /* number of page pointers */
+	Uint32 size;          /* number of profile data items */
 	profile_area_t ram;   /* normal RAM stats */
 	profile_area_t rom;   /* cartridge ROM stats */
 	profile_area_t tos;   /* ROM TOS stats */
@@ -82,10 +92,25 @@ static struct {
 	Uint32 loop_end;      /* address of last loop end */
 	Uint32 loop_count;    /* how many times it was looped */
 	Uint32 disasm_addr;   /* 'addresses' command start address */
+	Uint32 sample_cycles; /* PC sampling interval, zero when not sampling */
 	bool processed;	      /* true when data is already processed */
 	bool enabled;         /* true when profiling enabled */
 } cpu_profile;
 
+/* PC sampling interval set with "profile sample" for next profiling */
+static Uint32 cpu_sample_cycles;
+
+/* callgrind format profile streaming, see Profile_CpuStreamStart() */
+static struct {
+	FILE *fp;	/* output file, NULL when not streaming */
+	int interval;	/* VBLs between flushes */
+	int next_vbl;	/* VBL on which data is flushed next */
+	int parts;	/* how many parts have been flushed */
+} cpu_stream;
+
+/* returned for addresses which page isn't allocated */
+static const cpu_profile_item_t cpu_zero_item;
+
 /* special hack for EmuTOS */
 static Uint32 etos_switcher;
 
@@ -134,6 +159,49 @@ static inline Uint32 address2index(Uint32 pc)
 	return (pc >> 1);
 }
 
+/**
+ * Return profile data item for given index, allocate its page if needed.
+ */
+static inline cpu_profile_item_t *get_item(Uint32 idx)
+{
+	cpu_profile_item_t **page = &(cpu_profile.pages[idx >> CPU_PROFILE_PAGE_SHIFT]);
+
+	if (unlikely(!*page)) {
+		*page = calloc(CPU_PROFILE_PAGE_ITEMS, sizeof(cpu_profile_item_t));
+		assert(*page);
+	}
+	return *page + (idx & CPU_PROFILE_PAGE_MASK);
+}
+
+/**
+ * Return profile data item for given index for reading,
+ * zeroed item if its page isn't allocated.
+ */
+static inline const cpu_profile_item_t *peek_item(Uint32 idx)
+{
+	const cpu_profile_item_t *page = cpu_profile.pages[idx >> CPU_PROFILE_PAGE_SHIFT];
+
+	if (!page) {
+		return &cpu_zero_item;
+	}
+	return page + (idx & CPU_PROFILE_PAGE_MASK);
+}
+
+/**
+ * Free all profile data item pages.
+ */
+static void free_pages(void)
+{
+	Uint32 i;
+
+	for (i = 0; i < cpu_profile.pagecount; i++) {
+		free(cpu_profile.pages[i]);
+	}
+	free(cpu_profile.pages);
+	cpu_profile.pages = NULL;
+	cpu_profile.pagecount = 0;
+}
+
 /**
  * convert sorting array profile data index to Atari memory address.
  */
@@ -173,14 +241,14 @@ static Uint32 index2address(Uint32 idx)
  */
 bool Profile_CpuAddressData(Uint32 addr, float *percentage, Uint32 *count, Uint32 *cycles, Uint32 *misses)
 {
-	Uint32 idx;
-	if (!cpu_profile.data) {
+	const cpu_profile_item_t *item;
+	if (!cpu_profile.pages) {
 		return false;
 	}
-	idx = address2index(addr);
-	*misses = cpu_profile.data[idx].misses;
-	*cycles = cpu_profile.data[idx].cycles;
-	*count = cpu_profile.data[idx].count;
+	item = peek_item(address2index(addr));
+	*misses = item->misses;
+	*cycles = item->cycles;
+	*count = item->count;
 	if (cpu_profile.all.count) {
 		*percentage = 100.0*(*count)/cpu_profile.all.count;
 	} else {
@@ -229,6 +297,10 @@ static void show_cpu_area_stats(profile_area_t *area)
  */
 void Profile_CpuShowStats(void)
 {
+	if (cpu_profile.sample_cycles) {
+		fprintf(stderr, "PC sampled every %d cycles, instruction counts are sample counts.\n",
+			cpu_profile.sample_cycles);
+	}
 	fprintf(stderr, "Normal RAM (0-0x%X):\n", STRamEnd);
 	show_cpu_area_stats(&cpu_profile.ram);
 
@@ -261,12 +333,10 @@ Uint32 Profile_CpuShowAddresses(Uint32 lower, Uint32 upper, FILE *out)
 	int oldcols[DISASM_COLUMNS], newcols[DISASM_COLUMNS];
 	int show, shown, active;
 	const char *symbol;
-	cpu_profile_item_t *data;
 	Uint32 idx, end, size;
 	uaecptr nextpc, addr;
 
-	data = cpu_profile.data;
-	if (!data) {
+	if (!cpu_profile.pages) {
 		fprintf(stderr, "ERROR: no CPU profiling data available!\n");
 		return 0;
 	}
@@ -297,7 +367,7 @@ Uint32 Profile_CpuShowAddresses(Uint32 lower, Uint32 upper, FILE *out)
 	nextpc = 0;
 	idx = address2index(lower);
 	for (shown = 0; shown < show && idx < end; idx++) {
-		if (!data[idx].count) {
+		if (!peek_item(idx)->count) {
 			continue;
 		}
 		addr = index2address(idx);
@@ -344,8 +414,8 @@ static void leave_instruction_column(int *oldcols)
  */
 static int cmp_cpu_misses(const void *p1, const void *p2)
 {
-	Uint32 count1 = cpu_profile.data[*(const Uint32*)p1].misses;
-	Uint32 count2 = cpu_profile.data[*(const Uint32*)p2].misses;
+	Uint32 count1 = peek_item(*(const Uint32*)p1)->misses;
+	Uint32 count2 = peek_item(*(const Uint32*)p2)->misses;
 	if (count1 > count2) {
 		return -1;
 	}
@@ -363,7 +433,6 @@ void Profile_CpuShowMisses(int show)
 	int active;
 	int oldcols[DISASM_COLUMNS];
 	Uint32 *sort_arr, *end, addr, nextpc;
-	cpu_profile_item_t *data = cpu_profile.data;
 	float percentage;
 	Uint32 count;
 
@@ -382,7 +451,7 @@ void Profile_CpuShowMisses(int show)
 	show = (show < active ? show : active);
 	for (end = sort_arr + show; sort_arr < end; sort_arr++) {
 		addr = index2address(*sort_arr);
-		count = data[*sort_arr].misses;
+		count = peek_item(*sort_arr)->misses;
 		percentage = 100.0*count/cpu_profile.all.misses;
 		printf("0x%06x\t%5.2f%%\t%d%s\t", addr, percentage, count,
 		       count == MAX_CPU_PROFILE_VALUE ? " (OVERFLOW)" : "");
@@ -404,8 +473,8 @@ void Profile_CpuShowMisses(int show) {
  */
 static int cmp_cpu_cycles(const void *p1, const void *p2)
 {
-	Uint32 count1 = cpu_profile.data[*(const Uint32*)p1].cycles;
-	Uint32 count2 = cpu_profile.data[*(const Uint32*)p2].cycles;
+	Uint32 count1 = peek_item(*(const Uint32*)p1)->cycles;
+	Uint32 count2 = peek_item(*(const Uint32*)p2)->cycles;
 	if (count1 > count2) {
 		return -1;
 	}
@@ -423,11 +492,10 @@ void Profile_CpuShowCycles(int show)
 	int active;
 	int oldcols[DISASM_COLUMNS];
 	Uint32 *sort_arr, *end, addr, nextpc;
-	cpu_profile_item_t *data = cpu_profile.data;
 	float percentage;
 	Uint32 count;
 
-	if (!data) {
+	if (!cpu_profile.pages) {
 		fprintf(stderr, "ERROR: no CPU profiling data available!\n");
 		return;
 	}
@@ -442,7 +510,7 @@ void Profile_CpuShowCycles(int show)
 	show = (show < active ? show : active);
 	for (end = sort_arr + show; sort_arr < end; sort_arr++) {
 		addr = index2address(*sort_arr);
-		count = data[*sort_arr].cycles;
+		count = peek_item(*sort_arr)->cycles;
 		percentage = 100.0*count/cpu_profile.all.cycles;
 		printf("0x%06x\t%5.2f%%\t%d%s\t", addr, percentage, count,
 		       count == MAX_CPU_PROFILE_VALUE ? " (OVERFLOW)" : "");
@@ -459,8 +527,8 @@ void Profile_CpuShowCycles(int show)
  */
 static int cmp_cpu_count(const void *p1, const void *p2)
 {
-	Uint32 count1 = cpu_profile.data[*(const Uint32*)p1].count;
-	Uint32 count2 = cpu_profile.data[*(const Uint32*)p2].count;
+	Uint32 count1 = peek_item(*(const Uint32*)p1)->count;
+	Uint32 count2 = peek_item(*(const Uint32*)p2)->count;
 	if (count1 > count2) {
 		return -1;
 	}
@@ -477,7 +545,6 @@ static int cmp_cpu_count(const void *p1, const void *p2)
  */
 void Profile_CpuShowCounts(int show, bool only_symbols)
 {
-	cpu_profile_item_t *data = cpu_profile.data;
 	int symbols, matched, active;
 	int oldcols[DISASM_COLUMNS];
 	Uint32 *sort_arr, *end, addr, nextpc;
@@ -485,7 +552,7 @@ void Profile_CpuShowCounts(int show, bool only_symbols)
 	float percentage;
 	Uint32 count;
 
-	if (!data) {
+	if (!cpu_profile.pages) {
 		fprintf(stderr, "ERROR: no CPU profiling data available!\n");
 		return;
 	}
@@ -500,7 +567,7 @@ void Profile_CpuShowCounts(int show, bool only_symbols)
 		printf("addr:\t\tcount:\n");
 		for (end = sort_arr + show; sort_arr < end; sort_arr++) {
 			addr = index2address(*sort_arr);
-			count = data[*sort_arr].count;
+			count = peek_item(*sort_arr)->count;
 			percentage = 100.0*count/cpu_profile.all.count;
 			printf("0x%06x\t%5.2f%%\t%d%s\t",
 			       addr, percentage, count,
@@ -529,7 +596,7 @@ void Profile_CpuShowCounts(int show, bool only_symbols)
 		if (!name) {
 			continue;
 		}
-		count = data[*sort_arr].count;
+		count = peek_item(*sort_arr)->count;
 		percentage = 100.0*count/cpu_profile.all.count;
 		printf("0x%06x\t%5.2f%%\t%d\t%s%s\t",
 		       addr, percentage, count, name,
@@ -549,8 +616,7 @@ void Profile_CpuShowCounts(int show, bool only_symbols)
 
 static const char * addr2name(Uint32 addr, Uint64 *total)
 {
-	Uint32 idx = address2index(addr);
-	*total = cpu_profile.data[idx].count;
+	*total = peek_item(address2index(addr))->count;
 	return Symbols_GetByCpuAddress(addr);
 }
 
@@ -585,22 +651,209 @@ void Profile_CpuSave(FILE *out)
 	Profile_CpuShowCallers(out);
 }
 
+/* ------------------ CPU profile streaming ----------------- */
+
+/**
+ * Output callgrind function name for given address, unless
+ * it's the same function as for previous address.
+ */
+static void stream_fn(FILE *fp, Uint32 addr, Uint32 *prev_fn)
+{
+	const char *name;
+	Uint32 fn;
+
+	name = Symbols_GetBeforeCpuAddress(addr, &fn);
+	if (!name) {
+		/* no symbol, use the 64KB area */
+		fn = addr & 0xff0000;
+	}
+	if (fn == *prev_fn) {
+		return;
+	}
+	*prev_fn = fn;
+	if (name) {
+		fprintf(fp, "fn=%s\n", name);
+	} else {
+		fprintf(fp, "fn=0x%06x\n", fn);
+	}
+}
+
+/**
+ * Zero collected profile data in place.  Calls which haven't yet
+ * returned have the zeroed totals deducted from their start totals,
+ * so that their costs stay correct (unsigned wrap-around is fine).
+ */
+static void stream_reset(void)
+{
+	counters_t *all = &(cpu_profile.all);
+	callstack_t *stack;
+	caller_t *info;
+	Uint32 i;
+	int j;
+
+	for (i = 0; i < cpu_profile.pagecount; i++) {
+		if (cpu_profile.pages[i]) {
+			memset(cpu_profile.pages[i], 0, CPU_PROFILE_PAGE_ITEMS * sizeof(cpu_profile_item_t));
+		}
+	}
+	for (i = 0; i < (Uint32)cpu_callinfo.sites; i++) {
+		info = cpu_callinfo.site[i].callers;
+		for (j = 0; j < cpu_callinfo.site[i].count; j++, info++) {
+			info->calls = 0;
+			memset(&(info->all), 0, sizeof(info->all));
+			memset(&(info->own), 0, sizeof(info->own));
+		}
+	}
+	stack = cpu_callinfo.stack;
+	for (j = 0; j < cpu_callinfo.depth; j++, stack++) {
+		stack->all.calls -= all->calls;
+		stack->all.count -= all->count;
+		stack->all.cycles -= all->cycles;
+		stack->all.misses -= all->misses;
+	}
+	memset(all, 0, sizeof(*all));
+	memset(cpu_profile.miss_counts, 0, sizeof(cpu_profile.miss_counts));
+}
+
+/**
+ * Append current instruction costs and subroutine call costs
+ * as a callgrind part to the stream, optionally zeroing them.
+ */
+static void stream_flush(bool reset)
+{
+	FILE *fp = cpu_stream.fp;
+	const cpu_profile_item_t *page, *item;
+	const caller_t *info;
+	const callee_t *site;
+	const char *name;
+	Uint32 idx, addr, prev_fn = PC_UNDEFINED;
+	int i, j;
+
+	fprintf(fp, "\n# part %d, VBL %d\n", ++cpu_stream.parts, nVBLs);
+
+	for (idx = 0; idx < cpu_profile.size; idx++) {
+		page = cpu_profile.pages[idx >> CPU_PROFILE_PAGE_SHIFT];
+		if (!page) {
+			idx |= CPU_PROFILE_PAGE_MASK;
+			continue;
+		}
+		item = page + (idx & CPU_PROFILE_PAGE_MASK);
+		if (!item->count) {
+			continue;
+		}
+		addr = index2address(idx);
+		stream_fn(fp, addr, &prev_fn);
+		fprintf(fp, "0x%x %u %u\n", addr, item->count, item->cycles);
+	}
+
+	site = cpu_callinfo.site;
+	for (i = 0; i < cpu_callinfo.sites; i++, site++) {
+		if (!site->addr) {
+			continue;
+		}
+		info = site->callers;
+		for (j = 0; j < site->count && info->addr; j++, info++) {
+			/* only returned subroutine calls have costs */
+			if (!info->all.calls) {
+				continue;
+			}
+			stream_fn(fp, info->addr, &prev_fn);
+			name = Symbols_GetByCpuAddress(site->addr);
+			if (name) {
+				fprintf(fp, "cfn=%s\n", name);
+			} else {
+				fprintf(fp, "cfn=0x%06x\n", site->addr);
+			}
+			fprintf(fp, "calls=%"PRIu64" 0x%x\n", info->all.calls, site->addr);
+			fprintf(fp, "0x%x %"PRIu64" %"PRIu64"\n", info->addr, info->all.count, info->all.cycles);
+		}
+	}
+	fflush(fp);
+
+	if (reset) {
+		stream_reset();
+	}
+}
+
+/**
+ * Flush profile data to stream if it's time for that
+ */
+static inline void stream_check(void)
+{
+	if (unlikely(cpu_stream.fp) && nVBLs >= cpu_stream.next_vbl) {
+		cpu_stream.next_vbl = nVBLs + cpu_stream.interval;
+		stream_flush(true);
+	}
+}
+
+/**
+ * Start streaming CPU profile data in callgrind format to given file.
+ * Data collected during profiling is appended to it every given number
+ * of VBLs and zeroed, so that memory usage and counters stay bounded,
+ * and when profiling stops.  Return true for success.
+ */
+bool Profile_CpuStreamStart(const char *filename, int interval)
+{
+	Profile_CpuStreamStop();
+
+	cpu_stream.fp = fopen(filename, "w");
+	if (!cpu_stream.fp) {
+		return false;
+	}
+	cpu_stream.interval = interval;
+	cpu_stream.next_vbl = nVBLs + cpu_stream.interval;
+	cpu_stream.parts = 0;
+
+	fputs("# callgrind format\n", cpu_stream.fp);
+	fputs("version: 1\n", cpu_stream.fp);
+	fprintf(cpu_stream.fp, "creator: %s\n", PROG_NAME);
+	fputs("positions: instr\n", cpu_stream.fp);
+	fputs("events: Instructions Cycles\n", cpu_stream.fp);
+	if (cpu_sample_cycles) {
+		fprintf(cpu_stream.fp, "# PC sampled every %d cycles, instructions are samples\n",
+			cpu_sample_cycles);
+	}
+	return true;
+}
+
+/**
+ * Stop streaming CPU profile data.  Return true if it was streamed.
+ */
+bool Profile_CpuStreamStop(void)
+{
+	if (!cpu_stream.fp) {
+		return false;
+	}
+	fclose(cpu_stream.fp);
+	cpu_stream.fp = NULL;
+	return true;
+}
+
 /* ------------------ CPU profile control ----------------- */
 
 /**
- * Initialize CPU profiling when necessary.  Return true if profiling.
+ * Set CPU profiling PC sampling interval in cycles, zero to profile
+ * every instruction.  Takes effect when profiling is next started.
+ */
+void Profile_CpuSetSampling(Uint32 cycles)
+{
+	cpu_sample_cycles = cycles;
+}
+
+/**
+ * Initialize CPU profiling when necessary.  Return true if profiling
+ * needs Profile_CpuUpdate() to be called after every instruction.
  */
 bool Profile_CpuStart(void)
 {
 	int size;
 
 	Profile_FreeCallinfo(&(cpu_callinfo));
-	if (cpu_profile.sort_arr) {
+	if (cpu_profile.pages) {
 		/* remove previous results */
 		free(cpu_profile.sort_arr);
-		free(cpu_profile.data);
+		free_pages();
 		cpu_profile.sort_arr = NULL;
-		cpu_profile.data = NULL;
 		printf("Freed previous CPU profile buffers.\n");
 	}
 	if (!cpu_profile.enabled) {
@@ -613,14 +866,25 @@ bool Profile_CpuStart(void)
 	size = (STRamEnd + 0x20000 + TosSize) / 2;
 
 	/* Add one entry for catching invalid PC values */
-	cpu_profile.data = calloc(size + 1, sizeof(*cpu_profile.data));
-	if (!cpu_profile.data) {
+	cpu_profile.pagecount = (size + 1 + CPU_PROFILE_PAGE_MASK) >> CPU_PROFILE_PAGE_SHIFT;
+	cpu_profile.pages = calloc(cpu_profile.pagecount, sizeof(*cpu_profile.pages));
+	if (!cpu_profile.pages) {
 		perror("ERROR, new CPU profile buffer alloc failed");
+		cpu_profile.pagecount = 0;
 		return false;
 	}
-	printf("Allocated CPU profile buffer (%d MB).\n",
-	       (int)sizeof(*cpu_profile.data)*size/(1024*1024));
 	cpu_profile.size = size;
+	cpu_stream.next_vbl = nVBLs + cpu_stream.interval;
+
+	if (cpu_sample_cycles) {
+		/* no per-instruction updates, nor call/loop information */
+		cpu_profile.sample_cycles = cpu_sample_cycles;
+		printf("Sampling CPU PC every %d cycles.\n", cpu_sample_cycles);
+		CycInt_AddRelativeInterrupt(cpu_sample_cycles, INT_CPU_CYCLE, INTERRUPT_PROFILE_CPU);
+		cpu_profile.processed = false;
+		cpu_profile.enabled = true;
+		return false;
+	}
 
 	Profile_AllocCallinfo(&(cpu_callinfo), Symbols_CpuCount(), "CPU");
 
@@ -843,7 +1107,7 @@ void Profile_CpuUpdate(void)
 
 	idx = address2index(prev_pc);
 	assert(idx <= cpu_profile.size);
-	prev = cpu_profile.data + idx;
+	prev = get_item(idx);
 
 	if (likely(prev->count < MAX_CPU_PROFILE_VALUE)) {
 		prev->count++;
@@ -895,6 +1159,8 @@ void Profile_CpuUpdate(void)
 	counters->cycles += cycles;
 	counters->count++;
 
+	stream_check();
+
 #if DEBUG
 	if (unlikely(OpcodeFamily == 0)) {
 		Uint32 nextpc;
@@ -916,10 +1182,48 @@ void Profile_CpuUpdate(void)
 }
 
 
+/**
+ * Interrupt handler for sampling the CPU PC, accounts the whole
+ * sampling interval to the instruction at which it fired.
+ */
+void Profile_CpuSample(void)
+{
+	cpu_profile_item_t *item;
+	Uint32 idx, cycles;
+
+	CycInt_AcknowledgeInterrupt();
+	if (!cpu_profile.sample_cycles || cpu_profile.processed || !cpu_profile.enabled) {
+		/* e.g. restored from a memory snapshot */
+		return;
+	}
+	CycInt_AddRelativeInterrupt(cpu_profile.sample_cycles, INT_CPU_CYCLE, INTERRUPT_PROFILE_CPU);
+
+	idx = address2index(M68000_GetPC() & 0xffffff);
+	assert(idx <= cpu_profile.size);
+	item = get_item(idx);
+
+	/* cycles are based on 8Mhz clock, change them to correct one */
+	cycles = cpu_profile.sample_cycles << nCpuFreqShift;
+
+	if (likely(item->count < MAX_CPU_PROFILE_VALUE)) {
+		item->count++;
+	}
+	if (likely(item->cycles < MAX_CPU_PROFILE_VALUE - cycles)) {
+		item->cycles += cycles;
+	} else {
+		item->cycles = MAX_CPU_PROFILE_VALUE;
+	}
+	cpu_profile.all.cycles += cycles;
+	cpu_profile.all.count++;
+
+	stream_check();
+}
+
+
 /**
  * Helper for accounting CPU profile area item.
  */
-static void update_area_item(profile_area_t *area, Uint32 addr, cpu_profile_item_t *item)
+static void update_area_item(profile_area_t *area, Uint32 addr, const cpu_profile_item_t *item)
 {
 	Uint32 cycles = item->cycles;
 	Uint32 count = item->count;
@@ -947,17 +1251,22 @@ static void update_area_item(profile_area_t *area, Uint32 addr, cpu_profile_item
  */
 static Uint32 update_area(profile_area_t *area, Uint32 start, Uint32 end)
 {
-	cpu_profile_item_t *item;
+	const cpu_profile_item_t *page;
 	Uint32 addr;
 
 	memset(area, 0, sizeof(profile_area_t));
 	area->lowest = cpu_profile.size;
 
-	item = &(cpu_profile.data[start]);
-	for (addr = start; addr < end; addr++, item++) {
-		update_area_item(area, addr, item);
+	for (addr = start; addr < end; addr++) {
+		page = cpu_profile.pages[addr >> CPU_PROFILE_PAGE_SHIFT];
+		if (!page) {
+			/* skip to next page */
+			addr |= CPU_PROFILE_PAGE_MASK;
+			continue;
+		}
+		update_area_item(area, addr, page + (addr & CPU_PROFILE_PAGE_MASK));
 	}
-	return addr;
+	return end;
 }
 
 /**
@@ -965,12 +1274,16 @@ static Uint32 update_area(profile_area_t *area, Uint32 start, Uint32 end)
  */
 static Uint32* index_area(profile_area_t *area, Uint32 *sort_arr)
 {
-	cpu_profile_item_t *item;
+	const cpu_profile_item_t *page;
 	Uint32 addr;
 
-	item = &(cpu_profile.data[area->lowest]);
-	for (addr = area->lowest; addr <= area->highest; addr++, item++) {
-		if (item->count) {
+	for (addr = area->lowest; addr <= area->highest; addr++) {
+		page = cpu_profile.pages[addr >> CPU_PROFILE_PAGE_SHIFT];
+		if (!page) {
+			addr |= CPU_PROFILE_PAGE_MASK;
+			continue;
+		}
+		if (page[addr & CPU_PROFILE_PAGE_MASK].count) {
 			*sort_arr++ = addr;
 		}
 	}
@@ -986,6 +1299,9 @@ void Profile_CpuStop(void)
 	Uint32 *sort_arr, next;
 	int active;
 
+	if (cpu_profile.sample_cycles) {
+		CycInt_RemovePendingInterrupt(INTERRUPT_PROFILE_CPU);
+	}
 	if (cpu_profile.processed || !cpu_profile.enabled) {
 		return;
 	}
@@ -1000,6 +1316,11 @@ void Profile_CpuStop(void)
 
 	Profile_FinalizeCalls(&(cpu_callinfo), &(cpu_profile.all), Symbols_GetByCpuAddress);
 
+	/* rest of the data, it's zeroed anyway when profiling continues */
+	if (cpu_stream.fp) {
+		stream_flush(false);
+	}
+
 	/* find lowest and highest addresses executed etc */
 	next = update_area(&cpu_profile.ram, 0, STRamEnd/2);
 	next = update_area(&cpu_profile.tos, next, (STRamEnd + TosSize)/2);
@@ -1023,8 +1344,7 @@ void Profile_CpuStop(void)
 
 	if (!sort_arr) {
 		perror("ERROR: allocating CPU profile address data");
-		free(cpu_profile.data);
-		cpu_profile.data = NULL;
+		free_pages();
 		return;
 	}
 	printf("Allocated CPU profile address buffer (%d KB).\n",
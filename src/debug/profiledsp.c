@@ -16,6 +16,7 @@ const char Profiledsp_fileid[] = "Hatari profiledsp.c : " __DATE__ " " __TIME__;
 #include "main.h"
 #include "configuration.h"
 #include "clocks_timings.h"
+#include "cycInt.h"
 #include "dsp.h"
 #include "profile.h"
 #include "profile_priv.h"
@@ -23,12 +24,20 @@ const char Profiledsp_fileid[] = "Hatari profiledsp.c : " __DATE__ " " __TIME__;
 /* for VBL info */
 #include "screen.h"
 #include "video.h"
+#include "version.h"
 
 static callinfo_t dsp_callinfo;
 
 #define DSP_PROFILE_ARR_SIZE 0x10000
 #define MAX_DSP_PROFILE_VALUE 0xFFFFFFFFFFFFFFFFLL
 
+/* DSP runs at 4x the (8MHz) clock used for CPU cycle interrupts */
+#define DSP_SAMPLE_CLOCK_SHIFT 2
+
+/* how many different DO loops are tracked, and how deeply nested */
+#define DSP_MAX_LOOPS	256
+#define DSP_LOOP_DEPTH	8
+
 typedef struct {
 	Uint64 count;		/* how many times this address is used */
 	Uint64 cycles;		/* how many DSP cycles was taken at this address */
@@ -45,10 +54,51 @@ static struct {
 	Uint16 loop_end;      /* address of last loop end */
 	Uint32 loop_count;    /* how many times it was looped */
 	Uint32 disasm_addr;   /* 'dspaddresses' command start address */
+	Uint32 sample_cycles; /* PC sampling interval, zero when not sampling */
+	Uint32 *ssh;          /* DSP stack top register, i.e. return address */
 	bool processed;	      /* true when data is already processed */
 	bool enabled;         /* true when profiling enabled */
 } dsp_profile;
 
+/* PC sampling interval set with "dspprofile sample" for next profiling */
+static Uint32 dsp_sample_cycles;
+
+/* callgrind format profile streaming, see Profile_DspStreamStart() */
+static struct {
+	FILE *fp;	/* output file, NULL when not streaming */
+	int interval;	/* VBLs between flushes */
+	int next_vbl;	/* VBL on which data is flushed next */
+	int parts;	/* how many parts have been flushed */
+} dsp_stream;
+
+/* DO loop costs */
+typedef struct {
+	Uint16 addr;		/* address of the DO instruction */
+	Uint32 entries;		/* how many times loop was entered */
+	Uint64 iterations;	/* how many times loop body was executed */
+	Uint64 count;		/* instructions executed within the loop */
+	Uint64 cycles;		/* cycles used within the loop */
+} dsp_loop_t;
+
+/* currently executing DO loop */
+typedef struct {
+	int idx;		/* index of the loop in loops[] */
+	Uint16 sp;		/* stack pointer value within the loop */
+	Uint16 body;		/* loop body start address */
+	Uint64 count;		/* instruction count at loop start */
+	Uint64 cycles;		/* cycle count at loop start */
+} dsp_loop_active_t;
+
+static struct {
+	Uint32 *sp;		/* DSP stack pointer register */
+	Uint16 prev_sp;		/* stack pointer value for previous PC */
+	Uint16 *index;		/* DO address -> loops[] index + 1 */
+	dsp_loop_t *loops;	/* DO loop costs */
+	int count;		/* used loops[] items */
+	int depth;		/* number of active loops */
+	dsp_loop_active_t active[DSP_LOOP_DEPTH];
+} dsp_loops;
+
 
 /* ------------------ DSP profile results ----------------- */
 
@@ -85,6 +135,10 @@ bool Profile_DspAddressData(Uint16 addr, float *percentage, Uint64 *count, Uint6
 void Profile_DspShowStats(void)
 {
 	profile_area_t *area = &dsp_profile.ram;
+	if (dsp_profile.sample_cycles) {
+		fprintf(stderr, "PC sampled every %d cycles, instruction counts are sample counts.\n",
+			dsp_profile.sample_cycles);
+	}
 	fprintf(stderr, "DSP profile statistics (0x0-0xFFFF):\n");
 	if (!area->active) {
 		fprintf(stderr, "- no activity\n");
@@ -307,11 +361,42 @@ static const char * addr2name(Uint32 addr, Uint64 *total)
 }
 
 /**
- * Output DSP callers info to given file.
+ * Output DO loop costs to given file, as comments so that they
+ * don't confuse tools parsing the callers info before them.
+ */
+static void show_loops(FILE *fp)
+{
+	const dsp_loop_t *loop;
+	const char *name;
+	int i;
+
+	if (!dsp_loops.count) {
+		return;
+	}
+	fputs("# DO loops: <address>: <entries> <iterations> <instructions> <cycles>[ <symbol>]\n", fp);
+	loop = dsp_loops.loops;
+	for (i = 0; i < dsp_loops.count; i++, loop++) {
+		if (!loop->entries) {
+			continue;
+		}
+		fprintf(fp, "# 0x%04x: %u %"PRIu64" %"PRIu64" %"PRIu64,
+			loop->addr, loop->entries, loop->iterations,
+			loop->count, loop->cycles);
+		name = Symbols_GetByDspAddress(loop->addr);
+		if (name) {
+			fprintf(fp, " %s", name);
+		}
+		fputs("\n", fp);
+	}
+}
+
+/**
+ * Output DSP callers and DO loops info to given file.
  */
 void Profile_DspShowCallers(FILE *fp)
 {
 	Profile_ShowCallers(fp, dsp_callinfo.sites, dsp_callinfo.site, addr2name);
+	show_loops(fp);
 }
 
 /**
@@ -332,17 +417,247 @@ void Profile_DspSave(FILE *out)
 	Profile_DspShowCallers(out);
 }
 
+/* ------------------ DSP profile streaming ----------------- */
+
+/**
+ * Output callgrind function name for given address, unless
+ * it's the same function as for previous address.
+ */
+static void stream_fn(FILE *fp, Uint32 addr, Uint32 *prev_fn)
+{
+	const char *name;
+	Uint32 fn;
+
+	name = Symbols_GetBeforeDspAddress(addr, &fn);
+	if (!name) {
+		/* no symbol, use the 256 word area */
+		fn = addr & 0xff00;
+	}
+	if (fn == *prev_fn) {
+		return;
+	}
+	*prev_fn = fn;
+	if (name) {
+		fprintf(fp, "fn=%s\n", name);
+	} else {
+		fprintf(fp, "fn=0x%04x\n", fn);
+	}
+}
+
+/**
+ * Zero collected profile data in place.  Calls and loops which
+ * haven't yet returned have the zeroed totals deducted from their
+ * start totals, so that their costs stay correct (unsigned
+ * wrap-around is fine).
+ */
+static void stream_reset(void)
+{
+	counters_t *all = &(dsp_profile.ram.counters);
+	dsp_profile_item_t *item;
+	callstack_t *stack;
+	caller_t *info;
+	int i, j;
+
+	item = dsp_profile.data;
+	for (i = 0; i < DSP_PROFILE_ARR_SIZE; i++, item++) {
+		item->count = item->cycles = 0;
+		item->min_cycle = 0xFFFF;
+		item->max_cycle = 0;
+	}
+	for (i = 0; i < dsp_callinfo.sites; i++) {
+		info = dsp_callinfo.site[i].callers;
+		for (j = 0; j < dsp_callinfo.site[i].count; j++, info++) {
+			info->calls = 0;
+			memset(&(info->all), 0, sizeof(info->all));
+			memset(&(info->own), 0, sizeof(info->own));
+		}
+	}
+	stack = dsp_callinfo.stack;
+	for (j = 0; j < dsp_callinfo.depth; j++, stack++) {
+		stack->all.calls -= all->calls;
+		stack->all.count -= all->count;
+		stack->all.cycles -= all->cycles;
+		stack->all.misses -= all->misses;
+	}
+	for (i = 0; i < dsp_loops.count; i++) {
+		dsp_loops.loops[i].entries = 0;
+		dsp_loops.loops[i].iterations = 0;
+		dsp_loops.loops[i].count = 0;
+		dsp_loops.loops[i].cycles = 0;
+	}
+	for (j = 0; j < dsp_loops.depth; j++) {
+		dsp_loops.active[j].count -= all->count;
+		dsp_loops.active[j].cycles -= all->cycles;
+	}
+	memset(all, 0, sizeof(*all));
+}
+
+/**
+ * Append current instruction costs, subroutine call costs and
+ * DO loop costs as a callgrind part to the stream, optionally
+ * zeroing them.
+ */
+static void stream_flush(bool reset)
+{
+	FILE *fp = dsp_stream.fp;
+	const dsp_profile_item_t *item;
+	const caller_t *info;
+	const callee_t *site;
+	const char *name;
+	Uint32 addr, prev_fn = PC_UNDEFINED;
+	int i, j;
+
+	fprintf(fp, "\n# part %d, VBL %d\n", ++dsp_stream.parts, nVBLs);
+
+	item = dsp_profile.data;
+	for (addr = 0; addr < DSP_PROFILE_ARR_SIZE; addr++, item++) {
+		if (!item->count) {
+			continue;
+		}
+		stream_fn(fp, addr, &prev_fn);
+		fprintf(fp, "0x%x %"PRIu64" %"PRIu64"\n", addr, item->count, item->cycles);
+	}
+
+	site = dsp_callinfo.site;
+	for (i = 0; i < dsp_callinfo.sites; i++, site++) {
+		if (!site->addr) {
+			continue;
+		}
+		info = site->callers;
+		for (j = 0; j < site->count && info->addr; j++, info++) {
+			/* only returned subroutine calls have costs */
+			if (!info->all.calls) {
+				continue;
+			}
+			stream_fn(fp, info->addr, &prev_fn);
+			name = Symbols_GetByDspAddress(site->addr);
+			if (name) {
+				fprintf(fp, "cfn=%s\n", name);
+			} else {
+				fprintf(fp, "cfn=0x%04x\n", site->addr);
+			}
+			fprintf(fp, "calls=%"PRIu64" 0x%x\n", info->all.calls, site->addr);
+			fprintf(fp, "0x%x %"PRIu64" %"PRIu64"\n", info->addr, info->all.count, info->all.cycles);
+		}
+	}
+	show_loops(fp);
+	fflush(fp);
+
+	if (reset) {
+		stream_reset();
+	}
+}
+
+/**
+ * Flush profile data to stream if it's time for that
+ */
+static inline void stream_check(void)
+{
+	if (unlikely(dsp_stream.fp) && nVBLs >= dsp_stream.next_vbl) {
+		dsp_stream.next_vbl = nVBLs + dsp_stream.interval;
+		stream_flush(true);
+	}
+}
+
+/**
+ * Start streaming DSP profile data in callgrind format to given file.
+ * Data collected during profiling is appended to it every given number
+ * of VBLs and zeroed, and when profiling stops.  Return true for success.
+ */
+bool Profile_DspStreamStart(const char *filename, int interval)
+{
+	Profile_DspStreamStop();
+
+	dsp_stream.fp = fopen(filename, "w");
+	if (!dsp_stream.fp) {
+		return false;
+	}
+	dsp_stream.interval = interval;
+	dsp_stream.next_vbl = nVBLs + dsp_stream.interval;
+	dsp_stream.parts = 0;
+
+	fputs("# callgrind format\n", dsp_stream.fp);
+	fputs("version: 1\n", dsp_stream.fp);
+	fprintf(dsp_stream.fp, "creator: %s\n", PROG_NAME);
+	fputs("positions: instr\n", dsp_stream.fp);
+	fputs("events: Instructions Cycles\n", dsp_stream.fp);
+	if (dsp_sample_cycles) {
+		fprintf(dsp_stream.fp, "# PC sampled every %d cycles, instructions are samples\n",
+			dsp_sample_cycles);
+	}
+	return true;
+}
+
+/**
+ * Stop streaming DSP profile data.  Return true if it was streamed.
+ */
+bool Profile_DspStreamStop(void)
+{
+	if (!dsp_stream.fp) {
+		return false;
+	}
+	fclose(dsp_stream.fp);
+	dsp_stream.fp = NULL;
+	return true;
+}
+
 /* ------------------ DSP profile control ----------------- */
 
 /**
- * Initialize DSP profiling when necessary.  Return true if profiling.
+ * Set DSP profiling PC sampling interval in DSP cycles, zero to profile
+ * every instruction.  Takes effect when profiling is next started.
+ */
+void Profile_DspSetSampling(Uint32 cycles)
+{
+	/* round to interrupt clock granularity */
+	cycles = (cycles + (1 << DSP_SAMPLE_CLOCK_SHIFT) - 1) >> DSP_SAMPLE_CLOCK_SHIFT;
+	dsp_sample_cycles = cycles << DSP_SAMPLE_CLOCK_SHIFT;
+}
+
+/**
+ * Free DO loop tracking buffers.
+ */
+static void free_loops(void)
+{
+	free(dsp_loops.index);
+	free(dsp_loops.loops);
+	memset(&dsp_loops, 0, sizeof(dsp_loops));
+}
+
+/**
+ * Allocate DO loop tracking buffers.  Return true for success.
+ */
+static bool alloc_loops(void)
+{
+	Uint32 mask;
+
+	free_loops();
+	if (!DSP_GetRegisterAddress("SP", &dsp_loops.sp, &mask)) {
+		return false;
+	}
+	dsp_loops.index = calloc(DSP_PROFILE_ARR_SIZE, sizeof(*dsp_loops.index));
+	dsp_loops.loops = calloc(DSP_MAX_LOOPS, sizeof(*dsp_loops.loops));
+	if (!(dsp_loops.index && dsp_loops.loops)) {
+		perror("ERROR, DSP loop buffer alloc failed");
+		free_loops();
+		return false;
+	}
+	dsp_loops.prev_sp = *dsp_loops.sp & 0xF;
+	return true;
+}
+
+/**
+ * Initialize DSP profiling when necessary.  Return true if profiling
+ * needs Profile_DspUpdate() to be called after every instruction.
  */
 bool Profile_DspStart(void)
 {
 	dsp_profile_item_t *item;
+	Uint32 mask;
 	int i;
 
 	Profile_FreeCallinfo(&(dsp_callinfo));
+	free_loops();
 	if (dsp_profile.sort_arr) {
 		/* remove previous results */
 		free(dsp_profile.sort_arr);
@@ -365,12 +680,29 @@ bool Profile_DspStart(void)
 	printf("Allocated DSP profile buffer (%d KB).\n",
 	       (int)sizeof(*dsp_profile.data)*DSP_PROFILE_ARR_SIZE/1024);
 
-	Profile_AllocCallinfo(&(dsp_callinfo), Symbols_DspCount(), "DSP");
-
 	item = dsp_profile.data;
 	for (i = 0; i < DSP_PROFILE_ARR_SIZE; i++, item++) {
 		item->min_cycle = 0xFFFF;
 	}
+	dsp_stream.next_vbl = nVBLs + dsp_stream.interval;
+
+	if (dsp_sample_cycles) {
+		/* no per-instruction updates, nor call/loop information */
+		dsp_profile.sample_cycles = dsp_sample_cycles;
+		printf("Sampling DSP PC every %d cycles.\n", dsp_sample_cycles);
+		CycInt_AddRelativeInterrupt(dsp_sample_cycles >> DSP_SAMPLE_CLOCK_SHIFT,
+					    INT_CPU_CYCLE, INTERRUPT_PROFILE_DSP);
+		dsp_profile.processed = false;
+		dsp_profile.enabled = true;
+		return false;
+	}
+
+	Profile_AllocCallinfo(&(dsp_callinfo), Symbols_DspCount(), "DSP");
+	if (dsp_callinfo.sites) {
+		DSP_GetRegisterAddress("SSH", &dsp_profile.ssh, &mask);
+	}
+	alloc_loops();
+
 	dsp_profile.prev_pc = DSP_GetPC();
 
 	dsp_profile.loop_start = 0xFFFF;
@@ -394,6 +726,15 @@ static bool is_prev_instr(Uint16 prev_pc, Uint16 pc)
 	return false;
 }
 
+/* return true if given opcode is DO instruction */
+static bool is_do_opcode(Uint32 opcode)
+{
+	return ((opcode & 0xFF00F0) == 0x60080 ||	/* DO/ENDO 00000110 iiiiiiii 1000hhhh */
+		(opcode & 0xFFC0FF) == 0x6C000 ||	/* DO/ENDO 00000110 11DDDDDD 00000000 */
+		(opcode & 0xFFC0BF) == 0x64000 ||	/* DO/ENDO 00000110 01MMMRRR 0S000000 */
+		(opcode & 0xFFC0BF) == 0x60000);	/* DO/ENDO 00000110 00aaaaaa 0S000000 */
+}
+
 /* return branch type based on caller instruction type */
 static calltype_t dsp_opcode_type(Uint16 prev_pc, Uint16 pc)
 {
@@ -470,10 +811,7 @@ static calltype_t dsp_opcode_type(Uint16 prev_pc, Uint16 pc)
 	    (opcode & 0xFFC0FF) == 0x6C020 ||	/* REP  00000110 11dddddd 00100000 */
 	    (opcode & 0xFFC0BF) == 0x64020 ||	/* REP  00000110 01MMMRRR 0s100000 */
 	    (opcode & 0xFFC0BF) == 0x60020 ||	/* REP  00000110 00aaaaaa 0s100000 */
-	    (opcode & 0xFF00F0) == 0x60080 ||	/* DO/ENDO 00000110 iiiiiiii 1000hhhh */
-	    (opcode & 0xFFC0FF) == 0x6C000 ||	/* DO/ENDO 00000110 11DDDDDD 00000000 */
-	    (opcode & 0xFFC0BF) == 0x64000 ||	/* DO/ENDO 00000110 01MMMRRR 0S000000 */
-	    (opcode & 0xFFC0BF) == 0x60000) {	/* DO/ENDO 00000110 00aaaaaa 0S000000 */
+	    is_do_opcode(opcode)) {
 		return CALL_BRANCH;
 	}
 	if (is_prev_instr(prev_pc, pc)) {
@@ -520,7 +858,8 @@ static void collect_calls(Uint16 pc, counters_t *counters)
 
 		flag = dsp_opcode_type(prev_pc, pc);
 		if (flag == CALL_SUBROUTINE) {
-			dsp_callinfo.return_pc = DSP_GetNextPC(prev_pc);  /* slow! */
+			/* subroutine call pushed return address to stack top */
+			dsp_callinfo.return_pc = *dsp_profile.ssh & 0xFFFF;
 		} else if (caller_pc != PC_UNDEFINED) {
 			/* returned from function, change return
 			 * instruction address to address of
@@ -535,6 +874,84 @@ static void collect_calls(Uint16 pc, counters_t *counters)
 	}
 }
 
+/**
+ * Start tracking DO loop at given address, unless too many
+ * different or nested loops are already tracked.
+ */
+static void loop_start(Uint16 addr, Uint16 sp, counters_t *counters)
+{
+	dsp_loop_active_t *active;
+	int idx;
+
+	idx = dsp_loops.index[addr];
+	if (!idx) {
+		if (dsp_loops.count >= DSP_MAX_LOOPS) {
+			return;
+		}
+		dsp_loops.loops[dsp_loops.count].addr = addr;
+		idx = ++dsp_loops.count;
+		dsp_loops.index[addr] = idx;
+	}
+	if (dsp_loops.depth >= DSP_LOOP_DEPTH) {
+		return;
+	}
+	active = &(dsp_loops.active[dsp_loops.depth++]);
+	active->idx = idx - 1;
+	active->sp = sp;
+	/* DO instruction is 2 words */
+	active->body = addr + 2;
+	active->count = counters->count;
+	active->cycles = counters->cycles;
+	dsp_loops.loops[active->idx].entries++;
+	dsp_loops.loops[active->idx].iterations++;
+}
+
+/**
+ * Account costs for innermost active DO loop, which was exited.
+ */
+static void loop_end(counters_t *counters)
+{
+	dsp_loop_active_t *active;
+	dsp_loop_t *loop;
+
+	active = &(dsp_loops.active[--dsp_loops.depth]);
+	loop = &(dsp_loops.loops[active->idx]);
+	loop->count += counters->count - active->count;
+	loop->cycles += counters->cycles - active->cycles;
+}
+
+/**
+ * Track DO loop entries, iterations and exits based on hardware
+ * stack pointer changes.  DO pushes two items to the stack and
+ * loop exit (or ENDO) pops them.
+ */
+static void collect_loops(Uint16 prev_pc, Uint16 pc, counters_t *counters)
+{
+	const char *dummy;
+	Uint16 sp, prev_sp;
+
+	sp = *dsp_loops.sp & 0xF;
+	prev_sp = dsp_loops.prev_sp;
+
+	if (likely(sp == prev_sp)) {
+		/* jumped back to the loop body start? */
+		if (dsp_loops.depth && pc <= prev_pc &&
+		    pc == dsp_loops.active[dsp_loops.depth-1].body) {
+			dsp_loops.loops[dsp_loops.active[dsp_loops.depth-1].idx].iterations++;
+		}
+		return;
+	}
+	dsp_loops.prev_sp = sp;
+
+	while (dsp_loops.depth && sp < dsp_loops.active[dsp_loops.depth-1].sp) {
+		loop_end(counters);
+	}
+	if (sp == prev_sp + 2 &&
+	    is_do_opcode(DSP_ReadMemory(prev_pc, 'P', &dummy) & 0xFFFFFF)) {
+		loop_start(prev_pc, sp, counters);
+	}
+}
+
 /**
  * log last loop info, if there's suitable data for one
  */
@@ -611,6 +1028,45 @@ void Profile_DspUpdate(void)
 	 */
 	counters->cycles += cycles;
 	counters->count++;
+
+	if (dsp_loops.sp) {
+		collect_loops(prev_pc, pc, counters);
+	}
+	stream_check();
+}
+
+/**
+ * Interrupt handler for sampling the DSP PC, accounts the whole
+ * sampling interval to the instruction at which it fired.
+ */
+void Profile_DspSample(void)
+{
+	dsp_profile_item_t *item;
+	Uint32 cycles;
+
+	CycInt_AcknowledgeInterrupt();
+	if (!dsp_profile.sample_cycles || dsp_profile.processed || !dsp_profile.enabled) {
+		/* e.g. restored from a memory snapshot */
+		return;
+	}
+	cycles = dsp_profile.sample_cycles;
+	CycInt_AddRelativeInterrupt(cycles >> DSP_SAMPLE_CLOCK_SHIFT,
+				    INT_CPU_CYCLE, INTERRUPT_PROFILE_DSP);
+
+	item = dsp_profile.data + DSP_GetPC();
+
+	if (likely(item->count < MAX_DSP_PROFILE_VALUE)) {
+		item->count++;
+	}
+	if (likely(item->cycles < MAX_DSP_PROFILE_VALUE - cycles)) {
+		item->cycles += cycles;
+	} else {
+		item->cycles = MAX_DSP_PROFILE_VALUE;
+	}
+	dsp_profile.ram.counters.cycles += cycles;
+	dsp_profile.ram.counters.count++;
+
+	stream_check();
 }
 
 /**
@@ -657,6 +1113,9 @@ void Profile_DspStop(void)
 	Uint16 *sort_arr;
 	Uint32 addr;
 
+	if (dsp_profile.sample_cycles) {
+		CycInt_RemovePendingInterrupt(INTERRUPT_PROFILE_DSP);
+	}
 	if (dsp_profile.processed || !dsp_profile.enabled) {
 		return;
 	}
@@ -667,6 +1126,15 @@ void Profile_DspStop(void)
 	}
 
 	Profile_FinalizeCalls(&(dsp_callinfo), &(dsp_profile.ram.counters), Symbols_GetByDspAddress);
+	/* account loops which are still active */
+	while (dsp_loops.depth) {
+		loop_end(&(dsp_profile.ram.counters));
+	}
+
+	/* rest of the data, it's zeroed anyway when profiling continues */
+	if (dsp_stream.fp) {
+		stream_flush(false);
+	}
 
 	/* find lowest and highest  addresses executed */
 	area = &dsp_profile.ram;
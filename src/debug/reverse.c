@@ -0,0 +1,498 @@
+/*
+ * Hatari - reverse.c
+ *
+ * This file is distributed under the GNU General Public License, version 2
+ * or at your option any later version. Read the file gpl.txt for details.
+ *
+ * reverse.c - reverse execution support for the debugger.
+ *
+ * While enabled, emulation state is captured to a delta compressed
+ * checkpoint ring (see rewind.c) every given number of VBLs, and
+ * executed CPU instructions are counted.  Host input (IKBD state after
+ * host events have been processed and joystick reads) is journaled,
+ * so that it can be replayed as-is when emulation is re-executed.
+ *
+ * Stepping back restores the nearest checkpoint before the requested
+ * instruction and re-executes up to it.  Continuing back re-executes
+ * checkpoint intervals (newest first) looking for the last instruction
+ * where a CPU breakpoint condition matched, and then re-executes to it.
+ */
+const char Reverse_fileid[] = "Hatari reverse.c : " __DATE__ " " __TIME__;
+
+#include <inttypes.h>
+#include "main.h"
+#include "breakcond.h"
+#include "cycles.h"
+#include "debugui.h"
+#include "debug_priv.h"
+#include "ikbd.h"
+#include "m68000.h"
+#include "reverse.h"
+#include "rewind.h"
+#include "screen.h"
+#include "video.h"
+#include "68kDisass.h"
+
+#define REVERSE_INTERVAL_DEF	50	/* VBLs between checkpoints */
+#define REVERSE_POINTS_DEF	20	/* checkpoints kept */
+
+#define JOURNAL_IKBD	'K'	/* IKBD state after host events */
+#define JOURNAL_VALUE	'V'	/* value read from host */
+#define JOURNAL_IKBD_SIZE	(sizeof(Keyboard) + sizeof(KeyboardProcessor))
+
+typedef struct {
+	Uint64 insns;		/* instructions executed when taken */
+	Uint64 cycles;		/* CPU cycle counter then */
+	int input;		/* input journal position */
+} checkpoint_t;
+
+typedef enum {
+	REVERSE_RECORD,		/* normal emulation */
+	REVERSE_RUN,		/* re-executing to target */
+	REVERSE_SEARCH		/* re-executing interval up to target, for breakpoints */
+} reverse_mode_t;
+
+bool ReverseEnabled;
+
+static struct {
+	REWIND_RING *ring;
+	checkpoint_t *points;	/* oldest first, last is the latest ring state */
+	int count;
+	int max;
+	int interval;
+	int next_vbl;		/* when to take next checkpoint */
+	Uint64 insns;		/* instructions since reverse was enabled */
+	reverse_mode_t mode;
+	Uint64 target;
+	bool found;		/* REVERSE_SEARCH: breakpoint matched in interval */
+	Uint64 found_at;	/* last instruction where it matched */
+	Uint8 *journal;		/* host input journal */
+	int jsize;
+	int jalloc;
+	int jpos;		/* current journal position */
+} Reverse;
+
+
+/* ------------------ host input journal ------------------ */
+
+/**
+ * Return true if journaled input can be replayed for given entry type.
+ * If journal has something else, emulation has diverged from it, and
+ * the rest of the journal is discarded.
+ */
+static bool Reverse_JournalReplay(Uint8 type)
+{
+	if (Reverse.jpos >= Reverse.jsize) {
+		return false;
+	}
+	if (Reverse.journal[Reverse.jpos] == type) {
+		Reverse.jpos++;
+		return true;
+	}
+	fprintf(stderr, "WARNING: re-execution diverged from recorded input, discarding rest of it.\n");
+	Reverse.jsize = Reverse.jpos;
+	return false;
+}
+
+/**
+ * Reserve given amount of bytes at journal end for given entry type.
+ * Return pointer to them or NULL if there's no memory.
+ */
+static Uint8 *Reverse_JournalAdd(Uint8 type, int size)
+{
+	Uint8 *journal;
+	int alloc;
+
+	if (Reverse.jsize + 1 + size > Reverse.jalloc) {
+		alloc = 2 * Reverse.jalloc + 1 + size + 4096;
+		journal = realloc(Reverse.journal, alloc);
+		if (!journal) {
+			return NULL;
+		}
+		Reverse.journal = journal;
+		Reverse.jalloc = alloc;
+	}
+	journal = Reverse.journal + Reverse.jsize;
+	*journal++ = type;
+	Reverse.jsize += 1 + size;
+	Reverse.jpos = Reverse.jsize;
+	return journal;
+}
+
+/**
+ * Called after host events have been processed: record
+ * resulting IKBD input state, or replay recorded one.
+ */
+void Reverse_InputSync(void)
+{
+	Uint8 *data;
+
+	if (!ReverseEnabled) {
+		return;
+	}
+	if (Reverse_JournalReplay(JOURNAL_IKBD)) {
+		data = Reverse.journal + Reverse.jpos;
+		memcpy(&Keyboard, data, sizeof(Keyboard));
+		memcpy(&KeyboardProcessor, data + sizeof(Keyboard), sizeof(KeyboardProcessor));
+		Reverse.jpos += JOURNAL_IKBD_SIZE;
+		return;
+	}
+	data = Reverse_JournalAdd(JOURNAL_IKBD, JOURNAL_IKBD_SIZE);
+	if (data) {
+		memcpy(data, &Keyboard, sizeof(Keyboard));
+		memcpy(data + sizeof(Keyboard), &KeyboardProcessor, sizeof(KeyboardProcessor));
+	}
+}
+
+/**
+ * Called with value read from host input device: record
+ * and return it, or return recorded one.
+ */
+Uint32 Reverse_InputValue(Uint32 value)
+{
+	Uint8 *data;
+
+	if (!ReverseEnabled) {
+		return value;
+	}
+	if (Reverse_JournalReplay(JOURNAL_VALUE)) {
+		memcpy(&value, Reverse.journal + Reverse.jpos, sizeof(value));
+		Reverse.jpos += sizeof(value);
+		return value;
+	}
+	data = Reverse_JournalAdd(JOURNAL_VALUE, sizeof(value));
+	if (data) {
+		memcpy(data, &value, sizeof(value));
+	}
+	return value;
+}
+
+
+/* ------------------ checkpoints ------------------ */
+
+/**
+ * Free checkpoints & journal and disable reverse execution
+ */
+static void Reverse_Disable(void)
+{
+	Rewind_RingFree(Reverse.ring);
+	free(Reverse.points);
+	free(Reverse.journal);
+	memset(&Reverse, 0, sizeof(Reverse));
+	ReverseEnabled = false;
+}
+
+/**
+ * Take checkpoint of current emulation state.
+ * Return false on failure (reverse execution is then disabled).
+ */
+static bool Reverse_Checkpoint(void)
+{
+	int before = Rewind_RingCount(Reverse.ring);
+	int shift, i;
+
+	Reverse.next_vbl = nVBLs + Reverse.interval;
+	if (!Rewind_RingPush(Reverse.ring)) {
+		fprintf(stderr, "ERROR: taking reverse execution checkpoint failed, reverse disabled!\n");
+		Reverse_Disable();
+		return false;
+	}
+	if (Reverse.count && Rewind_RingCount(Reverse.ring) == before) {
+		/* oldest checkpoint dropped, and input journaled before next one */
+		Reverse.count--;
+		memmove(Reverse.points, Reverse.points + 1, Reverse.count * sizeof(checkpoint_t));
+		shift = Reverse.points[0].input;
+		memmove(Reverse.journal, Reverse.journal + shift, Reverse.jsize - shift);
+		Reverse.jsize -= shift;
+		Reverse.jpos -= shift;
+		for (i = 0; i < Reverse.count; i++) {
+			Reverse.points[i].input -= shift;
+		}
+	}
+	Reverse.points[Reverse.count].insns = Reverse.insns;
+	Reverse.points[Reverse.count].cycles = CyclesGlobalClockCounter;
+	Reverse.points[Reverse.count].input = Reverse.jpos;
+	Reverse.count++;
+	return true;
+}
+
+/**
+ * Return index of newest checkpoint taken at or before given instruction,
+ * or -1 if there's none.
+ */
+static int Reverse_FindCheckpoint(Uint64 insns)
+{
+	int i;
+
+	for (i = Reverse.count - 1; i >= 0; i--) {
+		if (Reverse.points[i].insns <= insns) {
+			break;
+		}
+	}
+	return i;
+}
+
+/**
+ * Restore given checkpoint, dropping the ones after it.
+ * Return false on failure (reverse execution is then disabled).
+ */
+static bool Reverse_Restore(int idx)
+{
+	while (Reverse.count - 1 > idx) {
+		Rewind_RingDrop(Reverse.ring);
+		Reverse.count--;
+	}
+	Reverse.mode = REVERSE_RECORD;
+	if (!Rewind_RingRestore(Reverse.ring)) {
+		fprintf(stderr, "ERROR: restoring reverse execution checkpoint failed, reverse disabled!\n");
+		Reverse_Disable();
+		return false;
+	}
+	Reverse.insns = Reverse.points[idx].insns;
+	Reverse.jpos = Reverse.points[idx].input;
+	Reverse.next_vbl = nVBLs + Reverse.interval;
+	return true;
+}
+
+/**
+ * Show where in the execution history emulation is now
+ */
+static void Reverse_ShowPosition(void)
+{
+	fprintf(stderr, "Reverse: at instruction %"PRIu64" (cycle %"PRIu64"):\n",
+		Reverse.insns, CyclesGlobalClockCounter);
+	Disasm(debugOutput, M68000_GetPC(), NULL, 1);
+}
+
+/**
+ * Restore checkpoint for given instruction and re-execute up to it.
+ * Return true if emulation needs to be continued for that.
+ */
+static bool Reverse_RunTo(Uint64 target)
+{
+	if (!Reverse_Restore(Reverse_FindCheckpoint(target))) {
+		return false;
+	}
+	if (Reverse.insns == target) {
+		Reverse_ShowPosition();
+		return false;
+	}
+	Reverse.mode = REVERSE_RUN;
+	Reverse.target = target;
+	return true;
+}
+
+/**
+ * Restore given checkpoint and start re-executing from it up to
+ * given instruction, searching for breakpoint hits.
+ */
+static bool Reverse_SearchFrom(int idx, Uint64 end)
+{
+	if (!Reverse_Restore(idx)) {
+		return false;
+	}
+	Reverse.found = BreakCond_CheckCpu();
+	Reverse.found_at = Reverse.insns;
+	Reverse.mode = REVERSE_SEARCH;
+	Reverse.target = end;
+	return true;
+}
+
+/**
+ * Searched interval was re-executed: go to the last breakpoint
+ * hit in it, or search the previous interval.
+ */
+static void Reverse_SearchDone(void)
+{
+	Uint64 end;
+
+	if (Reverse.found) {
+		if (Reverse_RunTo(Reverse.found_at)) {
+			return;
+		}
+		if (ReverseEnabled) {
+			DebugUI(REASON_CPU_BREAKPOINT);
+		}
+		return;
+	}
+	if (Reverse.count > 1) {
+		end = Reverse.points[Reverse.count - 1].insns;
+		Reverse_SearchFrom(Reverse.count - 2, end);
+		return;
+	}
+	if (Reverse_Restore(0)) {
+		fprintf(stderr, "Reverse: no breakpoint hits, stopped at the oldest checkpoint.\n");
+		Reverse_ShowPosition();
+		DebugUI(REASON_CPU_STEPS);
+	}
+}
+
+/**
+ * Called after each CPU instruction while reverse execution is enabled.
+ * Return true if emulation is being re-executed, i.e. other debugger
+ * checks (breakpoints, steps...) should be skipped for this instruction.
+ */
+bool Reverse_CpuUpdate(void)
+{
+	Reverse.insns++;
+
+	switch (Reverse.mode) {
+	case REVERSE_RECORD:
+		if (nVBLs >= Reverse.next_vbl) {
+			Reverse_Checkpoint();
+		}
+		return false;
+
+	case REVERSE_RUN:
+		if (nVBLs >= Reverse.next_vbl && !Reverse_Checkpoint()) {
+			return false;
+		}
+		if (Reverse.insns < Reverse.target) {
+			return true;
+		}
+		Reverse.mode = REVERSE_RECORD;
+		Reverse_ShowPosition();
+		DebugUI(REASON_CPU_STEPS);
+		return true;
+
+	case REVERSE_SEARCH:
+		if (Reverse.insns < Reverse.target) {
+			if (BreakCond_CheckCpu()) {
+				Reverse.found = true;
+				Reverse.found_at = Reverse.insns;
+			}
+			return true;
+		}
+		Reverse_SearchDone();
+		return true;
+	}
+	return false;
+}
+
+
+/* ------------------ debugger command ------------------ */
+
+/**
+ * Enable reverse execution with given checkpoint interval & count
+ */
+static void Reverse_Enable(int interval, int points)
+{
+	Reverse_Disable();
+
+	Reverse.ring = Rewind_RingCreate(points - 1);
+	Reverse.points = calloc(points, sizeof(checkpoint_t));
+	if (!(Reverse.ring && Reverse.points)) {
+		fprintf(stderr, "ERROR: reverse execution checkpoint allocation failed!\n");
+		Reverse_Disable();
+		return;
+	}
+	Reverse.max = points;
+	Reverse.interval = interval;
+	ReverseEnabled = true;
+	if (Reverse_Checkpoint()) {
+		fprintf(stderr, "Reverse execution enabled, checkpoint every %d VBLs, %d kept.\n",
+			interval, points);
+	}
+}
+
+/**
+ * Show reverse execution state
+ */
+static void Reverse_Info(void)
+{
+	if (!ReverseEnabled) {
+		fprintf(stderr, "Reverse execution is disabled.\n");
+		return;
+	}
+	fprintf(stderr, "Reverse execution: checkpoint every %d VBLs, %d/%d taken.\n",
+		Reverse.interval, Reverse.count, Reverse.max);
+	fprintf(stderr, "- oldest at instruction %"PRIu64" (cycle %"PRIu64")\n",
+		Reverse.points[0].insns, Reverse.points[0].cycles);
+	fprintf(stderr, "- latest at instruction %"PRIu64" (cycle %"PRIu64")\n",
+		Reverse.points[Reverse.count-1].insns, Reverse.points[Reverse.count-1].cycles);
+	fprintf(stderr, "- now at instruction %"PRIu64" (cycle %"PRIu64")\n",
+		Reverse.insns, CyclesGlobalClockCounter);
+	fprintf(stderr, "- %d bytes of input journaled, %d replayed.\n",
+		Reverse.jsize, Reverse.jpos);
+}
+
+const char Reverse_Description[] =
+	"on [VBLs [count]] | off | step [count] | cont\n"
+	"\t'on' starts taking checkpoints of the emulation state every given\n"
+	"\tnumber of VBLs (default 50), keeping given number of last ones\n"
+	"\t(default 20), and journaling host input.  'off' frees them.\n"
+	"\t'step' goes back given number of CPU instructions (default 1)\n"
+	"\tby restoring nearest earlier checkpoint and re-executing from it.\n"
+	"\t'cont' goes back to the last instruction where a (non-trace)\n"
+	"\tCPU breakpoint matched, or to the oldest checkpoint if none did.\n"
+	"\tWithout arguments, reverse execution state is shown.\n"
+	"\n"
+	"\tRe-execution is deterministic only if emulation state isn't\n"
+	"\tchanged from the debugger in between, DMA from host devices\n"
+	"\t(e.g. hard disk images) isn't journaled.";
+
+/**
+ * Readline callback
+ */
+char *Reverse_Match(const char *text, int state)
+{
+	static const char* cmds[] = { "cont", "off", "on", "step" };
+	return DebugUI_MatchHelper(cmds, ARRAYSIZE(cmds), text, state);
+}
+
+/**
+ * Command: reverse execution
+ */
+int Reverse_Parse(int nArgc, char *psArgs[])
+{
+	int interval, points, idx;
+	Uint64 steps;
+
+	if (nArgc < 2) {
+		Reverse_Info();
+		return DEBUGGER_CMDDONE;
+	}
+	if (strcmp(psArgs[1], "on") == 0) {
+		interval = (nArgc > 2 ? atoi(psArgs[2]) : REVERSE_INTERVAL_DEF);
+		points = (nArgc > 3 ? atoi(psArgs[3]) : REVERSE_POINTS_DEF);
+		if (interval < 1 || points < 2) {
+			fprintf(stderr, "ERROR: invalid checkpoint interval or count!\n");
+			return DEBUGGER_CMDDONE;
+		}
+		Reverse_Enable(interval, points);
+		return DEBUGGER_CMDDONE;
+	}
+	if (strcmp(psArgs[1], "off") == 0) {
+		Reverse_Disable();
+		fprintf(stderr, "Reverse execution disabled.\n");
+		return DEBUGGER_CMDDONE;
+	}
+	if (!ReverseEnabled) {
+		fprintf(stderr, "ERROR: reverse execution isn't enabled!\n");
+		return DEBUGGER_CMDDONE;
+	}
+	if (strcmp(psArgs[1], "step") == 0) {
+		steps = (nArgc > 2 ? strtoull(psArgs[2], NULL, 10) : 1);
+		if (!steps || steps > Reverse.insns - Reverse.points[0].insns) {
+			fprintf(stderr, "ERROR: can go back 1-%"PRIu64" instructions.\n",
+				Reverse.insns - Reverse.points[0].insns);
+			return DEBUGGER_CMDDONE;
+		}
+		if (Reverse_RunTo(Reverse.insns - steps)) {
+			return DEBUGGER_END;
+		}
+		return DEBUGGER_CMDDONE;
+	}
+	if (strcmp(psArgs[1], "cont") == 0) {
+		if (Reverse.insns == Reverse.points[0].insns) {
+			fprintf(stderr, "ERROR: already at the oldest checkpoint.\n");
+			return DEBUGGER_CMDDONE;
+		}
+		idx = Reverse_FindCheckpoint(Reverse.insns - 1);
+		if (Reverse_SearchFrom(idx, Reverse.insns)) {
+			return DEBUGGER_END;
+		}
+		return DEBUGGER_CMDDONE;
+	}
+	return DebugUI_PrintCmdHelp(psArgs[0]);
+}
@@ -0,0 +1,28 @@
+/*
+  Hatari - reverse.h
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+*/
+
+#ifndef HATARI_REVERSE_H
+#define HATARI_REVERSE_H
+
+extern bool ReverseEnabled;
+
+static inline bool Reverse_IsEnabled(void)
+{
+	return ReverseEnabled;
+}
+
+/* for debugcpu.c */
+extern bool Reverse_CpuUpdate(void);
+extern const char Reverse_Description[];
+extern char *Reverse_Match(const char *text, int state);
+extern int Reverse_Parse(int nArgc, char *psArgs[]);
+
+/* for host input handling (ikbd.c, joy.c, main.c) */
+extern void Reverse_InputSync(void);
+extern Uint32 Reverse_InputValue(Uint32 value);
+
+#endif
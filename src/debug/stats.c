@@ -0,0 +1,288 @@
+/*
+ * Hatari - stats.c
+ *
+ * This file is distributed under the GNU General Public License, version 2
+ * or at your option any later version. Read the file gpl.txt for details.
+ *
+ * stats.c - per-frame counters for the emulation hot paths
+ *
+ * When enabled, the CPU and DSP instruction loops, the CycInt handlers,
+ * IO intercepts, blitter, screen conversion and sound generation add
+ * their event counts to Stats_Current. These are flushed once per VBL
+ * to the last frame statistics, which the debugger "info stats" command
+ * and the libretro core log show. When disabled, the hot paths only pay
+ * for a well predicted test of Stats_bEnabled.
+ *
+ * When built with STATS_COUNT_ALLOCS (HEAP_STATS=1 in Makefile.libretro),
+ * the heap allocation functions are wrapped at link time and their calls
+ * counted too. After a warm-up, frames which still allocate are logged,
+ * as the emulation is supposed to run allocation-free in steady state.
+ */
+const char Stats_fileid[] = "Hatari stats.c : " __DATE__ " " __TIME__;
+
+#include <inttypes.h>
+#include "main.h"
+#include "log.h"
+#include "stats.h"
+
+/* frames after enabling in which allocations are expected */
+#define STATS_ALLOC_WARMUP	100
+
+bool Stats_bEnabled;
+STATS_FRAME Stats_Current;
+static STATS_FRAME StatsLast;
+/* sums since enabling, for benchmarks */
+static Uint64 StatsTotalCount[STATS_MAX];
+static Uint64 StatsTotalInterrupts[MAX_INTERRUPTS];
+static Uint32 StatsFrames;
+
+/* JSON keys for the counters, see Stats_WriteJson() */
+static const char * const StatsKeys[STATS_MAX] = {
+	"cpu_instructions",
+	"dsp_instructions",
+	"blitter_words",
+	"io_accesses",
+	"screen_lines",
+	"audio_samples",
+	"cycint_events",
+	"skipped_frames",
+	"host_usec",
+	"heap_allocs"
+};
+
+static const char * const StatsNames[STATS_MAX] = {
+	"CPU instructions",
+	"DSP instructions",
+	"Blitter words",
+	"IO accesses",
+	"Screen lines",
+	"Audio samples",
+	"CycInt events",
+	"Skipped frames",
+	"Host time (us)",
+	"Heap allocations"
+};
+
+static const char * const StatsIntNames[MAX_INTERRUPTS] = {
+	"null",
+	"VBL",
+	"HBL",
+	"end of line",
+	"MFP timer A",
+	"MFP timer B",
+	"MFP timer C",
+	"MFP timer D",
+	"ACIA IKBD",
+	"IKBD reset timer",
+	"IKBD autosend",
+	"DMA sound microwire",
+	"Crossbar 25MHz",
+	"Crossbar 32MHz",
+	"FDC",
+	"Blitter",
+	"MIDI",
+	"HDC",
+	"IDE",
+	"CPU profile",
+	"DSP profile"
+};
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Enable or disable counting. Counters are cleared on enabling.
+ */
+void Stats_Enable(bool bEnable)
+{
+	if (bEnable && !Stats_bEnabled)
+	{
+		memset(&Stats_Current, 0, sizeof(Stats_Current));
+		memset(&StatsLast, 0, sizeof(StatsLast));
+		memset(StatsTotalCount, 0, sizeof(StatsTotalCount));
+		memset(StatsTotalInterrupts, 0, sizeof(StatsTotalInterrupts));
+		StatsFrames = 0;
+	}
+	Stats_bEnabled = bEnable;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Called on each VBL: make the counts of the frame that just ended
+ * available and start a new frame.
+ */
+void Stats_VBL(void)
+{
+	int i;
+
+	if (!Stats_bEnabled)
+		return;
+	for (i = 0; i < STATS_MAX; i++)
+		StatsTotalCount[i] += Stats_Current.Count[i];
+	for (i = 0; i < MAX_INTERRUPTS; i++)
+		StatsTotalInterrupts[i] += Stats_Current.Interrupts[i];
+#ifdef STATS_COUNT_ALLOCS
+	if (Stats_Current.Count[STATS_HEAP_ALLOCS] && StatsFrames >= STATS_ALLOC_WARMUP)
+		Log_Printf(LOG_WARN, "%u heap allocations during frame %u of steady state\n",
+		           Stats_Current.Count[STATS_HEAP_ALLOCS], StatsFrames);
+#endif
+	StatsFrames++;
+	StatsLast = Stats_Current;
+	memset(&Stats_Current, 0, sizeof(Stats_Current));
+}
+
+
+#ifdef STATS_COUNT_ALLOCS
+/*-----------------------------------------------------------------------*/
+/**
+ * Heap function wrappers, see -Wl,--wrap in Makefile.libretro.
+ * The counter isn't atomic, calls from the sound and DSP threads
+ * can get lost, but any count tells that a frame allocated.
+ */
+extern void *__real_malloc(size_t size);
+extern void *__real_calloc(size_t nmemb, size_t size);
+extern void *__real_realloc(void *ptr, size_t size);
+extern char *__real_strdup(const char *s);
+
+void *__wrap_malloc(size_t size)
+{
+	Stats_Add(STATS_HEAP_ALLOCS, 1);
+	return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t nmemb, size_t size)
+{
+	Stats_Add(STATS_HEAP_ALLOCS, 1);
+	return __real_calloc(nmemb, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size)
+{
+	Stats_Add(STATS_HEAP_ALLOCS, 1);
+	return __real_realloc(ptr, size);
+}
+
+char *__wrap_strdup(const char *s)
+{
+	Stats_Add(STATS_HEAP_ALLOCS, 1);
+	return __real_strdup(s);
+}
+#endif
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return counters of the last complete frame.
+ */
+const STATS_FRAME *Stats_GetLastFrame(void)
+{
+	return &StatsLast;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Find the IO block with most accesses in the last frame.
+ */
+static int Stats_BusiestIoBlock(void)
+{
+	int i, nBest = 0;
+
+	for (i = 1; i < STATS_IO_BLOCKS; i++)
+	{
+		if (StatsLast.IoBlocks[i] > StatsLast.IoBlocks[nBest])
+			nBest = i;
+	}
+	return nBest;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Write one line summary of the last frame to given buffer.
+ * Return snprintf() result.
+ */
+int Stats_Summary(char *buf, size_t size)
+{
+	const Uint32 *cnt = StatsLast.Count;
+	int nBlock = Stats_BusiestIoBlock();
+
+	return snprintf(buf, size, "cpu %u dsp %u blit %u io %u (max %u @ $%06x)"
+	                " lines %u samples %u cycint %u (hbl %u, timers %u)"
+	                " skip %u host %uus",
+	                cnt[STATS_CPU_INSTR], cnt[STATS_DSP_INSTR],
+	                cnt[STATS_BLITTER_WORDS], cnt[STATS_IO_ACCESSES],
+	                StatsLast.IoBlocks[nBlock], 0xff8000 + (nBlock << 8),
+	                cnt[STATS_SCREEN_LINES], cnt[STATS_AUDIO_SAMPLES],
+	                cnt[STATS_INTERRUPTS], StatsLast.Interrupts[INTERRUPT_VIDEO_HBL],
+	                StatsLast.Interrupts[INTERRUPT_MFP_TIMERA] +
+	                StatsLast.Interrupts[INTERRUPT_MFP_TIMERB] +
+	                StatsLast.Interrupts[INTERRUPT_MFP_TIMERC] +
+	                StatsLast.Interrupts[INTERRUPT_MFP_TIMERD],
+	                cnt[STATS_SKIPPED_FRAMES], cnt[STATS_HOST_USEC]);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Show counters of the last frame (for the debugger "info" command).
+ * Counting is enabled on first use.
+ */
+void Stats_Info(Uint32 dummy)
+{
+	int i;
+
+	if (!Stats_bEnabled)
+	{
+		Stats_Enable(true);
+		fprintf(stderr, "Frame statistics enabled, available after next VBL.\n");
+		return;
+	}
+	fprintf(stderr, "Last frame:\n");
+	for (i = 0; i < STATS_MAX; i++)
+		fprintf(stderr, "- %-18s: %u\n", StatsNames[i], StatsLast.Count[i]);
+
+	fprintf(stderr, "CycInt events:\n");
+	for (i = 0; i < MAX_INTERRUPTS; i++)
+	{
+		if (StatsLast.Interrupts[i])
+			fprintf(stderr, "- %-18s: %u\n", StatsIntNames[i], StatsLast.Interrupts[i]);
+	}
+
+	fprintf(stderr, "IO accesses:\n");
+	for (i = 0; i < STATS_IO_BLOCKS; i++)
+	{
+		if (StatsLast.IoBlocks[i])
+			fprintf(stderr, "- $%06x-$%06x : %u\n", 0xff8000 + (i << 8),
+			        0xff80ff + (i << 8), StatsLast.IoBlocks[i]);
+	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Write the counters summed over all frames since counting was enabled
+ * to given file, as members of a JSON object (for benchmarks).
+ */
+void Stats_WriteJson(FILE *fp)
+{
+	int i;
+
+	fprintf(fp, "  \"stats_frames\": %u,\n  \"counters\": {", StatsFrames);
+	for (i = 0; i < STATS_MAX; i++)
+		fprintf(fp, "%s\n    \"%s\": %"PRIu64, i ? "," : "", StatsKeys[i], StatsTotalCount[i]);
+	fprintf(fp, "\n  },\n  \"cycint\": {");
+	for (i = 1; i < MAX_INTERRUPTS; i++)
+		fprintf(fp, "%s\n    \"%s\": %"PRIu64, i > 1 ? "," : "", StatsIntNames[i], StatsTotalInterrupts[i]);
+	fprintf(fp, "\n  }");
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return name of given CycInt interrupt (also for the timeline).
+ */
+const char *Stats_InterruptName(interrupt_id id)
+{
+	return StatsIntNames[id];
+}
@@ -0,0 +1,72 @@
+/*
+  Hatari - stats.h
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+*/
+
+#ifndef HATARI_STATS_H
+#define HATARI_STATS_H
+
+#include "cycInt.h"
+
+/* per-frame event counters */
+typedef enum {
+	STATS_CPU_INSTR,
+	STATS_DSP_INSTR,
+	STATS_BLITTER_WORDS,
+	STATS_IO_ACCESSES,
+	STATS_SCREEN_LINES,
+	STATS_AUDIO_SAMPLES,
+	STATS_INTERRUPTS,
+	STATS_SKIPPED_FRAMES,
+	STATS_HOST_USEC,
+	STATS_HEAP_ALLOCS,		/* only with STATS_COUNT_ALLOCS */
+	STATS_MAX
+} stats_id_t;
+
+/* IO intercept calls are counted in 256 byte blocks of 0xff8000-0xffffff */
+#define STATS_IO_BLOCKS	128
+
+typedef struct {
+	Uint32 Count[STATS_MAX];
+	Uint32 Interrupts[MAX_INTERRUPTS];
+	Uint32 IoBlocks[STATS_IO_BLOCKS];
+} STATS_FRAME;
+
+extern bool Stats_bEnabled;
+extern STATS_FRAME Stats_Current;
+
+static inline void Stats_Add(stats_id_t id, Uint32 n)
+{
+	if (unlikely(Stats_bEnabled))
+		Stats_Current.Count[id] += n;
+}
+
+static inline void Stats_AddInterrupt(interrupt_id id)
+{
+	if (unlikely(Stats_bEnabled))
+	{
+		Stats_Current.Count[STATS_INTERRUPTS]++;
+		Stats_Current.Interrupts[id]++;
+	}
+}
+
+static inline void Stats_AddIo(Uint32 addr)
+{
+	if (unlikely(Stats_bEnabled))
+	{
+		Stats_Current.Count[STATS_IO_ACCESSES]++;
+		Stats_Current.IoBlocks[((addr - 0xff8000) >> 8) & (STATS_IO_BLOCKS-1)]++;
+	}
+}
+
+extern void Stats_Enable(bool bEnable);
+extern void Stats_VBL(void);
+extern const STATS_FRAME *Stats_GetLastFrame(void);
+extern int Stats_Summary(char *buf, size_t size);
+extern void Stats_Info(Uint32 dummy);
+extern void Stats_WriteJson(FILE *fp);
+extern const char *Stats_InterruptName(interrupt_id id);
+
+#endif
@@ -43,6 +43,12 @@ typedef struct {
 	int symbols;		/* initial symbol count */
 	symbol_t *addresses;	/* items sorted by address */
 	symbol_t *names;	/* items sorted by symbol name */
+	/* indexes built after sorting, for large symbol tables */
+	Uint32 hashmask;	/* hash table size - 1 */
+	int *addr_hash;		/* address -> addresses[] index + 1 */
+	int *name_hash;		/* name -> names[] index + 1 */
+	int codecount;
+	int *code;		/* addresses[] indexes of TEXT symbols */
 } symbol_list_t;
 
 typedef struct {
@@ -106,6 +112,79 @@ static int symbols_by_name(const void *s1, const void *s2)
 }
 
 
+/**
+ * Hash functions for the address & name indexes
+ */
+static inline Uint32 symbols_hash_address(Uint32 addr)
+{
+	return (addr * 2654435761u) >> 7;
+}
+static Uint32 symbols_hash_name(const char *name)
+{
+	Uint32 hash = 2166136261u;
+	while (*name) {
+		hash ^= (unsigned char)*name++;
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+/**
+ * Build hash indexes for symbol address & name lookups, and an
+ * index of the code symbols for resolving any address to the
+ * function containing it.  Lists need to be sorted already.
+ * Return false if there's not enough memory for them.
+ */
+static bool symbols_build_index(symbol_list_t *list)
+{
+	Uint32 size, h;
+	int i;
+
+	for (size = 16; size < 2 * (Uint32)list->count; size <<= 1)
+		;
+	list->hashmask = size - 1;
+	list->addr_hash = calloc(size, sizeof(int));
+	list->name_hash = calloc(size, sizeof(int));
+	list->code = malloc(list->count * sizeof(int));
+	if (!(list->addr_hash && list->name_hash && list->code)) {
+		return false;
+	}
+	list->codecount = 0;
+	for (i = 0; i < list->count; i++) {
+		/* with duplicate addresses, first one is found */
+		h = symbols_hash_address(list->addresses[i].address) & list->hashmask;
+		while (list->addr_hash[h] && list->addresses[list->addr_hash[h]-1].address != list->addresses[i].address) {
+			h = (h + 1) & list->hashmask;
+		}
+		if (!list->addr_hash[h]) {
+			list->addr_hash[h] = i + 1;
+		}
+		/* same names are all added, they can differ by type */
+		h = symbols_hash_name(list->names[i].name) & list->hashmask;
+		while (list->name_hash[h]) {
+			h = (h + 1) & list->hashmask;
+		}
+		list->name_hash[h] = i + 1;
+
+		if (list->addresses[i].type == SYMTYPE_TEXT) {
+			list->code[list->codecount++] = i;
+		}
+	}
+	return true;
+}
+
+/**
+ * Free symbol lookup indexes
+ */
+static void symbols_free_index(symbol_list_t *list)
+{
+	free(list->addr_hash);
+	free(list->name_hash);
+	free(list->code);
+	list->addr_hash = list->name_hash = list->code = NULL;
+	list->codecount = 0;
+}
+
 /**
  * Allocate symbol list & names for given number of items.
  * Return allocated list or NULL on failure.
@@ -550,6 +629,15 @@ static symbol_list_t* Symbols_Load(const char *filename, Uint32 *offsets, Uint32
 	qsort(list->addresses, list->count, sizeof(symbol_t), symbols_by_address);
 	qsort(list->names, list->count, sizeof(symbol_t), symbols_by_name);
 
+	if (!symbols_build_index(list)) {
+		/* lookups fall back to bisecting the sorted lists */
+		fprintf(stderr, "WARNING: not enough memory for symbol lookup indexes!\n");
+		symbols_free_index(list);
+	}
+
+	/* expressions with symbols need to be re-parsed */
+	Eval_FlushCache();
+
 	fprintf(stderr, "Loaded %d symbols from '%s'.\n", list->count, filename);
 	return list;
 }
@@ -569,6 +657,7 @@ static void Symbols_Free(symbol_list_t* list)
 	for (i = 0; i < list->count; i++) {
 		free(list->names[i].name);
 	}
+	symbols_free_index(list);
 	free(list->addresses);
 	free(list->names);
 
@@ -577,6 +666,8 @@ static void Symbols_Free(symbol_list_t* list)
 	list->names = NULL;
 	list->count = 0;
 	free(list);
+
+	Eval_FlushCache();
 }
 
 
@@ -591,26 +682,35 @@ static char* Symbols_MatchByName(symbol_list_t* list, symtype_t symtype, const c
 {
 	static int i, len;
 	const symbol_t *entry;
+	int l, r, m;
 	
 	if (!list) {
 		return NULL;
 	}
 
+	entry = list->names;
 	if (!state) {
-		/* first match */
+		/* first match, bisect first name not sorting before text */
 		len = strlen(text);
-		i = 0;
+		l = 0;
+		r = list->count;
+		while (l < r) {
+			m = (l+r) >> 1;
+			if (strncmp(entry[m].name, text, len) < 0) {
+				l = m+1;
+			} else {
+				r = m;
+			}
+		}
+		i = l;
 	}
 
-	/* next match */
-	entry = list->names;
-	while (i < list->count) {
-		if ((entry[i].type & symtype) &&
-		    strncmp(entry[i].name, text, len) == 0) {
+	/* next match, matches are consecutive in name order */
+	while (i < list->count && strncmp(entry[i].name, text, len) == 0) {
+		if (entry[i].type & symtype) {
 			return strdup(entry[i++].name);
-		} else {
-			i++;
 		}
+		i++;
 	}
 	return NULL;
 }
@@ -669,6 +769,18 @@ static const symbol_t* Symbols_SearchByName(symbol_list_t* list, symtype_t symty
 	}
 	entries = list->names;
 
+	if (list->name_hash) {
+		Uint32 h = symbols_hash_name(name) & list->hashmask;
+		while ((m = list->name_hash[h])) {
+			m--;
+			if ((entries[m].type & symtype) && strcmp(entries[m].name, name) == 0) {
+				return &(entries[m]);
+			}
+			h = (h + 1) & list->hashmask;
+		}
+		return NULL;
+	}
+
 	/* bisect */
 	l = 0;
 	r = list->count - 1;
@@ -734,6 +846,17 @@ static int Symbols_SearchByAddress(symbol_list_t* list, Uint32 addr)
 	}
 	entries = list->addresses;
 
+	if (list->addr_hash) {
+		Uint32 h = symbols_hash_address(addr) & list->hashmask;
+		while ((m = list->addr_hash[h])) {
+			if (entries[m-1].address == addr) {
+				return m-1;
+			}
+			h = (h + 1) & list->hashmask;
+		}
+		return -1;
+	}
+
 	/* bisect */
 	l = 0;
 	r = list->count - 1;
@@ -779,6 +902,82 @@ const char* Symbols_GetByDspAddress(Uint32 addr)
 	return DspSymbolsList->addresses[idx].name;
 }
 
+/**
+ * Search code (TEXT) symbol at or before given address from given list,
+ * i.e. the function the address most likely belongs to.
+ * Return symbol name and set its address, or return NULL if none.
+ */
+static const char* Symbols_SearchBeforeAddress(symbol_list_t *list, Uint32 addr, Uint32 *symaddr)
+{
+	symbol_t *entries;
+	const int *code;
+	int l, r, m;
+
+	if (!list) {
+		return NULL;
+	}
+	entries = list->addresses;
+
+	code = list->code;
+	if (code) {
+		/* bisect last code symbol with address <= addr */
+		l = 0;
+		r = list->codecount - 1;
+		while (l <= r) {
+			m = (l+r) >> 1;
+			if (entries[code[m]].address > addr) {
+				r = m-1;
+			} else {
+				l = m+1;
+			}
+		}
+		if (r < 0) {
+			return NULL;
+		}
+		*symaddr = entries[code[r]].address;
+		return entries[code[r]].name;
+	}
+
+	/* bisect last symbol with address <= addr */
+	l = 0;
+	r = list->count - 1;
+	while (l <= r) {
+		m = (l+r) >> 1;
+		if (entries[m].address > addr) {
+			r = m-1;
+		} else {
+			l = m+1;
+		}
+	}
+	for (; r >= 0; r--) {
+		if (entries[r].type == SYMTYPE_TEXT) {
+			*symaddr = entries[r].address;
+			return entries[r].name;
+		}
+	}
+	return NULL;
+}
+
+/**
+ * Search CPU code (TEXT) symbol at or before given address.
+ * Return symbol name and set its address, or return NULL if none.
+ * Returned name is valid only until next Symbols_* function call.
+ */
+const char* Symbols_GetBeforeCpuAddress(Uint32 addr, Uint32 *symaddr)
+{
+	return Symbols_SearchBeforeAddress(CpuSymbolsList, addr, symaddr);
+}
+
+/**
+ * Search DSP code (TEXT) symbol at or before given address.
+ * Return symbol name and set its address, or return NULL if none.
+ * Returned name is valid only until next Symbols_* function call.
+ */
+const char* Symbols_GetBeforeDspAddress(Uint32 addr, Uint32 *symaddr)
+{
+	return Symbols_SearchBeforeAddress(DspSymbolsList, addr, symaddr);
+}
+
 /**
  * Search CPU symbol by address.
  * Return symbol index if address matches, -1 otherwise.
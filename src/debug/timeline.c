@@ -0,0 +1,248 @@
+/*
+ * Hatari - timeline.c
+ *
+ * This file is distributed under the GNU General Public License, version 2
+ * or at your option any later version. Read the file gpl.txt for details.
+ *
+ * timeline.c - CycInt handler timeline in Chrome trace format
+ *
+ * When enabled, every CycInt handler call is timed on the host and
+ * stored with the emulated cycle counter and VBL number into a ring
+ * buffer, so that only the newest events are kept. The buffer can be
+ * saved as Chrome / Perfetto trace JSON, where each interrupt type has
+ * its own track, to see how the device events interleave within a frame
+ * and how much host time each of them takes.
+ */
+const char Timeline_fileid[] = "Hatari timeline.c : " __DATE__ " " __TIME__;
+
+#include <errno.h>
+#include <inttypes.h>
+#include "main.h"
+#include "cycInt.h"
+#include "cycles.h"
+#include "debugui.h"
+#include "debug_priv.h"
+#include "file.h"
+#include "perf.h"
+#include "screen.h"
+#include "stats.h"
+#include "timeline.h"
+#include "video.h"
+
+#define TIMELINE_EVENTS_DEFAULT	(1 << 18)
+#define TIMELINE_EVENTS_MIN	1024
+
+typedef struct {
+	Uint64 nCycles;		/* CyclesGlobalClockCounter at handler call */
+	Sint64 nStartNs;	/* host time at handler call */
+	Uint32 nDurationNs;	/* host time spent in the handler */
+	Uint32 nVbl;
+	Uint8 nId;		/* interrupt_id */
+} TIMELINE_EVENT;
+
+bool Timeline_bEnabled;
+
+static TIMELINE_EVENT *pTimelineEvents;
+static Uint32 nTimelineSize;	/* power of 2 */
+static Uint32 nTimelineNext;	/* wraps around, only low bits index */
+static Uint32 nTimelineCount;
+static const char *TimelineFile;	/* where to save on exit */
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Call the pending CycInt handler and record it into the timeline.
+ * The slot is taken before the call, as handlers (e.g. the blitter)
+ * can call further due handlers themselves.
+ */
+void Timeline_CallHandler(void)
+{
+	TIMELINE_EVENT *pEvent;
+	Sint64 nStart;
+
+	pEvent = &pTimelineEvents[nTimelineNext++ & (nTimelineSize - 1)];
+	if (nTimelineCount < nTimelineSize)
+		nTimelineCount++;
+
+	pEvent->nId = CycInt_GetActiveInterrupt();
+	pEvent->nCycles = CyclesGlobalClockCounter;
+	pEvent->nVbl = nVBLs;
+	nStart = Perf_GetNs();
+	PendingInterruptFunction();
+	pEvent->nStartNs = nStart;
+	pEvent->nDurationNs = Perf_GetNs() - nStart;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Enable or disable recording. Enabling clears the timeline, and
+ * (re-)allocates it when given size differs, disabling keeps it
+ * for saving. Return false if allocation failed.
+ */
+static bool Timeline_Enable(bool bEnable, Uint32 nEvents)
+{
+	Uint32 nSize;
+
+	if (!bEnable)
+	{
+		Timeline_bEnabled = false;
+		return true;
+	}
+
+	for (nSize = TIMELINE_EVENTS_MIN; nSize < nEvents && nSize < 0x40000000; nSize <<= 1)
+		;
+	if (nSize != nTimelineSize || !pTimelineEvents)
+	{
+		Timeline_bEnabled = false;
+		free(pTimelineEvents);
+		pTimelineEvents = malloc(nSize * sizeof(TIMELINE_EVENT));
+		if (!pTimelineEvents)
+		{
+			fprintf(stderr, "ERROR: can't allocate timeline for %u events.\n", nSize);
+			nTimelineSize = 0;
+			return false;
+		}
+		nTimelineSize = nSize;
+	}
+	nTimelineNext = nTimelineCount = 0;
+	Timeline_bEnabled = true;
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Write recorded events, oldest first, as Chrome trace JSON.
+ * Host times are given in microseconds from the first event, emulated
+ * cycles and VBL number are included in the event arguments.
+ * Return number of written events, or -1 on error.
+ */
+static int Timeline_Save(const char *name)
+{
+	const TIMELINE_EVENT *pEvent;
+	Sint64 nBase, nTs;
+	Uint32 i, nFirst;
+	FILE *fp;
+
+	fp = fopen(name, "w");
+	if (!fp)
+	{
+		fprintf(stderr, "ERROR: opening '%s' failed (%d).\n", name, errno);
+		return -1;
+	}
+
+	fprintf(fp, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n"
+	        "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,"
+	        "\"args\":{\"name\":\"Hatari CycInt\"}}");
+	for (i = 1; i < MAX_INTERRUPTS; i++)
+	{
+		fprintf(fp, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,"
+		        "\"args\":{\"name\":\"%s\"}}", i, Stats_InterruptName(i));
+		fprintf(fp, ",\n{\"name\":\"thread_sort_index\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,"
+		        "\"args\":{\"sort_index\":%u}}", i, i);
+	}
+
+	nFirst = nTimelineNext - nTimelineCount;
+	nBase = nTimelineCount ? pTimelineEvents[nFirst & (nTimelineSize - 1)].nStartNs : 0;
+	for (i = 0; i < nTimelineCount; i++)
+	{
+		pEvent = &pTimelineEvents[(nFirst + i) & (nTimelineSize - 1)];
+		nTs = pEvent->nStartNs - nBase;
+		fprintf(fp, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,"
+		        "\"ts\":%"PRId64".%03d,\"dur\":%u.%03u,"
+		        "\"args\":{\"cycle\":%"PRIu64",\"vbl\":%u}}",
+		        Stats_InterruptName(pEvent->nId), pEvent->nId,
+		        nTs / 1000, (int)(nTs % 1000),
+		        pEvent->nDurationNs / 1000, pEvent->nDurationNs % 1000,
+		        pEvent->nCycles, pEvent->nVbl);
+	}
+	fprintf(fp, "\n]}\n");
+
+	if (fclose(fp) != 0)
+	{
+		fprintf(stderr, "ERROR: writing '%s' failed (%d).\n", name, errno);
+		return -1;
+	}
+	return nTimelineCount;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Set file where timeline is written on exit, and start recording
+ */
+void Timeline_SetFile(const char *path)
+{
+	if (Timeline_Enable(true, TIMELINE_EVENTS_DEFAULT))
+		TimelineFile = path;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Stop recording, save timeline to the file given on the command line
+ * (if any) and free it.
+ */
+void Timeline_UnInit(void)
+{
+	Timeline_bEnabled = false;
+	if (TimelineFile && pTimelineEvents)
+	{
+		int count = Timeline_Save(TimelineFile);
+		if (count >= 0)
+			fprintf(stderr, "%d timeline events saved to '%s'.\n", count, TimelineFile);
+	}
+	TimelineFile = NULL;
+	free(pTimelineEvents);
+	pTimelineEvents = NULL;
+	nTimelineSize = nTimelineNext = nTimelineCount = 0;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Readline match callback for timeline command
+ */
+char *Timeline_Match(const char *text, int state)
+{
+	static const char* cmds[] = { "off", "on", "save" };
+	return DebugUI_MatchHelper(cmds, ARRAYSIZE(cmds), text, state);
+}
+
+/**
+ * Command: Record CycInt handler timeline and save it
+ */
+int Timeline_Parse(int nArgc, char *psArgs[])
+{
+	int count;
+
+	if (nArgc < 2) {
+		return DebugUI_PrintCmdHelp(psArgs[0]);
+	}
+	if (strcmp(psArgs[1], "on") == 0) {
+		Uint32 events = TIMELINE_EVENTS_DEFAULT;
+		if (nArgc > 2 && atoi(psArgs[2]) > 0) {
+			events = atoi(psArgs[2]);
+		}
+		if (Timeline_Enable(true, events)) {
+			fprintf(stderr, "Recording last %u CycInt events.\n", nTimelineSize);
+		}
+		return DEBUGGER_CMDDONE;
+	}
+	if (strcmp(psArgs[1], "off") == 0) {
+		Timeline_Enable(false, 0);
+		return DEBUGGER_CMDDONE;
+	}
+	if (nArgc == 3 && strcmp(psArgs[1], "save") == 0) {
+		if (!pTimelineEvents) {
+			fprintf(stderr, "ERROR: no timeline recorded.\n");
+		} else if (File_Exists(psArgs[2])) {
+			fprintf(stderr, "ERROR: file '%s' already exists!\n", psArgs[2]);
+		} else if ((count = Timeline_Save(psArgs[2])) >= 0) {
+			fprintf(stderr, "%d timeline events saved to '%s'.\n", count, psArgs[2]);
+		}
+		return DEBUGGER_CMDDONE;
+	}
+	return DebugUI_PrintCmdHelp(psArgs[0]);
+}
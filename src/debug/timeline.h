@@ -0,0 +1,24 @@
+/*
+  Hatari - timeline.h
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+*/
+
+#ifndef HATARI_TIMELINE_H
+#define HATARI_TIMELINE_H
+
+extern bool Timeline_bEnabled;
+
+/* for cycInt.h */
+extern void Timeline_CallHandler(void);
+
+/* for options.c & main.c */
+extern void Timeline_SetFile(const char *path);
+extern void Timeline_UnInit(void);
+
+/* for debugui */
+extern char *Timeline_Match(const char *text, int state);
+extern int Timeline_Parse(int nArgc, char *psArgs[]);
+
+#endif
@@ -161,7 +161,7 @@ bool DIM_WriteDisk(int Drive, const char *pszFileName, Uint8 *pBuffer, int Image
 	memcpy(pDimFile + 32, pBuffer, ImageSize);
 	
 	/* And finally save it: */
-	bRet = File_Save(pszFileName, pDimFile, ImageSize + 32, false);
+	bRet = File_SaveReplace(pszFileName, pDimFile, ImageSize + 32);
 
 	free(pDimFile);
 
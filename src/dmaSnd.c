@@ -90,6 +90,11 @@
 	Sampling frequency = selectable
 	Bass turnover = 118.276Hz    (8.2nF on LM1992 bass)
 	Treble turnover = 8438.756Hz (8.2nF on LM1992 treble)
+
+	When built with ENABLE_LMC_FIXED_POINT (for CPUs with a slow FPU),
+	the filter runs in fixed point : coefficients and gains in Q28,
+	filter state in Q4 and 64 bit sums. Both voices are filtered
+	together, as the two lanes of a NEON vector when available.
 */
 
 
@@ -104,6 +109,7 @@ const char DmaSnd_fileid[] = "Hatari dmaSnd.c : " __DATE__ " " __TIME__;
 #include "log.h"
 #include "memorySnapShot.h"
 #include "mfp.h"
+#include "resample.h"
 #include "sound.h"
 #include "stMemory.h"
 #include "crossbar.h"
@@ -111,8 +117,16 @@ const char DmaSnd_fileid[] = "Hatari dmaSnd.c : " __DATE__ " " __TIME__;
 #include "video.h"
 #include "m68000.h"
 
+#if ENABLE_LMC_FIXED_POINT && ( defined(__ARM_NEON) || defined(__ARM_NEON__) )
+#define DMASND_LMC_NEON 1
+#include <arm_neon.h>
+#endif
+
 #define TONE_STEPS 13
 
+#define LMC_COEF_SHIFT	28			/* fixed point coefficients and gains are Q28 */
+#define LMC_STATE_SHIFT	4			/* fixed point filter state is Q4 */
+
 #define DMASND_FIFO_SIZE	8			/* 8 bytes : size of the DMA Audio's FIFO, filled on every HBL */
 #define DMASND_FIFO_SIZE_MASK	(DMASND_FIFO_SIZE-1)	/* mask to keep FIFO_pos in 0-7 range */
 
@@ -121,8 +135,10 @@ const char DmaSnd_fileid[] = "Hatari dmaSnd.c : " __DATE__ " " __TIME__;
 
 static void DmaSnd_Apply_LMC(int nMixBufIdx, int nSamplesToGenerate);
 static void DmaSnd_Set_Tone_Level(int set_bass, int set_treb);
+#if !ENABLE_LMC_FIXED_POINT
 static float DmaSnd_IIRfilterL(float xn);
 static float DmaSnd_IIRfilterR(float xn);
+#endif
 static struct first_order_s *DmaSnd_Treble_Shelf(float g, float fc, float Fs);
 static struct first_order_s *DmaSnd_Bass_Shelf(float g, float fc, float Fs);
 static Sint16 DmaSnd_LowPassFilterLeft(Sint16 in);
@@ -152,6 +168,7 @@ struct dma_s {
 
 Sint64	frameCounter_float = 0;
 bool	DmaInitSample = false;
+static RESAMPLER DmaResampler;		/* converts FIFO frames to nAudioFrequency */
 
 
 struct microwire_s {
@@ -171,6 +188,9 @@ struct lmc1992_s {
 	struct first_order_s bass_table[TONE_STEPS];
 	struct first_order_s treb_table[TONE_STEPS];
 	float coef[5];			/* IIR coefficients */
+#if ENABLE_LMC_FIXED_POINT
+	Sint32 coef_fixed[5];		/* same in Q28 */
+#endif
 	float left_gain;
 	float right_gain;
 };
@@ -222,6 +242,8 @@ static const int DmaSndSampleRates[4] =
 
 static void	DmaSnd_FIFO_Refill(void);
 static Sint8	DmaSnd_FIFO_PullByte(void);
+static void	DmaSnd_FIFO_PullFrame(void);
+static int	DmaSnd_FIFO_PullSpan(Sint16 (*pOut)[2], int nMax);
 static void	DmaSnd_FIFO_SetStereo(void);
 
 static int	DmaSnd_DetectSampleRate(void);
@@ -234,6 +256,7 @@ static inline int DmaSnd_EndOfFrameReached(void);
  */
 void DmaSnd_Reset(bool bCold)
 {
+	Sound_ThreadSync();
 	nDmaSoundControl = 0;
 	dma.soundMode = 0;
 
@@ -249,6 +272,7 @@ void DmaSnd_Reset(bool bCold)
 	dma.FIFO_NbBytes = 0;
 	dma.FrameLeft = 0;
 	dma.FrameRight = 0;
+	Resample_Reset(&DmaResampler);
 
 	if ( bCold )
 	{
@@ -274,11 +298,16 @@ void DmaSnd_Reset(bool bCold)
  */
 void DmaSnd_MemorySnapShot_Capture(bool bSave)
 {
+	Sound_ThreadSync();
+
 	/* Save/Restore details */
 	MemorySnapShot_Store(&nDmaSoundControl, sizeof(nDmaSoundControl));
 	MemorySnapShot_Store(&dma, sizeof(dma));
 	MemorySnapShot_Store(&microwire, sizeof(microwire));
 	MemorySnapShot_Store(&lmc1992, sizeof(lmc1992));
+
+	if (!bSave)
+		Resample_Reset(&DmaResampler);
 }
 
 
@@ -370,6 +399,73 @@ static Sint8 DmaSnd_FIFO_PullByte(void)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Pull the next mono or stereo frame from the FIFO and store it
+ * (low pass filtered) in dma.FrameLeft and dma.FrameRight.
+ */
+static void DmaSnd_FIFO_PullFrame(void)
+{
+	Sint8	LeftByte, RightByte;
+
+	LeftByte = DmaSnd_FIFO_PullByte ();
+	if (dma.soundMode & DMASNDMODE_MONO)
+		RightByte = LeftByte;
+	else
+		RightByte = DmaSnd_FIFO_PullByte ();
+
+	dma.FrameLeft  = DmaSnd_LowPassFilterLeft( (Sint16)LeftByte );
+	dma.FrameRight = DmaSnd_LowPassFilterRight( (Sint16)RightByte );
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * When the FIFO is empty, pull up to nMax frames into pOut by reading whole
+ * FIFO refills straight from ST RAM, as long as the end of the frame isn't
+ * reached (it has to go through DmaSnd_FIFO_Refill to loop or stop).
+ * As the FIFO is refilled and emptied completely, FIFO_Pos doesn't change.
+ * Return the number of frames pulled.
+ */
+static int DmaSnd_FIFO_PullSpan(Sint16 (*pOut)[2], int nMax)
+{
+	int nPerRefill = ( dma.soundMode & DMASNDMODE_MONO ) ? DMASND_FIFO_SIZE : DMASND_FIFO_SIZE / 2;
+	const Sint8 *pData = NULL;
+	Sint16 LeftByte, RightByte;
+	int n = 0, i;
+
+	if ( ( ( nDmaSoundControl & DMASNDCTRL_PLAY ) == 0 ) || ( dma.FIFO_NbBytes > 0 )
+	  || ( dma.frameEndAddr == dma.frameStartAddr ) )
+		return 0;
+
+	while ( ( nMax - n >= nPerRefill ) && ( dma.frameCounterAddr < dma.frameEndAddr )
+	     && ( dma.frameEndAddr - dma.frameCounterAddr > DMASND_FIFO_SIZE ) )
+	{
+		pData = (const Sint8 *)&STRam[ dma.frameCounterAddr ];
+		for ( i = 0 ; i < DMASND_FIFO_SIZE ; n++ )
+		{
+			LeftByte = pData[ i++ ];
+			if ( dma.soundMode & DMASNDMODE_MONO )
+				RightByte = LeftByte;
+			else
+				RightByte = pData[ i++ ];
+			pOut[n][0] = dma.FrameLeft  = DmaSnd_LowPassFilterLeft( LeftByte );
+			pOut[n][1] = dma.FrameRight = DmaSnd_LowPassFilterRight( RightByte );
+		}
+		dma.frameCounterAddr += DMASND_FIFO_SIZE;
+	}
+
+	/* Leave the last refill in the FIFO, as DmaSnd_FIFO_Refill would */
+	if ( pData )
+	{
+		for ( i = 0 ; i < DMASND_FIFO_SIZE ; i++ )
+			dma.FIFO[ ( dma.FIFO_Pos + i ) & DMASND_FIFO_SIZE_MASK ] = pData[ i ];
+	}
+
+	return n;
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * In case a program switches from mono to stereo, we must ensure that
@@ -477,11 +573,11 @@ static inline int DmaSnd_EndOfFrameReached(void)
 
 void DmaSnd_GenerateSamples(int nMixBufIdx, int nSamplesToGenerate)
 {
-	int i;
+	int i, j, n;
 	int nBufIdx;
-	Sint8 MonoByte , LeftByte , RightByte;
-	unsigned n;
-	Sint64 FreqRatio;
+	int nBlock, nIn;
+	Sint16 (*pIn)[2];
+	Sint16 Frames[RESAMPLE_MAX_INPUT][2];
 
 
 	/* DMA Audio OFF and FIFO empty : process YM2149's output */
@@ -518,94 +614,58 @@ void DmaSnd_GenerateSamples(int nMixBufIdx, int nSamplesToGenerate)
 
 	/* Compute ratio between DMA's sound frequency and host computer's sound frequency, */
 	/* use << 32 to simulate floating point precision */
-	FreqRatio = ( ((Sint64)DmaSnd_DetectSampleRate()) << 32 ) / nAudioFrequency;
+	Resample_SetStep ( &DmaResampler , ( ((Sint64)DmaSnd_DetectSampleRate()) << 32 ) / nAudioFrequency );
 
-	if (dma.soundMode & DMASNDMODE_MONO)
+	if ( DmaInitSample )
 	{
-		/* Mono 8-bit */
-		for (i = 0; i < nSamplesToGenerate; i++)
-		{
-			if ( DmaInitSample )
-			{
-				MonoByte = DmaSnd_FIFO_PullByte ();
-				dma.FrameLeft  = DmaSnd_LowPassFilterLeft( (Sint16)MonoByte );
-				dma.FrameRight = DmaSnd_LowPassFilterRight( (Sint16)MonoByte );
-				DmaInitSample = false;
-			}
-
-			nBufIdx = (nMixBufIdx + i) % MIXBUFFER_SIZE;
-
-			switch (microwire.mixing) {
-				case 1:
-					/* DMA and YM2149 mixing */
-					MixBuffer[nBufIdx][0] = MixBuffer[nBufIdx][0] + dma.FrameLeft * -((256*3/4)/4)/4;
-					break;
-				default:
-					/* mixing=0 DMA only */
-					/* mixing=2 DMA and input 2 (YM2149 LPF) -> DMA */
-					/* mixing=3 DMA and input 3 -> DMA */
-					MixBuffer[nBufIdx][0] = dma.FrameLeft * -((256*3/4)/4)/4;
-					break;
-			}
-
-			MixBuffer[nBufIdx][1] = MixBuffer[nBufIdx][0];		/* right = left */
-
-			/* Increase freq counter */
-			frameCounter_float += FreqRatio;
-			n = frameCounter_float >> 32;				/* number of samples to skip */
-			while ( n > 0 )						/* pull as many bytes from the FIFO as needed */
-			{
-				MonoByte = DmaSnd_FIFO_PullByte ();
-				dma.FrameLeft  = DmaSnd_LowPassFilterLeft( (Sint16)MonoByte );
-				dma.FrameRight = DmaSnd_LowPassFilterRight( (Sint16)MonoByte );
-				n--;
-			}
-			frameCounter_float &= 0xffffffff;			/* only keep the fractional part */
-		}
+		DmaSnd_FIFO_PullFrame ();
+		Resample_Push ( &DmaResampler , dma.FrameLeft , dma.FrameRight );
+		DmaInitSample = false;
 	}
-	else
+
+	for (i = 0; i < nSamplesToGenerate; i += nBlock)
 	{
-		/* Stereo 8-bit */
-		for (i = 0; i < nSamplesToGenerate; i++)
+		/* Pull all the frames needed for this block from the FIFO, then resample them at once */
+		nBlock = Resample_BlockSize ( &DmaResampler , nSamplesToGenerate - i );
+		nIn = Resample_InputCount ( &DmaResampler , frameCounter_float , nBlock );
+		pIn = Resample_Input ( &DmaResampler );
+		for (j = 0; j < nIn; )
 		{
-			if ( DmaInitSample )
+			/* When the FIFO runs dry, take the next bytes straight from ST RAM */
+			n = DmaSnd_FIFO_PullSpan ( &pIn[j] , nIn - j );
+			if ( n > 0 )
 			{
-				LeftByte = DmaSnd_FIFO_PullByte ();
-				RightByte = DmaSnd_FIFO_PullByte ();
-				dma.FrameLeft  = DmaSnd_LowPassFilterLeft( (Sint16)LeftByte );
-				dma.FrameRight = DmaSnd_LowPassFilterRight( (Sint16)RightByte );
-				DmaInitSample = false;
+				j += n;
+				continue;
 			}
+			DmaSnd_FIFO_PullFrame ();
+			pIn[j][0] = dma.FrameLeft;
+			pIn[j][1] = dma.FrameRight;
+			j++;
+		}
+		Resample_Process ( &DmaResampler , &frameCounter_float , nIn , Frames , nBlock );
 
-			nBufIdx = (nMixBufIdx + i) % MIXBUFFER_SIZE;
+		for (j = 0; j < nBlock; j++)
+		{
+			nBufIdx = (nMixBufIdx + i + j) % MIXBUFFER_SIZE;
 
 			switch (microwire.mixing) {
 				case 1:
 					/* DMA and YM2149 mixing */
-					MixBuffer[nBufIdx][0] = MixBuffer[nBufIdx][0] + dma.FrameLeft * -((256*3/4)/4)/4;
-					MixBuffer[nBufIdx][1] = MixBuffer[nBufIdx][1] + dma.FrameRight * -((256*3/4)/4)/4;
+					MixBuffer[nBufIdx][0] = MixBuffer[nBufIdx][0] + Frames[j][0] * -((256*3/4)/4)/4;
+					MixBuffer[nBufIdx][1] = MixBuffer[nBufIdx][1] + Frames[j][1] * -((256*3/4)/4)/4;
 					break;
 				default:
 					/* mixing=0 DMA only */
 					/* mixing=2 DMA and input 2 (YM2149 LPF) -> DMA */
 					/* mixing=3 DMA and input 3 -> DMA */
-					MixBuffer[nBufIdx][0] = dma.FrameLeft * -((256*3/4)/4)/4;
-					MixBuffer[nBufIdx][1] = dma.FrameRight * -((256*3/4)/4)/4;
+					MixBuffer[nBufIdx][0] = Frames[j][0] * -((256*3/4)/4)/4;
+					MixBuffer[nBufIdx][1] = Frames[j][1] * -((256*3/4)/4)/4;
 					break;
 			}
 
-			/* Increase freq counter */
-			frameCounter_float += FreqRatio;
-			n = frameCounter_float >> 32;				/* number of samples to skip */
-			while ( n > 0 )						/* pull as many bytes from the FIFO as needed */
-			{
-				LeftByte = DmaSnd_FIFO_PullByte ();
-				RightByte = DmaSnd_FIFO_PullByte ();
-				dma.FrameLeft  = DmaSnd_LowPassFilterLeft( (Sint16)LeftByte );
-				dma.FrameRight = DmaSnd_LowPassFilterRight( (Sint16)RightByte );
-				n--;
-			}
-			frameCounter_float &= 0xffffffff;			/* only keep the fractional part */
+			if (dma.soundMode & DMASNDMODE_MONO)
+				MixBuffer[nBufIdx][1] = MixBuffer[nBufIdx][0];		/* right = left */
 		}
 	}
 
@@ -620,6 +680,94 @@ void DmaSnd_GenerateSamples(int nMixBufIdx, int nSamplesToGenerate)
  * The Bass and Treble get samples at nAudioFrequency rate.
  * The tone control's sampling frequency must be at least 22050 Hz to sound good.
  */
+#if ENABLE_LMC_FIXED_POINT
+static void DmaSnd_Apply_LMC(int nMixBufIdx, int nSamplesToGenerate)
+{
+	static Sint32 data[2][2];		/* wn-1 and wn-2 of left and right voices, Q4 */
+	const Sint32 *c = lmc1992.coef_fixed;
+	Sint32 gain[2];
+	int nBufIdx;
+	int i;
+
+	/* Q28 gains, same as left_gain/right_gain */
+	gain[0] = (microwire.leftVolume * (Uint32)microwire.masterVolume) >> (32 - 1 - LMC_COEF_SHIFT);
+	gain[1] = (microwire.rightVolume * (Uint32)microwire.masterVolume) >> (32 - 1 - LMC_COEF_SHIFT);
+
+#if DMASND_LMC_NEON
+	{
+		int32x2_t c0 = vdup_n_s32(c[0]), c1 = vdup_n_s32(c[1]);
+		int32x2_t c2 = vdup_n_s32(c[2]), c3 = vdup_n_s32(c[3]), c4 = vdup_n_s32(c[4]);
+		int32x2_t vmax = vdup_n_s32(32767), vmin = vdup_n_s32(-32767);
+		int64x2_t trunc = vdupq_n_s64((1LL << (LMC_COEF_SHIFT + LMC_STATE_SHIFT)) - 1);
+		int32x2_t g = vld1_s32(gain);
+		int32x2_t d0 = vld1_s32(data[0]), d1 = vld1_s32(data[1]);
+		int32x2_t x, wn, yn;
+		int64x2_t acc;
+
+		for (i = 0; i < nSamplesToGenerate; i++) {
+			nBufIdx = (nMixBufIdx + i) % MIXBUFFER_SIZE;
+
+			x = vset_lane_s32(Subsonic_IIR_HPF_Left(MixBuffer[nBufIdx][0]), vdup_n_s32(0), 0);
+			x = vset_lane_s32(Subsonic_IIR_HPF_Right(MixBuffer[nBufIdx][1]), x, 1);
+			x = vshl_n_s32(x, LMC_STATE_SHIFT);
+
+			acc = vmull_s32(x, g);		/* a = g*xn - a1*wn-1 - a2*wn-2 */
+			acc = vmlsl_s32(acc, c0, d0);
+			acc = vmlsl_s32(acc, c1, d1);
+			wn = vrshrn_n_s64(acc, LMC_COEF_SHIFT);
+
+			acc = vmull_s32(c2, wn);	/* yn = b0*a + b1*wn-1 + b2*wn-2 */
+			acc = vmlal_s32(acc, c3, d0);
+			acc = vmlal_s32(acc, c4, d1);
+			acc = vaddq_s64(acc, vandq_s64(vshrq_n_s64(acc, 63), trunc));
+			yn = vshrn_n_s64(acc, LMC_COEF_SHIFT + LMC_STATE_SHIFT);
+			yn = vmax_s32(vmin_s32(yn, vmax), vmin);
+
+			d1 = d0;
+			d0 = wn;
+			MixBuffer[nBufIdx][0] = vget_lane_s32(yn, 0);
+			MixBuffer[nBufIdx][1] = vget_lane_s32(yn, 1);
+		}
+		vst1_s32(data[0], d0);
+		vst1_s32(data[1], d1);
+	}
+#else
+	{
+		Sint32 x[2], wn;
+		Sint64 acc;
+		int ch;
+
+		for (i = 0; i < nSamplesToGenerate; i++) {
+			nBufIdx = (nMixBufIdx + i) % MIXBUFFER_SIZE;
+
+			x[0] = Subsonic_IIR_HPF_Left(MixBuffer[nBufIdx][0]);
+			x[1] = Subsonic_IIR_HPF_Right(MixBuffer[nBufIdx][1]);
+
+			for (ch = 0; ch < 2; ch++) {
+				/* same rounding as the NEON version, so both give identical output ;
+				 * like the float version, output is truncated towards 0 */
+				acc = (Sint64)(x[ch] * (1 << LMC_STATE_SHIFT)) * gain[ch]
+				    - (Sint64)c[0] * data[0][ch] - (Sint64)c[1] * data[1][ch];
+				wn = (Sint32)((acc + (1LL << (LMC_COEF_SHIFT-1))) >> LMC_COEF_SHIFT);
+
+				acc = (Sint64)c[2] * wn + (Sint64)c[3] * data[0][ch] + (Sint64)c[4] * data[1][ch];
+				if (acc < 0)
+					acc += (1LL << (LMC_COEF_SHIFT+LMC_STATE_SHIFT)) - 1;
+				acc >>= LMC_COEF_SHIFT+LMC_STATE_SHIFT;
+				if (acc < -32767)			/* check for overflow to clip waveform */
+					acc = -32767;
+				else if (acc > 32767)
+					acc = 32767;
+
+				data[1][ch] = data[0][ch];
+				data[0][ch] = wn;
+				MixBuffer[nBufIdx][ch] = acc;
+			}
+		}
+	}
+#endif
+}
+#else
 static void DmaSnd_Apply_LMC(int nMixBufIdx, int nSamplesToGenerate)
 {
 	int nBufIdx;
@@ -645,6 +793,18 @@ static void DmaSnd_Apply_LMC(int nMixBufIdx, int nSamplesToGenerate)
 		MixBuffer[nBufIdx][1] = sample;
  	}
 }
+#endif
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return true if DMA sound is off and its FIFO is empty, i.e. if only
+ * the YM2149's output is being processed.
+ */
+bool DmaSnd_IsIdle(void)
+{
+	return !(nDmaSoundControl & DMASNDCTRL_PLAY) && ( dma.FIFO_NbBytes == 0 );
+}
 
 
 /*-----------------------------------------------------------------------*/
@@ -1042,6 +1202,9 @@ void DmaSnd_InterruptHandler_Microwire(void)
 			return;
 		}
 
+		/* Create samples up until this point with current settings */
+		Sound_Update(false);
+
 		/* Update the LMC 1992 commands */
 		switch ( ( cmd >> 6 ) & 0x7 ) {
 			case 0:
@@ -1174,6 +1337,7 @@ void DmaSnd_MicrowireMask_WriteWord(void)
 
 /*-------------------Bass / Treble filter ---------------------------*/
 
+#if !ENABLE_LMC_FIXED_POINT
 /**
  * Left voice Filter for Bass/Treble.
  */
@@ -1226,6 +1390,7 @@ static float DmaSnd_IIRfilterR(float xn)
 	data[0] = a;				/* wn -> wn-1            */
 	return yn;
 }
+#endif
 
 /**
  * LowPass Filter Left
@@ -1281,6 +1446,14 @@ static void DmaSnd_Set_Tone_Level(int set_bass, int set_treb)
 	lmc1992.coef[3] = lmc1992.treb_table[set_treb].b0 * lmc1992.bass_table[set_bass].b1 +
 			  lmc1992.treb_table[set_treb].b1 * lmc1992.bass_table[set_bass].b0;
 	lmc1992.coef[4] = lmc1992.treb_table[set_treb].b1 * lmc1992.bass_table[set_bass].b1;
+
+#if ENABLE_LMC_FIXED_POINT
+	{
+		int i;
+		for (i = 0; i < 5; i++)
+			lmc1992.coef_fixed[i] = lrintf(lmc1992.coef[i] * (float)(1 << LMC_COEF_SHIFT));
+	}
+#endif
 }
 
 
@@ -1337,6 +1510,8 @@ void DmaSnd_Init_Bass_and_Treble_Tables(void)
 	float  dB_adjusted, dB, g, fc_bt, fc_tt, Fs;
 	int    n;
 
+	Sound_ThreadSync();
+
 	fc_bt = 118.2763;
 	fc_tt = 8438.756;
 	Fs = (float)nAudioFrequency;
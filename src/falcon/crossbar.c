@@ -98,6 +98,7 @@ const char crossbar_fileid[] = "Hatari Crossbar.c : " __DATE__ " " __TIME__;
 #include "ioMem.h"
 #include "log.h"
 #include "memorySnapShot.h"
+#include "resample.h"
 #include "mfp.h"
 #include "sound.h"
 #include "crossbar.h"
@@ -108,6 +109,7 @@ const char crossbar_fileid[] = "Hatari Crossbar.c : " __DATE__ " " __TIME__;
 
 #define DACBUFFER_SIZE    2048
 #define DECIMAL_PRECISION 65536
+#define BATCH_MAX_FRAMES  64		/* max frames transferred by one clock interrupt */
 
 
 /* Crossbar internal functions */
@@ -115,10 +117,14 @@ static int  Crossbar_DetectSampleRate(Uint16 clock);
 static void Crossbar_Recalculate_Clocks_Cycles(void);
 static void Crossbar_Start_InterruptHandler_25Mhz(void);
 static void Crossbar_Start_InterruptHandler_32Mhz(void);
+static void Crossbar_Transfer_25Mhz(void);
+static void Crossbar_Transfer_32Mhz(void);
+static void Crossbar_Batch_Sync(bool bTruncate);
 
 /* Dma_Play sound functions */
 static void Crossbar_setDmaPlay_Settings(void);
 static void Crossbar_Process_DMAPlay_Transfer(void);
+static Uint32 Crossbar_DMAPlay_TransferSpan(Uint32 n);
 
 /* Dma_Record sound functions */
 static void Crossbar_setDmaRecord_Settings(void);
@@ -134,6 +140,7 @@ static void Crossbar_SendDataToDAC(Sint16 value, Uint16 sample_pos);
 
 /* ADC functions */
 static void Crossbar_Process_ADCXmit_Transfer(void);
+static void Crossbar_ADCXmit_Skip(Uint32 n);
 
 /* external data used by the MFP */
 Uint16 nCbar_DmaSoundControl;
@@ -295,6 +302,34 @@ static struct codec_s dac;
 static struct codec_s adc;
 static struct dsp_s dspXmit;
 static struct dsp_s dspReceive;
+static RESAMPLER DacResampler;		/* converts dac's buffer to nAudioFrequency */
+
+/* When the transfers of a clock can't be observed before the next buffer
+ * end, one clock interrupt handles a batch of frames. The frames due before
+ * it are transferred late, when the DAC buffer, the frame counter or the
+ * crossbar settings are accessed, or by the interrupt itself.
+ */
+struct batch_s {
+	Uint32 frames;			/* frames handled by the pending interrupt */
+	Uint32 done;			/* frames already transferred */
+	Uint32 due[BATCH_MAX_FRAMES];	/* cycles from the batch start to each frame */
+	Uint32 counter[BATCH_MAX_FRAMES];	/* cycles counter after each frame */
+	Uint32 pending[BATCH_MAX_FRAMES];	/* pending cycles over after each frame */
+	Uint32 *cycles_counter;
+	Uint32 *pendingCyclesOver;
+	interrupt_id id;
+};
+
+static struct batch_s batch25 = {
+	.cycles_counter = &crossbar.clock25_cycles_counter,
+	.pendingCyclesOver = &crossbar.pendingCyclesOver25,
+	.id = INTERRUPT_CROSSBAR_25MHZ
+};
+static struct batch_s batch32 = {
+	.cycles_counter = &crossbar.clock32_cycles_counter,
+	.pendingCyclesOver = &crossbar.pendingCyclesOver32,
+	.id = INTERRUPT_CROSSBAR_32MHZ
+};
 
 /**
  * Reset Crossbar variables.
@@ -326,6 +361,7 @@ void Crossbar_Reset(bool bCold)
 	dac.readPosition_float = 0;
 	dac.readPosition = 0;
 	dac.writePosition = 0;
+	Resample_Reset(&DacResampler);
 
 	/* ADC inits */
 	memset(adc.buffer_left, 0, sizeof(adc.buffer_left));
@@ -393,6 +429,16 @@ void Crossbar_Reset(bool bCold)
 	IoMem_WriteWord(0xff893c,0x2401);
 }
 
+/**
+ * Do the batched transfers due so far before a snapshot is saved, so that
+ * only the next frame of each clock is pending in it. This changes the
+ * cycle interrupt table, so it's done before anything is saved.
+ */
+void Crossbar_MemorySnapShot_Prepare(void)
+{
+	Crossbar_Batch_Sync(true);
+}
+
 /**
  * Save/Restore snapshot of local variables ('MemorySnapShot_Store' handles type)
  */
@@ -407,6 +453,13 @@ void Crossbar_MemorySnapShot_Capture(bool bSave)
 	MemorySnapShot_Store(&adc, sizeof(adc));
 	MemorySnapShot_Store(&dspXmit, sizeof(dspXmit));
 	MemorySnapShot_Store(&dspReceive, sizeof(dspReceive));
+
+	if (!bSave)
+	{
+		Resample_Reset(&DacResampler);
+		batch25.frames = batch32.frames = 1;
+		batch25.done = batch32.done = 0;
+	}
 }
 
 
@@ -474,6 +527,8 @@ void Crossbar_DmaCtrlReg_WriteByte(void)
 {
 	Uint8 sndCtrl = IoMem_ReadByte(0xff8901);
 
+	Crossbar_Batch_Sync(true);
+
 	LOG_TRACE(TRACE_CROSSBAR, "Crossbar : $ff8901 (additional Sound DMA control) write: 0x%02x\n", sndCtrl);
 
 	crossbar.dmaSelected = (sndCtrl & 0x80) >> 7;
@@ -632,6 +687,8 @@ void Crossbar_FrameStartLow_WriteByte(void)
  */
 void Crossbar_FrameCountHigh_ReadByte(void)
 {
+	Crossbar_Batch_Sync(false);
+
 	if (crossbar.dmaSelected == 0) {
 		/* DMA Play selected */
 		IoMem_WriteByte(0xff8909, (dmaPlay.frameStartAddr + dmaPlay.frameCounter) >> 16);
@@ -669,6 +726,8 @@ void Crossbar_FrameCountHigh_WriteByte(void)
  */
 void Crossbar_FrameCountMed_ReadByte(void)
 {
+	Crossbar_Batch_Sync(false);
+
 	if (crossbar.dmaSelected == 0) {
 		/* DMA Play selected */
 		IoMem_WriteByte(0xff890b, (dmaPlay.frameStartAddr + dmaPlay.frameCounter) >> 8);
@@ -706,6 +765,8 @@ void Crossbar_FrameCountMed_WriteByte(void)
  */
 void Crossbar_FrameCountLow_ReadByte(void)
 {
+	Crossbar_Batch_Sync(false);
+
 	if (crossbar.dmaSelected == 0) {
 		/* DMA Play selected */
 		IoMem_WriteByte(0xff890d, (dmaPlay.frameStartAddr + dmaPlay.frameCounter));
@@ -856,6 +917,8 @@ void Crossbar_DmaTrckCtrl_WriteByte(void)
 {
 	Uint8 sndCtrl = IoMem_ReadByte(0xff8920);
 
+	Crossbar_Batch_Sync(true);
+
 	LOG_TRACE(TRACE_CROSSBAR, "Crossbar : $ff8920 (sound mode control) write: 0x%02x\n", sndCtrl);
 
 	crossbar.playTracks = (sndCtrl & 3) + 1;
@@ -869,6 +932,8 @@ void Crossbar_SoundModeCtrl_WriteByte(void)
 {
 	Uint8 sndCtrl = IoMem_ReadByte(0xff8921);
 
+	Crossbar_Batch_Sync(true);
+
 	LOG_TRACE(TRACE_CROSSBAR, "crossbar : $ff8921 (additional sound mode control) write: 0x%02x\n", sndCtrl);
 
 	crossbar.is16Bits = (sndCtrl & 0x40) >> 6;
@@ -913,6 +978,8 @@ void Crossbar_SrcControler_WriteWord(void)
 {
 	Uint16 nCbSrc = IoMem_ReadWord(0xff8930);
 
+	Crossbar_Batch_Sync(true);
+
 	LOG_TRACE(TRACE_CROSSBAR, "Crossbar : $ff8930 (source device) write: 0x%04x\n", nCbSrc);
 
 	dspXmit.isTristated = 1 - ((nCbSrc >> 7) & 0x1);
@@ -961,6 +1028,8 @@ void Crossbar_DstControler_WriteWord(void)
 {
 	Uint16 destCtrl = IoMem_ReadWord(0xff8932);
 
+	Crossbar_Batch_Sync(true);
+
 	LOG_TRACE(TRACE_CROSSBAR, "Crossbar : $ff8932 (destination device) write: 0x%04x\n", destCtrl);
 
 	dspReceive.isTristated = 1 - ((destCtrl & 0x80) >> 7);
@@ -1013,6 +1082,8 @@ void Crossbar_FreqDivInt_WriteByte(void)
 {
 	Uint8 clkDiv = IoMem_ReadByte(0xff8935);
 
+	Crossbar_Batch_Sync(true);
+
 	LOG_TRACE(TRACE_CROSSBAR, "Crossbar : $ff8935 (int. clock divider) write: 0x%02x\n", clkDiv);
 
 	crossbar.int_freq_divider = clkDiv & 0xf;
@@ -1182,80 +1253,292 @@ static int Crossbar_DetectSampleRate(Uint16 clock)
 	return Falcon_SampleRates_32Mhz[crossbar.int_freq_divider - 1];
 }
 
+/*----------------------------------------------------------------------*/
+/*--------------------- Batched clock interrupts -----------------------*/
+/*----------------------------------------------------------------------*/
+
 /**
- * Start internal 25 Mhz clock interrupt.
+ * Return true if the DSP Xmit transfer does nothing.
  */
-static void Crossbar_Start_InterruptHandler_25Mhz(void)
+static bool Crossbar_DSPXmit_IsIdle(void)
 {
-	Uint32 cycles_25;
-	
-	cycles_25 = crossbar.clock25_cycles;
-	crossbar.clock25_cycles_counter += crossbar.clock25_cycles_decimal;
-	
-	if (crossbar.clock25_cycles_counter >= DECIMAL_PRECISION) {
-		crossbar.clock25_cycles_counter -= DECIMAL_PRECISION;
-		cycles_25 ++;
+	if (dspXmit.isTristated)
+		return true;
+	return !dmaRecord.isConnectedToDspInHandShakeMode && !dspXmit.isConnectedToCodec
+	       && !dspXmit.isConnectedToDma && !dspXmit.isConnectedToDsp;
+}
+
+/**
+ * Return the number of DMA Play transfers up to and including the one
+ * which reaches the end of the frame (at most max).
+ */
+static Uint32 Crossbar_DMAPlay_FramesToEnd(Uint32 max)
+{
+	Uint32 counter = dmaPlay.frameCounter;
+	Uint32 currentFrame = dmaPlay.currentFrame;
+	Uint32 i;
+
+	for (i = 1; i < max; i++) {
+		if (crossbar.is16Bits)
+			counter += 2;
+		else if (crossbar.isStereo || (currentFrame & 1) == 0)
+			counter += 1;
+		if (counter >= dmaPlay.frameLen)
+			break;
+		if (++currentFrame >= crossbar.playTracks * 2)
+			currentFrame = 0;
 	}
+	return i;
+}
 
-	if (crossbar.pendingCyclesOver25 >= cycles_25) {
-		crossbar.pendingCyclesOver25 -= cycles_25;
-		cycles_25 = 0;
+/**
+ * Return how many frames the next interrupt of the 25 Mhz or 32 Mhz clock
+ * can handle: only one when its transfers involve the DSP or DMA record,
+ * else up to the end of the DMA Play frame.
+ */
+static Uint32 Crossbar_Batch_Frames(bool bClock25)
+{
+	Uint32 freq = bClock25 ? CROSSBAR_FREQ_25MHZ : CROSSBAR_FREQ_32MHZ;
+	bool bDsp, bDma;
+
+	if (crossbar.isInSteFreqMode) {
+		/* the 32 Mhz clock does nothing then */
+		if (!bClock25)
+			return BATCH_MAX_FRAMES;
+		bDsp = bDma = true;
 	}
 	else {
-		cycles_25 -= crossbar.pendingCyclesOver25;
-		crossbar.pendingCyclesOver25 = 0;
+		bDsp = crossbar.dspXmit_freq == freq;
+		bDma = crossbar.dmaPlay_freq == freq;
 	}
 
-	CycInt_AddRelativeInterrupt(cycles_25, INT_CPU_CYCLE, INTERRUPT_CROSSBAR_25MHZ);
+	if (bClock25 && (adc.isConnectedToDsp || adc.isConnectedToDma))
+		return 1;
+	if (bDsp && !Crossbar_DSPXmit_IsIdle())
+		return 1;
+	if (bDma && dmaPlay.isRunning) {
+		if (dmaPlay.isConnectedToDspInHandShakeMode || dmaPlay.isConnectedToDsp
+		    || dmaPlay.isConnectedToDma)
+			return 1;
+		return Crossbar_DMAPlay_FramesToEnd(BATCH_MAX_FRAMES);
+	}
+	return BATCH_MAX_FRAMES;
 }
 
 /**
- * Start internal 32 Mhz clock interrupt.
+ * Compute the cycles of the next frames of a clock, the last one is
+ * where its interrupt is added.
  */
-static void Crossbar_Start_InterruptHandler_32Mhz(void)
+static Uint32 Crossbar_Batch_Start(struct batch_s *batch, Uint32 frames,
+                                   Uint32 cycles, Uint32 cycles_decimal)
 {
-	Uint32 cycles_32;
-	
-	cycles_32 = crossbar.clock32_cycles;
-	crossbar.clock32_cycles_counter += crossbar.clock32_cycles_decimal;
+	Uint32 i, cyc, total = 0;
+
+	for (i = 0; i < frames; i++) {
+		cyc = cycles;
+		*batch->cycles_counter += cycles_decimal;
+
+		if (*batch->cycles_counter >= DECIMAL_PRECISION) {
+			*batch->cycles_counter -= DECIMAL_PRECISION;
+			cyc ++;
+		}
+
+		if (*batch->pendingCyclesOver >= cyc) {
+			*batch->pendingCyclesOver -= cyc;
+			cyc = 0;
+		}
+		else {
+			cyc -= *batch->pendingCyclesOver;
+			*batch->pendingCyclesOver = 0;
+		}
 
-	if (crossbar.clock32_cycles_counter >= DECIMAL_PRECISION) {
-		crossbar.clock32_cycles_counter -= DECIMAL_PRECISION;
-		cycles_32 ++;
+		total += cyc;
+		batch->due[i] = total;
+		batch->counter[i] = *batch->cycles_counter;
+		batch->pending[i] = *batch->pendingCyclesOver;
 	}
 
-	if (crossbar.pendingCyclesOver32 >= cycles_32){
-		crossbar.pendingCyclesOver32 -= cycles_32;
-		cycles_32 = 0;
+	batch->frames = frames;
+	batch->done = 0;
+	return total;
+}
+
+/**
+ * Return how many cycles ago a frame of a batch was due,
+ * or -1 if it's the last one or not yet due.
+ * Inside another interrupt handler, only the frames whose own interrupt
+ * would have been called before that handler are due.
+ */
+static int Crossbar_Batch_Late(struct batch_s *batch, Uint32 frame)
+{
+	interrupt_id running;
+	int elapsed;
+
+	if (frame + 1 >= batch->frames || !CycInt_InterruptActive(batch->id))
+		return -1;
+
+	elapsed = batch->due[batch->frames - 1]
+	        - CycInt_FindCyclesPassedInHandler(batch->id, INT_CPU_CYCLE, &running);
+	if (elapsed < (int)batch->due[frame])
+		return -1;
+	if (elapsed == (int)batch->due[frame] && running != INTERRUPT_NULL && running < batch->id)
+		return -1;
+	return elapsed - batch->due[frame];
+}
+
+/**
+ * Return true if the transfers of a clock don't send anything anywhere,
+ * so that their order against the other clock doesn't matter.
+ */
+static bool Crossbar_Batch_IsIdle(bool bClock25)
+{
+	Uint32 freq = bClock25 ? CROSSBAR_FREQ_25MHZ : CROSSBAR_FREQ_32MHZ;
+	bool bSte = crossbar.isInSteFreqMode;
+
+	if (bSte && !bClock25)
+		return true;
+	if (bClock25 && (adc.isConnectedToCodec || adc.isConnectedToDsp || adc.isConnectedToDma))
+		return false;
+	if ((bSte || crossbar.dspXmit_freq == freq) && !Crossbar_DSPXmit_IsIdle())
+		return false;
+	return !((bSte || crossbar.dmaPlay_freq == freq) && dmaPlay.isRunning);
+}
+
+/**
+ * Return true if the transfers of a clock only send DMA Play samples
+ * to the DAC, so that several of them can be done in one span.
+ */
+static bool Crossbar_Batch_IsDMAPlayOnly(bool bClock25)
+{
+	Uint32 freq = bClock25 ? CROSSBAR_FREQ_25MHZ : CROSSBAR_FREQ_32MHZ;
+
+	if (crossbar.isInSteFreqMode) {
+		if (!bClock25)
+			return false;
 	}
-	else {
-		cycles_32 -= crossbar.pendingCyclesOver32;
-		crossbar.pendingCyclesOver32 = 0;
+	else if (crossbar.dmaPlay_freq != freq) {
+		return false;
 	}
 
-	CycInt_AddRelativeInterrupt(cycles_32, INT_CPU_CYCLE, INTERRUPT_CROSSBAR_32MHZ);
+	if (bClock25 && (adc.isConnectedToCodec || adc.isConnectedToDsp || adc.isConnectedToDma))
+		return false;
+	if ((crossbar.isInSteFreqMode || crossbar.dspXmit_freq == freq) && !Crossbar_DSPXmit_IsIdle())
+		return false;
+
+	return dmaPlay.isRunning && dmaPlay.isConnectedToCodec && !dmaPlay.isConnectedToDma
+	       && !dmaPlay.isConnectedToDsp && !dmaPlay.isConnectedToDspInHandShakeMode;
 }
 
+/**
+ * Make the interrupt of a batch happen at its next frame.
+ */
+static void Crossbar_Batch_Truncate(struct batch_s *batch)
+{
+	Uint32 last = batch->frames - 1;
+
+	if (batch->done >= last || !CycInt_InterruptActive(batch->id))
+		return;
+
+	CycInt_ModifyInterrupt((int)batch->due[batch->done] - (int)batch->due[last],
+	                       INT_CPU_CYCLE, batch->id);
+	*batch->cycles_counter = batch->counter[batch->done];
+	*batch->pendingCyclesOver = batch->pending[batch->done];
+	batch->frames = batch->done + 1;
+}
 
 /**
- * Execute transfers for internal 25 Mhz clock.
+ * Do the transfers of both clocks which were due before now, in the order
+ * they would have happened. With bTruncate, the settings are going to
+ * change, so the batches end at their next frame.
  */
-void Crossbar_InterruptHandler_25Mhz(void)
+static void Crossbar_Batch_Sync(bool bTruncate)
 {
-	/* How many cycle was this sound interrupt delayed (>= 0) */
-	crossbar.pendingCyclesOver25 += -INT_CONVERT_FROM_INTERNAL ( PendingInterruptCount , INT_CPU_CYCLE );
+	struct batch_s *batch;
+	int late25, late32, late, other;
+	bool bClock25;
+	Uint32 n;
+
+	while (1) {
+		late25 = Crossbar_Batch_Late(&batch25, batch25.done);
+		late32 = Crossbar_Batch_Late(&batch32, batch32.done);
+		if (late25 < 0 && late32 < 0)
+			break;
 
-	/* Remove this interrupt from list and re-order */
-	CycInt_AcknowledgeInterrupt();
+		bClock25 = late25 >= late32;
+		batch = bClock25 ? &batch25 : &batch32;
+		other = bClock25 ? late32 : late25;
+		if (Crossbar_Batch_IsIdle(!bClock25))
+			other = -1;
+
+		/* Count the following frames of this clock due before the other one */
+		n = 1;
+		if (Crossbar_Batch_IsDMAPlayOnly(bClock25)) {
+			while (batch->done + n < batch->frames) {
+				late = Crossbar_Batch_Late(batch, batch->done + n);
+				if (late < 0 || late < other || (late == other && !bClock25))
+					break;
+				n++;
+			}
+		}
 
+		if (n > 1 && (n = Crossbar_DMAPlay_TransferSpan(n)) > 0) {
+			if (bClock25)
+				Crossbar_ADCXmit_Skip(n);
+			batch->done += n;
+		}
+		else if (bClock25) {
+			Crossbar_Transfer_25Mhz();
+			batch25.done++;
+		}
+		else {
+			Crossbar_Transfer_32Mhz();
+			batch32.done++;
+		}
+	}
+
+	if (bTruncate) {
+		Crossbar_Batch_Truncate(&batch25);
+		Crossbar_Batch_Truncate(&batch32);
+	}
+}
+
+/**
+ * Start internal 25 Mhz clock interrupt.
+ */
+static void Crossbar_Start_InterruptHandler_25Mhz(void)
+{
+	Uint32 cycles_25;
+
+	cycles_25 = Crossbar_Batch_Start(&batch25, Crossbar_Batch_Frames(true),
+	                                 crossbar.clock25_cycles, crossbar.clock25_cycles_decimal);
+
+	CycInt_AddRelativeInterrupt(cycles_25, INT_CPU_CYCLE, INTERRUPT_CROSSBAR_25MHZ);
+}
+
+/**
+ * Start internal 32 Mhz clock interrupt.
+ */
+static void Crossbar_Start_InterruptHandler_32Mhz(void)
+{
+	Uint32 cycles_32;
+
+	cycles_32 = Crossbar_Batch_Start(&batch32, Crossbar_Batch_Frames(false),
+	                                 crossbar.clock32_cycles, crossbar.clock32_cycles_decimal);
+
+	CycInt_AddRelativeInterrupt(cycles_32, INT_CPU_CYCLE, INTERRUPT_CROSSBAR_32MHZ);
+}
+
+
+/**
+ * Execute transfers of one frame for internal 25 Mhz clock.
+ */
+static void Crossbar_Transfer_25Mhz(void)
+{
 	/* If transfer mode is in Ste mode, use only this clock for all the transfers */
 	if (crossbar.isInSteFreqMode) {
 		Crossbar_Process_DSPXmit_Transfer();
 		Crossbar_Process_DMAPlay_Transfer();
 		Crossbar_Process_ADCXmit_Transfer();
-		
-		/* Restart the 25 Mhz clock interrupt */
-		Crossbar_Start_InterruptHandler_25Mhz();
 		return;
 	}
 
@@ -1270,28 +1553,16 @@ void Crossbar_InterruptHandler_25Mhz(void)
 	if (crossbar.dmaPlay_freq == CROSSBAR_FREQ_25MHZ) {
 		Crossbar_Process_DMAPlay_Transfer();
 	}
-
-	/* Restart the 25 Mhz clock interrupt */
-	Crossbar_Start_InterruptHandler_25Mhz();
 }
 
 /**
- * Execute transfers for internal 32 Mhz clock.
+ * Execute transfers of one frame for internal 32 Mhz clock.
  */
-void Crossbar_InterruptHandler_32Mhz(void)
+static void Crossbar_Transfer_32Mhz(void)
 {
-	/* How many cycle was this sound interrupt delayed (>= 0) */
-	crossbar.pendingCyclesOver32 += -INT_CONVERT_FROM_INTERNAL ( PendingInterruptCount , INT_CPU_CYCLE );
-
-	/* Remove this interrupt from list and re-order */
-	CycInt_AcknowledgeInterrupt();
-
 	/* If transfer mode is in Ste mode, don't use this clock for all the transfers */
-	if (crossbar.isInSteFreqMode) {
-		/* Restart the 32 Mhz clock interrupt */
-		Crossbar_Start_InterruptHandler_32Mhz();
+	if (crossbar.isInSteFreqMode)
 		return;
-	}
 	
 	/* DSP Play transfer ? */
 	if (crossbar.dspXmit_freq == CROSSBAR_FREQ_32MHZ) {
@@ -1302,6 +1573,43 @@ void Crossbar_InterruptHandler_32Mhz(void)
 	if (crossbar.dmaPlay_freq == CROSSBAR_FREQ_32MHZ) {
 		Crossbar_Process_DMAPlay_Transfer();
 	}
+}
+
+/**
+ * Execute transfers for internal 25 Mhz clock.
+ */
+void Crossbar_InterruptHandler_25Mhz(void)
+{
+	/* Transfer the previous frames of the batch */
+	Crossbar_Batch_Sync(false);
+
+	/* How many cycle was this sound interrupt delayed (>= 0) */
+	crossbar.pendingCyclesOver25 += -INT_CONVERT_FROM_INTERNAL ( PendingInterruptCount , INT_CPU_CYCLE );
+
+	/* Remove this interrupt from list and re-order */
+	CycInt_AcknowledgeInterrupt();
+
+	Crossbar_Transfer_25Mhz();
+
+	/* Restart the 25 Mhz clock interrupt */
+	Crossbar_Start_InterruptHandler_25Mhz();
+}
+
+/**
+ * Execute transfers for internal 32 Mhz clock.
+ */
+void Crossbar_InterruptHandler_32Mhz(void)
+{
+	/* Transfer the previous frames of the batch */
+	Crossbar_Batch_Sync(false);
+
+	/* How many cycle was this sound interrupt delayed (>= 0) */
+	crossbar.pendingCyclesOver32 += -INT_CONVERT_FROM_INTERNAL ( PendingInterruptCount , INT_CPU_CYCLE );
+
+	/* Remove this interrupt from list and re-order */
+	CycInt_AcknowledgeInterrupt();
+
+	Crossbar_Transfer_32Mhz();
 
 	/* Restart the 32 Mhz clock interrupt */
 	Crossbar_Start_InterruptHandler_32Mhz();
@@ -1549,6 +1857,55 @@ static void Crossbar_Process_DMAPlay_Transfer(void)
 	}
 }
 
+/**
+ * Do up to n DMA Play transfers to the DAC, reading the samples straight
+ * from ST-RAM. Stop before the transfer which reaches the end of the frame,
+ * it has to raise the end of frame interrupts.
+ * Return the number of transfers done.
+ */
+static Uint32 Crossbar_DMAPlay_TransferSpan(Uint32 n)
+{
+	Uint8 *pFrameStart = &STRam[dmaPlay.frameStartAddr];
+	Uint32 counter = dmaPlay.frameCounter;
+	Uint32 currentFrame = dmaPlay.currentFrame;
+	Uint32 tracks = crossbar.playTracks * 2;
+	Uint32 left = crossbar.track_monitored * 2;
+	Sint16 value;
+	Uint32 i;
+
+	for (i = 0; i < n; i++) {
+		if (crossbar.is16Bits) {
+			if (counter + 2 >= dmaPlay.frameLen)
+				break;
+			value = (Sint16)do_get_mem_word(&pFrameStart[counter]);
+			counter += 2;
+		}
+		else {
+			value = (Sint8)pFrameStart[counter] * 64;
+			if (crossbar.isStereo || (currentFrame & 1) == 0) {
+				if (counter + 1 >= dmaPlay.frameLen)
+					break;
+				counter += 1;
+			}
+		}
+
+		if (currentFrame == left) {
+			dac.buffer_left[dac.writePosition] = value;
+		}
+		else if (currentFrame == left + 1) {
+			dac.buffer_right[dac.writePosition] = value;
+			dac.writePosition = (dac.writePosition + 1) % (DACBUFFER_SIZE);
+		}
+
+		if (++currentFrame >= tracks)
+			currentFrame = 0;
+	}
+
+	dmaPlay.frameCounter = counter;
+	dmaPlay.currentFrame = currentFrame;
+	return i;
+}
+
 /**
  * Function called when DmaPlay is in handshake mode */
 void Crossbar_DmaPlayInHandShakeMode(void)
@@ -1591,6 +1948,7 @@ void Crossbar_SendDataToDmaRecord(Sint16 value)
 	}
 	
 	pFrameStart = (Sint8 *)&STRam[dmaRecord.frameStartAddr];
+	STMemory_MarkDirty(dmaRecord.frameStartAddr + dmaRecord.frameCounter, 2);
 
 	/* 16 bits stereo mode ? */
 	if (crossbar.is16Bits) {
@@ -1688,26 +2046,67 @@ void Crossbar_DmaRecordInHandShakeMode_Frame(Uint32 frame)
  *    - micro_bufferL : left track recorded by the microphone
  *    - micro_bufferR : right track recorded by the microphone
  *    - microBuffer_size : buffers size
+ *    - latency : number of microphone frames to keep ahead of the ADC
+ *
+ * The microphone and the emulated ADC run from different clocks. To
+ * keep the delay steady, the conversion step is slightly adjusted
+ * (by at most 0.5%) according to how far the ADC buffer filling is
+ * from the wanted latency, and datas which would overrun the ADC
+ * reader are dropped.
  */
-void Crossbar_GetMicrophoneDatas(Sint16 *micro_bufferL, Sint16 *micro_bufferR, Uint32 microBuffer_size)
+void Crossbar_GetMicrophoneDatas(Sint16 *micro_bufferL, Sint16 *micro_bufferR, Uint32 microBuffer_size, Uint32 latency)
 {
-	Uint32 i, size, bufferIndex;
-	Sint64 idxPos;
+	static Sint64 idxPos;			/* fractional position in the microphone datas */
+	Uint32 bufferIndex, reader, size, target;
+	Sint32 fill;
+	Sint64 step, correction;
 
-	size = (microBuffer_size * crossbar.frequence_ratio>>32);
-	bufferIndex = 0;
-	idxPos = 0;
+	if (crossbar.frequence_ratio2 == 0)
+		return;
+
+	/* ADC transfers read from readPosition, direct ADC->DAC mixing from its own position */
+	if (adc.isConnectedToCodec || adc.isConnectedToDsp || adc.isConnectedToDma)
+		reader = adc.readPosition;
+	else
+		reader = crossbar.adc2dac_readBufferPosition;
+	fill = (adc.writePosition - reader + DACBUFFER_SIZE) % DACBUFFER_SIZE;
+
+	size = (microBuffer_size * crossbar.frequence_ratio) >> 32;
+	target = (latency * crossbar.frequence_ratio) >> 32;
+	if (target < size)
+		target = size;
+	if (target > DACBUFFER_SIZE / 3)
+		target = DACBUFFER_SIZE / 3;
+	if (target == 0)
+		return;
+
+	/* No room left before the reader: drop this buffer */
+	if (fill + size >= DACBUFFER_SIZE - size)
+		return;
+
+	correction = (crossbar.frequence_ratio2 * (fill - (Sint32)target)) / (Sint32)(8 * target);
+	if (correction > crossbar.frequence_ratio2 / 200)
+		correction = crossbar.frequence_ratio2 / 200;
+	else if (correction < -crossbar.frequence_ratio2 / 200)
+		correction = -crossbar.frequence_ratio2 / 200;
+	step = crossbar.frequence_ratio2 + correction;
+
+	bufferIndex = idxPos >> 32;
+	idxPos &= 0xffffffff;			/* only keep the fractional part */
 
-	for (i = 0; i < size; i++) {
+	while (bufferIndex < microBuffer_size) {
 		adc.writePosition = (adc.writePosition + 1) % DACBUFFER_SIZE;
 
 		adc.buffer_left[adc.writePosition] = micro_bufferL[bufferIndex];
 		adc.buffer_right[adc.writePosition] = micro_bufferR[bufferIndex]; 
 
-		idxPos += crossbar.frequence_ratio2;
-		bufferIndex += idxPos>>32;	
-		idxPos  &= 0xffffffff;			/* only keep the fractional part */
+		idxPos += step;
+		bufferIndex += idxPos >> 32;
+		idxPos &= 0xffffffff;
 	}
+
+	/* Frames stepped over past this buffer are skipped in the next one */
+	idxPos += (Sint64)(bufferIndex - microBuffer_size) << 32;
 }
 
 /**
@@ -1748,6 +2147,15 @@ static void Crossbar_Process_ADCXmit_Transfer(void)
 	}
 }
 
+/**
+ * Do n ADC transfers which aren't sent anywhere.
+ */
+static void Crossbar_ADCXmit_Skip(Uint32 n)
+{
+	adc.readPosition = (adc.readPosition + (n + 1 - adc.wordCount) / 2) % DACBUFFER_SIZE;
+	adc.wordCount ^= n & 1;
+}
+
 
 /*----------------------------------------------------------------------*/
 /*-------------------------- DAC processing ----------------------------*/
@@ -1781,9 +2189,18 @@ static void Crossbar_SendDataToDAC(Sint16 value, Uint16 sample_pos)
 void Crossbar_GenerateSamples(int nMixBufIdx, int nSamplesToGenerate)
 {
 	int i, j, nBufIdx;
-	int n;
+	int n, nBlock, nIn, nBlockStart = 0, nBlockEnd = 0;
 	Sint16 adc_leftData, adc_rightData, dac_LeftData, dac_RightData;
-	
+	Sint16 (*pIn)[2];
+	Sint16 Frames[RESAMPLE_MAX_INPUT][2];
+
+	/* The DAC buffer needs the frames transferred until now */
+	Crossbar_Batch_Sync(false);
+
+	/* Bring in what the microphone recorded meanwhile */
+	if (crossbar.microphone_ADC_is_started)
+		Microphone_Update();
+
 	if (crossbar.isDacMuted) {
 		/* Output sound = 0 */
 		for (i = 0; i < nSamplesToGenerate; i++) {
@@ -1798,10 +2215,30 @@ void Crossbar_GenerateSamples(int nMixBufIdx, int nSamplesToGenerate)
 		return;
 	}
 
+	Resample_SetStep(&DacResampler, crossbar.frequence_ratio);
+
 	for (i = 0; i < nSamplesToGenerate; i++)
 	{
 		nBufIdx = (nMixBufIdx + i) % MIXBUFFER_SIZE;
 
+		if (i == nBlockEnd) {
+			/* Resample the next block of crossbar samples from dac's buffer */
+			nBlock = Resample_BlockSize(&DacResampler, nSamplesToGenerate - i);
+			nIn = Resample_InputCount(&DacResampler, dac.readPosition_float, nBlock);
+			pIn = Resample_Input(&DacResampler);
+			for (j = 0; j < nIn; j++) {
+				pIn[j][0] = dac.buffer_left[dac.readPosition];
+				pIn[j][1] = dac.buffer_right[dac.readPosition];
+				// It becomes safe to zero old data as tail has moved
+				dac.buffer_left[dac.readPosition] = 0;
+				dac.buffer_right[dac.readPosition] = 0;
+				dac.readPosition = (dac.readPosition + 1) % DACBUFFER_SIZE;
+			}
+			Resample_Process(&DacResampler, &dac.readPosition_float, nIn, Frames, nBlock);
+			nBlockStart = i;
+			nBlockEnd = i + nBlock;
+		}
+
 		/* ADC mixing (PSG sound or microphone sound for left and right channels) */
 		switch (crossbar.codecAdcInput) {
 			case 0:
@@ -1842,36 +2279,21 @@ void Crossbar_GenerateSamples(int nMixBufIdx, int nSamplesToGenerate)
 				break;
 			case 2:
 				/* Crossbar->DAC sound only */
-				dac_LeftData = dac.buffer_left[dac.readPosition];
-				dac_RightData = dac.buffer_right[dac.readPosition];
+				dac_LeftData = Frames[i - nBlockStart][0];
+				dac_RightData = Frames[i - nBlockStart][1];
 				break;
 			case 3:
 				/* Mixing Direct ADC sound with Crossbar->DMA sound */
 				dac_LeftData = ((adc_leftData * crossbar.gainSettingLeft) >> 14) +
-						dac.buffer_left[dac.readPosition];
+						Frames[i - nBlockStart][0];
 				dac_RightData = ((adc_rightData  * crossbar.gainSettingRight) >> 14) +
-						dac.buffer_right[dac.readPosition];
+						Frames[i - nBlockStart][1];
 				break;
 		}
 			
 		MixBuffer[nBufIdx][0] = (dac_LeftData * crossbar.attenuationSettingLeft) >> 16;
 		MixBuffer[nBufIdx][1] = (dac_RightData * crossbar.attenuationSettingRight) >> 16;
 
-		/* Upgrade dac's buffer read pointer */ 
-		dac.readPosition_float += crossbar.frequence_ratio;
-		n = dac.readPosition_float >> 32;				/* number of samples to skip */
-
-		if (n) {
-			// It becomes safe to zero old data if tail has moved
-			for (j=0; j<n; j++) {
-				dac.buffer_left[(dac.readPosition+j) % DACBUFFER_SIZE] = 0;
-				dac.buffer_right[(dac.readPosition+j) % DACBUFFER_SIZE] = 0;
-			}
-		}
-
-		dac.readPosition = (dac.readPosition + n) % DACBUFFER_SIZE;
-		dac.readPosition_float &= 0xffffffff;			/* only keep the fractional part */
-		
 		/* Upgrade adc->dac's buffer read pointer */ 
 		crossbar.adc2dac_readBufferPosition_float += crossbar.frequence_ratio;
 		n = crossbar.adc2dac_readBufferPosition_float >> 32;				/* number of samples to skip */
@@ -29,6 +29,7 @@ void Crossbar_Compute_Ratio(void);
 extern void Crossbar_GenerateSamples(int nMixBufIdx, int nSamplesToGenerate);
 
 extern void Crossbar_Reset(bool bCold);
+extern void Crossbar_MemorySnapShot_Prepare(void);
 extern void Crossbar_MemorySnapShot_Capture(bool bSave);
 
 /* Called by ioMemTabFalcon.c */
@@ -78,7 +79,7 @@ void Crossbar_DmaPlayInHandShakeMode(void);
 void Crossbar_DmaRecordInHandShakeMode_Frame(Uint32 frame);
 
 /* Called by microphone.c */
-void Crossbar_GetMicrophoneDatas(Sint16 *micro_bufferL, Sint16 *micro_bufferR, Uint32 microBuffer_size);
+void Crossbar_GetMicrophoneDatas(Sint16 *micro_bufferL, Sint16 *micro_bufferR, Uint32 microBuffer_size, Uint32 latency);
 
 /* called by debugInfo.c */
 extern void Crossbar_Info(Uint32 dummy);
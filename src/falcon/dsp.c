@@ -21,6 +21,7 @@
 */
 
 #include <ctype.h>
+#include <stddef.h>
 
 #include "main.h"
 #include "sysdeps.h"
@@ -32,6 +33,9 @@
 #include "configuration.h"
 #include "cycInt.h"
 #include "m68000.h"
+#include "perf.h"
+#include "stats.h"
+#include "stMemory.h"
 
 #if ENABLE_DSP_EMU
 #include "debugdsp.h"
@@ -39,6 +43,11 @@
 #include "dsp_disasm.h"
 #endif
 
+#if ENABLE_DSP_EMU && HAVE_PTHREAD_H
+#define DSP_THREAD 1
+#include <pthread.h>
+#endif
+
 #define DEBUG 0
 #if DEBUG
 #define Dprintf(a) printf a
@@ -60,13 +69,81 @@ static const char* x_ext_memory_addr_name[] = {
 };
 
 static Sint32 save_cycles;
+
+/* In batched mode, the DSP cycles are collected until there are at least
+ * dsp_quantum of them, or until the host side accesses DSP state (host
+ * port, SSI, reset, debugger), and only then run at once. These are the
+ * same sync points at which the DSP thread is synced. The DSP output to
+ * the host side then happens up to a quantum later than in lockstep, but
+ * the same way on every run.
+ */
+static Sint32 dsp_quantum;		/* 0 runs DSP in lockstep with the CPU */
+static Sint32 dsp_deferred_cycles;	/* cycles not yet run or handed to worker */
+
+/* Backup of the DSP RAM for snapshots which leave RAM out (run-ahead),
+ * indexed by DSP RAM block like dsp_core_ram_written */
+static Uint32 *dsp_ram_backup;
 #endif
 
 static bool bDspDebugging;
 
+#if DSP_THREAD
+/* With DSP thread, the CPU hands the DSP cycles accumulated during
+ * a quantum to a worker thread and continues emulation while the
+ * worker runs them. Before the host side accesses DSP state (host
+ * port, SSI, reset, snapshot, debugger), DSP_Sync() waits for
+ * the worker and runs the rest of the cycles itself, so the DSP is
+ * exactly in sync at those points.
+ *
+ * What DSP code does towards the host side while on the worker
+ * (host interrupt, SSI handshake to crossbar) is queued, and done
+ * by the CPU thread when it collects the worker results. If the
+ * queue gets full, the worker stops until the CPU thread has done
+ * the queued output, like it would have been done inline.
+ */
+#define DSP_THREAD_QUANTUM	2048	/* DSP cycles handed to worker at once */
+#define DSP_THREAD_MAX_EVENTS	16
+
+typedef enum {
+	DSP_EVENT_HOST_INTERRUPT,
+	DSP_EVENT_SSI_SC1,
+	DSP_EVENT_SSI_SC2
+} dsp_thread_event_t;
+
+static pthread_t dsp_thread;
+static pthread_mutex_t dsp_thread_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t dsp_thread_cond = PTHREAD_COND_INITIALIZER;
+static bool bDspThreadActive;		/* worker thread exists */
+static bool bDspThreadBusy;		/* worker runs save_cycles (protected by lock) */
+static bool bDspThreadQuit;		/* worker should exit (protected by lock) */
+static bool bDspThreadFull;		/* worker waits for its output to be done (protected by lock) */
+static bool bDspOnThread;		/* DSP code is executed by worker */
+static bool bDspInline;			/* DSP code is executed by CPU thread */
+
+static struct {
+	dsp_thread_event_t type;
+	Uint32 value;
+} dsp_thread_events[DSP_THREAD_MAX_EVENTS];
+static int dsp_thread_nevents;		/* events queued by worker */
+
+static void DSP_ThreadWait(void);
+static bool DSP_ThreadDefer(dsp_thread_event_t type, Uint32 value);
+#endif
+#if ENABLE_DSP_EMU
+static void DSP_Sync(void);
+#else
+#define DSP_Sync()
+#endif
+
 bool bDspEnabled = false;
 bool bDspHostInterruptPending = false;
 
+#if ENABLE_DSP_EMU
+/* Set when the last instruction run was a loop polling the host port or
+ * SSI (see dsp56k_idle_loop()), its cycles are then in instr_cycle */
+static bool bDspIdle;
+#endif
+
 
 /**
  * Trigger HREQ interrupt at the host CPU.
@@ -74,6 +151,10 @@ bool bDspHostInterruptPending = false;
 #if ENABLE_DSP_EMU
 static void DSP_TriggerHostInterrupt(void)
 {
+#if DSP_THREAD
+	if (DSP_ThreadDefer(DSP_EVENT_HOST_INTERRUPT, 0))
+		return;
+#endif
 	bDspHostInterruptPending = true;
 	M68000_SetSpecial(SPCFLAG_DSP);
 }
@@ -113,6 +194,9 @@ void DSP_Init(void)
 	dsp56k_init_cpu();
 	bDspEnabled = true;
 	save_cycles = 0;
+	dsp_deferred_cycles = 0;
+	DSP_SetQuantum(ConfigureParams.System.nDSPQuantum);
+	DSP_EnableThread(ConfigureParams.System.bDSPThread);
 #endif
 }
 
@@ -123,8 +207,10 @@ void DSP_Init(void)
 void DSP_UnInit(void)
 {
 #if ENABLE_DSP_EMU
+	DSP_RamBackupFree();
 	if (!bDspEnabled)
 		return;
+	DSP_EnableThread(false);
 	dsp_core_shutdown();
 	bDspEnabled = false;
 #endif
@@ -137,35 +223,242 @@ void DSP_UnInit(void)
 void DSP_Reset(void)
 {
 #if ENABLE_DSP_EMU
+	dsp_deferred_cycles = 0;		/* reset discards what they would do */
+	DSP_Sync();
 	dsp_core_reset();
 	bDspHostInterruptPending = false;
+	bDspIdle = false;
 	save_cycles = 0;
 #endif
 }
 
 
+#if ENABLE_DSP_EMU
+/**
+ * Return the DSP RAM words of the given block (see DSP_RAMEXT_BLOCK()
+ * and DSP_RAMINT_BLOCK()).
+ */
+static Uint32 *DSP_RamBlock(int block)
+{
+	if (block < DSP_RAMEXT_BLOCKS)
+		return &dsp_core.ramext[block << DSP_RAM_BLOCK_SHIFT];
+	return &dsp_core.ramint[0][(block - DSP_RAMEXT_BLOCKS) << DSP_RAM_BLOCK_SHIFT];
+}
+
+/**
+ * Copy the DSP RAM blocks written since the last backup save or restore
+ * between DSP RAM and the backup, in the given direction.
+ */
+static void DSP_RamBackupCopy(bool bSave)
+{
+	Uint32 *backup;
+	int block;
+
+	for (block = 0; block < DSP_RAM_BLOCKS; block++)
+	{
+		if (!(dsp_core_ram_written[block >> 5] & (1 << (block & 31))))
+			continue;
+		backup = &dsp_ram_backup[block << DSP_RAM_BLOCK_SHIFT];
+		if (bSave)
+			memcpy(backup, DSP_RamBlock(block), DSP_RAM_BLOCK_SIZE * sizeof(Uint32));
+		else
+			memcpy(DSP_RamBlock(block), backup, DSP_RAM_BLOCK_SIZE * sizeof(Uint32));
+	}
+	memset(dsp_core_ram_written, 0, sizeof(dsp_core_ram_written));
+}
+
+/**
+ * Save or restore the DSP RAM, packed to 3 bytes per 24-bit word.
+ */
+static void DSP_RamSnapShot_Capture(bool bSave)
+{
+	Uint8 packed[3 * DSP_RAM_BLOCK_SIZE];
+	Uint32 *ram;
+	int block, i;
+
+	for (block = 0; block < DSP_RAM_BLOCKS; block++)
+	{
+		ram = DSP_RamBlock(block);
+		if (bSave)
+		{
+			for (i = 0; i < DSP_RAM_BLOCK_SIZE; i++)
+			{
+				packed[3*i] = ram[i] >> 16;
+				packed[3*i+1] = ram[i] >> 8;
+				packed[3*i+2] = ram[i];
+			}
+		}
+		MemorySnapShot_Store(packed, sizeof(packed));
+		if (!bSave)
+		{
+			for (i = 0; i < DSP_RAM_BLOCK_SIZE; i++)
+				ram[i] = (packed[3*i] << 16) | (packed[3*i+1] << 8) | packed[3*i+2];
+		}
+	}
+}
+#endif
+
+/**
+ * Free the DSP RAM backup.
+ */
+void DSP_RamBackupFree(void)
+{
+#if ENABLE_DSP_EMU
+	free(dsp_ram_backup);
+	dsp_ram_backup = NULL;
+	memset(dsp_core_ram_written, 0xff, sizeof(dsp_core_ram_written));
+#endif
+}
+
 /**
  * Save/Restore snapshot of CPU variables ('MemorySnapShot_Store' handles type)
+ *
+ * The DSP RAM isn't stored as part of dsp_core: it's packed to 24-bit
+ * words. For snapshots which leave RAM out (STMemory_bSnapShotRamBackup,
+ * run-ahead) it's kept in a backup instead, of which only the blocks
+ * written since it was last in sync with the DSP RAM are copied.
  */
 void DSP_MemorySnapShot_Capture(bool bSave)
 {
 #if ENABLE_DSP_EMU
-	if (!bSave)
+	bool bInBackup = false;
+
+	/* cycles deferred in batched mode are stored instead of run,
+	 * so that saving snapshots doesn't change the emulation
+	 */
+	if (bSave) {
+#if DSP_THREAD
+		if (bDspThreadActive)
+			DSP_Sync();
+#endif
+	} else
 		DSP_Reset();
 
 	MemorySnapShot_Store(&bDspEnabled, sizeof(bDspEnabled));
-	MemorySnapShot_Store(&dsp_core, sizeof(dsp_core));
+	MemorySnapShot_Store(&dsp_core, offsetof(dsp_core_t, ramext));
+	MemorySnapShot_Store(dsp_core.rom, sizeof(dsp_core.rom));
+	MemorySnapShot_Store((Uint8 *)&dsp_core + offsetof(dsp_core_t, periph),
+	                     sizeof(dsp_core) - offsetof(dsp_core_t, periph));
 	MemorySnapShot_Store(&save_cycles, sizeof(save_cycles));
+	MemorySnapShot_Store(&dsp_deferred_cycles, sizeof(dsp_deferred_cycles));
+
+	if (STMemory_bSnapShotRamBackup)
+	{
+		if (bSave && !dsp_ram_backup)
+		{
+			dsp_ram_backup = malloc(DSP_RAM_BLOCKS * DSP_RAM_BLOCK_SIZE * sizeof(Uint32));
+			memset(dsp_core_ram_written, 0xff, sizeof(dsp_core_ram_written));
+		}
+		bInBackup = dsp_ram_backup != NULL;
+		MemorySnapShot_Store(&bInBackup, sizeof(bInBackup));
+	}
+
+	if (bInBackup)
+	{
+		if (dsp_ram_backup)
+			DSP_RamBackupCopy(bSave);
+	}
+	else
+	{
+		DSP_RamSnapShot_Capture(bSave);
+		if (!bSave)
+			memset(dsp_core_ram_written, 0xff, sizeof(dsp_core_ram_written));
+	}
+
+	if (!bSave)
+		dsp56k_flush_decode_cache();
 #endif
 }
 
+#if ENABLE_DSP_EMU
+static Uint32 dsp_instr_count;	/* executed instructions, for statistics */
+
+/**
+ * Account the iterations of the DSP polling loop which fit in save_cycles
+ * without running them, as they would do nothing else
+ */
+static void DSP_SkipIdleLoop(void)
+{
+	int n = (save_cycles + dsp_core.instr_cycle - 1) / dsp_core.instr_cycle;
+
+	save_cycles -= n * dsp_core.instr_cycle;
+	dsp_instr_count += n;
+}
+
+/**
+ * Run DSP instructions for the cycles in save_cycles
+ */
+static void DSP_RunCycles(void)
+{
+	/* still waiting for the host port or SSI? */
+	if (bDspIdle && dsp56k_idle_loop())
+	{
+		DSP_SkipIdleLoop();
+		return;
+	}
+	bDspIdle = false;
+
+	while (save_cycles > 0)
+	{
+		Uint16 pc = dsp_core.pc;
+
+		dsp56k_execute_instruction();
+		save_cycles -= dsp_core.instr_cycle;
+		dsp_instr_count++;
+		if (dsp_core.pc == pc && dsp56k_idle_loop())
+		{
+			bDspIdle = true;
+			if (save_cycles > 0)
+				DSP_SkipIdleLoop();
+			break;
+		}
+#if DSP_THREAD
+		/* let CPU thread do the queued output without delay */
+		if (dsp_thread_nevents)
+			break;
+#endif
+	}
+}
+#endif
+
 /**
  * Run DSP for certain cycles
  */
 void DSP_Run(int nHostCycles)
 {
 #if ENABLE_DSP_EMU
-        save_cycles += nHostCycles * 2;
+#if DSP_THREAD
+	if (bDspThreadActive) {
+		dsp_deferred_cycles += nHostCycles * 2;
+		if (dsp_deferred_cycles < DSP_THREAD_QUANTUM)
+			return;
+
+		/* collect previous quantum and hand over the next one */
+		Perf_Begin(PERF_DSP);
+		DSP_ThreadWait();
+		Perf_End();
+		Stats_Add(STATS_DSP_INSTR, dsp_instr_count);
+		dsp_instr_count = 0;
+		save_cycles += dsp_deferred_cycles;
+		dsp_deferred_cycles = 0;
+		if (dsp_core.running == 0 || save_cycles <= 0)
+			return;
+
+		pthread_mutex_lock(&dsp_thread_lock);
+		bDspThreadBusy = true;
+		pthread_cond_broadcast(&dsp_thread_cond);
+		pthread_mutex_unlock(&dsp_thread_lock);
+		return;
+	}
+#endif
+	if (dsp_quantum && !bDspDebugging) {
+		dsp_deferred_cycles += nHostCycles * 2;
+		if (dsp_deferred_cycles < dsp_quantum)
+			return;
+		save_cycles += dsp_deferred_cycles;
+		dsp_deferred_cycles = 0;
+	} else
+		save_cycles += nHostCycles * 2;
 
         if (dsp_core.running == 0)
                 return;
@@ -174,6 +467,7 @@ void DSP_Run(int nHostCycles)
                 return;
 
         if (unlikely(bDspDebugging)) {
+                bDspIdle = false;
                 while (save_cycles > 0)
                 {
                         dsp56k_execute_instruction();
@@ -182,22 +476,224 @@ void DSP_Run(int nHostCycles)
                 }
         } else {
 		//	fprintf(stderr, "--> %d\n", save_cycles);
-                while (save_cycles > 0)
-                {
-                        dsp56k_execute_instruction();
-                        save_cycles -= dsp_core.instr_cycle;
-                }
+		Perf_Begin(PERF_DSP);
+		DSP_RunCycles();
+		Perf_End();
+		Stats_Add(STATS_DSP_INSTR, dsp_instr_count);
+		dsp_instr_count = 0;
         }
 
 #endif
 } 
 
+#if ENABLE_DSP_EMU
+/**
+ * Bring DSP up to date with the CPU, before host side accesses DSP state
+ */
+static void DSP_Sync(void)
+{
+#if DSP_THREAD
+	/* nothing to do when called back from DSP code
+	 * already running on this thread
+	 */
+	if (bDspInline)
+		return;
+	if (bDspThreadActive)
+		DSP_ThreadWait();
+#endif
+	if (dsp_deferred_cycles == 0)
+		return;
+
+	save_cycles += dsp_deferred_cycles;
+	dsp_deferred_cycles = 0;
+	if (dsp_core.running) {
+#if DSP_THREAD
+		bDspInline = true;
+#endif
+		DSP_RunCycles();
+#if DSP_THREAD
+		bDspInline = false;
+#endif
+	}
+}
+#endif
+
+/**
+ * Set how many DSP cycles are collected before running them at once,
+ * 0 runs the DSP in lockstep with the CPU
+ */
+void DSP_SetQuantum(int nCycles)
+{
+#if ENABLE_DSP_EMU
+	DSP_Sync();
+	dsp_quantum = nCycles > 0 ? nCycles : 0;
+#endif
+}
+
+#if DSP_THREAD
+/**
+ * Queue given DSP output towards host side, if DSP runs on the worker.
+ * Return false if it doesn't, i.e. output can be done directly.
+ */
+static bool DSP_ThreadDefer(dsp_thread_event_t type, Uint32 value)
+{
+	if (!bDspOnThread)
+		return false;
+
+	if (dsp_thread_nevents == DSP_THREAD_MAX_EVENTS) {
+		pthread_mutex_lock(&dsp_thread_lock);
+		bDspThreadFull = true;
+		pthread_cond_broadcast(&dsp_thread_cond);
+		while (bDspThreadFull)
+			pthread_cond_wait(&dsp_thread_cond, &dsp_thread_lock);
+		pthread_mutex_unlock(&dsp_thread_lock);
+	}
+	dsp_thread_events[dsp_thread_nevents].type = type;
+	dsp_thread_events[dsp_thread_nevents].value = value;
+	dsp_thread_nevents++;
+	return true;
+}
+
+/**
+ * Do the DSP output queued by the worker.
+ * Called from CPU thread, while worker is idle.
+ */
+static void DSP_ThreadDeliver(void)
+{
+	int i, n = dsp_thread_nevents;
+
+	/* crossbar may call back to DSP, which may queue nothing
+	 * anymore as it runs now on this thread
+	 */
+	dsp_thread_nevents = 0;
+	for (i = 0; i < n; i++) {
+		switch (dsp_thread_events[i].type) {
+		case DSP_EVENT_HOST_INTERRUPT:
+			DSP_TriggerHostInterrupt();
+			break;
+		case DSP_EVENT_SSI_SC1:
+			DSP_SsiTransmit_SC1();
+			break;
+		case DSP_EVENT_SSI_SC2:
+			DSP_SsiTransmit_SC2(dsp_thread_events[i].value);
+			break;
+		}
+	}
+}
+
+/**
+ * Do the output of the worker stopped in the middle of its cycles,
+ * because its queue is full. DSP code is then in the middle of an
+ * instruction, as when the output is done inline.
+ */
+static void DSP_ThreadDeliverFull(void)
+{
+	bDspOnThread = false;
+	bDspInline = true;
+	DSP_ThreadDeliver();
+	bDspInline = false;
+	bDspOnThread = true;
+}
+
+/**
+ * Wait until worker has run the cycles handed to it and do its output.
+ */
+static void DSP_ThreadWait(void)
+{
+	pthread_mutex_lock(&dsp_thread_lock);
+	while (bDspThreadBusy) {
+		if (bDspThreadFull) {
+			pthread_mutex_unlock(&dsp_thread_lock);
+			DSP_ThreadDeliverFull();
+			pthread_mutex_lock(&dsp_thread_lock);
+			bDspThreadFull = false;
+			pthread_cond_broadcast(&dsp_thread_cond);
+			continue;
+		}
+		pthread_cond_wait(&dsp_thread_cond, &dsp_thread_lock);
+	}
+	pthread_mutex_unlock(&dsp_thread_lock);
+
+	if (dsp_thread_nevents)
+		DSP_ThreadDeliver();
+}
+
+/**
+ * DSP worker thread
+ */
+static void *DSP_ThreadFunc(void *arg)
+{
+	pthread_mutex_lock(&dsp_thread_lock);
+	for (;;) {
+		while (!bDspThreadBusy && !bDspThreadQuit)
+			pthread_cond_wait(&dsp_thread_cond, &dsp_thread_lock);
+		if (bDspThreadQuit)
+			break;
+		pthread_mutex_unlock(&dsp_thread_lock);
+
+		bDspOnThread = true;
+		DSP_RunCycles();
+		bDspOnThread = false;
+
+		pthread_mutex_lock(&dsp_thread_lock);
+		bDspThreadBusy = false;
+		pthread_cond_broadcast(&dsp_thread_cond);
+	}
+	pthread_mutex_unlock(&dsp_thread_lock);
+	return NULL;
+}
+#endif
+
+/**
+ * Enable/disable running DSP on its own host thread.
+ * Thread isn't used while DSP is debugged.
+ */
+void DSP_EnableThread(bool enabled)
+{
+#if DSP_THREAD
+	/* Thread timing would make the emulation differ between runs */
+	enabled = enabled && bDspEnabled && !bDspDebugging
+	          && !ConfigureParams.System.bDeterministic;
+	if (enabled == bDspThreadActive)
+		return;
+
+	if (enabled) {
+		DSP_Sync();
+		bDspThreadQuit = false;
+		bDspThreadBusy = false;
+		if (pthread_create(&dsp_thread, NULL, DSP_ThreadFunc, NULL) != 0) {
+			fprintf(stderr, "Failed to create DSP thread, running DSP inline.\n");
+			return;
+		}
+		bDspThreadActive = true;
+	} else {
+		DSP_Sync();
+		pthread_mutex_lock(&dsp_thread_lock);
+		bDspThreadQuit = true;
+		pthread_cond_broadcast(&dsp_thread_cond);
+		pthread_mutex_unlock(&dsp_thread_lock);
+		pthread_join(dsp_thread, NULL);
+		bDspThreadActive = false;
+	}
+#endif
+}
+
 /**
  * Enable/disable DSP debugging mode
  */
 void DSP_SetDebugging(bool enabled)
 {
+#if DSP_THREAD
+	if (enabled)
+		DSP_EnableThread(false);
+#endif
+	if (enabled)
+		DSP_Sync();
 	bDspDebugging = enabled;
+#if DSP_THREAD
+	if (!enabled)
+		DSP_EnableThread(ConfigureParams.System.bDSPThread);
+#endif
 }
 
 /**
@@ -206,6 +702,7 @@ void DSP_SetDebugging(bool enabled)
 Uint16 DSP_GetPC(void)
 {
 #if ENABLE_DSP_EMU
+	DSP_Sync();
 	if (bDspEnabled)
 		return dsp_core.pc;
 	else
@@ -225,6 +722,7 @@ Uint16 DSP_GetNextPC(Uint16 pc)
 
 	if (!bDspEnabled)
 		return 0;
+	DSP_Sync();
 
 	/* Save DSP context */
 	memcpy(&dsp_core_save, &dsp_core, sizeof(dsp_core));
@@ -267,6 +765,7 @@ Uint16 DSP_DisasmAddress(FILE *out, Uint16 lowerAdr, Uint16 UpperAdr)
 #if ENABLE_DSP_EMU
 	Uint16 dsp_pc;
 
+	DSP_Sync();
 	for (dsp_pc=lowerAdr; dsp_pc<=UpperAdr; dsp_pc++) {
 		dsp_pc += dsp56k_execute_one_disasm_instruction(out, dsp_pc);
 	}
@@ -418,6 +917,7 @@ void DSP_Info(Uint32 dummy)
 	int i, j;
 	const char *stackname[] = { "SSH", "SSL" };
 
+	DSP_Sync();
 	fputs("DSP core information:\n", stderr);
 
 	for (i = 0; i < ARRAYSIZE(stackname); i++) {
@@ -456,6 +956,7 @@ void DSP_DisasmRegisters(void)
 #if ENABLE_DSP_EMU
 	Uint32 i;
 
+	DSP_Sync();
 	fprintf(stderr,"A: A2: %02x  A1: %06x  A0: %06x\n",
 		dsp_core.registers[DSP_REG_A2], dsp_core.registers[DSP_REG_A1], dsp_core.registers[DSP_REG_A0]);
 	fprintf(stderr,"B: B2: %02x  B1: %06x  B0: %06x\n",
@@ -619,6 +1120,7 @@ bool DSP_Disasm_SetRegister(const char *arg, Uint32 value)
 	Uint32 *addr, mask, sp_value;
 	int bits;
 
+	DSP_Sync();
 	/* first check registers needing special handling... */
 	if (arg[0]=='S' || arg[0]=='s') {
 		if (arg[1]=='P' || arg[1]=='p') {
@@ -673,6 +1175,7 @@ bool DSP_Disasm_SetRegister(const char *arg, Uint32 value)
 Uint32 DSP_SsiReadTxValue(void)
 {
 #if ENABLE_DSP_EMU
+	DSP_Sync();
 	return dsp_core.ssi.transmit_value;
 #else
 	return 0;
@@ -685,6 +1188,7 @@ Uint32 DSP_SsiReadTxValue(void)
 void DSP_SsiWriteRxValue(Uint32 value)
 {
 #if ENABLE_DSP_EMU
+	DSP_Sync();
 	dsp_core.ssi.received_value = value & 0xffffff;
 #endif
 }
@@ -696,6 +1200,7 @@ void DSP_SsiWriteRxValue(Uint32 value)
 void DSP_SsiReceive_SC0(void)
 {
 #if ENABLE_DSP_EMU
+	DSP_Sync();
 	dsp_core_ssi_Receive_SC0();
 #endif
 }
@@ -709,6 +1214,7 @@ void DSP_SsiTransmit_SC0(void)
 void DSP_SsiReceive_SC1(Uint32 FrameCounter)
 {
 #if ENABLE_DSP_EMU
+	DSP_Sync();
 	dsp_core_ssi_Receive_SC1(FrameCounter);
 #endif
 }
@@ -716,6 +1222,10 @@ void DSP_SsiReceive_SC1(Uint32 FrameCounter)
 void DSP_SsiTransmit_SC1(void)
 {
 #if ENABLE_DSP_EMU
+#if DSP_THREAD
+	if (DSP_ThreadDefer(DSP_EVENT_SSI_SC1, 0))
+		return;
+#endif
 	Crossbar_DmaPlayInHandShakeMode();
 #endif
 }
@@ -723,6 +1233,7 @@ void DSP_SsiTransmit_SC1(void)
 void DSP_SsiReceive_SC2(Uint32 FrameCounter)
 {
 #if ENABLE_DSP_EMU
+	DSP_Sync();
 	dsp_core_ssi_Receive_SC2(FrameCounter);
 #endif
 }
@@ -730,6 +1241,10 @@ void DSP_SsiReceive_SC2(Uint32 FrameCounter)
 void DSP_SsiTransmit_SC2(Uint32 frame)
 {
 #if ENABLE_DSP_EMU
+#if DSP_THREAD
+	if (DSP_ThreadDefer(DSP_EVENT_SSI_SC2, frame))
+		return;
+#endif
 	Crossbar_DmaRecordInHandShakeMode_Frame(frame);
 #endif
 }
@@ -737,6 +1252,7 @@ void DSP_SsiTransmit_SC2(Uint32 frame)
 void DSP_SsiReceive_SCK(void)
 {
 #if ENABLE_DSP_EMU
+	DSP_Sync();
 	dsp_core_ssi_Receive_SCK();
 #endif
 }
@@ -757,7 +1273,8 @@ void DSP_HandleReadAccess(void)
 	Uint32 addr;
 	Uint8 value;
 	bool multi_access = false; 
-	
+
+	DSP_Sync();
 	for (addr = IoAccessBaseAddress; addr < IoAccessBaseAddress+nIoMemAccessSize; addr++)
 	{
 #if ENABLE_DSP_EMU
@@ -785,6 +1302,7 @@ void DSP_HandleWriteAccess(void)
 	Uint32 addr;
 	bool multi_access = false; 
 
+	DSP_Sync();
 	for (addr = IoAccessBaseAddress; addr < IoAccessBaseAddress+nIoMemAccessSize; addr++)
 	{
 #if ENABLE_DSP_EMU
@@ -797,3 +1315,19 @@ void DSP_HandleWriteAccess(void)
 		multi_access = true;
 	}
 }
+
+/**
+ * Return the host interface status register ($ffa202) like the 68030
+ * would read it, but without the side effects of an IO access.
+ * Reading this register doesn't change the DSP state, so the CPU uses
+ * this to run loops polling it without interpreting them.
+ */
+Uint8 DSP_PeekHostStatus(void)
+{
+#if ENABLE_DSP_EMU
+	DSP_Sync();
+	return dsp_core.hostport[CPU_HOST_ISR];
+#else
+	return 0xff;
+#endif
+}
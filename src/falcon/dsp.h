@@ -38,9 +38,12 @@ extern void DSP_Init(void);
 extern void DSP_UnInit(void);
 extern void DSP_Reset(void);
 extern void DSP_Run(int nHostCycles);
+extern void DSP_SetQuantum(int nCycles);
+extern void DSP_EnableThread(bool enabled);
 
 /* Save Dsp state to snapshot */
 extern void DSP_MemorySnapShot_Capture(bool bSave);
+extern void DSP_RamBackupFree(void);
 
 /* Dsp Debugger commands */
 extern void DSP_SetDebugging(bool enabled);
@@ -71,6 +74,7 @@ extern void DSP_SsiTransmit_SCK(void);
 /* Dsp Host interface commands */
 extern void DSP_HandleReadAccess(void);
 extern void DSP_HandleWriteAccess(void);
+extern Uint8 DSP_PeekHostStatus(void);
 extern Uint16 DSP_Get_HREQ(void);
 
 
@@ -35,6 +35,7 @@
 
 /*--- the DSP core itself ---*/
 dsp_core_t dsp_core;
+Uint32 dsp_core_ram_written[(DSP_RAM_BLOCKS + 31) / 32];
 
 /*--- Defines ---*/
 #ifndef M_PI
@@ -56,6 +57,7 @@ void dsp_core_init(void (*host_interrupt)(void))
 
 	dsp_host_interrupt = host_interrupt;
 	memset(&dsp_core, 0, sizeof(dsp_core_t));
+	memset(dsp_core_ram_written, 0xff, sizeof(dsp_core_ram_written));
 
 	/* Initialize Y:rom[0x0100-0x01ff] with a sin table */
 	for (i=0;i<256;i++) {
@@ -656,7 +658,9 @@ void dsp_core_write_host(int addr, Uint8 value)
 					(dsp_core.hostport[CPU_HOST_TXH]<<16) |
 					(dsp_core.hostport[CPU_HOST_TXM]<<8) |
 					 dsp_core.hostport[CPU_HOST_TXL];
-				
+				dsp56k_invalidate_decoded(dsp_core.bootstrap_pos);
+				DSP_RAM_MARK_WRITTEN(DSP_RAMINT_BLOCK(DSP_SPACE_P, dsp_core.bootstrap_pos));
+
 				LOG_TRACE(TRACE_DSP_STATE, "Dsp: bootstrap p:0x%04x = 0x%06x\n",
 								dsp_core.bootstrap_pos,
 								dsp_core.ramint[DSP_SPACE_P][dsp_core.bootstrap_pos]);
@@ -30,6 +30,16 @@ extern "C" {
 
 #define DSP_RAMSIZE 32768
 
+/* Written DSP RAM is tracked in blocks of 256 words: the external RAM
+ * blocks first, then 2 blocks for each internal RAM (x:, y:, p:) */
+#define DSP_RAM_BLOCK_SHIFT	8
+#define DSP_RAM_BLOCK_SIZE	(1 << DSP_RAM_BLOCK_SHIFT)
+#define DSP_RAMEXT_BLOCKS	(DSP_RAMSIZE >> DSP_RAM_BLOCK_SHIFT)
+#define DSP_RAM_BLOCKS		(DSP_RAMEXT_BLOCKS + 3 * (512 >> DSP_RAM_BLOCK_SHIFT))
+#define DSP_RAMEXT_BLOCK(address)	((address) >> DSP_RAM_BLOCK_SHIFT)
+#define DSP_RAMINT_BLOCK(space, address) \
+	(DSP_RAMEXT_BLOCKS + (((space) * 512 + (address)) >> DSP_RAM_BLOCK_SHIFT))
+
 /* Host port, CPU side */
 #define CPU_HOST_ICR	0x00
 #define CPU_HOST_CVR	0x01
@@ -244,6 +254,11 @@ struct dsp_core_s {
 /* DSP */
 extern dsp_core_t dsp_core;
 
+/* DSP RAM blocks written since the snapshot backup was last in sync */
+extern Uint32 dsp_core_ram_written[(DSP_RAM_BLOCKS + 31) / 32];
+#define DSP_RAM_MARK_WRITTEN(block) \
+	(dsp_core_ram_written[(block) >> 5] |= 1 << ((block) & 31))
+
 /* Emulator call these to init/stop/reset DSP emulation */
 extern void dsp_core_init(void (*host_interrupt)(void));
 extern void dsp_core_shutdown(void);
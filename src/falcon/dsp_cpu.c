@@ -113,6 +113,9 @@ static Uint32 cur_inst_len;	/* =0:jump, >0:increment */
 /* Current instruction */
 static Uint32 cur_inst;
 
+/* ALU operation of current instruction (used by parallel moves) */
+static void (*cur_alu)(void);
+
 /* Counts the number of access to the external memory for one instruction */
 static Uint16 access_to_ext_memory;
 
@@ -240,6 +243,8 @@ static int dsp_pm_read_accu24(int numreg, Uint32 *dest);
 static void dsp_pm_0(void);
 static void dsp_pm_1(void);
 static void dsp_pm_2(void);
+static void dsp_pm_2_0(void);
+static void dsp_pm_2_1(void);
 static void dsp_pm_2_2(void);
 static void dsp_pm_3(void);
 static void dsp_pm_4(void);
@@ -698,6 +703,29 @@ static const dsp_interrupt_t dsp_interrupt[12] = {
 	{DSP_INTER_SSI_TRX_DATA	,	0x10, 2, "SSI tramsmit"}
 };
 
+/* Decoded instructions cache.
+ * P memory has 0x200 words of internal RAM, the rest of the 64K address
+ * space is the (mirrored) external RAM, which X and Y external RAM
+ * overlap too. Cache has a slot for each of these physical words, so
+ * that every write to them can invalidate the matching slot.
+ */
+#define DSP_DECODE_SLOTS	(0x200 + DSP_RAMSIZE)
+
+typedef struct {
+	dsp_emul_t handler;	/* NULL = not decoded yet */
+	dsp_emul_t alu;		/* ALU operation of parallel move */
+	Uint32 opcode;
+} dsp_decoded_t;
+
+static dsp_decoded_t dsp_decode_cache[DSP_DECODE_SLOTS];
+
+static inline Uint32 dsp_decode_slot_p(Uint16 address)
+{
+	if (address < 0x200)
+		return address;
+	return 0x200 + (address & (DSP_RAMSIZE-1));
+}
+
 
 /**********************************
  *	Emulator kernel
@@ -705,6 +733,7 @@ static const dsp_interrupt_t dsp_interrupt[12] = {
 
 void dsp56k_init_cpu(void)
 {
+	dsp56k_flush_decode_cache();
 	dsp56k_disasm_init();
 	isDsp_in_disasm_mode = false;
 	start_time = SDL_GetTicks();
@@ -719,6 +748,19 @@ Uint16 dsp56k_execute_one_disasm_instruction(FILE *out, Uint16 pc)
 	dsp_core_t *ptr1, *ptr2;
 	static dsp_core_t dsp_core_save;
 	Uint16 instruction_length;
+	Uint16 cycles;
+
+	/* Other instructions than the one at PC don't run with the current
+	 * registers anyway, so their earlier disassembly and cycles can be
+	 * shown again, as long as their words are the same */
+	if (pc != dsp_core.pc && (instruction_length = dsp56k_disasm_cached(pc, &cycles))) {
+		Uint16 instr_cycle = dsp_core.instr_cycle;
+
+		dsp_core.instr_cycle = cycles;
+		fprintf(out, "%s", dsp56k_getInstructionText());
+		dsp_core.instr_cycle = instr_cycle;
+		return instruction_length - 1;
+	}
 
 	ptr1 = &dsp_core;
 	ptr2 = &dsp_core_save;
@@ -739,9 +781,14 @@ Uint16 dsp56k_execute_one_disasm_instruction(FILE *out, Uint16 pc)
 	dsp56k_execute_instruction();
 
 	fprintf(out, "%s", dsp56k_getInstructionText());
+	cycles = dsp_core.instr_cycle;
 
 	/* Restore DSP context after executing instruction */
 	memcpy(ptr1, ptr2, sizeof(dsp_core));
+	dsp56k_disasm_cache_store(cycles);
+
+	/* Instruction may have changed P memory that got restored above */
+	dsp56k_flush_decode_cache();
 	
 	/* Unset DSP in disasm mode */
 	isDsp_in_disasm_mode = false;
@@ -749,8 +796,99 @@ Uint16 dsp56k_execute_one_disasm_instruction(FILE *out, Uint16 pc)
 	return instruction_length;
 }
 
+/**
+ * Invalidate all decoded instructions, for when P memory content
+ * is changed behind write_memory_raw() back
+ */
+void dsp56k_flush_decode_cache(void)
+{
+	memset(dsp_decode_cache, 0, sizeof(dsp_decode_cache));
+}
+
+/**
+ * Invalidate decoded instruction of given P memory address
+ */
+void dsp56k_invalidate_decoded(Uint16 address)
+{
+	dsp_decode_cache[dsp_decode_slot_p(address)].handler = NULL;
+}
+
+/**
+ * Decode given instruction word into its handler
+ */
+static void dsp_decode_instruction(dsp_decoded_t *decoded, Uint32 opcode)
+{
+	Uint32 value;
+
+	decoded->opcode = opcode;
+	decoded->alu = opcodes_alu[opcode & BITMASK(8)];
+	if (opcode >= 0x100000) {
+		/* Parallel move instruction, resolve also the move
+		 * variant, as dsp_pm_2() and dsp_pm_4() would do */
+		decoded->handler = opcodes_parmove[(opcode>>20) & BITMASK(4)];
+		if (decoded->handler == dsp_pm_2) {
+			if ((opcode & 0xffff00) == 0x200000)
+				decoded->handler = dsp_pm_2_0;
+			else if ((opcode & 0xffe000) == 0x204000)
+				decoded->handler = dsp_pm_2_1;
+			else if ((opcode & 0xfc0000) == 0x200000)
+				decoded->handler = dsp_pm_2_2;
+			else
+				decoded->handler = dsp_pm_3;
+		} else if (decoded->handler == dsp_pm_4) {
+			if ((opcode & 0xf40000) == 0x400000)
+				decoded->handler = dsp_pm_4x;
+			else
+				decoded->handler = dsp_pm_5;
+		}
+		return;
+	}
+
+	value = (opcode >> 11) & (BITMASK(6) << 3);
+	value += (opcode >> 5) & BITMASK(3);
+	decoded->handler = opcodes8h[value];
+	if (decoded->handler != opcode8h_0) {
+		return;
+	}
+
+	/* Resolve also the sub-opcodes, as opcode8h_0() would do */
+	switch(opcode) {
+		case 0x000000:
+			decoded->handler = dsp_nop;
+			break;
+		case 0x000004:
+			decoded->handler = dsp_rti;
+			break;
+		case 0x000005:
+			decoded->handler = dsp_illegal;
+			break;
+		case 0x000006:
+			decoded->handler = dsp_swi;
+			break;
+		case 0x00000c:
+			decoded->handler = dsp_rts;
+			break;
+		case 0x000084:
+			decoded->handler = dsp_reset;
+			break;
+		case 0x000086:
+			decoded->handler = dsp_wait;
+			break;
+		case 0x000087:
+			decoded->handler = dsp_stop;
+			break;
+		case 0x00008c:
+			decoded->handler = dsp_enddo;
+			break;
+		default:
+			decoded->handler = dsp_undefined;
+			break;
+	}
+}
+
 void dsp56k_execute_instruction(void)
 {
+	dsp_decoded_t *decoded;
 	Uint32 value;
 	Uint32 disasm_return = 0;
 	disasm_memory_ptr = 0;
@@ -758,9 +896,17 @@ void dsp56k_execute_instruction(void)
 	/* Initialise the number of access to the external memory for this instruction */
 	access_to_ext_memory = 0;
 	
-	/* Decode and execute current instruction */
-	cur_inst = read_memory_p(dsp_core.pc);
-	
+	/* Get decoded current instruction */
+	decoded = &dsp_decode_cache[dsp_decode_slot_p(dsp_core.pc)];
+	if (unlikely(decoded->handler == NULL)) {
+		dsp_decode_instruction(decoded, read_memory_p(dsp_core.pc));
+	}
+	cur_inst = decoded->opcode;
+	cur_alu = decoded->alu;
+	if (dsp_core.pc >= 0x200) {
+		access_to_ext_memory |= 1 << EXT_P_MEMORY;
+	}
+
 	/* Initialize instruction size and cycle counter */
 	cur_inst_len = 1;
 	dsp_core.instr_cycle = 2;
@@ -778,14 +924,8 @@ void dsp56k_execute_instruction(void)
 		}
 	}
 			
-	if (cur_inst < 0x100000) {
-		value = (cur_inst >> 11) & (BITMASK(6) << 3);
-		value += (cur_inst >> 5) & BITMASK(3);
-		opcodes8h[value]();
-	} else {
-		/* Do parallel move read */
-		opcodes_parmove[(cur_inst>>20) & BITMASK(4)]();
-	}
+	/* Execute it */
+	decoded->handler();
 
 	/* Add the waitstate due to external memory access */
 	/* (2 extra cycles per extra access to the external memory after the first one */
@@ -843,6 +983,46 @@ void dsp56k_execute_instruction(void)
 #endif
 }
 
+/**
+ * Return 1 if the DSP sits in a one instruction loop polling a peripheral
+ * register, like "jclr #0,x:<<$ffe9,*" waiting for the host port or the
+ * SSI, which branches to itself again, and there is no interrupt to take.
+ * Running the instruction then changes nothing but the cycles, until the
+ * host or SSI side changes the register (which happens only between
+ * DSP_Run() calls).
+ */
+int dsp56k_idle_loop(void)
+{
+	dsp_decoded_t *decoded;
+	Uint32 addr, space, value;
+
+	if (dsp_core.loop_rep || dsp_core.interrupt_state != DSP_INTERRUPT_NONE
+	    || dsp_core.interrupt_counter != 0
+	    || (dsp_core.registers[DSP_REG_SR] & (1<<DSP_SR_T))
+	    || LOG_TRACE_LEVEL(TRACE_DSP_DISASM))
+		return 0;
+
+	/* the last instruction of a DO loop jumps back to the loop start */
+	if ((dsp_core.registers[DSP_REG_SR] & (1<<DSP_SR_LF))
+	    && dsp_core.pc == dsp_core.registers[DSP_REG_LA] + 1)
+		return 0;
+
+	decoded = &dsp_decode_cache[dsp_decode_slot_p(dsp_core.pc)];
+	if (decoded->handler != dsp_jclr_pp && decoded->handler != dsp_jset_pp)
+		return 0;
+	if (read_memory_p(dsp_core.pc+1) != dsp_core.pc)
+		return 0;
+
+	/* reading these registers changes the DSP state */
+	space = (decoded->opcode>>6) & 1;
+	addr = (decoded->opcode>>8) & BITMASK(6);
+	if (space == DSP_SPACE_X && (addr == DSP_HOST_HRX || addr == DSP_SSI_RX))
+		return 0;
+
+	value = (dsp_core.periph[space][addr] >> (decoded->opcode & BITMASK(5))) & 1;
+	return decoded->handler == dsp_jclr_pp ? !value : value;
+}
+
 /**********************************
  *	Update the PC
 **********************************/
@@ -1327,6 +1507,10 @@ static void write_memory_raw(int space, Uint16 address, Uint32 value)
 	/* Internal RAM ? */
 	if (address < 0x100) {
 		dsp_core.ramint[space][address] = value;
+		DSP_RAM_MARK_WRITTEN(DSP_RAMINT_BLOCK(space, address));
+		if (space == DSP_SPACE_P) {
+			dsp_decode_cache[address].handler = NULL;
+		}
 		return;
 	}
 
@@ -1341,6 +1525,8 @@ static void write_memory_raw(int space, Uint16 address, Uint32 value)
 		else {
 			/* Space P RAM */
 			dsp_core.ramint[DSP_SPACE_P][address] = value;
+			DSP_RAM_MARK_WRITTEN(DSP_RAMINT_BLOCK(DSP_SPACE_P, address));
+			dsp_decode_cache[address].handler = NULL;
 			return;
 		}
 	}
@@ -1368,6 +1554,8 @@ static void write_memory_raw(int space, Uint16 address, Uint32 value)
 
 	/* Falcon: External RAM, map X,Y to P */
 	dsp_core.ramext[address & (DSP_RAMSIZE-1)] = value;
+	DSP_RAM_MARK_WRITTEN(DSP_RAMEXT_BLOCK(address & (DSP_RAMSIZE-1)));
+	dsp_decode_cache[0x200 + (address & (DSP_RAMSIZE-1))].handler = NULL;
 }
 
 static void write_memory_disasm(int space, Uint16 address, Uint32 value)
@@ -3479,7 +3667,7 @@ static void dsp_pm_0(void)
 	save_xy0 = dsp_core.registers[DSP_REG_X0+(memspace<<1)];
 
 	/* Execute parallel instruction */
-	opcodes_alu[cur_inst & BITMASK(8)]();
+	cur_alu();
 
 	/* Move [A|B] to [x|y]:ea */	
 	write_memory(memspace, addr, save_accu);
@@ -3550,7 +3738,7 @@ static void dsp_pm_1(void)
 	
 
 	/* Execute parallel instruction */
-	opcodes_alu[cur_inst & BITMASK(8)]();
+	cur_alu();
 
 
 	/* Write parallel move values */
@@ -3586,7 +3774,6 @@ static void dsp_pm_1(void)
 
 static void dsp_pm_2(void)
 {
-	Uint32 dummy;
 /*
 	0010 0000 0000 0000 nop
 	0010 0000 010m mrrr R update
@@ -3594,15 +3781,12 @@ static void dsp_pm_2(void)
 	001d dddd iiii iiii #xx,D
 */
 	if ((cur_inst & 0xffff00) == 0x200000) {
-		/* Execute parallel instruction */
-		opcodes_alu[cur_inst & BITMASK(8)]();
+		dsp_pm_2_0();
 		return;
 	}
 
 	if ((cur_inst & 0xffe000) == 0x204000) {
-		dsp_calc_ea((cur_inst>>8) & BITMASK(5), &dummy);
-		/* Execute parallel instruction */
-		opcodes_alu[cur_inst & BITMASK(8)]();
+		dsp_pm_2_1();
 		return;
 	}
 
@@ -3614,6 +3798,26 @@ static void dsp_pm_2(void)
 	dsp_pm_3();
 }
 
+static void dsp_pm_2_0(void)
+{
+/*
+	0010 0000 0000 0000 nop
+*/
+	/* Execute parallel instruction */
+	cur_alu();
+}
+
+static void dsp_pm_2_1(void)
+{
+	Uint32 dummy;
+/*
+	0010 0000 010m mrrr R update
+*/
+	dsp_calc_ea((cur_inst>>8) & BITMASK(5), &dummy);
+	/* Execute parallel instruction */
+	cur_alu();
+}
+
 static void dsp_pm_2_2(void)
 {
 /*
@@ -3631,7 +3835,7 @@ static void dsp_pm_2_2(void)
 		save_reg = dsp_core.registers[srcreg];
 
 	/* Execute parallel instruction */
-	opcodes_alu[cur_inst & BITMASK(8)]();
+	cur_alu();
 
 	/* Write reg */
 	if (dstreg == DSP_REG_A) {
@@ -3657,7 +3861,7 @@ static void dsp_pm_3(void)
 */
 
 	/* Execute parallel instruction */
-	opcodes_alu[cur_inst & BITMASK(8)]();
+	cur_alu();
 
 	/* Write reg */
 	dstreg = (cur_inst >> 16) & BITMASK(5);
@@ -3796,7 +4000,7 @@ static void dsp_pm_4x(void)
 	}
 
 	/* Execute parallel instruction */
-	opcodes_alu[cur_inst & BITMASK(8)]();
+	cur_alu();
 
 
 	if (cur_inst & (1<<15)) {
@@ -3899,7 +4103,7 @@ static void dsp_pm_5(void)
 
 
 	/* Execute parallel instruction */
-	opcodes_alu[cur_inst & BITMASK(8)]();
+	cur_alu();
 
 	if (cur_inst & (1<<15)) {
 		/* Write D */
@@ -3989,7 +4193,7 @@ static void dsp_pm_8(void)
 
 
 	/* Execute parallel instruction */
-	opcodes_alu[cur_inst & BITMASK(8)]();
+	cur_alu();
 
 	/* Write first parallel move */
 	if (cur_inst & (1<<15)) {
@@ -4042,6 +4246,22 @@ static void dsp_pm_8(void)
 /* source,dest[1] is 47:24 */
 /* source,dest[2] is 23:00 */
 
+/* The 56 bit values are handled as host 64 bit integers */
+#define DSP_MASK56	((((Uint64)1)<<56)-1)
+#define DSP_SIGN56	(((Uint64)1)<<55)
+
+static inline Uint64 dsp_get56(const Uint32 *reg)
+{
+	return ((Uint64)reg[0]<<48) | ((Uint64)reg[1]<<24) | reg[2];
+}
+
+static inline void dsp_set56(Uint32 *reg, Uint64 value)
+{
+	reg[0] = (value>>48) & BITMASK(8);
+	reg[1] = (value>>24) & BITMASK(24);
+	reg[2] = value & BITMASK(24);
+}
+
 static Uint16 dsp_abs56(Uint32 *dest)
 {
 	Uint32 zerodest[3];
@@ -4066,203 +4286,117 @@ static Uint16 dsp_abs56(Uint32 *dest)
 
 static Uint16 dsp_asl56(Uint32 *dest)
 {
+	Uint64 value = dsp_get56(dest);
 	Uint16 overflow, carry;
 
 	/* Shift left dest 1 bit: D<<=1 */
 
-	carry = (dest[0]>>7) & 1;
-
-	dest[0] <<= 1;
-	dest[0] |= (dest[1]>>23) & 1;
-	dest[0] &= BITMASK(8);
-
-	dest[1] <<= 1;
-	dest[1] |= (dest[2]>>23) & 1;
-	dest[1] &= BITMASK(24);
-	
-	dest[2] <<= 1;
-	dest[2] &= BITMASK(24);
+	carry = (value & DSP_SIGN56) != 0;
+	value = (value<<1) & DSP_MASK56;
+	overflow = (carry != ((value & DSP_SIGN56) != 0));
 
-	overflow = (carry != ((dest[0]>>7) & 1));
+	dsp_set56(dest, value);
 
 	return (overflow<<DSP_SR_L)|(overflow<<DSP_SR_V)|(carry<<DSP_SR_C);
 }
 
 static Uint16 dsp_asr56(Uint32 *dest)
 {
+	Uint64 value = dsp_get56(dest);
 	Uint16 carry;
 
 	/* Shift right dest 1 bit: D>>=1 */
 
-	carry = dest[2] & 1;
+	carry = value & 1;
+	value = (value>>1) | (value & DSP_SIGN56);
 
-	dest[2] >>= 1;
-	dest[2] |= (dest[1] & 1)<<23;
-
-	dest[1] >>= 1;
-	dest[1] |= (dest[0] & 1)<<23;
-
-	dest[0] >>= 1;
-	dest[0] |= (dest[0] & (1<<6))<<1;
+	dsp_set56(dest, value);
 
 	return (carry<<DSP_SR_C);
 }
 
 static Uint16 dsp_add56(Uint32 *source, Uint32 *dest)
 {
-	Uint16 overflow, carry, flg_s, flg_d, flg_r;
-
-	flg_s = (source[0]>>7) & 1;
-	flg_d = (dest[0]>>7) & 1;
+	Uint64 s = dsp_get56(source), d = dsp_get56(dest), r;
+	Uint16 overflow, carry;
 
 	/* Add source to dest: D = D+S */
-	dest[2] += source[2];
-	dest[1] += source[1]+((dest[2]>>24) & 1);
-	dest[0] += source[0]+((dest[1]>>24) & 1);
-
-	carry = (dest[0]>>8) & 1;
-
-	dest[2] &= BITMASK(24);
-	dest[1] &= BITMASK(24);
-	dest[0] &= BITMASK(8);
-
-	flg_r = (dest[0]>>7) & 1;
+	r = d + s;
+	carry = (r>>56) & 1;
+	r &= DSP_MASK56;
 
 	/*set overflow*/
-	overflow = (flg_s ^ flg_r) & (flg_d ^ flg_r);
+	overflow = (((s ^ r) & (d ^ r)) & DSP_SIGN56) != 0;
+
+	dsp_set56(dest, r);
 
 	return (overflow<<DSP_SR_L)|(overflow<<DSP_SR_V)|(carry<<DSP_SR_C);
 }
 
 static Uint16 dsp_sub56(Uint32 *source, Uint32 *dest)
 {
-	Uint16 overflow, carry, flg_s, flg_d, flg_r, dest_save;
-
-	dest_save = dest[0];
+	Uint64 s = dsp_get56(source), d = dsp_get56(dest), r;
+	Uint16 overflow, carry;
 
 	/* Subtract source from dest: D = D-S */
-	dest[2] -= source[2];
-	dest[1] -= source[1]+((dest[2]>>24) & 1);
-	dest[0] -= source[0]+((dest[1]>>24) & 1);
-
-	carry = (dest[0]>>8) & 1;
-
-	dest[2] &= BITMASK(24);
-	dest[1] &= BITMASK(24);
-	dest[0] &= BITMASK(8);
-
-	flg_s = (source[0]>>7) & 1;
-	flg_d = (dest_save>>7) & 1;
-	flg_r = (dest[0]>>7) & 1;
+	r = d - s;
+	carry = (r>>56) & 1;
+	r &= DSP_MASK56;
 
 	/* set overflow */
-	overflow = (flg_s ^ flg_d) & (flg_r ^ flg_d);
+	overflow = (((s ^ d) & (r ^ d)) & DSP_SIGN56) != 0;
+
+	dsp_set56(dest, r);
 
 	return (overflow<<DSP_SR_L)|(overflow<<DSP_SR_V)|(carry<<DSP_SR_C);
 }
 
 static void dsp_mul56(Uint32 source1, Uint32 source2, Uint32 *dest, Uint8 signe)
 {
-	Uint32 part[4], zerodest[3], value;
-
-	/* Multiply: D = S1*S2 */
-	if (source1 & (1<<23)) {
-		signe ^= 1;
-		source1 = (1<<24) - source1;
-	}
-	if (source2 & (1<<23)) {
-		signe ^= 1;
-		source2 = (1<<24) - source2;
-	}
-
-	/* bits 0-11 * bits 0-11 */
-	part[0]=(source1 & BITMASK(12))*(source2 & BITMASK(12));
-	/* bits 12-23 * bits 0-11 */
-	part[1]=((source1>>12) & BITMASK(12))*(source2 & BITMASK(12));
-	/* bits 0-11 * bits 12-23 */
-	part[2]=(source1 & BITMASK(12))*((source2>>12)  & BITMASK(12));
-	/* bits 12-23 * bits 12-23 */
-	part[3]=((source1>>12) & BITMASK(12))*((source2>>12) & BITMASK(12));
-
-	/* Calc dest 2 */
-	dest[2] = part[0];
-	dest[2] += (part[1] & BITMASK(12)) << 12;
-	dest[2] += (part[2] & BITMASK(12)) << 12;
-
-	/* Calc dest 1 */
-	dest[1] = (part[1]>>12) & BITMASK(12);
-	dest[1] += (part[2]>>12) & BITMASK(12);
-	dest[1] += part[3];
-
-	/* Calc dest 0 */
-	dest[0] = 0;
-
-	/* Add carries */
-	value = (dest[2]>>24) & BITMASK(8);
-	if (value) {
-		dest[1] += value;
-		dest[2] &= BITMASK(24);
-	}
-	value = (dest[1]>>24) & BITMASK(8);
-	if (value) {
-		dest[0] += value;
-		dest[1] &= BITMASK(24);
-	}
-
-	/* Get rid of extra sign bit */
-	dsp_asl56(dest);
+	Sint64 value;
 
+	/* Multiply: D = S1*S2, fractional, so the extra sign bit is shifted out */
+	value = (Sint64)((Sint32)(source1<<8)>>8) * ((Sint32)(source2<<8)>>8) * 2;
 	if (signe) {
-		zerodest[0] = zerodest[1] = zerodest[2] = 0;
-
-		dsp_sub56(dest, zerodest);
-
-		dest[0] = zerodest[0];
-		dest[1] = zerodest[1];
-		dest[2] = zerodest[2];
+		value = -value;
 	}
+
+	dsp_set56(dest, (Uint64)value);
 }
 
 static void dsp_rnd56(Uint32 *dest)
 {
-	Uint32 rnd_const[3];
-
-	rnd_const[0] = 0;
+	Uint64 value = dsp_get56(dest);
 
 	/* Scaling mode S0 */
 	if (dsp_core.registers[DSP_REG_SR] & (1<<DSP_SR_S0)) {
-		rnd_const[1] = 1;
-		rnd_const[2] = 0;
-		dsp_add56(rnd_const, dest);
+		value = (value + (1<<24)) & DSP_MASK56;
 
-		if ((dest[2]==0) && ((dest[1] & 1) == 0)) {
-			dest[1] &= (0xffffff - 0x3);
+		if ((value & BITMASK(25)) == 0) {
+			value &= ~(Uint64)(1<<25);
 		}
-		dest[1] &= 0xfffffe;
-		dest[2]=0;
+		value &= ~(Uint64)BITMASK(25);
 	}
 	/* Scaling mode S1 */
 	else if (dsp_core.registers[DSP_REG_SR] & (1<<DSP_SR_S1)) {
-		rnd_const[1] = 0;
-		rnd_const[2] = (1<<22);
-		dsp_add56(rnd_const, dest);
-   
-		if ((dest[2] & 0x7fffff) == 0){
-			dest[2] = 0;
+		value = (value + (1<<22)) & DSP_MASK56;
+
+		if ((value & BITMASK(23)) == 0) {
+			value &= ~(Uint64)BITMASK(24);
 		}
-		dest[2] &= 0x800000;
+		value &= ~(Uint64)BITMASK(23);
 	}
 	/* No Scaling */
 	else {
-		rnd_const[1] = 0;
-		rnd_const[2] = (1<<23);
-		dsp_add56(rnd_const, dest);
+		value = (value + (1<<23)) & DSP_MASK56;
 
-		if (dest[2] == 0) {
-			dest[1] &= 0xfffffe;
+		if ((value & BITMASK(24)) == 0) {
+			value &= ~(Uint64)(1<<24);
 		}
-		dest[2]=0;
+		value &= ~(Uint64)BITMASK(24);
 	}
+
+	dsp_set56(dest, value);
 }
 
 /**********************************
@@ -114,6 +114,9 @@ extern "C" {
 extern void dsp56k_init_cpu(void);		/* Set dsp_core to use */
 extern void dsp56k_execute_instruction(void);	/* Execute 1 instruction */
 extern Uint16 dsp56k_execute_one_disasm_instruction(FILE *out, Uint16 pc);	/* Execute 1 instruction in disasm mode */
+extern void dsp56k_flush_decode_cache(void);		/* P memory changed outside of DSP code */
+extern void dsp56k_invalidate_decoded(Uint16 address);	/* P memory word changed outside of DSP code */
+extern int dsp56k_idle_loop(void);		/* DSP polls a peripheral register */
 
 /* Interrupt relative functions */
 void dsp_add_interrupt(Uint16 inter);
@@ -59,11 +59,28 @@ static bool isLooping;
 /* Used to display dc instead of unknown instruction for illegal opcodes */
 static bool isInDisasmMode;
 
+/* Disassembled instructions with their cycles, so that showing the same
+ * code again doesn't need to execute every instruction again. Entries
+ * are checked against the current instruction words when used. */
+#define DISASM_CACHE_SIZE 1024	/* must be a power of 2 */
+
+typedef struct {
+	Uint32 inst;
+	Uint32 inst2;		/* second word, if any */
+	Uint16 pc;
+	Uint16 len;		/* 0 = unused entry */
+	Uint16 cycles;
+	char str_instr[sizeof(str_instr)];
+} dsp_disasm_cache_t;
+
+static dsp_disasm_cache_t disasm_cache[DISASM_CACHE_SIZE];
+
 void dsp56k_disasm_init(void)
 {
 	prev_inst_pc = 0x10000;		/* Init to an invalid value */
 	isLooping = false;
 	isInDisasmMode = false;
+	memset(disasm_cache, 0, sizeof(disasm_cache));
 }
 
 /**********************************
@@ -536,6 +553,46 @@ Uint16 dsp56k_disasm(dsp_trace_disasm_t mode)
 	return disasm_cur_inst_len;
 }
 
+/**
+ * Make the instruction at given address the current one from the
+ * disassembly cache, if it's there and its words didn't change.
+ * Return its length and set its cycles, or return 0.
+ */
+Uint16 dsp56k_disasm_cached(Uint16 pc, Uint16 *cycles)
+{
+	dsp_disasm_cache_t *entry = &disasm_cache[pc & (DISASM_CACHE_SIZE-1)];
+
+	if (entry->len == 0 || entry->pc != pc || entry->inst != read_memory(pc)
+	    || (entry->len > 1 && entry->inst2 != read_memory(pc + 1))) {
+		return 0;
+	}
+
+	isInDisasmMode = true;
+	prev_inst_pc = pc;
+	isLooping = false;
+	cur_inst = entry->inst;
+	disasm_cur_inst_len = entry->len;
+	strcpy(str_instr, entry->str_instr);
+	*cycles = entry->cycles;
+	return entry->len;
+}
+
+/**
+ * Add the instruction disassembled last, with its given cycles,
+ * to the disassembly cache
+ */
+void dsp56k_disasm_cache_store(Uint16 cycles)
+{
+	dsp_disasm_cache_t *entry = &disasm_cache[prev_inst_pc & (DISASM_CACHE_SIZE-1)];
+
+	entry->pc = prev_inst_pc;
+	entry->inst = cur_inst;
+	entry->inst2 = read_memory(prev_inst_pc + 1);
+	entry->len = disasm_cur_inst_len;
+	entry->cycles = cycles;
+	strcpy(entry->str_instr, str_instr);
+}
+
 /**
  * dsp56k_getInstrText : return the disasembled instructions
  */
@@ -35,6 +35,8 @@ typedef enum {
 extern void dsp56k_disasm_init(void);
 extern Uint16 dsp56k_disasm(dsp_trace_disasm_t value);
 extern const char* dsp56k_getInstructionText(void);
+extern Uint16 dsp56k_disasm_cached(Uint16 pc, Uint16 *cycles);
+extern void dsp56k_disasm_cache_store(Uint16 cycles);
 
 /* Registers change */
 extern void dsp56k_disasm_reg_save(void);
@@ -301,6 +301,12 @@ Uint32 HostScreen_getPaletteColor(Uint8 idx)
 	return palette.native[idx];
 }
 
+/* All 256 native colors, for looking up whole lines of pixels */
+const Uint32 *HostScreen_getPalette(void)
+{
+	return palette.native;
+}
+
 void HostScreen_updatePalette(int colorCount)
 {
 	SDL_SetColors( sdlscrn, palette.standard, 0, colorCount );
@@ -21,6 +21,22 @@
 #include "log.h"
 
 #define FRAMES_PER_BUFFER (64)
+#define MICRO_RING_BLOCKS (64)		/* must be a power of 2 */
+#define MICRO_DEFAULT_LATENCY (0.010)	/* in seconds, if the device doesn't suggest one */
+
+/* The PortAudio callback runs on its own thread: it only fills
+ * a single producer / single consumer ring of timestamped blocks,
+ * which the emulation thread drains into the crossbar ADC from
+ * Microphone_Update(). Neither side ever waits on the other.
+ */
+#define MICRO_RING_LOAD(x)	__atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+#define MICRO_RING_STORE(x,v)	__atomic_store_n(&(x), (v), __ATOMIC_RELEASE)
+
+typedef struct {
+	Sint16 frames[FRAMES_PER_BUFFER][2];
+	Uint32 nFrames;
+	PaTime adcTime;			/* capture time of the first frame */
+} MICRO_BLOCK;
 
 /* Static functions */
 static bool Microphone_Error (void);
@@ -38,9 +54,14 @@ static PaStream *micro_stream;
 static PaError  micro_err;
 
 static int   micro_sampleRate;
+static PaTime micro_latency;		/* capture latency kept in the ADC, in seconds */
 static Sint16 micro_buffer_L[FRAMES_PER_BUFFER];	/* left buffer */
 static Sint16 micro_buffer_R[FRAMES_PER_BUFFER];	/* right buffer */
 
+static MICRO_BLOCK micro_ring[MICRO_RING_BLOCKS];
+static Uint32 micro_ringWrite;		/* free running, only changed by the callback */
+static Uint32 micro_ringRead;		/* free running, only changed by the emulation */
+
 
 /* This routine will be called by the PortAudio engine when audio is needed.
 ** It may be called at interrupt level on some machines so don't do anything
@@ -52,31 +73,74 @@ static int Microphone_Callback (const void *inputBuffer, void *outputBuffer,
                            PaStreamCallbackFlags statusFlags,
                            void *userData)
 {
-	unsigned int i;
-	const Sint16 *in = inputBuffer;
-	
-	Sint16 *out_L = (Sint16*)micro_buffer_L;
-	Sint16 *out_R = (Sint16*)micro_buffer_R;
+	MICRO_BLOCK *block;
+	Uint32 write = micro_ringWrite;
 
-	if (inputBuffer == NULL) {
-		memset(micro_buffer_L, 0, sizeof(micro_buffer_L));
-		memset(micro_buffer_R, 0, sizeof(micro_buffer_R));
-	}
-	else {
-		for (i=0; i<framesPerBuffer; i++) {
-			*out_L ++ = *in++;	/* left data */
-			*out_R ++ = *in++;	/* right data */
-		}
-	}
+	/* Ring full: the emulation doesn't keep up, drop the newest datas */
+	if (write - MICRO_RING_LOAD(micro_ringRead) >= MICRO_RING_BLOCKS)
+		return paContinue;
+
+	if (framesPerBuffer > FRAMES_PER_BUFFER)
+		framesPerBuffer = FRAMES_PER_BUFFER;
+
+	block = &micro_ring[write % MICRO_RING_BLOCKS];
+	if (inputBuffer == NULL)
+		memset(block->frames, 0, framesPerBuffer * sizeof(block->frames[0]));
+	else
+		memcpy(block->frames, inputBuffer, framesPerBuffer * sizeof(block->frames[0]));
+	block->nFrames = framesPerBuffer;
+	block->adcTime = timeInfo ? timeInfo->inputBufferAdcTime : 0;
+
+	MICRO_RING_STORE(micro_ringWrite, write + 1);
 
-	/* send buffer to crossbar */
-	Crossbar_GetMicrophoneDatas(micro_buffer_L, micro_buffer_R, framesPerBuffer);
-	
 	/* get Next Microphone datas */
 	return paContinue;
 }
 
 
+/**
+ * Pass the blocks recorded since the last call to the crossbar ADC.
+ * Blocks which waited much longer than the latency (emulation paused
+ * or too slow) are dropped, so the delay doesn't grow over time.
+ * Called from the emulation thread.
+ */
+void Microphone_Update(void)
+{
+	MICRO_BLOCK *block;
+	Uint32 read, write, i;
+	PaTime oldest = 0;
+
+	if (micro_stream == NULL)
+		return;
+
+	read = micro_ringRead;
+	write = MICRO_RING_LOAD(micro_ringWrite);
+	if (read == write)
+		return;
+
+	/* Pa_GetStreamTime() and the callback timestamps use the same clock */
+	if (micro_ring[read % MICRO_RING_BLOCKS].adcTime != 0)
+		oldest = Pa_GetStreamTime(micro_stream) - 4 * micro_latency;
+
+	for ( ; read != write; read++) {
+		block = &micro_ring[read % MICRO_RING_BLOCKS];
+		if (block->adcTime != 0 && block->adcTime < oldest)
+			continue;
+
+		for (i = 0; i < block->nFrames; i++) {
+			micro_buffer_L[i] = block->frames[i][0];	/* left data */
+			micro_buffer_R[i] = block->frames[i][1];	/* right data */
+		}
+
+		/* send buffer to crossbar */
+		Crossbar_GetMicrophoneDatas(micro_buffer_L, micro_buffer_R, block->nFrames,
+		                            micro_latency * micro_sampleRate);
+	}
+
+	MICRO_RING_STORE(micro_ringRead, read);
+}
+
+
 /*******************************************************************/
 
 /**
@@ -109,9 +173,17 @@ bool Microphone_Start(int sampleRate)
 	
 	micro_inputParameters.channelCount = 2;				/* stereo input */
 	micro_inputParameters.sampleFormat = paInt16;			/* 16 bits sound */
-	micro_inputParameters.suggestedLatency = Pa_GetDeviceInfo (micro_inputParameters.device)->defaultLowInputLatency;
+	if (ConfigureParams.Sound.nMicrophoneLatency > 0)
+		micro_latency = ConfigureParams.Sound.nMicrophoneLatency / 1000.0;
+	else
+		micro_latency = Pa_GetDeviceInfo (micro_inputParameters.device)->defaultLowInputLatency;
+	if (micro_latency <= 0)
+		micro_latency = MICRO_DEFAULT_LATENCY;
+	micro_inputParameters.suggestedLatency = micro_latency;
 	micro_inputParameters.hostApiSpecificStreamInfo = NULL;
 
+	micro_ringWrite = micro_ringRead = 0;
+
 	/* Open Microphone stream */
 	micro_err = Pa_OpenStream (
 		&micro_stream,
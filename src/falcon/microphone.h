@@ -11,10 +11,12 @@
 #if HAVE_PORTAUDIO
 extern bool Microphone_Start (int sampleRate);
 extern bool Microphone_Stop (void);
+extern void Microphone_Update (void);
 #else
-/* replace function calls with NOPs (could also be empty static inlines) */
-#define Microphone_Start(rate) false
-#define Microphone_Stop() false
+/* replace function calls with NOPs */
+static inline bool Microphone_Start(int sampleRate) { return false; }
+static inline bool Microphone_Stop(void) { return false; }
+static inline void Microphone_Update(void) { }
 #endif
 
 
@@ -35,6 +35,7 @@ const char NvRam_fileid[] = "Hatari nvram.c : " __DATE__ " " __TIME__;
 #include "log.h"
 #include "nvram.h"
 #include "paths.h"
+#include "rtc.h"
 #include "vdi.h"
 
 
@@ -267,8 +268,7 @@ void NvRam_Data_ReadByte(void)
 	    || (nvram_index >=NVRAM_DAY && nvram_index <=NVRAM_YEAR) )
 	{
 		/* access to RTC?  - then read host clock and return its values */
-		time_t tim = time(NULL);
-		struct tm *curtim = localtime(&tim);	/* current time */
+		struct tm *curtim = Rtc_GetTime();	/* current time */
 		switch(nvram_index)
 		{
 			case NVRAM_SECONDS: value = curtim->tm_sec; break;
@@ -65,6 +65,7 @@
 
 const char VIDEL_fileid[] = "Hatari videl.c : " __DATE__ " " __TIME__;
 
+#include <stddef.h>
 #include <SDL_endian.h>
 #include <SDL.h>
 #include "main.h"
@@ -75,10 +76,23 @@ const char VIDEL_fileid[] = "Hatari videl.c : " __DATE__ " " __TIME__;
 #include "hostscreen.h"
 #include "screen.h"
 #include "stMemory.h"
+#include "rowPool.h"
+#include "stats.h"
 #include "videl.h"
 #include "video.h"				/* for bUseHighRes variable, maybe unuseful (Laurent) */
 #include "vdi.h"				/* for bUseVDIRes variable,  maybe unuseful (Laurent) */
 
+/* SIMD versions of the bitplane to chunky conversion (little endian only) */
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+# if defined(__SSE2__)
+#  include <emmintrin.h>
+#  define VIDEL_SIMD_SSE2 1
+# elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#  include <arm_neon.h>
+#  define VIDEL_SIMD_NEON 1
+# endif
+#endif
+
 #define Atari2HostAddr(a) (&STRam[a])
 #define VIDEL_COLOR_REGS_BEGIN	0xff9800
 
@@ -101,6 +115,7 @@ struct videl_s {
 	Uint16 save_scrBpp;			/* save screen Bpp to detect a change of bitplan mode */
 
 	bool hostColorsSync;			/* Sync palette with host's */
+	Uint32 colorsGeneration;		/* Incremented when the host palette changes */
 };
 
 struct videl_zoom_s {
@@ -112,11 +127,41 @@ struct videl_zoom_s {
 	int *zoomytable;
 };
 
+/* State the last rendered frame was based on, to skip unchanged frames */
+struct videl_frame_s {
+	Uint32 videoBaseAddr;
+	int    nextline;
+	Uint8  hscroll;
+	bool   bUseSTShifter;
+	Sint16 leftBorderSize;
+	Sint16 rightBorderSize;
+	Sint16 upperBorderSize;
+	Sint16 lowerBorderSize;
+	Uint16 XSize;
+	Uint16 YSize;
+	int    zoomX;
+	int    zoomY;
+	Uint32 colorsGeneration;
+	int    nVBL;				/* VBL of the frame, not compared */
+};
+
+/* What needs to be converted for the next frame */
+typedef enum {
+	VIDEL_FRAME_SAME,			/* nothing */
+	VIDEL_FRAME_ROWS,			/* only the rows in written memory pages */
+	VIDEL_FRAME_FULL			/* the whole screen */
+} videl_frame_update_t;
+
 static struct videl_s videl;
 static struct videl_zoom_s videl_zoom;
+static struct videl_frame_s videl_frame;
 
 Uint16 vfc_counter;			/* counter for VFC register $ff82a0 (to be internalized when VIDEL emulation is complete) */
 
+static bool bVidelUseSimd;		/* SIMD bitplane conversion passed its self-test */
+static bool bVidelDirtyRowsOnly;	/* VIDEL_renderScreen() converts only the written rows */
+
+static void VIDEL_bitplaneToChunky_Init(void);
 static void VIDEL_memset_uint32(Uint32 *addr, Uint32 color, int count);
 static void VIDEL_memset_uint16(Uint16 *addr, Uint16 color, int count);
 static void VIDEL_memset_uint8(Uint8 *addr, Uint8 color, int count);
@@ -135,6 +180,8 @@ void VIDEL_reset(void)
 	videl.hostColorsSync = false; 
 
 	vfc_counter = 0;
+
+	VIDEL_bitplaneToChunky_Init();
 	
 	/* Autozoom */
 	videl_zoom.zoomwidth = 0;
@@ -166,6 +213,10 @@ void VIDEL_MemorySnapShot_Capture(bool bSave)
 	/* Save/Restore details */
 	MemorySnapShot_Store(&videl, sizeof(videl));
 	MemorySnapShot_Store(&vfc_counter, sizeof(vfc_counter));
+
+	/* Host palette was synced to the colors at save time */
+	if (!bSave)
+		videl.hostColorsSync = false;
 }
 
 /**
@@ -851,6 +902,11 @@ static void VIDEL_getMonitorScale(int *sx, int *sy)
 static void VIDEL_updateColors(void)
 {
 	int i, r, g, b, colors = 1 << videl.save_scrBpp;
+	Uint32 oldColors[256];
+	bool changed = false;
+
+	for (i = 0; i < colors; i++)
+		oldColors[i] = HostScreen_getPaletteColor(i);
 
 #define F_COLORS(i) IoMem_ReadByte(VIDEL_COLOR_REGS_BEGIN + (i))
 #define STE_COLORS(i)	IoMem_ReadByte(0xff8240 + (i))
@@ -884,6 +940,12 @@ static void VIDEL_updateColors(void)
 		HostScreen_updatePalette(colors);
 	}
 
+	/* Programs often rewrite the same colors, don't reconvert for that */
+	for (i = 0; i < colors; i++)
+		changed |= (HostScreen_getPaletteColor(i) != oldColors[i]);
+	if (changed)
+		videl.colorsGeneration++;
+
 	videl.hostColorsSync = true;
 }
 
@@ -895,6 +957,61 @@ void VIDEL_ZoomModeChanged(void)
 }
 
 
+/**
+ * Return what differs in the frame to render from the last rendered one.
+ * The whole frame needs to be converted if the palette or any of the Videl
+ * settings the conversion depends on changed since then (or frames were
+ * skipped in between), otherwise only the rows in the video memory pages
+ * written since then. Dirty page tracking needs to be enabled for detecting
+ * unchanged video memory, otherwise every frame is fully converted.
+ */
+static videl_frame_update_t VIDEL_FrameChanged(int vbpp, int nextline)
+{
+	struct videl_frame_s frame;
+	Uint32 size;
+	videl_frame_update_t update;
+
+	memset(&frame, 0, sizeof(frame));
+	frame.videoBaseAddr = videl.videoBaseAddr;
+	frame.nextline = nextline;
+	frame.hscroll = IoMem_ReadByte(0xff8265) & 0x0f;
+	frame.bUseSTShifter = videl.bUseSTShifter;
+	frame.leftBorderSize = videl.leftBorderSize;
+	frame.rightBorderSize = videl.rightBorderSize;
+	frame.upperBorderSize = videl.upperBorderSize;
+	frame.lowerBorderSize = videl.lowerBorderSize;
+	frame.XSize = videl.XSize;
+	frame.YSize = videl.YSize;
+	frame.zoomX = nScreenZoomX;
+	frame.zoomY = nScreenZoomY;
+	frame.colorsGeneration = videl.colorsGeneration;
+	frame.nVBL = nVBLs;
+
+	/* Screen lines read by the conversion, including hscroll extra words */
+	size = (VIDEL_getScreenHeight() > videl.YSize ? VIDEL_getScreenHeight() : videl.YSize);
+	size *= (nextline + vbpp) * 2;
+
+	if (memcmp(&frame, &videl_frame, offsetof(struct videl_frame_s, nVBL)) != 0
+	    || frame.nVBL != videl_frame.nVBL + 1
+	    || pFrameBuffer->bFullUpdate
+	    || !STMemory_bDirtyTracking)
+		update = VIDEL_FRAME_FULL;
+	else if (STMemory_IsDirty(videl.videoBaseAddr, size, false))
+		update = VIDEL_FRAME_ROWS;
+	else
+		update = VIDEL_FRAME_SAME;
+
+	pFrameBuffer->bFullUpdate = false;
+	videl_frame = frame;
+	return update;
+}
+
+
+/**
+ * Convert the Videl screen to the host screen.
+ * Return true if the host screen was updated, false if the frame
+ * could not be rendered or was unchanged.
+ */
 bool VIDEL_renderScreen(void)
 {
 	/* Atari screen infos */
@@ -907,6 +1024,7 @@ bool VIDEL_renderScreen(void)
 	int nextline;
 
 	bool change = false;
+	videl_frame_update_t update;
 
 	videl.videoBaseAddr = VIDEL_getVideoramAddress(); // Todo: to be removed when all code is in Videl
 
@@ -930,6 +1048,17 @@ bool VIDEL_renderScreen(void)
 		HostScreen_setWindowSize(videl.save_scrWidth, videl.save_scrHeight, videl.save_scrBpp == 16 ? 16 : ConfigureParams.Screen.nForceBpp);
 	}
 
+	/* Palette is compared with the last frame's one */
+	if (videl.save_scrBpp < 16 && videl.hostColorsSync == 0)
+		VIDEL_updateColors();
+
+	/* Skip conversion and host screen update for unchanged frames */
+	update = VIDEL_FrameChanged(videl.save_scrBpp, linewidth + lineoffset);
+	if (change)
+		update = VIDEL_FRAME_FULL;
+	if (update == VIDEL_FRAME_SAME)
+		return false;
+
 	if (!HostScreen_renderBegin())
 		return false;
 
@@ -954,14 +1083,14 @@ bool VIDEL_renderScreen(void)
 	if ((vw<32) || (vh<32))
 		return false;
 
-	if (videl.save_scrBpp < 16 && videl.hostColorsSync == 0)
-		VIDEL_updateColors();
-
+	Stats_Add(STATS_SCREEN_LINES, vh);
+	bVidelDirtyRowsOnly = (update == VIDEL_FRAME_ROWS);
 	if (nScreenZoomX * nScreenZoomY != 1) {
 		VIDEL_ConvertScreenZoom(vw, vh, videl.save_scrBpp, nextline);
 	} else {
 		VIDEL_ConvertScreenNoZoom(vw, vh, videl.save_scrBpp, nextline);
 	}
+	bVidelDirtyRowsOnly = false;
 
 	HostScreen_update1(HostScreen_renderEnd(), false);
 
@@ -972,9 +1101,10 @@ bool VIDEL_renderScreen(void)
 /**
  * Performs conversion from the TOS's bitplane word order (big endian) data
  * into the native chunky color index.
+ * Portable version, also used to verify the SIMD versions below.
  */
-static void VIDEL_bitplaneToChunky(Uint16 *atariBitplaneData, Uint16 bpp,
-                                   Uint8 colorValues[16])
+static void VIDEL_bitplaneToChunky_C(Uint16 *atariBitplaneData, Uint16 bpp,
+                                     Uint8 colorValues[16])
 {
 	Uint32 a, b, c, d, x;
 
@@ -1100,15 +1230,495 @@ static void VIDEL_bitplaneToChunky(Uint16 *atariBitplaneData, Uint16 bpp,
 #endif
 }
 
+#if VIDEL_SIMD_SSE2
+/**
+ * SSE2 version of the bitplane to chunky conversion.
+ * The high (pixels 0-7) and low (pixels 8-15) bytes of the planes are
+ * gathered into one register each, next to a copy shifted left by one
+ * bit. Then each _mm_movemask_epi8() picks the top bit of all of them,
+ * which gives the color indexes of two pixels at once, and shifting
+ * the bytes by two bits moves to the next two pixels.
+ */
+static inline void VIDEL_bitplaneToChunky_SIMD(Uint16 *atariBitplaneData, Uint16 bpp,
+                                               Uint8 colorValues[16])
+{
+	__m128i v, r;
+	int i, mask;
+
+	if (bpp == 8)
+		v = _mm_loadu_si128((const __m128i *)atariBitplaneData);
+	else if (bpp == 4)
+		v = _mm_loadl_epi64((const __m128i *)atariBitplaneData);
+	else if (bpp == 2)
+		v = _mm_cvtsi32_si128(*(Uint32 *)atariBitplaneData);
+	else
+		v = _mm_cvtsi32_si128(atariBitplaneData[0]);
+
+	/* Plane high bytes into bytes 0-7, low bytes into bytes 8-15 */
+	v = _mm_packus_epi16(_mm_and_si128(v, _mm_set1_epi16(0x00ff)), _mm_srli_epi16(v, 8));
+
+	r = _mm_unpacklo_epi64(v, _mm_add_epi8(v, v));
+	for (i = 0; i < 8; i += 2)
+	{
+		mask = _mm_movemask_epi8(r);
+		colorValues[i] = mask;
+		colorValues[i+1] = mask >> 8;
+		r = _mm_add_epi8(r, r);
+		r = _mm_add_epi8(r, r);
+	}
+	r = _mm_unpackhi_epi64(v, _mm_add_epi8(v, v));
+	for (i = 8; i < 16; i += 2)
+	{
+		mask = _mm_movemask_epi8(r);
+		colorValues[i] = mask;
+		colorValues[i+1] = mask >> 8;
+		r = _mm_add_epi8(r, r);
+		r = _mm_add_epi8(r, r);
+	}
+}
+#elif VIDEL_SIMD_NEON
+/**
+ * NEON version of the bitplane to chunky conversion.
+ * Each plane's high and low byte are spread over the 16 pixels, and
+ * vtstq_u8() against the pixel bit masks tells which pixels have
+ * the plane's bit set in their color index.
+ */
+static inline void VIDEL_bitplaneToChunky_SIMD(Uint16 *atariBitplaneData, Uint16 bpp,
+                                               Uint8 colorValues[16])
+{
+	static const Uint8 pixelBits[16] = {
+		0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01,
+		0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01
+	};
+	const Uint8 *planes = (const Uint8 *)atariBitplaneData;
+	uint8x16_t bits = vld1q_u8(pixelBits);
+	uint8x16_t color = vdupq_n_u8(0);
+	uint8x16_t plane;
+	int i;
+
+	for (i = 0; i < bpp; i++)
+	{
+		plane = vcombine_u8(vdup_n_u8(planes[2*i]), vdup_n_u8(planes[2*i+1]));
+		plane = vtstq_u8(plane, bits);
+		color = vorrq_u8(color, vandq_u8(plane, vdupq_n_u8(1 << i)));
+	}
+	vst1q_u8(colorValues, color);
+}
+#endif
+
+/**
+ * Check once that the SIMD bitplane conversion gives the same results
+ * as the portable one, and use it only in that case.
+ */
+static void VIDEL_bitplaneToChunky_Init(void)
+{
+#if VIDEL_SIMD_SSE2 || VIDEL_SIMD_NEON
+	static bool bChecked = false;
+	Uint16 planes[8] = { 0 };
+	Uint8 expected[16], result[16];
+	Uint32 seed = 0x12345678;
+	int i, j, bpp;
+
+	if (bChecked)
+		return;
+	bChecked = true;
+
+	bVidelUseSimd = true;
+	for (i = 0; i < 256 && bVidelUseSimd; i++)
+	{
+		for (j = 0; j < 8; j++)
+		{
+			seed = seed * 1103515245 + 12345;
+			planes[j] = seed >> 16;
+		}
+		for (bpp = 1; bpp <= 8; bpp <<= 1)
+		{
+			VIDEL_bitplaneToChunky_C(planes, bpp, expected);
+			VIDEL_bitplaneToChunky_SIMD(planes, bpp, result);
+			if (memcmp(expected, result, sizeof(result)) != 0)
+			{
+				Log_Printf(LOG_WARN, "Videl: SIMD bitplane conversion mismatch, using the portable one.\n");
+				bVidelUseSimd = false;
+				break;
+			}
+		}
+	}
+#endif
+}
+
+/**
+ * Convert 16 pixels of bitplane data with the fastest available method.
+ */
+static inline void VIDEL_bitplaneToChunky(Uint16 *atariBitplaneData, Uint16 bpp,
+                                          Uint8 colorValues[16])
+{
+#if VIDEL_SIMD_SSE2 || VIDEL_SIMD_NEON
+	if (bVidelUseSimd)
+	{
+		VIDEL_bitplaneToChunky_SIMD(atariBitplaneData, bpp, colorValues);
+		return;
+	}
+#endif
+	VIDEL_bitplaneToChunky_C(atariBitplaneData, bpp, colorValues);
+}
+
+/* Parameters of the graphical area rows conversion, see RowPool_Run() */
+struct videl_convert_s {
+	Uint16 *fvram;				/* Atari line of first row (no zoom) or first line */
+	Uint8  *hvram;				/* Host line of first row */
+	int    scrpitch;
+	int    scrbpp;				/* Host bytes per pixel */
+	SDL_PixelFormat *scrfmt;
+	int    vw;				/* Atari pixels per line */
+	int    vbpp;
+	int    nextline;			/* Atari words per line */
+	int    hscrolloffset;
+	int    leftBorderSize;			/* Host pixels */
+	int    rightBorderSize;
+	int    coefx;				/* Zoom only */
+	bool   bIntegerZoom;			/* Zoom only : zoomxtable[w] is w / coefx */
+	int    scrwidth;			/* Zoom only : host pixels per row */
+	bool   bDirtyOnly;			/* Skip rows in unwritten memory pages */
+	int    nRowBytes;			/* Atari bytes read per line */
+};
+
+/**
+ * Return true if the Atari line needs to be converted.
+ */
+static inline bool VIDEL_lineChanged(const struct videl_convert_s *conv, Uint16 *fvram_line)
+{
+	return !conv->bDirtyOnly
+	       || STMemory_IsDirty((Uint8 *)fvram_line - STRam, conv->nRowBytes, false);
+}
+
+/**
+ * Set the values which don't depend on the zoom mode.
+ */
+static void VIDEL_initConvert(struct videl_convert_s *conv, int vw, int vbpp)
+{
+	conv->scrpitch = HostScreen_getPitch();
+	conv->scrbpp = HostScreen_getBpp();
+	conv->scrfmt = HostScreen_getFormat();
+	conv->vw = vw;
+	conv->vbpp = vbpp;
+	conv->bDirtyOnly = bVidelDirtyRowsOnly;
+	conv->bIntegerZoom = false;
+	if (vbpp < 16)
+		conv->nRowBytes = (((vw+15)>>4) + (conv->hscrolloffset ? 1 : 0)) * vbpp * 2;
+	else
+		conv->nRowBytes = vw * 2;
+}
+
+/**
+ * Fill count host pixels with the border color.
+ */
+static void VIDEL_fillBorder(Uint8 *hvram, int scrbpp, int count)
+{
+	switch (scrbpp) {
+		case 1:
+			VIDEL_memset_uint8(hvram, HostScreen_getPaletteColor(0), count);
+			break;
+		case 2:
+			VIDEL_memset_uint16((Uint16 *)hvram, HostScreen_getPaletteColor(0), count);
+			break;
+		case 4:
+			VIDEL_memset_uint32((Uint32 *)hvram, HostScreen_getPaletteColor(0), count);
+			break;
+	}
+}
+
+/**
+ * Fill the given number of host rows (upper or lower border).
+ */
+static void VIDEL_fillBorderRows(Uint8 *hvram, int rows, int scrwidth, int scrpitch)
+{
+	int scrbpp = HostScreen_getBpp();
+
+	while (rows-- > 0) {
+		VIDEL_fillBorder(hvram, scrbpp, scrwidth);
+		hvram += scrpitch;
+	}
+}
+
+/**
+ * Convert one line of bitplanes to host pixels, including the fine
+ * scrolling. Return the host address after the converted pixels.
+ */
+static Uint8 *VIDEL_convertBitplaneLine(const struct videl_convert_s *conv, Uint16 *fvram_column, Uint8 *hvram)
+{
+	/* The SDL colors blitting... */
+	const Uint32 *palette = HostScreen_getPalette();
+	Uint8 color[16];
+	int vbpp = conv->vbpp;
+	int hscrolloffset = conv->hscrolloffset;
+	int w, j;
+
+	/* FIXME: The byte swap could be done here by enrolling the loop into 2 each by 8 pixels */
+	switch (conv->scrbpp) {
+		case 1:
+		{
+			Uint8 *hvram_column = hvram;
+
+			/* First 16 pixels */
+			VIDEL_bitplaneToChunky(fvram_column, vbpp, color);
+			memcpy(hvram_column, color+hscrolloffset, 16-hscrolloffset);
+			hvram_column += 16-hscrolloffset;
+			fvram_column += vbpp;
+			/* Now the main part of the line */
+			for (w = 1; w < (conv->vw+15)>>4; w++) {
+				VIDEL_bitplaneToChunky( fvram_column, vbpp, color );
+				memcpy(hvram_column, color, 16);
+				hvram_column += 16;
+				fvram_column += vbpp;
+			}
+			/* Last pixels of the line for fine scrolling */
+			if (hscrolloffset) {
+				VIDEL_bitplaneToChunky(fvram_column, vbpp, color);
+				memcpy(hvram_column, color, hscrolloffset);
+				hvram_column += hscrolloffset;
+			}
+			return hvram_column;
+		}
+		case 2:
+		{
+			Uint16 *hvram_column = (Uint16 *)hvram;
+
+			/* First 16 pixels */
+			VIDEL_bitplaneToChunky(fvram_column, vbpp, color);
+			for (j = 0; j < 16 - hscrolloffset; j++) {
+				*hvram_column++ = palette[color[j+hscrolloffset]];
+			}
+			fvram_column += vbpp;
+			/* Now the main part of the line */
+			for (w = 1; w < (conv->vw+15)>>4; w++) {
+				VIDEL_bitplaneToChunky( fvram_column, vbpp, color );
+				for (j=0; j<16; j++) {
+					*hvram_column++ = palette[color[j]];
+				}
+				fvram_column += vbpp;
+			}
+			/* Last pixels of the line for fine scrolling */
+			if (hscrolloffset) {
+				VIDEL_bitplaneToChunky(fvram_column, vbpp, color);
+				for (j = 0; j < hscrolloffset; j++) {
+					*hvram_column++ = palette[color[j]];
+				}
+			}
+			return (Uint8 *)hvram_column;
+		}
+		case 4:
+		{
+			Uint32 *hvram_column = (Uint32 *)hvram;
+
+			/* First 16 pixels */
+			VIDEL_bitplaneToChunky(fvram_column, vbpp, color);
+			for (j = 0; j < 16 - hscrolloffset; j++) {
+				*hvram_column++ = palette[color[j+hscrolloffset]];
+			}
+			fvram_column += vbpp;
+			/* Now the main part of the line */
+			for (w = 1; w < (conv->vw+15)>>4; w++) {
+				VIDEL_bitplaneToChunky( fvram_column, vbpp, color );
+				for (j=0; j<16; j++) {
+					*hvram_column++ = palette[color[j]];
+				}
+				fvram_column += vbpp;
+			}
+			/* Last pixels of the line for fine scrolling */
+			if (hscrolloffset) {
+				VIDEL_bitplaneToChunky(fvram_column, vbpp, color);
+				for (j = 0; j < hscrolloffset; j++) {
+					*hvram_column++ = palette[color[j]];
+				}
+			}
+			return (Uint8 *)hvram_column;
+		}
+	}
+	return hvram;
+}
+
+/**
+ * Convert one Falcon TC (High Color) pixel to the host format.
+ */
+static inline Uint32 VIDEL_convertTrueColor(const struct videl_convert_s *conv, Uint16 srcword)
+{
+	int tmp;
+
+	switch (conv->scrbpp) {
+		case 1:
+			/* FIXME: when Videl switches to 16bpp, set the palette to 3:3:2 */
+			tmp = SDL_SwapBE16(srcword);
+			return (((tmp>>13) & 7) << 5) + (((tmp>>8) & 7) << 2) + (((tmp>>2) & 3));
+		case 2:
+			return SDL_SwapBE16(srcword);
+		default:
+			return SDL_MapRGB(conv->scrfmt, (srcword & 0xf8), (((srcword & 0x07) << 5) | ((srcword >> 11) & 0x3c)), ((srcword >> 5) & 0xf8));
+	}
+}
+
+/**
+ * Convert count Falcon TC pixels to host pixels.
+ */
+static void VIDEL_convertTrueColorLine(const struct videl_convert_s *conv, const Uint16 *fvram_column, Uint8 *hvram, int count)
+{
+	int w;
+
+	switch (conv->scrbpp) {
+		case 1:
+			for (w = 0; w < count; w++)
+				hvram[w] = VIDEL_convertTrueColor(conv, fvram_column[w]);
+			break;
+		case 2:
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+			/* Falcon and host pixels are both big endian RGB565 */
+			memcpy(hvram, fvram_column, count * 2);
+#else
+			for (w = 0; w < count; w++)
+				((Uint16 *)hvram)[w] = VIDEL_convertTrueColor(conv, fvram_column[w]);
+#endif
+			break;
+		case 4:
+			for (w = 0; w < count; w++)
+				((Uint32 *)hvram)[w] = VIDEL_convertTrueColor(conv, fvram_column[w]);
+			break;
+	}
+}
+
+/**
+ * Zoom a converted line of conv->vw host pixels to zoomwidth pixels.
+ * With an integer zoom, each pixel is just repeated coefx times.
+ */
+static void VIDEL_zoomLine(const struct videl_convert_s *conv, const Uint8 *line, Uint8 *hvram, int zoomwidth)
+{
+	const int *zoomxtable = videl_zoom.zoomxtable;
+	int coefx = conv->coefx;
+	int w, k;
+
+	if (conv->bIntegerZoom) {
+		switch (conv->scrbpp) {
+			case 1:
+				for (w = 0; w < conv->vw; w++)
+					for (k = 0; k < coefx; k++)
+						*hvram++ = line[w];
+				break;
+			case 2:
+			{
+				Uint16 *hvram_column = (Uint16 *)hvram;
+				for (w = 0; w < conv->vw; w++) {
+					Uint16 pixel = ((const Uint16 *)line)[w];
+					for (k = 0; k < coefx; k++)
+						*hvram_column++ = pixel;
+				}
+				break;
+			}
+			case 4:
+			{
+				Uint32 *hvram_column = (Uint32 *)hvram;
+				for (w = 0; w < conv->vw; w++) {
+					Uint32 pixel = ((const Uint32 *)line)[w];
+					for (k = 0; k < coefx; k++)
+						*hvram_column++ = pixel;
+				}
+				break;
+			}
+		}
+		return;
+	}
+
+	switch (conv->scrbpp) {
+		case 1:
+			for (w = 0; w < zoomwidth; w++)
+				hvram[w] = line[zoomxtable[w]];
+			break;
+		case 2:
+			for (w = 0; w < zoomwidth; w++)
+				((Uint16 *)hvram)[w] = ((const Uint16 *)line)[zoomxtable[w]];
+			break;
+		case 4:
+			for (w = 0; w < zoomwidth; w++)
+				((Uint32 *)hvram)[w] = ((const Uint32 *)line)[zoomxtable[w]];
+			break;
+	}
+}
+
+/**
+ * Apply the TT sample & hold mode to a converted 8-bit line.
+ */
+static void VIDEL_sampleHold(Uint8 *hvram_line, int count)
+{
+	Uint8 TMPPixel = 0;
+	int w;
+
+	for (w = 0; w < count; w++) {
+		if (hvram_line[w] == 0) {
+			hvram_line[w] = TMPPixel;
+		} else {
+			TMPPixel = hvram_line[w];
+		}
+	}
+}
+
+/**
+ * Convert the graphical area rows nFirst to nLast-1 without zoom.
+ */
+static void VIDEL_ConvertRowsNoZoom(int nFirst, int nLast, void *pParam)
+{
+	const struct videl_convert_s *conv = pParam;
+	Uint16 *fvram_line = conv->fvram + nFirst * conv->nextline;
+	Uint8 *hvram_line = conv->hvram + nFirst * conv->scrpitch;
+	Uint8 *hvram_column;
+	int scrbpp = conv->scrbpp;
+	int h;
+
+	for (h = nFirst; h < nLast; h++) {
+		if (!VIDEL_lineChanged(conv, fvram_line)) {
+			fvram_line += conv->nextline;
+			hvram_line += conv->scrpitch;
+			continue;
+		}
+
+		/* Left border first */
+		VIDEL_fillBorder(hvram_line, scrbpp, conv->leftBorderSize);
+		hvram_column = hvram_line + conv->leftBorderSize * scrbpp;
+
+		if (conv->vbpp < 16) {
+			/* Bitplanes modes */
+			hvram_column = VIDEL_convertBitplaneLine(conv, fvram_line, hvram_column);
+		} else {
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+			/* FIXME: here might be a runtime little/big video endian switch like:
+				if ( " videocard memory in Motorola endian format " false)
+			*/
+			if (scrbpp == 2) {
+				memcpy(hvram_column, fvram_line, conv->vw<<1);
+				hvram_column += conv->vw<<1;
+			} else
+#endif
+			{
+				/* Falcon TC (High Color) */
+				VIDEL_convertTrueColorLine(conv, fvram_line, hvram_column, conv->vw);
+				hvram_column += conv->vw * scrbpp;
+			}
+		}
+
+		/* Right border */
+		VIDEL_fillBorder(hvram_column, scrbpp, conv->rightBorderSize);
+
+		if (bTTSampleHold && conv->vbpp < 16 && scrbpp == 1)
+			VIDEL_sampleHold(hvram_line, conv->vw);
+
+		fvram_line += conv->nextline;
+		hvram_line += conv->scrpitch;
+	}
+}
+
 void VIDEL_ConvertScreenNoZoom(int vw, int vh, int vbpp, int nextline)
 {
+	struct videl_convert_s conv;
 	int scrpitch = HostScreen_getPitch();
-	int h, w, j;
 
 	Uint16 *fvram = (Uint16 *) Atari2HostAddr(videl.videoBaseAddr);
-	Uint16 *fvram_line;
 	Uint8 *hvram = HostScreen_getVideoramAddress();
-	SDL_PixelFormat *scrfmt = HostScreen_getFormat();
 
 	Uint16 lowBorderSize, rightBorderSize;
 	int scrwidth, scrheight;
@@ -1183,337 +1793,123 @@ void VIDEL_ConvertScreenNoZoom(int vw, int vh, int vbpp, int nextline)
 	hvram += ((scrheight-vh_clip)>>1)*scrpitch;
 	hvram += ((scrwidth-vw_clip)>>1)*HostScreen_getBpp();
 
-	fvram_line = fvram;
 	scrwidth = videl.leftBorderSize + vw + videl.rightBorderSize;
 
-	/* render the graphic area */
-	if (vbpp < 16) {
-		/* Bitplanes modes */
+	/* Render the upper border (unchanged if only rows need update) */
+	if (!bVidelDirtyRowsOnly)
+		VIDEL_fillBorderRows(hvram, videl.upperBorderSize, scrwidth, scrpitch);
+	hvram += videl.upperBorderSize * scrpitch;
 
-		/* The SDL colors blitting... */
-		Uint8 color[16];
+	/* Render the graphical area */
+	conv.fvram = fvram;
+	conv.hvram = hvram;
+	conv.nextline = nextline;
+	conv.hscrolloffset = hscrolloffset;
+	VIDEL_initConvert(&conv, vw, vbpp);
+	conv.leftBorderSize = videl.leftBorderSize;
+	conv.rightBorderSize = rightBorderSize;
+	conv.coefx = 1;
+	conv.scrwidth = scrwidth;
+	RowPool_Run(vh, VIDEL_ConvertRowsNoZoom, &conv);
+	hvram += vh * scrpitch;
 
-		/* FIXME: The byte swap could be done here by enrolling the loop into 2 each by 8 pixels */
-		switch ( HostScreen_getBpp() ) {
-			case 1:
-			{
-				Uint8 *hvram_line = hvram;
-
-				/* Render the upper border */
-				for (h = 0; h < videl.upperBorderSize; h++) {
-					VIDEL_memset_uint8 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch;
-				}
-
-				/* Render the graphical area */
-				for (h = 0; h < vh; h++) {
-					Uint16 *fvram_column = fvram_line;
-					Uint8 *hvram_column = hvram_line;
-
-					/* Left border first */
-					VIDEL_memset_uint8 (hvram_column, HostScreen_getPaletteColor(0), videl.leftBorderSize);
-					hvram_column += videl.leftBorderSize;
-				
-					/* First 16 pixels */
-					VIDEL_bitplaneToChunky(fvram_column, vbpp, color);
-					memcpy(hvram_column, color+hscrolloffset, 16-hscrolloffset);
-					hvram_column += 16-hscrolloffset;
-					fvram_column += vbpp;
-					/* Now the main part of the line */
-					for (w = 1; w < (vw+15)>>4; w++) {
-						VIDEL_bitplaneToChunky( fvram_column, vbpp, color );
-						memcpy(hvram_column, color, 16);
-						hvram_column += 16;
-						fvram_column += vbpp;
-					}
-					/* Last pixels of the line for fine scrolling */
-					if (hscrolloffset) {
-						VIDEL_bitplaneToChunky(fvram_column, vbpp, color);
-						memcpy(hvram_column, color, hscrolloffset);
-					}
-					/* Right border */
-					VIDEL_memset_uint8 (hvram_column, HostScreen_getPaletteColor(0), rightBorderSize);
-
-					if (bTTSampleHold) {
-						Uint8 TMPPixel = 0;
-						for (w=0; w < (vw); w++) {
-							if (hvram_line[w] == 0) {
-								hvram_line[w] = TMPPixel;
-							} else {
-								TMPPixel = hvram_line[w];
-							}
-						}
-					}
-
-					fvram_line += nextline;
-					hvram_line += scrpitch;
-				}
-
-				/* Render the lower border */
-				for (h = 0; h < lowBorderSize; h++) {
-					VIDEL_memset_uint8 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch;
-				}
-			}
-			break;
-			case 2:
-			{
-				Uint16 *hvram_line = (Uint16 *)hvram;
-
-				/* Render the upper border */
-				for (h = 0; h < videl.upperBorderSize; h++) {
-					VIDEL_memset_uint16 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch>>1;
-				}
-
-				/* Render the graphical area */
-				for (h = 0; h < vh; h++) {
-					Uint16 *fvram_column = fvram_line;
-					Uint16 *hvram_column = hvram_line;
-
-					/* Left border first */
-					VIDEL_memset_uint16 (hvram_column, HostScreen_getPaletteColor(0), videl.leftBorderSize);
-					hvram_column += videl.leftBorderSize;
-				
-					/* First 16 pixels */
-					VIDEL_bitplaneToChunky(fvram_column, vbpp, color);
-					for (j = 0; j < 16 - hscrolloffset; j++) {
-						*hvram_column++ = HostScreen_getPaletteColor(color[j+hscrolloffset]);
-					}
-					fvram_column += vbpp;
-					/* Now the main part of the line */
-					for (w = 1; w < (vw+15)>>4; w++) {
-						VIDEL_bitplaneToChunky( fvram_column, vbpp, color );
-						for (j=0; j<16; j++) {
-							*hvram_column++ = HostScreen_getPaletteColor( color[j] );
-						}
-						fvram_column += vbpp;
-					}
-					/* Last pixels of the line for fine scrolling */
-					if (hscrolloffset) {
-						VIDEL_bitplaneToChunky(fvram_column, vbpp, color);
-						for (j = 0; j < hscrolloffset; j++) {
-							*hvram_column++ = HostScreen_getPaletteColor(color[j]);
-						}
-					}
-					/* Right border */
-					VIDEL_memset_uint16 (hvram_column, HostScreen_getPaletteColor(0), rightBorderSize);
-
-					fvram_line += nextline;
-					hvram_line += scrpitch>>1;
-				}
-
-				/* Render the lower border */
-				for (h = 0; h < lowBorderSize; h++) {
-					VIDEL_memset_uint16 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch>>1;
-				}
-			}
-			break;
-			case 4:
-			{
-				Uint32 *hvram_line = (Uint32 *)hvram;
+	/* Render the lower border */
+	if (!bVidelDirtyRowsOnly)
+		VIDEL_fillBorderRows(hvram, lowBorderSize, scrwidth, scrpitch);
+}
 
-				/* Render the upper border */
-				for (h = 0; h < videl.upperBorderSize; h++) {
-					VIDEL_memset_uint32 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch>>2;
-				}
 
-				/* Render the graphical area */
-				for (h = 0; h < vh; h++) {
-					Uint16 *fvram_column = fvram_line;
-					Uint32 *hvram_column = hvram_line;
-
-					/* Left border first */
-					VIDEL_memset_uint32 (hvram_column, HostScreen_getPaletteColor(0), videl.leftBorderSize);
-					hvram_column += videl.leftBorderSize;
-				
-					/* First 16 pixels */
-					VIDEL_bitplaneToChunky(fvram_column, vbpp, color);
-					for (j = 0; j < 16 - hscrolloffset; j++) {
-						*hvram_column++ = HostScreen_getPaletteColor(color[j+hscrolloffset]);
-					}
-					fvram_column += vbpp;
-					/* Now the main part of the line */
-					for (w = 1; w < (vw+15)>>4; w++) {
-						VIDEL_bitplaneToChunky( fvram_column, vbpp, color );
-						for (j=0; j<16; j++) {
-							*hvram_column++ = HostScreen_getPaletteColor( color[j] );
-						}
-						fvram_column += vbpp;
-					}
-					/* Last pixels of the line for fine scrolling */
-					if (hscrolloffset) {
-						VIDEL_bitplaneToChunky(fvram_column, vbpp, color);
-						for (j = 0; j < hscrolloffset; j++) {
-							*hvram_column++ = HostScreen_getPaletteColor(color[j]);
-						}
-					}
-					/* Right border */
-					VIDEL_memset_uint32 (hvram_column, HostScreen_getPaletteColor(0), rightBorderSize);
+/**
+ * Convert the zoomed graphical area rows nFirst to nLast-1. Host rows
+ * showing the same Atari line as the previous one are copied from it,
+ * except for the first row of each band, which doesn't depend on the
+ * rows converted by the other threads.
+ */
+static void VIDEL_ConvertRowsZoom(int nFirst, int nLast, void *pParam)
+{
+	const struct videl_convert_s *conv = pParam;
+	Uint8 *hvram_line = conv->hvram + nFirst * conv->scrpitch;
+	Uint8 *hvram_column;
+	Uint8 *p2cline = NULL;
+	Uint16 *fvram_column;
+	int scrbpp = conv->scrbpp;
+	int zoomwidth = conv->vw * conv->coefx;
+	int h, w, cursrcline = -1;
+
+	if (conv->vbpp < 16 || conv->bIntegerZoom) {
+		/* One complete 16-pixel aligned planar 2 chunky (or TC) line */
+		p2cline = malloc(scrbpp * ((conv->vw+15) & ~15));
+		if (!p2cline)
+			return;
+	}
 
-					fvram_line += nextline;
-					hvram_line += scrpitch>>2;
-				}
+	for (h = nFirst; h < nLast; h++) {
+		fvram_column = conv->fvram + (videl_zoom.zoomytable[h] * conv->nextline);
 
-				/* Render the lower border */
-				for (h = 0; h < lowBorderSize; h++) {
-					VIDEL_memset_uint32 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch>>2;
-				}
-			}
-			break;
+		/* Unchanged line (and its copies) ? */
+		if (!VIDEL_lineChanged(conv, fvram_column)) {
+			/* nothing to do */
 		}
-
-	} else {
-
-		/* Falcon TC (High Color) */
-		switch ( HostScreen_getBpp() )  {
-			case 1:
-			{
-				/* FIXME: when Videl switches to 16bpp, set the palette to 3:3:2 */
-				Uint8 *hvram_line = hvram;
-
-				/* Render the upper border */
-				for (h = 0; h < videl.upperBorderSize; h++) {
-					VIDEL_memset_uint8 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch;
-				}
-
-				/* Render the graphical area */
-				for (h = 0; h < vh; h++) {
-					Uint16 *fvram_column = fvram_line;
-					Uint8 *hvram_column = hvram_line;
-					int tmp;
-
-					/* Left border first */
-					VIDEL_memset_uint8 (hvram_column, HostScreen_getPaletteColor(0), videl.leftBorderSize);
-					hvram_column += videl.leftBorderSize;
-
-					/* Graphical area */
-					for (w = 0; w < vw; w++) {
-						tmp = SDL_SwapBE16(*fvram_column++);
-						*hvram_column++ = (((tmp>>13) & 7) << 5) + (((tmp>>8) & 7) << 2) + (((tmp>>2) & 3));
+		/* Recopy the same line ? */
+		else if (videl_zoom.zoomytable[h] == cursrcline) {
+			memcpy(hvram_line, hvram_line-conv->scrpitch, conv->scrwidth*scrbpp);
+		} else {
+			hvram_column = hvram_line;
+
+			/* Display the Left border */
+			VIDEL_fillBorder(hvram_column, scrbpp, conv->leftBorderSize);
+			hvram_column += conv->leftBorderSize * scrbpp;
+
+			/* Display the Graphical area */
+			if (conv->vbpp < 16) {
+				/* Bitplanes modes : convert the new line, then zoom it */
+				VIDEL_convertBitplaneLine(conv, fvram_column, p2cline);
+				VIDEL_zoomLine(conv, p2cline, hvram_column, zoomwidth);
+			} else if (conv->bIntegerZoom) {
+				/* Falcon high-color (16-bit) mode : convert each pixel once */
+				VIDEL_convertTrueColorLine(conv, fvram_column, p2cline, conv->vw);
+				VIDEL_zoomLine(conv, p2cline, hvram_column, zoomwidth);
+			} else {
+				/* Falcon high-color (16-bit) mode */
+				int *zoomxtable = videl_zoom.zoomxtable;
+
+				for (w = 0; w < zoomwidth; w++) {
+					Uint32 pixel = VIDEL_convertTrueColor(conv, fvram_column[zoomxtable[w]]);
+					switch (scrbpp) {
+						case 1: hvram_column[w] = pixel; break;
+						case 2: ((Uint16 *)hvram_column)[w] = pixel; break;
+						case 4: ((Uint32 *)hvram_column)[w] = pixel; break;
 					}
-
-					/* Right border */
-					VIDEL_memset_uint8 (hvram_column, HostScreen_getPaletteColor(0), rightBorderSize);
-
-					fvram_line += nextline;
-					hvram_line += scrpitch;
-				}
-				/* Render the bottom border */
-				for (h = 0; h < lowBorderSize; h++) {
-					VIDEL_memset_uint8 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch;
-				}
-			}
-			break;
-			case 2:
-			{
-				Uint16 *hvram_line = (Uint16 *)hvram;
-
-				/* Render the upper border */
-				for (h = 0; h < videl.upperBorderSize; h++) {
-					VIDEL_memset_uint16 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch>>1;
-				}
-
-				/* Render the graphical area */
-				for (h = 0; h < vh; h++) {
-					Uint16 *hvram_column = hvram_line;
-#if SDL_BYTEORDER != SDL_BIG_ENDIAN
-					Uint16 *fvram_column;
-#endif
-					/* Left border first */
-					VIDEL_memset_uint16 (hvram_column, HostScreen_getPaletteColor(0), videl.leftBorderSize);
-					hvram_column += videl.leftBorderSize;
-
-#if SDL_BYTEORDER == SDL_BIG_ENDIAN
-					/* FIXME: here might be a runtime little/big video endian switch like:
-						if ( " videocard memory in Motorola endian format " false)
-					*/
-					memcpy(hvram_column, fvram_line, vw<<1);
-					hvram_column += vw<<1;
-#else
-					fvram_column = fvram_line;
-					/* Graphical area */
-					for (w = 0; w < vw; w++)
-						*hvram_column ++ = SDL_SwapBE16(*fvram_column++);
-#endif /* SDL_BYTEORDER == SDL_BIG_ENDIAN */
-
-					/* Right border */
-					VIDEL_memset_uint16 (hvram_column, HostScreen_getPaletteColor(0), rightBorderSize);
-
-					fvram_line += nextline;
-					hvram_line += scrpitch>>1;
-				}
-
-				/* Render the bottom border */
-				for (h = 0; h < lowBorderSize; h++) {
-					VIDEL_memset_uint16 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch>>1;
 				}
 			}
-			break;
-			case 4:
-			{
-				Uint32 *hvram_line = (Uint32 *)hvram;
-
-				/* Render the upper border */
-				for (h = 0; h < videl.upperBorderSize; h++) {
-					VIDEL_memset_uint32 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch>>2;
-				}
-
-				/* Render the graphical area */
-				for (h = 0; h < vh; h++) {
-					Uint16 *fvram_column = fvram_line;
-					Uint32 *hvram_column = hvram_line;
-
-					/* Left border first */
-					VIDEL_memset_uint32 (hvram_column, HostScreen_getPaletteColor(0), videl.leftBorderSize);
-					hvram_column += videl.leftBorderSize;
+			hvram_column += zoomwidth * scrbpp;
 
-					/* Graphical area */
-					for (w = 0; w < vw; w++) {
-						Uint16 srcword = *fvram_column++;
-						*hvram_column ++ = SDL_MapRGB(scrfmt, (srcword & 0xf8), (((srcword & 0x07) << 5) | ((srcword >> 11) & 0x3c)), ((srcword >> 5) & 0xf8));
-					}
-
-					/* Right border */
-					VIDEL_memset_uint32 (hvram_column, HostScreen_getPaletteColor(0), rightBorderSize);
-				}
+			/* Display the Right border */
+			VIDEL_fillBorder(hvram_column, scrbpp, conv->rightBorderSize);
 
-				fvram_line += nextline;
-				hvram_line += scrpitch>>2;
-
-				/* Render the bottom border */
-				for (h = 0; h < lowBorderSize; h++) {
-					VIDEL_memset_uint32 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch>>2;
-				}
-			}
-			break;
+			if (bTTSampleHold && conv->vbpp < 16 && scrbpp == 1)
+				VIDEL_sampleHold(hvram_line, zoomwidth);
 		}
+
+		hvram_line += conv->scrpitch;
+		cursrcline = videl_zoom.zoomytable[h];
 	}
-}
 
+	free(p2cline);
+}
 
 void VIDEL_ConvertScreenZoom(int vw, int vh, int vbpp, int nextline)
 {
-	int i, j, w, h, cursrcline;
+	struct videl_convert_s conv;
+	int i;
 
 	Uint16 *fvram = (Uint16 *) Atari2HostAddr(videl.videoBaseAddr);
-	Uint16 *fvram_line;
-	Uint16 scrIdx = 0;
 
 	int coefx = 1;
 	int coefy = 1;
+	bool bIntegerZoom = false;
 	int scrpitch, scrwidth, scrheight, scrbpp, hscrolloffset;
 	Uint8 *hvram;
-	SDL_PixelFormat *scrfmt;
 
 	/* If emulated computer is the TT, we use the same rendering for display, but without the borders */
 	if (ConfigureParams.System.nMachineType == MACHINE_TT) {
@@ -1533,7 +1929,6 @@ void VIDEL_ConvertScreenZoom(int vw, int vh, int vbpp, int nextline)
 	scrwidth = HostScreen_getWidth();
 	scrheight = HostScreen_getHeight();
 	scrbpp = HostScreen_getBpp();
-	scrfmt = HostScreen_getFormat();
 	hvram = (Uint8 *) HostScreen_getVideoramAddress();
 
 	hscrolloffset = IoMem_ReadByte(0xff8265) & 0x0f;
@@ -1548,6 +1943,7 @@ void VIDEL_ConvertScreenZoom(int vw, int vh, int vbpp, int nextline)
 	if (/*(bx_options.autozoom.integercoefs) &&*/ (scrwidth>=vw) && (scrheight>=vh)) {
 		coefx = scrwidth/vw;
 		coefy = scrheight/vh;
+		bIntegerZoom = true;
 
 		scrwidth = vw * coefx;
 		scrheight = vh * coefy;
@@ -1581,8 +1977,6 @@ void VIDEL_ConvertScreenZoom(int vw, int vh, int vbpp, int nextline)
 		videl_zoom.prev_scrheight = scrheight;
 	}
 
-	cursrcline = -1;
-
 	/* We reuse the following values to compute the display area size in zoom mode */
 	/* scrwidth must not change */
 	if (ConfigureParams.System.nMachineType == MACHINE_FALCON) {
@@ -1591,420 +1985,28 @@ void VIDEL_ConvertScreenZoom(int vw, int vh, int vbpp, int nextline)
 		scrheight = vh * coefy;
 	}
 
-	if (vbpp<16) {
-		Uint8 color[16];
-
-		/* Bitplanes modes */
-		switch(scrbpp) {
-			case 1:
-			{
-				/* One complete 16-pixel aligned planar 2 chunky line */
-				Uint8 *p2cline = malloc(sizeof(Uint8) * ((vw+15) & ~15));
-				Uint8 *hvram_line = hvram;
-				Uint8 *hvram_column = p2cline;
-
-				/* Render the upper border */
-				for (h = 0; h < videl.upperBorderSize * coefy; h++) {
-					VIDEL_memset_uint8 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch;
-				}
-
-				/* Render the graphical area */
-				for (h = 0; h < scrheight; h++) {
-
-					fvram_line = fvram + (videl_zoom.zoomytable[scrIdx] * nextline);
-					scrIdx ++;
-
-					/* Recopy the same line ? */
-					if (videl_zoom.zoomytable[h] == cursrcline) {
-						memcpy(hvram_line, hvram_line-scrpitch, scrwidth*scrbpp);
-					} else {
-						Uint16 *fvram_column = fvram_line;
-						hvram_column = p2cline;
-
-						/* First 16 pixels of a new line */
-						VIDEL_bitplaneToChunky(fvram_column, vbpp, color);
-						memcpy(hvram_column, color+hscrolloffset, 16-hscrolloffset);
-						hvram_column += 16-hscrolloffset;
-						fvram_column += vbpp;
-						/* Convert main part of the new line */
-						for (w=1; w < (vw+15)>>4; w++) {
-							VIDEL_bitplaneToChunky( fvram_column, vbpp, color );
-							memcpy(hvram_column, color, 16);
-							hvram_column += 16;
-							fvram_column += vbpp;
-						}
-						/* Last pixels of the line for fine scrolling */
-						if (hscrolloffset) {
-							VIDEL_bitplaneToChunky(fvram_column, vbpp, color);
-							memcpy(hvram_column, color, hscrolloffset);
-						}
-
-						hvram_column = hvram_line;
-
-						/* Display the Left border */
-						VIDEL_memset_uint8 (hvram_column, HostScreen_getPaletteColor(0), videl.leftBorderSize * coefx);
-						hvram_column += videl.leftBorderSize * coefx;
-
-						/* Display the Graphical area */
-						for (w=0; w<(vw*coefx); w++)
-							hvram_column[w] = p2cline[videl_zoom.zoomxtable[w - videl.leftBorderSize * coefx]];
-						hvram_column += vw * coefx;
-
-						/* Display the Right border */
-						VIDEL_memset_uint8 (hvram_column, HostScreen_getPaletteColor(0), videl.rightBorderSize * coefx);
-						hvram_column += videl.rightBorderSize * coefx;
-
-						if (bTTSampleHold) {
-							Uint8 TMPPixel = 0;
-							for (w=0; w < (vw*coefx); w++) {
-								if (hvram_line[w] == 0) {
-									hvram_line[w] = TMPPixel;
-								} else {
-									TMPPixel = hvram_line[w];
-								}
-							}
-						}
-
-					}
-
-					hvram_line += scrpitch;
-					cursrcline = videl_zoom.zoomytable[h];
-				}
-
-				/* Render the lower border */
-				for (h = 0; h < videl.lowerBorderSize * coefy; h++) {
-					VIDEL_memset_uint8 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch;
-				}
-
-				free(p2cline);
-			}
-			break;
-			case 2:
-			{
-				/* One complete 16-pixel aligned planar 2 chunky line */
-				Uint16 *p2cline = malloc(sizeof(Uint16) * ((vw+15) & ~15));
-				Uint16 *hvram_line = (Uint16 *)hvram;
-				Uint16 *hvram_column = p2cline;
-
-				/* Render the upper border */
-				for (h = 0; h < videl.upperBorderSize * coefy; h++) {
-					VIDEL_memset_uint16 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch>>1;
-				}
-
-				/* Render the graphical area */
-				for (h = 0; h < scrheight; h++) {
-					fvram_line = fvram + (videl_zoom.zoomytable[scrIdx] * nextline);
-					scrIdx ++;
-
-					/* Recopy the same line ? */
-					if (videl_zoom.zoomytable[h] == cursrcline) {
-						memcpy(hvram_line, hvram_line-(scrpitch>>1), scrwidth*scrbpp);
-					} else {
-						Uint16 *fvram_column = fvram_line;
-						hvram_column = p2cline;
-
-						/* First 16 pixels of a new line */
-						VIDEL_bitplaneToChunky(fvram_column, vbpp, color);
-						for (j = 0; j < 16 - hscrolloffset; j++) {
-							*hvram_column++ = HostScreen_getPaletteColor(color[j+hscrolloffset]);
-						}
-						fvram_column += vbpp;
-						/* Convert the main part of the new line */
-						for (w = 1; w < (vw+15)>>4; w++) {
-							VIDEL_bitplaneToChunky( fvram_column, vbpp, color );
-							for (j=0; j<16; j++) {
-								*hvram_column++ = HostScreen_getPaletteColor( color[j] );
-							}
-							fvram_column += vbpp;
-						}
-						/* Last pixels of the new line for fine scrolling */
-						if (hscrolloffset) {
-							VIDEL_bitplaneToChunky(fvram_column, vbpp, color);
-							for (j = 0; j < hscrolloffset; j++) {
-								*hvram_column++ = HostScreen_getPaletteColor(color[j]);
-							}
-						}
-
-						hvram_column = hvram_line;
-
-						/* Display the Left border */
-						VIDEL_memset_uint16 (hvram_column, HostScreen_getPaletteColor(0), videl.leftBorderSize * coefx);
-						hvram_column += videl.leftBorderSize * coefx;
-
-						/* Display the Graphical area */
-						for (w=0; w<(vw*coefx); w++)
-							hvram_column[w] = p2cline[videl_zoom.zoomxtable[w]];
-						hvram_column += vw * coefx;
-
-						/* Display the Right border */
-						VIDEL_memset_uint16 (hvram_column, HostScreen_getPaletteColor(0), videl.rightBorderSize * coefx);
-						hvram_column += videl.rightBorderSize * coefx;
-					}
-
-					hvram_line += scrpitch>>1;
-					cursrcline = videl_zoom.zoomytable[h];
-				}
-
-				/* Render the lower border */
-				for (h = 0; h < videl.lowerBorderSize * coefy; h++) {
-					VIDEL_memset_uint16 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch>>1;
-				}
-
-				free(p2cline);
-			}
-			break;
-			case 4:
-			{
-				/* One complete 16-pixel aligned planar 2 chunky line */
-				Uint32 *p2cline = malloc(sizeof(Uint32) * ((vw+15) & ~15));
-				Uint32 *hvram_line = (Uint32 *)hvram;
-				Uint32 *hvram_column = p2cline;
-
-				/* Render the upper border */
-				for (h = 0; h < videl.upperBorderSize * coefy; h++) {
-					VIDEL_memset_uint32 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch>>2;
-				}
-
-				/* Render the graphical area */
-				for (h = 0; h < scrheight; h++) {
-					fvram_line = fvram + (videl_zoom.zoomytable[scrIdx] * nextline);
-					scrIdx ++;
-					/* Recopy the same line ? */
-					if (videl_zoom.zoomytable[h] == cursrcline) {
-						memcpy(hvram_line, hvram_line-(scrpitch>>2), scrwidth*scrbpp);
-					} else {
-						Uint16 *fvram_column = fvram_line;
-						hvram_column = p2cline;
-
-						/* First 16 pixels of a new line */
-						VIDEL_bitplaneToChunky(fvram_column, vbpp, color);
-						for (j = 0; j < 16 - hscrolloffset; j++) {
-							*hvram_column++ = HostScreen_getPaletteColor(color[j+hscrolloffset]);
-						}
-						fvram_column += vbpp;
-						/* Convert the main part of the new line */
-						for (w = 1; w < (vw+15)>>4; w++) {
-							VIDEL_bitplaneToChunky( fvram_column, vbpp, color );
-							for (j=0; j<16; j++) {
-								*hvram_column++ = HostScreen_getPaletteColor( color[j] );
-							}
-							fvram_column += vbpp;
-						}
-						/* Last pixels of the new line for fine scrolling */
-						if (hscrolloffset) {
-							VIDEL_bitplaneToChunky(fvram_column, vbpp, color);
-							for (j = 0; j < hscrolloffset; j++) {
-								*hvram_column++ = HostScreen_getPaletteColor(color[j]);
-							}
-						}
-
-						hvram_column = hvram_line;
-						/* Display the Left border */
-						VIDEL_memset_uint32 (hvram_column, HostScreen_getPaletteColor(0), videl.leftBorderSize * coefx);
-						hvram_column += videl.leftBorderSize * coefx;
-
-						/* Display the Graphical area */
-						for (w=0; w<(vw*coefx); w++) {
-							hvram_column[w] = p2cline[videl_zoom.zoomxtable[w]];
-						}
-						hvram_column += vw * coefx;
-
-						/* Display the Right border */
-						VIDEL_memset_uint32 (hvram_column, HostScreen_getPaletteColor(0), videl.rightBorderSize * coefx);
-						hvram_column += videl.rightBorderSize * coefx;
-					}
-
-					hvram_line += scrpitch>>2;
-					cursrcline = videl_zoom.zoomytable[h];
-				}
-
-				/* Render the lower border */
-				for (h = 0; h < videl.lowerBorderSize * coefy; h++) {
-					VIDEL_memset_uint32 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch>>2;
-				}
-
-				free(p2cline);
-			}
-			break;
-		}
-	} else {
-		/* Falcon high-color (16-bit) mode */
-
-		switch(scrbpp) {
-			case 1:
-			{
-				/* FIXME: when Videl switches to 16bpp, set the palette to 3:3:2 */
-				Uint8 *hvram_line = hvram;
-				Uint8 *hvram_column = hvram_line;
-
-				/* Render the upper border */
-				for (h = 0; h < videl.upperBorderSize * coefy; h++) {
-					VIDEL_memset_uint8 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch;
-				}
-
-				/* Render the graphical area */
-				for (h = 0; h < scrheight; h++) {
-					Uint16 *fvram_column;
-
-					fvram_line = fvram + (videl_zoom.zoomytable[scrIdx] * nextline);
-					scrIdx ++;
-
-					fvram_column = fvram_line;
-
-					/* Recopy the same line ? */
-					if (videl_zoom.zoomytable[h] == cursrcline) {
-						memcpy(hvram_line, hvram_line-scrpitch, scrwidth*scrbpp);
-					} else {
-
-						hvram_column = hvram_line;
-						/* Display the Left border */
-						VIDEL_memset_uint8 (hvram_column, HostScreen_getPaletteColor(0), videl.leftBorderSize * coefx);
-						hvram_column += videl.leftBorderSize * coefx;
-
-						/* Display the Graphical area */
-						for (w = 0; w<(vw*coefx); w++) {
-							Uint16 srcword;
-							Uint8 dstbyte;
-							
-							srcword = SDL_SwapBE16(fvram_column[videl_zoom.zoomxtable[w - videl.leftBorderSize * coefx]]);
-
-							dstbyte = ((srcword>>13) & 7) << 5;
-							dstbyte |= ((srcword>>8) & 7) << 2;
-							dstbyte |= ((srcword>>2) & 3);
-							*hvram_column++ = dstbyte;
-						}
-
-						/* Display the Right border */
-						VIDEL_memset_uint8 (hvram_column, HostScreen_getPaletteColor(0), videl.rightBorderSize * coefx);
-						hvram_column += videl.rightBorderSize * coefx;
-					}
-
-					hvram_line += scrpitch;
-					cursrcline = videl_zoom.zoomytable[h];
-				}
-
-				/* Render the lower border */
-				for (h = 0; h < videl.lowerBorderSize * coefy; h++) {
-					VIDEL_memset_uint8 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch;
-				}
-			}
-			break;
-			case 2:
-			{
-				Uint16 *hvram_line = (Uint16 *)hvram;
-				Uint16 *hvram_column = hvram_line;
-
-				/* Render the upper border */
-				for (h = 0; h < videl.upperBorderSize * coefy; h++) {
-					VIDEL_memset_uint16 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch>>1;
-				}
-
-				/* Render the graphical area */
-				for (h = 0; h < scrheight; h++) {
-					Uint16 *fvram_column;
-
-					fvram_line = fvram + (videl_zoom.zoomytable[scrIdx] * nextline);
-					scrIdx ++;
-
-					fvram_column = fvram_line;
-
-					/* Recopy the same line ? */
-					if (videl_zoom.zoomytable[h] == cursrcline) {
-						memcpy(hvram_line, hvram_line-(scrpitch>>1), scrwidth*scrbpp);
-					} else {
-
-						hvram_column = hvram_line;
-
-						/* Display the Left border */
-						VIDEL_memset_uint16 (hvram_column, HostScreen_getPaletteColor(0), videl.leftBorderSize * coefx);
-						hvram_column += videl.leftBorderSize * coefx;
-
-						/* Display the Graphical area */
-						for (w=0; w<(vw*coefx); w++)
-							*hvram_column++ = SDL_SwapBE16(fvram_column[videl_zoom.zoomxtable[w]]);
-
-
-						/* Display the Right border */
-						VIDEL_memset_uint16 (hvram_column, HostScreen_getPaletteColor(0), videl.rightBorderSize * coefx);
-						hvram_column += videl.rightBorderSize * coefx;
-					}
-
-					hvram_line += scrpitch>>1;
-					cursrcline = videl_zoom.zoomytable[h];
-				}
-
-				/* Render the lower border */
-				for (h = 0; h < videl.lowerBorderSize * coefy; h++) {
-					VIDEL_memset_uint16 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch>>1;
-				}
-			}
-			break;
-			case 4:
-			{
-				Uint32 *hvram_line = (Uint32 *)hvram;
-				Uint32 *hvram_column = hvram_line;
-
-				/* Render the upper border */
-				for (h = 0; h < videl.upperBorderSize * coefy; h++) {
-					VIDEL_memset_uint32 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-				}
-
-				/* Render the graphical area */
-				for (h = 0; h < scrheight; h++) {
-					Uint16 *fvram_column;
-
-					fvram_line = fvram + (videl_zoom.zoomytable[scrIdx] * nextline);
-					scrIdx ++;
-					fvram_column = fvram_line;
-
-					/* Recopy the same line ? */
-					if (videl_zoom.zoomytable[h] == cursrcline) {
-						memcpy(hvram_line, hvram_line-(scrpitch>>2), scrwidth*scrbpp);
-						hvram_line += scrpitch>>2;
-					} else {
-
-						hvram_column = hvram_line;
-
-						/* Display the Left border */
-						VIDEL_memset_uint32 (hvram_column, HostScreen_getPaletteColor(0), videl.leftBorderSize * coefx);
-						hvram_column += videl.leftBorderSize * coefx;
-
-						/* Display the Graphical area */
-						for (w = 0; w<(vw*coefx); w++) {
-							Uint16 srcword;
-
-							srcword = fvram_column[videl_zoom.zoomxtable[w]];
-							*hvram_column++ = SDL_MapRGB(scrfmt, (srcword & 0xf8), (((srcword & 0x07) << 5) | ((srcword >> 11) & 0x3c)), ((srcword >> 5) & 0xf8));
-						}
-
-						/* Display the Right border */
-						VIDEL_memset_uint32 (hvram_column, HostScreen_getPaletteColor(0), videl.rightBorderSize * coefx);
-						hvram_column += videl.rightBorderSize * coefx;
-					}
-
-					hvram_line += scrpitch>>2;
-					cursrcline = videl_zoom.zoomytable[h];
-				}
-
-				/* Render the lower border */
-				for (h = 0; h < videl.lowerBorderSize * coefy; h++) {
-					VIDEL_memset_uint32 (hvram_line, HostScreen_getPaletteColor(0), scrwidth);
-					hvram_line += scrpitch>>2;
-				}
-			}
-			break;
-		}
-	}
+	/* Render the upper border (unchanged if only rows need update) */
+	if (!bVidelDirtyRowsOnly)
+		VIDEL_fillBorderRows(hvram, videl.upperBorderSize * coefy, scrwidth, scrpitch);
+	hvram += videl.upperBorderSize * coefy * scrpitch;
+
+	/* Render the graphical area */
+	conv.fvram = fvram;
+	conv.hvram = hvram;
+	conv.nextline = nextline;
+	conv.hscrolloffset = hscrolloffset;
+	VIDEL_initConvert(&conv, vw, vbpp);
+	conv.leftBorderSize = videl.leftBorderSize * coefx;
+	conv.rightBorderSize = videl.rightBorderSize * coefx;
+	conv.coefx = coefx;
+	conv.bIntegerZoom = bIntegerZoom;
+	conv.scrwidth = scrwidth;
+	RowPool_Run(scrheight, VIDEL_ConvertRowsZoom, &conv);
+	hvram += scrheight * scrpitch;
+
+	/* Render the lower border */
+	if (!bVidelDirtyRowsOnly)
+		VIDEL_fillBorderRows(hvram, videl.lowerBorderSize * coefy, scrwidth, scrpitch);
 }
 
 static void VIDEL_memset_uint32(Uint32 *addr, Uint32 color, int count)
@@ -414,6 +414,7 @@ enum
 #define	FDC_DELAY_CYCLE_TYPE_IV_PREPARE		(100*8)		/* FIXME [NP] : this was not measured */
 #define	FDC_DELAY_CYCLE_COMMAND_COMPLETE	(1*8)		/* Number of cycles before going to the _COMPLETE state (~8 cpu cycles) */
 #define	FDC_DELAY_CYCLE_COMMAND_IMMEDIATE	(0)		/* Number of cycles to go immediately to another state */
+#define	FDC_DELAY_CYCLE_TURBO			(16*8)		/* Max delay between 2 states when a command runs in turbo mode */
 
 /* When the drive is switched off or if there's no floppy, some commands will wait forever */
 /* as they can't find the next index pulse. Instead of continuously testing if a valid drive */
@@ -480,6 +481,7 @@ typedef struct {
 	Uint8		InterruptCond;				/* For a type IV force interrupt, contains the condition on the lower 4 bits */
 
 	int		EmulationMode;				/* FDC_EMULATION_MODE_INTERNAL or FDC_EMULATION_MODE_IPF */
+	bool		TurboCommand;				/* true if the current command runs with collapsed delays */
 } FDC_STRUCT;
 
 
@@ -512,6 +514,7 @@ typedef struct {
 	Uint8		NumberOfHeads;				/* 1 for single sided drive, 2 for double sided */
 
 	Uint64		IndexPulse_Time;			/* CyclesGlobalClockCounter value last time we had an index pulse with motor ON */
+	bool		TurboDisabled;				/* true if a program polled the FDC during a turbo command */
 } FDC_DRIVE_STRUCT;
 
 
@@ -532,10 +535,31 @@ typedef struct {
 } FDC_BUFFER_STRUCT;
 
 
+/**
+ * When reading from the disk with DMA sector count > 0, bytes are not
+ * transferred with one timer per byte, but with one timer per burst of bytes
+ * ending when the DMA's FIFO is full (or at the end of FDC_BUFFER).
+ * The only change visible by the CPU during a burst are the unused bits
+ * of the DMA status at $ff8606 ; when $ff8604/$ff8606 are accessed, FDC_Burst_Sync()
+ * pushes the bytes that should already have been read by the FDC at this point.
+ * DMA address and sector count are only updated at the end of the burst,
+ * when the FIFO is full, as with a transfer of 1 byte per timer.
+ */
+typedef struct {
+	int		NbBytes;				/* Number of bytes in the running burst, or 0 if no burst */
+	int		PosStart;				/* Position in FDC_BUFFER of the 1st byte of the burst */
+	int		CpuCycles;				/* Delay in cpu cycles until the last byte of the burst */
+} FDC_BURST_STRUCT;
+
+
 static FDC_STRUCT	FDC;					/* All variables related to the WD1772 emulation */
 static FDC_DMA_STRUCT	FDC_DMA;				/* All variables related to the DMA transfer */
 static FDC_DRIVE_STRUCT	FDC_DRIVES[ MAX_FLOPPYDRIVES ];		/* A: and B: */
 static FDC_BUFFER_STRUCT	FDC_BUFFER;			/* Buffer of Timing/Byte to transfer with the FDC */
+static FDC_BURST_STRUCT	FDC_BURST;				/* Bytes of FDC_BUFFER transferred by the current timer */
+
+/* Read sector commands for the boot sector of drive A (used by the boot snapshot cache) */
+Uint32	FDC_BootSectorReads = 0;
 
 static Uint8 DMADiskWorkSpace[ FDC_TRACK_BYTES_STANDARD*4+1000 ];/* Workspace used to transfer bytes between floppy and DMA */
 								/* It should be large enough to contain a whole track */
@@ -550,11 +574,17 @@ static Uint8 DMADiskWorkSpace[ FDC_TRACK_BYTES_STANDARD*4+1000 ];/* Workspace us
 static Uint32	FDC_DelayToFdcCycles ( Uint32 Delay_micro );
 static Uint32	FDC_FdcCyclesToCpuCycles ( Uint32 FdcCycles );
 static Uint32	FDC_CpuCyclesToFdcCycles ( Uint32 CpuCycles );
+static Uint32	FDC_TimerFdcCyclesToCpuCycles ( int FdcCycles );
 static void	FDC_StartTimer_FdcCycles ( int FdcCycles , int InternalCycleOffset );
 static int	FDC_TransferByte_FdcCycles ( int NbBytes );
 static void	FDC_CRC16 ( Uint8 *buf , int nb , Uint16 *pCRC );
 
 static void	FDC_ResetDMA ( void );
+static int	FDC_Burst_Start ( void );
+static void	FDC_Burst_Transfer ( void );
+static void	FDC_Burst_Sync ( bool StopBurst );
+static bool	FDC_Turbo_Possible ( Uint8 Type );
+static void	FDC_Turbo_Stop ( bool Sticky );
 
 static int	FDC_GetEmulationMode ( void );
 static void	FDC_UpdateAll ( void );
@@ -626,6 +656,7 @@ void	FDC_MemorySnapShot_Capture(bool bSave)
 	MemorySnapShot_Store(&FDC_DMA, sizeof(FDC_DMA));
 	MemorySnapShot_Store(&FDC_DRIVES, sizeof(FDC_DRIVES));
 	MemorySnapShot_Store(&FDC_BUFFER, sizeof(FDC_BUFFER_STRUCT));
+	MemorySnapShot_Store(&FDC_BURST, sizeof(FDC_BURST_STRUCT));
 
 	MemorySnapShot_Store(DMADiskWorkSpace, sizeof(DMADiskWorkSpace));
 }
@@ -649,6 +680,17 @@ void	FDC_Drive_Set_BusyLed ( Uint8 STR )
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Return true while the FDC is executing a command (the fake command used
+ * to stop the motor after the last one doesn't count)
+ */
+bool	FDC_IsBusy ( void )
+{
+	return ( FDC.Command != FDCEMU_CMD_NULL ) && ( FDC.Command != FDCEMU_CMD_MOTOR_STOP );
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Return a small text + length with the current values of the FDC's registers
@@ -779,18 +821,29 @@ static Uint32	FDC_CpuCyclesToFdcCycles ( Uint32 CpuCycles )
 
 /*-----------------------------------------------------------------------*/
 /**
- * Start an internal timer to handle the FDC's events.
+ * Convert a delay in fdc cycles to the number of cpu cycles used for
+ * the FDC's internal timer.
  * If "fast floppy" mode is used, we speed up the timer by dividing
  * the number of cycles by a fixed number.
  */
-static void	FDC_StartTimer_FdcCycles ( int FdcCycles , int InternalCycleOffset )
+static Uint32	FDC_TimerFdcCyclesToCpuCycles ( int FdcCycles )
 {
-//fprintf ( stderr , "fdc start timer %d cycles\n" , FdcCycles );
-
 	if ( ( ConfigureParams.DiskImage.FastFloppy ) && ( FdcCycles > FDC_FAST_FDC_FACTOR ) )
 		FdcCycles /= FDC_FAST_FDC_FACTOR;
 
-	CycInt_AddRelativeInterruptWithOffset ( FDC_FdcCyclesToCpuCycles ( FdcCycles ) , INT_CPU_CYCLE , INTERRUPT_FDC , InternalCycleOffset );
+	return FDC_FdcCyclesToCpuCycles ( FdcCycles );
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Start an internal timer to handle the FDC's events.
+ */
+static void	FDC_StartTimer_FdcCycles ( int FdcCycles , int InternalCycleOffset )
+{
+//fprintf ( stderr , "fdc start timer %d cycles\n" , FdcCycles );
+
+	CycInt_AddRelativeInterruptWithOffset ( FDC_TimerFdcCyclesToCpuCycles ( FdcCycles ) , INT_CPU_CYCLE , INTERRUPT_FDC , InternalCycleOffset );
 }
 
 
@@ -892,6 +945,7 @@ void FDC_Reset ( bool bCold )
 	FDC.CommandType = 0;
 	FDC.InterruptCond = 0;
 	FDC.IRQ_Signal = 0;
+	FDC.TurboCommand = false;
 
 	FDC.IndexPulse_Counter = 0;
 	for ( i=0 ; i<MAX_FLOPPYDRIVES ; i++ )
@@ -905,6 +959,7 @@ void FDC_Reset ( bool bCold )
 	FDC_ResetDMA();
 
 	FDC_Buffer_Reset();
+	FDC_BURST.NbBytes = 0;
 
 	/* Also reset IPF emulation */
 	IPF_Reset();
@@ -1168,6 +1223,183 @@ int	FDC_Buffer_Get_Size ( void )
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Return the delay in fdc cycles before transferring the next byte(s) of
+ * FDC_BUFFER to the DMA.
+ * If DMA sector count is not 0, all the bytes until the DMA's FIFO is full
+ * (or until the end of FDC_BUFFER) are handled as a single burst : the
+ * fdc timer will expire only once, after the delay of the last byte of the burst.
+ * The timer's delay in cpu cycles is the sum of the delays of each byte, as if
+ * a timer was started for each byte (see FDC_InterruptHandler_Update()).
+ */
+static int	FDC_Burst_Start ( void )
+{
+	int	NbBytes;
+	int	FdcCycles;
+	int	i;
+
+	FDC_BURST.NbBytes = 0;
+
+	/* If DMA is OFF, no FIFO transfer will happen, use 1 timer per byte */
+	/* In turbo mode, FDC_Burst_Transfer() will transfer all the bytes at once */
+	if ( ( FDC_DMA.SectorCount == 0 ) || FDC.TurboCommand )
+		return FDC_Buffer_Read_Timing ();
+
+	NbBytes = FDC_DMA_FIFO_SIZE - FDC_DMA.FIFO_Size;
+	if ( NbBytes > FDC_BUFFER.Size - FDC_BUFFER.PosRead )
+		NbBytes = FDC_BUFFER.Size - FDC_BUFFER.PosRead;
+	if ( NbBytes <= 1 )
+		return FDC_Buffer_Read_Timing ();
+
+	FdcCycles = 0;
+	FDC_BURST.CpuCycles = 0;
+	for ( i = FDC_BUFFER.PosRead ; i < FDC_BUFFER.PosRead + NbBytes ; i++ )
+	{
+		FdcCycles += FDC_BUFFER.Data[ i ].Timing;
+		FDC_BURST.CpuCycles += FDC_TimerFdcCyclesToCpuCycles ( FDC_BUFFER.Data[ i ].Timing );
+	}
+
+	FDC_BURST.NbBytes = NbBytes;
+	FDC_BURST.PosStart = FDC_BUFFER.PosRead;
+
+//fprintf ( stderr , "fdc burst start pos=%d nb=%d cpu_cycles=%d\n" , FDC_BURST.PosStart , NbBytes , FDC_BURST.CpuCycles );
+	return FdcCycles;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Transfer the next byte of FDC_BUFFER to the DMA, or the remaining bytes
+ * of the current burst if FDC_Burst_Start() started one.
+ */
+static void	FDC_Burst_Transfer ( void )
+{
+	int	PosEnd;
+
+	if ( FDC.TurboCommand )
+	{
+		while ( FDC_BUFFER.PosRead < FDC_BUFFER.Size )
+			FDC_DMA_FIFO_Push ( FDC_Buffer_Read_Byte () );
+		return;
+	}
+
+	if ( FDC_BURST.NbBytes == 0 )
+	{
+		FDC_DMA_FIFO_Push ( FDC_Buffer_Read_Byte () );
+		return;
+	}
+
+	PosEnd = FDC_BURST.PosStart + FDC_BURST.NbBytes;
+	while ( FDC_BUFFER.PosRead < PosEnd )
+		FDC_DMA_FIFO_Push ( FDC_Buffer_Read_Byte () );
+
+	FDC_BURST.NbBytes = 0;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * When the CPU accesses the DMA/FDC registers during a burst, push to the DMA
+ * the bytes that would already have been transferred with 1 timer per byte.
+ * The last byte of the burst is always left to the fdc timer, as it's the
+ * one that will fill the FIFO.
+ * If StopBurst is true (when DMA's state is changed by the CPU), the burst
+ * is also shortened to end with the next byte, so the next burst will be
+ * computed using the new DMA's state.
+ */
+static void	FDC_Burst_Sync ( bool StopBurst )
+{
+	int	CyclesElapsed;
+	int	Cycles;
+	int	PosEnd;
+	int	i;
+
+	if ( ( FDC_BURST.NbBytes == 0 ) || !CycInt_InterruptActive ( INTERRUPT_FDC ) )
+		return;
+
+	CyclesElapsed = FDC_BURST.CpuCycles - CycInt_FindCyclesPassed ( INTERRUPT_FDC , INT_CPU_CYCLE );
+	PosEnd = FDC_BURST.PosStart + FDC_BURST.NbBytes;
+
+	Cycles = 0;
+	for ( i = FDC_BURST.PosStart ; i < PosEnd - 1 ; i++ )
+	{
+		Cycles += FDC_TimerFdcCyclesToCpuCycles ( FDC_BUFFER.Data[ i ].Timing );
+		if ( i < FDC_BUFFER.PosRead )			/* Byte already pushed by a previous call */
+			continue;
+		if ( Cycles > CyclesElapsed )			/* Byte not read yet */
+		{
+			Cycles -= FDC_TimerFdcCyclesToCpuCycles ( FDC_BUFFER.Data[ i ].Timing );
+			break;
+		}
+		FDC_DMA_FIFO_Push ( FDC_Buffer_Read_Byte () );
+	}
+
+	if ( StopBurst && ( FDC_BUFFER.PosRead < PosEnd - 1 ) )
+	{
+		/* End the burst with the next byte and restart a burst from there */
+		Cycles += FDC_TimerFdcCyclesToCpuCycles ( FDC_BUFFER.Data[ FDC_BUFFER.PosRead ].Timing );
+		CycInt_ModifyInterrupt ( Cycles - FDC_BURST.CpuCycles , INT_CPU_CYCLE , INTERRUPT_FDC );
+		FDC_BURST.NbBytes = FDC_BUFFER.PosRead - FDC_BURST.PosStart + 1;
+		FDC_BURST.CpuCycles = Cycles;
+	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return true if a new command of type 'Type' can run in turbo mode :
+ * seek, spin up, rotation and transfer delays are collapsed, so the
+ * sector is transferred by the DMA immediately and the IRQ comes after
+ * a few states of at most FDC_DELAY_CYCLE_TURBO.
+ * This is only possible for type I/II commands with ST/MSA/DIM images.
+ * Read address/track and write track are often used by protections and
+ * always use exact timings, as well as STX images.
+ */
+static bool	FDC_Turbo_Possible ( Uint8 Type )
+{
+	int	ImageType;
+
+	if ( !ConfigureParams.DiskImage.TurboFloppy )
+		return false;
+
+	if ( ( Type != 1 ) && ( Type != 2 ) )
+		return false;
+
+	if ( ( FDC.DriveSelSignal < 0 ) || ( !FDC_DRIVES[ FDC.DriveSelSignal ].Enabled )
+	  || ( !FDC_DRIVES[ FDC.DriveSelSignal ].DiskInserted ) || ( FDC_DRIVES[ FDC.DriveSelSignal ].TurboDisabled ) )
+		return false;
+
+	ImageType = EmulationDrives[ FDC.DriveSelSignal ].ImageType;
+	return ( ImageType == FLOPPY_IMAGE_TYPE_ST ) || ( ImageType == FLOPPY_IMAGE_TYPE_MSA )
+		|| ( ImageType == FLOPPY_IMAGE_TYPE_DIM );
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Continue the current command with exact timings.
+ * If Sticky is true (a program polled the FDC status or the DMA address
+ * during a turbo command, which is what most protections do), all the next
+ * commands on this drive will also use exact timings until another disk is inserted.
+ */
+static void	FDC_Turbo_Stop ( bool Sticky )
+{
+	int	FrameCycles, HblCounterVideo, LineCycles;
+
+	if ( !FDC.TurboCommand )
+		return;
+
+	Video_GetPosition ( &FrameCycles , &HblCounterVideo , &LineCycles );
+	LOG_TRACE(TRACE_FDC, "fdc turbo stop sticky=%d drive=%d VBL=%d video_cyc=%d %d@%d pc=%x\n",
+		Sticky , FDC.DriveSelSignal , nVBLs, FrameCycles, LineCycles, HblCounterVideo, M68000_GetPC());
+
+	FDC.TurboCommand = false;
+	if ( Sticky && ( FDC.DriveSelSignal >= 0 ) )
+		FDC_DRIVES[ FDC.DriveSelSignal ].TurboDisabled = true;
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Return the mode to handle a read/write in $ff86xx
@@ -1281,6 +1513,7 @@ void	FDC_InsertFloppy ( int Drive )
 	if ( ( Drive >= 0 ) && ( Drive < MAX_FLOPPYDRIVES ) )
 	{
 		FDC_DRIVES[ Drive ].DiskInserted = true;
+		FDC_DRIVES[ Drive ].TurboDisabled = false;		/* Try turbo mode again with a new disk */
 		if ( ( FDC.STR & FDC_STR_BIT_MOTOR_ON ) != 0 )		/* If we insert a floppy while motor is already on, we must */
 			FDC_IndexPulse_Init ( Drive );			/* init the index pulse's position */
 		else
@@ -1302,6 +1535,7 @@ void	FDC_EjectFloppy ( int Drive )
 	if ( ( Drive >= 0 ) && ( Drive < MAX_FLOPPYDRIVES ) )
 	{
 		FDC_DRIVES[ Drive ].DiskInserted = false;
+		FDC_DRIVES[ Drive ].TurboDisabled = false;
 		FDC_DRIVES[ Drive ].IndexPulse_Time = 0;		/* Stop counting index pulses on an empty drive */
 	}
 }
@@ -1803,7 +2037,14 @@ void FDC_InterruptHandler_Update ( void )
 
 	if ( FDC.Command != FDCEMU_CMD_NULL )
 	{
-		FDC_StartTimer_FdcCycles ( FdcCycles , -PendingCyclesOver );
+		if ( FDC_BURST.NbBytes > 0 )				/* Timer for a whole burst of bytes */
+			CycInt_AddRelativeInterruptWithOffset ( FDC_BURST.CpuCycles , INT_CPU_CYCLE , INTERRUPT_FDC , -PendingCyclesOver );
+		else
+		{
+			if ( FDC.TurboCommand && ( FdcCycles > FDC_DELAY_CYCLE_TURBO ) )
+				FdcCycles = FDC_DELAY_CYCLE_TURBO;	/* Collapse all delays in turbo mode */
+			FDC_StartTimer_FdcCycles ( FdcCycles , -PendingCyclesOver );
+		}
 	}
 }
 
@@ -1857,6 +2098,7 @@ static int FDC_CmdCompleteCommon ( bool DoInt )
 		nVBLs, FrameCycles, LineCycles, HblCounterVideo, M68000_GetPC());
 
 	FDC_Update_STR ( FDC_STR_BIT_BUSY , 0 );			/* Remove busy bit */
+	FDC.TurboCommand = false;					/* Motor stop always uses exact timings */
 
 	if ( DoInt )
 		FDC_SetIRQ ( FDC_IRQ_SOURCE_COMPLETE );
@@ -2521,15 +2763,15 @@ static int FDC_UpdateReadSectorsCmd ( void )
 				FDC_Update_STR ( FDC_STR_BIT_RECORD_TYPE , 0 );
 
 			FDC.CommandState = FDCEMU_RUN_READSECTORS_READDATA_TRANSFER_LOOP;
-			FdcCycles = FDC_Buffer_Read_Timing ();		/* Delay to transfer the first byte */
+			FdcCycles = FDC_Burst_Start ();			/* Delay to transfer the first byte(s) */
 		}
 		break;
 	 case FDCEMU_RUN_READSECTORS_READDATA_TRANSFER_LOOP:
-		/* Transfer the sector 1 byte at a time using DMA */
-		FDC_DMA_FIFO_Push ( FDC_Buffer_Read_Byte () );		/* Add 1 byte to the DMA FIFO */
+		/* Transfer the sector using DMA, 1 byte or 1 burst at a time */
+		FDC_Burst_Transfer ();					/* Add 1 byte or a burst of bytes to the DMA FIFO */
 		if ( FDC_BUFFER.PosRead < FDC_Buffer_Get_Size () )
 		{
-			FdcCycles = FDC_Buffer_Read_Timing ();		/* Delay to transfer the next byte */
+			FdcCycles = FDC_Burst_Start ();			/* Delay to transfer the next byte(s) */
 		}
 		else							/* Sector transferred, check the CRC */
 		{
@@ -2879,14 +3121,14 @@ static int FDC_UpdateReadAddressCmd ( void )
 		FDC.SR = FDC_Buffer_Read_Byte_pos ( 0 );		/* The 1st byte of the ID field is also copied into Sector Register */
 
 		FDC.CommandState = FDCEMU_RUN_READADDRESS_TRANSFER_LOOP;
-		FdcCycles = FDC_Buffer_Read_Timing ();			/* Delay to transfer the first byte */
+		FdcCycles = FDC_Burst_Start ();				/* Delay to transfer the first byte(s) */
 		break;
 	 case FDCEMU_RUN_READADDRESS_TRANSFER_LOOP:
-		/* Transfer the ID field 1 byte at a time using DMA */
-		FDC_DMA_FIFO_Push ( FDC_Buffer_Read_Byte () );		/* Add 1 byte to the DMA FIFO */
+		/* Transfer the ID field using DMA, 1 byte or 1 burst at a time */
+		FDC_Burst_Transfer ();					/* Add 1 byte or a burst of bytes to the DMA FIFO */
 		if ( FDC_BUFFER.PosRead < FDC_Buffer_Get_Size () )
 		{
-			FdcCycles = FDC_Buffer_Read_Timing ();		/* Delay to transfer the next byte */
+			FdcCycles = FDC_Burst_Start ();			/* Delay to transfer the next byte(s) */
 		}
 		else
 		{
@@ -2978,7 +3220,7 @@ static int FDC_UpdateReadTrackCmd ( void )
 				  nVBLs, FrameCycles, LineCycles, HblCounterVideo, M68000_GetPC());
 
 			for ( i=0 ; i<FDC_GetBytesPerTrack ( FDC.DriveSelSignal ) ; i++ )
-				FDC_Buffer_Add ( rand() & 0xff );	/* Fill the track buffer with random bytes */
+				FDC_Buffer_Add ( Hatari_rand() & 0xff );	/* Fill the track buffer with random bytes */
 		}
 		else if ( EmulationDrives[ FDC.DriveSelSignal ].ImageType == FLOPPY_IMAGE_TYPE_STX )
 		{
@@ -2990,14 +3232,14 @@ static int FDC_UpdateReadTrackCmd ( void )
 		}
 
 		FDC.CommandState = FDCEMU_RUN_READTRACK_TRANSFER_LOOP;
-		FdcCycles = FDC_Buffer_Read_Timing ();			/* Delay to transfer the first byte */
+		FdcCycles = FDC_Burst_Start ();				/* Delay to transfer the first byte(s) */
 		break;
 	 case FDCEMU_RUN_READTRACK_TRANSFER_LOOP:
-		/* Transfer the track 1 byte at a time using DMA */
-		FDC_DMA_FIFO_Push ( FDC_Buffer_Read_Byte () );		/* Add 1 byte to the DMA FIFO */
+		/* Transfer the track using DMA, 1 byte or 1 burst at a time */
+		FDC_Burst_Transfer ();					/* Add 1 byte or a burst of bytes to the DMA FIFO */
 		if ( FDC_BUFFER.PosRead < FDC_Buffer_Get_Size () )
 		{
-			FdcCycles = FDC_Buffer_Read_Timing ();		/* Delay to transfer the next byte */
+			FdcCycles = FDC_Burst_Start ();			/* Delay to transfer the next byte(s) */
 		}
 		else							/* Track completely transferred */
 		{
@@ -3149,6 +3391,8 @@ static bool FDC_Set_MotorON ( Uint8 FDC_CR )
 
 		FDC_Update_STR ( FDC_STR_BIT_SPIN_UP , 0 );		/* Unset spin up bit */
 		FDC.IndexPulse_Counter = 0;				/* Reset counter to measure the spin up sequence */
+		if ( FDC.TurboCommand )
+			FDC.IndexPulse_Counter = FDC_DELAY_IP_SPIN_UP;	/* Spin up is immediately complete in turbo mode */
 		SpinUp = true;
 	}
 	else								/* No spin up : don't add delay to start the motor */
@@ -3329,6 +3573,9 @@ static int FDC_TypeII_ReadSector ( void )
 		  FDC.SideSignal , FDC.DriveSelSignal , FDC_DMA.SectorCount ,
 		  FDC_GetDMAAddress(), nVBLs, FrameCycles, LineCycles, HblCounterVideo, M68000_GetPC());
 
+	if ( FDC.DriveSelSignal == 0 && FDC.SideSignal == 0 && FDC.TR == 0 && FDC.SR == 1 )
+		FDC_BootSectorReads++;
+
 	/* Set emulation to read sector(s) */
 	FDC.Command = FDCEMU_CMD_READSECTORS;
 	FDC.CommandState = FDCEMU_RUN_READSECTORS_READDATA;
@@ -3644,6 +3891,9 @@ static void FDC_ExecuteCommand ( void )
 	/* when we call FDC_ExecuteTypeIVCommands() */
 	FDC.InterruptCond = 0;
 
+	/* A new command replaces the timer of a running burst */
+	FDC_BURST.NbBytes = 0;
+
 	/* Check type of command and execute */
 	if ( Type == 1 )						/* Type I - Restore, Seek, Step, Step-In, Step-Out */
 		FdcCycles = FDC_ExecuteTypeICommands();
@@ -3654,6 +3904,10 @@ static void FDC_ExecuteCommand ( void )
 	else								/* Type IV - Force Interrupt */
 		FdcCycles = FDC_ExecuteTypeIVCommands();
 
+	FDC.TurboCommand = FDC_Turbo_Possible ( Type );
+	if ( FDC.TurboCommand && ( FdcCycles > FDC_DELAY_CYCLE_TURBO ) )
+		FdcCycles = FDC_DELAY_CYCLE_TURBO;
+
 	FDC.ReplaceCommandPossible = true;				/* This new command can be replaced during the prepare+spinup phase */
 	FDC_StartTimer_FdcCycles ( FdcCycles , 0 );
 }
@@ -3816,6 +4070,8 @@ void FDC_DiskController_WriteWord ( void )
 
 	M68000_WaitState(4);
 
+	FDC_Burst_Sync ( true );					/* DMA/FDC state might change */
+
 	Video_GetPosition ( &FrameCycles , &HblCounterVideo , &LineCycles );
 
 	LOG_TRACE(TRACE_FDC, "fdc write 8604 data=0x%x VBL=%d video_cyc=%d %d@%d pc=%x\n" ,
@@ -3901,6 +4157,8 @@ void FDC_DiskControllerStatus_ReadWord ( void )
 		return;
 	}
 
+	FDC_Burst_Sync ( false );					/* Update ff8604_recent_val */
+
 	/* Are we trying to read the DMA SectorCount ? */
 	if ( FDC_DMA.Mode & 0x10 )					/* Bit 4 */
 	{
@@ -3931,6 +4189,8 @@ void FDC_DiskControllerStatus_ReadWord ( void )
 			switch ( FDC_reg )
 			{
 			 case 0x0:						/* 0 0 - Status register */
+				FDC_Turbo_Stop ( true );			/* Program polls the FDC, use exact timings */
+
 				/* If we report a type I status, some bits are updated in real time */
 				/* depending on the corresponding signals. If this is not a type I, we return STR unmodified */
 				/* [NP] Contrary to what is written in the WD1772 doc, the WPRT bit */
@@ -4065,6 +4325,8 @@ void FDC_DmaModeControl_WriteWord ( void )
 
 	M68000_WaitState(4);
 
+	FDC_Burst_Sync ( true );					/* DMA state might change */
+
 	Mode_prev = FDC_DMA.Mode;					/* Store previous to check for _read/_write toggle (DMA reset) */
 	FDC_DMA.Mode = IoMem_ReadWord(0xff8606);			/* Store to DMA Mode control */
 
@@ -4110,6 +4372,8 @@ void FDC_DmaStatus_ReadWord ( void )
 		return;
 	}
 
+	FDC_Burst_Sync ( false );					/* Update ff8604_recent_val */
+
 	/* Update Bit1 for zero sector count */
 	if ( FDC_DMA.SectorCount != 0 )
 		FDC_DMA.Status |= 0x02;
@@ -4131,6 +4395,8 @@ void	FDC_DmaAddress_ReadByte ( void )
 {
 	int FrameCycles, HblCounterVideo, LineCycles;
 
+	FDC_Turbo_Stop ( true );					/* Program polls the DMA, use exact timings */
+
 	Video_GetPosition ( &FrameCycles , &HblCounterVideo , &LineCycles );
 
 	LOG_TRACE(TRACE_FDC, "fdc read dma address %x val=0x%02x address=0x%x VBL=%d video_cyc=%d %d@%d pc=%x\n" ,
@@ -4247,6 +4513,23 @@ static int	FDC_NextSectorID_FdcCycles_ST ( Uint8 Drive , Uint8 NumberOfHeads , U
 		return -1;
 
 	MaxSector = FDC_GetSectorsPerTrack ( Drive , Track , Side );
+
+	/* In turbo mode, the ID field we're looking for is immediately under the head */
+	/* If it doesn't exist, we need exact timings to get RNF after 5 revolutions */
+	if ( FDC.TurboCommand )
+	{
+		if ( ( Track == FDC.TR )
+		  && ( ( FDC.CommandType == 1 ) || ( ( FDC.SR >= 1 ) && ( FDC.SR <= MaxSector ) ) ) )
+		{
+			FDC.NextSector_ID_Field_TR = Track;
+			FDC.NextSector_ID_Field_SR = ( FDC.CommandType == 1 ) ? 1 : FDC.SR;
+			FDC.NextSector_ID_Field_LEN = FDC_SECTOR_SIZE_512;
+			FDC.NextSector_ID_Field_CRC_OK = 1;
+			return FDC_DELAY_CYCLE_COMMAND_IMMEDIATE;
+		}
+		FDC_Turbo_Stop ( false );
+	}
+
 	TrackPos = FDC_TRACK_LAYOUT_STANDARD_GAP1;			/* Position of 1st raw sector */
 	TrackPos += FDC_TRACK_LAYOUT_STANDARD_GAP2;			/* Position of ID Field in 1st raw sector */
 
@@ -183,6 +183,34 @@ bool File_DoesFileNameEndWithSlash(char *pszFileName)
 }
 
 
+/* File contents read in advance, returned by the next HFile_Read() of it */
+static char *pszPreloadedName;
+static Uint8 *pPreloadedData;
+static long nPreloadedSize;
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Hand the (allocated) contents of given file over to the next
+ * HFile_Read() call for this file name. Unclaimed earlier contents
+ * are freed, pszFileName NULL only does that.
+ */
+void HFile_SetPreloaded(const char *pszFileName, Uint8 *pData, long nSize)
+{
+	free(pszPreloadedName);
+	free(pPreloadedData);
+	pszPreloadedName = NULL;
+	pPreloadedData = NULL;
+	if (!pszFileName)
+		return;
+	pszPreloadedName = strdup(pszFileName);
+	if (pszPreloadedName)
+		pPreloadedData = pData;
+	else
+		free(pData);
+	nPreloadedSize = nSize;
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Read file from disk into allocated buffer and return the buffer
@@ -195,6 +223,16 @@ Uint8 *HFile_Read(const char *pszFileName, long *pFileSize, const char * const p
 	Uint8 *pFile = NULL;
 	long FileSize = 0;
 
+	if (pszPreloadedName && strcmp(pszFileName, pszPreloadedName) == 0)
+	{
+		pFile = pPreloadedData;
+		pPreloadedData = NULL;
+		HFile_SetPreloaded(NULL, NULL, 0);
+		if (pFileSize)
+			*pFileSize = nPreloadedSize;
+		return pFile;
+	}
+
 	/* Does the file exist? If not, see if can scan for other extensions and try these */
 	if (!File_Exists(pszFileName) && ppszExts)
 	{
@@ -273,34 +311,28 @@ Uint8 *HFile_Read(const char *pszFileName, long *pFileSize, const char * const p
 
 /*-----------------------------------------------------------------------*/
 /**
- * Save file to disk, return FALSE if errors
+ * Write data to given file path, gzipped if bGzip is set.
+ * Return FALSE if errors
  */
-bool File_Save(const char *pszFileName, const Uint8 *pAddress, size_t Size, bool bQueryOverwrite)
+static bool File_WriteData(const char *pszPath, bool bGzip, const Uint8 *pAddress, size_t Size)
 {
 	bool bRet = false;
 
-	/* Check if need to ask user if to overwrite */
-	if (bQueryOverwrite)
-	{
-		/* If file exists, ask if OK to overwrite */
-		if (!File_QueryOverwrite(pszFileName))
-			return false;
-	}
-
 #if HAVE_LIBZ
 	/* Normal file or gzipped file? */
-	if (File_DoesFileExtensionMatch(pszFileName, ".gz"))
+	if (bGzip)
 	{
 		gzFile hGzFile;
 		/* Create a gzipped file: */
-		hGzFile = gzopen(pszFileName, "wb");
+		hGzFile = gzopen(pszPath, "wb");
 		if (hGzFile != NULL)
 		{
 			/* Write data, set success flag */
 			if (gzwrite(hGzFile, pAddress, Size) == (int)Size)
 				bRet = true;
 
-			gzclose(hGzFile);
+			if (gzclose(hGzFile) != Z_OK)
+				bRet = false;
 		}
 	}
 	else
@@ -308,14 +340,15 @@ bool File_Save(const char *pszFileName, const Uint8 *pAddress, size_t Size, bool
 	{
 		FILE *hDiskFile;
 		/* Create a normal file: */
-		hDiskFile = fopen(pszFileName, "wb");
+		hDiskFile = fopen(pszPath, "wb");
 		if (hDiskFile != NULL)
 		{
 			/* Write data, set success flag */
 			if (fwrite(pAddress, 1, Size, hDiskFile) == Size)
 				bRet = true;
 
-			fclose(hDiskFile);
+			if (fclose(hDiskFile) != 0)
+				bRet = false;
 		}
 	}
 
@@ -323,6 +356,59 @@ bool File_Save(const char *pszFileName, const Uint8 *pAddress, size_t Size, bool
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Save file to disk, return FALSE if errors
+ */
+bool File_Save(const char *pszFileName, const Uint8 *pAddress, size_t Size, bool bQueryOverwrite)
+{
+	/* Check if need to ask user if to overwrite */
+	if (bQueryOverwrite)
+	{
+		/* If file exists, ask if OK to overwrite */
+		if (!File_QueryOverwrite(pszFileName))
+			return false;
+	}
+
+	return File_WriteData(pszFileName, File_DoesFileExtensionMatch(pszFileName, ".gz"),
+	                      pAddress, Size);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Save file to disk through a temporary file which is renamed over
+ * the original one only once it's completely written, so that a crash
+ * or a full disk doesn't leave a truncated file. Return FALSE if errors
+ * (the original file is then left untouched).
+ */
+bool File_SaveReplace(const char *pszFileName, const Uint8 *pAddress, size_t Size)
+{
+	char *pszTemp;
+	bool bRet;
+
+	pszTemp = malloc(strlen(pszFileName) + 5);
+	if (!pszTemp)
+		return false;
+	sprintf(pszTemp, "%s.tmp", pszFileName);
+
+	bRet = File_WriteData(pszTemp, File_DoesFileExtensionMatch(pszFileName, ".gz"),
+	                      pAddress, Size);
+#ifdef WIN32
+	/* rename() doesn't replace existing files on Windows */
+	if (bRet)
+		remove(pszFileName);
+#endif
+	if (bRet && rename(pszTemp, pszFileName) != 0)
+		bRet = false;
+	if (!bRet)
+		remove(pszTemp);
+
+	free(pszTemp);
+	return bRet;
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Return size of file, -1 if error
@@ -0,0 +1,443 @@
+/*
+  Hatari - fileWriter.c
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+
+  Background writer for the WAV, YM and AVI recorders (and for writing
+  back changed floppy images).
+
+  A recorder asks for a buffer with FileWriter_Begin(), copies the data of
+  the current frame into it and hands it over with FileWriter_Commit(),
+  together with the function that converts and writes it to the file. Jobs
+  are written in order by a host thread, so the emulation thread doesn't
+  wait for the disk (or for the frame conversion) anymore.
+
+  Jobs can also be given an encode function (to compress a video frame
+  for example). Encoding doesn't depend on the previous jobs, so a pool of
+  threads encodes the queued jobs in parallel, while they are still written
+  to the file in the order they were committed.
+
+  The queue is bounded : when all the slots are waiting to be written, the
+  emulation thread blocks until the oldest one is done. How often, and how
+  long, this happened is kept with the other statistics shown by the
+  debugger "info writer" command.
+
+  A recorder has to call FileWriter_Flush() before accessing its file
+  directly (to update the headers when recording stops for example).
+  Without threads, jobs are encoded and written as soon as they are
+  committed.
+*/
+const char FileWriter_fileid[] = "Hatari fileWriter.c : " __DATE__ " " __TIME__;
+
+#include <inttypes.h>
+#include <SDL.h>
+
+#include "main.h"
+#include "log.h"
+#include "fileWriter.h"
+
+#if HAVE_PTHREAD_H
+#define FILEWRITER_THREAD 1
+#include <pthread.h>
+#endif
+
+
+#define FILEWRITER_SLOTS	16			/* jobs queued at most */
+
+typedef enum {
+	JOB_QUEUED,					/* waiting to be encoded */
+	JOB_ENCODING,
+	JOB_ENCODED,					/* waiting to be written */
+	JOB_FAILED					/* encoding failed, skip it */
+} job_state_t;
+
+typedef struct {
+	Uint8		*pBuffer;			/* kept between jobs */
+	int		nAlloc;
+	int		nSize;
+	FILEWRITER_BUFFER Out;				/* encoded data, kept too */
+	FILEWRITER_ENCODE pEncode;			/* NULL to write pBuffer as is */
+	FILEWRITER_FUNC	pFunc;
+	void		*pParam;
+	job_state_t	State;				/* protected by lock */
+} FILEWRITER_JOB;
+
+static FILEWRITER_JOB	Jobs[FILEWRITER_SLOTS];
+static int		nJobRead;			/* next job to write (protected by lock) */
+static int		nJobWrite;			/* next job to fill (emulation) */
+static int		nJobsPending;			/* protected by lock */
+static bool		bJobFailed;			/* protected by lock */
+
+static struct {
+	Uint32		nJobs;
+	Uint64		nBytes;
+	int		nMaxPending;
+	Uint32		nStalls;			/* times the queue was full */
+	Uint32		nStallTicks;			/* ms spent waiting for it */
+} WriterStats;
+
+static int		nWriterThreads = 1;
+
+#if FILEWRITER_THREAD
+static pthread_t	writer_threads[FILEWRITER_MAX_THREADS];
+static pthread_mutex_t	writer_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t	writer_cond = PTHREAD_COND_INITIALIZER;
+static int		nWriterActive;			/* running threads */
+static bool		bWriterFailedToStart;
+static bool		bWriterQuit;			/* protected by lock */
+static bool		bWriterBusy;			/* a thread writes the oldest job (protected by lock) */
+#endif
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Encode job, return false on error.
+ */
+static bool FileWriter_Encode(FILEWRITER_JOB *pJob)
+{
+	pJob->Out.nSize = 0;
+	return pJob->pEncode(pJob->pBuffer, pJob->nSize, &pJob->Out, pJob->pParam);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Write job (or its encoded data) to its file, return false on error.
+ */
+static bool FileWriter_Write(FILEWRITER_JOB *pJob)
+{
+	if (pJob->pEncode)
+		return pJob->pFunc(pJob->Out.pBuffer, pJob->Out.nSize, pJob->pParam);
+	return pJob->pFunc(pJob->pBuffer, pJob->nSize, pJob->pParam);
+}
+
+
+#if FILEWRITER_THREAD
+/*-----------------------------------------------------------------------*/
+/**
+ * Return the oldest queued job waiting to be encoded, or NULL.
+ * Called with the lock held.
+ */
+static FILEWRITER_JOB *FileWriter_NextToEncode(void)
+{
+	int i;
+
+	for (i = 0; i < nJobsPending; i++)
+	{
+		FILEWRITER_JOB *pJob = &Jobs[(nJobRead + i) % FILEWRITER_SLOTS];
+		if (pJob->State == JOB_QUEUED)
+			return pJob;
+	}
+	return NULL;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Writer pool thread : write the oldest job when it's ready, otherwise
+ * encode the next queued one.
+ */
+static void *FileWriter_ThreadFunc(void *arg)
+{
+	FILEWRITER_JOB *pJob;
+	bool bOk;
+
+	pthread_mutex_lock(&writer_lock);
+	for (;;)
+	{
+		pJob = &Jobs[nJobRead];
+		if (nJobsPending && !bWriterBusy && pJob->State >= JOB_ENCODED)
+		{
+			bWriterBusy = true;
+			pthread_mutex_unlock(&writer_lock);
+
+			bOk = pJob->State == JOB_ENCODED && FileWriter_Write(pJob);
+
+			pthread_mutex_lock(&writer_lock);
+			if (!bOk)
+				bJobFailed = true;
+			nJobRead = (nJobRead + 1) % FILEWRITER_SLOTS;
+			nJobsPending--;
+			bWriterBusy = false;
+			pthread_cond_broadcast(&writer_cond);
+			continue;
+		}
+
+		pJob = FileWriter_NextToEncode();
+		if (pJob)
+		{
+			pJob->State = JOB_ENCODING;
+			pthread_mutex_unlock(&writer_lock);
+
+			bOk = FileWriter_Encode(pJob);
+
+			pthread_mutex_lock(&writer_lock);
+			pJob->State = bOk ? JOB_ENCODED : JOB_FAILED;
+			pthread_cond_broadcast(&writer_cond);
+			continue;
+		}
+
+		if (bWriterQuit && !nJobsPending)
+			break;
+		pthread_cond_wait(&writer_cond, &writer_lock);
+	}
+	pthread_mutex_unlock(&writer_lock);
+	return NULL;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Start the writer threads on first use. Return false if jobs
+ * have to be written synchronously.
+ */
+static bool FileWriter_StartThreads(void)
+{
+	if (nWriterActive)
+		return true;
+	if (bWriterFailedToStart)
+		return false;
+
+	bWriterQuit = false;
+	while (nWriterActive < nWriterThreads)
+	{
+		if (pthread_create(&writer_threads[nWriterActive], NULL, FileWriter_ThreadFunc, NULL) != 0)
+			break;
+		nWriterActive++;
+	}
+	if (!nWriterActive)
+	{
+		Log_Printf(LOG_WARN, "Failed to create file writer thread, recording synchronously.\n");
+		bWriterFailedToStart = true;
+		return false;
+	}
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Stop the writer threads, after the queued jobs are written.
+ */
+static void FileWriter_StopThreads(void)
+{
+	pthread_mutex_lock(&writer_lock);
+	bWriterQuit = true;
+	pthread_cond_broadcast(&writer_cond);
+	pthread_mutex_unlock(&writer_lock);
+	while (nWriterActive)
+		pthread_join(writer_threads[--nWriterActive], NULL);
+}
+#endif
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return a buffer of nSize bytes for the next job, waiting for the
+ * writer if the queue is full. Return NULL if there's not enough memory.
+ */
+Uint8 *FileWriter_Begin(int nSize)
+{
+	FILEWRITER_JOB *pJob;
+	Uint8 *pBuffer;
+
+#if FILEWRITER_THREAD
+	if (FileWriter_StartThreads())
+	{
+		pthread_mutex_lock(&writer_lock);
+		if (nJobsPending == FILEWRITER_SLOTS)
+		{
+			Uint32 nStart = SDL_GetTicks();
+
+			WriterStats.nStalls++;
+			while (nJobsPending == FILEWRITER_SLOTS)
+				pthread_cond_wait(&writer_cond, &writer_lock);
+			WriterStats.nStallTicks += SDL_GetTicks() - nStart;
+		}
+		pthread_mutex_unlock(&writer_lock);
+	}
+#endif
+
+	pJob = &Jobs[nJobWrite];
+	if (nSize > pJob->nAlloc || !pJob->pBuffer)
+	{
+		pBuffer = realloc(pJob->pBuffer, nSize > 0 ? nSize : 1);
+		if (!pBuffer)
+			return NULL;
+		pJob->pBuffer = pBuffer;
+		pJob->nAlloc = nSize > 0 ? nSize : 1;
+	}
+	pJob->nSize = nSize;
+	return pJob->pBuffer;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Queue the buffer returned by FileWriter_Begin(), to be encoded with
+ * pEncode if it's not NULL and written with pFunc. Return false if a
+ * previous job failed since the last flush.
+ */
+bool FileWriter_CommitEncode(FILEWRITER_ENCODE pEncode, FILEWRITER_FUNC pFunc, void *pParam)
+{
+	FILEWRITER_JOB *pJob = &Jobs[nJobWrite];
+	bool bOk;
+
+	pJob->pEncode = pEncode;
+	pJob->pFunc = pFunc;
+	pJob->pParam = pParam;
+	WriterStats.nJobs++;
+	WriterStats.nBytes += pJob->nSize;
+
+#if FILEWRITER_THREAD
+	if (nWriterActive)
+	{
+		pthread_mutex_lock(&writer_lock);
+		pJob->State = pEncode ? JOB_QUEUED : JOB_ENCODED;
+		nJobWrite = (nJobWrite + 1) % FILEWRITER_SLOTS;
+		nJobsPending++;
+		if (nJobsPending > WriterStats.nMaxPending)
+			WriterStats.nMaxPending = nJobsPending;
+		bOk = !bJobFailed;
+		pthread_cond_broadcast(&writer_cond);
+		pthread_mutex_unlock(&writer_lock);
+		return bOk;
+	}
+#endif
+
+	bOk = !pEncode || FileWriter_Encode(pJob);
+	if (!bOk || !FileWriter_Write(pJob))
+		bJobFailed = true;
+	return !bJobFailed;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Queue the buffer returned by FileWriter_Begin() to be written with
+ * pFunc. Return false if a previous job failed since the last flush.
+ */
+bool FileWriter_Commit(FILEWRITER_FUNC pFunc, void *pParam)
+{
+	return FileWriter_CommitEncode(NULL, pFunc, pParam);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Make room for nSize more bytes at the end of an encoded job output
+ * and return where to write them, or NULL if there's not enough memory.
+ * The caller adds them to pOut->nSize once written.
+ */
+Uint8 *FileWriter_Reserve(FILEWRITER_BUFFER *pOut, int nSize)
+{
+	Uint8 *pBuffer;
+	int nAlloc;
+
+	if (pOut->nSize + nSize > pOut->nAlloc)
+	{
+		nAlloc = pOut->nSize + nSize;
+		pBuffer = realloc(pOut->pBuffer, nAlloc);
+		if (!pBuffer)
+			return NULL;
+		pOut->pBuffer = pBuffer;
+		pOut->nAlloc = nAlloc;
+	}
+	return pOut->pBuffer + pOut->nSize;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Wait until all queued jobs are written. Return false if one of them
+ * failed since the last flush.
+ */
+bool FileWriter_Flush(void)
+{
+	bool bOk;
+
+#if FILEWRITER_THREAD
+	pthread_mutex_lock(&writer_lock);
+	while (nJobsPending)
+		pthread_cond_wait(&writer_cond, &writer_lock);
+#endif
+	bOk = !bJobFailed;
+	bJobFailed = false;
+#if FILEWRITER_THREAD
+	pthread_mutex_unlock(&writer_lock);
+#endif
+	return bOk;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Set how many threads encode and write the jobs. Takes effect
+ * on next job, after the queued ones are written.
+ */
+void FileWriter_SetThreads(int nThreads)
+{
+	if (nThreads < 1)
+		nThreads = 1;
+	if (nThreads > FILEWRITER_MAX_THREADS)
+		nThreads = FILEWRITER_MAX_THREADS;
+	if (nThreads == nWriterThreads)
+		return;
+
+#if FILEWRITER_THREAD
+	FileWriter_StopThreads();
+#endif
+	nWriterThreads = nThreads;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Write the remaining jobs, stop the writer threads and free the buffers
+ * (called when Hatari exits).
+ */
+void FileWriter_UnInit(void)
+{
+	int i;
+
+#if FILEWRITER_THREAD
+	FileWriter_StopThreads();
+#endif
+	for (i = 0; i < FILEWRITER_SLOTS; i++)
+	{
+		free(Jobs[i].pBuffer);
+		free(Jobs[i].Out.pBuffer);
+		memset(&Jobs[i], 0, sizeof(Jobs[i]));
+	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Show writer statistics (for the debugger "info" command).
+ */
+void FileWriter_Info(Uint32 dummy)
+{
+	int nPending;
+
+#if FILEWRITER_THREAD
+	pthread_mutex_lock(&writer_lock);
+#endif
+	nPending = nJobsPending;
+#if FILEWRITER_THREAD
+	pthread_mutex_unlock(&writer_lock);
+	if (nWriterActive)
+		fprintf(stderr, "File writer threads: %d running\n", nWriterActive);
+	else
+		fprintf(stderr, "File writer threads: %d, not started\n", nWriterThreads);
+#else
+	fprintf(stderr, "File writer thread: not available, writing synchronously\n");
+#endif
+	fprintf(stderr, "- jobs written   : %u (%"PRIu64" bytes)\n",
+	        WriterStats.nJobs - nPending, WriterStats.nBytes);
+	fprintf(stderr, "- jobs queued    : %d (max %d of %d)\n",
+	        nPending, WriterStats.nMaxPending, FILEWRITER_SLOTS);
+	fprintf(stderr, "- queue full     : %u times, %u ms waited\n",
+	        WriterStats.nStalls, WriterStats.nStallTicks);
+}
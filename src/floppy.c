@@ -44,6 +44,12 @@ const char Floppy_fileid[] = "Hatari floppy.c : " __DATE__ " " __TIME__;
 #include "screen.h"
 #include "video.h"
 #include "fdc.h"
+#include "fileWriter.h"
+
+#if HAVE_PTHREAD_H
+#define FLOPPY_PREFETCH 1
+#include <pthread.h>
+#endif
 
 
 /* Emulation drive details, eg FileName, Inserted, Changed etc... */
@@ -66,8 +72,46 @@ static const char * const pszDiskImageNameExts[] =
 };
 
 
+#if FLOPPY_PREFETCH
+/* Disk image read in the background before it gets inserted */
+static struct {
+	pthread_t thread;
+	bool bRunning;			/* thread has been started, not yet joined */
+	char *pszFileName;
+	struct stat FileStat;		/* to check the file didn't change since */
+	Uint8 *pData;
+	long nSize;
+	STX_MAIN_STRUCT *pStx;		/* STX images only */
+} Prefetch;
+#endif
+
+
+/* Changed images are written back in the background after this many
+ * VBLs (5 seconds), so that a crash doesn't lose everything since the
+ * disk was inserted.
+ */
+#define FLOPPY_WRITEBACK_VBLS	(5*50)
+
+typedef bool (*FLOPPY_WRITE_FUNC)(int Drive, const char *pszFileName, Uint8 *pBuffer, int ImageSize);
+
+/* Image write-back queued to the file writer */
+typedef struct {
+	FLOPPY_WRITE_FUNC pWriteDisk;
+	int Drive;
+	char sFileName[FILENAME_MAX];
+} FLOPPY_WRITEBACK;
+
+#define FLOPPY_WRITEBACK_MAX	8
+/* Images queued since the last flush, only used by the emulation thread */
+static char *WriteBackNames[FLOPPY_WRITEBACK_MAX];
+static int nWriteBackNames;
+/* VBL at which the contents of each drive were found changed */
+static int WriteBackVBL[MAX_FLOPPYDRIVES];
+
+
 /* local functions */
 static bool	Floppy_EjectBothDrives(void);
+static void	Floppy_DropPrefetch(void);
 static void	Floppy_DriveTransitionSetState ( int Drive , int State );
 
 
@@ -97,6 +141,255 @@ void Floppy_Init(void)
 void Floppy_UnInit(void)
 {
 	Floppy_EjectBothDrives();
+	Floppy_DropPrefetch();
+	Floppy_WriteBackFlush(NULL);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return the function to write given image file with if that can be
+ * done in the background, i.e. it only needs the image contents.
+ */
+static FLOPPY_WRITE_FUNC Floppy_WriteBackFunc(const char *pszFileName)
+{
+	if (MSA_FileNameIsMSA(pszFileName, true))
+		return MSA_WriteDisk;
+	if (ST_FileNameIsST(pszFileName, true))
+		return ST_WriteDisk;
+	if (DIM_FileNameIsDIM(pszFileName, true))
+		return DIM_WriteDisk;
+	return NULL;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * File writer job: compress and write a floppy image. Errors are only
+ * logged, they shouldn't stop recordings sharing the writer.
+ */
+static bool Floppy_WriteBackJob(Uint8 *pData, int nSize, void *pParam)
+{
+	FLOPPY_WRITEBACK *pWriteBack = pParam;
+
+	if (pWriteBack->pWriteDisk(pWriteBack->Drive, pWriteBack->sFileName, pData, nSize))
+		Log_Printf(LOG_INFO, "Updated the contents of floppy image '%s'.", pWriteBack->sFileName);
+	else
+		Log_Printf(LOG_WARN, "Writing failed, discarded the contents\n of floppy image '%s'.", pWriteBack->sFileName);
+	free(pWriteBack);
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Queue a copy of the image in given drive to be written back to its
+ * file in the background. Return false if it has to be written directly.
+ */
+static bool Floppy_WriteBackQueue(int Drive, FLOPPY_WRITE_FUNC pWriteDisk)
+{
+	FLOPPY_WRITEBACK *pWriteBack;
+	Uint8 *pData;
+	int nSize = EmulationDrives[Drive].nImageBytes;
+
+	if (nWriteBackNames == FLOPPY_WRITEBACK_MAX)
+		Floppy_WriteBackFlush(NULL);
+
+	pWriteBack = malloc(sizeof(*pWriteBack));
+	if (!pWriteBack)
+		return false;
+	pData = FileWriter_Begin(nSize);
+	if (!pData)
+	{
+		free(pWriteBack);
+		return false;
+	}
+	Floppy_LoadImage(Drive, 0, -1);
+	memcpy(pData, EmulationDrives[Drive].pBuffer, nSize);
+	pWriteBack->pWriteDisk = pWriteDisk;
+	pWriteBack->Drive = Drive;
+	strcpy(pWriteBack->sFileName, EmulationDrives[Drive].sFileName);
+
+	WriteBackNames[nWriteBackNames++] = strdup(pWriteBack->sFileName);
+	FileWriter_Commit(Floppy_WriteBackJob, pWriteBack);
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Wait until the queued write-backs of given image file (all of them
+ * if NULL) are done, before it gets read again.
+ */
+void Floppy_WriteBackFlush(const char *pszFileName)
+{
+	int i;
+
+	for (i = 0; i < nWriteBackNames; i++)
+	{
+		if (!pszFileName || strcmp(WriteBackNames[i], pszFileName) == 0)
+			break;
+	}
+	if (i == nWriteBackNames)
+		return;
+
+	/* failures were already reported by the jobs */
+	FileWriter_Flush();
+	for (i = 0; i < nWriteBackNames; i++)
+		free(WriteBackNames[i]);
+	nWriteBackNames = 0;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Called every VBL: write back images whose contents have been changed
+ * for a while, without waiting for them to be ejected.
+ */
+void Floppy_WriteBackCheck(void)
+{
+	int Drive;
+	FLOPPY_WRITE_FUNC pWriteDisk;
+
+	for (Drive = 0; Drive < MAX_FLOPPYDRIVES; Drive++)
+	{
+		if (!EmulationDrives[Drive].bContentsChanged || !EmulationDrives[Drive].bOKToSave)
+		{
+			WriteBackVBL[Drive] = 0;
+			continue;
+		}
+		if (!WriteBackVBL[Drive])
+		{
+			WriteBackVBL[Drive] = nVBLs;
+			continue;
+		}
+		if (nVBLs - WriteBackVBL[Drive] < FLOPPY_WRITEBACK_VBLS)
+			continue;
+
+		WriteBackVBL[Drive] = 0;
+		pWriteDisk = Floppy_WriteBackFunc(EmulationDrives[Drive].sFileName);
+		if (pWriteDisk && Floppy_WriteBackQueue(Drive, pWriteDisk))
+			EmulationDrives[Drive].bContentsChanged = false;
+	}
+}
+
+
+#if FLOPPY_PREFETCH
+/*-----------------------------------------------------------------------*/
+/**
+ * Prefetch thread: read the whole image file and for STX images also
+ * parse it, the emulation thread doesn't touch Prefetch until joined.
+ */
+static void *Floppy_PrefetchThread(void *arg)
+{
+	Prefetch.pData = HFile_Read(Prefetch.pszFileName, &Prefetch.nSize, NULL);
+	if (Prefetch.pData && STX_FileNameIsSTX(Prefetch.pszFileName, true))
+		Prefetch.pStx = STX_BuildStruct(Prefetch.pData, 0);
+	return NULL;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Wait for the prefetch thread to finish
+ */
+static void Floppy_JoinPrefetch(void)
+{
+	if (Prefetch.bRunning)
+	{
+		pthread_join(Prefetch.thread, NULL);
+		Prefetch.bRunning = false;
+	}
+}
+#endif
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Forget the prefetched image, if any
+ */
+static void Floppy_DropPrefetch(void)
+{
+#if FLOPPY_PREFETCH
+	Floppy_JoinPrefetch();
+	if (Prefetch.pStx)
+	{
+		/* the STX code owns the parsed structure once handed over */
+		STX_SetPrefetched(Prefetch.pData, Prefetch.pStx);
+		STX_SetPrefetched(NULL, NULL);
+	}
+	free(Prefetch.pData);
+	free(Prefetch.pszFileName);
+	Prefetch.pszFileName = NULL;
+	Prefetch.pData = NULL;
+	Prefetch.pStx = NULL;
+#endif
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Start reading given disk image file in the background, so that
+ * inserting it later on (e.g. next disk of a playlist) doesn't stall
+ * the emulation with file I/O and image parsing. Unused earlier
+ * prefetched image is dropped. Does nothing without thread support.
+ */
+void Floppy_Prefetch(const char *pszFileName)
+{
+#if FLOPPY_PREFETCH
+	char *filename;
+
+	if (Prefetch.pszFileName && strcmp(Prefetch.pszFileName, pszFileName) == 0)
+		return;
+	Floppy_DropPrefetch();
+
+	if (!File_Exists(pszFileName))
+		filename = File_FindPossibleExtFileName(pszFileName, pszDiskImageNameExts);
+	else
+		filename = strdup(pszFileName);
+	if (!filename)
+		return;
+	Floppy_WriteBackFlush(filename);
+	/* zipped images are already inflated only as far as they are accessed */
+	if (ZIP_FileNameIsZIP(filename) || stat(filename, &Prefetch.FileStat) != 0)
+	{
+		free(filename);
+		return;
+	}
+
+	Prefetch.pszFileName = filename;
+	if (pthread_create(&Prefetch.thread, NULL, Floppy_PrefetchThread, NULL) == 0)
+		Prefetch.bRunning = true;
+	else
+		Floppy_DropPrefetch();
+#endif
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * If given image file has been prefetched and is unchanged since,
+ * hand its contents to the image loaders.
+ */
+static void Floppy_ClaimPrefetch(const char *pszFileName)
+{
+#if FLOPPY_PREFETCH
+	struct stat FileStat;
+
+	if (!Prefetch.pszFileName || strcmp(Prefetch.pszFileName, pszFileName) != 0)
+		return;
+	Floppy_JoinPrefetch();
+	if (Prefetch.pData && stat(pszFileName, &FileStat) == 0
+	    && FileStat.st_mtime == Prefetch.FileStat.st_mtime
+	    && FileStat.st_size == Prefetch.FileStat.st_size)
+	{
+		HFile_SetPreloaded(pszFileName, Prefetch.pData, Prefetch.nSize);
+		STX_SetPrefetched(Prefetch.pData, Prefetch.pStx);
+		Prefetch.pData = NULL;
+		Prefetch.pStx = NULL;
+	}
+	Floppy_DropPrefetch();
+#endif
 }
 
 
@@ -141,6 +434,8 @@ void Floppy_MemorySnapShot_Capture(bool bSave)
 			if (!EmulationDrives[i].pBuffer)
 				perror("Floppy_MemorySnapShot_Capture");
 		}
+		if (bSave)
+			Floppy_LoadImage(i, 0, -1);
 		if (EmulationDrives[i].pBuffer)
 			MemorySnapShot_Store(EmulationDrives[i].pBuffer, EmulationDrives[i].nImageBytes);
 		MemorySnapShot_Store(EmulationDrives[i].sFileName, sizeof(EmulationDrives[i].sFileName));
@@ -492,11 +787,120 @@ int	Floppy_DriveTransitionUpdateState ( int Drive )
 }
 
 
+static void Floppy_FreeLazyImage(int Drive);
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Let the image in given drive be decoded on demand: nBlocks blocks of
+ * nBlockBytes each are decoded into the drive buffer by pLoadBlock() when
+ * they are accessed for the first time. pFree() releases pData when the
+ * image is completely decoded or ejected. Called by the image loaders
+ * for the pBuffer they return, the first block (with the boot sector)
+ * is decoded right away. Return false (and release pData) on error.
+ */
+bool Floppy_SetLazyImage(int Drive, Uint8 *pBuffer, void *pData, int nBlockBytes, int nBlocks,
+                         bool (*pLoadBlock)(void *pData, Uint8 *pBuffer, int nBlock, Uint8 *pLoaded),
+                         void (*pFree)(void *pData))
+{
+	FLOPPY_LAZY *pLazy;
+
+	assert(!EmulationDrives[Drive].pLazy && nBlockBytes >= NUMBYTESPERSECTOR);
+
+	pLazy = malloc(sizeof(*pLazy));
+	if (pLazy)
+		pLazy->pLoaded = calloc(nBlocks, 1);
+	if (!pLazy || !pLazy->pLoaded)
+	{
+		perror("Floppy_SetLazyImage");
+		free(pLazy);
+		pFree(pData);
+		return false;
+	}
+	pLazy->pData = pData;
+	pLazy->nBlockBytes = nBlockBytes;
+	pLazy->nBlocks = nBlocks;
+	pLazy->nUnloaded = nBlocks;
+	pLazy->pLoadBlock = pLoadBlock;
+	pLazy->pFree = pFree;
+	EmulationDrives[Drive].pLazy = pLazy;
+
+	if (!pLoadBlock(pData, pBuffer, 0, pLazy->pLoaded))
+	{
+		Floppy_FreeLazyImage(Drive);
+		return false;
+	}
+	return true;
+}
+
+/**
+ * Free the on demand decoding state of given drive
+ */
+static void Floppy_FreeLazyImage(int Drive)
+{
+	FLOPPY_LAZY *pLazy = EmulationDrives[Drive].pLazy;
+
+	if (!pLazy)
+		return;
+	pLazy->pFree(pLazy->pData);
+	free(pLazy->pLoaded);
+	free(pLazy);
+	EmulationDrives[Drive].pLazy = NULL;
+}
+
+/**
+ * Make sure that given range of the drive buffer is decoded,
+ * nBytes < 0 stands for the whole image.
+ */
+void Floppy_LoadImage(int Drive, long nOffset, long nBytes)
+{
+	FLOPPY_LAZY *pLazy = EmulationDrives[Drive].pLazy;
+	int nBlock, nLast;
+	bool bDecoded = false;
+
+	if (!pLazy)
+		return;
+
+	if (nBytes < 0)
+	{
+		nOffset = 0;
+		nBytes = (long)pLazy->nBlocks * pLazy->nBlockBytes;
+	}
+	if (nBytes == 0)
+		return;
+	nBlock = nOffset / pLazy->nBlockBytes;
+	nLast = (nOffset + nBytes - 1) / pLazy->nBlockBytes;
+	if (nLast >= pLazy->nBlocks)
+		nLast = pLazy->nBlocks - 1;
+
+	for ( ; nBlock <= nLast; nBlock++)
+	{
+		if (pLazy->pLoaded[nBlock])
+			continue;
+		if (!pLazy->pLoadBlock(pLazy->pData, EmulationDrives[Drive].pBuffer, nBlock, pLazy->pLoaded))
+		{
+			Log_Printf(LOG_WARN, "Failed to decode block %d of floppy image in drive %c:\n",
+			           nBlock, 'A' + Drive);
+			pLazy->pLoaded[nBlock] = 1;
+		}
+		bDecoded = true;
+	}
+	if (!bDecoded)
+		return;
+
+	/* Recount, the loader may have decoded more blocks than asked for */
+	pLazy->nUnloaded = 0;
+	for (nBlock = 0; nBlock < pLazy->nBlocks; nBlock++)
+		pLazy->nUnloaded += !pLazy->pLoaded[nBlock];
+	if (pLazy->nUnloaded == 0)
+		Floppy_FreeLazyImage(Drive);
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Insert previously set disk file image into floppy drive.
- * The WHOLE image is copied into Hatari drive buffers, and
- * uncompressed if necessary.
+ * The WHOLE image is copied into Hatari drive buffers. Compressed
+ * images may get uncompressed only when their tracks are accessed.
  * Return TRUE on success, false otherwise.
  */
 bool Floppy_InsertDiskIntoDrive(int Drive)
@@ -514,12 +918,15 @@ bool Floppy_InsertDiskIntoDrive(int Drive)
 	{
 		return true; /* only do eject */
 	}
+	Floppy_WriteBackFlush(filename);
 	if (!File_Exists(filename))
 	{
 		Log_AlertDlg(LOG_INFO, "Image '%s' not found", filename);
 		return false;
 	}
 
+	Floppy_ClaimPrefetch(filename);
+
 	/* Check disk image type and read the file: */
 	if (MSA_FileNameIsMSA(filename, true))
 		EmulationDrives[Drive].pBuffer = MSA_ReadDisk(Drive, filename, &nImageBytes, &ImageType);
@@ -536,9 +943,15 @@ bool Floppy_InsertDiskIntoDrive(int Drive)
 		const char *zippath = ConfigureParams.DiskImage.szDiskZipPath[Drive];
 		EmulationDrives[Drive].pBuffer = ZIP_ReadDisk(Drive, filename, zippath, &nImageBytes, &ImageType);
 	}
+	/* drop whatever of the prefetched image the loaders didn't take,
+	 * STX_Insert() below claims the prefetched STX structure */
+	HFile_SetPreloaded(NULL, NULL, 0);
+	if (ImageType != FLOPPY_IMAGE_TYPE_STX)
+		STX_SetPrefetched(NULL, NULL);
 
 	if ( (EmulationDrives[Drive].pBuffer == NULL) || ( ImageType == FLOPPY_IMAGE_TYPE_NONE ) )
 	{
+		Floppy_FreeLazyImage(Drive);
 		return false;
 	}
 
@@ -603,8 +1016,9 @@ bool Floppy_EjectDiskFromDrive(int Drive)
 	/* Does our drive have a disk in? */
 	if (EmulationDrives[Drive].bDiskInserted)
 	{
-		bool bSaved = false;
+		bool bSaved = false, bQueued = false;
 		char *psFileName = EmulationDrives[Drive].sFileName;
+		FLOPPY_WRITE_FUNC pWriteDisk;
 
 		/* OK, has contents changed? If so, need to save */
 		if (EmulationDrives[Drive].bContentsChanged)
@@ -612,22 +1026,26 @@ bool Floppy_EjectDiskFromDrive(int Drive)
 			/* Is OK to save image (if boot-sector is bad, don't allow a save) */
 			if (EmulationDrives[Drive].bOKToSave)
 			{
-				/* Save as .MSA, .ST, .DIM, .IPF or .STX image? */
-				if (MSA_FileNameIsMSA(psFileName, true))
-					bSaved = MSA_WriteDisk(Drive, psFileName, EmulationDrives[Drive].pBuffer, EmulationDrives[Drive].nImageBytes);
-				else if (ST_FileNameIsST(psFileName, true))
-					bSaved = ST_WriteDisk(Drive, psFileName, EmulationDrives[Drive].pBuffer, EmulationDrives[Drive].nImageBytes);
-				else if (DIM_FileNameIsDIM(psFileName, true))
-					bSaved = DIM_WriteDisk(Drive, psFileName, EmulationDrives[Drive].pBuffer, EmulationDrives[Drive].nImageBytes);
+				/* Save as .MSA, .ST or .DIM image in the background? */
+				pWriteDisk = Floppy_WriteBackFunc(psFileName);
+				if (pWriteDisk && Floppy_WriteBackQueue(Drive, pWriteDisk))
+					bQueued = true;
+				else if (pWriteDisk)
+				{
+					Floppy_LoadImage(Drive, 0, -1);
+					bSaved = pWriteDisk(Drive, psFileName, EmulationDrives[Drive].pBuffer, EmulationDrives[Drive].nImageBytes);
+				}
+				/* Save as .IPF, .STX or .ZIP image? */
 				else if (IPF_FileNameIsIPF(psFileName, true))
 					bSaved = IPF_WriteDisk(Drive, psFileName, EmulationDrives[Drive].pBuffer, EmulationDrives[Drive].nImageBytes);
 				else if (STX_FileNameIsSTX(psFileName, true))
 					bSaved = STX_WriteDisk(Drive, psFileName, EmulationDrives[Drive].pBuffer, EmulationDrives[Drive].nImageBytes);
 				else if (ZIP_FileNameIsZIP(psFileName))
 					bSaved = ZIP_WriteDisk(Drive, psFileName, EmulationDrives[Drive].pBuffer, EmulationDrives[Drive].nImageBytes);
+				/* (queued write-back logs its result itself) */
 				if (bSaved)
 					Log_Printf(LOG_INFO, "Updated the contents of floppy image '%s'.", psFileName);
-				else
+				else if (!bQueued)
 					Log_Printf(LOG_INFO, "Writing of this format failed or not supported, discarded the contents\n of floppy image '%s'.", psFileName);
 			} else
 				Log_Printf(LOG_INFO, "Writing not possible, discarded the contents of floppy image\n '%s'.", psFileName);
@@ -651,6 +1069,7 @@ bool Floppy_EjectDiskFromDrive(int Drive)
 
 
 	/* Drive is now empty */
+	Floppy_FreeLazyImage(Drive);
 	if (EmulationDrives[Drive].pBuffer != NULL)
 	{
 		free(EmulationDrives[Drive].pBuffer);
@@ -851,6 +1270,7 @@ bool Floppy_ReadSectors(int Drive, Uint8 **pBuffer, Uint16 Sector,
 		Offset += (NUMBYTESPERSECTOR*(Sector-1));     /* And finally to sector */
 
 		/* Return a pointer to the sectors data (usually 512 bytes per sector) */
+		Floppy_LoadImage(Drive, Offset, (long)Count*NUMBYTESPERSECTOR);
 		*pBuffer = pDiskBuffer+Offset;
 
 		return true;
@@ -931,6 +1351,7 @@ bool Floppy_WriteSectors(int Drive, Uint8 *pBuffer, Uint16 Sector,
 		Offset += (NUMBYTESPERSECTOR*(Sector-1));   /* And finally to sector */
 
 		/* Write sectors (usually 512 bytes per sector) */
+		Floppy_LoadImage(Drive, Offset, (long)Count*NUMBYTESPERSECTOR);
 		memcpy(pDiskBuffer+Offset, pBuffer, (int)Count*NUMBYTESPERSECTOR);
 		/* And set 'changed' flag */
 		EmulationDrives[Drive].bContentsChanged = true;
@@ -35,6 +35,11 @@ const char floppy_ipf_fileid[] = "Hatari floppy_ipf.c : " __DATE__ " " __TIME__;
 #endif
 /* Macro to check release and revision */
 #define	CAPS_LIB_REL_REV	( CAPS_LIB_RELEASE * 100 + CAPS_LIB_REVISION )
+
+#if HAVE_PTHREAD_H
+#define IPF_TRACK_PREFETCH 1
+#include <pthread.h>
+#endif
 #endif
 
 
@@ -62,6 +67,53 @@ typedef struct
 static IPF_STRUCT	IPF_State;			/* All variables related to the IPF support */
 
 
+#if IPF_TRACK_PREFETCH
+/*
+ * Tracks are decoded by CAPSLockTrack ahead of the FDC by a background
+ * thread : the neighbour tracks and the other side each time the head
+ * arrives on a new track, and the target of a seek. Each decoded entry is
+ * handed to the FDC only once, as locking a track again also refreshes
+ * its flakey bits. Only IPF images are prefetched, CT RAW / KF stream
+ * images depend on the revolution set when a command starts.
+ * All calls to CAPSLockTrack are done with Lock held, capsimage is not
+ * known to be thread safe.
+ * This is kept out of IPF_State, which is saved as is in memory snapshots.
+ */
+#define	IPF_PREFETCH_TRACKS	6		/* Decoded tracks kept per drive */
+
+enum
+{
+	IPF_TRACK_FREE ,
+	IPF_TRACK_QUEUED ,				/* Waiting for the prefetch thread */
+	IPF_TRACK_DECODED
+};
+
+typedef struct
+{
+	int			State;
+	int			Track;
+	int			Side;
+	Uint32			Stamp;			/* For LRU replacement */
+	struct CapsTrackInfoT1	cti;
+} IPF_TRACK;
+
+static struct
+{
+	pthread_t		Thread;
+	pthread_mutex_t		Lock;
+	pthread_cond_t		Cond;
+	bool			bRunning;
+	bool			bQuit;
+
+	bool			Enabled[ MAX_FLOPPYDRIVES ];	/* Image can be prefetched */
+	int			UsedTrack[ MAX_FLOPPYDRIVES ];	/* Track/side currently read by the FDC */
+	int			UsedSide[ MAX_FLOPPYDRIVES ];
+	Uint32			Stamp;
+	IPF_TRACK		Tracks[ MAX_FLOPPYDRIVES ][ IPF_PREFETCH_TRACKS ];
+} IPF_Prefetch = { .Lock = PTHREAD_MUTEX_INITIALIZER , .Cond = PTHREAD_COND_INITIALIZER };
+#endif
+
+
 #ifdef HAVE_CAPSIMAGE
 static void	IPF_CallBack_Trk ( struct CapsFdc *pc , CapsULong State );
 static void	IPF_CallBack_Irq ( struct CapsFdc *pc , CapsULong State );
@@ -72,6 +124,222 @@ static void	IPF_Drive_Update_Enable_Side ( void );
 
 
 
+#ifdef HAVE_CAPSIMAGE
+/*
+ * Decode a track of the image in a drive, return true if OK
+ */
+static bool	IPF_LockTrack ( struct CapsTrackInfoT1 *pcti , int Drive , int Track , int Side )
+{
+	pcti->type = 1;
+	return CAPSLockTrack ( pcti , IPF_State.CapsImage[ Drive ] , Track , Side ,
+			DI_LOCK_DENALT|DI_LOCK_DENVAR|DI_LOCK_UPDATEFD|DI_LOCK_TYPE ) == imgeOk;
+}
+
+
+#if IPF_TRACK_PREFETCH
+/*
+ * Prefetch thread : decode the queued tracks, most recently queued first
+ */
+static void	*IPF_Prefetch_Thread ( void *arg )
+{
+	IPF_TRACK	*pt;
+	int		Drive , PtDrive = 0;
+	int		i;
+
+	pthread_mutex_lock ( &IPF_Prefetch.Lock );
+	while ( !IPF_Prefetch.bQuit )
+	{
+		pt = NULL;
+		for ( Drive=0 ; Drive < MAX_FLOPPYDRIVES ; Drive++ )
+			for ( i=0 ; i < IPF_PREFETCH_TRACKS ; i++ )
+				if ( IPF_Prefetch.Enabled[ Drive ] && IPF_Prefetch.Tracks[ Drive ][ i ].State == IPF_TRACK_QUEUED
+				  && ( pt == NULL || IPF_Prefetch.Tracks[ Drive ][ i ].Stamp > pt->Stamp ) )
+				{
+					pt = &IPF_Prefetch.Tracks[ Drive ][ i ];
+					PtDrive = Drive;
+				}
+
+		if ( pt == NULL )
+		{
+			pthread_cond_wait ( &IPF_Prefetch.Cond , &IPF_Prefetch.Lock );
+			continue;
+		}
+
+		if ( IPF_LockTrack ( &pt->cti , PtDrive , pt->Track , pt->Side ) )
+			pt->State = IPF_TRACK_DECODED;
+		else
+			pt->State = IPF_TRACK_FREE;
+	}
+	pthread_mutex_unlock ( &IPF_Prefetch.Lock );
+
+	return NULL;
+}
+
+
+/*
+ * Queue a track to be decoded, unless it's already queued/decoded.
+ * The least recently queued entry is replaced when all are used.
+ * Must be called with IPF_Prefetch.Lock held.
+ */
+static void	IPF_Prefetch_Queue ( int Drive , int Track , int Side )
+{
+	IPF_TRACK	*pt , *victim = NULL;
+	int		i;
+
+	if ( !IPF_Prefetch.Enabled[ Drive ] || ( Track < 0 ) || ( Track > (int)IPF_State.Drive[ Drive ].maxtrack )
+	  || ( Side && !IPF_State.DoubleSided[ Drive ] ) )
+		return;
+
+	/* Never lock again the track being read, this would change its flakey bits */
+	if ( ( Track == IPF_Prefetch.UsedTrack[ Drive ] ) && ( Side == IPF_Prefetch.UsedSide[ Drive ] ) )
+		return;
+
+	for ( i=0 ; i < IPF_PREFETCH_TRACKS ; i++ )
+	{
+		pt = &IPF_Prefetch.Tracks[ Drive ][ i ];
+		if ( ( pt->State != IPF_TRACK_FREE ) && ( pt->Track == Track ) && ( pt->Side == Side ) )
+		{
+			pt->Stamp = ++IPF_Prefetch.Stamp;
+			return;
+		}
+		if ( ( victim == NULL ) || ( pt->State == IPF_TRACK_FREE )
+		  || ( ( victim->State != IPF_TRACK_FREE ) && ( pt->Stamp < victim->Stamp ) ) )
+			victim = pt;
+	}
+
+	/* A replaced decoded track stays locked in capsimage until the image is ejected, as all other tracks */
+	victim->State = IPF_TRACK_QUEUED;
+	victim->Track = Track;
+	victim->Side = Side;
+	victim->Stamp = ++IPF_Prefetch.Stamp;
+}
+#endif
+
+
+/*
+ * Start the prefetch thread
+ */
+static void	IPF_Prefetch_Init ( void )
+{
+#if IPF_TRACK_PREFETCH
+	IPF_Prefetch.bQuit = false;
+	if ( pthread_create ( &IPF_Prefetch.Thread , NULL , IPF_Prefetch_Thread , NULL ) == 0 )
+		IPF_Prefetch.bRunning = true;
+	else
+		fprintf ( stderr , "IPF : could not start the track prefetch thread\n" );
+#endif
+}
+
+
+/*
+ * Stop the prefetch thread
+ */
+static void	IPF_Prefetch_Exit ( void )
+{
+#if IPF_TRACK_PREFETCH
+	if ( !IPF_Prefetch.bRunning )
+		return;
+
+	pthread_mutex_lock ( &IPF_Prefetch.Lock );
+	IPF_Prefetch.bQuit = true;
+	pthread_cond_signal ( &IPF_Prefetch.Cond );
+	pthread_mutex_unlock ( &IPF_Prefetch.Lock );
+
+	pthread_join ( IPF_Prefetch.Thread , NULL );
+	IPF_Prefetch.bRunning = false;
+#endif
+}
+
+
+/*
+ * Forget all prefetched tracks of a drive and enable/disable prefetching
+ * for it. This must be done before its image is changed or removed.
+ */
+static void	IPF_Prefetch_Reset ( int Drive , bool bEnable )
+{
+#if IPF_TRACK_PREFETCH
+	pthread_mutex_lock ( &IPF_Prefetch.Lock );
+	memset ( IPF_Prefetch.Tracks[ Drive ] , 0 , sizeof ( IPF_Prefetch.Tracks[ Drive ] ) );
+	IPF_Prefetch.UsedTrack[ Drive ] = -1;
+	IPF_Prefetch.UsedSide[ Drive ] = -1;
+	IPF_Prefetch.Enabled[ Drive ] = bEnable && IPF_Prefetch.bRunning;
+	pthread_mutex_unlock ( &IPF_Prefetch.Lock );
+#endif
+}
+
+
+/*
+ * Prefetch a track the head is going to (seek command, drive/side selection)
+ */
+static void	IPF_Prefetch_Request ( int Drive , int Track , int Side )
+{
+#if IPF_TRACK_PREFETCH
+	if ( Drive < 0 )
+		return;
+
+	pthread_mutex_lock ( &IPF_Prefetch.Lock );
+	IPF_Prefetch_Queue ( Drive , Track , Side );
+	pthread_cond_signal ( &IPF_Prefetch.Cond );
+	pthread_mutex_unlock ( &IPF_Prefetch.Lock );
+#endif
+}
+
+
+/*
+ * Get the decoded data of the track the FDC moved to, from the prefetched
+ * tracks if possible, else decode it now. Then prefetch the tracks around it.
+ * Return true if OK.
+ */
+static bool	IPF_Prefetch_GetTrack ( struct CapsTrackInfoT1 *pcti , int Drive , int Track , int Side )
+{
+#if IPF_TRACK_PREFETCH
+	IPF_TRACK	*pt;
+	bool		Found = false;
+	bool		Ok;
+	int		i;
+
+	pthread_mutex_lock ( &IPF_Prefetch.Lock );
+
+	for ( i=0 ; i < IPF_PREFETCH_TRACKS ; i++ )
+	{
+		pt = &IPF_Prefetch.Tracks[ Drive ][ i ];
+		if ( ( pt->State == IPF_TRACK_FREE ) || ( pt->Track != Track ) || ( pt->Side != Side ) )
+			continue;
+		if ( pt->State == IPF_TRACK_DECODED )
+		{
+			*pcti = pt->cti;
+			Found = true;
+		}
+		pt->State = IPF_TRACK_FREE;		/* Each decoded track is used only once */
+	}
+
+	LOG_TRACE(TRACE_FDC, "fdc ipf track drive=%d track=%d side=%d %s\n" , Drive , Track , Side , Found ? "prefetched" : "not prefetched" );
+
+	Ok = Found || IPF_LockTrack ( pcti , Drive , Track , Side );
+	if ( Ok )
+	{
+		IPF_Prefetch.UsedTrack[ Drive ] = Track;
+		IPF_Prefetch.UsedSide[ Drive ] = Side;
+
+		/* Queued last will be decoded first */
+		IPF_Prefetch_Queue ( Drive , Track - 1 , Side );
+		IPF_Prefetch_Queue ( Drive , Track , 1 - Side );
+		IPF_Prefetch_Queue ( Drive , Track + 1 , Side );
+		pthread_cond_signal ( &IPF_Prefetch.Cond );
+	}
+
+	pthread_mutex_unlock ( &IPF_Prefetch.Lock );
+	return Ok;
+
+#else
+	return IPF_LockTrack ( pcti , Drive , Track , Side );
+#endif
+}
+#endif
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Save/Restore snapshot of local variables('MemorySnapShot_Store' handles type)
@@ -116,6 +384,11 @@ fprintf ( stderr , "ipf load %d\n" , StructSize );
 
 		if ( StructSize > 0 )
 		{
+#ifdef HAVE_CAPSIMAGE
+			/* Images are inserted again below */
+			for ( Drive=0 ; Drive < MAX_FLOPPYDRIVES ; Drive++ )
+				IPF_Prefetch_Reset ( Drive , false );
+#endif
 			MemorySnapShot_Store(&IPF_State, sizeof(IPF_State));
 
 #ifdef HAVE_CAPSIMAGE
@@ -287,6 +560,8 @@ bool	IPF_Init ( void )
 
 	CAPSFdcReset ( &IPF_State.Fdc );
 
+	IPF_Prefetch_Init ();
+
 	return true;
 #endif
 }
@@ -301,6 +576,7 @@ void	IPF_Exit ( void )
 {
 #ifndef HAVE_CAPSIMAGE
 #else
+	IPF_Prefetch_Exit ();
 	CAPSExit();
 #endif
 }
@@ -404,6 +680,12 @@ bool	IPF_Insert ( int Drive , Uint8 *pImageBuffer , long ImageSize )
 	IPF_State.Rev_Track[ Drive ] = -1;						/* Invalidate previous track/side to handle revolution's count */
 	IPF_State.Rev_Side[ Drive ] = -1;
 
+#if CAPS_LIB_REL_REV >= 501
+	IPF_Prefetch_Reset ( Drive , ImageType == citIPF );				/* Raw images depend on the revolution, don't prefetch them */
+#else
+	IPF_Prefetch_Reset ( Drive , true );
+#endif
+
 	return true;
 #endif
 }
@@ -422,6 +704,8 @@ bool	IPF_Eject ( int Drive )
 #else
 	fprintf ( stderr , "IPF : IPF_Eject drive=%d imageid=%d\n" , Drive , IPF_State.CapsImage[ Drive ] );
 
+	IPF_Prefetch_Reset ( Drive , false );						/* Stop decoding tracks of this image */
+
 	CAPSFdcInvalidateTrack ( &IPF_State.Fdc , Drive );				/* Invalidate previous buffered track data for drive, if any */
 
 	if ( CAPSUnlockImage ( IPF_State.CapsImage[ Drive ] ) < 0 )
@@ -464,7 +748,8 @@ void IPF_Reset ( void )
 
 /*
  * Callback function used when track is changed.
- * We need to update the track data by calling CAPSLockTrack
+ * We need to update the track data by calling CAPSLockTrack (usually
+ * already done by the prefetch thread)
  */
 #ifdef HAVE_CAPSIMAGE
 static void	IPF_CallBack_Trk ( struct CapsFdc *pc , CapsULong State )
@@ -473,9 +758,7 @@ static void	IPF_CallBack_Trk ( struct CapsFdc *pc , CapsULong State )
 	struct CapsDrive *pd = pc->drive+Drive;		/* Current drive where the track change occurred */
 	struct CapsTrackInfoT1 cti;
 
-	cti.type=1;
-	if ( CAPSLockTrack ( &cti , IPF_State.CapsImage[ Drive ] , pd->buftrack , pd->bufside ,
-			DI_LOCK_DENALT|DI_LOCK_DENVAR|DI_LOCK_UPDATEFD|DI_LOCK_TYPE ) != imgeOk )
+	if ( !IPF_Prefetch_GetTrack ( &cti , Drive , pd->buftrack , pd->bufside ) )
 		return;
 
 	LOG_TRACE(TRACE_FDC, "fdc ipf callback trk drive=%d buftrack=%d bufside=%d VBL=%d HBL=%d\n" , Drive ,
@@ -641,6 +924,9 @@ void	IPF_SetDriveSide ( Uint8 io_porta_old , Uint8 io_porta_new )
 	}
 
 	IPF_Emulate();					/* Update emulation's state up to this point, then set new drive/side */
+
+	if ( IPF_State.Fdc.drivenew >= 0 )		/* Decode the selected track in advance */
+		IPF_Prefetch_Request ( IPF_State.Fdc.drivenew , IPF_State.Drive[ IPF_State.Fdc.drivenew ].track , Side );
 #endif
 }
 
@@ -685,6 +971,19 @@ void	IPF_FDC_WriteReg ( Uint8 Reg , Uint8 Byte )
 
 	IPF_Emulate();					/* Update emulation's state up to this point */
 
+	/* Decode the target track of restore/seek commands in advance, */
+	/* the tracks next to the current one are already prefetched for step commands */
+	if ( ( Reg == 0 ) && ( IPF_State.Fdc.driveact >= 0 ) )
+	{
+		int	Drive = IPF_State.Fdc.driveact;
+
+		if ( ( Byte & 0xf0 ) == 0x00 )		/* Restore */
+			IPF_Prefetch_Request ( Drive , 0 , IPF_State.Drive[ Drive ].side );
+		else if ( ( Byte & 0xf0 ) == 0x10 )	/* Seek */
+			IPF_Prefetch_Request ( Drive , (int)IPF_State.Drive[ Drive ].track + IPF_State.Fdc.r_data - IPF_State.Fdc.r_track ,
+				IPF_State.Drive[ Drive ].side );
+	}
+
 	CAPSFdcWrite ( &IPF_State.Fdc , Reg , Byte );
 #endif
 }
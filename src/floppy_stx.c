@@ -42,6 +42,9 @@ const char floppy_stx_fileid[] = "Hatari floppy_stx.c : " __DATE__ " " __TIME__;
 #define FDC_DELAY_CYCLE_MFM_BYTE		( 4 * 8 * 8 )	/* 4 us per bit, 8 bits per byte, 8 MHz clock -> 256 cycles */
 
 #define FDC_TRACK_BYTES_STANDARD	6250
+#define FDC_CYCLES_PER_REV		( 8000000 / 5 )	/* 300 RPM, gives 5 RPS and 1600000 cycles per revolution at 8 MHz */
+
+#define	STX_SECTOR_SIZE_MAX		1024
 
 
 #define	WD1772_SAVE_FILE_EXT		".wd1772"
@@ -69,6 +72,9 @@ static STX_STRUCT	STX_State;			/* All variables related to the STX support */
 
 static STX_SAVE_STRUCT	STX_SaveStruct[ MAX_FLOPPYDRIVES ];	/* To save 'write sector' data */
 
+static Uint8		*STX_PrefetchedBuffer;		/* File buffer STX_PrefetchedStruct was built from */
+static STX_MAIN_STRUCT	*STX_PrefetchedStruct;		/* Built in advance, used by the next insert of this buffer */
+
 
 
 /* Default timing table for Macrodos when revision=0 */
@@ -108,6 +114,8 @@ static void	STX_FreeSaveTracksStructAll ( STX_SAVE_TRACK_STRUCT *pSaveTracksStru
 static void	STX_FreeSaveTracksStruct ( STX_SAVE_TRACK_STRUCT *pSaveTracksStruct , int Nb );
 
 static void	STX_BuildSectorsSimple ( STX_TRACK_STRUCT *pStxTrack , Uint8 *p );
+static bool	STX_BuildTimings ( STX_MAIN_STRUCT *pStxMain );
+static void	STX_ComputeByteTimings ( Uint16 *pTimings , Uint8 *pTimingData , Uint32 ReadTime , int Size );
 static Uint16	STX_BuildSectorID_CRC ( STX_SECTOR_STRUCT *pStxSector );
 static STX_TRACK_STRUCT	*STX_FindTrack ( Uint8 Drive , Uint8 Track , Uint8 Side );
 static STX_SECTOR_STRUCT *STX_FindSector ( Uint8 Drive , Uint8 Track , Uint8 Side , Uint8 SectorStruct_Nb );
@@ -830,6 +838,14 @@ static bool	STX_Insert_internal ( int Drive , const char *FilenameSTX , Uint8 *p
 {
 	fprintf ( stderr , "STX : STX_Insert_internal drive=%d file=%s buf=%p size=%ld\n" , Drive , FilenameSTX , pImageBuffer , ImageSize );
 
+	if ( STX_PrefetchedStruct && ( STX_PrefetchedBuffer == pImageBuffer ) )
+	{
+		STX_State.ImageBuffer[ Drive ] = STX_PrefetchedStruct;
+		STX_PrefetchedStruct = NULL;
+		STX_PrefetchedBuffer = NULL;
+		return true;
+	}
+
 	STX_State.ImageBuffer[ Drive ] = STX_BuildStruct ( pImageBuffer , STX_DEBUG_FLAG );
 	if ( STX_State.ImageBuffer[ Drive ] == NULL )
 	{
@@ -841,6 +857,20 @@ static bool	STX_Insert_internal ( int Drive , const char *FilenameSTX , Uint8 *p
 }
 
 
+/*-----------------------------------------------------------------------*/
+/*
+ * Give the structure built in advance by STX_BuildStruct() for the STX file
+ * in pImageBuffer to the next STX_Insert() of this buffer. An unused
+ * previous structure is freed, pStxMain=NULL only does that.
+ */
+void	STX_SetPrefetched ( Uint8 *pImageBuffer , STX_MAIN_STRUCT *pStxMain )
+{
+	STX_FreeStruct ( STX_PrefetchedStruct );
+	STX_PrefetchedStruct = pStxMain;
+	STX_PrefetchedBuffer = pStxMain ? pImageBuffer : NULL;
+}
+
+
 /*-----------------------------------------------------------------------*/
 /*
  * When ejecting a disk, free the ressources associated with an STX image
@@ -924,9 +954,16 @@ static void	STX_FreeStruct ( STX_MAIN_STRUCT *pStxMain )
 	if ( !pStxMain )
 		return;
 
-	for ( Track = 0 ; Track < pStxMain->TracksCount ; Track++ )
+	for ( Track = 0 ; pStxMain->pTracksStruct && Track < pStxMain->TracksCount ; Track++ )
 	{
-		free ( (pStxMain->pTracksStruct[ Track ]).pSectorsStruct );
+		STX_TRACK_STRUCT *pStxTrack = &pStxMain->pTracksStruct[ Track ];
+		int Sector;
+
+		for ( Sector = 0 ; pStxTrack->pSectorsStruct && Sector < pStxTrack->SectorsCount ; Sector++ )
+			free ( pStxTrack->pSectorsStruct[ Sector ].pByteTimings );
+		free ( pStxTrack->pSectorsStruct );
+		free ( pStxTrack->pSectorsOrder );
+		free ( pStxTrack->pTrackImageTimings );
 	}
 
 	free ( pStxMain->pTracksStruct );
@@ -1302,11 +1339,137 @@ next_track:
 		pStxTrack++;
 	}
 
+	if ( !STX_BuildTimings ( pStxMain ) )
+	{
+		STX_FreeStruct ( pStxMain );
+		return NULL;
+	}
 
 	return pStxMain;
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Precompute what the FDC functions need at each index pulse, sector search
+ * or byte transfer, instead of walking the tracks/sectors lists every time :
+ * the track for each TrackNumber, the size of each track, the sectors sorted
+ * by position and the number of FDC cycles to read each byte.
+ * Return false if memory can't be allocated.
+ */
+static bool	STX_BuildTimings ( STX_MAIN_STRUCT *pStxMain )
+{
+	STX_TRACK_STRUCT	*pStxTrack;
+	STX_SECTOR_STRUCT	*pStxSector;
+	int			Track;
+	int			Sector;
+	int			i;
+	Uint16			Nb;
+	Uint32			ReadTime;
+
+	for ( Track = pStxMain->TracksCount - 1 ; Track >= 0 ; Track-- )	/* 1st track block wins if duplicated */
+	{
+		pStxTrack = &(pStxMain->pTracksStruct[ Track ]);
+		pStxMain->pTracksIndex[ pStxTrack->TrackNumber ] = pStxTrack;
+
+		if ( pStxTrack->pTrackImageData )
+			pStxTrack->TrackSize = pStxTrack->TrackImageSize;
+		else if ( ( pStxTrack->Flags & STX_TRACK_FLAG_SECTOR_BLOCK ) == 0 )
+			pStxTrack->TrackSize = pStxTrack->MFMSize / 8;	/* When the track contains only sector data, MFMSize is in bits */
+		else
+			pStxTrack->TrackSize = pStxTrack->MFMSize;
+
+		/* The timing for each byte of a track image is the average timing based on TrackImageSize */
+		if ( pStxTrack->pTrackImageData && pStxTrack->TrackImageSize > 0 )
+		{
+			pStxTrack->pTrackImageTimings = malloc ( pStxTrack->TrackImageSize * sizeof ( Uint16 ) );
+			if ( !pStxTrack->pTrackImageTimings )
+				return false;
+			STX_ComputeByteTimings ( pStxTrack->pTrackImageTimings , NULL , FDC_CYCLES_PER_REV , pStxTrack->TrackImageSize );
+		}
+
+		if ( pStxTrack->SectorsCount == 0 || pStxTrack->pSectorsStruct == NULL )
+			continue;
+
+		/* Sort the sectors by BitPosition (insertion sort, keeps the order of equal positions) */
+		pStxTrack->pSectorsOrder = malloc ( pStxTrack->SectorsCount * sizeof ( Uint16 ) );
+		if ( !pStxTrack->pSectorsOrder )
+			return false;
+		for ( Sector = 0 ; Sector < pStxTrack->SectorsCount ; Sector++ )
+		{
+			Nb = Sector;
+			for ( i = Sector ; i > 0 ; i-- )
+			{
+				if ( pStxTrack->pSectorsStruct[ pStxTrack->pSectorsOrder[ i-1 ] ].BitPosition
+				  <= pStxTrack->pSectorsStruct[ Nb ].BitPosition )
+					break;
+				pStxTrack->pSectorsOrder[ i ] = pStxTrack->pSectorsOrder[ i-1 ];
+			}
+			pStxTrack->pSectorsOrder[ i ] = Nb;
+		}
+
+		for ( Sector = 0 ; Sector < pStxTrack->SectorsCount ; Sector++ )
+		{
+			pStxSector = &(pStxTrack->pSectorsStruct[ Sector ]);
+			if ( ( pStxSector->FDC_Status & STX_SECTOR_FLAG_RNF ) || ( pStxSector->SectorSize == 0 ) )
+				continue;
+
+			ReadTime = pStxSector->ReadTime;
+			if ( ReadTime == 0 )				/* Sector has a standard delay (32 us per byte) */
+				ReadTime = 32 * pStxSector->SectorSize;	/* Use the real standard value instead of 0 */
+			ReadTime *= 8;					/* Convert delay in us to a number of FDC cycles at 8 MHz */
+
+			pStxSector->pByteTimings = malloc ( pStxSector->SectorSize * sizeof ( Uint16 ) );
+			if ( !pStxSector->pByteTimings )
+				return false;
+			STX_ComputeByteTimings ( pStxSector->pByteTimings , pStxSector->pTimingData , ReadTime , pStxSector->SectorSize );
+		}
+	}
+
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Compute the number of FDC cycles at 8 MHz to read each of the Size bytes
+ * of a sector or track. If pTimingData is not null, it gives the timing for
+ * each block of 16 bytes, else the bytes are evenly spread over ReadTime.
+ * Timings can be a decimal value and are rounded to the best possible integer,
+ * keeping the total exact.
+ */
+static void	STX_ComputeByteTimings ( Uint16 *pTimings , Uint8 *pTimingData , Uint32 ReadTime , int Size )
+{
+	int			i;
+	Uint16			Timing;
+	double			Total_cur;				/* To compute closest integer timings for each byte */
+	double			Total_prev;
+
+	Total_prev = 0;
+	for ( i=0 ; i<Size ; i++ )
+	{
+		if ( pTimingData )					/* Specific timing for each block of 16 bytes */
+		{
+			Timing = ( pTimingData[ ( i>>4 ) * 2 ] << 8 )
+				+ pTimingData[ ( i>>4 ) * 2 + 1 ];	/* Get big endian timing for this block of 16 bytes */
+
+			/* [NP] Formula to convert timing data comes from Pasti.prg 0.4b : */
+			/* 1 unit of timing = 32 FDC cycles at 8 MHz + 28 cycles to complete each block of 16 bytes */
+			Timing = Timing * 32 + 28;
+
+			if ( i % 16 == 0 )	Total_prev = 0;		/* New block of 16 bytes */
+			Total_cur = ( (double)Timing * ( ( i % 16 ) + 1 ) ) / 16;
+		}
+		else							/* Specific timing for the whole sector/track */
+			Total_cur = ( (double)ReadTime * ( i+1 ) ) / Size;
+
+		Timing = rint ( Total_cur - Total_prev );
+		Total_prev += Timing;
+		pTimings[ i ] = Timing;
+	}
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * When a track only consists of the content of each 512 bytes sector and
@@ -1378,16 +1541,10 @@ static Uint16	STX_BuildSectorID_CRC ( STX_SECTOR_STRUCT *pStxSector )
  */
 static STX_TRACK_STRUCT	*STX_FindTrack ( Uint8 Drive , Uint8 Track , Uint8 Side )
 {
-	int	i;
-
-	if ( STX_State.ImageBuffer[ Drive ] == NULL )
+	if ( ( STX_State.ImageBuffer[ Drive ] == NULL ) || ( Side > 1 ) )
 		return NULL;
 
-	for ( i=0 ; i<STX_State.ImageBuffer[ Drive ]->TracksCount ; i++ )
-		if ( STX_State.ImageBuffer[ Drive ]->pTracksStruct[ i ].TrackNumber == ( ( Track & 0x7f ) | ( Side << 7 ) ) )
-			return &(STX_State.ImageBuffer[ Drive ]->pTracksStruct[ i ]);
-
-	return NULL;
+	return STX_State.ImageBuffer[ Drive ]->pTracksIndex[ ( Track & 0x7f ) | ( Side << 7 ) ];
 }
 
 
@@ -1459,13 +1616,8 @@ extern Uint32	FDC_GetCyclesPerRev_FdcCycles_STX ( Uint8 Drive , Uint8 Track , Ui
 	pStxTrack = STX_FindTrack ( Drive , Track , Side );
 	if ( pStxTrack == NULL )
 		TrackSize =  FDC_TRACK_BYTES_STANDARD;			/* Use a standard track length is track is not available */
-
-	else if ( pStxTrack->pTrackImageData )
-		TrackSize = pStxTrack->TrackImageSize;
-	else if ( ( pStxTrack->Flags & STX_TRACK_FLAG_SECTOR_BLOCK ) == 0 )
-		TrackSize = pStxTrack->MFMSize / 8;		/* When the track contains only sector data, MFMSize is in bits */
 	else
-		TrackSize = pStxTrack->MFMSize;
+		TrackSize = pStxTrack->TrackSize;
 
 //fprintf ( stderr , "fdc stx drive=%d track=0x%x side=%d size=%d\n" , Drive , Track, Side , TrackSize );
 	return TrackSize * FDC_DELAY_CYCLE_MFM_BYTE;
@@ -1483,8 +1635,8 @@ extern Uint32	FDC_GetCyclesPerRev_FdcCycles_STX ( Uint8 Drive , Uint8 Track , Ui
  * the next sector's number into NextSector_ID_Field_SR, the next track's number
  * into NextSector_ID_Field_TR, the next sector's lenght into
  * NextSector_ID_Field_LEN and if the CRC is correct or not into NextSector_ID_Field_CRC_OK.
- * This function assumes the sectors of each track are sorted in ascending order
- * using BitPosition.
+ * The sectors are searched in ascending BitPosition order, using the
+ * pSectorsOrder table built by STX_BuildTimings().
  * If there's no available drive/floppy or no ID field in the track, we return -1
  */
 extern int	FDC_NextSectorID_FdcCycles_STX ( Uint8 Drive , Uint8 NumberOfHeads , Uint8 Track , Uint8 Side )
@@ -1492,8 +1644,8 @@ extern int	FDC_NextSectorID_FdcCycles_STX ( Uint8 Drive , Uint8 NumberOfHeads ,
 	STX_TRACK_STRUCT	*pStxTrack;
 	int			CurrentPos_FdcCycles;
 	int			i;
+	int			Low , High;
 	int			Delay_FdcCycles;
-	int			TrackSize;
 
 	CurrentPos_FdcCycles = FDC_IndexPulse_GetCurrentPos_FdcCycles ( NULL );
 	if ( CurrentPos_FdcCycles < 0 )					/* No drive/floppy available at the moment */
@@ -1509,33 +1661,32 @@ extern int	FDC_NextSectorID_FdcCycles_STX ( Uint8 Drive , Uint8 NumberOfHeads ,
 	if ( pStxTrack->SectorsCount == 0 )				/* No sector (track image only, or empty / non formatted track) */
 		return -1;
 
-	/* Compare CurrentPos_FdcCycles with each sector's position in ascending order */
-	for ( i=0 ; i<pStxTrack->SectorsCount ; i++ )
+	/* Binary search of the 1st sector whose position is after CurrentPos_FdcCycles */
+	Low = 0;
+	High = pStxTrack->SectorsCount;
+	while ( Low < High )
 	{
-		if ( CurrentPos_FdcCycles < (int)pStxTrack->pSectorsStruct[ i ].BitPosition*FDC_DELAY_CYCLE_MFM_BIT )	/* 1 bit = 32 cycles at 8 MHz */
-			break;						/* We found the next sector */
+		i = ( Low + High ) / 2;
+		if ( CurrentPos_FdcCycles < (int)pStxTrack->pSectorsStruct[ pStxTrack->pSectorsOrder[ i ] ].BitPosition*FDC_DELAY_CYCLE_MFM_BIT )	/* 1 bit = 32 cycles at 8 MHz */
+			High = i;
+		else
+			Low = i + 1;
 	}
+	i = Low;
 
 	if ( i == pStxTrack->SectorsCount )				/* CurrentPos_FdcCycles is after the last ID Field of this track */
 	{
 		/* Reach end of track (new index pulse), then go to 1st sector from current position */
-		if ( pStxTrack->pTrackImageData )
-			TrackSize = pStxTrack->TrackImageSize;
-		else if ( ( pStxTrack->Flags & STX_TRACK_FLAG_SECTOR_BLOCK ) == 0 )
-			TrackSize = pStxTrack->MFMSize / 8;		/* When the track contains only sector data, MFMSize is in bits */
-		else
-			TrackSize = pStxTrack->MFMSize;
-
-		Delay_FdcCycles = TrackSize * FDC_DELAY_CYCLE_MFM_BYTE - CurrentPos_FdcCycles
-				+ pStxTrack->pSectorsStruct[ 0 ].BitPosition*FDC_DELAY_CYCLE_MFM_BIT;
-		STX_State.NextSectorStruct_Nbr = 0;
-//fprintf ( stderr , "size=%d pos=%d pos0=%d delay=%d\n" , TrackSize, CurrentPos_FdcCycles, pStxTrack->pSectorsStruct[ 0 ].BitPosition , Delay_FdcCycles );
+		STX_State.NextSectorStruct_Nbr = pStxTrack->pSectorsOrder[ 0 ];
+		Delay_FdcCycles = pStxTrack->TrackSize * FDC_DELAY_CYCLE_MFM_BYTE - CurrentPos_FdcCycles
+				+ pStxTrack->pSectorsStruct[ STX_State.NextSectorStruct_Nbr ].BitPosition*FDC_DELAY_CYCLE_MFM_BIT;
+//fprintf ( stderr , "size=%d pos=%d pos0=%d delay=%d\n" , pStxTrack->TrackSize, CurrentPos_FdcCycles, pStxTrack->pSectorsStruct[ STX_State.NextSectorStruct_Nbr ].BitPosition , Delay_FdcCycles );
 	}
 	else								/* There's an ID Field before end of track */
 	{
-		Delay_FdcCycles = (int)pStxTrack->pSectorsStruct[ i ].BitPosition*FDC_DELAY_CYCLE_MFM_BIT - CurrentPos_FdcCycles;
-		STX_State.NextSectorStruct_Nbr = i;
-//fprintf ( stderr , "i=%d pos=%d posi=%d delay=%d\n" , i, CurrentPos_FdcCycles, pStxTrack->pSectorsStruct[ i ].BitPosition*FDC_DELAY_CYCLE_MFM_BIT , Delay_FdcCycles );
+		STX_State.NextSectorStruct_Nbr = pStxTrack->pSectorsOrder[ i ];
+		Delay_FdcCycles = (int)pStxTrack->pSectorsStruct[ STX_State.NextSectorStruct_Nbr ].BitPosition*FDC_DELAY_CYCLE_MFM_BIT - CurrentPos_FdcCycles;
+//fprintf ( stderr , "i=%d pos=%d posi=%d delay=%d\n" , i, CurrentPos_FdcCycles, pStxTrack->pSectorsStruct[ STX_State.NextSectorStruct_Nbr ].BitPosition*FDC_DELAY_CYCLE_MFM_BIT , Delay_FdcCycles );
 	}
 
 	/* Store the value of the track/sector numbers in the next ID field */
@@ -1612,8 +1763,7 @@ extern Uint8	FDC_NextSectorID_CRC_OK_STX ( void )
  * Each byte of the sector is added to the FDC buffer with a default timing
  * (32 microsec) or a variable timing, depending on the sector's flags.
  * Some sectors can also contains "fuzzy" bits.
- * Special care must be taken to compute the timing of each byte, which can
- * be a decimal value and must be rounded to the best possible integer.
+ * The timing of each byte was computed by STX_BuildTimings().
  *
  * If the sector's data were changed by a 'write sector' command, then we assume
  * a sector with no fuzzy byte and standard timings.
@@ -1626,10 +1776,8 @@ extern Uint8	FDC_ReadSector_STX ( Uint8 Drive , Uint8 Track , Uint8 Sector , Uin
 	STX_SECTOR_STRUCT	*pStxSector;
 	int			i;
 	Uint8			Byte;
-	Uint16			Timing;
-	Uint32			Sector_ReadTime;
-	double			Total_cur;				/* To compute closest integer timings for each byte */
-	double			Total_prev;
+	Uint16			*pTimings;
+	Uint16			StdTimings[ STX_SECTOR_SIZE_MAX ];
 	Uint8			*pSector_WriteData;
 
 	pStxSector = STX_FindSector ( Drive , Track , Side , STX_State.NextSectorStruct_Nbr );
@@ -1645,14 +1793,16 @@ extern Uint8	FDC_ReadSector_STX ( Uint8 Drive , Uint8 Track , Uint8 Sector , Uin
 		return STX_SECTOR_FLAG_RNF;				/* RNF in FDC's status register */
 
 	*pSectorSize = pStxSector->SectorSize;
-	Sector_ReadTime = pStxSector->ReadTime;
+	pTimings = pStxSector->pByteTimings;
 
 	/* Check if this sector was changed by a 'write sector' command */
 	/* If so, we use this recent buffer instead of the original STX content */
 	if (STX_SaveStruct[Drive].SaveSectorsCount > 0 && pStxSector->SaveSectorIndex >= 0)
 	{
 		pSector_WriteData = STX_SaveStruct[ Drive ].pSaveSectorsStruct[ pStxSector->SaveSectorIndex ].pData;
-		Sector_ReadTime = 0;					/* Standard timings */
+		/* Standard delay (32 us per byte) */
+		STX_ComputeByteTimings ( StdTimings , NULL , 32 * 8 * pStxSector->SectorSize , pStxSector->SectorSize );
+		pTimings = StdTimings;
 
 		LOG_TRACE(TRACE_FDC, "fdc stx read sector drive=%d track=%d sect=%d side=%d using saved sector=%d\n" ,
 			Drive, Track, Sector, Side , pStxSector->SaveSectorIndex );
@@ -1660,11 +1810,6 @@ extern Uint8	FDC_ReadSector_STX ( Uint8 Drive , Uint8 Track , Uint8 Sector , Uin
 	else
 		pSector_WriteData = NULL;
 
-	if ( Sector_ReadTime == 0 )					/* Sector has a standard delay (32 us per byte) */
-		Sector_ReadTime = 32 * pStxSector->SectorSize;		/* Use the real standard value instead of 0 */
-	Sector_ReadTime *= 8;						/* Convert delay in us to a number of FDC cycles at 8 MHz */
-
-	Total_prev = 0;
 	for ( i=0 ; i<pStxSector->SectorSize ; i++ )
 	{
 		/* Get the value of each byte, with possible fuzzy bits */
@@ -1672,37 +1817,14 @@ extern Uint8	FDC_ReadSector_STX ( Uint8 Drive , Uint8 Track , Uint8 Sector , Uin
 		{
 			Byte = pStxSector->pData[ i ];
 			if ( pStxSector->pFuzzyData )
-				Byte = ( Byte & pStxSector->pFuzzyData[ i ] ) | ( rand() & ~pStxSector->pFuzzyData[ i ] );
+				Byte = ( Byte & pStxSector->pFuzzyData[ i ] ) | ( Hatari_rand() & ~pStxSector->pFuzzyData[ i ] );
 		}
 
 		else							/* Use data from 'write sector' */
 			Byte = pSector_WriteData[ i ];
 
-		/* Compute the timing in FDC cycles to transfer this byte */
-		if ( ( pStxSector->pTimingData )			/* Specific timing for each block of 16 bytes */
-		  && ( pSector_WriteData == NULL ) )
-		{
-			Timing = ( pStxSector->pTimingData[ ( i>>4 ) * 2 ] << 8 )
-				+ pStxSector->pTimingData[ ( i>>4 ) * 2 + 1 ];	/* Get big endian timing for this block of 16 bytes */
-
-			/* [NP] Formula to convert timing data comes from Pasti.prg 0.4b : */
-			/* 1 unit of timing = 32 FDC cycles at 8 MHz + 28 cycles to complete each block of 16 bytes */
-			Timing = Timing * 32 + 28;
-
-			if ( i % 16 == 0 )	Total_prev = 0;		/* New block of 16 bytes */
-			Total_cur = ( (double)Timing * ( ( i % 16 ) + 1 ) ) / 16;
-			Timing = rint ( Total_cur - Total_prev );
-			Total_prev += Timing;
-		}
-		else							/* Specific timing in us for the whole sector */
-		{
-			Total_cur = ( (double)Sector_ReadTime * ( i+1 ) ) / pStxSector->SectorSize;
-			Timing = rint ( Total_cur - Total_prev );
-			Total_prev += Timing;
-		}
-
-		/* Add the Byte to the buffer, Timing should be a number of FDC cycles at 8 MHz */
-		FDC_Buffer_Add_Timing ( Byte , Timing );
+		/* Add the Byte to the buffer, timing is a number of FDC cycles at 8 MHz */
+		FDC_Buffer_Add_Timing ( Byte , pTimings[ i ] );
 	}
 
 	/* Return only bits 3 and 5 of the FDC_Status */
@@ -1883,10 +2005,6 @@ extern Uint8	FDC_ReadTrack_STX ( Uint8 Drive , Uint8 Track , Uint8 Side )
 	STX_TRACK_STRUCT	*pStxTrack;
 	STX_SECTOR_STRUCT	*pStxSector;
 	int			i;
-	Uint16			Timing;
-	Uint32			Track_ReadTime;
-	double			Total_cur;				/* To compute closest integer timings for each byte */
-	double			Total_prev;
 	int			TrackSize;
 	int			Sector;
 	int			SectorSize;
@@ -1905,7 +2023,7 @@ extern Uint8	FDC_ReadTrack_STX ( Uint8 Drive , Uint8 Track , Uint8 Side )
 	{
 		fprintf ( stderr , "fdc stx : track info not found for read track drive=%d track=%d side=%d, returning random bytes\n" , Drive , Track , Side );
  		for ( i=0 ; i<FDC_GetBytesPerTrack ( Drive ) ; i++ )
-			FDC_Buffer_Add ( rand() & 0xff );		/* Fill the track buffer with random bytes */
+			FDC_Buffer_Add ( Hatari_rand() & 0xff );		/* Fill the track buffer with random bytes */
 		return 0;
 	}
 
@@ -1913,16 +2031,9 @@ extern Uint8	FDC_ReadTrack_STX ( Uint8 Drive , Uint8 Track , Uint8 Side )
 	/* The timing for each byte is the average timing based on TrackImageSize */
 	if ( pStxTrack->pTrackImageData )
 	{
-		Track_ReadTime = 8000000 / 5;				/* 300 RPM, gives 5 RPS and 1600000 cycles per revolution at 8 MHz */
-		Total_prev = 0;
+		/* Add each byte to the buffer, timings precomputed by STX_BuildTimings() */
 		for ( i=0 ; i<pStxTrack->TrackImageSize ; i++ )
-		{
-			Total_cur = ( (double)Track_ReadTime * ( i+1 ) ) / pStxTrack->TrackImageSize;
-			Timing = rint ( Total_cur - Total_prev );
-			Total_prev += Timing;
-			/* Add each byte to the buffer, Timing should be a number of FDC cycles at 8 MHz */
-			FDC_Buffer_Add_Timing ( pStxTrack->pTrackImageData[ i ] , Timing );
-		}
+			FDC_Buffer_Add_Timing ( pStxTrack->pTrackImageData[ i ] , pStxTrack->pTrackImageTimings[ i ] );
 	}
 
 	/* If the track block doesn't contain a dump of the track image, we must build a track */
@@ -1943,7 +2054,7 @@ extern Uint8	FDC_ReadTrack_STX ( Uint8 Drive , Uint8 Track , Uint8 Side )
 		{
 			fprintf ( stderr , "fdc stx : no track image and no sector for read track drive=%d track=%d side=%d, building an unformatted track\n" , Drive , Track , Side );
 			for ( i=0 ; i<TrackSize ; i++ )
-				FDC_Buffer_Add ( rand() & 0xff );	/* Fill the track buffer with random bytes */
+				FDC_Buffer_Add ( Hatari_rand() & 0xff );	/* Fill the track buffer with random bytes */
 			return 0;
 		}
 
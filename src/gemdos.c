@@ -50,6 +50,7 @@ const char Gemdos_fileid[] = "Hatari gemdos.c : " __DATE__ " " __TIME__;
 #include "m68000.h"
 #include "memorySnapShot.h"
 #include "printer.h"
+#include "rtc.h"
 #include "rs232.h"
 #include "statusbar.h"
 #include "scandir.h"
@@ -100,6 +101,8 @@ typedef struct {
 #define DTA_MAGIC_NUMBER  0x12983476
 #define MAX_DTAS_FILES    256      /* Must be ^2 */
 #define CALL_PEXEC_ROUTINE 3       /* Call our cartridge pexec routine */
+#define PEXEC_FASTLOAD   0x4846    /* Private Pexec mode of the cartridge routine */
+#define PRG_HEADER_SIZE  0x1c
 
 #define  BASE_FILEHANDLE     64    /* Our emulation handles - MUST not be valid TOS ones, but MUST be <256 */
 #define  MAX_FILE_HANDLES    32    /* We can allow 32 files open at once */
@@ -124,6 +127,9 @@ typedef struct
 	bool bUsed;
 	Uint32 Basepage;
 	FILE *FileHandle;
+	long nFilePos;                      /* current position in the file */
+	long nFileSize;                     /* -1 when it needs to be queried */
+	bool bDirty;                        /* last access was a buffered write */
 	/* TODO: host path might not fit into this */
 	char szActualName[MAX_GEMDOS_PATH];        /* used by F_DATIME (0x57) */
 } FILE_HANDLE;
@@ -133,11 +139,53 @@ typedef struct
 	bool bUsed;
 	int  nentries;                      /* number of entries in fs directory */
 	int  centry;                        /* current entry # */
-	struct dirent **found;              /* legal files */
+	char **found;                       /* legal files, in 'names' */
 	char path[MAX_GEMDOS_PATH];                /* sfirst path */
+	/* buffers kept over Fsfirst() calls, grown when needed */
+	int  foundsize;
+	char *names;
+	size_t namessize;
 } INTERNAL_DTA;
 
+/* Host directory contents, cached for the file name matching and Fsfirst */
+#define DIRCACHE_ENTRIES  16
+typedef struct
+{
+	char path[MAX_GEMDOS_PATH];         /* host directory, empty if unused */
+	time_t mtime;                       /* directory modification time */
+	time_t scantime;                    /* when the directory was read */
+	Uint32 lastuse;
+	int count;
+	char **names;                       /* sorted, precomposed entry names */
+	int *hash;                          /* case-insensitive name hash, index+1 */
+	int hashmask;
+	/* buffers kept over re-reads, grown when needed */
+	int namessize;
+	int hashsize;
+	char *pool;                         /* the name strings */
+	size_t poolsize;
+} DIR_CACHE;
+
+static DIR_CACHE DirCache[DIRCACHE_ENTRIES];
+static Uint32 DirCacheClock;
+
 static FILE_HANDLE  FileHandles[MAX_FILE_HANDLES];
+static bool bFilesDirty;    /* some file has buffered writes */
+
+/* host file buffer size, for read-ahead and write-behind */
+#define FILE_BUFFER_SIZE  (64*1024)
+/* allocated on first use of the handle and kept for its later files */
+static char *FileBuffers[MAX_FILE_HANDLES];
+
+/* host path for the calls which don't keep it */
+static char szHostPath[FILENAME_MAX];
+
+/* Host time spent in the intercepted GEMDOS calls */
+static struct {
+	Uint32 nCalls;
+	Sint64 nTotalTime;          /* in micro seconds */
+	Sint64 nMaxTime;
+} CallStats[0x60];
 static INTERNAL_DTA InternalDTAs[MAX_DTAS_FILES];
 static int DTAIndex;        /* Circular index into above */
 static DTA *pDTA;           /* Our GEMDOS hard drive Disk Transfer Address structure */
@@ -170,8 +218,14 @@ static void GemDOS_DateTime2Tos(time_t t, DATETIME *DateTime, const char *fname)
 {
 	struct tm *x;
 
-	/* localtime takes DST into account */
-	x = localtime(&t);
+	/* host file times would differ between hosts */
+	if (ConfigureParams.System.bDeterministic)
+	{
+		t = RTC_DETERMINISTIC_EPOCH;
+		x = gmtime(&t);
+	}
+	else
+		x = localtime(&t);	/* localtime takes DST into account */
 
 	if (x == NULL)
 	{
@@ -275,12 +329,202 @@ static Uint8 GemDOS_ConvertAttribute(mode_t mode)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Hash a host file name case-insensitively (like strcasecmp() compares)
+ */
+static Uint32 DirCache_HashName(const char *name)
+{
+	Uint32 h = 2166136261u;
+
+	while (*name)
+	{
+		h ^= tolower((unsigned char)*name++);
+		h *= 16777619u;
+	}
+	return h;
+}
+
+/**
+ * Forget all cached directories, called when the emulation itself
+ * modifies them (the modification time check catches the host changes).
+ * The entry buffers are kept for the following reads.
+ */
+static void GemDOS_FlushDirCache(void)
+{
+	int i;
+
+	for (i = 0; i < DIRCACHE_ENTRIES; i++)
+	{
+		DirCache[i].path[0] = '\0';
+		DirCache[i].count = 0;
+	}
+}
+
+/**
+ * Free the directory cache buffers
+ */
+static void GemDOS_FreeDirCache(void)
+{
+	int i;
+
+	for (i = 0; i < DIRCACHE_ENTRIES; i++)
+	{
+		free(DirCache[i].names);
+		free(DirCache[i].hash);
+		free(DirCache[i].pool);
+	}
+	memset(DirCache, 0, sizeof(DirCache));
+}
+
+/**
+ * Make the buffers of given cache entry large enough for 'count' names
+ * taking 'len' bytes and a hash table of 'size' entries.
+ * Return false if that fails.
+ */
+static bool DirCache_Reserve(DIR_CACHE *dc, int count, int size, size_t len)
+{
+	void *p;
+
+	if (count >= dc->namessize)
+	{
+		p = realloc(dc->names, (count + 1) * sizeof(char *));
+		if (!p)
+			return false;
+		dc->names = p;
+		dc->namessize = count + 1;
+	}
+	if (size > dc->hashsize)
+	{
+		p = realloc(dc->hash, size * sizeof(int));
+		if (!p)
+			return false;
+		dc->hash = p;
+		dc->hashsize = size;
+	}
+	if (len > dc->poolsize)
+	{
+		p = realloc(dc->pool, len);
+		if (!p)
+			return false;
+		dc->pool = p;
+		dc->poolsize = len;
+	}
+	return true;
+}
+
+/**
+ * Read the given host directory into the cache entry.
+ * Return false if the directory can not be read.
+ */
+static bool DirCache_Scan(DIR_CACHE *dc, const char *path, time_t mtime)
+{
+	struct dirent **files;
+	int i, count, size;
+	size_t len;
+	char *name;
+	Uint32 h;
+
+	count = scandir(path, &files, 0, alphasort);
+	if (count < 0)
+		return false;
+
+	for (size = 16; size < 2 * count; size *= 2)
+		;
+	for (len = i = 0; i < count; i++)
+	{
+		Str_DecomposedToPrecomposedUtf8(files[i]->d_name, files[i]->d_name);   /* for OSX */
+		len += strlen(files[i]->d_name) + 1;
+	}
+	if (!DirCache_Reserve(dc, count, size, len))
+	{
+		for (i = 0; i < count; i++)
+			free(files[i]);
+		free(files);
+		return false;
+	}
+	strcpy(dc->path, path);
+	memset(dc->hash, 0, size * sizeof(int));
+	dc->hashmask = size - 1;
+	dc->mtime = mtime;
+	dc->scantime = time(NULL);
+
+	name = dc->pool;
+	for (i = 0; i < count; i++)
+	{
+		strcpy(name, files[i]->d_name);
+		dc->names[i] = name;
+		name += strlen(name) + 1;
+		free(files[i]);
+		/* first of equal names comes first in the probe sequence */
+		h = DirCache_HashName(dc->names[i]) & dc->hashmask;
+		while (dc->hash[h])
+			h = (h + 1) & dc->hashmask;
+		dc->hash[h] = i + 1;
+	}
+	free(files);
+	dc->count = count;
+	return true;
+}
+
+/**
+ * Return cached contents of given host directory, (re-)reading it
+ * when it is not cached yet or has been modified since. Entries read
+ * within the same second as their last modification are not trusted,
+ * as the time stamp could not tell about further changes in that second.
+ * Return NULL if the directory can not be read.
+ */
+static DIR_CACHE *GemDOS_GetDirCache(const char *path)
+{
+	char key[MAX_GEMDOS_PATH];
+	struct stat dirstat;
+	DIR_CACHE *dc, *unused;
+	int i, len;
+
+	/* "dir/" and "dir" are the same directory */
+	len = snprintf(key, sizeof(key), "%s", path);
+	if (len >= (int)sizeof(key))
+		return NULL;
+	while (len > 1 && key[len-1] == PATHSEP && key[len-2] != ':')
+		key[--len] = '\0';
+
+	if (stat(key, &dirstat) != 0 || !S_ISDIR(dirstat.st_mode))
+		return NULL;
+
+	unused = &DirCache[0];
+	for (i = 0; i < DIRCACHE_ENTRIES; i++)
+	{
+		dc = &DirCache[i];
+		if (dc->path[0] && strcmp(dc->path, key) == 0)
+		{
+			if (dc->mtime == dirstat.st_mtime && dc->mtime < dc->scantime)
+			{
+				dc->lastuse = ++DirCacheClock;
+				return dc;
+			}
+			unused = dc;
+			break;
+		}
+		if (!dc->path[0] || (unused->path[0] && dc->lastuse < unused->lastuse))
+			unused = dc;
+	}
+
+	dc = unused;
+	dc->path[0] = '\0';
+	dc->count = 0;
+	if (!DirCache_Scan(dc, key, dirstat.st_mtime))
+		return NULL;
+	dc->lastuse = ++DirCacheClock;
+	return dc;
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Populate the DTA buffer with file info.
  * @return   0 if entry is ok, 1 if entry should be skipped, < 0 for errors.
  */
-static int PopulateDTA(char *path, struct dirent *file)
+static int PopulateDTA(char *path, const char *name)
 {
 	/* TODO: host file path can be longer than MAX_GEMDOS_PATH */
 	char tempstr[MAX_GEMDOS_PATH];
@@ -288,7 +532,7 @@ static int PopulateDTA(char *path, struct dirent *file)
 	DATETIME DateTime;
 	int nFileAttr, nAttrMask;
 
-	snprintf(tempstr, sizeof(tempstr), "%s%c%s", path, PATHSEP, file->d_name);
+	snprintf(tempstr, sizeof(tempstr), "%s%c%s", path, PATHSEP, name);
 
 	if (stat(tempstr, &filestat) != 0)
 	{
@@ -308,15 +552,16 @@ static int PopulateDTA(char *path, struct dirent *file)
 	GemDOS_DateTime2Tos(filestat.st_mtime, &DateTime, tempstr);
 
 	/* convert to atari-style uppercase */
-	Str_Filename2TOSname(file->d_name, pDTA->dta_name);
+	Str_Filename2TOSname(name, pDTA->dta_name);
 #if DEBUG_PATTERN_MATCH
 	fprintf(stderr, "GEMDOS: host: %s -> GEMDOS: %s\n",
-		file->d_name, pDTA->dta_name);
+		name, pDTA->dta_name);
 #endif
 	do_put_mem_long(pDTA->dta_size, filestat.st_size);
 	do_put_mem_word(pDTA->dta_time, DateTime.timeword);
 	do_put_mem_word(pDTA->dta_date, DateTime.dateword);
 	pDTA->dta_attrib = nFileAttr;
+	STMemory_MarkDirty((Uint8 *)pDTA - STRam, sizeof(DTA));
 
 	return 0;
 }
@@ -324,22 +569,40 @@ static int PopulateDTA(char *path, struct dirent *file)
 
 /*-----------------------------------------------------------------------*/
 /**
- * Clear a used DTA structure.
+ * Clear a used DTA structure. Its buffers are kept for the next Fsfirst().
  */
 static void ClearInternalDTA(void)
 {
-	int i;
+	InternalDTAs[DTAIndex].nentries = 0;
+	InternalDTAs[DTAIndex].bUsed = false;
+}
+
+/**
+ * Make the buffers of current DTA structure large enough for 'count'
+ * names taking 'len' bytes. Return false if that fails.
+ */
+static bool ReserveInternalDTA(int count, size_t len)
+{
+	INTERNAL_DTA *dta = &InternalDTAs[DTAIndex];
+	void *p;
 
-	/* clear the old DTA structure */
-	if (InternalDTAs[DTAIndex].found != NULL)
+	if (count > dta->foundsize)
 	{
-		for (i=0; i < InternalDTAs[DTAIndex].nentries; i++)
-			free(InternalDTAs[DTAIndex].found[i]);
-		free(InternalDTAs[DTAIndex].found);
-		InternalDTAs[DTAIndex].found = NULL;
+		p = realloc(dta->found, count * sizeof(char *));
+		if (!p)
+			return false;
+		dta->found = p;
+		dta->foundsize = count;
 	}
-	InternalDTAs[DTAIndex].nentries = 0;
-	InternalDTAs[DTAIndex].bUsed = false;
+	if (len > dta->namessize)
+	{
+		p = realloc(dta->names, len);
+		if (!p)
+			return false;
+		dta->names = p;
+		dta->namessize = len;
+	}
+	return true;
 }
 
 
@@ -427,6 +690,17 @@ static const char* fsfirst_dirmask(const char *string)
 		return string;
 }
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Give the host file of given internal file handle the handle's buffer
+ */
+static void GemDOS_SetFileBuffer(int i)
+{
+	if (!FileBuffers[i])
+		FileBuffers[i] = malloc(FILE_BUFFER_SIZE);   /* NULL lets stdio allocate */
+	setvbuf(FileHandles[i].FileHandle, FileBuffers[i], _IOFBF, FILE_BUFFER_SIZE);
+}
+
 /*-----------------------------------------------------------------------*/
 /**
  * Close given internal file handle if it's still in use
@@ -438,9 +712,54 @@ static void GemDOS_CloseFileHandle(int i)
 		fclose(FileHandles[i].FileHandle);
 	FileHandles[i].FileHandle = NULL;
 	FileHandles[i].Basepage = 0;
+	FileHandles[i].bDirty = false;
 	FileHandles[i].bUsed = false;
 }
 
+/**
+ * Flush the buffered writes of all files except given internal handle
+ * (-1 for all) to the host, so that other handles and the host file
+ * system calls see them
+ */
+static void GemDOS_FlushFiles(int except)
+{
+	int i;
+
+	if (!bFilesDirty)
+		return;
+	bFilesDirty = false;
+	for (i = 0; i < ARRAYSIZE(FileHandles); i++)
+	{
+		if (!FileHandles[i].bDirty)
+			continue;
+		if (i == except)
+		{
+			bFilesDirty = true;
+			continue;
+		}
+		fflush(FileHandles[i].FileHandle);
+		FileHandles[i].bDirty = false;
+	}
+}
+
+/**
+ * Return size of the file behind given (validated) internal handle.
+ * The size is queried from the host only when it's not already known.
+ */
+static long GemDOS_GetFileSize(int i)
+{
+	FILE *fp = FileHandles[i].FileHandle;
+
+	if (FileHandles[i].nFileSize < 0)
+	{
+		fseek(fp, 0, SEEK_END);
+		FileHandles[i].nFileSize = ftell(fp);
+		fseek(fp, FileHandles[i].nFilePos, SEEK_SET);
+		FileHandles[i].bDirty = false;
+	}
+	return FileHandles[i].nFileSize;
+}
+
 /**
  * Un-force given file handle
  */
@@ -483,12 +802,17 @@ void GemDOS_Init(void)
 	{
 		GemDOS_UnforceFileHandle(i);
 	}
+	memset(CallStats, 0, sizeof(CallStats));
+	bFilesDirty = false;
 	/* Clear DTAs */
 	for(i = 0; i < ARRAYSIZE(InternalDTAs); i++)
 	{
 		InternalDTAs[i].bUsed = false;
 		InternalDTAs[i].nentries = 0;
 		InternalDTAs[i].found = NULL;
+		InternalDTAs[i].foundsize = 0;
+		InternalDTAs[i].names = NULL;
+		InternalDTAs[i].namessize = 0;
 	}
 	DTAIndex = 0;
 }
@@ -517,6 +841,8 @@ void GemDOS_Reset(void)
 	}
 	DTAIndex = 0;
 
+	GemDOS_FlushDirCache();
+
 	/* Reset */
 	bInitGemDOS = false;
 	CurrentDrive = nBootDrive;
@@ -736,6 +1062,23 @@ void GemDOS_UnInitDrives(void)
 
 	GemDOS_Reset();        /* Close all open files on emulated drive */
 
+	/* Release the buffers kept over the calls */
+	for (i = 0; i < MAX_FILE_HANDLES; i++)
+	{
+		free(FileBuffers[i]);
+		FileBuffers[i] = NULL;
+	}
+	for (i = 0; i < MAX_DTAS_FILES; i++)
+	{
+		free(InternalDTAs[i].found);
+		InternalDTAs[i].found = NULL;
+		InternalDTAs[i].foundsize = 0;
+		free(InternalDTAs[i].names);
+		InternalDTAs[i].names = NULL;
+		InternalDTAs[i].namessize = 0;
+	}
+	GemDOS_FreeDirCache();
+
 	if (GEMDOS_EMU_ON)
 	{
 		for(i = 0; i < MAX_HARDDRIVES; i++)
@@ -986,21 +1329,23 @@ static int GemDOS_FileName2HardDriveID(char *pszFileName)
 /*-----------------------------------------------------------------------*/
 /**
  * Check whether a file in given path matches given case-insensitive pattern.
- * Return first matched name which caller needs to free, or NULL for no match.
+ * Return first matched name, or NULL for no match. The name is in the
+ * directory cache, valid until the next cache lookup.
  */
-static char* match_host_dir_entry(const char *path, const char *name, bool pattern)
+static const char *match_host_dir_entry(const char *path, const char *name, bool pattern)
 {
 #define MAX_UTF8_NAME_LEN (3*(8+1+3)+1) /* UTF-8 can have up to 3 bytes per character */
-	struct dirent *entry;
-	char *match = NULL;
-	DIR *dir;
+	const char *match = NULL;
+	DIR_CACHE *dc;
 	char nameHost[MAX_UTF8_NAME_LEN];
+	int i, idx;
+	Uint32 h;
 
 	Str_AtariToHost(name, nameHost, MAX_UTF8_NAME_LEN, INVALID_CHAR);
 	name = nameHost;
 	
-	dir = opendir(path);
-	if (!dir)
+	dc = GemDOS_GetDirCache(path);
+	if (!dc)
 		return NULL;
 
 #if DEBUG_PATTERN_MATCH
@@ -1008,29 +1353,28 @@ static char* match_host_dir_entry(const char *path, const char *name, bool patte
 #endif
 	if (pattern)
 	{
-		while ((entry = readdir(dir)))
+		for (i = 0; i < dc->count; i++)
 		{
-			Str_DecomposedToPrecomposedUtf8(entry->d_name, entry->d_name);   /* for OSX */
-			if (fsfirst_match(name, entry->d_name))
+			if (dc->names[i] && fsfirst_match(name, dc->names[i]))
 			{
-				match = strdup(entry->d_name);
+				match = dc->names[i];
 				break;
 			}
 		}
 	}
 	else
 	{
-		while ((entry = readdir(dir)))
+		h = DirCache_HashName(name) & dc->hashmask;
+		while ((idx = dc->hash[h]))
 		{
-			Str_DecomposedToPrecomposedUtf8(entry->d_name, entry->d_name);   /* for OSX */
-			if (strcasecmp(name, entry->d_name) == 0)
+			if (strcasecmp(name, dc->names[idx-1]) == 0)
 			{
-				match = strdup(entry->d_name);
+				match = dc->names[idx-1];
 				break;
 			}
+			h = (h + 1) & dc->hashmask;
 		}
 	}
-	closedir(dir);
 #if DEBUG_PATTERN_MATCH
 	fprintf(stderr, "-> '%s'\n", match);
 #endif
@@ -1089,7 +1433,8 @@ static int clip_to_83(char *name)
  */
 static bool add_path_component(char *path, int maxlen, const char *origname, bool is_dir)
 {
-	char *tmp, *match, name[strlen(origname) + 3];
+	char *tmp, name[strlen(origname) + 3];
+	const char *match;
 	int dot, namelen, pathlen;
 	int (*chr_conv)(int);
 	bool modified;
@@ -1111,7 +1456,6 @@ static bool add_path_component(char *path, int maxlen, const char *origname, boo
 	{
 		/* use strncat so that string is always nul terminated */
 		strncat(path+pathlen, match, maxlen-pathlen);
-		free(match);
 		return true;
 	}
 
@@ -1126,7 +1470,6 @@ static bool add_path_component(char *path, int maxlen, const char *origname, boo
 		if (match)
 		{
 			strncat(path+pathlen, match, maxlen-pathlen);
-			free(match);
 			return true;
 		}
 	}
@@ -1184,7 +1527,6 @@ static bool add_path_component(char *path, int maxlen, const char *origname, boo
 		if (match)
 		{
 			strncat(path+pathlen, match, maxlen-pathlen);
-			free(match);
 			return true;
 		}
 	}
@@ -1568,7 +1910,7 @@ static Uint32 errno2gemdos(const int error, const etype_t etype)
  */
 static bool GemDOS_MkDir(Uint32 Params)
 {
-	char *pDirName, *psDirPath;
+	char *pDirName;
 	int Drive;
 
 	/* Find directory to make */
@@ -1593,23 +1935,15 @@ static bool GemDOS_MkDir(Uint32 Params)
 		return true;
 	}
 
-	psDirPath = malloc(FILENAME_MAX);
-	if (!psDirPath)
-	{
-		perror("GemDOS_MkDir");
-		Regs[REG_D0] = GEMDOS_ENSMEM;
-		return true;
-	}
-	
 	/* Copy old directory, as if calls fails keep this one */
-	GemDOS_CreateHardDriveFileName(Drive, pDirName, psDirPath, FILENAME_MAX);
+	GemDOS_CreateHardDriveFileName(Drive, pDirName, szHostPath, sizeof(szHostPath));
 	
 	/* Attempt to make directory */
-	if (mkdir(psDirPath, 0755) == 0)
+	GemDOS_FlushDirCache();
+	if (mkdir(szHostPath, 0755) == 0)
 		Regs[REG_D0] = GEMDOS_EOK;
 	else
 		Regs[REG_D0] = errno2gemdos(errno, ERROR_PATH);
-	free(psDirPath);
 	return true;
 }
 
@@ -1620,7 +1954,7 @@ static bool GemDOS_MkDir(Uint32 Params)
  */
 static bool GemDOS_RmDir(Uint32 Params)
 {
-	char *pDirName, *psDirPath;
+	char *pDirName;
 	int Drive;
 
 	/* Find directory to make */
@@ -1645,23 +1979,15 @@ static bool GemDOS_RmDir(Uint32 Params)
 		return true;
 	}
 
-	psDirPath = malloc(FILENAME_MAX);
-	if (!psDirPath)
-	{
-		perror("GemDOS_RmDir");
-		Regs[REG_D0] = GEMDOS_ENSMEM;
-		return true;
-	}
-
 	/* Copy old directory, as if calls fails keep this one */
-	GemDOS_CreateHardDriveFileName(Drive, pDirName, psDirPath, FILENAME_MAX);
+	GemDOS_CreateHardDriveFileName(Drive, pDirName, szHostPath, sizeof(szHostPath));
 
 	/* Attempt to remove directory */
-	if (rmdir(psDirPath) == 0)
+	GemDOS_FlushDirCache();
+	if (rmdir(szHostPath) == 0)
 		Regs[REG_D0] = GEMDOS_EOK;
 	else
 		Regs[REG_D0] = errno2gemdos(errno, ERROR_PATH);
-	free(psDirPath);
 	return true;
 }
 
@@ -1673,7 +1999,7 @@ static bool GemDOS_RmDir(Uint32 Params)
  */
 static bool GemDOS_ChDir(Uint32 Params)
 {
-	char *pDirName, *psTempDirPath;
+	char *pDirName;
 	struct stat buf;
 	int Drive;
 
@@ -1691,44 +2017,33 @@ static bool GemDOS_ChDir(Uint32 Params)
 		return false;
 	}
 
-	/* Allocate temporary memory for path name: */
-	psTempDirPath = malloc(FILENAME_MAX);
-	if (!psTempDirPath)
-	{
-		perror("GemDOS_ChDir");
-		Regs[REG_D0] = GEMDOS_ENSMEM;
-		return true;
-	}
-
-	GemDOS_CreateHardDriveFileName(Drive, pDirName, psTempDirPath, FILENAME_MAX);
+	GemDOS_CreateHardDriveFileName(Drive, pDirName, szHostPath, sizeof(szHostPath));
 
 	/* Remove trailing slashes (stat on Windows does not like that) */
-	File_CleanFileName(psTempDirPath);
+	File_CleanFileName(szHostPath);
 
-	if (stat(psTempDirPath, &buf))
+	if (stat(szHostPath, &buf))
 	{
 		/* error */
-		free(psTempDirPath);
 		Regs[REG_D0] = GEMDOS_EPTHNF;
 		return true;
 	}
 
-	File_AddSlashToEndFileName(psTempDirPath);
-	File_MakeAbsoluteName(psTempDirPath);
+	File_AddSlashToEndFileName(szHostPath);
+	File_MakeAbsoluteName(szHostPath);
 
 	/* Prevent '..' commands moving BELOW the root HDD folder */
 	/* by double checking if path is valid */
-	if (strncmp(psTempDirPath, emudrives[Drive-2]->hd_emulation_dir,
+	if (strncmp(szHostPath, emudrives[Drive-2]->hd_emulation_dir,
 		    strlen(emudrives[Drive-2]->hd_emulation_dir)) == 0)
 	{
-		strcpy(emudrives[Drive-2]->fs_currpath, psTempDirPath);
+		strcpy(emudrives[Drive-2]->fs_currpath, szHostPath);
 		Regs[REG_D0] = GEMDOS_EOK;
 	}
 	else
 	{
 		Regs[REG_D0] = GEMDOS_EPTHNF;
 	}
-	free(psTempDirPath);
 
 	return true;
 
@@ -1811,10 +2126,16 @@ static bool GemDOS_Create(Uint32 Params)
 	}
 	
 	/* truncate and open for reading & writing */
+	GemDOS_FlushDirCache();
 	FileHandles[Index].FileHandle = fopen(szActualFileName, "wb+");
 
 	if (FileHandles[Index].FileHandle != NULL)
 	{
+		GemDOS_SetFileBuffer(Index);
+		FileHandles[Index].nFilePos = 0;
+		FileHandles[Index].nFileSize = 0;
+		FileHandles[Index].bDirty = false;
+
 		/* FIXME: implement other Mode attributes
 		 * - GEMDOS_FILE_ATTRIB_HIDDEN       (FA_HIDDEN)
 		 * - GEMDOS_FILE_ATTRIB_SYSTEM_FILE  (FA_SYSTEM)
@@ -1958,6 +2279,8 @@ static bool GemDOS_Open(Uint32 Params)
 			RealMode = "read+write";
 		}
 		FileHandles[Index].FileHandle = fopen(szActualFileName, ModeStr);
+		if (FileHandles[Index].FileHandle)
+			GemDOS_SetFileBuffer(Index);
 	}
 
 	if (FileHandles[Index].FileHandle != NULL)
@@ -1970,6 +2293,9 @@ static bool GemDOS_Open(Uint32 Params)
 			 "%s", szActualFileName);
 
 		GemDOS_UpdateCurrentProgram(Index);
+		FileHandles[Index].nFilePos = ftell(FileHandles[Index].FileHandle);
+		FileHandles[Index].nFileSize = -1;
+		FileHandles[Index].bDirty = false;
 
 		/* Return valid ST file handle from our range (BASE_FILEHANDLE upwards) */
 		Regs[REG_D0] = Index+BASE_FILEHANDLE;
@@ -2047,10 +2373,11 @@ static bool GemDOS_Close(Uint32 Params)
 static bool GemDOS_Read(Uint32 Params)
 {
 	char *pBuffer;
-	long CurrentPos, FileSize, nBytesRead, nBytesLeft;
+	long FileSize, nBytesRead, nBytesLeft;
 	Uint32 Addr;
 	Uint32 Size;
 	int Handle;
+	FILE *fp;
 
 	/* Read details from stack */
 	Handle = STMemory_ReadWord(Params);
@@ -2077,13 +2404,13 @@ static bool GemDOS_Read(Uint32 Params)
 		return true;
 	}
 	
-	/* To quick check to see where our file pointer is and how large the file is */
-	CurrentPos = ftell(FileHandles[Handle].FileHandle);
-	fseek(FileHandles[Handle].FileHandle, 0, SEEK_END);
-	FileSize = ftell(FileHandles[Handle].FileHandle);
-	fseek(FileHandles[Handle].FileHandle, CurrentPos, SEEK_SET);
+	/* Another handle could have buffered writes to the same file */
+	GemDOS_FlushFiles(Handle);
+	fp = FileHandles[Handle].FileHandle;
 
-	nBytesLeft = FileSize-CurrentPos;
+	/* Where our file pointer is and how large the file is */
+	FileSize = GemDOS_GetFileSize(Handle);
+	nBytesLeft = FileSize - FileHandles[Handle].nFilePos;
 	
 	/* Check for bad size and End Of File */
 	if (Size <= 0 || nBytesLeft <= 0)
@@ -2104,17 +2431,32 @@ static bool GemDOS_Read(Uint32 Params)
 		Regs[REG_D0] = GEMDOS_ERANGE;
 		return true;
 	}
-	/* And read data in */
-	nBytesRead = fread(pBuffer, 1, Size, FileHandles[Handle].FileHandle);
+	/* Switching from writing to reading needs a file positioning.
+	 * Large reads then go directly to ST RAM, smaller ones are
+	 * served from the stdio read-ahead buffer.
+	 */
+	if (FileHandles[Handle].bDirty)
+	{
+		fseek(fp, FileHandles[Handle].nFilePos, SEEK_SET);
+		FileHandles[Handle].bDirty = false;
+	}
+	nBytesRead = fread(pBuffer, 1, Size, fp);
+	if (nBytesRead > 0)
+		STMemory_MarkDirty(Addr, nBytesRead);
 	
-	if (ferror(FileHandles[Handle].FileHandle))
+	if (ferror(fp))
 	{
 		Log_Printf(LOG_WARN, "GEMDOS failed to read from '%s'\n",
 			   FileHandles[Handle].szActualName );
 		Regs[REG_D0] = errno2gemdos(errno, ERROR_FILE);
+		clearerr(fp);
+		FileHandles[Handle].nFilePos = ftell(fp);
 	} else
+	{
 		/* Return number of bytes read */
+		FileHandles[Handle].nFilePos += nBytesRead;
 		Regs[REG_D0] = nBytesRead;
+	}
 
 	return true;
 }
@@ -2130,7 +2472,7 @@ static bool GemDOS_Write(Uint32 Params)
 	long nBytesWritten;
 	Uint32 Addr;
 	Sint32 Size;
-	int Handle;
+	int Handle, i;
 	FILE *fp;
 
 	/* Read details from stack */
@@ -2166,17 +2508,44 @@ static bool GemDOS_Write(Uint32 Params)
 		return true;
 	}
 
+	GemDOS_FlushFiles(Handle);
 	fp = FileHandles[Handle].FileHandle;
+
+	/* Switching from reading to writing needs a file positioning.
+	 * The data is then written behind, when another GEMDOS call
+	 * needs it on the host or the file is seeked or closed.
+	 */
+	if (!FileHandles[Handle].bDirty)
+		fseek(fp, FileHandles[Handle].nFilePos, SEEK_SET);
 	nBytesWritten = fwrite(pBuffer, 1, Size, fp);
+	FileHandles[Handle].bDirty = true;
+	bFilesDirty = true;
+
+	/* other handles to the same file don't know its size anymore */
+	for (i = 0; i < ARRAYSIZE(FileHandles); i++)
+	{
+		if (i != Handle && FileHandles[i].bUsed &&
+		    strcmp(FileHandles[i].szActualName, FileHandles[Handle].szActualName) == 0)
+			FileHandles[i].nFileSize = -1;
+	}
+
 	if (ferror(fp))
 	{
 		Log_Printf(LOG_WARN, "GEMDOS failed to write to '%s'\n",
 			   FileHandles[Handle].szActualName );
 		Regs[REG_D0] = errno2gemdos(errno, ERROR_FILE);
+		clearerr(fp);
+		fflush(fp);
+		FileHandles[Handle].bDirty = false;
+		FileHandles[Handle].nFilePos = ftell(fp);
+		FileHandles[Handle].nFileSize = -1;
 	}
 	else
 	{
-		fflush(fp);
+		FileHandles[Handle].nFilePos += nBytesWritten;
+		if (FileHandles[Handle].nFileSize >= 0 &&
+		    FileHandles[Handle].nFilePos > FileHandles[Handle].nFileSize)
+			FileHandles[Handle].nFileSize = FileHandles[Handle].nFilePos;
 		Regs[REG_D0] = nBytesWritten;      /* OK */
 	}
 	return true;
@@ -2190,7 +2559,7 @@ static bool GemDOS_Write(Uint32 Params)
  */
 static bool GemDOS_FDelete(Uint32 Params)
 {
-	char *pszFileName, *psActualFileName;
+	char *pszFileName;
 	int Drive;
 
 	/* Find filename */
@@ -2215,24 +2584,16 @@ static bool GemDOS_FDelete(Uint32 Params)
 		return true;
 	}
 
-	psActualFileName = malloc(FILENAME_MAX);
-	if (!psActualFileName)
-	{
-		perror("GemDOS_FDelete");
-		Regs[REG_D0] = GEMDOS_ENSMEM;
-		return true;
-	}
-
 	/* And convert to hard drive filename */
-	GemDOS_CreateHardDriveFileName(Drive, pszFileName, psActualFileName, FILENAME_MAX);
+	GemDOS_CreateHardDriveFileName(Drive, pszFileName, szHostPath, sizeof(szHostPath));
 
 	/* Now delete file?? */
-	if (unlink(psActualFileName) == 0)
+	GemDOS_FlushDirCache();
+	if (unlink(szHostPath) == 0)
 		Regs[REG_D0] = GEMDOS_EOK;          /* OK */
 	else
 		Regs[REG_D0] = errno2gemdos(errno, ERROR_FILE);
 
-	free(psActualFileName);
 	return true;
 }
 
@@ -2267,12 +2628,9 @@ static bool GemDOS_LSeek(Uint32 Params)
 
 	fhndl = FileHandles[Handle].FileHandle;
 
-	/* Save old position in file */
-	nOldPos = ftell(fhndl);
-
-	/* Determine the size of the file */
-	fseek(fhndl, 0L, SEEK_END);
-	nFileSize = ftell(fhndl);
+	/* Old position and size of the file */
+	nOldPos = FileHandles[Handle].nFilePos;
+	nFileSize = GemDOS_GetFileSize(Handle);
 
 	switch (Mode)
 	{
@@ -2280,23 +2638,26 @@ static bool GemDOS_LSeek(Uint32 Params)
 	 case 1: nDestPos = nOldPos + Offset; break;
 	 case 2: nDestPos = nFileSize + Offset; break; /* negative offset */
 	 default:
-		/* Restore old position and return error */
-		fseek(fhndl, nOldPos, SEEK_SET);
 		Regs[REG_D0] = GEMDOS_EINVFN;
 		return true;
 	}
 
 	if (nDestPos < 0 || nDestPos > nFileSize)
 	{
-		/* Restore old position and return error */
-		fseek(fhndl, nOldPos, SEEK_SET);
 		Regs[REG_D0] = GEMDOS_ERANGE;
 		return true;
 	}
 
-	/* Seek to new position and return offset from start of file */
-	fseek(fhndl, nDestPos, SEEK_SET);
-	Regs[REG_D0] = ftell(fhndl);
+	/* Seek to new position (this also writes out buffered data)
+	 * and return offset from start of file
+	 */
+	if (nDestPos != nOldPos || FileHandles[Handle].bDirty)
+	{
+		fseek(fhndl, nDestPos, SEEK_SET);
+		FileHandles[Handle].bDirty = false;
+		FileHandles[Handle].nFilePos = nDestPos;
+	}
+	Regs[REG_D0] = nDestPos;
 
 	return true;
 }
@@ -2514,6 +2875,114 @@ static bool GemDOS_GetDir(Uint32 Params)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Load and relocate a program into the basepage that the cartridge Pexec
+ * routine created for it, the same way as its 68000 load_n_reloc code does
+ * (program file contents are read after the basepage, relocation table
+ * bytes are cleared while it's processed, then the BSS is cleared), but
+ * without running thousands of emulated instructions for it.
+ * Return the basepage, or 0 to let the cartridge code load the program.
+ */
+static Uint32 GemDOS_PexecLoad(char *pszFileName, Uint32 Basepage)
+{
+	char szActualFileName[MAX_GEMDOS_PATH];
+	Uint8 Header[PRG_HEADER_SIZE];
+	Uint32 TextStart, TextLen, DataLen, BssStart, BssLen, SymLen, Reloc, Addr;
+	Uint32 LoadSize, Offset;
+	Uint8 Byte;
+	long FileSize;
+	FILE *fp;
+	int Drive, i;
+
+	Drive = GemDOS_FileName2HardDriveID(pszFileName);
+	if (!ISHARDDRIVE(Drive))
+		return 0;
+	GemDOS_CreateHardDriveFileName(Drive, pszFileName,
+	                               szActualFileName, sizeof(szActualFileName));
+	fp = fopen(szActualFileName, "rb");
+	if (!fp)
+		return 0;
+
+	/* Same checks as the cartridge code, it reports the errors */
+	if (fread(Header, 1, sizeof(Header), fp) != sizeof(Header)
+	    || do_get_mem_word(Header) != 0x601a
+	    || fseek(fp, 0, SEEK_END) != 0 || (FileSize = ftell(fp)) < PRG_HEADER_SIZE)
+		goto fail;
+	TextStart = Basepage + 0x100;
+	TextLen = do_get_mem_long(Header + 2);
+	DataLen = do_get_mem_long(Header + 6);
+	BssLen = do_get_mem_long(Header + 10);
+	SymLen = do_get_mem_long(Header + 14);
+	BssStart = TextStart + TextLen + DataLen;
+	if (BssStart + BssLen > STMemory_ReadLong(Basepage + 4))
+		goto fail;
+
+	/* Whole file after the header is read to the TEXT start */
+	LoadSize = FileSize - PRG_HEADER_SIZE;
+	if (LoadSize < BssStart + BssLen - TextStart)
+		LoadSize = BssStart + BssLen - TextStart;
+	if (LoadSize > 0x1000000 || !STMemory_ValidArea(Basepage, LoadSize + 0x100))
+		goto fail;
+	memcpy((Uint8 *)STRAM_ADDR(TextStart), Header, sizeof(Header));
+	if (fseek(fp, PRG_HEADER_SIZE, SEEK_SET) != 0
+	    || fread((Uint8 *)STRAM_ADDR(TextStart), 1, FileSize - PRG_HEADER_SIZE, fp)
+	       != (size_t)(FileSize - PRG_HEADER_SIZE))
+		goto fail;
+	STMemory_MarkDirty(TextStart, LoadSize);
+
+	/* Relocate, unless the program has the absolute flag set */
+	Reloc = BssStart + SymLen;
+	if (do_get_mem_word(Header + 26) == 0)
+	{
+		if (!STMemory_ValidArea(Reloc, 4))
+			goto fail;
+		Offset = STMemory_ReadLong(Reloc);
+		STMemory_WriteLong(Reloc, 0);
+		Reloc += 4;
+		Addr = TextStart + Offset;
+		while (Offset)
+		{
+			if ((Addr & 1) || !STMemory_ValidArea(Addr, 4))
+				goto fail;
+			STMemory_WriteLong(Addr, STMemory_ReadLong(Addr) + TextStart);
+			do
+			{
+				if (!STMemory_ValidArea(Reloc, 1))
+					goto fail;
+				Byte = STMemory_ReadByte(Reloc);
+				STMemory_WriteByte(Reloc++, 0);
+				Addr += Byte == 1 ? 254 : Byte;
+			} while (Byte == 1);
+			Offset = Byte;
+		}
+	}
+	memset((Uint8 *)STRAM_ADDR(BssStart), 0, BssLen);
+
+	/* Fill the basepage: TEXT, DATA and BSS start and length, DTA */
+	for (i = 0; i < 3; i++)
+	{
+		STMemory_WriteLong(Basepage + 8 + 8 * i,
+		                   i == 0 ? TextStart : i == 1 ? TextStart + TextLen : BssStart);
+		STMemory_WriteLong(Basepage + 12 + 8 * i,
+		                   i == 0 ? TextLen : i == 1 ? DataLen : BssLen);
+	}
+	STMemory_WriteLong(Basepage + 32, Basepage + 0x80);
+
+	/* Fopen isn't called for the program, so update it here */
+	Symbols_ChangeCurrentProgram(fp, szActualFileName);
+	PexecCalled = false;
+	fclose(fp);
+
+	LOG_TRACE(TRACE_OS_GEMDOS, "-> loaded '%s' to basepage 0x%x\n", szActualFileName, Basepage);
+	return Basepage;
+
+fail:
+	fclose(fp);
+	return 0;
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * GEMDOS PExec handler
@@ -2573,6 +3042,15 @@ static int GemDOS_Pexec(Uint32 Params)
 		return false;
 	 case 6:
 		return false;
+	 case PEXEC_FASTLOAD:   /* From the cartridge Pexec routine */
+		Regs[REG_D0] = 0;
+		if (PexecCalled && ConfigureParams.HardDisk.bFastPexec)
+		{
+			pszFileName = (char *)STRAM_ADDR(STMemory_ReadLong(Params+SIZE_WORD));
+			Regs[REG_D0] = GemDOS_PexecLoad(pszFileName,
+			                                STMemory_ReadLong(Params+SIZE_WORD+SIZE_LONG));
+		}
+		return true;
 	}
 
 	/* Default: Still re-direct to TOS */
@@ -2587,7 +3065,7 @@ static int GemDOS_Pexec(Uint32 Params)
  */
 static bool GemDOS_SNext(void)
 {
-	struct dirent **temp;
+	char **temp;
 	Uint32 nDTA;
 	int Index;
 	int ret;
@@ -2659,11 +3137,12 @@ static bool GemDOS_SFirst(Uint32 Params)
 	char szActualFileName[MAX_GEMDOS_PATH];
 	char *pszFileName;
 	const char *dirmask;
-	struct dirent **files;
+	char *name;
+	size_t len;
+	DIR_CACHE *dc;
 	Uint32 nDTA;
 	int Drive;
-	DIR *fsdir;
-	int i,j,count;
+	int i,j;
 
 	/* Find filename to search for */
 	pszFileName = (char *)STRAM_ADDR(STMemory_ReadLong(Params));
@@ -2694,6 +3173,7 @@ static bool GemDOS_SFirst(Uint32 Params)
 		return true;
 	}
 	pDTA = (DTA *)STRAM_ADDR(nDTA);
+	STMemory_MarkDirty(nDTA, sizeof(DTA));
 
 	/* Populate DTA, set index for our use */
 	do_put_mem_word(pDTA->index, DTAIndex);
@@ -2718,54 +3198,54 @@ static bool GemDOS_SFirst(Uint32 Params)
 	 * TODO: host path may not fit into InternalDTA
 	 */
 	fsfirst_dirname(szActualFileName, InternalDTAs[DTAIndex].path);
-	fsdir = opendir(InternalDTAs[DTAIndex].path);
+	dc = GemDOS_GetDirCache(InternalDTAs[DTAIndex].path);
 
-	if (fsdir == NULL)
+	if (dc == NULL)
 	{
 		Regs[REG_D0] = GEMDOS_EPTHNF;        /* Path not found */
 		return true;
 	}
-	/* close directory */
-	closedir(fsdir);
-
-	count = scandir(InternalDTAs[DTAIndex].path, &files, 0, alphasort);
-	/* File (directory actually) not found */
-	if (count < 0)
-	{
-		Regs[REG_D0] = GEMDOS_EFILNF;
-		return true;
-	}
 
 	InternalDTAs[DTAIndex].centry = 0;          /* current entry is 0 */
 	dirmask = fsfirst_dirmask(szActualFileName);/* directory mask part */
-	InternalDTAs[DTAIndex].found = files;       /* get files */
 
-	/* count & copy the entries that match our mask and discard the rest */
+	/* count the entries that match our mask and their name lengths */
 	j = 0;
-	for (i=0; i < count; i++)
+	len = 0;
+	for (i=0; i < dc->count; i++)
 	{
-		Str_DecomposedToPrecomposedUtf8(files[i]->d_name, files[i]->d_name);   /* for OSX */
-		if (fsfirst_match(dirmask, files[i]->d_name))
+		if (fsfirst_match(dirmask, dc->names[i]))
 		{
-			InternalDTAs[DTAIndex].found[j] = files[i];
+			len += strlen(dc->names[i]) + 1;
 			j++;
 		}
-		else
-		{
-			free(files[i]);
-			files[i] = NULL;
-		}
 	}
-	InternalDTAs[DTAIndex].nentries = j; /* set number of legal entries */
 
 	/* No files of that match, return error code */
 	if (j==0)
 	{
-		free(files);
-		InternalDTAs[DTAIndex].found = NULL;
 		Regs[REG_D0] = GEMDOS_EFILNF;        /* File not found */
 		return true;
 	}
+	if (!ReserveInternalDTA(j, len))
+	{
+		Regs[REG_D0] = GEMDOS_ENSMEM;
+		return true;
+	}
+
+	/* copy the entries that match our mask */
+	name = InternalDTAs[DTAIndex].names;
+	j = 0;
+	for (i=0; i < dc->count; i++)
+	{
+		if (fsfirst_match(dirmask, dc->names[i]))
+		{
+			strcpy(name, dc->names[i]);
+			InternalDTAs[DTAIndex].found[j++] = name;
+			name += strlen(name) + 1;
+		}
+	}
+	InternalDTAs[DTAIndex].nentries = j; /* set number of legal entries */
 
 	/* Scan for first file (SNext uses no parameters) */
 	GemDOS_SNext();
@@ -2820,6 +3300,7 @@ static bool GemDOS_Rename(Uint32 Params)
 		              szOldActualFileName, sizeof(szOldActualFileName));
 
 	/* Rename files */
+	GemDOS_FlushDirCache();
 	if (rename(szOldActualFileName,szNewActualFileName) == 0)
 		Regs[REG_D0] = GEMDOS_EOK;
 	else
@@ -3132,7 +3613,7 @@ void GemDOS_Info(Uint32 bShowOpcodes)
 		for (j = 0; j < entries; j++)
 		{
 			fprintf(stderr, "  - %d: %s%s\n",
-				j, InternalDTAs[i].found[j]->d_name,
+				j, InternalDTAs[i].found[j],
 				j == centry ? " *" : "");
 		}
 		fprintf(stderr, "  Fsnext entry = %d.\n", centry);
@@ -3164,6 +3645,20 @@ void GemDOS_Info(Uint32 bShowOpcodes)
 	}
 	if (!used)
 		fputs("- None.\n", stderr);
+
+	fputs("\nHost time spent in emulated GEMDOS calls:\n", stderr);
+	for (used = i = 0; i < ARRAYSIZE(CallStats); i++)
+	{
+		if (!CallStats[i].nCalls)
+			continue;
+		fprintf(stderr, "- 0x%02x %-9s %8u calls, %8.1f us average, %8"PRId64" us max, %6.2f s total\n",
+			i, GemDOS_Opcode2Name(i), CallStats[i].nCalls,
+			(double)CallStats[i].nTotalTime / CallStats[i].nCalls,
+			CallStats[i].nMaxTime, CallStats[i].nTotalTime / 1000000.0);
+		used++;
+	}
+	if (!used)
+		fputs("- None.\n", stderr);
 }
 
 #else /* !ENABLE_TRACING */
@@ -3188,6 +3683,7 @@ void GemDOS_OpCode(void)
 	Uint32 Params;
 	int Finished;
 	Uint16 SR;
+	Sint64 nStartTime;
 
 	SR = M68000_GetSR();
 
@@ -3212,6 +3708,11 @@ void GemDOS_OpCode(void)
 	GemDOSCall = STMemory_ReadWord(Params);
 	Params += SIZE_WORD;
 
+	/* Buffered writes are kept only over file data accesses */
+	if (GemDOSCall != 0x3f && GemDOSCall != 0x40 && GemDOSCall != 0x42)
+		GemDOS_FlushFiles(-1);
+	nStartTime = Time_GetTicks();
+
 	/* Intercept call */
 	switch(GemDOSCall)
 	{
@@ -3367,6 +3868,15 @@ void GemDOS_OpCode(void)
 			  M68000_GetPC());
 	}
 
+	if (Finished && GemDOSCall < ARRAYSIZE(CallStats))
+	{
+		Sint64 nTime = Time_GetTicks() - nStartTime;
+		CallStats[GemDOSCall].nCalls++;
+		CallStats[GemDOSCall].nTotalTime += nTime;
+		if (nTime > CallStats[GemDOSCall].nMaxTime)
+			CallStats[GemDOSCall].nMaxTime = nTime;
+	}
+
 	switch(Finished)
 	{
 	 case true:
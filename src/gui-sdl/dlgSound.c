@@ -128,7 +128,8 @@ void Dialog_SoundDlg(void)
 	sounddlg[DLGSOUND_MODEL].state &= ~SG_SELECTED;
 	sounddlg[DLGSOUND_TABLE].state &= ~SG_SELECTED;
 	sounddlg[DLGSOUND_LINEAR].state &= ~SG_SELECTED;
-	if (ConfigureParams.Sound.YmVolumeMixing == YM_MODEL_MIXING)
+	if (ConfigureParams.Sound.YmVolumeMixing == YM_MODEL_MIXING
+	    || ConfigureParams.Sound.YmVolumeMixing == YM_COMPACT_MIXING)
 		sounddlg[DLGSOUND_MODEL].state |= SG_SELECTED;
 	else
 	if (ConfigureParams.Sound.YmVolumeMixing == YM_TABLE_MIXING)
@@ -192,7 +193,11 @@ void Dialog_SoundDlg(void)
 	}
 
 	if (sounddlg[DLGSOUND_MODEL].state & SG_SELECTED)
-		ConfigureParams.Sound.YmVolumeMixing = YM_MODEL_MIXING;
+	{
+		/* keep the compact version of the model if selected on command line */
+		if (ConfigureParams.Sound.YmVolumeMixing != YM_COMPACT_MIXING)
+			ConfigureParams.Sound.YmVolumeMixing = YM_MODEL_MIXING;
+	}
 	else
 	if (sounddlg[DLGSOUND_TABLE].state & SG_SELECTED)
 		ConfigureParams.Sound.YmVolumeMixing = YM_TABLE_MIXING;
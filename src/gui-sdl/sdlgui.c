@@ -153,6 +153,7 @@ int SDLGui_UnInit(void)
  */
 int SDLGui_SetScreen(SDL_Surface *pScrn)
 {
+	Screen_RenderSync();
 	pSdlGuiScrn = pScrn;
 
 	/* Decide which font to use - small or big one: */
@@ -12,19 +12,69 @@
 #include "config.h"
 #endif
 
-#include <string.h>
-#include <stdio.h>
-#include <stdlib.h>
-#include <SDL.h>
-
+#include "main.h"
 #include "hd6301_cpu.h"
 
 
 /**********************************
  *	Defines
  **********************************/
-#define HD6301_DISASM 		1
-#define HD6301_DISPLAY_REGS	1
+#define HD6301_DISASM 		0
+#define HD6301_DISPLAY_REGS	0
+
+/* Internal registers */
+#define HD6301_REG_P1DDR	0x00
+#define HD6301_REG_P2DDR	0x01
+#define HD6301_REG_P1		0x02
+#define HD6301_REG_P2		0x03
+#define HD6301_REG_P3DDR	0x04
+#define HD6301_REG_P4DDR	0x05
+#define HD6301_REG_P3		0x06
+#define HD6301_REG_P4		0x07
+#define HD6301_REG_TCSR		0x08
+#define HD6301_REG_FRC_H	0x09
+#define HD6301_REG_FRC_L	0x0a
+#define HD6301_REG_OCR_H	0x0b
+#define HD6301_REG_OCR_L	0x0c
+#define HD6301_REG_ICR_H	0x0d
+#define HD6301_REG_ICR_L	0x0e
+#define HD6301_REG_RMCR		0x10
+#define HD6301_REG_TRCSR	0x11
+#define HD6301_REG_RDR		0x12
+#define HD6301_REG_TDR		0x13
+#define HD6301_REG_RAMCR	0x14
+
+/* Timer Control and Status Register bits */
+#define HD6301_TCSR_ETOI	0x04
+#define HD6301_TCSR_EOCI	0x08
+#define HD6301_TCSR_EICI	0x10
+#define HD6301_TCSR_TOF		0x20
+#define HD6301_TCSR_OCF		0x40
+#define HD6301_TCSR_ICF		0x80
+
+/* Transmit/Receive Control and Status Register bits */
+#define HD6301_TRCSR_WU		0x01
+#define HD6301_TRCSR_TE		0x02
+#define HD6301_TRCSR_TIE	0x04
+#define HD6301_TRCSR_RE		0x08
+#define HD6301_TRCSR_RIE	0x10
+#define HD6301_TRCSR_TDRE	0x20
+#define HD6301_TRCSR_ORFE	0x40
+#define HD6301_TRCSR_RDRF	0x80
+
+/* Interrupt vectors */
+#define HD6301_VECTOR_TRAP	0xffee
+#define HD6301_VECTOR_SCI	0xfff0
+#define HD6301_VECTOR_TOF	0xfff2
+#define HD6301_VECTOR_OCF	0xfff4
+#define HD6301_VECTOR_ICF	0xfff6
+#define HD6301_VECTOR_SWI	0xfffa
+#define HD6301_VECTOR_RESET	0xfffe
+
+/* Cpu state for WAI and SLP */
+#define HD6301_RUNNING		0
+#define HD6301_WAI		1
+#define HD6301_SLP		2
 
 /* HD6301 Disasm and debug code */
 #define HD6301_DISASM_UNDEFINED		0
@@ -51,8 +101,8 @@
  *	macros for CCR processing
  *	adapted from mame project
  **********************************/
-#define HD6301_SET_Z8(a)	hd6301_reg_CCR |= (((Uint8)(a) == 0) << 1)
-#define HD6301_SET_Z16(a)	hd6301_reg_CCR |= (((Uint16)(a) == 0) << 1)
+#define HD6301_SET_Z8(a)	hd6301_reg_CCR |= (((Uint8)(a) == 0) << 2)
+#define HD6301_SET_Z16(a)	hd6301_reg_CCR |= (((Uint16)(a) == 0) << 2)
 #define HD6301_SET_N8(a)	hd6301_reg_CCR |= (((a) & 0x80) >> 4)
 #define HD6301_SET_N16(a)	hd6301_reg_CCR |= (((a) & 0x8000) >> 12)
 #define HD6301_SET_C8(a)	hd6301_reg_CCR |= (((a) & 0x100) >> 8)
@@ -76,6 +126,14 @@
 static Uint8 hd6301_read_memory(Uint16 addr);
 static void hd6301_write_memory (Uint16 addr, Uint8 value);
 static Uint16 hd6301_get_memory_ext(void);
+static Uint8 hd6301_read_register(Uint16 addr);
+static void hd6301_write_register(Uint16 addr, Uint8 value);
+static void hd6301_output_port(int port);
+static Uint16 hd6301_pending_interrupt(void);
+static void hd6301_push_registers(Uint16 pc);
+static void hd6301_interrupt(Uint16 vector);
+static int hd6301_timer_next_event(void);
+static void hd6301_timer_update(int cycles);
 
 /* HD6301 opcodes functions */
 static void hd6301_undefined(void);
@@ -595,22 +653,40 @@ static struct hd6301_opcode_t hd6301_opcode_table[256] = {
 
 
 /* Variables */
-static Uint8	hd6301_cycles;
+static int	hd6301_cycles;
 static Uint8	hd6301_cur_inst;
 
-static Sint8	hd6301_reg_A; 
-static Sint8	hd6301_reg_B;
-static Sint16	hd6301_reg_X;
+static Uint8	hd6301_reg_A;
+static Uint8	hd6301_reg_B;
+static Uint16	hd6301_reg_X;
 static Uint16	hd6301_reg_SP;
 static Uint16	hd6301_reg_PC;
 static Uint8	hd6301_reg_CCR;
 
-//Uint8	hd6301_reg_RMCR;
-
 static Uint8	hd6301_intREG[32];
 static Uint8	hd6301_intRAM[128];
 static Uint8	hd6301_intROM[4096];
 
+/* Timer */
+static Uint16	hd6301_frc;
+static Uint16	hd6301_ocr;
+static Uint16	hd6301_icr;
+static Uint8	hd6301_frc_latch;
+static Uint8	hd6301_tcsr_read;
+
+/* SCI */
+static Uint8	hd6301_trcsr_read;
+
+static Uint8	hd6301_wait;		/* HD6301_RUNNING, HD6301_WAI or HD6301_SLP */
+static bool	hd6301_break;		/* Stop hd6301_run() after the current instruction */
+
+static hd6301_read_port_t	hd6301_read_port;
+static hd6301_write_port_t	hd6301_write_port;
+
+/* Registers for port n are at hd6301_port_ddr[n] and hd6301_port_data[n] */
+static const Uint8 hd6301_port_ddr[5] = { 0, HD6301_REG_P1DDR, HD6301_REG_P2DDR, HD6301_REG_P3DDR, HD6301_REG_P4DDR };
+static const Uint8 hd6301_port_data[5] = { 0, HD6301_REG_P1, HD6301_REG_P2, HD6301_REG_P3, HD6301_REG_P4 };
+
 
 /**********************************
  *	Emulator kernel
@@ -618,12 +694,52 @@ static Uint8	hd6301_intROM[4096];
 
 /**
  * Initialise hd6301 cpu
+ * read_port/write_port are called when the cpu reads or writes ports 1 to 4
  */
-void hd6301_init_cpu(void)
+void hd6301_init_cpu(hd6301_read_port_t read_port, hd6301_write_port_t write_port)
 {
+	hd6301_read_port = read_port;
+	hd6301_write_port = write_port;
 	hd6301_reg_CCR = 0xc0;
 }
 
+/**
+ * Load the 4 KB of the internal ROM ($f000-$ffff)
+ */
+void hd6301_load_rom(const Uint8 *rom)
+{
+	memcpy(hd6301_intROM, rom, sizeof(hd6301_intROM));
+}
+
+/**
+ * Reset hd6301 cpu : internal registers get their reset values (RAM is
+ * not cleared) and PC is loaded from the reset vector
+ */
+void hd6301_reset_cpu(void)
+{
+	int port;
+
+	memset(hd6301_intREG, 0, sizeof(hd6301_intREG));
+	hd6301_intREG[HD6301_REG_TRCSR] = HD6301_TRCSR_TDRE;
+	hd6301_intREG[HD6301_REG_RAMCR] = 0x40;
+
+	hd6301_frc = 0;
+	hd6301_ocr = 0xffff;
+	hd6301_icr = 0;
+	hd6301_frc_latch = 0;
+	hd6301_tcsr_read = 0;
+	hd6301_trcsr_read = 0;
+	hd6301_wait = HD6301_RUNNING;
+
+	hd6301_reg_CCR = 0xc0 | (1 << hd6301_REG_CCR_I);
+	hd6301_reg_PC = hd6301_read_memory(HD6301_VECTOR_RESET) << 8;
+	hd6301_reg_PC += hd6301_read_memory(HD6301_VECTOR_RESET+1);
+
+	/* All ports are inputs after reset */
+	for (port = 1; port <= 4; port++)
+		hd6301_write_port(port, 0xff);
+}
+
 /**
  * Execute 1 hd6301 instruction
  */
@@ -635,13 +751,13 @@ void hd6301_execute_one_instruction(void)
 	hd6301_opcode = hd6301_opcode_table[hd6301_cur_inst];
 
 	/* disasm opcode ? */
-#ifdef HD6301_DISASM
+#if HD6301_DISASM
 	hd6301_disasm();
 #endif
 	/* execute opcode  */
 	hd6301_opcode.op_func();
 
-#ifdef HD6301_DISPLAY_REGS
+#if HD6301_DISPLAY_REGS
 	hd6301_display_registers();
 #endif
 
@@ -650,12 +766,350 @@ void hd6301_execute_one_instruction(void)
 
 	/* Increment PC register */
 	hd6301_reg_PC += hd6301_opcode.op_bytes;
+}
+
+/**
+ * Run the hd6301 for at least 'cycles' cycles, processing interrupts
+ * and timers. The run stops earlier when the cpu writes a new byte
+ * into the SCI's TDR, so the caller can send it at the right time.
+ * Return the number of cycles really executed.
+ */
+int hd6301_run(int cycles)
+{
+	int done = 0;
+	Uint16 vector;
+
+	hd6301_break = false;
+	while ((done < cycles) && !hd6301_break)
+	{
+		hd6301_cycles = 0;
+
+		vector = 0;
+		if ((hd6301_reg_CCR & (1 << hd6301_REG_CCR_I)) == 0)
+			vector = hd6301_pending_interrupt();
+
+		if (vector)
+			hd6301_interrupt(vector);
+		else if (hd6301_wait != HD6301_RUNNING)
+		{
+			/* Nothing to do until the next timer event or the end of this run */
+			hd6301_cycles = hd6301_timer_next_event();
+			if (hd6301_cycles > cycles - done)
+				hd6301_cycles = cycles - done;
+		}
+		else
+			hd6301_execute_one_instruction();
+
+		hd6301_timer_update(hd6301_cycles);
+		done += hd6301_cycles;
+	}
+
+	return done;
+}
+
+/**
+ * Save the complete cpu state
+ */
+void hd6301_save_state(hd6301_state_t *state)
+{
+	state->reg_A = hd6301_reg_A;
+	state->reg_B = hd6301_reg_B;
+	state->reg_X = hd6301_reg_X;
+	state->reg_SP = hd6301_reg_SP;
+	state->reg_PC = hd6301_reg_PC;
+	state->reg_CCR = hd6301_reg_CCR;
+	memcpy(state->intREG, hd6301_intREG, sizeof(state->intREG));
+	memcpy(state->intRAM, hd6301_intRAM, sizeof(state->intRAM));
+	state->frc = hd6301_frc;
+	state->ocr = hd6301_ocr;
+	state->icr = hd6301_icr;
+	state->frc_latch = hd6301_frc_latch;
+	state->tcsr_read = hd6301_tcsr_read;
+	state->trcsr_read = hd6301_trcsr_read;
+	state->wait = hd6301_wait;
+}
+
+/**
+ * Restore the complete cpu state
+ */
+void hd6301_restore_state(const hd6301_state_t *state)
+{
+	int port;
+
+	hd6301_reg_A = state->reg_A;
+	hd6301_reg_B = state->reg_B;
+	hd6301_reg_X = state->reg_X;
+	hd6301_reg_SP = state->reg_SP;
+	hd6301_reg_PC = state->reg_PC;
+	hd6301_reg_CCR = state->reg_CCR;
+	memcpy(hd6301_intREG, state->intREG, sizeof(hd6301_intREG));
+	memcpy(hd6301_intRAM, state->intRAM, sizeof(hd6301_intRAM));
+	hd6301_frc = state->frc;
+	hd6301_ocr = state->ocr;
+	hd6301_icr = state->icr;
+	hd6301_frc_latch = state->frc_latch;
+	hd6301_tcsr_read = state->tcsr_read;
+	hd6301_trcsr_read = state->trcsr_read;
+	hd6301_wait = state->wait;
+
+	for (port = 1; port <= 4; port++)
+		hd6301_output_port(port);
+}
+
+/**
+ * Return true if the SCI has a byte in TDR waiting to be transmitted
+ */
+bool hd6301_sci_tx_pending(void)
+{
+	return (hd6301_intREG[HD6301_REG_TRCSR] & (HD6301_TRCSR_TE | HD6301_TRCSR_TDRE)) == HD6301_TRCSR_TE;
+}
+
+/**
+ * Move TDR to the SCI's transmit shift register : TDR is empty again
+ */
+Uint8 hd6301_sci_tx_byte(void)
+{
+	hd6301_intREG[HD6301_REG_TRCSR] |= HD6301_TRCSR_TDRE;
+	return hd6301_intREG[HD6301_REG_TDR];
+}
+
+/**
+ * A byte was received on the SCI's RX line. If the previous byte was not
+ * read yet, the new byte is lost and an overrun error is reported
+ */
+void hd6301_sci_rx_byte(Uint8 value)
+{
+	if ((hd6301_intREG[HD6301_REG_TRCSR] & HD6301_TRCSR_RE) == 0)
+		return;
+
+	if (hd6301_intREG[HD6301_REG_TRCSR] & HD6301_TRCSR_RDRF)
+		hd6301_intREG[HD6301_REG_TRCSR] |= HD6301_TRCSR_ORFE;
+	else
+	{
+		hd6301_intREG[HD6301_REG_RDR] = value;
+		hd6301_intREG[HD6301_REG_TRCSR] |= HD6301_TRCSR_RDRF;
+	}
+}
+
+/**
+ * Return the vector of the highest priority pending maskable interrupt,
+ * or 0 if no interrupt is pending
+ */
+static Uint16 hd6301_pending_interrupt(void)
+{
+	Uint8 tcsr = hd6301_intREG[HD6301_REG_TCSR];
+	Uint8 trcsr = hd6301_intREG[HD6301_REG_TRCSR];
+
+	if ((tcsr & HD6301_TCSR_ICF) && (tcsr & HD6301_TCSR_EICI))
+		return HD6301_VECTOR_ICF;
+	if ((tcsr & HD6301_TCSR_OCF) && (tcsr & HD6301_TCSR_EOCI))
+		return HD6301_VECTOR_OCF;
+	if ((tcsr & HD6301_TCSR_TOF) && (tcsr & HD6301_TCSR_ETOI))
+		return HD6301_VECTOR_TOF;
+	if (((trcsr & (HD6301_TRCSR_RDRF | HD6301_TRCSR_ORFE)) && (trcsr & HD6301_TRCSR_RIE))
+	    || ((trcsr & HD6301_TRCSR_TDRE) && (trcsr & HD6301_TRCSR_TIE)))
+		return HD6301_VECTOR_SCI;
+	return 0;
+}
+
+/**
+ * Push PC, X, A, B and CCR on the stack
+ */
+static void hd6301_push_registers(Uint16 pc)
+{
+	hd6301_write_memory(hd6301_reg_SP--, pc & 0xff);
+	hd6301_write_memory(hd6301_reg_SP--, pc >> 8);
+	hd6301_write_memory(hd6301_reg_SP--, hd6301_reg_X & 0xff);
+	hd6301_write_memory(hd6301_reg_SP--, hd6301_reg_X >> 8);
+	hd6301_write_memory(hd6301_reg_SP--, hd6301_reg_A);
+	hd6301_write_memory(hd6301_reg_SP--, hd6301_reg_B);
+	hd6301_write_memory(hd6301_reg_SP--, hd6301_reg_CCR);
+}
+
+/**
+ * Jump to an interrupt vector. Registers were already pushed by WAI
+ */
+static void hd6301_interrupt(Uint16 vector)
+{
+	if (hd6301_wait == HD6301_WAI)
+		hd6301_cycles += 4;
+	else
+	{
+		hd6301_push_registers(hd6301_reg_PC);
+		hd6301_cycles += 12;
+	}
+	hd6301_wait = HD6301_RUNNING;
+
+	hd6301_reg_CCR |= 1 << hd6301_REG_CCR_I;
+	hd6301_reg_PC = hd6301_read_memory(vector) << 8;
+	hd6301_reg_PC += hd6301_read_memory(vector+1);
+}
+
+/**
+ * Return the number of cycles before the next OCF or TOF event
+ */
+static int hd6301_timer_next_event(void)
+{
+	int to_ocr, to_overflow;
+
+	to_ocr = (Uint16)(hd6301_ocr - hd6301_frc);
+	if (to_ocr == 0)
+		to_ocr = 0x10000;
+	to_overflow = 0x10000 - hd6301_frc;
+
+	return to_ocr < to_overflow ? to_ocr : to_overflow;
+}
+
+/**
+ * Increment the free running counter and set OCF/TOF when the counter
+ * matches the output compare register or overflows
+ */
+static void hd6301_timer_update(int cycles)
+{
+	int to_ocr;
+
+	to_ocr = (Uint16)(hd6301_ocr - hd6301_frc);
+	if (to_ocr == 0)
+		to_ocr = 0x10000;
+	if (cycles >= to_ocr)
+		hd6301_intREG[HD6301_REG_TCSR] |= HD6301_TCSR_OCF;
+
+	if (hd6301_frc + cycles > 0xffff)
+		hd6301_intREG[HD6301_REG_TCSR] |= HD6301_TCSR_TOF;
+
+	hd6301_frc += cycles;
+}
+
+/**
+ * Send the state of a port's pins : outputs get their data bit, inputs are high
+ */
+static void hd6301_output_port(int port)
+{
+	Uint8 ddr = hd6301_intREG[hd6301_port_ddr[port]];
+
+	hd6301_write_port(port, (hd6301_intREG[hd6301_port_data[port]] & ddr) | ~ddr);
+}
+
+/**
+ * Read hd6301 internal registers
+ */
+static Uint8 hd6301_read_register(Uint16 addr)
+{
+	Uint8 ddr, value;
+	int port;
+
+	switch (addr) {
+		case HD6301_REG_P1:
+		case HD6301_REG_P2:
+		case HD6301_REG_P3:
+		case HD6301_REG_P4:
+			port = addr == HD6301_REG_P1 ? 1 : addr == HD6301_REG_P2 ? 2 : addr == HD6301_REG_P3 ? 3 : 4;
+			ddr = hd6301_intREG[hd6301_port_ddr[port]];
+			value = (hd6301_intREG[addr] & ddr) | (hd6301_read_port(port) & ~ddr);
+			if (port == 2)
+				value = (value & 0x1f) | 0xe0;	/* P25-P27 : operating mode 7 (single chip) */
+			return value;
 
-	/* post process interrupts */
+		case HD6301_REG_TCSR:
+			hd6301_tcsr_read = hd6301_intREG[HD6301_REG_TCSR];
+			return hd6301_intREG[HD6301_REG_TCSR];
+		case HD6301_REG_FRC_H:
+			if (hd6301_tcsr_read & HD6301_TCSR_TOF)
+				hd6301_intREG[HD6301_REG_TCSR] &= ~HD6301_TCSR_TOF;
+			hd6301_frc_latch = hd6301_frc & 0xff;
+			return hd6301_frc >> 8;
+		case HD6301_REG_FRC_L:
+			return hd6301_frc_latch;
+		case HD6301_REG_OCR_H:
+			return hd6301_ocr >> 8;
+		case HD6301_REG_OCR_L:
+			return hd6301_ocr & 0xff;
+		case HD6301_REG_ICR_H:
+			if (hd6301_tcsr_read & HD6301_TCSR_ICF)
+				hd6301_intREG[HD6301_REG_TCSR] &= ~HD6301_TCSR_ICF;
+			return hd6301_icr >> 8;
+		case HD6301_REG_ICR_L:
+			return hd6301_icr & 0xff;
 
-	/* post process timers */
+		case HD6301_REG_TRCSR:
+			hd6301_trcsr_read = hd6301_intREG[HD6301_REG_TRCSR];
+			return hd6301_intREG[HD6301_REG_TRCSR];
+		case HD6301_REG_RDR:
+			hd6301_intREG[HD6301_REG_TRCSR] &= ~(hd6301_trcsr_read & (HD6301_TRCSR_RDRF | HD6301_TRCSR_ORFE));
+			hd6301_trcsr_read = 0;
+			return hd6301_intREG[HD6301_REG_RDR];
+	}
 
-	/* post process SCI */
+	return hd6301_intREG[addr];
+}
+
+/**
+ * Write hd6301 internal registers
+ */
+static void hd6301_write_register(Uint16 addr, Uint8 value)
+{
+	switch (addr) {
+		case HD6301_REG_P1DDR:
+		case HD6301_REG_P1:
+			hd6301_intREG[addr] = value;
+			hd6301_output_port(1);
+			break;
+		case HD6301_REG_P2DDR:
+		case HD6301_REG_P2:
+			hd6301_intREG[addr] = value;
+			hd6301_output_port(2);
+			break;
+		case HD6301_REG_P3DDR:
+		case HD6301_REG_P3:
+			hd6301_intREG[addr] = value;
+			hd6301_output_port(3);
+			break;
+		case HD6301_REG_P4DDR:
+		case HD6301_REG_P4:
+			hd6301_intREG[addr] = value;
+			hd6301_output_port(4);
+			break;
+
+		case HD6301_REG_TCSR:
+			hd6301_intREG[addr] = (hd6301_intREG[addr] & 0xe0) | (value & 0x1f);
+			break;
+		case HD6301_REG_FRC_H:
+			/* Writing the high byte presets the counter to $fff8 */
+			hd6301_frc_latch = value;
+			hd6301_frc = 0xfff8;
+			break;
+		case HD6301_REG_FRC_L:
+			hd6301_frc = (hd6301_frc_latch << 8) | value;
+			break;
+		case HD6301_REG_OCR_H:
+			if (hd6301_tcsr_read & HD6301_TCSR_OCF)
+				hd6301_intREG[HD6301_REG_TCSR] &= ~HD6301_TCSR_OCF;
+			hd6301_ocr = (value << 8) | (hd6301_ocr & 0xff);
+			break;
+		case HD6301_REG_OCR_L:
+			if (hd6301_tcsr_read & HD6301_TCSR_OCF)
+				hd6301_intREG[HD6301_REG_TCSR] &= ~HD6301_TCSR_OCF;
+			hd6301_ocr = (hd6301_ocr & 0xff00) | value;
+			break;
+		case HD6301_REG_ICR_H:
+		case HD6301_REG_ICR_L:
+			break;
+
+		case HD6301_REG_TRCSR:
+			hd6301_intREG[addr] = (hd6301_intREG[addr] & 0xe0) | (value & 0x1f);
+			break;
+		case HD6301_REG_RDR:
+			break;
+		case HD6301_REG_TDR:
+			hd6301_intREG[addr] = value;
+			hd6301_intREG[HD6301_REG_TRCSR] &= ~HD6301_TRCSR_TDRE;
+			hd6301_break = true;
+			break;
+
+		default:
+			hd6301_intREG[addr] = value;
+			break;
+	}
 }
 
 /**
@@ -665,7 +1119,7 @@ static Uint8 hd6301_read_memory(Uint16 addr)
 {
 	/* Internal registers */
 	if (addr <= 0x1f) {
-		return hd6301_intREG[addr];
+		return hd6301_read_register(addr);
 	}
 
 	/* Internal RAM */
@@ -678,8 +1132,8 @@ static Uint8 hd6301_read_memory(Uint16 addr)
 		return hd6301_intROM[addr-0xf000];
 	}
 
-	fprintf(stderr, "hd6301: 0x%04x: 0x%04x illegal memory address\n", hd6301_reg_PC, addr);
-	exit(-1);
+	/* Nothing is connected to the external bus in single chip mode */
+	return 0xff;
 }
 
 /**
@@ -689,7 +1143,7 @@ static void hd6301_write_memory (Uint16 addr, Uint8 value)
 {
 	/* Internal registers */
 	if (addr <= 0x1f) {
-		hd6301_intREG[addr] = value;
+		hd6301_write_register(addr, value);
 	}
 
 	/* Internal RAM */
@@ -697,16 +1151,7 @@ static void hd6301_write_memory (Uint16 addr, Uint8 value)
 		hd6301_intRAM[addr-0x80] = value;
 	}
 
-	/* Internal ROM */
-	else if (addr >= 0xf000) {
-		fprintf(stderr, "hd6301: 0x%04x: attempt to write to rom\n", addr);
-	}
-
-	/* Illegal address */
-	else {
-		fprintf(stderr, "hd6301: 0x%04x: write to illegal address\n", addr);
-		exit(-1);
-	}
+	/* Writes to the ROM or to the external bus are ignored */
 }
 
 /**
@@ -722,12 +1167,16 @@ static Uint16 hd6301_get_memory_ext(void)
 }
 
 /**
- * Undefined opcode
+ * Undefined opcode : the hd6301 takes the TRAP interrupt
  */
 static void hd6301_undefined(void)
 {
-	fprintf(stderr, "hd6301: 0x%04x: 0x%02x unknown instruction\n", hd6301_reg_PC, hd6301_cur_inst);
-	exit(-1);  /* TODO: Trap the error correctly */
+	hd6301_push_registers(hd6301_reg_PC);
+	hd6301_cycles += 12;
+
+	hd6301_reg_CCR |= 1 << hd6301_REG_CCR_I;
+	hd6301_reg_PC = hd6301_read_memory(HD6301_VECTOR_TRAP) << 8;
+	hd6301_reg_PC += hd6301_read_memory(HD6301_VECTOR_TRAP+1);
 }
 
 /**
@@ -993,7 +1442,26 @@ static void hd6301_xgdx(void)
  */
 static void hd6301_daa(void)
 {
-	/* Todo */
+	Uint8 msn, lsn, correction;
+	Uint16 result;
+
+	msn = hd6301_reg_A & 0xf0;
+	lsn = hd6301_reg_A & 0x0f;
+	correction = 0;
+	if ((lsn > 0x09) || (hd6301_reg_CCR & (1 << hd6301_REG_CCR_H)))
+		correction |= 0x06;
+	if ((msn > 0x80) && (lsn > 0x09))
+		correction |= 0x60;
+	if ((msn > 0x90) || (hd6301_reg_CCR & 1))
+		correction |= 0x60;
+	result = hd6301_reg_A + correction;
+
+	/* Carry is kept if it was already set */
+	HD6301_CLR_NZV;
+	HD6301_SET_NZ8(result);
+	HD6301_SET_C8(result);
+
+	hd6301_reg_A = result;
 }
 
 /**
@@ -1004,7 +1472,7 @@ static void hd6301_daa(void)
  */
 static void hd6301_slp(void)
 {
-	/* Todo */
+	hd6301_wait = HD6301_SLP;
 }
 
 /**
@@ -1034,9 +1502,9 @@ static void hd6301_aba(void)
  */
 static void hd6301_bra(void)
 {
-	Sint8 addr;
+	Sint16 addr;
 
-	addr = hd6301_read_memory(hd6301_reg_PC + 1);
+	addr = (Sint8)hd6301_read_memory(hd6301_reg_PC + 1);
 	hd6301_reg_PC += addr + 2;
 }
 
@@ -1059,14 +1527,14 @@ static void hd6301_brn(void)
  */
 static void hd6301_bhi(void)
 {
-	Sint8 addr;
+	Sint16 addr;
 	Uint8 bitC, bitZ;
 
 	bitC = (hd6301_reg_CCR >> hd6301_REG_CCR_C) & 1;
 	bitZ = (hd6301_reg_CCR >> hd6301_REG_CCR_Z) & 1;
 	addr = 2;
 	if ((bitC | bitZ) == 0) {
-		addr += hd6301_read_memory(hd6301_reg_PC + 1);
+		addr += (Sint8)hd6301_read_memory(hd6301_reg_PC + 1);
 	}
 	hd6301_reg_PC += addr;
 }
@@ -1079,14 +1547,14 @@ static void hd6301_bhi(void)
  */
 static void hd6301_bls(void)
 {
-	Sint8 addr;
+	Sint16 addr;
 	Uint8 bitC, bitZ;
 
 	bitC = (hd6301_reg_CCR >> hd6301_REG_CCR_C) & 1;
 	bitZ = (hd6301_reg_CCR >> hd6301_REG_CCR_Z) & 1;
 	addr = 2;
 	if ((bitC | bitZ) == 1) {
-		addr += hd6301_read_memory(hd6301_reg_PC + 1);
+		addr += (Sint8)hd6301_read_memory(hd6301_reg_PC + 1);
 	}
 	hd6301_reg_PC += addr;
 }
@@ -1099,13 +1567,13 @@ static void hd6301_bls(void)
  */
 static void hd6301_bcc(void)
 {
-	Sint8 addr;
+	Sint16 addr;
 	Uint8 bitC;
 
 	bitC = (hd6301_reg_CCR >> hd6301_REG_CCR_C) & 1;
 	addr = 2;
 	if (bitC == 0) {
-		addr += hd6301_read_memory(hd6301_reg_PC + 1);
+		addr += (Sint8)hd6301_read_memory(hd6301_reg_PC + 1);
 	}
 	hd6301_reg_PC += addr;
 }
@@ -1118,13 +1586,13 @@ static void hd6301_bcc(void)
  */
 static void hd6301_bcs(void)
 {
-	Sint8 addr;
+	Sint16 addr;
 	Uint8 bitC;
 
 	bitC = (hd6301_reg_CCR >> hd6301_REG_CCR_C) & 1;
 	addr = 2;
 	if (bitC == 1) {
-		addr += hd6301_read_memory(hd6301_reg_PC + 1);
+		addr += (Sint8)hd6301_read_memory(hd6301_reg_PC + 1);
 	}
 	hd6301_reg_PC += addr;
 }
@@ -1137,13 +1605,13 @@ static void hd6301_bcs(void)
  */
 static void hd6301_bne(void)
 {
-	Sint8 addr;
+	Sint16 addr;
 	Uint8 bitZ;
 
 	bitZ = (hd6301_reg_CCR >> hd6301_REG_CCR_Z) & 1;
 	addr = 2;
 	if (bitZ == 0) {
-		addr += hd6301_read_memory(hd6301_reg_PC + 1);
+		addr += (Sint8)hd6301_read_memory(hd6301_reg_PC + 1);
 	}
 	hd6301_reg_PC += addr;
 }
@@ -1156,13 +1624,13 @@ static void hd6301_bne(void)
  */
 static void hd6301_beq(void)
 {
-	Sint8 addr;
+	Sint16 addr;
 	Uint8 bitZ;
 
 	bitZ = (hd6301_reg_CCR >> hd6301_REG_CCR_Z) & 1;
 	addr = 2;
 	if (bitZ == 1) {
-		addr += hd6301_read_memory(hd6301_reg_PC + 1);
+		addr += (Sint8)hd6301_read_memory(hd6301_reg_PC + 1);
 	}
 	hd6301_reg_PC += addr;
 }
@@ -1175,13 +1643,13 @@ static void hd6301_beq(void)
  */
 static void hd6301_bvc(void)
 {
-	Sint8 addr;
+	Sint16 addr;
 	Uint8 bitV;
 
 	bitV = (hd6301_reg_CCR >> hd6301_REG_CCR_V) & 1;
 	addr = 2;
 	if (bitV == 0) {
-		addr += hd6301_read_memory(hd6301_reg_PC + 1);
+		addr += (Sint8)hd6301_read_memory(hd6301_reg_PC + 1);
 	}
 	hd6301_reg_PC += addr;
 }
@@ -1194,13 +1662,13 @@ static void hd6301_bvc(void)
  */
 static void hd6301_bvs(void)
 {
-	Sint8 addr;
+	Sint16 addr;
 	Uint8 bitV;
 
 	bitV = (hd6301_reg_CCR >> hd6301_REG_CCR_V) & 1;
 	addr = 2;
 	if (bitV == 1) {
-		addr += hd6301_read_memory(hd6301_reg_PC + 1);
+		addr += (Sint8)hd6301_read_memory(hd6301_reg_PC + 1);
 	}
 	hd6301_reg_PC += addr;
 }
@@ -1213,13 +1681,13 @@ static void hd6301_bvs(void)
  */
 static void hd6301_bpl(void)
 {
-	Sint8 addr;
+	Sint16 addr;
 	Uint8 bitN;
 
 	bitN = (hd6301_reg_CCR >> hd6301_REG_CCR_N) & 1;
 	addr = 2;
 	if (bitN == 0) {
-		addr += hd6301_read_memory(hd6301_reg_PC + 1);
+		addr += (Sint8)hd6301_read_memory(hd6301_reg_PC + 1);
 	}
 	hd6301_reg_PC += addr;
 }
@@ -1232,13 +1700,13 @@ static void hd6301_bpl(void)
  */
 static void hd6301_bmi(void)
 {
-	Sint8 addr;
+	Sint16 addr;
 	Uint8 bitN;
 
 	bitN = (hd6301_reg_CCR >> hd6301_REG_CCR_N) & 1;
 	addr = 2;
 	if (bitN == 1) {
-		addr += hd6301_read_memory(hd6301_reg_PC + 1);
+		addr += (Sint8)hd6301_read_memory(hd6301_reg_PC + 1);
 	}
 	hd6301_reg_PC += addr;
 }
@@ -1251,14 +1719,14 @@ static void hd6301_bmi(void)
  */
 static void hd6301_bge(void)
 {
-	Sint8 addr;
+	Sint16 addr;
 	Uint8 bitN, bitV;
 
 	bitN = (hd6301_reg_CCR >> hd6301_REG_CCR_N) & 1;
 	bitV = (hd6301_reg_CCR >> hd6301_REG_CCR_V) & 1;
 	addr = 2;
 	if ((bitN ^ bitV) == 0) {
-		addr += hd6301_read_memory(hd6301_reg_PC + 1);
+		addr += (Sint8)hd6301_read_memory(hd6301_reg_PC + 1);
 	}
 	hd6301_reg_PC += addr;
 }
@@ -1271,14 +1739,14 @@ static void hd6301_bge(void)
  */
 static void hd6301_blt(void)
 {
-	Sint8 addr;
+	Sint16 addr;
 	Uint8 bitN, bitV;
 
 	bitN = (hd6301_reg_CCR >> hd6301_REG_CCR_N) & 1;
 	bitV = (hd6301_reg_CCR >> hd6301_REG_CCR_V) & 1;
 	addr = 2;
 	if ((bitN ^ bitV) == 1) {
-		addr += hd6301_read_memory(hd6301_reg_PC + 1);
+		addr += (Sint8)hd6301_read_memory(hd6301_reg_PC + 1);
 	}
 	hd6301_reg_PC += addr;
 }
@@ -1291,7 +1759,7 @@ static void hd6301_blt(void)
  */
 static void hd6301_bgt(void)
 {
-	Sint8 addr;
+	Sint16 addr;
 	Uint8 bitN, bitV, bitZ;
 
 	bitN = (hd6301_reg_CCR >> hd6301_REG_CCR_N) & 1;
@@ -1299,7 +1767,7 @@ static void hd6301_bgt(void)
 	bitZ = (hd6301_reg_CCR >> hd6301_REG_CCR_Z) & 1;
 	addr = 2;
 	if ((bitZ | (bitN ^ bitV)) == 0) {
-		addr += hd6301_read_memory(hd6301_reg_PC + 1);
+		addr += (Sint8)hd6301_read_memory(hd6301_reg_PC + 1);
 	}
 	hd6301_reg_PC += addr;
 }
@@ -1312,7 +1780,7 @@ static void hd6301_bgt(void)
  */
 static void hd6301_ble(void)
 {
-	Sint8 addr;
+	Sint16 addr;
 	Uint8 bitN, bitV, bitZ;
 
 	bitN = (hd6301_reg_CCR >> hd6301_REG_CCR_N) & 1;
@@ -1320,7 +1788,7 @@ static void hd6301_ble(void)
 	bitZ = (hd6301_reg_CCR >> hd6301_REG_CCR_Z) & 1;
 	addr = 2;
 	if ((bitZ | (bitN ^ bitV)) == 1) {
-		addr += hd6301_read_memory(hd6301_reg_PC + 1);
+		addr += (Sint8)hd6301_read_memory(hd6301_reg_PC + 1);
 	}
 	hd6301_reg_PC += addr;
 }
@@ -1507,7 +1975,9 @@ static void hd6301_mul(void)
  */
 static void hd6301_wai(void)
 {
-	/* Todo */
+	hd6301_push_registers(hd6301_reg_PC+1);
+	hd6301_reg_PC += 1;
+	hd6301_wait = HD6301_WAI;
 }
 
 /**
@@ -1680,7 +2150,7 @@ static void hd6301_deca(void)
 {
 	Uint8 overflow;
 
-	overflow = (hd6301_reg_A == (Sint8)0x80) << hd6301_REG_CCR_V;
+	overflow = (hd6301_reg_A == 0x80) << hd6301_REG_CCR_V;
 	-- hd6301_reg_A;
 
 	HD6301_CLR_NZV;
@@ -1878,7 +2348,7 @@ static void hd6301_decb(void)
 {
 	Uint8 overflow;
 
-	overflow = (hd6301_reg_B == (Sint8)0x80) << hd6301_REG_CCR_V;
+	overflow = (hd6301_reg_B == 0x80) << hd6301_REG_CCR_V;
 	-- hd6301_reg_B;
 
 	HD6301_CLR_NZV;
@@ -2194,7 +2664,6 @@ static void hd6301_tim_ind(void)
 	value = hd6301_read_memory(hd6301_reg_PC+1);
 	addr = hd6301_reg_X + hd6301_read_memory(hd6301_reg_PC+2);
 	value &= hd6301_read_memory(addr);
-	hd6301_write_memory(addr, value);
 
 	HD6301_CLR_NZV;
 	HD6301_SET_NZ8(value);
@@ -2249,12 +2718,7 @@ static void hd6301_tst_ind(void)
  */
 static void hd6301_jmp_ind(void)
 {
-	Uint8  value;
-	Uint16 addr;
-
-	addr = hd6301_reg_X + hd6301_read_memory(hd6301_reg_PC+1);
-	value = hd6301_read_memory(addr);
-	hd6301_reg_PC = value;
+	hd6301_reg_PC = hd6301_reg_X + hd6301_read_memory(hd6301_reg_PC+1);
 }
 
 /**
@@ -2420,7 +2884,7 @@ static void hd6301_ror_ext(void)
 
 	HD6301_CLR_NZVC;
 	hd6301_reg_CCR |= carry;
-	HD6301_SET_NZ8(value);
+	HD6301_SET_NZ8(result);
 	bitN = (hd6301_reg_CCR >> hd6301_REG_CCR_N) & 1;
 	hd6301_reg_CCR |= ((bitN ^ carry) == 1) << hd6301_REG_CCR_V;
 }
@@ -2497,7 +2961,7 @@ static void hd6301_rol_ext(void)
 
 	HD6301_CLR_NZVC;
 	hd6301_reg_CCR |= carry;
-	HD6301_SET_NZ8(value);
+	HD6301_SET_NZ8(result);
 	bitN = (hd6301_reg_CCR >> hd6301_REG_CCR_N) & 1;
 	hd6301_reg_CCR |= ((bitN ^ carry) == 1) << hd6301_REG_CCR_V;
 }
@@ -2539,7 +3003,6 @@ static void hd6301_tim_dir(void)
 	value = hd6301_read_memory(hd6301_reg_PC+1);
 	addr = hd6301_read_memory(hd6301_reg_PC+2);
 	value &= hd6301_read_memory(addr);
-	hd6301_write_memory(addr, value);
 
 	HD6301_CLR_NZV;
 	HD6301_SET_NZ8(value);
@@ -2594,13 +3057,7 @@ static void hd6301_tst_ext(void)
  */
 static void hd6301_jmp_ext(void)
 {
-	Uint8  value;
-	Uint16 addr;
-
-	addr = hd6301_get_memory_ext();
-	value = hd6301_read_memory(addr);
-
-	hd6301_reg_PC = value;
+	hd6301_reg_PC = hd6301_get_memory_ext();
 }
 
 /**
@@ -2669,7 +3126,7 @@ static void hd6301_sbca_imm(void)
 	Uint8  value, carry;
 	Uint16 result;
 
-	carry = hd6301_REG_CCR_C & 1;
+	carry = hd6301_reg_CCR & 1;
 	value = hd6301_read_memory(hd6301_reg_PC+1);
 	result = hd6301_reg_A - value - carry;
 
@@ -2771,7 +3228,7 @@ static void hd6301_adca_imm(void)
 	Uint8  value, carry;
 	Uint16 result;
 
-	carry = hd6301_REG_CCR_C & 1;
+	carry = hd6301_reg_CCR & 1;
 	value = hd6301_read_memory(hd6301_reg_PC+1);
 	result = hd6301_reg_A + value + carry;
 
@@ -2844,12 +3301,12 @@ static void hd6301_cpx_imm(void)
  */
 static void hd6301_bsr(void)
 {
-	Sint8 addr;
+	Sint16 addr;
 
 	hd6301_write_memory(hd6301_reg_SP--, (hd6301_reg_PC + 2) & 0xff);
 	hd6301_write_memory(hd6301_reg_SP--, (hd6301_reg_PC + 2) >> 8);
 
-	addr = hd6301_read_memory(hd6301_reg_PC + 1);
+	addr = (Sint8)hd6301_read_memory(hd6301_reg_PC + 1);
 	hd6301_reg_PC += addr + 2;
 }
 
@@ -2922,7 +3379,7 @@ static void hd6301_sbca_dir(void)
 	Uint8  value, carry;
 	Uint16 addr, result;
 
-	carry = hd6301_REG_CCR_C & 1;
+	carry = hd6301_reg_CCR & 1;
 	addr = hd6301_read_memory(hd6301_reg_PC+1);
 	value = hd6301_read_memory(addr);
 	result = hd6301_reg_A - value - carry;
@@ -3054,7 +3511,7 @@ static void hd6301_adca_dir(void)
 	Uint8  value, carry;
 	Uint16 addr, result;
 
-	carry = hd6301_REG_CCR_C & 1;
+	carry = hd6301_reg_CCR & 1;
 	addr = hd6301_read_memory(hd6301_reg_PC+1);
 	value = hd6301_read_memory(addr);
 	result = hd6301_reg_A + value + carry;
@@ -3098,7 +3555,7 @@ static void hd6301_adda_dir(void)
 	value = hd6301_read_memory(addr);
 	result = hd6301_reg_A + value;
 
-	HD6301_CLR_NZVC;
+	HD6301_CLR_HNZVC;
 	HD6301_SET_FLAGS8(hd6301_reg_A, value, result);
 	HD6301_SET_H(hd6301_reg_A, value, result);
 
@@ -3139,7 +3596,7 @@ static void hd6301_jsr_dir(void)
 	hd6301_write_memory(hd6301_reg_SP--, (hd6301_reg_PC + 2) >> 8);
 
 	addr = hd6301_read_memory(hd6301_reg_PC + 1);
-	hd6301_reg_PC += addr + 2;
+	hd6301_reg_PC = addr;
 }
 
 /**
@@ -3172,7 +3629,7 @@ static void hd6301_sts_dir(void)
 	
 	addr = hd6301_read_memory(hd6301_reg_PC+1);
 	hd6301_write_memory(addr, hd6301_reg_SP >> 8);
-	hd6301_write_memory(addr+1, hd6301_reg_SP & 8);
+	hd6301_write_memory(addr+1, hd6301_reg_SP & 0xff);
 
 	HD6301_CLR_NZV;
 	HD6301_SET_NZ16(hd6301_reg_SP);
@@ -3229,7 +3686,7 @@ static void hd6301_sbca_ind(void)
 	Uint8  value, carry;
 	Uint16 addr, result;
 
-	carry = hd6301_REG_CCR_C & 1;
+	carry = hd6301_reg_CCR & 1;
 	addr = hd6301_reg_X + hd6301_read_memory(hd6301_reg_PC+1);
 	value = hd6301_read_memory(addr);
 	result = hd6301_reg_A - value - carry;
@@ -3361,7 +3818,7 @@ static void hd6301_adca_ind(void)
 	Uint8  value, carry;
 	Uint16 addr, result;
 
-	carry = hd6301_REG_CCR_C & 1;
+	carry = hd6301_reg_CCR & 1;
 	addr = hd6301_reg_X + hd6301_read_memory(hd6301_reg_PC+1);
 	value = hd6301_read_memory(addr);
 	result = hd6301_reg_A + value + carry;
@@ -3446,7 +3903,7 @@ static void hd6301_jsr_ind(void)
 	hd6301_write_memory(hd6301_reg_SP--, (hd6301_reg_PC + 2) >> 8);
 
 	addr = hd6301_reg_X + hd6301_read_memory(hd6301_reg_PC+1);
-	hd6301_reg_PC += addr + 2;
+	hd6301_reg_PC = addr;
 }
 
 /**
@@ -3479,7 +3936,7 @@ static void hd6301_sts_ind(void)
 	
 	addr = hd6301_reg_X + hd6301_read_memory(hd6301_reg_PC+1);
 	hd6301_write_memory(addr, hd6301_reg_SP >> 8);
-	hd6301_write_memory(addr+1, hd6301_reg_SP & 8);
+	hd6301_write_memory(addr+1, hd6301_reg_SP & 0xff);
 
 	HD6301_CLR_NZV;
 	HD6301_SET_NZ16(hd6301_reg_SP);
@@ -3536,7 +3993,7 @@ static void hd6301_sbca_ext(void)
 	Uint8  value, carry;
 	Uint16 addr, result;
 
-	carry = hd6301_REG_CCR_C & 1;
+	carry = hd6301_reg_CCR & 1;
 	addr = hd6301_get_memory_ext();
 	value = hd6301_read_memory(addr);
 	result = hd6301_reg_A - value - carry;
@@ -3668,7 +4125,7 @@ static void hd6301_adca_ext(void)
 	Uint8  value, carry;
 	Uint16 addr, result;
 
-	carry = hd6301_REG_CCR_C & 1;
+	carry = hd6301_reg_CCR & 1;
 	addr = hd6301_get_memory_ext();
 	value = hd6301_read_memory(addr);
 	result = hd6301_reg_A + value + carry;
@@ -3749,11 +4206,11 @@ static void hd6301_jsr_ext(void)
 {
 	Uint16 addr;
 
-	hd6301_write_memory(hd6301_reg_SP--, (hd6301_reg_PC + 2) & 0xff);
-	hd6301_write_memory(hd6301_reg_SP--, (hd6301_reg_PC + 2) >> 8);
+	hd6301_write_memory(hd6301_reg_SP--, (hd6301_reg_PC + 3) & 0xff);
+	hd6301_write_memory(hd6301_reg_SP--, (hd6301_reg_PC + 3) >> 8);
 
 	addr = hd6301_get_memory_ext();
-	hd6301_reg_PC += addr + 2;
+	hd6301_reg_PC = addr;
 }
 
 /**
@@ -3786,7 +4243,7 @@ static void hd6301_sts_ext(void)
 	
 	addr = hd6301_get_memory_ext();
 	hd6301_write_memory(addr, hd6301_reg_SP >> 8);
-	hd6301_write_memory(addr+1, hd6301_reg_SP & 8);
+	hd6301_write_memory(addr+1, hd6301_reg_SP & 0xff);
 
 	HD6301_CLR_NZV;
 	HD6301_SET_NZ16(hd6301_reg_SP);
@@ -3841,7 +4298,7 @@ static void hd6301_sbcb_imm(void)
 	Uint8  value, carry;
 	Uint16 result;
 
-	carry = hd6301_REG_CCR_C & 1;
+	carry = hd6301_reg_CCR & 1;
 	value = hd6301_read_memory(hd6301_reg_PC+1);
 	result = hd6301_reg_B - value - carry;
 
@@ -3943,7 +4400,7 @@ static void hd6301_adcb_imm(void)
 	Uint8  value, carry;
 	Uint16 result;
 
-	carry = hd6301_REG_CCR_C & 1;
+	carry = hd6301_reg_CCR & 1;
 	value = hd6301_read_memory(hd6301_reg_PC+1);
 	result = hd6301_reg_B + value + carry;
 
@@ -4074,7 +4531,7 @@ static void hd6301_sbcb_dir(void)
 	Uint8  value, carry;
 	Uint16 addr, result;
 
-	carry = hd6301_REG_CCR_C & 1;
+	carry = hd6301_reg_CCR & 1;
 	addr = hd6301_read_memory(hd6301_reg_PC+1);
 	value = hd6301_read_memory(addr);
 	result = hd6301_reg_B - value - carry;
@@ -4206,7 +4663,7 @@ static void hd6301_adcb_dir(void)
 	Uint8  value, carry;
 	Uint16 addr, result;
 
-	carry = hd6301_REG_CCR_C & 1;
+	carry = hd6301_reg_CCR & 1;
 	addr = hd6301_read_memory(hd6301_reg_PC+1);
 	value = hd6301_read_memory(addr);
 	result = hd6301_reg_B + value + carry;
@@ -4386,7 +4843,7 @@ static void hd6301_sbcb_ind(void)
 	Uint8  value, carry;
 	Uint16 addr, result;
 
-	carry = hd6301_REG_CCR_C & 1;
+	carry = hd6301_reg_CCR & 1;
 	addr = hd6301_reg_X + hd6301_read_memory(hd6301_reg_PC+1);
 	value = hd6301_read_memory(addr);
 	result = hd6301_reg_B - value - carry;
@@ -4518,7 +4975,7 @@ static void hd6301_adcb_ind(void)
 	Uint8  value, carry;
 	Uint16 addr, result;
 
-	carry = hd6301_REG_CCR_C & 1;
+	carry = hd6301_reg_CCR & 1;
 	addr = hd6301_reg_X + hd6301_read_memory(hd6301_reg_PC+1);
 	value = hd6301_read_memory(addr);
 	result = hd6301_reg_B + value + carry;
@@ -4698,7 +5155,7 @@ static void hd6301_sbcb_ext(void)
 	Uint8  value, carry;
 	Uint16 addr, result;
 
-	carry = hd6301_REG_CCR_C & 1;
+	carry = hd6301_reg_CCR & 1;
 	addr = hd6301_get_memory_ext();
 	value = hd6301_read_memory(addr);
 	result = hd6301_reg_B - value - carry;
@@ -4830,7 +5287,7 @@ static void hd6301_adcb_ext(void)
 	Uint8  value, carry;
 	Uint16 addr, result;
 
-	carry = hd6301_REG_CCR_C & 1;
+	carry = hd6301_reg_CCR & 1;
 	addr = hd6301_get_memory_ext();
 	value = hd6301_read_memory(addr);
 	result = hd6301_reg_B + value + carry;
@@ -32,9 +32,45 @@ struct hd6301_opcode_t {
 	Uint8	op_disasm;		/* For instructions disasm */
 };
 
+/* Ports are numbered from 1 to 4 like in the hd6301 datasheet */
+typedef Uint8 (*hd6301_read_port_t)(int port);
+typedef void (*hd6301_write_port_t)(int port, Uint8 value);
+
+/* Complete cpu state, used to save/restore the cpu (snapshots) */
+typedef struct {
+	Uint8	reg_A;
+	Uint8	reg_B;
+	Uint16	reg_X;
+	Uint16	reg_SP;
+	Uint16	reg_PC;
+	Uint8	reg_CCR;
+
+	Uint8	intREG[32];
+	Uint8	intRAM[128];
+
+	Uint16	frc;			/* Free running counter */
+	Uint16	ocr;			/* Output compare register */
+	Uint16	icr;			/* Input capture register */
+	Uint8	frc_latch;		/* FRC low byte, latched when reading FRC high byte */
+	Uint8	tcsr_read;		/* TCSR flags seen by the last read of TCSR */
+	Uint8	trcsr_read;		/* TRCSR flags seen by the last read of TRCSR */
+	Uint8	wait;			/* Cpu stopped by WAI or SLP */
+} hd6301_state_t;
+
 /* Functions */
-extern void hd6301_init_cpu(void);
+extern void hd6301_init_cpu(hd6301_read_port_t read_port, hd6301_write_port_t write_port);
+extern void hd6301_load_rom(const Uint8 *rom);
+extern void hd6301_reset_cpu(void);
 extern void hd6301_execute_one_instruction(void);
+extern int hd6301_run(int cycles);
+
+extern void hd6301_save_state(hd6301_state_t *state);
+extern void hd6301_restore_state(const hd6301_state_t *state);
+
+/* Serial Communication Interface */
+extern bool hd6301_sci_tx_pending(void);
+extern Uint8 hd6301_sci_tx_byte(void);
+extern void hd6301_sci_rx_byte(Uint8 value);
 
 /* HF6301 Disasm and debug code */
 extern void hd6301_disasm(void);
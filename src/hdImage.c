@@ -0,0 +1,710 @@
+/*
+  Hatari - hdImage.c
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+
+  Hard disk image access for the ACSI/SCSI and IDE emulation.
+
+  Where the host supports it, the whole image is mapped into memory, so
+  reading sectors is a memcpy() from the page cache straight to where the
+  caller wants them (e.g. ST RAM for ACSI DMA) instead of an lseek() and
+  a read() through the stdio buffer for every command. While the sectors
+  are read sequentially, the next pages are requested from the host ahead
+  of time, which helps when the images are on network storage.
+
+  If the image can't be mapped (e.g. a 2 GB image on a 32-bit host), it's
+  accessed with the stdio functions as before.
+
+  When an overlay directory is configured, the image is opened read-only
+  (so that any number of instances can share it) and the sectors written
+  by the emulated machine go to a per-drive overlay file in that directory
+  instead. The overlay file has a header with the size of the image, which
+  is followed by records of a (big endian) 64-bit sector number and the
+  sector data. Each modified sector has one record, the in-memory hash
+  table of the record index for each sector is built when the overlay is
+  opened.
+
+  The emulated controllers can also hand a transfer over to a host thread
+  with HdImage_Submit(), and pick its result up with HdImage_Complete()
+  once the emulated drive would have finished it. Only then the emulation
+  has to wait, if the host disk is slower than the emulated one. Until
+  the transfer is complete, the image must not be accessed otherwise.
+*/
+const char HdImage_fileid[] = "Hatari hdImage.c : " __DATE__ " " __TIME__;
+
+#include <assert.h>
+
+#include "main.h"
+#include "configuration.h"
+#include "file.h"
+#include "hdImage.h"
+#include "log.h"
+
+#if HAVE_MMAP
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#if HAVE_PTHREAD_H
+#define HDIMAGE_THREAD 1
+#include <pthread.h>
+#endif
+
+
+#define HDIMAGE_READAHEAD	(256*1024)	/* bytes requested ahead of sequential reads */
+
+#define OVERLAY_MAGIC		"HATCOW01"
+#define OVERLAY_HEADER		16		/* magic + image size in sectors */
+#define OVERLAY_RECORD		(8 + HDIMAGE_SECTOR_SIZE)
+#define OVERLAY_MIN_HASH	1024
+
+#define HDIMAGE_QUEUE		16		/* more than the ACSI and IDE drives */
+
+static int nOpenImages;
+
+#if HDIMAGE_THREAD
+static pthread_t Thread;
+static bool bThreadRunning, bThreadQuit;
+static pthread_mutex_t Mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t WorkCond = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t DoneCond = PTHREAD_COND_INITIALIZER;
+static HD_IMAGE *Queue[HDIMAGE_QUEUE];
+static int nQueueHead, nQueued;
+static int nTransfers, nWaits;			/* statistics */
+#endif
+
+static void HdImage_Release(HD_IMAGE *pImg);
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Store / load big endian 64-bit value.
+ */
+static void HdImage_PutU64(Uint8 *p, Uint64 nVal)
+{
+	int i;
+	for (i = 7; i >= 0; i--, nVal >>= 8)
+		p[i] = nVal;
+}
+static Uint64 HdImage_GetU64(const Uint8 *p)
+{
+	Uint64 nVal = 0;
+	int i;
+	for (i = 0; i < 8; i++)
+		nVal = (nVal << 8) | p[i];
+	return nVal;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return the overlay hash table slot of given sector: the one holding it,
+ * or the free one where it would be added.
+ */
+static Uint32 HdImage_OvlSlot(const HD_IMAGE *pImg, Uint64 nSector)
+{
+	Uint32 i = (Uint32)((nSector * 0x9E3779B97F4A7C15ULL) >> 32) & pImg->nOvlMask;
+
+	while (pImg->pOvlSectors[i] && pImg->pOvlSectors[i] != nSector + 1)
+		i = (i + 1) & pImg->nOvlMask;
+	return i;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * (Re)allocate the overlay hash table with nSize (power of 2) slots.
+ * Return false on error.
+ */
+static bool HdImage_OvlResize(HD_IMAGE *pImg, Uint32 nSize)
+{
+	HD_IMAGE Old = *pImg;
+	Uint32 i, nSlot;
+
+	pImg->pOvlSectors = calloc(nSize, sizeof(*pImg->pOvlSectors));
+	pImg->pOvlRecords = malloc(nSize * sizeof(*pImg->pOvlRecords));
+	if (!pImg->pOvlSectors || !pImg->pOvlRecords)
+	{
+		free(pImg->pOvlSectors);
+		free(pImg->pOvlRecords);
+		pImg->pOvlSectors = Old.pOvlSectors;
+		pImg->pOvlRecords = Old.pOvlRecords;
+		return false;
+	}
+	pImg->nOvlMask = nSize - 1;
+	for (i = 0; Old.pOvlSectors && i <= Old.nOvlMask; i++)
+	{
+		if (!Old.pOvlSectors[i])
+			continue;
+		nSlot = HdImage_OvlSlot(pImg, Old.pOvlSectors[i] - 1);
+		pImg->pOvlSectors[nSlot] = Old.pOvlSectors[i];
+		pImg->pOvlRecords[nSlot] = Old.pOvlRecords[i];
+	}
+	free(Old.pOvlSectors);
+	free(Old.pOvlRecords);
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Add the next overlay record for given (not yet overlaid) sector to the
+ * hash table, which is kept at most half full. Return false on error.
+ */
+static bool HdImage_OvlAdd(HD_IMAGE *pImg, Uint64 nSector)
+{
+	Uint32 nSlot;
+
+	if (2 * (pImg->nOvlCount + 1) > pImg->nOvlMask + 1
+	    && !HdImage_OvlResize(pImg, 2 * (pImg->nOvlMask + 1)))
+		return false;
+
+	nSlot = HdImage_OvlSlot(pImg, nSector);
+	pImg->pOvlSectors[nSlot] = nSector + 1;
+	pImg->pOvlRecords[nSlot] = pImg->nOvlCount++;
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Open (or create) the overlay file for the image and index its records.
+ * Return false on error.
+ */
+static bool HdImage_OpenOverlay(HD_IMAGE *pImg, const char *pszFileName)
+{
+	Uint8 header[OVERLAY_HEADER], record[OVERLAY_RECORD];
+	off_t nSize = File_Length(pszFileName);
+	Uint64 nSector;
+
+	if (nSize <= 0)
+	{
+		pImg->pOverlay = fopen(pszFileName, "wb+");
+		memcpy(header, OVERLAY_MAGIC, 8);
+		HdImage_PutU64(header + 8, pImg->nSectors);
+		if (pImg->pOverlay && fwrite(header, sizeof(header), 1, pImg->pOverlay) != 1)
+		{
+			fclose(pImg->pOverlay);
+			pImg->pOverlay = NULL;
+		}
+	}
+	else
+	{
+		pImg->pOverlay = fopen(pszFileName, "rb+");
+		if (pImg->pOverlay &&
+		    (fread(header, sizeof(header), 1, pImg->pOverlay) != 1 ||
+		     memcmp(header, OVERLAY_MAGIC, 8) != 0 ||
+		     HdImage_GetU64(header + 8) != pImg->nSectors))
+		{
+			Log_Printf(LOG_ERROR, "ERROR: HD overlay %s doesn't belong to this image!\n", pszFileName);
+			fclose(pImg->pOverlay);
+			pImg->pOverlay = NULL;
+			return false;
+		}
+	}
+	if (!pImg->pOverlay)
+	{
+		Log_Printf(LOG_ERROR, "ERROR: cannot open HD overlay %s!\n", pszFileName);
+		return false;
+	}
+	if (!File_Lock(pImg->pOverlay))
+	{
+		Log_Printf(LOG_ERROR, "ERROR: cannot lock HD overlay %s for writing!\n", pszFileName);
+		fclose(pImg->pOverlay);
+		pImg->pOverlay = NULL;
+		return false;
+	}
+
+	if (!HdImage_OvlResize(pImg, OVERLAY_MIN_HASH))
+		return false;
+
+	/* a partial last record (e.g. lost on a crash) is ignored, and overwritten */
+	while (fread(record, sizeof(record), 1, pImg->pOverlay) == 1)
+	{
+		nSector = HdImage_GetU64(record);
+		if (nSector >= pImg->nSectors || !HdImage_OvlAdd(pImg, nSector))
+		{
+			/* closed by the caller */
+			Log_Printf(LOG_ERROR, "ERROR: HD overlay %s is corrupted!\n", pszFileName);
+			return false;
+		}
+	}
+	Log_Printf(LOG_INFO, "Using HD overlay %s (%d modified sectors)\n",
+	           pszFileName, pImg->nOvlCount);
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Replace the overlaid sectors of the read ones. Return the number of
+ * sectors still valid.
+ */
+static int HdImage_OvlRead(HD_IMAGE *pImg, Uint64 nSector, Uint8 *pBuf, int nCount)
+{
+	Uint32 nSlot;
+	int i;
+
+	for (i = 0; i < nCount; i++)
+	{
+		nSlot = HdImage_OvlSlot(pImg, nSector + i);
+		if (!pImg->pOvlSectors[nSlot])
+			continue;
+		if (fseeko(pImg->pOverlay, OVERLAY_HEADER + 8 + (off_t)pImg->pOvlRecords[nSlot] * OVERLAY_RECORD, SEEK_SET) != 0
+		    || fread(pBuf + i * HDIMAGE_SECTOR_SIZE, HDIMAGE_SECTOR_SIZE, 1, pImg->pOverlay) != 1)
+			return i;
+	}
+	return nCount;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Write the sectors to the overlay. Return the number of sectors written.
+ */
+static int HdImage_OvlWrite(HD_IMAGE *pImg, Uint64 nSector, const Uint8 *pBuf, int nCount)
+{
+	Uint8 head[8];
+	Uint32 nSlot, nRecord;
+	bool bNew;
+	int i;
+
+	for (i = 0; i < nCount; i++)
+	{
+		nSlot = HdImage_OvlSlot(pImg, nSector + i);
+		bNew = !pImg->pOvlSectors[nSlot];
+		nRecord = bNew ? pImg->nOvlCount : pImg->pOvlRecords[nSlot];
+
+		HdImage_PutU64(head, nSector + i);
+		if (fseeko(pImg->pOverlay, OVERLAY_HEADER + (off_t)nRecord * OVERLAY_RECORD, SEEK_SET) != 0
+		    || fwrite(head, sizeof(head), 1, pImg->pOverlay) != 1
+		    || fwrite(pBuf + i * HDIMAGE_SECTOR_SIZE, HDIMAGE_SECTOR_SIZE, 1, pImg->pOverlay) != 1
+		    || (bNew && !HdImage_OvlAdd(pImg, nSector + i)))
+			return i;
+	}
+	return nCount;
+}
+
+
+#if HAVE_MMAP
+/*-----------------------------------------------------------------------*/
+/**
+ * Map the opened image, return false if that's not possible.
+ */
+static bool HdImage_Map(HD_IMAGE *pImg)
+{
+	size_t nLen = pImg->nSectors * HDIMAGE_SECTOR_SIZE;
+	void *pMap;
+
+	/* Doesn't fit into the address space? */
+	if (nLen / HDIMAGE_SECTOR_SIZE != pImg->nSectors)
+		return false;
+
+	pMap = mmap(NULL, nLen, PROT_READ | (pImg->bReadOnly || pImg->pOverlay ? 0 : PROT_WRITE),
+	            MAP_SHARED, fileno(pImg->fp), 0);
+	if (pMap == MAP_FAILED)
+		return false;
+
+	pImg->pMap = pMap;
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Ask the host to page in the next part of the image when it's read
+ * sequentially.
+ */
+static void HdImage_ReadAhead(HD_IMAGE *pImg, Uint64 nSector, int nCount)
+{
+	static size_t nPageMask;
+	bool bSequential = (nSector == pImg->nNextSector);
+	size_t nPos, nStart, nEnd;
+
+	pImg->nNextSector = nSector + nCount;
+	if (!bSequential)
+	{
+		pImg->nReadAhead = 0;
+		return;
+	}
+
+	/* still half a window requested ahead? */
+	nPos = pImg->nNextSector * HDIMAGE_SECTOR_SIZE;
+	if (nPos + HDIMAGE_READAHEAD / 2 <= pImg->nReadAhead)
+		return;
+
+	if (!nPageMask)
+		nPageMask = sysconf(_SC_PAGESIZE) - 1;
+
+	nStart = nPos > pImg->nReadAhead ? nPos : pImg->nReadAhead;
+	nStart &= ~nPageMask;
+	nEnd = nPos + HDIMAGE_READAHEAD;
+	if (nEnd > pImg->nSectors * HDIMAGE_SECTOR_SIZE)
+		nEnd = pImg->nSectors * HDIMAGE_SECTOR_SIZE;
+	if (nStart >= nEnd)
+		return;
+
+	madvise(pImg->pMap + nStart, nEnd - nStart, MADV_WILLNEED);
+	pImg->nReadAhead = nEnd;
+}
+#endif
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Wait until the host has done the submitted transfer (if any).
+ */
+static void HdImage_Wait(HD_IMAGE *pImg)
+{
+#if HDIMAGE_THREAD
+	if (pImg->nAsyncState != HDIMAGE_ASYNC_QUEUED)
+		return;
+	pthread_mutex_lock(&Mutex);
+	if (pImg->nAsyncState == HDIMAGE_ASYNC_QUEUED)
+		nWaits++;
+	while (pImg->nAsyncState == HDIMAGE_ASYNC_QUEUED)
+		pthread_cond_wait(&DoneCond, &Mutex);
+	pthread_mutex_unlock(&Mutex);
+#endif
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Do the submitted transfer.
+ */
+static void HdImage_Transfer(HD_IMAGE *pImg)
+{
+	if (pImg->bAsyncWrite)
+		pImg->nAsyncCount = HdImage_Write(pImg, pImg->nAsyncSector, pImg->pAsyncBuf, pImg->nAsyncCount);
+	else
+		pImg->nAsyncCount = HdImage_Read(pImg, pImg->nAsyncSector, pImg->pAsyncBuf, pImg->nAsyncCount);
+}
+
+
+#if HDIMAGE_THREAD
+/*-----------------------------------------------------------------------*/
+/**
+ * Host thread doing the submitted transfers in order.
+ */
+static void *HdImage_Thread(void *pArg)
+{
+	HD_IMAGE *pImg;
+
+	pthread_mutex_lock(&Mutex);
+	for (;;)
+	{
+		while (!nQueued && !bThreadQuit)
+			pthread_cond_wait(&WorkCond, &Mutex);
+		if (!nQueued)
+			break;
+		pImg = Queue[nQueueHead];
+		nQueueHead = (nQueueHead + 1) % HDIMAGE_QUEUE;
+		nQueued--;
+		pthread_mutex_unlock(&Mutex);
+
+		HdImage_Transfer(pImg);
+
+		pthread_mutex_lock(&Mutex);
+		pImg->nAsyncState = HDIMAGE_ASYNC_DONE;
+		pthread_cond_broadcast(&DoneCond);
+	}
+	pthread_mutex_unlock(&Mutex);
+	return NULL;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Start the transfer thread (when the first image is opened), if possible.
+ */
+static void HdImage_StartThread(void)
+{
+	bThreadQuit = false;
+	nTransfers = nWaits = 0;
+	bThreadRunning = (pthread_create(&Thread, NULL, HdImage_Thread, NULL) == 0);
+	if (!bThreadRunning)
+		Log_Printf(LOG_WARN, "HD image transfers are done synchronously.\n");
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Stop the transfer thread (when the last image is closed).
+ */
+static void HdImage_StopThread(void)
+{
+	if (!bThreadRunning)
+		return;
+	pthread_mutex_lock(&Mutex);
+	bThreadQuit = true;
+	pthread_cond_signal(&WorkCond);
+	pthread_mutex_unlock(&Mutex);
+	pthread_join(Thread, NULL);
+	bThreadRunning = false;
+	Log_Printf(LOG_DEBUG, "HD image transfers: %d, waited for the host: %d\n",
+	           nTransfers, nWaits);
+}
+#endif
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Open given image file for reading and writing, or just for reading if
+ * that's allowed and the file is read-only. With an overlay directory
+ * configured, the writes go instead to the pszOverlayName overlay file
+ * in it. Return false on error.
+ */
+bool HdImage_Open(HD_IMAGE *pImg, const char *pszFileName, bool bAllowReadOnly,
+                  const char *pszOverlayName)
+{
+	char *pszOverlay;
+	off_t nSize;
+	bool bOk;
+
+	memset(pImg, 0, sizeof(*pImg));
+
+	/* a partial last sector is ignored */
+	nSize = File_Length(pszFileName);
+	if (nSize < HDIMAGE_SECTOR_SIZE)
+	{
+		Log_Printf(LOG_ERROR, "ERROR: HD file has strange size!\n");
+		return false;
+	}
+	pImg->nSectors = nSize / HDIMAGE_SECTOR_SIZE;
+
+	if (pszOverlayName && ConfigureParams.HardDisk.szOverlayDir[0])
+	{
+		/* the image is shared, open it read-only */
+		pImg->fp = fopen(pszFileName, "rb");
+		if (pImg->fp == NULL)
+		{
+			Log_Printf(LOG_ERROR, "ERROR: cannot open HD file!\n");
+			return false;
+		}
+		pszOverlay = File_MakePath(ConfigureParams.HardDisk.szOverlayDir, pszOverlayName, "cow");
+		bOk = pszOverlay && HdImage_OpenOverlay(pImg, pszOverlay);
+		free(pszOverlay);
+		if (!bOk)
+		{
+			HdImage_Release(pImg);
+			return false;
+		}
+#if HAVE_MMAP
+		HdImage_Map(pImg);
+#endif
+		goto opened;
+	}
+
+	pImg->fp = fopen(pszFileName, "rb+");
+	if (pImg->fp == NULL && bAllowReadOnly)
+	{
+		/* Maybe the file is read-only? */
+		pImg->fp = fopen(pszFileName, "rb");
+		pImg->bReadOnly = true;
+	}
+	if (pImg->fp == NULL)
+	{
+		Log_Printf(LOG_ERROR, "ERROR: cannot open HD file!\n");
+		return false;
+	}
+	if (!pImg->bReadOnly && !File_Lock(pImg->fp))
+	{
+		Log_Printf(LOG_ERROR, "ERROR: cannot lock HD file for writing!\n");
+		fclose(pImg->fp);
+		pImg->fp = NULL;
+		return false;
+	}
+
+#if HAVE_MMAP
+	if (!HdImage_Map(pImg))
+		Log_Printf(LOG_DEBUG, "HD image %s is not memory mapped\n", pszFileName);
+#endif
+opened:
+#if HDIMAGE_THREAD
+	if (nOpenImages == 0)
+		HdImage_StartThread();
+#endif
+	nOpenImages++;
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Close the image files and free its resources.
+ */
+static void HdImage_Release(HD_IMAGE *pImg)
+{
+#if HAVE_MMAP
+	if (pImg->pMap)
+		munmap(pImg->pMap, pImg->nSectors * HDIMAGE_SECTOR_SIZE);
+#endif
+	if (pImg->pOverlay)
+	{
+		File_UnLock(pImg->pOverlay);
+		fclose(pImg->pOverlay);
+		free(pImg->pOvlSectors);
+		free(pImg->pOvlRecords);
+	}
+	else if (!pImg->bReadOnly)
+		File_UnLock(pImg->fp);
+	fclose(pImg->fp);
+	memset(pImg, 0, sizeof(*pImg));
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Close the image (if it's open).
+ */
+void HdImage_Close(HD_IMAGE *pImg)
+{
+	if (!pImg->fp)
+		return;
+	HdImage_Wait(pImg);
+	HdImage_Release(pImg);
+
+#if HDIMAGE_THREAD
+	if (nOpenImages == 1)
+		HdImage_StopThread();
+#endif
+	nOpenImages--;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Read nCount sectors starting from nSector to pBuf.
+ * Return the number of sectors read.
+ */
+int HdImage_Read(HD_IMAGE *pImg, Uint64 nSector, Uint8 *pBuf, int nCount)
+{
+	if (!pImg->fp || nSector >= pImg->nSectors)
+		return 0;
+	if (nCount > pImg->nSectors - nSector)
+		nCount = pImg->nSectors - nSector;
+
+#if HAVE_MMAP
+	if (pImg->pMap)
+	{
+		memcpy(pBuf, pImg->pMap + nSector * HDIMAGE_SECTOR_SIZE,
+		       nCount * HDIMAGE_SECTOR_SIZE);
+		HdImage_ReadAhead(pImg, nSector, nCount);
+	}
+	else
+#endif
+	{
+		if (fseeko(pImg->fp, (off_t)nSector * HDIMAGE_SECTOR_SIZE, SEEK_SET) != 0)
+			return 0;
+		nCount = fread(pBuf, HDIMAGE_SECTOR_SIZE, nCount, pImg->fp);
+	}
+
+	if (pImg->nOvlCount)
+		return HdImage_OvlRead(pImg, nSector, pBuf, nCount);
+	return nCount;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Write nCount sectors from pBuf starting at nSector.
+ * Return the number of sectors written.
+ */
+int HdImage_Write(HD_IMAGE *pImg, Uint64 nSector, const Uint8 *pBuf, int nCount)
+{
+	if (!pImg->fp || pImg->bReadOnly || nSector >= pImg->nSectors)
+		return 0;
+	if (nCount > pImg->nSectors - nSector)
+		nCount = pImg->nSectors - nSector;
+
+	if (pImg->pOverlay)
+		return HdImage_OvlWrite(pImg, nSector, pBuf, nCount);
+#if HAVE_MMAP
+	if (pImg->pMap)
+	{
+		memcpy(pImg->pMap + nSector * HDIMAGE_SECTOR_SIZE, pBuf,
+		       nCount * HDIMAGE_SECTOR_SIZE);
+		return nCount;
+	}
+#endif
+	if (fseeko(pImg->fp, (off_t)nSector * HDIMAGE_SECTOR_SIZE, SEEK_SET) != 0)
+		return 0;
+	return fwrite(pBuf, HDIMAGE_SECTOR_SIZE, nCount, pImg->fp);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Hand the written sectors over to the host.
+ */
+void HdImage_Flush(HD_IMAGE *pImg)
+{
+	if (!pImg->fp || pImg->bReadOnly)
+		return;
+	HdImage_Wait(pImg);
+	if (pImg->pOverlay)
+	{
+		fflush(pImg->pOverlay);
+		return;
+	}
+#if HAVE_MMAP
+	if (pImg->pMap)
+	{
+		msync(pImg->pMap, pImg->nSectors * HDIMAGE_SECTOR_SIZE, MS_ASYNC);
+		return;
+	}
+#endif
+	fflush(pImg->fp);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Start transferring nCount sectors between pBuf and the image at nSector
+ * in the background. pBuf has to stay valid until HdImage_Complete().
+ * Without threads, the transfer is done right away.
+ */
+void HdImage_Submit(HD_IMAGE *pImg, bool bWrite, Uint64 nSector, Uint8 *pBuf, int nCount)
+{
+	/* previous transfer not picked up? */
+	HdImage_Complete(pImg);
+
+	pImg->bAsyncWrite = bWrite;
+	pImg->nAsyncSector = nSector;
+	pImg->pAsyncBuf = pBuf;
+	pImg->nAsyncCount = nCount;
+
+#if HDIMAGE_THREAD
+	if (bThreadRunning)
+	{
+		pthread_mutex_lock(&Mutex);
+		assert(nQueued < HDIMAGE_QUEUE);
+		pImg->nAsyncState = HDIMAGE_ASYNC_QUEUED;
+		Queue[(nQueueHead + nQueued) % HDIMAGE_QUEUE] = pImg;
+		nQueued++;
+		nTransfers++;
+		pthread_cond_signal(&WorkCond);
+		pthread_mutex_unlock(&Mutex);
+		return;
+	}
+#endif
+	HdImage_Transfer(pImg);
+	pImg->nAsyncState = HDIMAGE_ASYNC_DONE;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Wait for the submitted transfer to finish, if the host hasn't done it
+ * yet. Return the number of sectors transferred.
+ */
+int HdImage_Complete(HD_IMAGE *pImg)
+{
+	if (pImg->nAsyncState == HDIMAGE_ASYNC_IDLE)
+		return 0;
+	HdImage_Wait(pImg);
+	pImg->nAsyncState = HDIMAGE_ASYNC_IDLE;
+	return pImg->nAsyncCount;
+}
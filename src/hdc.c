@@ -10,6 +10,7 @@ const char HDC_fileid[] = "Hatari hdc.c : " __DATE__ " " __TIME__;
 
 #include "main.h"
 #include "configuration.h"
+#include "cycInt.h"
 #include "debugui.h"
 #include "file.h"
 #include "fdc.h"
@@ -20,6 +21,7 @@ const char HDC_fileid[] = "Hatari hdc.c : " __DATE__ " " __TIME__;
 #include "mfp.h"
 #include "stMemory.h"
 #include "tos.h"
+#include "m68000.h"
 #include "statusbar.h"
 
 
@@ -32,9 +34,10 @@ const char HDC_fileid[] = "Hatari hdc.c : " __DATE__ " " __TIME__;
   operation interrupts the current operation. The DRQ status can
   be polled non-destructively in GPIP.
 
-  (For simplicity, the operation is finished immediately,
-  this is a potential bug, but I doubt it is significant,
-  we just appear to have a very fast hard drive.)
+  Sector reads and writes are done by the host in the background,
+  and they complete (with the DMA transfer and the interrupt) when
+  the emulated drive would have finished them. The other commands
+  are finished immediately.
 
   The ACSI command set is a subset of the SCSI standard.
   (for details, see the X3T9.2 SCSI draft documents
@@ -54,7 +57,7 @@ const char HDC_fileid[] = "Hatari hdc.c : " __DATE__ " " __TIME__;
  */
 typedef struct {
 	bool enabled;
-	FILE *image_file;
+	HD_IMAGE image;
 	Uint32 nLastBlockAddr;      /* The specified sector number */
 	bool bSetLastBlockAddr;
 	Uint8 nLastError;
@@ -79,6 +82,21 @@ SCSI_CTRLR AcsiBus;
 int nAcsiPartitions = 0;
 bool bAcsiEmuOn = false;
 
+/* Emulated drive timing, in 8 MHz CPU cycles: command overhead (1 ms)
+ * and transfer of one sector at the ACSI DMA rate (of ~1 MB/s) */
+#define HDC_COMMAND_CYCLES	8000
+#define HDC_SECTOR_CYCLES	4096
+
+/* Sector transfer done by the host in the background */
+static struct {
+	SCSI_DEV *dev;			/* NULL if there's none */
+	bool bWrite;
+	Uint32 nDmaAddr;
+	int nCount;
+	Uint8 *pBuffer;
+	int nBufferSize;
+} HdcTransfer;
+
 
 /* Our dummy INQUIRY response data */
 static unsigned char inquiry_bytes[] =
@@ -168,8 +186,7 @@ static void HDC_Cmd_Seek(SCSI_CTRLR *ctr)
 	LOG_TRACE(TRACE_SCSI_CMD, "HDC: SEEK (%s), LBA=%i",
 	          HDC_CmdInfoStr(ctr), dev->nLastBlockAddr);
 
-	if (dev->nLastBlockAddr < dev->hdSize &&
-	    fseeko(dev->image_file, (off_t)dev->nLastBlockAddr * 512L, SEEK_SET) == 0)
+	if (dev->nLastBlockAddr < dev->hdSize)
 	{
 		LOG_TRACE(TRACE_SCSI_CMD, " -> OK\n");
 		ctr->returnCode = HD_STATUS_OK;
@@ -364,6 +381,7 @@ static void HDC_Cmd_ModeSense(SCSI_CTRLR *ctr)
 		STRam[nDmaAddr+13] = 0;
 		STRam[nDmaAddr+14] = 0;
 		STRam[nDmaAddr+15] = 0;
+		STMemory_MarkDirty(nDmaAddr, 16);
 
 		FDC_WriteDMAAddress(nDmaAddr + 16);
 
@@ -413,6 +431,7 @@ static void HDC_Cmd_ReadCapacity(SCSI_CTRLR *ctr)
 	if (STMemory_ValidArea(nDmaAddr, 8))
 	{
 		int nSectors = dev->hdSize - 1;
+		STMemory_MarkDirty(nDmaAddr, 8);
 		STRam[nDmaAddr++] = (nSectors >> 24) & 0xFF;
 		STRam[nDmaAddr++] = (nSectors >> 16) & 0xFF;
 		STRam[nDmaAddr++] = (nSectors >> 8) & 0xFF;
@@ -440,6 +459,160 @@ static void HDC_Cmd_ReadCapacity(SCSI_CTRLR *ctr)
 }
 
 
+/**
+ * Start the transfer of the command's sectors between the disk and ST RAM
+ * at nDmaAddr. The host does it in the background, the command completes
+ * in HDC_InterruptHandler(), when the emulated drive would have finished.
+ * Return false if the transfer can't be started.
+ */
+static bool HDC_StartTransfer(SCSI_CTRLR *ctr, bool bWrite, Uint32 nDmaAddr)
+{
+	SCSI_DEV *dev = &ctr->devs[ctr->target];
+	int nCount = HDC_GetCount(ctr);
+	Uint8 *pBuffer;
+
+	/* stale transfer of a reset machine? */
+	HDC_CancelTransfer();
+
+	if (512 * nCount > HdcTransfer.nBufferSize)
+	{
+		pBuffer = realloc(HdcTransfer.pBuffer, 512 * nCount);
+		if (!pBuffer)
+			return false;
+		HdcTransfer.pBuffer = pBuffer;
+		HdcTransfer.nBufferSize = 512 * nCount;
+	}
+	if (bWrite)
+		memcpy(HdcTransfer.pBuffer, &STRam[nDmaAddr], 512 * nCount);
+
+	HdImage_Submit(&dev->image, bWrite, dev->nLastBlockAddr, HdcTransfer.pBuffer, nCount);
+	HdcTransfer.dev = dev;
+	HdcTransfer.bWrite = bWrite;
+	HdcTransfer.nDmaAddr = nDmaAddr;
+	HdcTransfer.nCount = nCount;
+
+	CycInt_AddRelativeInterrupt((HDC_COMMAND_CYCLES + nCount * HDC_SECTOR_CYCLES) << nCpuFreqShift,
+	                            INT_CPU_CYCLE, INTERRUPT_HDC);
+	LOG_TRACE(TRACE_SCSI_CMD, " -> started\n");
+	return true;
+}
+
+
+/**
+ * Pick up the result of the sector transfer from the host (waiting for it
+ * if needed), do the DMA, set the command status and interrupt.
+ */
+static void HDC_FinishTransfer(SCSI_CTRLR *ctr)
+{
+	SCSI_DEV *dev = HdcTransfer.dev;
+	Uint32 nDmaAddr = HdcTransfer.nDmaAddr;
+	int n;
+
+	HdcTransfer.dev = NULL;
+	n = HdImage_Complete(&dev->image);
+	if (!HdcTransfer.bWrite)
+	{
+		memcpy(&STRam[nDmaAddr], HdcTransfer.pBuffer, 512 * n);
+		STMemory_MarkDirty(nDmaAddr, 512 * n);
+	}
+
+	if (n == HdcTransfer.nCount)
+	{
+		ctr->returnCode = HD_STATUS_OK;
+		dev->nLastError = HD_REQSENS_OK;
+	}
+	else
+	{
+		ctr->returnCode = HD_STATUS_ERROR;
+		dev->nLastError = HdcTransfer.bWrite ? HD_REQSENS_WRITEERR : HD_REQSENS_NOSECTOR;
+	}
+
+	/* Update DMA counter */
+	FDC_WriteDMAAddress(nDmaAddr + 512*n);
+
+	LOG_TRACE(TRACE_SCSI_CMD, "HDC: %s SECTOR of LBA 0x%x -> %s (%d)\n",
+		  HdcTransfer.bWrite ? "WRITE" : "READ", dev->nLastBlockAddr,
+		  ctr->returnCode == HD_STATUS_OK ? "OK" : "ERROR",
+		  dev->nLastError);
+
+	FDC_SetDMAStatus(ctr->bDmaError);
+	FDC_SetIRQ(FDC_IRQ_SOURCE_HDC);
+}
+
+
+/**
+ * Drop the sector transfer in progress (if any), without completing
+ * the command.
+ */
+void HDC_CancelTransfer(void)
+{
+	if (!HdcTransfer.dev)
+		return;
+	HdImage_Complete(&HdcTransfer.dev->image);
+	HdcTransfer.dev = NULL;
+	CycInt_RemovePendingInterrupt(INTERRUPT_HDC);
+}
+
+
+/**
+ * The emulated drive has finished the sector transfer.
+ */
+void HDC_InterruptHandler(void)
+{
+	CycInt_AcknowledgeInterrupt();
+	if (HdcTransfer.dev)
+		HDC_FinishTransfer(&AcsiBus);
+}
+
+
+/**
+ * Save/Restore snapshot of the sector transfer in progress. Its end is
+ * in the cycle interrupt table, the host part is submitted again when
+ * restoring: reads read the image again, writes use the saved data.
+ */
+void HDC_MemorySnapShot_Capture(bool bSave)
+{
+	SCSI_DEV *dev;
+	Uint8 *pBuffer;
+	int nTarget = -1;
+
+	if (bSave && HdcTransfer.dev)
+		nTarget = HdcTransfer.dev - AcsiBus.devs;
+	MemorySnapShot_Store(&nTarget, sizeof(nTarget));
+	if (nTarget < 0)
+		return;
+
+	/* restoring: the transfer of the running emulation was dropped */
+	dev = &AcsiBus.devs[nTarget & 7];
+	MemorySnapShot_Store(&dev->nLastBlockAddr, sizeof(dev->nLastBlockAddr));
+	MemorySnapShot_Store(&HdcTransfer.bWrite, sizeof(HdcTransfer.bWrite));
+	MemorySnapShot_Store(&HdcTransfer.nDmaAddr, sizeof(HdcTransfer.nDmaAddr));
+	MemorySnapShot_Store(&HdcTransfer.nCount, sizeof(HdcTransfer.nCount));
+
+	if (!bSave && 512 * HdcTransfer.nCount > HdcTransfer.nBufferSize)
+	{
+		pBuffer = realloc(HdcTransfer.pBuffer, 512 * HdcTransfer.nCount);
+		if (!pBuffer)
+		{
+			if (HdcTransfer.bWrite)
+				MemorySnapShot_Skip(512 * HdcTransfer.nCount);
+			return;
+		}
+		HdcTransfer.pBuffer = pBuffer;
+		HdcTransfer.nBufferSize = 512 * HdcTransfer.nCount;
+	}
+	if (HdcTransfer.bWrite)
+		MemorySnapShot_Store(HdcTransfer.pBuffer, 512 * HdcTransfer.nCount);
+
+	if (!bSave && dev->enabled)
+	{
+		HdImage_Submit(&dev->image, HdcTransfer.bWrite, dev->nLastBlockAddr,
+		               HdcTransfer.pBuffer, HdcTransfer.nCount);
+		HdcTransfer.dev = dev;
+	}
+}
+
+
 /**
  * Write a sector off our disk - (seek implied)
  */
@@ -454,9 +627,7 @@ static void HDC_Cmd_WriteSector(SCSI_CTRLR *ctr)
 	LOG_TRACE(TRACE_SCSI_CMD, "HDC: WRITE SECTOR (%s) with LBA 0x%x from 0x%x",
 	          HDC_CmdInfoStr(ctr), dev->nLastBlockAddr, nDmaAddr);
 
-	/* seek to the position */
-	if (dev->nLastBlockAddr >= dev->hdSize ||
-	    fseeko(dev->image_file, (off_t)dev->nLastBlockAddr * 512L, SEEK_SET) != 0)
+	if (dev->nLastBlockAddr >= dev->hdSize)
 	{
 		ctr->returnCode = HD_STATUS_ERROR;
 		dev->nLastError = HD_REQSENS_INVADDR;
@@ -467,8 +638,9 @@ static void HDC_Cmd_WriteSector(SCSI_CTRLR *ctr)
 #ifndef DISALLOW_HDC_WRITE
 		if (STMemory_ValidArea(nDmaAddr, 512 * HDC_GetCount(ctr)))
 		{
-			n = fwrite(&STRam[nDmaAddr], 512,
-				   HDC_GetCount(ctr), dev->image_file);
+			dev->bSetLastBlockAddr = true;
+			if (HDC_StartTransfer(ctr, true, nDmaAddr))
+				return;
 		}
 		else
 		{
@@ -513,26 +685,25 @@ static void HDC_Cmd_ReadSector(SCSI_CTRLR *ctr)
 	LOG_TRACE(TRACE_SCSI_CMD, "HDC: READ SECTOR (%s) with LBA 0x%x to 0x%x",
 	          HDC_CmdInfoStr(ctr), dev->nLastBlockAddr, nDmaAddr);
 
-	/* seek to the position */
-	if (dev->nLastBlockAddr >= dev->hdSize ||
-	    fseeko(dev->image_file, (off_t)dev->nLastBlockAddr * 512L, SEEK_SET) != 0)
+	if (dev->nLastBlockAddr >= dev->hdSize)
 	{
 		ctr->returnCode = HD_STATUS_ERROR;
 		dev->nLastError = HD_REQSENS_INVADDR;
 	}
 	else
 	{
+		n = 0;
 		if (STMemory_ValidArea(nDmaAddr, 512 * HDC_GetCount(ctr)))
 		{
-			n = fread(&STRam[nDmaAddr], 512,
-				   HDC_GetCount(ctr), dev->image_file);
+			dev->bSetLastBlockAddr = true;
+			if (HDC_StartTransfer(ctr, false, nDmaAddr))
+				return;
 		}
 		else
 		{
 			Log_Printf(LOG_WARN, "HDC sector read uses invalid RAM range 0x%x+%i\n",
 				   nDmaAddr, 512 * HDC_GetCount(ctr));
 			ctr->bDmaError = true;
-			n = 0;
 		}
 		if (n == HDC_GetCount(ctr))
 		{
@@ -657,19 +828,16 @@ static void HDC_EmulateCommandPacket(SCSI_CTRLR *ctr)
  *   http://lxr.free-electrons.com/source/block/partitions/atari.c
  * - Support partition tables with other endianess
  */
-int HDC_PartitionCount(FILE *fp, const Uint64 tracelevel)
+int HDC_PartitionCount(HD_IMAGE *pImg, const Uint64 tracelevel)
 {
 	unsigned char *pinfo, bootsector[512];
 	Uint32 start, sectors, total = 0;
 	int i, parts = 0;
-	long offset;
 
-	if (!fp)
+	if (!pImg->fp)
 		return 0;
-	offset = ftell(fp);
 
-	fseek(fp, 0, SEEK_SET);
-	if (fread(bootsector, sizeof(bootsector), 1, fp) != 1)
+	if (HdImage_Read(pImg, 0, bootsector, 1) != 1)
 	{
 		perror("HDC_PartitionCount");
 		return 0;
@@ -731,7 +899,6 @@ int HDC_PartitionCount(FILE *fp, const Uint64 tracelevel)
 		LOG_TRACE(tracelevel, "- Total size: %i MB in %d partitions\n", total/2048, parts);
 	}
 
-	fseek(fp, offset, SEEK_SET);
 	return parts;
 }
 
@@ -741,7 +908,6 @@ int HDC_PartitionCount(FILE *fp, const Uint64 tracelevel)
  */
 bool HDC_Init(void)
 {
-	off_t filesize;
 	int i;
 
 	memset(&AcsiBus, 0, sizeof(AcsiBus));
@@ -750,8 +916,7 @@ bool HDC_Init(void)
 
 	for (i = 0; i < MAX_ACSI_DEVS; i++)
 	{
-		char *filename;
-		FILE *fp;
+		char *filename, ovlname[8];
 
 		if (!ConfigureParams.Acsi[i].bUseDevice)
 			continue;
@@ -759,27 +924,16 @@ bool HDC_Init(void)
 		Log_Printf(LOG_INFO, "Mounting ACSI hard drive image %s\n", filename);
 
 		/* Check size for sanity - is the length a multiple of 512? */
-		filesize = File_Length(filename);
-		if (filesize <= 0 || (filesize & 0x1ff) != 0)
+		if ((File_Length(filename) & 0x1ff) != 0)
 		{
 			Log_Printf(LOG_ERROR, "ERROR: HD file has strange size!\n");
 			continue;
 		}
-
-		fp = fopen(filename, "rb+");
-		if (fp == NULL)
-		{
-			Log_Printf(LOG_ERROR, "ERROR: cannot open HD file!\n");
-			continue;
-		}
-		if (!File_Lock(fp))
-		{
-			Log_Printf(LOG_ERROR, "ERROR: cannot lock HD file for writing!\n");
+		snprintf(ovlname, sizeof(ovlname), "acsi%d", i);
+		if (!HdImage_Open(&AcsiBus.devs[i].image, filename, false, ovlname))
 			continue;
-		}
-		nAcsiPartitions += HDC_PartitionCount(fp, TRACE_SCSI_CMD);
-		AcsiBus.devs[i].hdSize = filesize / 512;
-		AcsiBus.devs[i].image_file = fp;
+		nAcsiPartitions += HDC_PartitionCount(&AcsiBus.devs[i].image, TRACE_SCSI_CMD);
+		AcsiBus.devs[i].hdSize = AcsiBus.devs[i].image.nSectors;
 		AcsiBus.devs[i].enabled = true;
 		bAcsiEmuOn = true;
 	}
@@ -803,13 +957,16 @@ void HDC_UnInit(void)
 	if (!bAcsiEmuOn)
 		return;
 
+	HDC_CancelTransfer();
+	free(HdcTransfer.pBuffer);
+	HdcTransfer.pBuffer = NULL;
+	HdcTransfer.nBufferSize = 0;
+
 	for (i = 0; i < MAX_ACSI_DEVS; i++)
 	{
 		if (!AcsiBus.devs[i].enabled)
 			continue;
-		File_UnLock(AcsiBus.devs[i].image_file);
-		fclose(AcsiBus.devs[i].image_file);
-		AcsiBus.devs[i].image_file = NULL;
+		HdImage_Close(&AcsiBus.devs[i].image);
 		AcsiBus.devs[i].enabled = false;
 	}
 
@@ -1018,6 +1175,10 @@ static void Acsi_WriteCommandByte(int addr, Uint8 byte)
 		HDC_WriteCommandPacket(&AcsiBus, byte);
 	}
 
+	/* Sector transfer interrupts when it completes */
+	if (HdcTransfer.dev)
+		return;
+
 	if (AcsiBus.devs[AcsiBus.target].enabled)
 	{
 		FDC_SetDMAStatus(AcsiBus.bDmaError);	/* Mark DMA error */
@@ -16,10 +16,12 @@
 
 #include "main.h"
 #include "configuration.h"
+#include "cycInt.h"
 #include "file.h"
 #include "ide.h"
 #include "hdc.h" /* for partition counting */
 #include "m68000.h"
+#include "memorySnapShot.h"
 #include "mfp.h"
 #include "stMemory.h"
 #include "sysdeps.h"
@@ -316,7 +318,7 @@ struct BlockDriverState {
     void (*change_cb)(void *opaque);
     void *change_opaque;
 
-    FILE *fhndl;
+    HD_IMAGE image;
     void *opaque;
 
     char filename[1024];
@@ -403,14 +405,7 @@ static void *qemu_memalign(size_t alignment, size_t size)
  */
 static void bdrv_get_geometry(BlockDriverState *bs, uint64_t *nb_sectors_ptr)
 {
-	int64_t length;
-	length = File_Length(bs->filename);
-
-	if (length < 0)
-		length = 0;
-	else
-		length = length >> SECTOR_BITS;
-	*nb_sectors_ptr = length;
+	*nb_sectors_ptr = bs->image.nSectors;
 }
 
 static void bdrv_get_geometry_hint(BlockDriverState *bs,
@@ -458,7 +453,7 @@ static void bdrv_set_change_cb(BlockDriverState *bs,
  */
 static int bdrv_is_inserted(BlockDriverState *bs)
 {
-	return (bs->fhndl != NULL);
+	return (bs->image.fp != NULL);
 }
 
 
@@ -477,90 +472,82 @@ static void bdrv_set_locked(BlockDriverState *bs, int locked)
 }
 
 
-/* return < 0 if error. See bdrv_write() for the return codes */
+/* return < 0 if error. See bdrv_complete() for the return codes */
 static int bdrv_read(BlockDriverState *bs, int64_t sector_num,
                      uint8_t *buf, int nb_sectors)
 {
-	int ret, len;
+	int ret;
 
-	if (!bs->fhndl)
+	if (!bs->image.fp)
 		return -ENOMEDIUM;
 
-	len = nb_sectors * 512;
-
-	fseeko(bs->fhndl, sector_num*512, SEEK_SET);
-	ret = fread(buf, 1, len, bs->fhndl);
-	if (ret != len)
+	ret = HdImage_Read(&bs->image, sector_num, buf, nb_sectors);
+	if (ret != nb_sectors)
 	{
-		fprintf(stderr,"IDE: bdrv_read error (%d != %d length) at sector %lu!\n", ret, len, (unsigned long)sector_num);
+		fprintf(stderr,"IDE: bdrv_read error (%d != %d sectors) at sector %lu!\n", ret, nb_sectors, (unsigned long)sector_num);
 		return -EINVAL;
 	}
 	else
 	{
-		bs->rd_bytes += (unsigned) len;
+		bs->rd_bytes += (unsigned) nb_sectors * 512;
 		bs->rd_ops ++;
 		return 0;
 	}
 }
 
 
+/* Start reading or writing in the background, the result is returned
+ * by bdrv_complete(). buf has to stay valid until then. */
+static void bdrv_submit(BlockDriverState *bs, int is_write, int64_t sector_num,
+                        uint8_t *buf, int nb_sectors)
+{
+	HdImage_Submit(&bs->image, is_write, sector_num, buf, nb_sectors);
+}
+
 /* Return < 0 if error. Important errors are:
   -EIO         generic I/O error (may happen for all errors)
   -ENOMEDIUM   No media inserted.
   -EINVAL      Invalid sector number or nb_sectors
   -EACCES      Trying to write a read-only device
 */
-static int bdrv_write(BlockDriverState *bs, int64_t sector_num,
-                      const uint8_t *buf, int nb_sectors)
+static int bdrv_complete(BlockDriverState *bs, int is_write, int64_t sector_num,
+                         int nb_sectors)
 {
-	int ret, len;
+	int ret = HdImage_Complete(&bs->image);
 
-	if (!bs->fhndl)
+	if (!bs->image.fp)
 		return -ENOMEDIUM;
-	if (bs->read_only)
+	if (is_write && bs->read_only)
 		return -EACCES;
-
-	len = nb_sectors * 512;
-
-	fseeko(bs->fhndl, sector_num*512, SEEK_SET);
-	ret = fwrite(buf, 1, len, bs->fhndl);
-	if (ret != len)
+	if (ret != nb_sectors)
 	{
-		fprintf(stderr,"IDE: bdrv_write error (%d != %d length) at sector %lu!\n", ret, len,  (unsigned long)sector_num);
-		return -EIO;
+		fprintf(stderr,"IDE: bdrv_%s error (%d != %d sectors) at sector %lu!\n", is_write ? "write" : "read",
+		        ret, nb_sectors, (unsigned long)sector_num);
+		return is_write ? -EIO : -EINVAL;
 	}
-	else
+	if (is_write)
 	{
-		bs->wr_bytes += (unsigned) len;
+		bs->wr_bytes += (unsigned) nb_sectors * 512;
 		bs->wr_ops ++;
-		return 0;
 	}
+	else
+	{
+		bs->rd_bytes += (unsigned) nb_sectors * 512;
+		bs->rd_ops ++;
+	}
+	return 0;
 }
 
 
-static int bdrv_open(BlockDriverState *bs, const char *filename, int flags)
+/* ovlname is the name of the overlay file for the writes, if one is used */
+static int bdrv_open(BlockDriverState *bs, const char *filename, const char *ovlname, int flags)
 {
 	Log_Printf(LOG_INFO, "Mounting IDE hard drive image %s\n", filename);
 
 	strncpy(bs->filename, filename, sizeof(bs->filename));
 
-	bs->read_only = 0;
-
-	bs->fhndl = fopen(filename, "rb+");
-
-	if (!bs->fhndl) {
-		/* Maybe the file is read-only? */
-		bs->fhndl = fopen(filename, "rb");
-		if (!bs->fhndl)
-			perror("bdrv_open");
-		bs->read_only = 1;
-	}
-	else if (!File_Lock(bs->fhndl))
-	{
-		Log_Printf(LOG_ERROR, "ERROR: cannot lock HD file for writing!\n");
-		fclose(bs->fhndl);
-		bs->fhndl = NULL;
-	}
+	HdImage_Open(&bs->image, filename, true, ovlname);
+	bs->read_only = bs->image.bReadOnly;
 
 	/* call the change callback */
 	bs->media_changed = 1;
@@ -572,14 +559,12 @@ static int bdrv_open(BlockDriverState *bs, const char *filename, int flags)
 
 static void bdrv_flush(BlockDriverState *bs)
 {
-	fflush(bs->fhndl);
+	HdImage_Flush(&bs->image);
 }
 
 static void bdrv_close(BlockDriverState *bs)
 {
-	File_UnLock(bs->fhndl);
-	fclose(bs->fhndl);
-	bs->fhndl = NULL;
+	HdImage_Close(&bs->image);
 }
 
 /**
@@ -911,8 +896,19 @@ typedef struct IDEState
 	uint8_t *data_end;
 	uint8_t *io_buffer;
 	int media_changed;
+	/* sector transfer done by the host in the background */
+	int async_write;
+	int64_t async_sector_num;
+	int async_n;
 } IDEState;
 
+/* Emulated drive timing, in 8 MHz CPU cycles: command overhead (250 us)
+ * and reading one sector from the media (at 8 MB/s) */
+#define IDE_COMMAND_CYCLES	2000
+#define IDE_SECTOR_CYCLES	512
+
+static IDEState *ide_async;	/* drive waiting for its sector transfer */
+
 
 static void padstr(char *str, const char *src, int len)
 {
@@ -1192,10 +1188,53 @@ static void ide_set_sector(IDEState *s, int64_t sector_num)
 	}
 }
 
+/*
+ * Let the host transfer the sectors in the background while the drive
+ * is busy, the command is finished by the IDE interrupt handler once the
+ * emulated drive would have transferred them.
+ */
+static void ide_sector_read(IDEState *s);
+static void ide_sector_write(IDEState *s);
+
+static void ide_async_start(IDEState *s, int is_write, int64_t sector_num, int n)
+{
+	if (ide_async)
+		Ide_CompleteTransfer();
+
+	bdrv_submit(s->bs, is_write, sector_num, s->io_buffer, n);
+	s->async_write = is_write;
+	s->async_sector_num = sector_num;
+	s->async_n = n;
+	ide_async = s;
+
+	ide_transfer_stop(s);
+	s->status = BUSY_STAT;
+	CycInt_AddRelativeInterrupt((IDE_COMMAND_CYCLES + n * IDE_SECTOR_CYCLES) << nCpuFreqShift,
+	                            INT_CPU_CYCLE, INTERRUPT_IDE);
+}
+
+static void ide_sector_read_done(IDEState *s, int ret)
+{
+	int64_t sector_num = s->async_sector_num;
+	int n = s->async_n;
+
+	s->status = READY_STAT | SEEK_STAT;
+	if (ret != 0)
+	{
+		ide_abort_command(s);
+		ide_set_irq(s);
+		return;
+	}
+	ide_transfer_start(s, s->io_buffer, 512 * n, ide_sector_read);
+	ide_set_irq(s);
+	ide_set_sector(s, sector_num + n);
+	s->nsector -= n;
+}
+
 static void ide_sector_read(IDEState *s)
 {
 	int64_t sector_num;
-	int ret, n;
+	int n;
 
 	s->status = READY_STAT | SEEK_STAT;
 	s->error = 0; /* not needed by IDE spec, but needed by Windows */
@@ -1212,34 +1251,18 @@ static void ide_sector_read(IDEState *s)
 
 		if (n > s->req_nb_sectors)
 			n = s->req_nb_sectors;
-		ret = bdrv_read(s->bs, sector_num, s->io_buffer, n);
-		if (ret != 0)
-		{
-			ide_abort_command(s);
-			ide_set_irq(s);
-			return;
-		}
-		ide_transfer_start(s, s->io_buffer, 512 * n, ide_sector_read);
-		ide_set_irq(s);
-		ide_set_sector(s, sector_num + n);
-		s->nsector -= n;
+		ide_async_start(s, 0, sector_num, n);
 	}
 }
 
 
-static void ide_sector_write(IDEState *s)
+static void ide_sector_write_done(IDEState *s, int ret)
 {
-	int64_t sector_num;
-	int ret, n, n1;
+	int64_t sector_num = s->async_sector_num;
+	int n = s->async_n;
+	int n1;
 
 	s->status = READY_STAT | SEEK_STAT;
-	sector_num = ide_get_sector(s);
-	LOG_TRACE(TRACE_IDE, "IDE: write sector=%"PRId64"\n", sector_num);
-
-	n = s->nsector;
-	if (n > s->req_nb_sectors)
-		n = s->req_nb_sectors;
-	ret = bdrv_write(s->bs, sector_num, s->io_buffer, n);
 	if (ret != 0)
 	{
 		ide_abort_command(s);
@@ -1264,6 +1287,113 @@ static void ide_sector_write(IDEState *s)
 	ide_set_irq(s);
 }
 
+static void ide_sector_write(IDEState *s)
+{
+	int64_t sector_num;
+	int n;
+
+	s->status = READY_STAT | SEEK_STAT;
+	sector_num = ide_get_sector(s);
+	LOG_TRACE(TRACE_IDE, "IDE: write sector=%"PRId64"\n", sector_num);
+
+	n = s->nsector;
+	if (n > s->req_nb_sectors)
+		n = s->req_nb_sectors;
+	ide_async_start(s, 1, sector_num, n);
+}
+
+
+/**
+ * Finish the pending sector transfer right now
+ */
+void Ide_CompleteTransfer(void)
+{
+	IDEState *s = ide_async;
+	int ret;
+
+	if (!s)
+		return;
+	CycInt_RemovePendingInterrupt(INTERRUPT_IDE);
+
+	ide_async = NULL;
+	ret = bdrv_complete(s->bs, s->async_write, s->async_sector_num, s->async_n);
+	if (s->async_write)
+		ide_sector_write_done(s, ret);
+	else
+		ide_sector_read_done(s, ret);
+}
+
+/**
+ * Drop the pending sector transfer (the host I/O is still waited for)
+ */
+void Ide_CancelTransfer(void)
+{
+	IDEState *s = ide_async;
+
+	CycInt_RemovePendingInterrupt(INTERRUPT_IDE);
+	if (!s)
+		return;
+	ide_async = NULL;
+	bdrv_complete(s->bs, s->async_write, s->async_sector_num, s->async_n);
+	s->status = READY_STAT | SEEK_STAT;
+}
+
+/**
+ * The emulated drive has transferred the sectors
+ */
+void Ide_InterruptHandler(void)
+{
+	CycInt_AcknowledgeInterrupt();
+	Ide_CompleteTransfer();
+}
+
+/**
+ * Save/Restore snapshot of the pending sector transfer. Its end is in
+ * the cycle interrupt table, the host part is submitted again when
+ * restoring: reads read the image again, writes use the saved data.
+ */
+void Ide_MemorySnapShot_Capture(bool bSave)
+{
+	IDEState *s = ide_async;
+	int nDrive = -1, is_write = 0, n = 0;
+	int64_t sector_num = 0;
+
+	if (bSave && s)
+	{
+		nDrive = s - opaque_ide_if;
+		is_write = s->async_write;
+		sector_num = s->async_sector_num;
+		n = s->async_n;
+	}
+	MemorySnapShot_Store(&nDrive, sizeof(nDrive));
+	if (nDrive < 0)
+		return;
+	MemorySnapShot_Store(&is_write, sizeof(is_write));
+	MemorySnapShot_Store(&sector_num, sizeof(sector_num));
+	MemorySnapShot_Store(&n, sizeof(n));
+
+	/* restoring: the transfer of the running emulation was dropped */
+	s = opaque_ide_if ? &opaque_ide_if[nDrive & 1] : NULL;
+	if (!s || !s->bs)
+	{
+		if (is_write)
+			MemorySnapShot_Skip(512 * n);
+		return;
+	}
+	if (is_write)
+		MemorySnapShot_Store(s->io_buffer, 512 * n);
+
+	if (!bSave)
+	{
+		s->async_write = is_write;
+		s->async_sector_num = sector_num;
+		s->async_n = n;
+		bdrv_submit(s->bs, is_write, sector_num, s->io_buffer, n);
+		ide_async = s;
+		s->status = BUSY_STAT;
+	}
+}
+
 
 static void ide_atapi_cmd_ok(IDEState *s)
 {
@@ -2464,6 +2594,41 @@ static uint32_t ide_data_readl(void *opaque, uint32_t addr)
 	return ret;
 }
 
+/**
+ * Do up to 'count' word or long-word (depending on 'size') reads of the
+ * IDE data register at 'addr' in one go, storing the data at 'dst' in
+ * ST memory byte order. This is for CPU loops which copy a sector from
+ * the data register to memory. The last read of the current transfer
+ * is always left to Ide_Mem_wget/lget, since that one ends the transfer.
+ * Returns the number of reads done.
+ */
+int Ide_Mem_ReadBurst(uaecptr addr, uae_u8 *dst, int size, int count)
+{
+	IDEState *s;
+	int avail, i;
+
+	if ((addr & 0x00ffffff) != 0xf00000 || !ConfigureParams.HardDisk.bUseIdeMasterHardDiskImage
+	    || !opaque_ide_if || LOG_TRACE_LEVEL(TRACE_IDE))
+		return 0;
+
+	s = opaque_ide_if->cur_drive;
+	avail = (s->data_end - s->data_ptr) / size - 1;
+	if (count > avail)
+		count = avail;
+	if (count <= 0)
+		return 0;
+
+	/* the data register swaps the bytes of each word */
+	for (i = 0; i < count * size; i += 2)
+	{
+		dst[i] = s->data_ptr[i + 1];
+		dst[i + 1] = s->data_ptr[i];
+	}
+	s->data_ptr += count * size;
+
+	return count;
+}
+
 static void ide_dummy_transfer_stop(IDEState *s)
 {
 	s->data_ptr = s->io_buffer;
@@ -2476,6 +2641,8 @@ static void ide_dummy_transfer_stop(IDEState *s)
 
 static void ide_reset(IDEState *s)
 {
+	if (ide_async == s)
+		Ide_CancelTransfer();
 	s->mult_sectors = MAX_MULT_SECTORS;
 	s->cur_drive = s;
 	s->select = 0xa0;
@@ -2677,13 +2844,13 @@ void Ide_Init(void)
 	memset(hd_table[0], 0, sizeof(BlockDriverState));
 	memset(hd_table[1], 0, sizeof(BlockDriverState));
 
-	bdrv_open(hd_table[0], ConfigureParams.HardDisk.szIdeMasterHardDiskImage, 0);
-	nIDEPartitions += HDC_PartitionCount(hd_table[0]->fhndl, TRACE_IDE);
+	bdrv_open(hd_table[0], ConfigureParams.HardDisk.szIdeMasterHardDiskImage, "ide0", 0);
+	nIDEPartitions += HDC_PartitionCount(&hd_table[0]->image, TRACE_IDE);
 
 	if (ConfigureParams.HardDisk.bUseIdeSlaveHardDiskImage)
 	{
-		bdrv_open(hd_table[1], ConfigureParams.HardDisk.szIdeSlaveHardDiskImage, 0);
-		nIDEPartitions += HDC_PartitionCount(hd_table[1]->fhndl, TRACE_IDE);
+		bdrv_open(hd_table[1], ConfigureParams.HardDisk.szIdeSlaveHardDiskImage, "ide1", 0);
+		nIDEPartitions += HDC_PartitionCount(&hd_table[1]->image, TRACE_IDE);
 
 		ide_init2(&opaque_ide_if[0], hd_table[0], hd_table[1]);
 	}
@@ -2701,6 +2868,8 @@ void Ide_UnInit(void)
 {
 	int i;
 
+	Ide_CancelTransfer();
+
 	for (i = 0; i < 2; i++)
 	{
 		if (hd_table[i])
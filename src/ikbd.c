@@ -8,12 +8,14 @@
   and sends bytes to the ACIA(6850).
   The IKBD has a small ROM which is used to process various commands send
   by the main CPU to the THE IKBD.
-  Due to lack of real HD6301 emulation, those commands are handled by
-  functionnaly equivalent code that tries to be as close as possible
-  to a real HD6301.
+  By default, those commands are handled by functionnaly equivalent code
+  that tries to be as close as possible to a real HD6301.
 
   For program using their own HD6301 code, we also use some custom
   handlers to emulate the expected result.
+
+  If an image of the IKBD's ROM is available, the real ROM can be run
+  instead on the HD6301 cpu core (see the end of this file).
 */
 
 const char IKBD_fileid[] = "Hatari ikbd.c : " __DATE__ " " __TIME__;
@@ -83,6 +85,10 @@ const char IKBD_fileid[] = "Hatari ikbd.c : " __DATE__ " " __TIME__;
 #include "acia.h"
 #include "configuration.h"
 #include "clocks_timings.h"
+#include "cycles.h"
+#include "file.h"
+#include "log.h"
+#include "hd6301_cpu.h"
 
 
 #define DBL_CLICK_HISTORY  0x07     /* Number of frames since last click to see if need to send one or two clicks */
@@ -339,6 +345,16 @@ static bool	IKBD_BCD_Check ( Uint8 val );
 static Uint8	IKBD_BCD_Adjust ( Uint8 val );
 void		IKBD_UpdateClockOnVBL ( void );
 
+static Uint8	IKBD_6301_ReadPort ( int Port );
+static void	IKBD_6301_WritePort ( int Port , Uint8 Value );
+static void	IKBD_6301_PressKey ( Uint8 ScanCode , bool bPress );
+static void	IKBD_6301_Run ( Uint64 Target );
+static void	IKBD_6301_RunAhead ( void );
+static void	IKBD_6301_LoadRom ( void );
+static void	IKBD_6301_Reset ( void );
+static void	IKBD_6301_Update ( void );
+static void	IKBD_6301_MemorySnapShot_Capture ( bool bSave );
+
 
 
 /*-----------------------------------------------------------------------*/
@@ -369,6 +385,10 @@ static void	(*pIKBD_CustomCodeHandler_Read) ( void );
 static void	(*pIKBD_CustomCodeHandler_Write) ( Uint8 );
 static bool	IKBD_ExeMode = false;
 
+/* Running the IKBD's ROM on the HD6301 cpu core (see the end of this file) */
+static bool	IKBD_6301_Enabled = false;
+static Uint64	IKBD_6301_TxTime;			/* IKBD_6301_Clock value when TDR was written */
+
 static Uint8	ScanCodeState[ 128 ];			/* state of each key : 0=released 1=pressed */
 
 /* This array contains all known custom 6301 programs, with their CRC */
@@ -438,6 +458,9 @@ void	IKBD_Init ( void )
 
 	/* Set the callback functions for RX/TX line */
 	IKBD_Init_Pointers ( pACIA_IKBD );
+
+	/* Connect the 6301's ports, in case a ROM image is used */
+	hd6301_init_cpu ( IKBD_6301_ReadPort , IKBD_6301_WritePort );
 }
 
 
@@ -483,6 +506,15 @@ void	IKBD_Reset ( bool bCold )
 	pIKBD->RSR = 0;
 	pIKBD->SCI_RX_Size = 0;
 
+	/* If an image of the IKBD's ROM is used, reset the real 6301 */
+	if ( bCold )
+		IKBD_6301_LoadRom ();
+	if ( IKBD_6301_Enabled )
+	{
+		IKBD_6301_Reset ();
+		return;
+	}
+
 
 	/* On cold reset, clear the whole RAM (including clock data) */
 	/* On warm reset, the clock data should be kept */
@@ -657,6 +689,7 @@ void IKBD_MemorySnapShot_Capture(bool bSave)
 
 	/* Save the IKBD's SCI part and restore the callback functions for RX/TX lines with the ACIA */
 	MemorySnapShot_Store(&IKBD, sizeof(IKBD));
+	IKBD_6301_MemorySnapShot_Capture ( bSave );
 	if (!bSave)						/* Restoring a snapshot */
 	{
 		IKBD_Init_Pointers ( pACIA_IKBD );
@@ -725,6 +758,9 @@ static void	IKBD_SCI_Get_Line_RX ( int rx_bit )
 
 	LOG_TRACE ( TRACE_IKBD_ACIA, "ikbd acia rx_state=%d bit=%d VBL=%d HBL=%d\n" , pIKBD->SCI_RX_State , rx_bit , nVBLs , nHBL );
 
+	if ( IKBD_6301_Enabled )
+		IKBD_6301_Run ( CyclesGlobalClockCounter );		/* Catch up with the ACIA before a byte is received */
+
 	StateNext = -1;
 	switch ( pIKBD->SCI_RX_State )
 	{
@@ -842,6 +878,9 @@ static Uint8	IKBD_SCI_Set_Line_TX ( void )
 	if ( StateNext >= 0 )
 		pIKBD->SCI_TX_State = StateNext;			/* Go to a new state */
 
+	if ( IKBD_6301_Enabled )
+		IKBD_6301_RunAhead ();					/* Run until a new byte could cross the serial line */
+
 	return tx_bit;
 }
 
@@ -858,6 +897,12 @@ static void	IKBD_Process_RDR ( Uint8 RDR )
 {
 	pIKBD->TRCSR &= ~IKBD_TRCSR_BIT_RDRF;				/* RDR was read */
 
+	/* If the IKBD's ROM is used, pass the byte to the 6301's SCI */
+	if ( IKBD_6301_Enabled )
+	{
+		hd6301_sci_rx_byte ( RDR );
+		return;
+	}
 
 	/* If IKBD is executing custom code, send the byte to the function handling this code */
 	if ( IKBD_ExeMode && pIKBD_CustomCodeHandler_Write )
@@ -885,6 +930,18 @@ static void	IKBD_Check_New_TDR ( void )
 {
 //  fprintf(stderr , "check new tdr %d %d\n", Keyboard.BufferHead , Keyboard.BufferTail );
 
+	/* If the IKBD's ROM is used, take the byte written by the 6301 in its TDR */
+	/* (but not before the 6301 wrote it, as it can run ahead of the ACIA) */
+	if ( IKBD_6301_Enabled )
+	{
+		if ( hd6301_sci_tx_pending () && ( IKBD_6301_TxTime <= CyclesGlobalClockCounter ) )
+		{
+			pIKBD->TDR = hd6301_sci_tx_byte ();
+			pIKBD->TRCSR &= ~IKBD_TRCSR_BIT_TDRE;
+		}
+		return;
+	}
+
 	if ( ( Keyboard.NbBytesInOutputBuffer > 0 )
 	  && ( Keyboard.PauseOutput == false ) )
 	{
@@ -936,7 +993,7 @@ static bool	IKBD_OutputBuffer_CheckFreeCount ( int Nb )
  */
 static int	IKBD_Delay_Random ( int min , int max )
 {
-	return min + rand() % ( max - min );
+	return min + Hatari_rand() % ( max - min );
 }
 
 
@@ -1095,6 +1152,9 @@ void	IKBD_UpdateClockOnVBL ( void )
 	/* Max number of days per month ; 18 entries, because the index for this array is a BCD coded month */
 	Uint8	day_max[ 18 ] = { 0x32, 0x29, 0x32, 0x31, 0x32, 0x31, 0x32, 0x32, 0x31, 0,0,0,0,0,0, 0x32, 0x31, 0x32 };
 
+	/* The IKBD's ROM updates its own clock */
+	if ( IKBD_6301_Enabled )
+		return;
 
 	/* Check if more than 1 second passed since last increment of date/time */
         FrameDuration_micro = ClocksTimings_GetVBLDuration_micro ( ConfigureParams.System.nMachineType , nScreenRefreshRate );
@@ -1715,6 +1775,13 @@ static void IKBD_SendAutoKeyboardCommands(void)
  */
 void IKBD_PressSTKey(Uint8 ScanCode, bool bPress)
 {
+	/* If the IKBD's ROM is used, the 6301 will scan the keyboard matrix */
+	if ( IKBD_6301_Enabled )
+	{
+		IKBD_6301_PressKey ( ScanCode , bPress );
+		return;
+	}
+
 	/* If IKBD is monitoring only joysticks, don't report key */
 	if ( KeyboardProcessor.JoystickMode == AUTOMODE_JOYSTICK_MONITORING )
 		return;
@@ -1767,6 +1834,13 @@ void IKBD_InterruptHandler_AutoSend(void)
 	/* Trigger this auto-update function again after a while */
 	CycInt_AddRelativeInterrupt(Keyboard.AutoSendCycles, INT_CPU_CYCLE, INTERRUPT_IKBD_AUTOSEND);
 
+	/* If the IKBD's ROM is used, the 6301 reports the events itself */
+	if ( IKBD_6301_Enabled )
+	{
+		IKBD_6301_Update();
+		return;
+	}
+
 	/* We don't send keyboard data automatically within the first few
 	 * VBLs to avoid that TOS gets confused during its boot time */
 	if (nVBLs > 20)
@@ -1777,6 +1851,26 @@ void IKBD_InterruptHandler_AutoSend(void)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Called just after the host input was sampled in the middle of a frame :
+ * bring the next automatic update forward, so the new joystick and mouse
+ * state is sent at once instead of up to one AutoSend period later.
+ * Keys are already queued by IKBD_PressSTKey(), and in joystick monitoring
+ * mode the program chose its own sampling rate, so it's left alone.
+ */
+void IKBD_InputSync(void)
+{
+	if ( IKBD_6301_Enabled
+	  || KeyboardProcessor.JoystickMode == AUTOMODE_JOYSTICK_MONITORING
+	  || !CycInt_InterruptActive ( INTERRUPT_IKBD_AUTOSEND ) )
+		return;
+
+	CycInt_RemovePendingInterrupt ( INTERRUPT_IKBD_AUTOSEND );
+	CycInt_AddRelativeInterrupt ( 4, INT_CPU_CYCLE, INTERRUPT_IKBD_AUTOSEND );
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * On ST if disable Mouse AND Joystick with a set time of a RESET command they are
@@ -3056,3 +3150,553 @@ static void IKBD_CustomCodeHandler_ChaosAD_Write ( Uint8 aciabyte )
 	}
 }
 
+
+
+
+
+/************************************************************************/
+/* This part runs the real IKBD's ROM on the HD6301 cpu core, instead	*/
+/* of the functionally equivalent code above. It's used when an image	*/
+/* of the IKBD's ROM is given with --ikbd-rom.				*/
+/*									*/
+/* The 6301 is not run in lockstep with the 68000 : it runs ahead of	*/
+/* the 68000 in batches of cycles and both cpus are only synchronised	*/
+/* when a byte crosses the serial line. A batch never goes further than	*/
+/* the time when the SCI could receive the next byte from the ACIA (so	*/
+/* RDR is always seen on time by the 6301), nor further than the time	*/
+/* when the ACIA could take the byte written in TDR (so TDRE is seen on	*/
+/* time too). When the serial line is idle, this means the 6301 runs	*/
+/* about 10 bits (~1250 6301 cycles) at once.				*/
+/*									*/
+/* The keyboard matrix (P1 rows, P3/P4 columns) and the wiring of the	*/
+/* mouse's quadrature signals on P4 are learnt from the ROM itself :	*/
+/* when the image is loaded, we boot it in a sandbox and record the	*/
+/* scan code / mouse packet it reports for each key / mouse signal.	*/
+/************************************************************************/
+
+#define	IKBD_6301_ROM_SIZE		4096
+#define	IKBD_6301_CPU_CYCLES		( 8 << nCpuFreqShift )	/* 1 6301 cycle at 1 MHz, in cpu cycles */
+#define	IKBD_6301_MAX_RUN		0x10000			/* max 6301 cycles in one call to hd6301_run */
+
+#define	IKBD_6301_MATRIX_COLUMNS	15			/* P3 bits 1-7 and P4 bits 0-7 */
+#define	IKBD_6301_KEY_NONE		0xff
+
+#define	IKBD_6301_PROBE_BOOT_CYCLES	300000			/* 6301 cycles to boot the ROM in the sandbox */
+#define	IKBD_6301_PROBE_KEY_CYCLES	20000			/* 6301 cycles to wait for a key report */
+#define	IKBD_6301_PROBE_MOUSE_CYCLES	100000			/* 6301 cycles to wait for mouse reports */
+#define	IKBD_6301_PROBE_MOUSE_STEPS	16			/* quadrature steps sent to find a mouse axis */
+
+static bool	IKBD_6301_Probing = false;		/* true while learning the ROM's key/mouse mapping */
+static char	IKBD_6301_RomFileName[ FILENAME_MAX ];	/* image loaded in IKBD_6301_Rom */
+static Uint8	IKBD_6301_Rom[ IKBD_6301_ROM_SIZE ];
+
+static Uint64	IKBD_6301_Clock;			/* CyclesGlobalClockCounter value the 6301 was run up to */
+static Uint64	IKBD_6301_RxHorizon;			/* don't run further : the SCI could receive a new byte */
+static Uint64	IKBD_6301_TxHorizon;			/* don't run further while TDR is full : the ACIA could take it */
+
+static Uint8	IKBD_6301_PortOut[ 5 ];			/* Value on the output pins of P1-P4 */
+static Uint8	IKBD_6301_Matrix[ IKBD_6301_MATRIX_COLUMNS ];	/* For each column, 1 bit per pressed key's row */
+static Uint8	IKBD_6301_KeyPos[ 128 ];		/* Position in the matrix (column*8+row) of each ST scan code */
+
+/* Mouse's X and Y quadrature signals are on P4 bits 0-1 and 2-3. Each */
+/* step moves the 2 bits of a pair to the next value in this table */
+static const Uint8 IKBD_6301_Quadrature[ 4 ] = { 3 , 1 , 0 , 2 };
+
+static int	IKBD_6301_MouseAxis[ 2 ];		/* For each pair : 0=X 1=Y */
+static int	IKBD_6301_MouseSign[ 2 ];		/* For each pair : 1 if forward steps move in the positive direction */
+static int	IKBD_6301_MouseStepsPerUnit;		/* Number of steps for a one unit move */
+static int	IKBD_6301_MousePhase[ 2 ];		/* Index in IKBD_6301_Quadrature for each pair */
+static int	IKBD_6301_MouseSteps[ 2 ];		/* Number of steps still to do for each pair */
+static int	IKBD_6301_MouseReads;			/* Number of P4 reads since the last step */
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return joystick data for 'Joy' (same format as KeyboardProcessor.Joy.JoyData)
+ */
+static Uint8	IKBD_6301_GetJoystick ( int Joy )
+{
+	if ( IKBD_6301_Probing )
+		return 0;
+
+#ifdef __LIBRETRO__
+	if ( Joy == 1 )
+		return MXjoy0;
+	return NUMjoy < 0 ? MXjoy1 : 0;
+#else
+	return Joy_GetStickData ( Joy );
+#endif
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Convert the mouse moves from the host into quadrature steps
+ */
+static void	IKBD_6301_AddMouseMoves ( void )
+{
+	int	Pair;
+	int	Delta;
+
+	for ( Pair=0 ; Pair<2 ; Pair++ )
+	{
+		Delta = IKBD_6301_MouseAxis[ Pair ] ? KeyboardProcessor.Mouse.dy : KeyboardProcessor.Mouse.dx;
+		IKBD_6301_MouseSteps[ Pair ] += Delta * IKBD_6301_MouseSign[ Pair ] * IKBD_6301_MouseStepsPerUnit;
+	}
+	KeyboardProcessor.Mouse.dx = 0;
+	KeyboardProcessor.Mouse.dy = 0;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return the quadrature signals of the mouse for P4 bits 0-3.
+ * The ROM samples the mouse by polling P4, so we do one step only after
+ * 2 reads to be sure no step is missed. New moves are only started by
+ * groups of 4 steps, so the signals always go back to their idle state
+ * (both bits high), else they would be seen as a joystick 0 direction.
+ */
+static Uint8	IKBD_6301_GetMouse ( void )
+{
+	int	Pair;
+	int	Dir;
+	Uint8	Value = 0;
+
+	if ( !IKBD_6301_Probing )
+		IKBD_6301_AddMouseMoves ();
+
+	if ( ++IKBD_6301_MouseReads >= 2 )
+	{
+		for ( Pair=0 ; Pair<2 ; Pair++ )
+		{
+			if ( ( IKBD_6301_MousePhase[ Pair ] == 0 )
+			  && ( IKBD_6301_MouseSteps[ Pair ] > -4 ) && ( IKBD_6301_MouseSteps[ Pair ] < 4 ) )
+				continue;
+
+			Dir = IKBD_6301_MouseSteps[ Pair ] < 0 ? -1 : 1;
+			IKBD_6301_MouseSteps[ Pair ] -= Dir;
+			IKBD_6301_MousePhase[ Pair ] = ( IKBD_6301_MousePhase[ Pair ] + Dir ) & 3;
+			IKBD_6301_MouseReads = 0;
+		}
+	}
+
+	for ( Pair=0 ; Pair<2 ; Pair++ )
+		Value |= IKBD_6301_Quadrature[ IKBD_6301_MousePhase[ Pair ] ] << ( Pair * 2 );
+	return Value;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Read the input pins of a 6301 port (bits configured as outputs are ignored
+ * by the cpu core).
+ *  P1 : rows of the keyboard matrix, 0 if a key is pressed in one of the
+ *       columns set to 0 on P3 bits 1-7 / P4 bits 0-7
+ *  P2 : bit 1 = left mouse button / joystick 0 fire, bit 2 = right mouse
+ *       button / joystick 1 fire (0 when pressed)
+ *  P4 : bits 0-3 = mouse or joystick 0, bits 4-7 = joystick 1 (0 when pressed)
+ */
+static Uint8	IKBD_6301_ReadPort ( int Port )
+{
+	int	Col;
+	Uint8	Rows;
+	Uint8	Joy0, Joy1;
+	Uint8	Value = 0xff;
+
+	switch ( Port )
+	{
+	  case 1 :
+		Rows = 0;
+		for ( Col=0 ; Col<7 ; Col++ )
+			if ( ( IKBD_6301_PortOut[ 3 ] & ( 2 << Col ) ) == 0 )
+				Rows |= IKBD_6301_Matrix[ Col ];
+		for ( Col=0 ; Col<8 ; Col++ )
+			if ( ( IKBD_6301_PortOut[ 4 ] & ( 1 << Col ) ) == 0 )
+				Rows |= IKBD_6301_Matrix[ 7 + Col ];
+		Value = ~Rows;
+		break;
+
+	  case 2 :
+		if ( !IKBD_6301_Probing )
+		{
+			if ( ( Keyboard.bLButtonDown & BUTTON_MOUSE ) || ( IKBD_6301_GetJoystick ( 0 ) & 0x80 ) )
+				Value &= ~0x02;
+			if ( ( Keyboard.bRButtonDown & BUTTON_MOUSE ) || ( IKBD_6301_GetJoystick ( 1 ) & 0x80 ) )
+				Value &= ~0x04;
+		}
+		break;
+
+	  case 4 :
+		Joy0 = IKBD_6301_GetJoystick ( 0 ) & 0x0f;
+		Joy1 = IKBD_6301_GetJoystick ( 1 ) & 0x0f;
+		Value = ~( Joy1 << 4 ) & 0xf0;
+		if ( Joy0 )
+			Value |= ~Joy0 & 0x0f;
+		else
+			Value |= IKBD_6301_GetMouse ();
+		break;
+	}
+
+	return Value;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Store the value of the output pins of a 6301 port (used to select
+ * the columns of the keyboard matrix)
+ */
+static void	IKBD_6301_WritePort ( int Port , Uint8 Value )
+{
+	IKBD_6301_PortOut[ Port ] = Value;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Update the keyboard matrix when a key is pressed/released.
+ */
+static void	IKBD_6301_PressKey ( Uint8 ScanCode , bool bPress )
+{
+	Uint8	Pos = IKBD_6301_KeyPos[ ScanCode & 0x7f ];
+
+	ScanCodeState[ ScanCode & 0x7f ] = bPress ? 1 : 0;
+
+	if ( Pos == IKBD_6301_KEY_NONE )
+		return;
+	if ( bPress )
+		IKBD_6301_Matrix[ Pos >> 3 ] |= 1 << ( Pos & 7 );
+	else
+		IKBD_6301_Matrix[ Pos >> 3 ] &= ~( 1 << ( Pos & 7 ) );
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Run the 6301 until CyclesGlobalClockCounter reaches 'Target', but never
+ * after IKBD_6301_RxHorizon, and never after IKBD_6301_TxHorizon while
+ * TDR is waiting to be sent. hd6301_run() returns early when TDR is written,
+ * so we can record the time of the write and stop at the TX horizon.
+ */
+static void	IKBD_6301_Run ( Uint64 Target )
+{
+	Uint64	Limit;
+	Uint64	Cycles;
+	bool	TxPending;
+
+	if ( Target > IKBD_6301_RxHorizon )
+		Target = IKBD_6301_RxHorizon;
+
+	while ( IKBD_6301_Clock < Target )
+	{
+		TxPending = hd6301_sci_tx_pending ();
+		Limit = Target;
+		if ( TxPending && ( Limit > IKBD_6301_TxHorizon ) )
+			Limit = IKBD_6301_TxHorizon;
+		if ( IKBD_6301_Clock >= Limit )
+			break;
+
+		Cycles = ( Limit - IKBD_6301_Clock + IKBD_6301_CPU_CYCLES - 1 ) / IKBD_6301_CPU_CYCLES;
+		if ( Cycles > IKBD_6301_MAX_RUN )
+			Cycles = IKBD_6301_MAX_RUN;
+		IKBD_6301_Clock += (Uint64)hd6301_run ( (int)Cycles ) * IKBD_6301_CPU_CYCLES;
+
+		if ( !TxPending && hd6301_sci_tx_pending () )
+			IKBD_6301_TxTime = IKBD_6301_Clock;
+	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Called after each bit exchanged with the ACIA : compute how far the 6301
+ * can run before the next byte could cross the serial line and run it.
+ * 'n' bits ahead means the next call to IKBD_SCI_Get_Line_RX/IKBD_SCI_Set_Line_TX
+ * that could complete/start a byte is n*BitCycles after now. We stop half a bit
+ * before to absorb the jitter of the ACIA's timer.
+ */
+static void	IKBD_6301_RunAhead ( void )
+{
+	Uint64	Now = CyclesGlobalClockCounter;
+	Uint64	BitCycles;
+	int	RxBits, TxBits;
+
+	BitCycles = ( (Uint64)( 8021247 / pACIA_IKBD->TX_Clock ) * pACIA_IKBD->Clock_Divider ) << nCpuFreqShift;
+	if ( BitCycles == 0 )
+		BitCycles = 1;
+
+	if ( pIKBD->SCI_RX_State == IKBD_SCI_STATE_IDLE )
+		RxBits = 10;					/* start bit, 8 data bits, stop bit */
+	else if ( pIKBD->SCI_RX_State == IKBD_SCI_STATE_DATA_BIT )
+		RxBits = pIKBD->SCI_RX_Size + 1;
+	else
+		RxBits = 1;
+
+	if ( pIKBD->SCI_TX_State == IKBD_SCI_STATE_IDLE )
+		TxBits = pIKBD->SCI_TX_Delay + 1;
+	else if ( pIKBD->SCI_TX_State == IKBD_SCI_STATE_DATA_BIT )
+		TxBits = pIKBD->SCI_TX_Size + 2;
+	else
+		TxBits = 2;
+
+	IKBD_6301_RxHorizon = Now + RxBits * BitCycles - BitCycles / 2;
+	IKBD_6301_TxHorizon = Now + TxBits * BitCycles - BitCycles / 2;
+
+	IKBD_6301_Run ( IKBD_6301_RxHorizon );
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Run the 6301 in the sandbox for 'Cycles' cycles, sending the bytes from
+ * TDR to 'pBytes' instead of the ACIA. Stop when 'MaxBytes' were received.
+ * Return the number of bytes received.
+ */
+static int	IKBD_6301_ProbeRun ( int Cycles , Uint8 *pBytes , int MaxBytes )
+{
+	int	Done = 0;
+	int	NbBytes = 0;
+	Uint8	Byte;
+
+	while ( Done < Cycles )
+	{
+		Done += hd6301_run ( Cycles - Done );
+		if ( hd6301_sci_tx_pending () )
+		{
+			Byte = hd6301_sci_tx_byte ();
+			if ( NbBytes < MaxBytes )
+			{
+				pBytes[ NbBytes++ ] = Byte;
+				if ( NbBytes == MaxBytes )
+					break;
+			}
+		}
+	}
+
+	return NbBytes;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Move the mouse signals of pair 'Pair' forward in the sandbox and return the
+ * sum of the relative mouse packets reported by the ROM in 'pDX' and 'pDY'.
+ */
+static void	IKBD_6301_ProbeMouse ( int Pair , int *pDX , int *pDY )
+{
+	Uint8	Bytes[ 64 ];
+	int	NbBytes;
+	int	i;
+
+	memset ( IKBD_6301_MouseSteps , 0 , sizeof ( IKBD_6301_MouseSteps ) );
+	memset ( IKBD_6301_MousePhase , 0 , sizeof ( IKBD_6301_MousePhase ) );
+	IKBD_6301_MouseSteps[ Pair ] = IKBD_6301_PROBE_MOUSE_STEPS;
+
+	NbBytes = IKBD_6301_ProbeRun ( IKBD_6301_PROBE_MOUSE_CYCLES , Bytes , sizeof ( Bytes ) );
+
+	*pDX = *pDY = 0;
+	for ( i=0 ; i+2<NbBytes ; i++ )
+		if ( ( Bytes[ i ] & 0xfc ) == 0xf8 )		/* relative mouse packet : header, dx, dy */
+		{
+			*pDX += (Sint8)Bytes[ i+1 ];
+			*pDY += (Sint8)Bytes[ i+2 ];
+			i += 2;
+		}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Learn the keyboard matrix and the mouse wiring from the ROM : boot it in a
+ * sandbox, then for each position in the matrix restore the booted state,
+ * press the key and record the scan code reported by the ROM. Same for
+ * each pair of mouse signals.
+ * Return false if the ROM doesn't look like an IKBD's ROM.
+ */
+static bool	IKBD_6301_Probe ( void )
+{
+	hd6301_state_t	Booted;
+	Uint8	Byte;
+	int	Col, Row, Pair;
+	int	NbKeys = 0;
+	int	DX, DY, Units;
+	bool	MouseOk = true;
+
+	IKBD_6301_Probing = true;
+	memset ( IKBD_6301_Matrix , 0 , sizeof ( IKBD_6301_Matrix ) );
+	memset ( IKBD_6301_KeyPos , IKBD_6301_KEY_NONE , sizeof ( IKBD_6301_KeyPos ) );
+	memset ( IKBD_6301_MouseSteps , 0 , sizeof ( IKBD_6301_MouseSteps ) );
+	memset ( IKBD_6301_MousePhase , 0 , sizeof ( IKBD_6301_MousePhase ) );
+
+	hd6301_reset_cpu ();
+	IKBD_6301_ProbeRun ( IKBD_6301_PROBE_BOOT_CYCLES , NULL , 0 );
+	hd6301_save_state ( &Booted );
+
+	for ( Col=0 ; Col<IKBD_6301_MATRIX_COLUMNS ; Col++ )
+		for ( Row=0 ; Row<8 ; Row++ )
+		{
+			hd6301_restore_state ( &Booted );
+			IKBD_6301_Matrix[ Col ] = 1 << Row;
+			if ( ( IKBD_6301_ProbeRun ( IKBD_6301_PROBE_KEY_CYCLES , &Byte , 1 ) == 1 )
+			  && ( Byte < 0x80 ) && ( IKBD_6301_KeyPos[ Byte ] == IKBD_6301_KEY_NONE ) )
+			{
+				IKBD_6301_KeyPos[ Byte ] = Col * 8 + Row;
+				NbKeys++;
+			}
+			IKBD_6301_Matrix[ Col ] = 0;
+		}
+
+	IKBD_6301_MouseStepsPerUnit = 1;
+	for ( Pair=0 ; Pair<2 ; Pair++ )
+	{
+		hd6301_restore_state ( &Booted );
+		IKBD_6301_ProbeMouse ( Pair , &DX , &DY );
+		IKBD_6301_MouseAxis[ Pair ] = abs ( DY ) > abs ( DX ) ? 1 : 0;
+		Units = IKBD_6301_MouseAxis[ Pair ] ? DY : DX;
+		IKBD_6301_MouseSign[ Pair ] = Units < 0 ? -1 : 1;
+		if ( Units == 0 )
+			MouseOk = false;
+		else if ( Pair == 0 )
+			IKBD_6301_MouseStepsPerUnit = IKBD_6301_PROBE_MOUSE_STEPS / abs ( Units );
+	}
+	if ( !MouseOk || ( IKBD_6301_MouseAxis[ 0 ] == IKBD_6301_MouseAxis[ 1 ] )
+	  || ( IKBD_6301_MouseStepsPerUnit < 1 ) || ( IKBD_6301_MouseStepsPerUnit > 4 ) )
+	{
+		Log_Printf ( LOG_WARN , "IKBD ROM '%s' : mouse wiring not found, using default\n" , IKBD_6301_RomFileName );
+		IKBD_6301_MouseAxis[ 0 ] = 0;
+		IKBD_6301_MouseAxis[ 1 ] = 1;
+		IKBD_6301_MouseSign[ 0 ] = IKBD_6301_MouseSign[ 1 ] = 1;
+		IKBD_6301_MouseStepsPerUnit = 4;
+	}
+
+	memset ( IKBD_6301_MouseSteps , 0 , sizeof ( IKBD_6301_MouseSteps ) );
+	memset ( IKBD_6301_MousePhase , 0 , sizeof ( IKBD_6301_MousePhase ) );
+	IKBD_6301_Probing = false;
+
+	LOG_TRACE ( TRACE_IKBD_ALL , "ikbd rom probe keys=%d mouse axis=%d/%d sign=%d/%d steps=%d\n" , NbKeys ,
+		IKBD_6301_MouseAxis[ 0 ] , IKBD_6301_MouseAxis[ 1 ] , IKBD_6301_MouseSign[ 0 ] , IKBD_6301_MouseSign[ 1 ] ,
+		IKBD_6301_MouseStepsPerUnit );
+
+	if ( NbKeys == 0 )
+	{
+		Log_Printf ( LOG_WARN , "IKBD ROM '%s' doesn't report any key, using internal IKBD emulation\n" , IKBD_6301_RomFileName );
+		return false;
+	}
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Load the IKBD's ROM image if the name in the configuration changed.
+ * If no image is given (or if it can't be used), the internal IKBD emulation
+ * is used.
+ */
+static void	IKBD_6301_LoadRom ( void )
+{
+	Uint8	*pRomData;
+	long	nRomSize;
+
+	if ( strcmp ( ConfigureParams.Rom.szIkbdRomFileName , IKBD_6301_RomFileName ) == 0 )
+		return;
+
+	strcpy ( IKBD_6301_RomFileName , ConfigureParams.Rom.szIkbdRomFileName );
+	IKBD_6301_Enabled = false;
+	if ( IKBD_6301_RomFileName[ 0 ] == 0 )
+		return;
+
+	pRomData = HFile_Read ( IKBD_6301_RomFileName , &nRomSize , NULL );
+	if ( !pRomData )
+	{
+		Log_Printf ( LOG_ERROR , "Failed to load IKBD ROM '%s'.\n" , IKBD_6301_RomFileName );
+		return;
+	}
+	if ( nRomSize != IKBD_6301_ROM_SIZE )
+	{
+		Log_Printf ( LOG_ERROR , "IKBD ROM '%s' has illegal size (must be %d bytes).\n" , IKBD_6301_RomFileName , IKBD_6301_ROM_SIZE );
+		free ( pRomData );
+		return;
+	}
+	memcpy ( IKBD_6301_Rom , pRomData , IKBD_6301_ROM_SIZE );
+	free ( pRomData );
+
+	hd6301_load_rom ( IKBD_6301_Rom );
+	IKBD_6301_Enabled = IKBD_6301_Probe ();
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Reset the 6301 (the RESET pin is connected to the 68000's reset)
+ */
+static void	IKBD_6301_Reset ( void )
+{
+	int	i;
+
+	hd6301_reset_cpu ();
+
+	IKBD_6301_Clock = CyclesGlobalClockCounter;
+	IKBD_6301_RxHorizon = IKBD_6301_TxHorizon = IKBD_6301_Clock;
+	IKBD_6301_TxTime = 0;
+
+	memset ( IKBD_6301_Matrix , 0 , sizeof ( IKBD_6301_Matrix ) );
+	for ( i=0 ; i<128 ; i++ )
+		if ( ScanCodeState[ i ] )
+			IKBD_6301_PressKey ( i , true );
+
+	memset ( IKBD_6301_MouseSteps , 0 , sizeof ( IKBD_6301_MouseSteps ) );
+	memset ( IKBD_6301_MousePhase , 0 , sizeof ( IKBD_6301_MousePhase ) );
+	IKBD_6301_MouseReads = 0;
+	KeyboardProcessor.Mouse.dx = KeyboardProcessor.Mouse.dy = 0;
+
+	Keyboard.BufferHead = Keyboard.BufferTail = 0;
+	Keyboard.NbBytesInOutputBuffer = 0;
+
+	/* Main_EventHandler() is still called from the auto-update function */
+	Keyboard.AutoSendCycles = 150000;				/* approx every VBL */
+	CycInt_AddRelativeInterrupt ( Keyboard.AutoSendCycles, INT_CPU_CYCLE, INTERRUPT_IKBD_AUTOSEND );
+	LOG_TRACE ( TRACE_IKBD_ALL , "ikbd reset done, running 6301 rom\n" );
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Called from the auto-update function : run the 6301 up to now, in case
+ * the ACIA's timer is not running yet.
+ */
+static void	IKBD_6301_Update ( void )
+{
+	if ( pACIA_IKBD->Clock_Divider == 0 )				/* Serial line is not initialised */
+		IKBD_6301_RxHorizon = CyclesGlobalClockCounter;
+
+	IKBD_6301_Run ( CyclesGlobalClockCounter );
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Save/Restore the 6301's state
+ */
+static void	IKBD_6301_MemorySnapShot_Capture ( bool bSave )
+{
+	hd6301_state_t	State;
+
+	if ( bSave )
+		hd6301_save_state ( &State );
+	else
+		IKBD_6301_LoadRom ();
+
+	MemorySnapShot_Store(&State, sizeof(State));
+	MemorySnapShot_Store(&IKBD_6301_Clock, sizeof(IKBD_6301_Clock));
+	MemorySnapShot_Store(&IKBD_6301_RxHorizon, sizeof(IKBD_6301_RxHorizon));
+	MemorySnapShot_Store(&IKBD_6301_TxHorizon, sizeof(IKBD_6301_TxHorizon));
+	MemorySnapShot_Store(&IKBD_6301_TxTime, sizeof(IKBD_6301_TxTime));
+	MemorySnapShot_Store(IKBD_6301_PortOut, sizeof(IKBD_6301_PortOut));
+	MemorySnapShot_Store(IKBD_6301_Matrix, sizeof(IKBD_6301_Matrix));
+	MemorySnapShot_Store(IKBD_6301_MousePhase, sizeof(IKBD_6301_MousePhase));
+	MemorySnapShot_Store(IKBD_6301_MouseSteps, sizeof(IKBD_6301_MouseSteps));
+	MemorySnapShot_Store(&IKBD_6301_MouseReads, sizeof(IKBD_6301_MouseReads));
+
+	if ( !bSave && IKBD_6301_Enabled )
+		hd6301_restore_state ( &State );
+}
@@ -18,8 +18,6 @@ extern int pulse_swallowing_count;
 
 extern void Audio_Init(void);
 extern void Audio_UnInit(void);
-extern void Audio_Lock(void);
-extern void Audio_Unlock(void);
 extern void Audio_FreeSoundBuffer(void);
 extern void Audio_SetOutputAudioFreq(int Frequency);
 extern void Audio_EnableAudio(bool bEnable);
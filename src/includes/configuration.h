@@ -18,6 +18,7 @@ typedef struct
   int nAlertDlgLogLevel;
   bool bConfirmQuit;
   bool bNatFeats;
+  bool bNatFeatsBulk;
   bool bConsoleWindow;	/* for now, used just for Windows */
 } CNF_LOG;
 
@@ -33,12 +34,13 @@ typedef struct
 } CNF_DEBUGGER;
 
 
-/* ROM (TOS + cartridge) configuration */
+/* ROM (TOS + cartridge + IKBD) configuration */
 typedef struct
 {
   char szTosImageFileName[FILENAME_MAX];
   bool bPatchTos;
   char szCartridgeImageFileName[FILENAME_MAX];
+  char szIkbdRomFileName[FILENAME_MAX];
 } CNF_ROM;
 
 
@@ -46,12 +48,15 @@ typedef struct
 typedef struct
 {
   bool bEnableMicrophone;
+  int nMicrophoneLatency;          /* Microphone capture latency in ms, 0 = host default */
   bool bEnableSound;
   bool bEnableSoundSync;
   int nPlaybackFreq;
   int SdlAudioBufferSize;
   char szYMCaptureFileName[FILENAME_MAX];
   int YmVolumeMixing;
+  bool bYmBlepSynthesis;
+  bool bSoundThread;              /* Generate sound on its own host thread */
 } CNF_SOUND;
 
 
@@ -119,6 +124,7 @@ typedef struct
 {
   int nMemorySize;
   bool bAutoSave;
+  bool bHugePages;
   char szMemoryCaptureFileName[FILENAME_MAX];
   char szAutoSaveFileName[FILENAME_MAX];
 } CNF_MEMORY;
@@ -165,6 +171,7 @@ typedef struct
 {
   bool bAutoInsertDiskB;
   bool FastFloppy;			/* true to speed up FDC emulation */
+  bool TurboFloppy;			/* true to collapse FDC delays for ST/MSA/DIM images */
   bool EnableDriveA;
   bool EnableDriveB;
   int  DriveA_NumberOfHeads;
@@ -197,9 +204,11 @@ typedef struct
   WRITEPROTECTION nWriteProtection;
   GEMDOS_CHR_CONV nGemdosCase;
   bool bBootFromHardDisk;
+  bool bFastPexec;			/* load programs from GEMDOS drives natively */
   char szHardDiskDirectories[MAX_HARDDRIVES][FILENAME_MAX];
   char szIdeMasterHardDiskImage[FILENAME_MAX];
   char szIdeSlaveHardDiskImage[FILENAME_MAX];
+  char szOverlayDir[FILENAME_MAX];	/* copy-on-write overlays for the HD images, if set */
 } CNF_HARDDISK;
 
 /* SCSI/ACSI configuration */
@@ -235,17 +244,21 @@ typedef struct
 {
   MONITORTYPE nMonitorType;
   int nFrameSkips;
+  bool bAdaptiveFrameSkip;
   bool bFullScreen;
   bool bKeepResolution;
   bool bKeepResolutionST;
   bool bAllowOverscan;
   bool bAspectCorrect;
+  int nConvertThreads;            /* Threads converting Falcon/TT screen rows */
   bool bUseExtVdiResolutions;
   int nSpec512Threshold;
+  bool bRenderThread;             /* Convert ST screen on its own host thread */
   int nForceBpp;
   int nVdiColors;
   int nVdiWidth;
   int nVdiHeight;
+  bool bVdiAccel;                 /* Service common VDI calls natively */
   bool bShowStatusbar;
   bool bShowDriveLed;
   bool bCrop;
@@ -307,10 +320,13 @@ typedef struct
   MACHINETYPE nMachineType;
   bool bBlitter;                  /* TRUE if Blitter is enabled */
   DSPTYPE nDSPType;               /* how to "emulate" DSP */
+  bool bDSPThread;                /* Run emulated DSP on its own host thread */
+  int nDSPQuantum;                /* DSP cycles run at once, 0 = in lockstep with CPU */
   bool bRealTimeClock;
   bool bPatchTimerD;
   bool bFastBoot;                 /* Enable to patch TOS for fast boot */
   bool bFastForward;
+  bool bDeterministic;            /* Same emulation on all hosts (netplay) */
 
 #if ENABLE_WINUAE_CPU
   bool bAddressSpace24;
@@ -325,6 +341,7 @@ typedef struct
 {
   int AviRecordVcodec;
   int AviRecordFps;
+  int AviRecordThreads;           /* Threads encoding the video frames */
   char AviRecordFile[FILENAME_MAX];
 } CNF_VIDEO;
 
@@ -360,6 +377,6 @@ extern void Configuration_SetDefault(void);
 extern void Configuration_Apply(bool bReset);
 extern void Configuration_Load(const char *psFileName);
 extern void Configuration_Save(void);
-extern void Configuration_MemorySnapShot_Capture(bool bSave);
+extern bool Configuration_MemorySnapShot_Capture(bool bSave);
 
 #endif
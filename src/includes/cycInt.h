@@ -8,6 +8,10 @@
 #ifndef HATARI_CYCINT_H
 #define HATARI_CYCINT_H
 
+#include "hotState.h"
+#include "perf.h"
+#include "timeline.h"
+
 /* Interrupt handlers in system */
 typedef enum
 {
@@ -28,6 +32,10 @@ typedef enum
   INTERRUPT_FDC,
   INTERRUPT_BLITTER,
   INTERRUPT_MIDI,
+  INTERRUPT_HDC,
+  INTERRUPT_IDE,
+  INTERRUPT_PROFILE_CPU,
+  INTERRUPT_PROFILE_DSP,
 
   MAX_INTERRUPTS
 } interrupt_id;
@@ -54,12 +62,32 @@ typedef enum
 
 
 
-extern void (*PendingInterruptFunction)(void);
-extern int PendingInterruptCount;
+#define PendingInterruptFunction HotState.PendingInterruptFunction
+#define PendingInterruptCount HotState.PendingInterruptCount
+extern interrupt_id RunningInterrupt;
+
+/* Call the handler of the interrupt that is due */
+static inline void CycInt_CallPendingHandler(void)
+{
+	RunningInterrupt = INTERRUPT_NULL;
+	Perf_Begin(PERF_CYCINT);
+	if (unlikely(Timeline_bEnabled))
+		Timeline_CallHandler();
+	else
+		PendingInterruptFunction();
+	Perf_End();
+}
+
+/* Called once all the due interrupt handlers have returned */
+static inline void CycInt_HandlersDone(void)
+{
+	RunningInterrupt = INTERRUPT_NULL;
+}
 
 extern void CycInt_Reset(void);
 extern void CycInt_MemorySnapShot_Capture(bool bSave);
 extern void CycInt_AcknowledgeInterrupt(void);
+extern interrupt_id CycInt_GetActiveInterrupt(void);
 extern void CycInt_AddAbsoluteInterrupt(int CycleTime, int CycleType, interrupt_id Handler);
 extern void CycInt_AddRelativeInterrupt(int CycleTime, int CycleType, interrupt_id Handler);
 extern void CycInt_AddRelativeInterruptNoOffset(int CycleTime, int CycleType, interrupt_id Handler);
@@ -69,5 +97,6 @@ extern void CycInt_RemovePendingInterrupt(interrupt_id Handler);
 extern void CycInt_ResumeStoppedInterrupt(interrupt_id Handler);
 extern bool CycInt_InterruptActive(interrupt_id Handler);
 extern int CycInt_FindCyclesPassed(interrupt_id Handler, int CycleType);
+extern int CycInt_FindCyclesPassedInHandler(interrupt_id Handler, int CycleType, interrupt_id *pRunning);
 
 #endif /* ifndef HATARI_CYCINT_H */
@@ -10,6 +10,7 @@
 
 #include <stdbool.h>
 #include <SDL_endian.h>
+#include "hotState.h"
 
 enum
 {
@@ -21,10 +22,10 @@ enum
 };
 
 
-extern int	nCyclesMainCounter;
-extern Uint64	CyclesGlobalClockCounter;
+#define nCyclesMainCounter		HotState.nCyclesMainCounter
+#define CyclesGlobalClockCounter	HotState.CyclesGlobalClockCounter
 
-extern int	CurrentInstrCycles;
+#define CurrentInstrCycles		HotState.CurrentInstrCycles
 extern int	MovepByteNbr;
 
 
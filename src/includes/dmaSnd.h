@@ -17,6 +17,7 @@ extern Uint16 nDmaSoundControl;
 extern void DmaSnd_Reset(bool bCold);
 extern void DmaSnd_MemorySnapShot_Capture(bool bSave);
 extern void DmaSnd_GenerateSamples(int nMixBufIdx, int nSamplesToGenerate);
+extern bool DmaSnd_IsIdle(void);
 extern void DmaSnd_STE_HBL_Update(void);
 
 extern void DmaSnd_SoundControl_ReadWord(void);
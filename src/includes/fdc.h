@@ -45,6 +45,8 @@
 #define	FDC_IRQ_SOURCE_OTHER			(1<<4)		/* IRQ set by other parts (IPF) */
 
 
+extern Uint32	FDC_BootSectorReads;
+
 extern void	FDC_MemorySnapShot_Capture ( bool bSave );
 extern void	FDC_Init ( void );
 extern void	FDC_Reset ( bool bCold );
@@ -55,6 +57,7 @@ extern void	FDC_ClearIRQ ( void );
 extern void	FDC_InterruptHandler_Update ( void );
 
 extern void	FDC_Drive_Set_BusyLed ( Uint8 SR );
+extern bool	FDC_IsBusy ( void );
 extern int	FDC_Get_Statusbar_Text ( char *text, size_t maxlen );
 extern void	FDC_Drive_Set_Enable ( int Drive , bool value );
 extern void	FDC_Drive_Set_NumberOfHeads ( int Drive , int NbrHeads );
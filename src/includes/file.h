@@ -20,8 +20,10 @@ extern bool File_DoesFileExtensionMatch(const char *pszFileName, const char *psz
 extern bool File_ChangeFileExtension(const char *Filename_old, const char *Extension_old , char *Filename_new , const char *Extension_new);
 extern const char *File_RemoveFileNameDrive(const char *pszFileName);
 extern bool File_DoesFileNameEndWithSlash(char *pszFileName);
+extern void HFile_SetPreloaded(const char *pszFileName, Uint8 *pData, long nSize);
 extern Uint8 *HFile_Read(const char *pszFileName, long *pFileSize, const char * const ppszExts[]);
 extern bool File_Save(const char *pszFileName, const Uint8 *pAddress, size_t Size, bool bQueryOverwrite);
+extern bool File_SaveReplace(const char *pszFileName, const Uint8 *pAddress, size_t Size);
 extern off_t File_Length(const char *pszFileName);
 extern bool File_Exists(const char *pszFileName);
 extern bool File_DirExists(const char *psDirName);
@@ -0,0 +1,34 @@
+/*
+  Hatari - fileWriter.h
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+*/
+
+#ifndef HATARI_FILEWRITER_H
+#define HATARI_FILEWRITER_H
+
+#define FILEWRITER_MAX_THREADS	8
+
+/* Growable output buffer of an encoded job */
+typedef struct {
+	Uint8 *pBuffer;
+	int nAlloc;
+	int nSize;
+} FILEWRITER_BUFFER;
+
+/* Writes one queued job to its file, return false on error */
+typedef bool (*FILEWRITER_FUNC)(Uint8 *pData, int nSize, void *pParam);
+/* Encodes one queued job to pOut (on any thread), return false on error */
+typedef bool (*FILEWRITER_ENCODE)(Uint8 *pData, int nSize, FILEWRITER_BUFFER *pOut, void *pParam);
+
+extern Uint8 *FileWriter_Begin(int nSize);
+extern bool FileWriter_Commit(FILEWRITER_FUNC pFunc, void *pParam);
+extern bool FileWriter_CommitEncode(FILEWRITER_ENCODE pEncode, FILEWRITER_FUNC pFunc, void *pParam);
+extern Uint8 *FileWriter_Reserve(FILEWRITER_BUFFER *pOut, int nSize);
+extern bool FileWriter_Flush(void);
+extern void FileWriter_SetThreads(int nThreads);
+extern void FileWriter_UnInit(void);
+extern void FileWriter_Info(Uint32 dummy);
+
+#endif /* ifndef HATARI_FILEWRITER_H */
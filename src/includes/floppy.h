@@ -26,11 +26,26 @@
 #define	FLOPPY_IMAGE_TYPE_IPF			4		/* handled by capsimage library */
 #define	FLOPPY_IMAGE_TYPE_STX			5
 
+/* Image data which is decoded into the drive buffer only on first access,
+ * in blocks of the image (usually tracks). The loader callback has to set
+ * pLoaded[] for each block it decoded, at least for the requested one. */
+typedef struct
+{
+	void *pData;					/* image loader private data */
+	int nBlockBytes;
+	int nBlocks;
+	int nUnloaded;					/* blocks not decoded yet */
+	Uint8 *pLoaded;					/* per block flag */
+	bool (*pLoadBlock)(void *pData, Uint8 *pBuffer, int nBlock, Uint8 *pLoaded);
+	void (*pFree)(void *pData);
+} FLOPPY_LAZY;
+
 /* Structure for each drive connected as emulation */
 typedef struct
 {
 	int ImageType;
 	Uint8 *pBuffer;
+	FLOPPY_LAZY *pLazy;				/* NULL when pBuffer is complete */
 	char sFileName[FILENAME_MAX];
 	int nImageBytes;
 	bool bDiskInserted;
@@ -59,6 +74,13 @@ extern const char* Floppy_SetDiskFileName(int Drive, const char *pszFileName, co
 extern int Floppy_DriveTransitionUpdateState ( int Drive );
 extern bool Floppy_InsertDiskIntoDrive(int Drive);
 extern bool Floppy_EjectDiskFromDrive(int Drive);
+extern void Floppy_Prefetch(const char *pszFileName);
+extern void Floppy_WriteBackFlush(const char *pszFileName);
+extern void Floppy_WriteBackCheck(void);
+extern bool Floppy_SetLazyImage(int Drive, Uint8 *pBuffer, void *pData, int nBlockBytes, int nBlocks,
+                                bool (*pLoadBlock)(void *pData, Uint8 *pBuffer, int nBlock, Uint8 *pLoaded),
+                                void (*pFree)(void *pData));
+extern void Floppy_LoadImage(int Drive, long nOffset, long nBytes);
 extern void Floppy_FindDiskDetails(const Uint8 *pBuffer, int nImageBytes, Uint16 *pnSectorsPerTrack, Uint16 *pnSides);
 extern bool Floppy_ReadSectors(int Drive, Uint8 **pBuffer, Uint16 Sector, Uint16 Track, Uint16 Side, short Count, int *pnSectorsPerTrack, int *pSectorSize);
 extern bool Floppy_WriteSectors(int Drive, Uint8 *pBuffer, Uint16 Sector, Uint16 Track, Uint16 Side, short Count, int *pnSectorsPerTrack, int *pSectorSize);
@@ -30,6 +30,7 @@ typedef struct {
 	Uint8		*pData;					/* Bytes for this sector or null if RNF */
 	Uint8		*pFuzzyData;				/* Fuzzy mask for this sector or null if no fuzzy bits */
 	Uint8		*pTimingData;				/* Data for variable bit width or null */
+	Uint16		*pByteTimings;				/* FDC cycles to read each byte, or null if RNF */
 
 	Sint32		SaveSectorIndex;			/* Index in STX_SaveStruct[].pSaveSectorsStruct or -1 if not used */
 } STX_SECTOR_STRUCT;
@@ -76,6 +77,11 @@ typedef struct {
 								/* consists of 2 bytes per 16 FDC bytes */
 
 	Sint32			SaveTrackIndex;			/* Index in STX_SaveStruct[].pSaveTracksStruct or -1 if not used */
+
+	/* Precomputed by STX_BuildStruct() for the FDC timings */
+	Uint32			TrackSize;			/* Number of bytes per revolution */
+	Uint16			*pSectorsOrder;			/* Sectors numbers sorted by ascending BitPosition */
+	Uint16			*pTrackImageTimings;		/* FDC cycles to read each byte of pTrackImageData */
 } STX_TRACK_STRUCT;
 
 #define	STX_TRACK_BLOCK_SIZE		( 4+4+2+2+2+1+1 )	/* Size of the track block in an STX file = 16 bytes */
@@ -99,6 +105,7 @@ typedef struct {
 
 	/* Other internal variables */
 	STX_TRACK_STRUCT	*pTracksStruct;
+	STX_TRACK_STRUCT	*pTracksIndex[ 256 ];		/* Track struct for each TrackNumber or null */
 
 	/* These variable are used to warn the user only one time if a write command is made */
 	bool		WarnedWriteSector;			/* True if a 'write sector' command was made and user was warned */
@@ -166,6 +173,7 @@ extern bool	STX_Insert ( int Drive , const char *FilenameSTX , Uint8 *pImageBuff
 extern bool	STX_Eject ( int Drive );
 
 extern STX_MAIN_STRUCT *STX_BuildStruct ( Uint8 *pFileBuffer , int Debug );
+extern void	STX_SetPrefetched ( Uint8 *pImageBuffer , STX_MAIN_STRUCT *pStxMain );
 
 
 extern Uint32	FDC_GetCyclesPerRev_FdcCycles_STX ( Uint8 Drive , Uint8 Track , Uint8 Side );
@@ -0,0 +1,48 @@
+/*
+  Hatari - hdImage.h
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+*/
+
+#ifndef HATARI_HDIMAGE_H
+#define HATARI_HDIMAGE_H
+
+#define HDIMAGE_SECTOR_SIZE	512
+
+/* Hard disk image shared by the ACSI/SCSI and IDE emulation */
+typedef struct {
+	FILE *fp;			/* NULL when no image is open */
+	Uint8 *pMap;			/* whole image mapped, or NULL */
+	Uint64 nSectors;
+	bool bReadOnly;
+	Uint64 nNextSector;		/* sector following the last read */
+	Uint64 nReadAhead;		/* end offset of the read-ahead window */
+	/* copy-on-write overlay, the image itself is then only read */
+	FILE *pOverlay;			/* modified sectors, or NULL */
+	Uint64 *pOvlSectors;		/* hash table of the modified sectors + 1 */
+	Uint32 *pOvlRecords;		/* their record index in the overlay file */
+	Uint32 nOvlMask;		/* hash table size - 1 */
+	Uint32 nOvlCount;		/* records in the overlay file */
+	/* transfer done in the background */
+	volatile int nAsyncState;	/* HDIMAGE_ASYNC_* */
+	bool bAsyncWrite;
+	Uint64 nAsyncSector;
+	Uint8 *pAsyncBuf;
+	int nAsyncCount;		/* sectors to transfer, then transferred */
+} HD_IMAGE;
+
+#define HDIMAGE_ASYNC_IDLE	0
+#define HDIMAGE_ASYNC_QUEUED	1
+#define HDIMAGE_ASYNC_DONE	2
+
+extern bool HdImage_Open(HD_IMAGE *pImg, const char *pszFileName, bool bAllowReadOnly,
+                         const char *pszOverlayName);
+extern void HdImage_Close(HD_IMAGE *pImg);
+extern int HdImage_Read(HD_IMAGE *pImg, Uint64 nSector, Uint8 *pBuf, int nCount);
+extern int HdImage_Write(HD_IMAGE *pImg, Uint64 nSector, const Uint8 *pBuf, int nCount);
+extern void HdImage_Flush(HD_IMAGE *pImg);
+extern void HdImage_Submit(HD_IMAGE *pImg, bool bWrite, Uint64 nSector, Uint8 *pBuf, int nCount);
+extern int HdImage_Complete(HD_IMAGE *pImg);
+
+#endif /* HATARI_HDIMAGE_H */
@@ -11,6 +11,7 @@
 #ifndef HATARI_HDC_H
 #define HATARI_HDC_H
 
+#include "hdImage.h"
 
 /* Opcodes */
 /* The following are multi-sector transfers with seek implied */
@@ -58,9 +59,12 @@ extern bool bAcsiEmuOn;
 extern bool HDC_Init(void);
 extern void HDC_UnInit(void);
 extern void HDC_ResetCommandStatus(void);
+extern void HDC_CancelTransfer(void);
+extern void HDC_InterruptHandler(void);
+extern void HDC_MemorySnapShot_Capture(bool bSave);
 extern short int HDC_ReadCommandByte(int addr);
 extern void HDC_WriteCommandByte(int addr, Uint8 byte);
-extern int HDC_PartitionCount(FILE *fp, const Uint64 tracelevel);
+extern int HDC_PartitionCount(HD_IMAGE *pImg, const Uint64 tracelevel);
 
 void Ncr5380_Reset(void);
 
@@ -0,0 +1,57 @@
+/*
+  Hatari - hotState.h
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+
+  The variables which the CPU loop reads or updates for every instruction
+  belong to different modules (cycles, interrupts, CPU glue, memory). They
+  are kept together in one cache line aligned structure, so that executing
+  an instruction touches one or two cache lines for them instead of one
+  per variable, and position independent code only needs a single base
+  address to reach all of them.
+
+  The modules still use the usual variable names, which are mapped to the
+  structure members by their headers.
+*/
+
+#ifndef HATARI_HOTSTATE_H
+#define HATARI_HOTSTATE_H
+
+#include <SDL_types.h>
+
+typedef struct
+{
+	/* cycInt.c */
+	int PendingInterruptCount;		/* cycles until the next interrupt */
+	void (*PendingInterruptFunction)(void);	/* handler of that interrupt */
+
+	/* cycles.c */
+	Uint64 CyclesGlobalClockCounter;	/* cycles since starting Hatari (never reset) */
+	int nCyclesMainCounter;			/* cycles since previous Cycles_UpdateCounters() */
+	int CurrentInstrCycles;
+
+	/* m68000.c */
+	int nCpuFreqShift;			/* 0=8MHz, 1=16MHz, 2=32Mhz */
+	int nWaitStateCycles;			/* wait states of certain IO registers */
+	int BusMode;				/* who owns the bus (cpu, blitter, ...) */
+	Uint32 BusErrorPC;			/* PC when a bus error occurs */
+	int LastOpcodeFamily;			/* see the enum in readcpu.h i_XXX */
+	int LastInstrCycles;			/* cycles of previous instr. (not rounded to 4) */
+	int Pairing;				/* 1 if the latest 2 instr. paired */
+
+	/* newcpu.c (of either CPU core) */
+	int OpcodeFamily;			/* family of the latest instruction */
+	int BusCyclePenalty;			/* extra cycles for misaligned accesses */
+
+	/* stMemory.c */
+	Uint8 *STRam;				/* ST RAM, ROM and IO memory */
+} HOT_STATE;
+
+#if defined(__GNUC__)
+extern HOT_STATE HotState __attribute__((aligned(64)));
+#else
+extern HOT_STATE HotState;
+#endif
+
+#endif /* HATARI_HOTSTATE_H */
@@ -14,11 +14,16 @@ extern int nIDEPartitions;
 
 extern void Ide_Init(void);
 extern void Ide_UnInit(void);
+extern void Ide_CompleteTransfer(void);
+extern void Ide_CancelTransfer(void);
+extern void Ide_InterruptHandler(void);
+extern void Ide_MemorySnapShot_Capture(bool bSave);
 extern uae_u32 Ide_Mem_bget(uaecptr addr);
 extern uae_u32 Ide_Mem_wget(uaecptr addr);
 extern uae_u32 Ide_Mem_lget(uaecptr addr);
 extern void Ide_Mem_bput(uaecptr addr, uae_u32 val);
 extern void Ide_Mem_wput(uaecptr addr, uae_u32 val);
 extern void Ide_Mem_lput(uaecptr addr, uae_u32 val);
+extern int Ide_Mem_ReadBurst(uaecptr addr, uae_u8 *dst, int size, int count);
 
 #endif /* HATARI_IDE_H */
@@ -15,6 +15,8 @@ typedef struct
 	const int SpanInBytes;    /* E.g. SIZE_BYTE, SIZE_WORD or SIZE_LONG */
 	void (*ReadFunc)(void);   /* Read function */
 	void (*WriteFunc)(void);  /* Write function */
+	const int ReadWaitStates;  /* Wait states always added before calling ReadFunc */
+	const int WriteWaitStates; /* Wait states always added before calling WriteFunc */
 } INTERCEPT_ACCESS_FUNC;
 
 extern const INTERCEPT_ACCESS_FUNC IoMemTable_ST[];
@@ -165,16 +165,16 @@ typedef struct {
 extern cpu_instruction_t CpuInstruction;
 
 extern Uint32 BusErrorAddress;
-extern Uint32 BusErrorPC;
+#define BusErrorPC HotState.BusErrorPC
 extern bool bBusErrorReadWrite;
-extern int nCpuFreqShift;
-extern int nWaitStateCycles;
-extern int BusMode;
+#define nCpuFreqShift HotState.nCpuFreqShift
+#define nWaitStateCycles HotState.nWaitStateCycles
+#define BusMode HotState.BusMode
 extern bool	CPU_IACK;
 
-extern int	LastOpcodeFamily;
-extern int	LastInstrCycles;
-extern int	Pairing;
+#define LastOpcodeFamily HotState.LastOpcodeFamily
+#define LastInstrCycles HotState.LastInstrCycles
+#define Pairing HotState.Pairing
 extern char	PairingArray[ MAX_OPCODE_FAMILY ][ MAX_OPCODE_FAMILY ];
 extern const char *OpcodeName[];
 
@@ -231,9 +231,10 @@ static inline void M68000_AddCyclesWithPairing(int cycles)
 	/* the previous one is of the form 4+2n */
 	/* If so, a pairing could be possible depending on the opcode */
 	/* A pairing is also possible if current instr is 4n but with BusCyclePenalty > 0 */
-	if ( ( PairingArray[ LastOpcodeFamily ][ OpcodeFamily ] == 1 )
+	/* (cheapest tests first, most instructions take 4n cycles) */
+	if ( ( ( ( cycles & 3 ) == 2 ) || ( BusCyclePenalty > 0 ) )
 	    && ( ( LastInstrCycles & 3 ) == 2 )
-	    && ( ( ( cycles & 3 ) == 2 ) || ( BusCyclePenalty > 0 ) ) )
+	    && ( PairingArray[ LastOpcodeFamily ][ OpcodeFamily ] == 1 ) )
 	{
 		Pairing = 1;
 		LOG_TRACE(TRACE_CPU_PAIRING,
@@ -290,14 +291,32 @@ static inline void M68000_AddCyclesWithPairing(int cycles)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * There seem to be wait states when a program accesses certain hardware
+ * registers on the ST. Use this function to simulate these wait states.
+ * [NP] with some instructions like CLR, we have a read then a write at the
+ * same location, so we may have 2 wait states (read and write) to add
+ * (nWaitStateCycles should be reset to 0 after the cycles were added).
+ */
+static inline void M68000_WaitState(int nCycles)
+{
+	M68000_SetSpecial(SPCFLAG_EXTRA_CYCLES);
+
+	nWaitStateCycles += nCycles;	/* add all the wait states for this instruction */
+}
+
+
 extern void M68000_Init(void);
 extern void M68000_Reset(bool bCold);
 extern void M68000_Start(void);
+extern void M68000_StartFrames(void);
+extern void M68000_RunFrame(void);
+extern void M68000_EndFrame(void);
 extern void M68000_CheckCpuSettings(void);
 extern void M68000_MemorySnapShot_Capture(bool bSave);
 extern void M68000_BusError(Uint32 addr, bool bReadWrite);
 extern void M68000_Exception(Uint32 ExceptionVector , int ExceptionSource);
-extern void M68000_WaitState(int nCycles);
 extern int M68000_WaitEClock ( void );
 
 #endif
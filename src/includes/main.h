@@ -49,12 +49,17 @@
 
 extern bool bQuitProgram;
 
+extern Sint64 Time_GetTicks(void);
 extern bool Main_PauseEmulation(bool visualize);
 extern bool Main_UnPauseEmulation(void);
 extern void Main_RequestQuit(int exitval);
 extern void Main_SetRunVBLs(Uint32 vbls);
+extern void Main_SetBenchmarkFile(const char *path);
 extern bool Main_SetVBLSlowdown(int factor);
 extern void Main_WaitOnVbl(void);
+#ifdef __LIBRETRO__
+extern bool Main_RunFrame(void);
+#endif
 extern void Main_WarpMouse(int x, int y);
 extern void Main_EventHandler(void);
 extern void Main_SetTitle(const char *title);
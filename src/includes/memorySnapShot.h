@@ -9,4 +9,9 @@
 extern void MemorySnapShot_Skip(int Nb);
 extern void MemorySnapShot_Store(void *pData, int Size);
 extern void MemorySnapShot_Capture(const char *pszFileName, bool bConfirm);
+extern void MemorySnapShot_CheckSaved(void);
 extern void MemorySnapShot_Restore(const char *pszFileName, bool bConfirm);
+extern int MemorySnapShot_TryCaptureMem(void *pBuffer, int nSize);
+extern int MemorySnapShot_CaptureMem(void *pBuffer, int nSize);
+extern bool MemorySnapShot_RestoreMem(const void *pBuffer, int nSize);
+extern int MemorySnapShot_Size(void);
@@ -0,0 +1,52 @@
+/*
+  Hatari - movie.h
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+*/
+
+#ifndef HATARI_MOVIE_H
+#define HATARI_MOVIE_H
+
+/* Input given to the emulation on one input update, besides key presses */
+typedef struct
+{
+	Uint8 nJoy0;		/* joystick port 0 ATARIJOY_BITMASK_* bits */
+	Uint8 nJoy1;		/* joystick port 1 bits */
+	Uint8 nFlags;		/* MOVIE_INPUT_* */
+	Sint16 nMouseDx;	/* host mouse motion */
+	Sint16 nMouseDy;
+} MOVIE_INPUT;
+
+#define MOVIE_INPUT_MOUSE	0x01	/* mouse motion and buttons were applied */
+#define MOVIE_INPUT_LBUTTON	0x02
+#define MOVIE_INPUT_RBUTTON	0x04
+#define MOVIE_INPUT_TWOJOYS	0x08	/* two joysticks, no mouse */
+
+extern bool bMovieRecording;
+extern bool bMoviePlaying;
+
+static inline bool Movie_IsRecording(void)
+{
+	return bMovieRecording;
+}
+
+static inline bool Movie_IsPlaying(void)
+{
+	return bMoviePlaying;
+}
+
+extern void Movie_Record(const char *name);
+extern void Movie_Play(const char *name);
+extern void Movie_Stop(void);
+extern void Movie_UnInit(void);
+extern int Movie_GetMismatches(void);
+
+/* for the frontend input and disk handling */
+extern void Movie_RecordKey(Uint8 nScanCode, bool bPress);
+extern void Movie_RecordInput(const MOVIE_INPUT *pInput);
+extern void Movie_RecordDisk(int nDrive, const char *pszFileName);
+extern bool Movie_PlayInput(MOVIE_INPUT *pInput);
+extern void Movie_FrameDone(void);
+
+#endif
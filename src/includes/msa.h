@@ -6,6 +6,6 @@
 */
 
 extern bool MSA_FileNameIsMSA(const char *pszFileName, bool bAllowGZ);
-extern Uint8 *MSA_UnCompress(Uint8 *pMSAFile, long *pImageSize);
+extern Uint8 *MSA_UnCompress(int Drive, Uint8 *pMSAFile, long nMSABytes, long *pImageSize);
 extern Uint8 *MSA_ReadDisk(int Drive, const char *pszFileName, long *pImageSize, int *pImageType);
 extern bool MSA_WriteDisk(int Drive, const char *pszFileName, Uint8 *pBuffer, int ImageSize);
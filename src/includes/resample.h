@@ -0,0 +1,39 @@
+/*
+  Hatari - resample.h
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+*/
+
+#ifndef HATARI_RESAMPLE_H
+#define HATARI_RESAMPLE_H
+
+#define RESAMPLE_TAPS		16	/* FIR length in input samples */
+#define RESAMPLE_PHASE_BITS	8
+#define RESAMPLE_PHASES		(1 << RESAMPLE_PHASE_BITS)	/* sub-sample positions */
+#define RESAMPLE_MAX_INPUT	512	/* input stereo samples per block */
+
+typedef struct {
+	Sint64 nStep;			/* input samples per output sample, 32.32 */
+	Sint16 Coefs[RESAMPLE_PHASES][RESAMPLE_TAPS];
+	/* RESAMPLE_TAPS previous input samples followed by the new block */
+	Sint16 Buffer[RESAMPLE_TAPS + RESAMPLE_MAX_INPUT][2];
+} RESAMPLER;
+
+extern void Resample_Reset(RESAMPLER *pRes);
+extern void Resample_SetStep(RESAMPLER *pRes, Sint64 nStep);
+extern void Resample_Push(RESAMPLER *pRes, Sint16 nLeft, Sint16 nRight);
+extern int Resample_BlockSize(const RESAMPLER *pRes, int nOut);
+extern int Resample_InputCount(const RESAMPLER *pRes, Sint64 nPhase, int nOut);
+extern void Resample_Process(RESAMPLER *pRes, Sint64 *pPhase, int nIn, Sint16 (*pOut)[2], int nOut);
+
+/**
+ * Return where the caller has to write the nIn new input samples
+ * of the next Resample_Process() block.
+ */
+static inline Sint16 (*Resample_Input(RESAMPLER *pRes))[2]
+{
+	return &pRes->Buffer[RESAMPLE_TAPS];
+}
+
+#endif
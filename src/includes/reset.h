@@ -10,5 +10,6 @@
 
 extern int Reset_Cold(void);
 extern int Reset_Warm(void);
+extern void Reset_SnapShot(void);
 
 #endif
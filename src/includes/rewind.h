@@ -0,0 +1,28 @@
+/*
+  Hatari - rewind.h
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+*/
+
+#ifndef HATARI_REWIND_H
+#define HATARI_REWIND_H
+
+typedef struct REWIND_RING REWIND_RING;
+
+extern REWIND_RING *Rewind_RingCreate(int nEntries);
+extern void Rewind_RingFree(REWIND_RING *pRing);
+extern void Rewind_RingClear(REWIND_RING *pRing);
+extern int Rewind_RingCount(REWIND_RING *pRing);
+extern bool Rewind_RingPush(REWIND_RING *pRing);
+extern bool Rewind_RingDrop(REWIND_RING *pRing);
+extern bool Rewind_RingRestore(REWIND_RING *pRing);
+
+extern bool Rewind_Init(int nEntries);
+extern void Rewind_UnInit(void);
+extern bool Rewind_IsEnabled(void);
+extern int Rewind_GetCount(void);
+extern bool Rewind_Push(void);
+extern bool Rewind_Back(void);
+
+#endif
@@ -0,0 +1,20 @@
+/*
+  Hatari - rowPool.h
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+*/
+
+#ifndef HATARI_ROWPOOL_H
+#define HATARI_ROWPOOL_H
+
+#define ROWPOOL_MAX_THREADS	8
+
+/* Converts rows nFirst to nLast-1 (on any thread) */
+typedef void (*ROWPOOL_FUNC)(int nFirst, int nLast, void *pParam);
+
+extern void RowPool_Run(int nRows, ROWPOOL_FUNC pFunc, void *pParam);
+extern void RowPool_SetThreads(int nThreads);
+extern void RowPool_UnInit(void);
+
+#endif /* ifndef HATARI_ROWPOOL_H */
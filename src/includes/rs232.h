@@ -13,6 +13,8 @@
 
 extern void RS232_Init(void);
 extern void RS232_UnInit(void);
+extern bool RS232_IsChannelName(const char *name);
+extern void RS232_Update(void);
 extern void RS232_HandleUCR(Sint16 ucr);
 extern bool RS232_SetBaudRate(int nBaud);
 extern void RS232_SetBaudRateFromTimerD(void);
@@ -10,6 +10,12 @@
 #ifndef HATARI_RTC_H
 #define HATARI_RTC_H
 
+#include <time.h>
+
+/* Date of the clocks at start in deterministic mode, 2000-01-01 00:00:00 */
+#define RTC_DETERMINISTIC_EPOCH 946684800
+
+extern struct tm *Rtc_GetTime(void);
 extern void Rtc_SecondsUnits_ReadByte(void);
 extern void Rtc_SecondsTens_ReadByte(void);
 extern void Rtc_MinutesUnits_ReadByte(void);
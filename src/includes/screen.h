@@ -61,8 +61,10 @@ typedef struct
 {
   Uint16 HBLPalettes[HBL_PALETTE_LINES];
   Uint32 HBLPaletteMasks[HBL_PALETTE_MASKS];
+  Uint64 HBLPaletteHashes[HBL_PALETTE_MASKS];
   Uint8 *pSTScreen;             /* Copy of screen built up during frame (copy each line on HBL to simulate monitor raster) */
   Uint8 *pSTScreenCopy;         /* Previous frames copy of above  */
+  Uint8 *pSTScreenRender;       /* Spare copy, read by the render thread */
   int OverscanModeCopy;         /* Previous screen overscan mode */
   bool bFullUpdate;             /* Set TRUE to cause full update on next draw */
 } FRAMEBUFFER;
@@ -100,6 +102,23 @@ enum
   OVERSCANMODE_BOTTOM    /* 0x02 (Top+Bottom) 0x03 */
 };
 
+/* Unconverted ST low/medium resolution frame, for hosts which decode
+ * the bitplanes themselves (see Screen_SetRawFrameHook()) */
+typedef struct {
+	const Uint8 *pScreen;          /* bitplanes of first line */
+	const Uint16 *pPalettes;       /* 16 ST colors for each line */
+	const Uint32 *pPaletteMasks;   /* HBLPaletteMasks[] of each line */
+	int nPitch;                    /* bytes between lines in pScreen */
+	int nWidthBytes;               /* bitplane bytes to show on each line */
+	int nLines;
+	int nOffsetX, nOffsetY;        /* position in host screen, in pixels */
+	bool bWide;                    /* 640 wide: low res pixels and lines doubled */
+	bool bDoubleY;                 /* fill the doubled lines, otherwise leave them black */
+} SCREEN_RAWFRAME;
+
+/* Shows given frame, returns false if it has to be converted as usual */
+typedef bool (*SCREEN_RAWFRAME_FUNC)(const SCREEN_RAWFRAME *pFrame);
+
 extern bool bGrabMouse;
 extern bool bInFullScreen;
 extern int nScreenZoomX, nScreenZoomY;
@@ -120,6 +139,10 @@ extern void Screen_EnterFullScreen(void);
 extern void Screen_ReturnFromFullScreen(void);
 extern void Screen_ModeChanged(void);
 extern bool Screen_Draw(void);
+extern void Screen_RenderSync(void);
+extern void Screen_EnableRenderThread(bool bEnable);
+extern void Screen_SetRawFrameHook(SCREEN_RAWFRAME_FUNC pFunc);
+extern void Screen_SetVDIChangedRows(int nFirst, int nEnd);
 extern bool Screen_SetSDLVideoSize(int width, int height, int bitdepth);
 
 extern bool bTTSampleHold;      /* TT special video mode */
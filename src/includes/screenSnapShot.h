@@ -14,6 +14,7 @@
 extern int ScreenSnapShot_SavePNG_ToFile(SDL_Surface *surface, FILE *fp, int png_compression_level, int png_filter ,
 		int CropLeft , int CropRight , int CropTop , int CropBottom );
 extern void ScreenSnapShot_SaveScreen(void);
+extern void ScreenSnapShot_UpdateBatch(void);
 
 #endif /* ifndef HATARI_SCREENSNAPSHOT_H */
 
@@ -44,21 +44,35 @@ typedef		yms16			ymsample;	/* Output samples are mono 16bits signed PCM */
 #define YM_LINEAR_MIXING		1		/* Use ymout1c5bit[] to build ymout5[] */
 #define YM_TABLE_MIXING			2		/* Use volumetable_original to build ymout5[] */
 #define YM_MODEL_MIXING			3		/* Use circuit analysis model to build ymout5[] */
+#define YM_COMPACT_MIXING		4		/* Use circuit analysis model with per voice tables */
 
 extern int	YmVolumeMixing;
 extern bool	UseLowPassFilter;
+extern bool	UseBlepSynthesis;
 
 extern void Sound_Init(void);
+extern void Sound_UnInit(void);
 extern void Sound_Reset(void);
 extern void Sound_ResetBufferIndex(void);
 extern void Sound_MemorySnapShot_Capture(bool bSave);
 extern void Sound_Update(bool FillFrame);
 extern void Sound_Update_VBL(void);
+extern void Sound_GenerateYMSamples(int nSamples);
 extern void Sound_WriteReg( int reg , Uint8 data );
+extern void Sound_JournalWriteReg( int reg , Uint8 data );
 extern bool Sound_BeginRecording(char *pszCaptureFileName);
 extern void Sound_EndRecording(void);
 extern bool Sound_AreWeRecording(void);
+extern void Sound_FrequencyChanged(void);
 extern void Sound_SetYmVolumeMixing(void);
+extern void Sound_EnableThread(bool bEnable);
+extern void Sound_ThreadSync(void);
+extern bool Sound_ThreadIsActive(void);
+extern int Sound_RingFill(void);
+extern int Sound_RingPeek(Sint16 **ppSamples);
+extern void Sound_RingAdvance(int nSamples);
+extern Uint32 Sound_RingTell(void);
+extern void Sound_RingTruncate(Uint32 nPos);
 extern ymsample Subsonic_IIR_HPF_Left(ymsample x0);
 extern ymsample Subsonic_IIR_HPF_Right(ymsample x0);
 
@@ -11,13 +11,13 @@
 #include "main.h"
 #include "sysdeps.h"
 #include "maccess.h"
+#include "hotState.h"
 
+#define STRam HotState.STRam
 #if ENABLE_SMALL_MEM
-extern Uint8 *STRam;
 extern uae_u8 *ROMmemory;
 # define RomMem (ROMmemory-0xe00000)
 #else
-extern Uint8 STRam[16*1024*1024];
 #define RomMem STRam
 #endif  /* ENABLE_SMALL_MEM */
 
@@ -37,6 +37,43 @@ extern Uint32 STRamEnd;
 # define STRAM_ADDR(Var)  ((unsigned long)STRam+((Uint32)(Var) & 0x00ffffff))
 #endif
 
+/* Optional tracking of written ST-RAM pages, see STMemory_SetDirtyTracking() */
+#define STMEMORY_PAGE_SHIFT	12			/* 4 KiB pages */
+#define STMEMORY_PAGE_SIZE	(1 << STMEMORY_PAGE_SHIFT)
+#define STMEMORY_PAGES		(0x1000000 >> STMEMORY_PAGE_SHIFT)
+
+extern bool STMemory_bDirtyTracking;
+extern bool STMemory_bSnapShotRamBackup;
+extern Uint32 STMemory_DirtyPages[STMEMORY_PAGES / 32];
+
+/**
+ * Mark the page containing given address as written.
+ * Caller needs to check that dirty tracking is enabled.
+ */
+static inline void STMemory_MarkDirtyPage(Uint32 addr)
+{
+	Uint32 page = (addr & 0xffffff) >> STMEMORY_PAGE_SHIFT;
+	STMemory_DirtyPages[page >> 5] |= 1 << (page & 31);
+}
+
+/**
+ * Mark pages of the given written memory area as dirty,
+ * if dirty page tracking is enabled.
+ */
+static inline void STMemory_MarkDirty(Uint32 addr, Uint32 size)
+{
+	Uint32 page, last;
+
+	if (!STMemory_bDirtyTracking || !size)
+		return;
+	page = (addr & 0xffffff) >> STMEMORY_PAGE_SHIFT;
+	last = ((addr + size - 1) & 0xffffff) >> STMEMORY_PAGE_SHIFT;
+	if (last < page)
+		last = STMEMORY_PAGES - 1;
+	for ( ; page <= last; page++)
+		STMemory_DirtyPages[page >> 5] |= 1 << (page & 31);
+}
+
 
 /**
  * Check whether given memory address and size are within
@@ -64,6 +101,7 @@ static inline bool STMemory_ValidArea(Uint32 addr, int size)
 static inline void STMemory_WriteLong(Uint32 Address, Uint32 Var)
 {
 	Address &= 0xffffff;
+	STMemory_MarkDirty(Address, 4);
 #if ENABLE_SMALL_MEM
 	if (Address >= 0xe00000)
 		do_put_mem_long(&ROMmemory[Address-0xe00000], Var);
@@ -82,6 +120,7 @@ static inline void STMemory_WriteLong(Uint32 Address, Uint32 Var)
 static inline void STMemory_WriteWord(Uint32 Address, Uint16 Var)
 {
 	Address &= 0xffffff;
+	STMemory_MarkDirty(Address, 2);
 #if ENABLE_SMALL_MEM
 	if (Address >= 0xe00000)
 		do_put_mem_word(&ROMmemory[Address-0xe00000], Var);
@@ -99,6 +138,8 @@ static inline void STMemory_WriteWord(Uint32 Address, Uint16 Var)
 static inline void STMemory_WriteByte(Uint32 Address, Uint8 Var)
 {
 	Address &= 0xffffff;
+	if (STMemory_bDirtyTracking)
+		STMemory_MarkDirtyPage(Address);
 #if ENABLE_SMALL_MEM
 	if (Address >= 0xe00000)
 		ROMmemory[Address-0xe00000] = Var;
@@ -163,8 +204,23 @@ static inline Uint8 STMemory_ReadByte(Uint32 Address)
 }
 
 
+extern bool STMemory_Init(void);
+extern void STMemory_UnInit(void);
+extern void STMemory_ReleaseUnused(void);
+extern void STMemory_SetHugePages(bool bEnable);
+extern void *STMemory_AllocLarge(size_t size);
+extern void STMemory_FreeLarge(void *mem, size_t size);
+extern void STMemory_ClearLarge(void *mem, size_t size);
 extern bool STMemory_SafeCopy(Uint32 addr, Uint8 *src, unsigned int len, const char *name);
 extern void STMemory_MemorySnapShot_Capture(bool bSave);
 extern void STMemory_SetDefaultConfig(void);
+extern void STMemory_SetDirtyTracking(bool bEnable);
+extern void STMemory_DirtyTracking_VBL(void);
+extern void STMemory_ClearDirtyPages(void);
+extern const Uint32 *STMemory_GetDirtyPages(bool bLastFrame);
+extern bool STMemory_IsDirty(Uint32 addr, Uint32 size, bool bLastFrame);
+extern void STMemory_MarkAllWritten(void);
+extern void STMemory_RamBackupFree(void);
+extern Uint32 STMemory_GetStateHash(void);
 
 #endif
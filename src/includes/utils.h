@@ -20,5 +20,17 @@ extern void    crc32_add_byte ( Uint32 *crc , Uint8 c );
 extern void    crc16_reset ( Uint16 *crc );
 extern void    crc16_add_byte ( Uint16 *crc , Uint8 c );
 
+#define HASH32_BASIS	0x811c9dc5	/* FNV-1a */
+#define HASH32_PRIME	0x01000193
+
+extern void    hash32_reset ( Uint32 *hash );
+extern void    hash32_add_block ( Uint32 *hash , const Uint8 *p , int len );
+
+#define HATARI_RAND_MAX	0x7fffffff
+
+extern void    Hatari_srand ( Uint32 seed );
+extern int     Hatari_rand ( void );
+extern void    Utils_MemorySnapShot_Capture ( bool bSave );
+
 
 #endif		/* HATARI_UTILS_H */
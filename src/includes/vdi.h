@@ -51,6 +51,7 @@ extern void VDI_SetResolution(int GEMColor, int WidthRequest, int HeightRequest)
 extern void AES_Info(Uint32 bShowOpcodes);
 extern void VDI_Info(Uint32 bShowOpcodes);
 extern bool VDI_AES_Entry(void);
+extern bool VDI_Accelerate(void);
 extern void VDI_LineA(Uint32 LineABase, Uint32 FontBase);
 extern void VDI_Complete(void);
 extern void VDI_Reset(void);
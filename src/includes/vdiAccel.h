@@ -0,0 +1,18 @@
+/*
+  Hatari - vdiAccel.h
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+*/
+
+#ifndef HATARI_VDIACCEL_H
+#define HATARI_VDIACCEL_H
+
+extern bool bVdiAccel;
+
+extern void VDIAccel_Reset(void);
+extern void VDIAccel_OpenWorkstation(Uint16 handle, Uint32 intin);
+extern bool VDIAccel_Call(Uint16 opcode, Uint32 control, Uint32 intin, Uint32 ptsin);
+extern void VDIAccel_MemorySnapShot_Capture(bool bSave);
+
+#endif  /* HATARI_VDIACCEL_H */
@@ -113,6 +113,11 @@
 extern int STRes;
 extern int TTRes;
 extern int nFrameSkips;
+extern bool bVideoHeadless;
+extern int nVideoHeadlessSample;
+extern bool bVideoFrameRequested;
+extern bool bVideoFrameHidden;
+extern bool bVideoFrameSpeculative;
 extern bool bUseHighRes;
 extern int nVBLs;
 extern int nHBL;
@@ -123,6 +128,7 @@ extern Uint16 HBLPalettes[HBL_PALETTE_LINES];
 extern Uint16 *pHBLPalettes;
 extern Uint32 HBLPaletteMasks[HBL_PALETTE_MASKS];
 extern Uint32 *pHBLPaletteMasks;
+extern Uint64 HBLPaletteHashes[HBL_PALETTE_MASKS];
 extern Uint32 VideoBase;
 extern int nScreenRefreshRate;
 
@@ -168,6 +174,7 @@ extern void	Video_GetTTRes(int *width, int *height, int *bpp);
 extern bool	Video_RenderTTScreen(void);
 
 extern void	Video_AddInterruptTimerB ( int Pos );
+extern void	Video_StartTimerB ( void );
 
 extern void	Video_StartInterrupts ( int PendingCyclesOver );
 extern void	Video_InterruptHandler_VBL(void);
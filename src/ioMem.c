@@ -36,11 +36,38 @@ const char IoMem_fileid[] = "Hatari ioMem.c : " __DATE__ " " __TIME__;
 #include "ioMemTables.h"
 #include "memorySnapShot.h"
 #include "m68000.h"
+#include "stats.h"
 #include "sysdeps.h"
 
 
-static void (*pInterceptReadTable[0x8000])(void);     /* Table with read access handlers */
-static void (*pInterceptWriteTable[0x8000])(void);    /* Table with write access handlers */
+/* While setting up the handlers, there's one function pointer per address.
+ * These tables are then compacted, so that the accesses only need a small
+ * index per address into the list of the distinct handlers. */
+static void (**pInterceptReadTable)(void);            /* Table with read access handlers */
+static void (**pInterceptWriteTable)(void);           /* Table with write access handlers */
+
+#define IOMEM_MAX_HANDLERS 256
+typedef struct
+{
+	Uint8 Index[0x8000];                          /* Handler index for each address */
+	void (*Handlers[IOMEM_MAX_HANDLERS])(void);   /* Distinct handlers */
+	Uint8 WaitStates[IOMEM_MAX_HANDLERS];         /* Static wait states of each handler */
+	int nHandlers;
+} IOMEM_DISPATCH;
+
+static IOMEM_DISPATCH IoMemRead, IoMemWrite;
+
+/* Add the handler's static wait states, then call it */
+static inline void IoMem_CallHandler(const IOMEM_DISPATCH *pDispatch, Uint32 idx)
+{
+	int n = pDispatch->Index[idx];
+
+	if (pDispatch->WaitStates[n])
+		M68000_WaitState(pDispatch->WaitStates[n]);
+	pDispatch->Handlers[n]();
+}
+
+#define IOMEM_READ_HANDLER(idx)   (IoMemRead.Handlers[IoMemRead.Index[idx]])
 
 int nIoMemAccessSize;                                 /* Set to 1, 2 or 4 according to byte, word or long word access */
 Uint32 IoAccessBaseAddress;                           /* Stores the base address of the IO mem access */
@@ -59,8 +86,15 @@ static enum {
  */
 void IoMem_MemorySnapShot_Capture(bool bSave)
 {
+	int nOldBusMode = falconBusMode;
+
 	/* Save/Restore details */
 	MemorySnapShot_Store(&falconBusMode, sizeof(falconBusMode));
+
+	/* The Falcon IO tables depend on the bus mode */
+	if (!bSave && falconBusMode != nOldBusMode
+	    && ConfigureParams.System.nMachineType == MACHINE_FALCON)
+		IoMem_Init();
 }
 
 /*-----------------------------------------------------------------------*/
@@ -87,11 +121,75 @@ static void IoMem_SetBusErrorRegion(Uint32 startaddr, Uint32 endaddr)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Return the static wait states of given read or write handler
+ * in the machine's IO table.
+ */
+static int IoMem_GetWaitStates(const INTERCEPT_ACCESS_FUNC *pInterceptAccessFuncs,
+                               void (*pHandler)(void), bool bWrite)
+{
+	int i;
+
+	for (i = 0; pInterceptAccessFuncs[i].Address != 0; i++)
+	{
+		if (!bWrite && pInterceptAccessFuncs[i].ReadFunc == pHandler)
+			return pInterceptAccessFuncs[i].ReadWaitStates;
+		if (bWrite && pInterceptAccessFuncs[i].WriteFunc == pHandler)
+			return pInterceptAccessFuncs[i].WriteWaitStates;
+	}
+	return 0;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Compact given 'intercept' table into dispatch table.
+ */
+static void IoMem_BuildDispatch(IOMEM_DISPATCH *pDispatch, void (**pTable)(void),
+                                const INTERCEPT_ACCESS_FUNC *pInterceptAccessFuncs, bool bWrite)
+{
+	int i, n = 0;
+	Uint32 idx;
+
+	pDispatch->nHandlers = 0;
+	for (idx = 0; idx < 0x8000; idx++)
+	{
+		/* neighbour addresses usually share the handler */
+		if (pDispatch->nHandlers == 0 || pDispatch->Handlers[n] != pTable[idx])
+		{
+			for (n = 0; n < pDispatch->nHandlers; n++)
+			{
+				if (pDispatch->Handlers[n] == pTable[idx])
+					break;
+			}
+			if (n == pDispatch->nHandlers)
+			{
+				if (n == IOMEM_MAX_HANDLERS)
+				{
+					fprintf(stderr, "IoMem_Init: too many IO handlers!\n");
+					abort();
+				}
+				pDispatch->WaitStates[n] = IoMem_GetWaitStates(pInterceptAccessFuncs, pTable[idx], bWrite);
+				pDispatch->Handlers[pDispatch->nHandlers++] = pTable[idx];
+			}
+		}
+		pDispatch->Index[idx] = n;
+	}
+	for (i = pDispatch->nHandlers; i < IOMEM_MAX_HANDLERS; i++)
+	{
+		pDispatch->Handlers[i] = NULL;
+		pDispatch->WaitStates[i] = 0;
+	}
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Create 'intercept' tables for hardware address access. Each 'intercept
  * table is a list of 0x8000 pointers to a list of functions to call when
- * that location in the ST's memory is accessed. 
+ * that location in the ST's memory is accessed. The tables are then
+ * compacted into the dispatch tables used for the actual accesses.
  */
 void IoMem_Init(void)
 {
@@ -99,6 +197,14 @@ void IoMem_Init(void)
 	int i;
 	const INTERCEPT_ACCESS_FUNC *pInterceptAccessFuncs = NULL;
 
+	pInterceptReadTable = malloc(0x8000 * sizeof(*pInterceptReadTable));
+	pInterceptWriteTable = malloc(0x8000 * sizeof(*pInterceptWriteTable));
+	if (!pInterceptReadTable || !pInterceptWriteTable)
+	{
+		fprintf(stderr, "IoMem_Init: out of memory!\n");
+		exit(1);
+	}
+
 	/* Set default IO access handler (-> bus error) */
 	IoMem_SetBusErrorRegion(0xff8000, 0xffffff);
 
@@ -228,6 +334,13 @@ void IoMem_Init(void)
 
 		}
 	}
+
+	IoMem_BuildDispatch(&IoMemRead, pInterceptReadTable, pInterceptAccessFuncs, false);
+	IoMem_BuildDispatch(&IoMemWrite, pInterceptWriteTable, pInterceptAccessFuncs, true);
+
+	free(pInterceptReadTable);
+	free(pInterceptWriteTable);
+	pInterceptReadTable = pInterceptWriteTable = NULL;
 }
 
 /*-----------------------------------------------------------------------*/
@@ -272,11 +385,12 @@ uae_u32 IoMem_bget(uaecptr addr)
 	}
 
 	IoAccessBaseAddress = addr;                   /* Store access location */
+	Stats_AddIo(addr);
 	nIoMemAccessSize = SIZE_BYTE;
 	nBusErrorAccesses = 0;
 
 	IoAccessCurrentAddress = addr;
-	pInterceptReadTable[addr-0xff8000]();         /* Call handler */
+	IoMem_CallHandler(&IoMemRead, addr-0xff8000); /* Call handler */
 
 	/* Check if we read from a bus-error region */
 	if (nBusErrorAccesses == 1)
@@ -317,17 +431,18 @@ uae_u32 IoMem_wget(uaecptr addr)
 	}
 
 	IoAccessBaseAddress = addr;                   /* Store for exception frame */
+	Stats_AddIo(addr);
 	nIoMemAccessSize = SIZE_WORD;
 	nBusErrorAccesses = 0;
 	idx = addr - 0xff8000;
 
 	IoAccessCurrentAddress = addr;
-	pInterceptReadTable[idx]();                   /* Call 1st handler */
+	IoMem_CallHandler(&IoMemRead, idx);          /* Call 1st handler */
 
-	if (pInterceptReadTable[idx+1] != pInterceptReadTable[idx])
+	if (IoMemRead.Index[idx+1] != IoMemRead.Index[idx])
 	{
 		IoAccessCurrentAddress = addr + 1;
-		pInterceptReadTable[idx+1]();             /* Call 2nd handler */
+		IoMem_CallHandler(&IoMemRead, idx+1);    /* Call 2nd handler */
 	}
 
 	/* Check if we completely read from a bus-error region */
@@ -370,19 +485,20 @@ uae_u32 IoMem_lget(uaecptr addr)
 	}
 
 	IoAccessBaseAddress = addr;                   /* Store for exception frame */
+	Stats_AddIo(addr);
 	nIoMemAccessSize = SIZE_LONG;
 	nBusErrorAccesses = 0;
 	idx = addr - 0xff8000;
 
 	IoAccessCurrentAddress = addr;
-	pInterceptReadTable[idx]();                   /* Call 1st handler */
+	IoMem_CallHandler(&IoMemRead, idx);          /* Call 1st handler */
 
 	for (n = 1; n < nIoMemAccessSize; n++)
 	{
-		if (pInterceptReadTable[idx+n] != pInterceptReadTable[idx+n-1])
+		if (IoMemRead.Index[idx+n] != IoMemRead.Index[idx+n-1])
 		{
 			IoAccessCurrentAddress = addr + n;
-			pInterceptReadTable[idx+n]();     /* Call n-th handler */
+			IoMem_CallHandler(&IoMemRead, idx+n); /* Call n-th handler */
 		}
 	}
 
@@ -419,13 +535,14 @@ void IoMem_bput(uaecptr addr, uae_u32 val)
 	}
 
 	IoAccessBaseAddress = addr;                   /* Store for exception frame, just in case */
+	Stats_AddIo(addr);
 	nIoMemAccessSize = SIZE_BYTE;
 	nBusErrorAccesses = 0;
 
 	IoMem[addr] = val;
 
 	IoAccessCurrentAddress = addr;
-	pInterceptWriteTable[addr-0xff8000]();        /* Call handler */
+	IoMem_CallHandler(&IoMemWrite, addr-0xff8000); /* Call handler */
 
 	/* Check if we wrote to a bus-error region */
 	if (nBusErrorAccesses == 1)
@@ -460,6 +577,7 @@ void IoMem_wput(uaecptr addr, uae_u32 val)
 	}
 
 	IoAccessBaseAddress = addr;                   /* Store for exception frame, just in case */
+	Stats_AddIo(addr);
 	nIoMemAccessSize = SIZE_WORD;
 	nBusErrorAccesses = 0;
 
@@ -467,12 +585,12 @@ void IoMem_wput(uaecptr addr, uae_u32 val)
 	idx = addr - 0xff8000;
 
 	IoAccessCurrentAddress = addr;
-	pInterceptWriteTable[idx]();                  /* Call 1st handler */
+	IoMem_CallHandler(&IoMemWrite, idx);         /* Call 1st handler */
 
-	if (pInterceptWriteTable[idx+1] != pInterceptWriteTable[idx])
+	if (IoMemWrite.Index[idx+1] != IoMemWrite.Index[idx])
 	{
 		IoAccessCurrentAddress = addr + 1;
-		pInterceptWriteTable[idx+1]();            /* Call 2nd handler */
+		IoMem_CallHandler(&IoMemWrite, idx+1);   /* Call 2nd handler */
 	}
 
 	/* Check if we wrote to a bus-error region */
@@ -509,6 +627,7 @@ void IoMem_lput(uaecptr addr, uae_u32 val)
 	}
 
 	IoAccessBaseAddress = addr;                   /* Store for exception frame, just in case */
+	Stats_AddIo(addr);
 	nIoMemAccessSize = SIZE_LONG;
 	nBusErrorAccesses = 0;
 
@@ -516,14 +635,14 @@ void IoMem_lput(uaecptr addr, uae_u32 val)
 	idx = addr - 0xff8000;
 
 	IoAccessCurrentAddress = addr;
-	pInterceptWriteTable[idx]();                  /* Call first handler */
+	IoMem_CallHandler(&IoMemWrite, idx);         /* Call first handler */
 
 	for (n = 1; n < nIoMemAccessSize; n++)
 	{
-		if (pInterceptWriteTable[idx+n] != pInterceptWriteTable[idx+n-1])
+		if (IoMemWrite.Index[idx+n] != IoMemWrite.Index[idx+n-1])
 		{
 			IoAccessCurrentAddress = addr + n;
-			pInterceptWriteTable[idx+n]();   /* Call n-th handler */
+			IoMem_CallHandler(&IoMemWrite, idx+n); /* Call n-th handler */
 		}
 	}
 
@@ -592,7 +711,7 @@ void IoMem_VoidRead(void)
 	/* handler is probably called only once, so we have to take care of the neighbour "void IO registers" */
 	for (a = IoAccessBaseAddress; a < IoAccessBaseAddress + nIoMemAccessSize; a++)
 	{
-		if (pInterceptReadTable[a - 0xff8000] == IoMem_VoidRead)
+		if (IOMEM_READ_HANDLER(a - 0xff8000) == IoMem_VoidRead)
 		{
 			IoMem[a] = 0xff;
 		}
@@ -612,7 +731,7 @@ void IoMem_VoidRead_00(void)
 	/* handler is probably called only once, so we have to take care of the neighbour "void IO registers" */
 	for (a = IoAccessBaseAddress; a < IoAccessBaseAddress + nIoMemAccessSize; a++)
 	{
-		if (pInterceptReadTable[a - 0xff8000] == IoMem_VoidRead_00)
+		if (IOMEM_READ_HANDLER(a - 0xff8000) == IoMem_VoidRead_00)
 		{
 			IoMem[a] = 0x00;
 		}
@@ -17,6 +17,7 @@ const char Joy_fileid[] = "Hatari joy.c : " __DATE__ " " __TIME__;
 #include "ioMem.h"
 #include "joy.h"
 #include "log.h"
+#include "reverse.h"
 #include "screen.h"
 #include "video.h"
 #include "statusbar.h"
@@ -185,10 +186,8 @@ static bool Joy_ReadJoystick(int nSdlJoyID, JOYREADING *pJoyReading)
 /**
  * Read PC joystick and return ST format byte, i.e. lower 4 bits direction
  * and top bit fire.
- * NOTE : ID 0 is Joystick 0/Mouse and ID 1 is Joystick 1 (default),
- *        ID 2 and 3 are STE joypads and ID 4 and 5 are parport joysticks.
  */
-Uint8 Joy_GetStickData(int nStJoyId)
+static Uint8 Joy_ReadStickData(int nStJoyId)
 {
 	Uint8 nData = 0;
 	JOYREADING JoyReading;
@@ -277,6 +276,23 @@ Uint8 Joy_GetStickData(int nStJoyId)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Return ST format joystick byte for given ST joystick (journaled
+ * for the debugger reverse execution when that is enabled).
+ * NOTE : ID 0 is Joystick 0/Mouse and ID 1 is Joystick 1 (default),
+ *        ID 2 and 3 are STE joypads and ID 4 and 5 are parport joysticks.
+ */
+Uint8 Joy_GetStickData(int nStJoyId)
+{
+	Uint8 nData = Joy_ReadStickData(nStJoyId);
+
+	if (Reverse_IsEnabled())
+		nData = Reverse_InputValue(nData);
+	return nData;
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Get the fire button states.
@@ -315,6 +331,8 @@ static int Joy_GetFireButtons(int nStJoyId)
 		}
 	}
 
+	if (Reverse_IsEnabled())
+		nButtons = Reverse_InputValue(nButtons);
 	return nButtons;
 }
 
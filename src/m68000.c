@@ -84,17 +84,14 @@ const char M68000_fileid[] = "Hatari m68000.c : " __DATE__ " " __TIME__;
 /* information about current CPU instruction */
 cpu_instruction_t CpuInstruction;
 
+/* variables used for every instruction, see hotState.h
+ * (BusMode and LastOpcodeFamily are set in M68000_Init) */
+HOT_STATE HotState;
+
 Uint32 BusErrorAddress;         /* Stores the offending address for bus-/address errors */
-Uint32 BusErrorPC;              /* Value of the PC when bus error occurs */
 bool bBusErrorReadWrite;        /* 0 for write error, 1 for read error */
-int nCpuFreqShift;              /* Used to emulate higher CPU frequencies: 0=8MHz, 1=16MHz, 2=32Mhz */
-int nWaitStateCycles;           /* Used to emulate the wait state cycles of certain IO registers */
-int BusMode = BUS_MODE_CPU;	/* Used to tell which part is owning the bus (cpu, blitter, ...) */
 bool CPU_IACK = false;		/* Set to true during an exception when getting the interrupt's vector number */
 
-int LastOpcodeFamily = i_NOP;	/* see the enum in readcpu.h i_XXX */
-int LastInstrCycles = 0;	/* number of cycles for previous instr. (not rounded to 4) */
-int Pairing = 0;		/* set to 1 if the latest 2 intr paired */
 char PairingArray[ MAX_OPCODE_FAMILY ][ MAX_OPCODE_FAMILY ];
 
 
@@ -210,6 +207,9 @@ void M68000_Init(void)
 
 	/* Init the pairing matrix */
 	M68000_InitPairing();
+
+	BusMode = BUS_MODE_CPU;
+	LastOpcodeFamily = i_NOP;
 }
 
 
@@ -245,11 +245,10 @@ void M68000_Reset(bool bCold)
 
 /*-----------------------------------------------------------------------*/
 /**
- * Start 680x0 emulation
+ * Load initial memory snapshot, if one was requested
  */
-void M68000_Start(void)
+static void M68000_LoadInitialSnapShot(void)
 {
-	/* Load initial memory snapshot */
 	if (bLoadMemorySave)
 	{
 		MemorySnapShot_Restore(ConfigureParams.Memory.szMemoryCaptureFileName, false);
@@ -258,11 +257,53 @@ void M68000_Start(void)
 	{
 		MemorySnapShot_Restore(ConfigureParams.Memory.szAutoSaveFileName, false);
 	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Start 680x0 emulation
+ */
+void M68000_Start(void)
+{
+	M68000_LoadInitialSnapShot();
 
 	m68k_go(true);
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Start 680x0 emulation frame by frame: the frames are then emulated
+ * one at a time by M68000_RunFrame().
+ */
+void M68000_StartFrames(void)
+{
+	M68000_LoadInitialSnapShot();
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Run 680x0 emulation up to the end of the current frame (see
+ * M68000_EndFrame()), or until the emulation is quit.
+ */
+void M68000_RunFrame(void)
+{
+	m68k_go(true);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Make M68000_RunFrame() return after the current instruction.
+ */
+void M68000_EndFrame(void)
+{
+	m68k_end_frame();
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Check whether CPU settings have been changed.
@@ -502,23 +543,6 @@ void M68000_Exception(Uint32 ExceptionVector , int ExceptionSource)
 }
 
 
-/*-----------------------------------------------------------------------*/
-/**
- * There seem to be wait states when a program accesses certain hardware
- * registers on the ST. Use this function to simulate these wait states.
- * [NP] with some instructions like CLR, we have a read then a write at the
- * same location, so we may have 2 wait states (read and write) to add
- * (nWaitStateCycles should be reset to 0 after the cycles were added).
- */
-void M68000_WaitState(int nCycles)
-{
-	M68000_SetSpecial(SPCFLAG_EXTRA_CYCLES);
-
-	nWaitStateCycles += nCycles;	/* add all the wait states for this instruction */
-}
-
-
-
 /*-----------------------------------------------------------------------*/
 /**
  * Some components (HBL/VBL interrupts, access to the ACIA) require an
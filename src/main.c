@@ -20,6 +20,7 @@ const char Main_fileid[] = "Hatari main.c : " __DATE__ " " __TIME__;
 #include "dialog.h"
 #include "audio.h"
 #include "joy.h"
+#include "fileWriter.h"
 #include "floppy.h"
 #include "floppy_ipf.h"
 #include "gemdos.h"
@@ -40,6 +41,7 @@ const char Main_fileid[] = "Hatari main.c : " __DATE__ " " __TIME__;
 #include "reset.h"
 #include "resolution.h"
 #include "rs232.h"
+#include "rowPool.h"
 #include "screen.h"
 #include "sdlgui.h"
 #include "shortcut.h"
@@ -49,9 +51,20 @@ const char Main_fileid[] = "Hatari main.c : " __DATE__ " " __TIME__;
 #include "stMemory.h"
 #include "str.h"
 #include "tos.h"
+#include "utils.h"
 #include "video.h"
 #include "avi_record.h"
 #include "debugui.h"
+#include "gdbstub.h"
+#include "heatmap.h"
+#include "history.h"
+#include "natfeats.h"
+#include "stats.h"
+#include "perf.h"
+#include "timeline.h"
+#include "microbench.h"
+#include "movie.h"
+#include "reverse.h"
 #include "clocks_timings.h"
 
 #include "hatari-glue.h"
@@ -71,6 +84,10 @@ const char Main_fileid[] = "Hatari main.c : " __DATE__ " " __TIME__;
 #include "gui-win/opencon.h"
 #endif
 
+#if HAVE_SYS_RESOURCE_H
+#include <sys/resource.h>
+#endif
+
 bool bQuitProgram = false;                /* Flag to quit program cleanly */
 static int nQuitValue;                    /* exit value */
 
@@ -79,8 +96,21 @@ static Uint32 nFirstMilliTick;            /* Ticks when VBL counting started */
 static Uint32 nVBLCount;                  /* Frame count */
 static int nVBLSlowdown = 1;		  /* host VBL wait multiplier */
 
+static const char *BenchmarkFile;         /* Where to write benchmark results */
+static Sint64 nBenchmarkStartTicks;       /* Host time of first benchmarked VBL */
+static Uint32 nBenchmarkStartMilliTick;
+static Uint32 nBenchmarkVBLs;
+
 static bool bEmulationActive = true;      /* Run emulation when started */
 static bool bAccurateDelays;              /* Host system has an accurate SDL_Delay()? */
+#if HAVE_CLOCK_NANOSLEEP
+static Sint64 nWakeJitter = 1000;         /* Host wake-up latency budget in micro sec */
+#endif
+static Sint64 nFrameStartTicks;           /* Host time when emulating the frame started */
+#ifdef __LIBRETRO__
+static bool bFrameEnded;                  /* Frame ended on VBL, Main_SyncVbl() still to do */
+static Sint64 nFrameWorkTicks;            /* Host time spent on emulating that frame */
+#endif
 static bool bIgnoreNextMouseMotion = false;  /* Next mouse motion will be ignored (needed after SDL_WarpMouse) */
 
 #ifndef __LIBRETRO__
@@ -124,15 +154,20 @@ static Uint32 Main_GetTicks(void)
 /*-----------------------------------------------------------------------*/
 /**
  * Return a time counter in micro seconds.
- * If gettimeofday is available, we use it directly, else we convert the
+ * If clock_nanosleep is available, we use the monotonic clock that it
+ * sleeps on, else gettimeofday if available, else we convert the
  * return of SDL_GetTicks in micro sec.
  */
 
-static Sint64	Time_GetTicks ( void )
+Sint64	Time_GetTicks ( void )
 {
 	Sint64	ticks_micro;
 
-#if HAVE_GETTIMEOFDAY
+#if HAVE_CLOCK_NANOSLEEP
+	struct timespec	now;
+	clock_gettime ( CLOCK_MONOTONIC , &now );
+	ticks_micro = (Sint64)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+#elif HAVE_GETTIMEOFDAY
 	struct timeval	now;
 	gettimeofday ( &now , NULL );
 	ticks_micro = (Sint64)now.tv_sec * 1000000 + now.tv_usec;
@@ -170,6 +205,24 @@ static void	Time_Delay ( Sint64 ticks_micro )
 }
 
 
+#if HAVE_CLOCK_NANOSLEEP
+/*-----------------------------------------------------------------------*/
+/**
+ * Sleep until the given Time_GetTicks() value. As the deadline is absolute,
+ * the time spent before sleeping and interruptions by signals don't add up.
+ */
+
+static void	Time_SleepUntil ( Sint64 ticks_micro )
+{
+	struct timespec	ts;
+	ts.tv_sec = ticks_micro / 1000000;
+	ts.tv_nsec = (ticks_micro % 1000000) * 1000;	/* micro sec -> nano sec */
+	while ( clock_nanosleep ( CLOCK_MONOTONIC , TIMER_ABSTIME , &ts , NULL ) == EINTR )
+		;
+}
+#endif
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Pause emulation, stop sound.  'visualize' should be set true,
@@ -184,6 +237,7 @@ bool Main_PauseEmulation(bool visualize)
 
 	Audio_EnableAudio(false);
 	bEmulationActive = false;
+	Screen_RenderSync();
 	if (visualize)
 	{
 		if (nFirstMilliTick)
@@ -223,7 +277,8 @@ bool Main_UnPauseEmulation(void)
 		return false;
 
 	Sound_BufferIndexNeedReset = true;
-	Audio_EnableAudio(ConfigureParams.Sound.bEnableSound);
+	/* Nobody listens in headless mode */
+	Audio_EnableAudio(ConfigureParams.Sound.bEnableSound && !bVideoHeadless);
 	bEmulationActive = true;
 
 	/* Cause full screen update (to clear all) */
@@ -267,6 +322,56 @@ pauseg=-1;
 	nQuitValue = exitval;
 }
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Set file where benchmark results are written as JSON on exit,
+ * and enable the frame statistics counters for them.
+ */
+void Main_SetBenchmarkFile(const char *path)
+{
+	BenchmarkFile = path;
+	Stats_Enable(true);
+}
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Write speed, frame statistics totals and peak memory use since
+ * the first VBL to the benchmark file.
+ */
+static void Main_WriteBenchmark(void)
+{
+	double seconds, cpu_seconds;
+	long peak_rss = 0;
+	FILE *fp;
+
+	if (!BenchmarkFile || !nBenchmarkVBLs)
+		return;
+
+	seconds = (Time_GetTicks() - nBenchmarkStartTicks) / 1000000.0;
+	cpu_seconds = (Main_GetTicks() - nBenchmarkStartMilliTick) / 1000.0;
+#if HAVE_SYS_RESOURCE_H
+	{
+		struct rusage usage;
+		if (getrusage(RUSAGE_SELF, &usage) == 0)
+			peak_rss = usage.ru_maxrss;
+	}
+#endif
+	fp = fopen(BenchmarkFile, "w");
+	if (!fp)
+	{
+		fprintf(stderr, "ERROR: can't write benchmark results to '%s'\n", BenchmarkFile);
+		return;
+	}
+	fprintf(fp, "{\n  \"vbls\": %u,\n  \"seconds\": %.3f,\n  \"cpu_seconds\": %.3f,\n"
+	        "  \"vbl_per_second\": %.1f,\n  \"peak_rss_kb\": %ld,\n",
+	        nBenchmarkVBLs, seconds, cpu_seconds,
+	        seconds > 0.0 ? nBenchmarkVBLs / seconds : 0.0, peak_rss);
+	Stats_WriteJson(fp);
+	fprintf(fp, "\n}\n");
+	fclose(fp);
+	BenchmarkFile = NULL;
+}
+
 /*-----------------------------------------------------------------------*/
 /**
  * Set how many VBLs Hatari should run, from the moment this function
@@ -296,7 +401,58 @@ bool Main_SetVBLSlowdown(int factor)
 
 /*-----------------------------------------------------------------------*/
 /**
- * This function waits on each emulated VBL to synchronize the real time
+ * Adaptive frameskip: adjust the number of frames which aren't drawn
+ * according to the host time spent emulating each frame (without the
+ * VBL wait). Only the screen conversion is skipped, sound and the
+ * emulated timings don't depend on it. The average includes the skipped
+ * frames, so each change is held until it shows up in the average.
+ */
+static void Main_AdaptFrameSkip(Sint64 nWorkTicks, Sint64 nFrameDuration)
+{
+	static Sint64 nWorkAverage;
+	static int nHoldFrames;
+	static bool bWasFastForward;
+	int nMaxSkips = ConfigureParams.Screen.nFrameSkips;
+
+	if (nMaxSkips < AUTO_FRAMESKIP_LIMIT)
+		nMaxSkips = AUTO_FRAMESKIP_LIMIT;
+
+	/* Nothing to show while fast forwarding, draw as rarely as allowed */
+	if (ConfigureParams.System.bFastForward)
+	{
+		nFrameSkips = nMaxSkips;
+		bWasFastForward = true;
+		return;
+	}
+	if (bWasFastForward)
+	{
+		nFrameSkips = 0;
+		nHoldFrames = 0;
+		bWasFastForward = false;
+	}
+
+	/* Debugger, dialogs etc. stop the host clock for far longer */
+	if (nWorkTicks > 4*nFrameDuration)
+		nWorkTicks = 4*nFrameDuration;
+	nWorkAverage += (nWorkTicks - nWorkAverage) / 8;
+
+	if (nHoldFrames > 0)
+	{
+		nHoldFrames--;
+		return;
+	}
+	if (nWorkAverage > nFrameDuration && nFrameSkips < nMaxSkips)
+		nFrameSkips += 1;
+	else if (nWorkAverage < nFrameDuration*3/4 && nFrameSkips > 0)
+		nFrameSkips -= 1;
+	else
+		return;
+	nHoldFrames = 8 + 2*nFrameSkips;
+}
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Count the emulated VBL and wait for it to synchronize the real time
  * with the emulated ST.
  * Unfortunately SDL_Delay and other sleep functions like usleep or nanosleep
  * are very inaccurate on some systems like Linux 2.4 or Mac OS X (they can only
@@ -304,27 +460,31 @@ bool Main_SetVBLSlowdown(int factor)
  * to "busy wait" there to get an accurate timing.
  * All times are expressed as micro seconds, to avoid too much rounding error.
  */
-void Main_WaitOnVbl(void)
+static void Main_SyncVbl(Sint64 nWorkTicks)
 {
 	Sint64 CurrentTicks;
 	static Sint64 DestTicks = 0;
 	Sint64 FrameDuration_micro;
 	Sint64 nDelay;
 
-#ifdef __LIBRETRO__
-if(pauseg==1)pause_select();
-co_switch(mainThread);
-#if defined(WIIU) || defined(VITA)
-return;
-#endif
-#endif
+	NatFeat_BatchUpdate();
+
+	if (BenchmarkFile && !nBenchmarkVBLs++)
+	{
+		nBenchmarkStartTicks = Time_GetTicks();
+		nBenchmarkStartMilliTick = Main_GetTicks();
+	}
 
 	nVBLCount++;
 	if (nRunVBLs &&	nVBLCount >= nRunVBLs)
 	{
+		Main_WriteBenchmark();
+		Timeline_UnInit();
+		HeatMap_UnInit();
+		Movie_UnInit();
 		/* show VBLs/s */
 		Main_PauseEmulation(true);
-		exit(0);
+		exit(Movie_GetMismatches() ? 1 : 0);
 	}
 
 //	FrameDuration_micro = (Sint64) ( 1000000.0 / nScreenRefreshRate + 0.5 );	/* round to closest integer */
@@ -341,22 +501,27 @@ return;
 
 	nDelay = DestTicks - CurrentTicks;
 
-	/* Do not wait if we are in fast forward mode or if we are totally out of sync */
-	if (ConfigureParams.System.bFastForward == true
+	if (ConfigureParams.Screen.bAdaptiveFrameSkip && nWorkTicks)
+		Main_AdaptFrameSkip(nWorkTicks, FrameDuration_micro);
+
+	/* Do not wait if we are in fast forward or headless mode or if we are totally out of sync */
+	if (ConfigureParams.System.bFastForward == true || bVideoHeadless
 	    || nDelay < -4*FrameDuration_micro || nDelay > 50*FrameDuration_micro)
 	{
-		if (ConfigureParams.System.bFastForward == true)
+		if (ConfigureParams.System.bFastForward == true || bVideoHeadless)
 		{
 			if (!nFirstMilliTick)
 				nFirstMilliTick = Main_GetTicks();
 		}
-		if (nFrameSkips < ConfigureParams.Screen.nFrameSkips)
+		if (nFrameSkips < ConfigureParams.Screen.nFrameSkips
+		    && !ConfigureParams.Screen.bAdaptiveFrameSkip)
 		{
 			nFrameSkips += 1;
 			// Log_Printf(LOG_DEBUG, "Increased frameskip to %d\n", nFrameSkips);
 		}
 		/* Only update DestTicks for next VBL */
 		DestTicks = CurrentTicks + FrameDuration_micro;
+		nFrameStartTicks = Time_GetTicks();
 		return;
 	}
 	/* If automatic frameskip is enabled and delay's more than twice
@@ -364,6 +529,7 @@ return;
 	 */
 	if (nFrameSkips > 0
 	    && ConfigureParams.Screen.nFrameSkips >= AUTO_FRAMESKIP_LIMIT
+	    && !ConfigureParams.Screen.bAdaptiveFrameSkip
 	    && 2*nDelay > FrameDuration_micro/nFrameSkips)
 	{
 		nFrameSkips -= 1;
@@ -372,9 +538,27 @@ return;
 
 	if (bAccurateDelays)
 	{
+#if HAVE_CLOCK_NANOSLEEP
+		/* Sleep until the deadline minus the usual wake-up latency
+		 * of the host, so that only that latency is busy-waited.
+		 * Late wake-ups raise the budget at once, it then decays
+		 * again slowly while the wake-ups are on time. */
+		if (nDelay > nWakeJitter)
+		{
+			Sint64 nWakeTicks = DestTicks - nWakeJitter;
+			Sint64 nLate;
+			Time_SleepUntil(nWakeTicks);
+			nLate = Time_GetTicks() - nWakeTicks;
+			if (nLate > nWakeJitter)
+				nWakeJitter = nLate < 4000 ? nLate : 4000;
+			else if (nWakeJitter > 100)
+				nWakeJitter -= (nWakeJitter - nLate) / 16 + 1;
+		}
+#else
 		/* Accurate sleeping is possible -> use SDL_Delay to free the CPU */
 		if (nDelay > 1000)
 			Time_Delay(nDelay - 1000);
+#endif
 	}
 	else
 	{
@@ -397,6 +581,39 @@ return;
 //printf ( "tick %lld\n" , CurrentTicks );
 	/* Update DestTicks for next VBL */
 	DestTicks += FrameDuration_micro;
+	nFrameStartTicks = Time_GetTicks();
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * This function is called on each emulated VBL to synchronize the real
+ * time with the emulated ST, see Main_SyncVbl().
+ */
+void Main_WaitOnVbl(void)
+{
+	Sint64 nWorkTicks = 0;
+
+	if (nFrameStartTicks)
+	{
+		nWorkTicks = Time_GetTicks() - nFrameStartTicks;
+		Stats_Add(STATS_HOST_USEC, nWorkTicks);
+	}
+
+	if (GdbStub_IsActive())
+		GdbStub_Update();
+
+#ifdef __LIBRETRO__
+	/* Return to the frontend at the end of this instruction, the rest
+	 * is done by Main_RunFrame() when it asks for the next frame */
+	nFrameWorkTicks = nWorkTicks;
+	bFrameEnded = true;
+	M68000_EndFrame();
+#else
+	Perf_FrameDone();
+	Main_SyncVbl(nWorkTicks);
+	Perf_FrameStart();
+#endif
 }
 
 
@@ -622,6 +839,9 @@ else SND=-1;
 			break;
 		}
 	} while (bContinueProcessing || !(bEmulationActive || bQuitProgram));
+
+	if (Reverse_IsEnabled())
+		Reverse_InputSync();
 #endif
 }
 
@@ -653,6 +873,14 @@ void Main_SetTitle(const char *title)
  */
 static void Main_Init_HW(void)
 {
+	if (!STMemory_Init())
+	{
+#ifndef __LIBRETRO__
+		exit(-1);
+#else
+		pauseg=-1;
+#endif
+	}
 	FDC_Init();
 }
 
@@ -760,6 +988,7 @@ static void Main_UnInit(void)
 void Main_UnInit(void)
 #endif
 {
+	Main_WriteBenchmark();
 	Screen_ReturnFromFullScreen();
 	Floppy_UnInit();
 	HDC_UnInit();
@@ -773,12 +1002,21 @@ void Main_UnInit(void)
 	Joy_UnInit();
 	if (Sound_AreWeRecording())
 		Sound_EndRecording();
+	History_RecordStop();
+	Timeline_UnInit();
+	HeatMap_UnInit();
+	Movie_UnInit();
+	GdbStub_Close();
+	FileWriter_UnInit();
+	RowPool_UnInit();
+	Sound_UnInit();
 	Audio_UnInit();
 	SDLGui_UnInit();
 	DSP_UnInit();
 	HostScreen_UnInit();
 	Screen_UnInit();
 	Exit680x0();
+	STMemory_UnInit();
 
 	IPF_Exit();
 
@@ -853,6 +1091,62 @@ static void Main_StatusbarSetup(void)
 }
 
 
+/**
+ * Finish the emulation after it has been quit
+ */
+static void Main_Exit(void)
+{
+	static bool bExited;
+
+	if (bExited)
+		return;
+	bExited = true;
+
+	if (bRecordingAvi)
+	{
+		/* cleanly close the avi file */
+		Statusbar_AddMessage("Finishing AVI file...", 100);
+		Statusbar_Update(sdlscrn, true);
+		Avi_StopRecording();
+	}
+	/* Un-init emulation system */
+	Main_UnInit();
+#ifdef __LIBRETRO__
+pauseg=-1;
+#endif
+}
+
+
+#ifdef __LIBRETRO__
+/**
+ * Emulate one frame: resume where the previous one ended on VBL and
+ * return on the next VBL. Returns false once the emulation has been quit.
+ */
+bool Main_RunFrame(void)
+{
+	if (!bQuitProgram)
+	{
+		if (bFrameEnded)
+		{
+			bFrameEnded = false;
+			if (Reverse_IsEnabled())
+				Reverse_InputSync();
+#if !defined(WIIU) && !defined(VITA)
+			Main_SyncVbl(nFrameWorkTicks);
+#endif
+		}
+
+		M68000_RunFrame();
+		if (!bQuitProgram)
+			return true;
+	}
+
+	Main_Exit();
+	return false;
+}
+#endif
+
+
 /**
  * Main
  * 
@@ -866,6 +1160,7 @@ int main(int argc, char *argv[])
 {
 	/* Generate random seed */
 	srand(time(NULL));
+	Hatari_srand(time(NULL));
 
 	/* Logs default to stderr at start */
 	Log_Default();
@@ -894,6 +1189,12 @@ int main(int argc, char *argv[])
 	// After initial configuration was loaded
 	// Set tos.img in retro_system_dir
 	snprintf(ConfigureParams.Rom.szTosImageFileName, FILENAME_MAX, "%s", RETRO_TOS);
+	// Real IKBD ROM as ikbd.img in retro_system_dir
+	if (hatari_ikbd_rom)
+		snprintf(ConfigureParams.Rom.szIkbdRomFileName, FILENAME_MAX, "%s", RETRO_IKBD);
+	ConfigureParams.System.bDeterministic = hatari_deterministic;
+	ConfigureParams.Screen.bAdaptiveFrameSkip = hatari_frameskip_adaptive;
+	ConfigureParams.Memory.bHugePages = hatari_huge_pages;
 #endif
 
 	/* monitor type option might require "reset" -> true */
@@ -917,6 +1218,15 @@ int main(int argc, char *argv[])
 	/* Init emulator system */
 	Main_Init();
 
+	/* Only measure the hot kernels instead of running the emulation? */
+	if (MicroBench_IsRequested())
+	{
+		nQuitValue = MicroBench_Run(stdout);
+		bQuitProgram = true;
+		Main_Exit();
+		return nQuitValue;
+	}
+
 	/* Set initial Statusbar information */
 	Main_StatusbarSetup();
 	
@@ -933,19 +1243,14 @@ int main(int argc, char *argv[])
 
 	/* Run emulation */
 	Main_UnPauseEmulation();
+#ifdef __LIBRETRO__
+	/* The frontend runs the frames one by one with Main_RunFrame() */
+	M68000_StartFrames();
+	return 0;
+#else
 	M68000_Start();                 /* Start emulation */
 
-	if (bRecordingAvi)
-	{
-		/* cleanly close the avi file */
-		Statusbar_AddMessage("Finishing AVI file...", 100);
-		Statusbar_Update(sdlscrn, true);
-		Avi_StopRecording();
-	}
-	/* Un-init emulation system */
-	Main_UnInit();
-#ifdef __LIBRETRO__
-pauseg=-1;
-#endif
+	Main_Exit();
 	return nQuitValue;
+#endif
 }
@@ -15,6 +15,13 @@
   save/restore all variables that are local to it. We use one function to
   reduce redundancy and the function 'MemorySnapShot_Store' decides if it
   should save or restore the data.
+
+  Saving to a file first captures the whole state into memory, which only
+  takes a few milliseconds. The state is then split into chunks which the
+  file writer threads compress in parallel (each one as a separate gzip
+  member, gzread() reads them back as a single stream) and write in the
+  background, so that emulation doesn't wait for them. The result is
+  reported on the next VBL once the last chunk is written.
 */
 const char MemorySnapShot_fileid[] = "Hatari memorySnapShot.c : " __DATE__ " " __TIME__;
 
@@ -28,10 +35,13 @@ const char MemorySnapShot_fileid[] = "Hatari memorySnapShot.c : " __DATE__ " " _
 #include "dmaSnd.h"
 #include "fdc.h"
 #include "file.h"
+#include "fileWriter.h"
 #include "floppy.h"
 #include "floppy_ipf.h"
 #include "floppy_stx.h"
 #include "gemdos.h"
+#include "hdc.h"
+#include "ide.h"
 #include "acia.h"
 #include "ikbd.h"
 #include "cycInt.h"
@@ -47,6 +57,8 @@ const char MemorySnapShot_fileid[] = "Hatari memorySnapShot.c : " __DATE__ " " _
 #include "str.h"
 #include "stMemory.h"
 #include "tos.h"
+#include "vdiAccel.h"
+#include "utils.h"
 #include "screen.h"
 #include "video.h"
 #include "falcon/dsp.h"
@@ -67,30 +79,117 @@ const char MemorySnapShot_fileid[] = "Hatari memorySnapShot.c : " __DATE__ " " _
 /* Remove possible conflicting mkdir declaration from cpu/sysdeps.h */
 #undef mkdir
 #include <zlib.h>
-typedef gzFile MSS_File;
+typedef gzFile MSS_Handle;
+
+/* Snapshots are mostly RAM contents which deflate's fastest level packs
+ * nearly as well as the default one, at a fraction of the save time.
+ */
+#define SNAPSHOT_GZ_LEVEL   "1"
+#define SNAPSHOT_GZ_BUFSIZE (128*1024)
+#define SNAPSHOT_GZ_WINDOW  (15+16)	/* deflate window bits for gzip format */
 
 #else
 
-typedef FILE* MSS_File;
+typedef FILE* MSS_Handle;
 
 #endif
 
+/* A snapshot is either backed by a (possibly compressed) file, or by
+ * a caller supplied memory buffer which is always stored uncompressed.
+ */
+typedef struct
+{
+	MSS_Handle fhndl;	/* file backend, NULL when memory backed */
+	Uint8 *pMem;		/* memory backend buffer, NULL when file backed */
+	int nMemSize;		/* size of the memory buffer */
+	int nMemPos;		/* current read/write position in the buffer */
+	bool bSizeOnly;		/* only count stored bytes, don't copy anything */
+} MSS_File;
+
 
 static MSS_File CaptureFile;
 static bool bCaptureSave, bCaptureError;
 
 
+/* Background saves split the state into at most this many chunks,
+ * to leave file writer slots for the recordings.
+ */
+#define SNAPSHOT_CHUNKS_MAX	8
+#define SNAPSHOT_CHUNK_MIN	(256*1024)
+
+/* A snapshot file being written in the background */
+typedef struct
+{
+	char szFileName[FILENAME_MAX];
+	char szTempName[FILENAME_MAX+4];
+	FILE *fp;
+	int nChunks;
+	int nNumber;
+	bool bError;
+} MSS_SAVE;
+
+/* Header of a queued chunk, its state data follows */
+typedef struct
+{
+	MSS_SAVE *pSave;
+	int nIndex;
+	bool bEncodeError;	/* set by the encode function */
+} MSS_CHUNK;
+
+static int nLastSaveQueued;		/* number of last background save */
+static volatile int nLastSaveDone;	/* and of last one finished (by writer thread) */
+static volatile int nLastSaveFailed;	/* and of last one that failed (by writer thread) */
+static int nLastSaveReported;		/* last one reported to the user */
+static bool bSaveConfirm;		/* confirm it when done */
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Open file.
  */
-static MSS_File MemorySnapShot_fopen(const char *pszFileName, const char *pszMode)
+static bool MemorySnapShot_fopen(MSS_File *pFile, const char *pszFileName, const char *pszMode)
 {
+	memset(pFile, 0, sizeof(*pFile));
 #ifdef COMPRESS_MEMORYSNAPSHOT
-	return gzopen(pszFileName, pszMode);
+	if (pszMode[0] == 'w')
+	{
+		char sMode[8];
+		snprintf(sMode, sizeof(sMode), "%s%s", pszMode, SNAPSHOT_GZ_LEVEL);
+		pFile->fhndl = gzopen(pszFileName, sMode);
+	}
+	else
+		pFile->fhndl = gzopen(pszFileName, pszMode);
+	if (pFile->fhndl)
+		gzbuffer(pFile->fhndl, SNAPSHOT_GZ_BUFSIZE);
 #else
-	return fopen(pszFileName, pszMode);
+	pFile->fhndl = fopen(pszFileName, pszMode);
 #endif
+	return pFile->fhndl != NULL;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * "Open" memory buffer of given size.
+ */
+static bool MemorySnapShot_mopen(MSS_File *pFile, void *pBuffer, int nSize)
+{
+	memset(pFile, 0, sizeof(*pFile));
+	pFile->pMem = pBuffer;
+	pFile->nMemSize = nSize;
+	return pFile->pMem != NULL;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * "Open" a size query, which just counts the bytes written to it.
+ */
+static bool MemorySnapShot_sopen(MSS_File *pFile)
+{
+	memset(pFile, 0, sizeof(*pFile));
+	pFile->bSizeOnly = true;
+	return true;
 }
 
 
@@ -98,13 +197,29 @@ static MSS_File MemorySnapShot_fopen(const char *pszFileName, const char *pszMod
 /**
  * Close file.
  */
-static void MemorySnapShot_fclose(MSS_File fhndl)
+static void MemorySnapShot_fclose(MSS_File *pFile)
 {
+	if (pFile->fhndl)
+	{
 #ifdef COMPRESS_MEMORYSNAPSHOT
-	gzclose(fhndl);
+		gzclose(pFile->fhndl);
 #else
-	fclose(fhndl);
+		fclose(pFile->fhndl);
 #endif
+	}
+	pFile->fhndl = NULL;
+	pFile->pMem = NULL;
+	pFile->bSizeOnly = false;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return true if a snapshot file or memory buffer is open.
+ */
+static inline bool MemorySnapShot_IsOpen(MSS_File *pFile)
+{
+	return pFile->fhndl != NULL || pFile->pMem != NULL || pFile->bSizeOnly;
 }
 
 
@@ -112,12 +227,20 @@ static void MemorySnapShot_fclose(MSS_File fhndl)
 /**
  * Read from file.
  */
-static int MemorySnapShot_fread(MSS_File fhndl, char *buf, int len)
+static int MemorySnapShot_fread(MSS_File *pFile, char *buf, int len)
 {
+	if (pFile->pMem)
+	{
+		if (len > pFile->nMemSize - pFile->nMemPos)
+			len = pFile->nMemSize - pFile->nMemPos;
+		memcpy(buf, pFile->pMem + pFile->nMemPos, len);
+		pFile->nMemPos += len;
+		return len;
+	}
 #ifdef COMPRESS_MEMORYSNAPSHOT
-	return gzread(fhndl, buf, len);
+	return gzread(pFile->fhndl, buf, len);
 #else
-	return fread(buf, 1, len, fhndl);
+	return fread(buf, 1, len, pFile->fhndl);
 #endif
 }
 
@@ -126,12 +249,25 @@ static int MemorySnapShot_fread(MSS_File fhndl, char *buf, int len)
 /**
  * Write data to file.
  */
-static int MemorySnapShot_fwrite(MSS_File fhndl, const char *buf, int len)
+static int MemorySnapShot_fwrite(MSS_File *pFile, const char *buf, int len)
 {
+	if (pFile->bSizeOnly)
+	{
+		pFile->nMemPos += len;
+		return len;
+	}
+	if (pFile->pMem)
+	{
+		if (len > pFile->nMemSize - pFile->nMemPos)
+			len = pFile->nMemSize - pFile->nMemPos;
+		memcpy(pFile->pMem + pFile->nMemPos, buf, len);
+		pFile->nMemPos += len;
+		return len;
+	}
 #ifdef COMPRESS_MEMORYSNAPSHOT
-	return gzwrite(fhndl, buf, len);
+	return gzwrite(pFile->fhndl, buf, len);
 #else
-	return fwrite(buf, 1, len, fhndl);
+	return fwrite(buf, 1, len, pFile->fhndl);
 #endif
 }
 
@@ -140,22 +276,37 @@ static int MemorySnapShot_fwrite(MSS_File fhndl, const char *buf, int len)
 /**
  * Seek into file from current position
  */
-static int MemorySnapShot_fseek(MSS_File fhndl, int pos)
+static int MemorySnapShot_fseek(MSS_File *pFile, int pos)
 {
+	if (pFile->bSizeOnly)
+	{
+		pFile->nMemPos += pos;
+		return pFile->nMemPos;
+	}
+	if (pFile->pMem)
+	{
+		if (pFile->nMemPos + pos < 0 || pFile->nMemPos + pos > pFile->nMemSize)
+			return -1;
+		/* keep saved memory snapshots reproducible */
+		if (bCaptureSave && pos > 0)
+			memset(pFile->pMem + pFile->nMemPos, 0, pos);
+		pFile->nMemPos += pos;
+		return pFile->nMemPos;
+	}
 #ifdef COMPRESS_MEMORYSNAPSHOT
-	return (int)gzseek(fhndl, pos, SEEK_CUR);	/* return -1 if error, new position >=0 if OK */
+	return (int)gzseek(pFile->fhndl, pos, SEEK_CUR);	/* return -1 if error, new position >=0 if OK */
 #else
-	return fseek(fhndl, pos, SEEK_CUR);		/* return -1 if error, 0 if OK */
+	return fseek(pFile->fhndl, pos, SEEK_CUR);		/* return -1 if error, 0 if OK */
 #endif
 }
 
 
 /*-----------------------------------------------------------------------*/
 /**
- * Open/Create snapshot file, and set flag so 'MemorySnapShot_Store' knows
- * how to handle data.
+ * Save/restore and check the snapshot header (version string and
+ * CPU core version). Return false on failure.
  */
-static bool MemorySnapShot_OpenFile(const char *pszFileName, bool bSave)
+static bool MemorySnapShot_StoreHeader(bool bSave)
 {
 	char VersionString[] = VERSION_STRING;
 #if ENABLE_WINUAE_CPU
@@ -165,6 +316,51 @@ static bool MemorySnapShot_OpenFile(const char *pszFileName, bool bSave)
 #endif
 	Uint8 CpuCore;
 
+	if (bSave)
+	{
+		/* Store version string */
+		MemorySnapShot_Store(VersionString, sizeof(VersionString));
+		/* Store CPU core version */
+		CpuCore = CORE_VERSION;
+		MemorySnapShot_Store(&CpuCore, sizeof(CpuCore));
+		return !bCaptureError;
+	}
+
+	/* Restore version string */
+	MemorySnapShot_Store(VersionString, sizeof(VersionString));
+	/* Does match current version? */
+	if (strcmp(VersionString, VERSION_STRING))
+	{
+		/* No, inform user and error */
+		Log_AlertDlg(LOG_ERROR,
+			     "Unable to restore Hatari memory state.\n"
+			     "Given state file is compatible only with\n"
+			     "Hatari version " VERSION_STRING ".");
+		bCaptureError = true;
+		return false;
+	}
+	/* Check CPU core version */
+	MemorySnapShot_Store(&CpuCore, sizeof(CpuCore));
+	if (CpuCore != CORE_VERSION)
+	{
+		Log_AlertDlg(LOG_ERROR,
+			     "Unable to restore Hatari memory state.\n"
+			     "Given state file is for different Hatari\n"
+			     "CPU core version.");
+		bCaptureError = true;
+		return false;
+	}
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Open/Create snapshot file, and set flag so 'MemorySnapShot_Store' knows
+ * how to handle data.
+ */
+static bool MemorySnapShot_OpenFile(const char *pszFileName, bool bSave)
+{
 	/* Set error */
 	bCaptureError = false;
 
@@ -173,61 +369,32 @@ static bool MemorySnapShot_OpenFile(const char *pszFileName, bool bSave)
 	 */
 	if (bSave)
 	{
-		if (!File_QueryOverwrite(pszFileName))
-			return false;
-
 		/* Save */
-		CaptureFile = MemorySnapShot_fopen(pszFileName, "wb");
-		if (!CaptureFile)
+		if (!MemorySnapShot_fopen(&CaptureFile, pszFileName, "wb"))
 		{
 			fprintf(stderr, "Failed to open save file '%s': %s\n",
 			        pszFileName, strerror(errno));
 			bCaptureError = true;
 			return false;
 		}
-		bCaptureSave = true;
-		/* Store version string */
-		MemorySnapShot_Store(VersionString, sizeof(VersionString));
-		/* Store CPU core version */
-		CpuCore = CORE_VERSION;
-		MemorySnapShot_Store(&CpuCore, sizeof(CpuCore));
 	}
 	else
 	{
 		/* Restore */
-		CaptureFile = MemorySnapShot_fopen(pszFileName, "rb");
-		if (!CaptureFile)
+		if (!MemorySnapShot_fopen(&CaptureFile, pszFileName, "rb"))
 		{
 			fprintf(stderr, "Failed to open file '%s': %s\n",
 			        pszFileName, strerror(errno));
 			bCaptureError = true;
 			return false;
 		}
-		bCaptureSave = false;
-		/* Restore version string */
-		MemorySnapShot_Store(VersionString, sizeof(VersionString));
-		/* Does match current version? */
-		if (strcmp(VersionString, VERSION_STRING))
-		{
-			/* No, inform user and error */
-			Log_AlertDlg(LOG_ERROR,
-				     "Unable to restore Hatari memory state.\n"
-				     "Given state file is compatible only with\n"
-				     "Hatari version " VERSION_STRING ".");
-			bCaptureError = true;
-			return false;
-		}
-		/* Check CPU core version */
-		MemorySnapShot_Store(&CpuCore, sizeof(CpuCore));
-		if (CpuCore != CORE_VERSION)
-		{
-			Log_AlertDlg(LOG_ERROR,
-				     "Unable to restore Hatari memory state.\n"
-				     "Given state file is for different Hatari\n"
-				     "CPU core version.");
-			bCaptureError = true;
-			return false;
-		}
+	}
+	bCaptureSave = bSave;
+
+	if (!MemorySnapShot_StoreHeader(bSave))
+	{
+		MemorySnapShot_fclose(&CaptureFile);
+		return false;
 	}
 
 	/* All OK */
@@ -235,13 +402,52 @@ static bool MemorySnapShot_OpenFile(const char *pszFileName, bool bSave)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Use given memory buffer as (uncompressed) snapshot storage, and set
+ * flag so 'MemorySnapShot_Store' knows how to handle data.
+ */
+static bool MemorySnapShot_OpenMem(void *pBuffer, int nSize, bool bSave)
+{
+	bCaptureError = false;
+
+	if (!MemorySnapShot_mopen(&CaptureFile, pBuffer, nSize))
+	{
+		bCaptureError = true;
+		return false;
+	}
+	bCaptureSave = bSave;
+
+	if (!MemorySnapShot_StoreHeader(bSave))
+	{
+		MemorySnapShot_fclose(&CaptureFile);
+		return false;
+	}
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Start a snapshot size query: 'MemorySnapShot_Store' then only
+ * counts the saved bytes without copying any data.
+ */
+static bool MemorySnapShot_OpenSizeQuery(void)
+{
+	bCaptureError = false;
+	MemorySnapShot_sopen(&CaptureFile);
+	bCaptureSave = true;
+	return MemorySnapShot_StoreHeader(true);
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Close snapshot file.
  */
 static void MemorySnapShot_CloseFile(void)
 {
-	MemorySnapShot_fclose(CaptureFile);
+	MemorySnapShot_fclose(&CaptureFile);
 }
 
 
@@ -254,9 +460,9 @@ void MemorySnapShot_Skip(int Nb)
 	int res;
 
 	/* Check no file errors */
-	if (CaptureFile != NULL)
+	if (MemorySnapShot_IsOpen(&CaptureFile))
 	{
-		res = MemorySnapShot_fseek(CaptureFile, Nb);
+		res = MemorySnapShot_fseek(&CaptureFile, Nb);
 
 		/* Did seek OK? */
 		if (res < 0)
@@ -274,13 +480,13 @@ void MemorySnapShot_Store(void *pData, int Size)
 	long nBytes;
 
 	/* Check no file errors */
-	if (CaptureFile != NULL)
+	if (MemorySnapShot_IsOpen(&CaptureFile))
 	{
 		/* Saving or Restoring? */
 		if (bCaptureSave)
-			nBytes = MemorySnapShot_fwrite(CaptureFile, (char *)pData, Size);
+			nBytes = MemorySnapShot_fwrite(&CaptureFile, (char *)pData, Size);
 		else
-			nBytes = MemorySnapShot_fread(CaptureFile, (char *)pData, Size);
+			nBytes = MemorySnapShot_fread(&CaptureFile, (char *)pData, Size);
 
 		/* Did save OK? */
 		if (nBytes != Size)
@@ -291,42 +497,331 @@ void MemorySnapShot_Store(void *pData, int Size)
 
 /*-----------------------------------------------------------------------*/
 /**
- * Save 'snapshot' of memory/chips/emulation variables
+ * Save all memory/chips/emulation variables to the opened snapshot.
+ * Debugger state is saved to a separate file next to the snapshot,
+ * so it is skipped when pszFileName is NULL (memory snapshots).
  */
-void MemorySnapShot_Capture(const char *pszFileName, bool bConfirm)
+static void MemorySnapShot_SaveAll(const char *pszFileName)
 {
 	Uint32 magic = SNAPSHOT_MAGIC;
 
+	/* Finish the work which would change already saved parts,
+	 * the size query only counts and doesn't need it */
+	if (!CaptureFile.bSizeOnly)
+		Crossbar_MemorySnapShot_Prepare();
+
+	/* Capture each files details */
+	Configuration_MemorySnapShot_Capture(true);
+	TOS_MemorySnapShot_Capture(true);
+	STMemory_MemorySnapShot_Capture(true);
+	Cycles_MemorySnapShot_Capture(true);			/* Before fdc (for CyclesGlobalClockCounter) */
+	Utils_MemorySnapShot_Capture(true);			/* Random generator state */
+	FDC_MemorySnapShot_Capture(true);
+	Floppy_MemorySnapShot_Capture(true);
+	IPF_MemorySnapShot_Capture(true);			/* After fdc/floppy are saved */
+	STX_MemorySnapShot_Capture(true);			/* After fdc/floppy are saved */
+	GemDOS_MemorySnapShot_Capture(true);
+	HDC_MemorySnapShot_Capture(true);
+	Ide_MemorySnapShot_Capture(true);
+	ACIA_MemorySnapShot_Capture(true);
+	IKBD_MemorySnapShot_Capture(true);
+	CycInt_MemorySnapShot_Capture(true);
+	M68000_MemorySnapShot_Capture(true);
+	MFP_MemorySnapShot_Capture(true);
+	PSG_MemorySnapShot_Capture(true);
+	Sound_MemorySnapShot_Capture(true);
+	Video_MemorySnapShot_Capture(true);
+	Blitter_MemorySnapShot_Capture(true);
+	DmaSnd_MemorySnapShot_Capture(true);
+	Crossbar_MemorySnapShot_Capture(true);
+	VIDEL_MemorySnapShot_Capture(true);
+	DSP_MemorySnapShot_Capture(true);
+	VDIAccel_MemorySnapShot_Capture(true);
+	if (pszFileName)
+		DebugUI_MemorySnapShot_Capture(pszFileName, true);
+	IoMem_MemorySnapShot_Capture(true);
+	/* end marker */
+	MemorySnapShot_Store(&magic, sizeof(magic));
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Restore all memory/chips/emulation variables from the opened snapshot.
+ * Debugger state is restored only for file snapshots (see above).
+ *
+ * When the snapshot was taken with the configuration the emulation runs
+ * with, and the previous restore didn't fail, the memory and IO maps and
+ * TOS are already set up for it. Then the state is restored in place,
+ * without the cold reset (which e.g. the run-ahead, rewind and netplay
+ * restores, done up to several times per frame, would mostly spend
+ * rebuilding the IO tables).
+ */
+static void MemorySnapShot_RestoreAll(const char *pszFileName)
+{
+	static bool bLastRestoreFailed;
+	bool bWarm;
+	Uint32 magic;
+
+	bWarm = !Configuration_MemorySnapShot_Capture(false) && !bLastRestoreFailed;
+	TOS_MemorySnapShot_Capture(false);
+
+	HDC_CancelTransfer();
+	Ide_CancelTransfer();
+
+	if (bWarm)
+	{
+		/* Only reset the state which the snapshot doesn't contain */
+		Reset_SnapShot();
+	}
+	else
+	{
+		/* Reset emulator to get things running */
+		IoMem_UnInit();  IoMem_Init();
+		Reset_Cold();
+	}
+
+	/* Capture each files details */
+	STMemory_MemorySnapShot_Capture(false);
+	Cycles_MemorySnapShot_Capture(false);			/* Before fdc (for CyclesGlobalClockCounter) */
+	Utils_MemorySnapShot_Capture(false);			/* Random generator state */
+	FDC_MemorySnapShot_Capture(false);
+	Floppy_MemorySnapShot_Capture(false);
+	IPF_MemorySnapShot_Capture(false);			/* After fdc/floppy are restored, as IPF depends on them */
+	STX_MemorySnapShot_Capture(false);			/* After fdc/floppy are restored, as STX depends on them */
+	GemDOS_MemorySnapShot_Capture(false);
+	HDC_MemorySnapShot_Capture(false);
+	Ide_MemorySnapShot_Capture(false);
+	ACIA_MemorySnapShot_Capture(false);
+	IKBD_MemorySnapShot_Capture(false);			/* After ACIA */
+	CycInt_MemorySnapShot_Capture(false);
+	M68000_MemorySnapShot_Capture(false);
+	MFP_MemorySnapShot_Capture(false);
+	PSG_MemorySnapShot_Capture(false);
+	Sound_MemorySnapShot_Capture(false);
+	Video_MemorySnapShot_Capture(false);
+	Blitter_MemorySnapShot_Capture(false);
+	DmaSnd_MemorySnapShot_Capture(false);
+	Crossbar_MemorySnapShot_Capture(false);
+	VIDEL_MemorySnapShot_Capture(false);
+	DSP_MemorySnapShot_Capture(false);
+	VDIAccel_MemorySnapShot_Capture(false);
+	if (pszFileName)
+		DebugUI_MemorySnapShot_Capture(pszFileName, false);
+	IoMem_MemorySnapShot_Capture(false);
+
+	/* version string check catches release-to-release
+	 * state changes, bCaptureError catches too short
+	 * state file, this check a too long state file.
+	 */
+	MemorySnapShot_Store(&magic, sizeof(magic));
+	if (!bCaptureError && magic != SNAPSHOT_MAGIC)
+		bCaptureError = true;
+	bLastRestoreFailed = bCaptureError;
+
+	/* Re-derive the host screen mode and palette from the restored state */
+	if (bWarm)
+		Screen_ModeChanged();
+}
+
+
+#ifdef COMPRESS_MEMORYSNAPSHOT
+/*-----------------------------------------------------------------------*/
+/**
+ * File writer encode function: compress a chunk as a gzip member. Errors
+ * are noted in the chunk, so that its write function still gets called.
+ */
+static bool MemorySnapShot_EncodeChunk(Uint8 *pData, int nSize, FILEWRITER_BUFFER *pOut, void *pParam)
+{
+	MSS_CHUNK *pChunk = pParam;
+	z_stream zs;
+	int nBound;
+
+	memset(&zs, 0, sizeof(zs));
+	if (deflateInit2(&zs, atoi(SNAPSHOT_GZ_LEVEL), Z_DEFLATED, SNAPSHOT_GZ_WINDOW,
+	                 8, Z_DEFAULT_STRATEGY) != Z_OK)
+	{
+		pChunk->bEncodeError = true;
+		return true;
+	}
+	nSize -= sizeof(MSS_CHUNK);
+	nBound = deflateBound(&zs, nSize);
+	zs.next_in = pData + sizeof(MSS_CHUNK);
+	zs.avail_in = nSize;
+	zs.next_out = FileWriter_Reserve(pOut, nBound);
+	zs.avail_out = nBound;
+	if (!zs.next_out || deflate(&zs, Z_FINISH) != Z_STREAM_END)
+		pChunk->bEncodeError = true;
+	else
+		pOut->nSize = nBound - zs.avail_out;
+	deflateEnd(&zs);
+	return true;
+}
+#endif
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * File writer write function: the first chunk of a background save
+ * creates a temporary file, the last one replaces the snapshot file
+ * with it. Errors are only logged here, and reported on next VBL.
+ */
+static bool MemorySnapShot_WriteChunk(Uint8 *pData, int nSize, void *pParam)
+{
+	MSS_CHUNK *pChunk = pParam;
+	MSS_SAVE *pSave = pChunk->pSave;
+
+	if (pChunk->nIndex == 0)
+	{
+		pSave->fp = fopen(pSave->szTempName, "wb");
+		if (!pSave->fp)
+		{
+			Log_Printf(LOG_WARN, "Failed to open save file '%s': %s\n",
+			           pSave->szTempName, strerror(errno));
+			pSave->bError = true;
+		}
+	}
+#ifdef COMPRESS_MEMORYSNAPSHOT
+	if (pChunk->bEncodeError)
+		pSave->bError = true;
+#else
+	pData += sizeof(MSS_CHUNK);
+	nSize -= sizeof(MSS_CHUNK);
+#endif
+	if (!pSave->bError && fwrite(pData, 1, nSize, pSave->fp) != (size_t)nSize)
+		pSave->bError = true;
+
+	if (pChunk->nIndex < pSave->nChunks - 1)
+		return true;
+
+	if (pSave->fp && fclose(pSave->fp) != 0)
+		pSave->bError = true;
+	if (!pSave->bError && rename(pSave->szTempName, pSave->szFileName) != 0)
+		pSave->bError = true;
+	if (pSave->bError)
+	{
+		remove(pSave->szTempName);
+		Log_Printf(LOG_WARN, "Unable to save memory state to file '%s'.\n", pSave->szFileName);
+		nLastSaveFailed = pSave->nNumber;
+	}
+	else
+		Log_Printf(LOG_INFO, "Memory state saved to file '%s'.\n", pSave->szFileName);
+	nLastSaveDone = pSave->nNumber;
+	free(pSave);
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Capture the state into memory and queue it in chunks to the file
+ * writer. Return false if the snapshot has to be saved directly.
+ */
+static bool MemorySnapShot_CaptureQueue(const char *pszFileName)
+{
+	MSS_SAVE *pSave;
+	MSS_CHUNK *pChunk;
+	Uint8 *pState;
+	int nSize, nUsed, nChunkSize, nPos, i;
+
+	nSize = MemorySnapShot_Size();
+	if (nSize < 0 || strlen(pszFileName) >= sizeof(pSave->szFileName))
+		return false;
+	pSave = malloc(sizeof(*pSave));
+	pState = malloc(nSize);
+	if (!pSave || !pState || (nUsed = MemorySnapShot_CaptureMem(pState, nSize)) < 0)
+	{
+		free(pSave);
+		free(pState);
+		return false;
+	}
+	DebugUI_MemorySnapShot_Capture(pszFileName, true);
+
+	nChunkSize = (nUsed + SNAPSHOT_CHUNKS_MAX - 1) / SNAPSHOT_CHUNKS_MAX;
+	if (nChunkSize < SNAPSHOT_CHUNK_MIN)
+		nChunkSize = SNAPSHOT_CHUNK_MIN;
+
+	strcpy(pSave->szFileName, pszFileName);
+	snprintf(pSave->szTempName, sizeof(pSave->szTempName), "%s.tmp", pszFileName);
+	pSave->fp = NULL;
+	pSave->nChunks = (nUsed + nChunkSize - 1) / nChunkSize;
+	pSave->nNumber = ++nLastSaveQueued;
+	pSave->bError = false;
+
+	/* compress the chunks on as many threads as the recordings */
+	FileWriter_SetThreads(ConfigureParams.Video.AviRecordThreads);
+	for (i = 0, nPos = 0; i < pSave->nChunks; i++, nPos += nChunkSize)
+	{
+		int nLen = nUsed - nPos < nChunkSize ? nUsed - nPos : nChunkSize;
+
+		pChunk = (MSS_CHUNK *)FileWriter_Begin(sizeof(MSS_CHUNK) + nLen);
+		if (!pChunk)
+		{
+			/* drop the already written chunks, save directly instead */
+			FileWriter_Flush();
+			if (pSave->fp)
+				fclose(pSave->fp);
+			remove(pSave->szTempName);
+			nLastSaveDone = nLastSaveFailed = pSave->nNumber;
+			nLastSaveReported = pSave->nNumber;
+			free(pSave);
+			free(pState);
+			return false;
+		}
+		pChunk->pSave = pSave;
+		pChunk->nIndex = i;
+		pChunk->bEncodeError = false;
+		memcpy(pChunk + 1, pState + nPos, nLen);
+#ifdef COMPRESS_MEMORYSNAPSHOT
+		FileWriter_CommitEncode(MemorySnapShot_EncodeChunk, MemorySnapShot_WriteChunk, pChunk);
+#else
+		FileWriter_Commit(MemorySnapShot_WriteChunk, pChunk);
+#endif
+	}
+	free(pState);
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Called every VBL: report background saves which are done.
+ */
+void MemorySnapShot_CheckSaved(void)
+{
+	int nDone = nLastSaveDone;
+
+	if (nDone == nLastSaveReported)
+		return;
+	nLastSaveReported = nDone;
+
+	if (nLastSaveFailed == nDone)
+		Log_AlertDlg(LOG_ERROR, "Unable to save memory state to file.");
+	else if (bSaveConfirm)
+		Log_AlertDlg(LOG_INFO, "Memory state file saved.");
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Save 'snapshot' of memory/chips/emulation variables. The file is
+ * written in the background when possible, see above.
+ */
+void MemorySnapShot_Capture(const char *pszFileName, bool bConfirm)
+{
+	if (!File_QueryOverwrite(pszFileName))
+		return;
+
+	if (MemorySnapShot_CaptureQueue(pszFileName))
+	{
+		bSaveConfirm = bConfirm;
+		return;
+	}
+
 	/* Set to 'saving' */
 	if (MemorySnapShot_OpenFile(pszFileName, true))
 	{
-		/* Capture each files details */
-		Configuration_MemorySnapShot_Capture(true);
-		TOS_MemorySnapShot_Capture(true);
-		STMemory_MemorySnapShot_Capture(true);
-		Cycles_MemorySnapShot_Capture(true);			/* Before fdc (for CyclesGlobalClockCounter) */
-		FDC_MemorySnapShot_Capture(true);
-		Floppy_MemorySnapShot_Capture(true);
-		IPF_MemorySnapShot_Capture(true);			/* After fdc/floppy are saved */
-		STX_MemorySnapShot_Capture(true);			/* After fdc/floppy are saved */
-		GemDOS_MemorySnapShot_Capture(true);
-		ACIA_MemorySnapShot_Capture(true);
-		IKBD_MemorySnapShot_Capture(true);
-		CycInt_MemorySnapShot_Capture(true);
-		M68000_MemorySnapShot_Capture(true);
-		MFP_MemorySnapShot_Capture(true);
-		PSG_MemorySnapShot_Capture(true);
-		Sound_MemorySnapShot_Capture(true);
-		Video_MemorySnapShot_Capture(true);
-		Blitter_MemorySnapShot_Capture(true);
-		DmaSnd_MemorySnapShot_Capture(true);
-		Crossbar_MemorySnapShot_Capture(true);
-		VIDEL_MemorySnapShot_Capture(true);
-		DSP_MemorySnapShot_Capture(true);
-		DebugUI_MemorySnapShot_Capture(pszFileName, true);
-		IoMem_MemorySnapShot_Capture(true);
-		/* end marker */
-		MemorySnapShot_Store(&magic, sizeof(magic));
+		MemorySnapShot_SaveAll(pszFileName);
 		/* And close */
 		MemorySnapShot_CloseFile();
 	} else {
@@ -349,49 +844,14 @@ void MemorySnapShot_Capture(const char *pszFileName, bool bConfirm)
  */
 void MemorySnapShot_Restore(const char *pszFileName, bool bConfirm)
 {
-	Uint32 magic;
+	/* the file may still be being saved */
+	if (nLastSaveDone != nLastSaveQueued)
+		FileWriter_Flush();
 
 	/* Set to 'restore' */
 	if (MemorySnapShot_OpenFile(pszFileName, false))
 	{
-		Configuration_MemorySnapShot_Capture(false);
-		TOS_MemorySnapShot_Capture(false);
-
-		/* Reset emulator to get things running */
-		IoMem_UnInit();  IoMem_Init();
-		Reset_Cold();
-
-		/* Capture each files details */
-		STMemory_MemorySnapShot_Capture(false);
-		Cycles_MemorySnapShot_Capture(false);			/* Before fdc (for CyclesGlobalClockCounter) */
-		FDC_MemorySnapShot_Capture(false);
-		Floppy_MemorySnapShot_Capture(false);
-		IPF_MemorySnapShot_Capture(false);			/* After fdc/floppy are restored, as IPF depends on them */
-		STX_MemorySnapShot_Capture(false);			/* After fdc/floppy are restored, as STX depends on them */
-		GemDOS_MemorySnapShot_Capture(false);
-		ACIA_MemorySnapShot_Capture(false);
-		IKBD_MemorySnapShot_Capture(false);			/* After ACIA */
-		CycInt_MemorySnapShot_Capture(false);
-		M68000_MemorySnapShot_Capture(false);
-		MFP_MemorySnapShot_Capture(false);
-		PSG_MemorySnapShot_Capture(false);
-		Sound_MemorySnapShot_Capture(false);
-		Video_MemorySnapShot_Capture(false);
-		Blitter_MemorySnapShot_Capture(false);
-		DmaSnd_MemorySnapShot_Capture(false);
-		Crossbar_MemorySnapShot_Capture(false);
-		VIDEL_MemorySnapShot_Capture(false);
-		DSP_MemorySnapShot_Capture(false);
-		DebugUI_MemorySnapShot_Capture(pszFileName, false);
-		IoMem_MemorySnapShot_Capture(false);
-
-		/* version string check catches release-to-release
-		 * state changes, bCaptureError catches too short
-		 * state file, this check a too long state file.
-		 */
-		MemorySnapShot_Store(&magic, sizeof(magic));
-		if (!bCaptureError && magic != SNAPSHOT_MAGIC)
-			bCaptureError = true;
+		MemorySnapShot_RestoreAll(pszFileName);
 
 		/* And close */
 		MemorySnapShot_CloseFile();
@@ -414,6 +874,90 @@ void MemorySnapShot_Restore(const char *pszFileName, bool bConfirm)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Like MemorySnapShot_CaptureMem(), but without a warning on failure,
+ * for callers which try a buffer first and grow it when it's too small.
+ */
+int MemorySnapShot_TryCaptureMem(void *pBuffer, int nSize)
+{
+	int nUsed;
+
+	if (!MemorySnapShot_OpenMem(pBuffer, nSize, true))
+		return -1;
+
+	MemorySnapShot_SaveAll(NULL);
+	nUsed = CaptureFile.nMemPos;
+	MemorySnapShot_CloseFile();
+
+	return bCaptureError ? -1 : nUsed;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Save 'snapshot' of memory/chips/emulation variables into given memory
+ * buffer, uncompressed. Nothing is written to the file system.
+ * Return number of bytes used, or -1 on error (e.g. buffer too small).
+ */
+int MemorySnapShot_CaptureMem(void *pBuffer, int nSize)
+{
+	int nUsed = MemorySnapShot_TryCaptureMem(pBuffer, nSize);
+
+	if (nUsed < 0)
+		Log_Printf(LOG_WARN, "Unable to save memory state to %d byte buffer.\n", nSize);
+	return nUsed;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return the number of bytes MemorySnapShot_CaptureMem() would need
+ * for the current emulation state, or -1 on error. This does a dry run
+ * of the save chain, no data is copied.
+ */
+int MemorySnapShot_Size(void)
+{
+	int nSize;
+
+	if (!MemorySnapShot_OpenSizeQuery())
+		return -1;
+
+	MemorySnapShot_SaveAll(NULL);
+	nSize = CaptureFile.nMemPos;
+	MemorySnapShot_CloseFile();
+
+	return bCaptureError ? -1 : nSize;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Restore 'snapshot' of memory/chips/emulation variables from given
+ * memory buffer (as saved by MemorySnapShot_CaptureMem()).
+ * Return true on success.
+ */
+bool MemorySnapShot_RestoreMem(const void *pBuffer, int nSize)
+{
+	/* buffer is only read from when restoring */
+	if (!MemorySnapShot_OpenMem((void *)pBuffer, nSize, false))
+		return false;
+
+	MemorySnapShot_RestoreAll(NULL);
+	MemorySnapShot_CloseFile();
+
+	/* changes may affect also info shown in statusbar */
+	Statusbar_UpdateInfo();
+
+	if (bCaptureError)
+	{
+		Log_AlertDlg(LOG_ERROR, "Full memory state restore failed!\nPlease reboot emulation.");
+		return false;
+	}
+	return true;
+}
+
+
 /*-----------------------------------------------------------------------*/
 /*
  * Save and restore functions required by the UAE CPU core...
@@ -141,6 +141,7 @@ const char MFP_fileid[] = "Hatari mfp.c : " __DATE__ " " __TIME__;
 #include "vdi.h"
 #include "screen.h"
 #include "video.h"
+#include "utils.h"
 
 
 /*
@@ -214,6 +215,13 @@ static bool TimerBCanResume = false;
 static bool TimerCCanResume = false;
 static bool TimerDCanResume = false;
 
+/* When a timer's interrupt is disabled in IER and its data register is not read, */
+/* each expiry only clears the pending bit. In that case, several periods are folded */
+/* into a single event in the interrupts table ; the event is unfolded again when the */
+/* timer is read, written or when its interrupt is enabled. */
+#define	MFP_TIMER_FOLD_CYCLES		32768		/* Max number of MFP cycles for a folded event */
+static int TimerFoldCycles[ 4 ];	/* Period of a folded timer, 0 if not folded (index is Handler - INTERRUPT_MFP_TIMERA) */
+
 bool bAppliedTimerDPatch;           /* true if the Timer-D patch has been applied */
 static int nTimerDFakeValue;        /* Faked Timer-D data register for the Timer-D patch */
 
@@ -222,6 +230,9 @@ static int PendingCyclesOver = 0;   /* >= 0 value, used to "loop" a timer when d
 
 #define	MFP_IRQ_DELAY_TO_CPU		4		/* When MFP_IRQ is set, it takes 4 CPU cycles before it's visible to the CPU */
 
+/* Ints checked by MFP_CheckPendingInterrupts() : all except 14, 11, 9 and 2 */
+#define	MFP_CHECKED_INTS		0xb5fb
+
 static int	MFP_Current_Interrupt = -1;
 static Uint8	MFP_IRQ = 0;
 static Uint64	MFP_IRQ_Time = 0;
@@ -257,7 +268,6 @@ static const Uint16 MFPDiv[] =
 
 static Uint8	MFP_ConvertIntNumber ( int Interrupt , Uint8 **pMFP_IER , Uint8 **pMFP_IPR , Uint8 **pMFP_ISR , Uint8 **pMFP_IMR );
 static void	MFP_Exception ( int Interrupt );
-static bool	MFP_InterruptRequest ( int Int , Uint8 Bit , Uint8 IPRx , Uint8 IMRx , Uint8 PriorityMaskA , Uint8 PriorityMaskB );
 static int	MFP_CheckPendingInterrupts ( void );
 
 
@@ -290,6 +300,8 @@ void MFP_Reset(void)
 	/* Clear counters */
 	TimerAClockCycles = TimerBClockCycles = 0;
 	TimerCClockCycles = TimerDClockCycles = 0;
+	for ( i=0 ; i<4 ; i++ )
+		TimerFoldCycles[ i ] = 0;
 
 	/* Clear IRQ */
 	MFP_Current_Interrupt = -1;
@@ -346,6 +358,7 @@ void MFP_MemorySnapShot_Capture(bool bSave)
 	MemorySnapShot_Store(&MFP_UpdateNeeded, sizeof(MFP_UpdateNeeded));
 	MemorySnapShot_Store(&MFP_Pending_Time_Min, sizeof(MFP_Pending_Time_Min));
 	MemorySnapShot_Store(&MFP_Pending_Time, sizeof(MFP_Pending_Time));
+	MemorySnapShot_Store(&TimerFoldCycles, sizeof(TimerFoldCycles));
 }
 
 
@@ -562,69 +575,53 @@ void MFP_UpdateIRQ ( Uint64 Event_Time )
 
 /*-----------------------------------------------------------------------*/
 /**
- * Test if interrupt 'Bit' is set in pending and mask register.
- * Also check that no higher priority interrupt is in service.
- * Depending on the interrupt, we check either IPRA/IMRA or IPRB/IMRB
- * @return true if the MFP interrupt request is allowed
+ * Return the number of the highest bit set in a non-zero 16 bit value.
  */
-static bool MFP_InterruptRequest ( int Int , Uint8 Bit , Uint8 IPRx , Uint8 IMRx , Uint8 PriorityMaskA , Uint8 PriorityMaskB )
+static inline int MFP_HighestBit ( Uint16 Bits )
 {
-//fprintf ( stderr , "mfp int req %d %x %x %X %x %x\n" , Int , Bit , IPRx , IMRx , PriorityMaskA , PriorityMaskB );
-
-	if ( ( IPRx & IMRx & Bit ) 					/* Interrupt is pending and not masked */
-	    && ( MFP_Pending_Time[ Int ] <= MFP_Pending_Time_Min ) )	/* Process pending requests in chronological time */
-	{
-		/* Are any higher priority interrupts in service ? */
-		if ( ( ( MFP_ISRA & PriorityMaskA ) == 0 ) && ( ( MFP_ISRB & PriorityMaskB ) == 0 ) )
-			return true;				/* No higher int in service */
-	}
+#ifdef __GNUC__
+	return 31 - __builtin_clz ( Bits );
+#else
+	int	Bit = 15;
 
-	return false;
+	while ( ( Bits & ( 1 << Bit ) ) == 0 )
+		Bit--;
+	return Bit;
+#endif
 }
 
 
 /*-----------------------------------------------------------------------*/
 /**
  * Check if any MFP interrupts can be serviced.
+ * Registers A and B are combined into 16 bit values, where bit N is
+ * MFP interrupt N ; as higher bits have higher priorities, the highest
+ * pending and non-masked bit gives the next candidate, and this interrupt
+ * is blocked if any in-service bit at the same or a higher position is set.
+ * Candidates are processed in chronological order : if the highest one
+ * became pending after the oldest pending interrupt, the next one is tried.
  * @return MFP interrupt number for the highest interrupt allowed, else return -1.
  */
 static int MFP_CheckPendingInterrupts ( void )
 {
-	if ( MFP_InterruptRequest ( MFP_INT_GPIP7 , MFP_GPIP7_BIT, MFP_IPRA, MFP_IMRA, 0x80, 0x00 ) )		/* Check MFP GPIP7 interrupt (bit 7) */
-		return MFP_INT_GPIP7;
-	
-	if ( MFP_InterruptRequest ( MFP_INT_TIMER_A , MFP_TIMER_A_BIT, MFP_IPRA, MFP_IMRA, 0xe0, 0x00 ) )	/* Check Timer A (bit 5) */
-		return MFP_INT_TIMER_A;
+	Uint16	Pending , InService;
+	int	Int;
 
-	if ( MFP_InterruptRequest ( MFP_INT_RCV_BUF_FULL , MFP_RCV_BUF_FULL_BIT, MFP_IPRA, MFP_IMRA, 0xf0, 0x00 ) )	/* Check Receive buffer full (bit 4) */
-		return MFP_INT_RCV_BUF_FULL;
+	Pending = ( ( MFP_IPRA << 8 ) | MFP_IPRB ) & ( ( MFP_IMRA << 8 ) | MFP_IMRB ) & MFP_CHECKED_INTS;
+	InService = ( MFP_ISRA << 8 ) | MFP_ISRB;
 
-	if ( MFP_InterruptRequest ( MFP_INT_TRN_BUF_EMPTY , MFP_TRN_BUF_EMPTY_BIT, MFP_IPRA, MFP_IMRA, 0xfc, 0x00 ) )	/* Check transmit buffer empty (bit 2) */
-		return MFP_INT_TRN_BUF_EMPTY;
-
-	if ( MFP_InterruptRequest ( MFP_INT_TIMER_B , MFP_TIMER_B_BIT, MFP_IPRA, MFP_IMRA, 0xff, 0x00 ) )	/* Check Timer B (bit 0) */
-		return MFP_INT_TIMER_B;
-
-	if ( MFP_InterruptRequest ( MFP_INT_GPIP5 , MFP_FDCHDC_BIT, MFP_IPRB, MFP_IMRB, 0xff, 0x80 ) )		/* Check FDC (bit 7) */
-		return MFP_INT_GPIP5;
-
-	if ( MFP_InterruptRequest ( MFP_INT_ACIA , MFP_ACIA_BIT, MFP_IPRB, MFP_IMRB, 0xff, 0xc0 ) )		/* Check ACIA (Keyboard or MIDI) (bit 6) */
-		return MFP_INT_ACIA;
-
-	if ( MFP_InterruptRequest ( MFP_INT_TIMER_C , MFP_TIMER_C_BIT, MFP_IPRB, MFP_IMRB, 0xff, 0xe0 ) )	/* Check Timer C (bit 5) */
-		return MFP_INT_TIMER_C;
-
-	if ( MFP_InterruptRequest ( MFP_INT_TIMER_D , MFP_TIMER_D_BIT, MFP_IPRB, MFP_IMRB, 0xff, 0xf0 ) )	/* Check Timer D (bit 4) */
-		return MFP_INT_TIMER_D;
+	while ( Pending )
+	{
+		Int = MFP_HighestBit ( Pending );
 
-	if ( MFP_InterruptRequest ( MFP_INT_GPU_DONE , MFP_GPU_DONE_BIT, MFP_IPRB, MFP_IMRB, 0xff, 0xf8 ) )	/* Check GPU done (bit 3) */
-		return MFP_INT_GPU_DONE;
+		if ( InService >> Int )				/* Same or higher priority int in service */
+			return -1;
 
-	if ( MFP_InterruptRequest ( MFP_INT_GPIP1 , MFP_GPIP1_BIT, MFP_IPRB, MFP_IMRB, 0xff, 0xfe ) )		/* Check (Falcon) Centronics ACK / (ST) RS232 DCD (bit 1) */
-		return MFP_INT_GPIP1;
+		if ( MFP_Pending_Time[ Int ] <= MFP_Pending_Time_Min )	/* Process pending requests in chronological time */
+			return Int;
 
-	if ( MFP_InterruptRequest ( MFP_INT_GPIP0 , MFP_GPIP0_BIT, MFP_IPRB, MFP_IMRB, 0xff, 0xff ) )		/* Check Centronics BUSY (bit 0) */
-		return MFP_INT_GPIP0;
+		Pending &= ~( 1 << Int );
+	}
 
 	return -1;						/* No pending interrupt */
 }
@@ -739,6 +736,60 @@ void MFP_TimerB_EventCount_Interrupt ( int Delayed_Cycles )
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Return the number of MFP cycles until the next event of a timer that is
+ * restarting after an interrupt. If the timer's interrupt is disabled in IER,
+ * each expiry has no visible effect, so we fold as many periods as possible
+ * into one event (keeping the value below MFP_TIMER_FOLD_CYCLES).
+ */
+static int MFP_TimerFold(interrupt_id Handler, int TimerClockCycles)
+{
+	Uint8	Enabled;
+	int	Periods;
+
+	switch ( Handler )
+	{
+	 case INTERRUPT_MFP_TIMERA:	Enabled = MFP_IERA & MFP_TIMER_A_BIT; break;
+	 case INTERRUPT_MFP_TIMERB:	Enabled = MFP_IERA & MFP_TIMER_B_BIT; break;
+	 case INTERRUPT_MFP_TIMERC:	Enabled = MFP_IERB & MFP_TIMER_C_BIT; break;
+	 default:			Enabled = MFP_IERB & MFP_TIMER_D_BIT; break;
+	}
+
+	Periods = MFP_TIMER_FOLD_CYCLES / TimerClockCycles;
+	if ( Enabled || ( Periods <= 1 ) )
+		return TimerClockCycles;
+
+	TimerFoldCycles[ Handler - INTERRUPT_MFP_TIMERA ] = TimerClockCycles;
+	return Periods * TimerClockCycles;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * If a timer's event was folded, remove the whole periods that are still
+ * to come after the current one, so the event occurs at the timer's next
+ * expiry again. As whole periods are removed in MFP cycles, the phase
+ * of the timer is not changed.
+ */
+static void MFP_TimerUnfold(interrupt_id Handler)
+{
+	int	TimerClockCycles = TimerFoldCycles[ Handler - INTERRUPT_MFP_TIMERA ];
+	int	Remaining;
+
+	if ( TimerClockCycles == 0 )
+		return;
+	TimerFoldCycles[ Handler - INTERRUPT_MFP_TIMERA ] = 0;
+
+	if ( !CycInt_InterruptActive ( Handler ) )
+		return;
+
+	Remaining = CycInt_FindCyclesPassed ( Handler, INT_MFP_CYCLE );
+	if ( Remaining > TimerClockCycles )
+		CycInt_ModifyInterrupt ( -( ( Remaining - 1 ) / TimerClockCycles ) * TimerClockCycles, INT_MFP_CYCLE, Handler );
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Start Timer A or B - EventCount mode is done in HBL handler to time correctly
@@ -783,7 +834,7 @@ static int MFP_StartTimer_AB(Uint8 TimerControl, Uint16 TimerData, interrupt_id
 		if ( ( M68000_GetPC() == 0x14d78 ) && ( STMemory_ReadLong ( 0x14d6c ) == 0x11faff75 ) )
 		{
 //			fprintf ( stderr , "mfp add jitter %d\n" , TimerClockCycles );
-			TimerClockCycles += rand()%5-2;		/* add jitter for wod2 */
+			TimerClockCycles += Hatari_rand()%5-2;		/* add jitter for wod2 */
 		}
 
 		if (LOG_TRACE_LEVEL(TRACE_MFP_START))
@@ -798,6 +849,7 @@ static int MFP_StartTimer_AB(Uint8 TimerControl, Uint16 TimerData, interrupt_id
 
 		/* And add to our internal interrupt list, if timer cycles is zero
 		 * then timer is stopped */
+		MFP_TimerUnfold(Handler);
 		CycInt_RemovePendingInterrupt(Handler);
 		if (TimerClockCycles)
 		{
@@ -820,7 +872,7 @@ static int MFP_StartTimer_AB(Uint8 TimerControl, Uint16 TimerData, interrupt_id
 					if ( PendingCyclesOver > TimerClockCyclesInternal )
 						PendingCyclesOver = PendingCyclesOver % TimerClockCyclesInternal;
 
-					CycInt_AddRelativeInterruptWithOffset(TimerClockCycles, INT_MFP_CYCLE, Handler, -PendingCyclesOver);
+					CycInt_AddRelativeInterruptWithOffset(MFP_TimerFold(Handler, TimerClockCycles), INT_MFP_CYCLE, Handler, -PendingCyclesOver);
 				}
 
 				*pTimerCanResume = true;		/* timer was set, resume is possible if stop/start it later */
@@ -846,12 +898,14 @@ static int MFP_StartTimer_AB(Uint8 TimerControl, Uint16 TimerData, interrupt_id
 	else if (TimerControl == 8 )				/* event count mode */
 	{
 		/* Make sure no outstanding interrupts in list if channel is disabled */
+		MFP_TimerUnfold(Handler);
 		CycInt_RemovePendingInterrupt(Handler);
 
 		if ( Handler == INTERRUPT_MFP_TIMERB )		/* we're starting timer B event count mode */
 		{
 			/* Store start cycle for handling interrupt in video.c */
 			TimerBEventCountCycleStart = Cycles_GetCounterOnWriteAccess(CYCLES_COUNTER_VIDEO);
+			Video_StartTimerB();			/* start end of line interrupts if needed */
 		}
 
 		if (LOG_TRACE_LEVEL(TRACE_MFP_START))
@@ -900,6 +954,7 @@ static int MFP_StartTimer_CD(Uint8 TimerControl, Uint16 TimerData, interrupt_id
 
 		/* And add to our internal interrupt list, if timer cycles is zero
 		 * then timer is stopped */
+		MFP_TimerUnfold(Handler);
 		CycInt_RemovePendingInterrupt(Handler);
 		if (TimerClockCycles)
 		{
@@ -922,7 +977,7 @@ static int MFP_StartTimer_CD(Uint8 TimerControl, Uint16 TimerData, interrupt_id
 					if ( PendingCyclesOver > TimerClockCyclesInternal )
 						PendingCyclesOver = PendingCyclesOver % TimerClockCyclesInternal;
 
-					CycInt_AddRelativeInterruptWithOffset(TimerClockCycles, INT_MFP_CYCLE, Handler, -PendingCyclesOver);
+					CycInt_AddRelativeInterruptWithOffset(MFP_TimerFold(Handler, TimerClockCycles), INT_MFP_CYCLE, Handler, -PendingCyclesOver);
 				}
 
 				*pTimerCanResume = true;		/* timer was set, resume is possible if stop/start it later */
@@ -943,6 +998,7 @@ static int MFP_StartTimer_CD(Uint8 TimerControl, Uint16 TimerData, interrupt_id
 		}
 
 		/* Make sure no outstanding interrupts in list if channel is disabled */
+		MFP_TimerUnfold(Handler);
 		CycInt_RemovePendingInterrupt(Handler);
 	}
 
@@ -958,6 +1014,8 @@ static Uint8 MFP_ReadTimer_AB(Uint8 TimerControl, Uint8 MainCounter, int TimerCy
 {
 //	int TimerCyclesPassed;
 
+	MFP_TimerUnfold(Handler);
+
 	/* Find TimerAB count, if no interrupt or not in delay mode assume
 	 * in Event Count mode so already up-to-date as kept by HBL */
 	if (CycInt_InterruptActive(Handler) && (TimerControl > 0) && (TimerControl <= 7))
@@ -1002,6 +1060,8 @@ static Uint8 MFP_ReadTimerCD(Uint8 TimerControl, Uint8 TimerData, Uint8 MainCoun
 {
 //	int TimerCyclesPassed;
 
+	MFP_TimerUnfold(Handler);
+
 	/* Find TimerCD count. If timer is off, MainCounter already contains
 	 * the latest value */
 	if (CycInt_InterruptActive(Handler))
@@ -1235,8 +1295,6 @@ void MFP_InterruptHandler_TimerD(void)
  */
 void MFP_GPIP_ReadByte(void)
 {
-	M68000_WaitState(4);
-
 	if (!bUseHighRes)
 		MFP_GPIP |= 0x80;   /* Color monitor -> set top bit */
 	else
@@ -1282,8 +1340,6 @@ void MFP_GPIP_ReadByte(void)
  */
 void MFP_ActiveEdge_ReadByte(void)
 {
-	M68000_WaitState(4);
-
 	IoMem[0xfffa03] = MFP_AER;
 }
 
@@ -1293,8 +1349,6 @@ void MFP_ActiveEdge_ReadByte(void)
  */
 void MFP_DataDirection_ReadByte(void)
 {
-	M68000_WaitState(4);
-
 	IoMem[0xfffa05] = MFP_DDR;
 }
 
@@ -1304,8 +1358,6 @@ void MFP_DataDirection_ReadByte(void)
  */
 void MFP_EnableA_ReadByte(void)
 {
-	M68000_WaitState(4);
-
 	IoMem[0xfffa07] = MFP_IERA;
 }
 
@@ -1315,8 +1367,6 @@ void MFP_EnableA_ReadByte(void)
  */
 void MFP_EnableB_ReadByte(void)
 {
-	M68000_WaitState(4);
-
 	IoMem[0xfffa09] = MFP_IERB;
 }
 
@@ -1326,8 +1376,6 @@ void MFP_EnableB_ReadByte(void)
  */
 void MFP_PendingA_ReadByte(void)
 {
-	M68000_WaitState(4);
-
 	IoMem[0xfffa0b] = MFP_IPRA;
 }
 
@@ -1337,8 +1385,6 @@ void MFP_PendingA_ReadByte(void)
  */
 void MFP_PendingB_ReadByte(void)
 {
-	M68000_WaitState(4);
-
 	IoMem[0xfffa0d] = MFP_IPRB;
 }
 
@@ -1348,8 +1394,6 @@ void MFP_PendingB_ReadByte(void)
  */
 void MFP_InServiceA_ReadByte(void)
 {
-	M68000_WaitState(4);
-
 	IoMem[0xfffa0f] = MFP_ISRA;
 }
 
@@ -1359,8 +1403,6 @@ void MFP_InServiceA_ReadByte(void)
  */
 void MFP_InServiceB_ReadByte(void)
 {
-	M68000_WaitState(4);
-
 	IoMem[0xfffa11] = MFP_ISRB;
 }
 
@@ -1370,8 +1412,6 @@ void MFP_InServiceB_ReadByte(void)
  */
 void MFP_MaskA_ReadByte(void)
 {
-	M68000_WaitState(4);
-
 	IoMem[0xfffa13] = MFP_IMRA;
 }
 
@@ -1381,8 +1421,6 @@ void MFP_MaskA_ReadByte(void)
  */
 void MFP_MaskB_ReadByte(void)
 {
-	M68000_WaitState(4);
-
 	IoMem[0xfffa15] = MFP_IMRB;
 }
 
@@ -1392,8 +1430,6 @@ void MFP_MaskB_ReadByte(void)
  */
 void MFP_VectorReg_ReadByte(void)
 {
-	M68000_WaitState(4);
-
 	IoMem[0xfffa17] = MFP_VR;
 }
 
@@ -1403,8 +1439,6 @@ void MFP_VectorReg_ReadByte(void)
  */
 void MFP_TimerACtrl_ReadByte(void)
 {
-	M68000_WaitState(4);
-
 	IoMem[0xfffa19] = MFP_TACR;
 }
 
@@ -1414,8 +1448,6 @@ void MFP_TimerACtrl_ReadByte(void)
  */
 void MFP_TimerBCtrl_ReadByte(void)
 {
-	M68000_WaitState(4);
-
 	IoMem[0xfffa1b] = MFP_TBCR;
 }
 
@@ -1425,8 +1457,6 @@ void MFP_TimerBCtrl_ReadByte(void)
  */
 void MFP_TimerCDCtrl_ReadByte(void)
 {
-	M68000_WaitState(4);
-
 	IoMem[0xfffa1d] = MFP_TCDCR;
 }
 
@@ -1436,8 +1466,6 @@ void MFP_TimerCDCtrl_ReadByte(void)
  */
 void MFP_TimerAData_ReadByte(void)
 {
-	M68000_WaitState(4);
-
 	if (MFP_TACR != 8)          		/* Is event count? Need to re-calculate counter */
 		MFP_ReadTimerA(false);		/* Stores result in 'MFP_TA_MAINCOUNTER' */
 
@@ -1452,8 +1480,6 @@ void MFP_TimerBData_ReadByte(void)
 {
 	Uint8 TB_count;
 
-	M68000_WaitState(4);
-
 	/* Is it event count mode or not? */
 	if (MFP_TBCR != 8)
 	{
@@ -1519,8 +1545,6 @@ void MFP_TimerBData_ReadByte(void)
  */
 void MFP_TimerCData_ReadByte(void)
 {
-	M68000_WaitState(4);
-
 	MFP_ReadTimerC(false);		/* Stores result in 'MFP_TC_MAINCOUNTER' */
 
 	IoMem[0xfffa23] = MFP_TC_MAINCOUNTER;
@@ -1534,8 +1558,6 @@ void MFP_TimerDData_ReadByte(void)
 {
 	Uint32 pc = M68000_GetPC();
 
-	M68000_WaitState(4);
-
 	if (ConfigureParams.System.bPatchTimerD && pc >= TosAddress && pc <= TosAddress + TosSize)
 	{
 		/* Trick the tos to believe it was changed: */
@@ -1555,8 +1577,6 @@ void MFP_TimerDData_ReadByte(void)
  */
 void MFP_GPIP_WriteByte(void)
 {
-	M68000_WaitState(4);
-
 	/* Nothing... */
 	/*fprintf(stderr, "Write to GPIP: %x\n", (int)IoMem[0xfffa01]);*/
 	/*MFP_GPIP = IoMem[0xfffa01];*/   /* TODO: What are the GPIP pins good for? */
@@ -1615,8 +1635,6 @@ void MFP_ActiveEdge_WriteByte(void)
  */
 void MFP_DataDirection_WriteByte(void)
 {
-	M68000_WaitState(4);
-
 	MFP_DDR = IoMem[0xfffa05];
 }
 
@@ -1626,9 +1644,11 @@ void MFP_DataDirection_WriteByte(void)
  */
 void MFP_EnableA_WriteByte(void)
 {
-	M68000_WaitState(4);
-
 	MFP_IERA = IoMem[0xfffa07];
+	if ( MFP_IERA & MFP_TIMER_A_BIT )
+		MFP_TimerUnfold(INTERRUPT_MFP_TIMERA);
+	if ( MFP_IERA & MFP_TIMER_B_BIT )
+		MFP_TimerUnfold(INTERRUPT_MFP_TIMERB);
 	MFP_IPRA &= MFP_IERA;
 	MFP_UpdateIRQ ( Cycles_GetClockCounterOnWriteAccess() );
 }
@@ -1639,9 +1659,11 @@ void MFP_EnableA_WriteByte(void)
  */
 void MFP_EnableB_WriteByte(void)
 {
-	M68000_WaitState(4);
-
 	MFP_IERB = IoMem[0xfffa09];
+	if ( MFP_IERB & MFP_TIMER_C_BIT )
+		MFP_TimerUnfold(INTERRUPT_MFP_TIMERC);
+	if ( MFP_IERB & MFP_TIMER_D_BIT )
+		MFP_TimerUnfold(INTERRUPT_MFP_TIMERD);
 	MFP_IPRB &= MFP_IERB;
 	MFP_UpdateIRQ ( Cycles_GetClockCounterOnWriteAccess() );
 }
@@ -1652,8 +1674,6 @@ void MFP_EnableB_WriteByte(void)
  */
 void MFP_PendingA_WriteByte(void)
 {
-	M68000_WaitState(4);
-
 	MFP_IPRA &= IoMem[0xfffa0b];				/* Cannot set pending bits - only clear via software */
 	MFP_UpdateIRQ ( Cycles_GetClockCounterOnWriteAccess() );
 }
@@ -1664,8 +1684,6 @@ void MFP_PendingA_WriteByte(void)
  */
 void MFP_PendingB_WriteByte(void)
 {
-	M68000_WaitState(4);
-
 	MFP_IPRB &= IoMem[0xfffa0d];				/* Cannot set pending bits - only clear via software */
 	MFP_UpdateIRQ ( Cycles_GetClockCounterOnWriteAccess() );
 }
@@ -1676,8 +1694,6 @@ void MFP_PendingB_WriteByte(void)
  */
 void MFP_InServiceA_WriteByte(void)
 {
-	M68000_WaitState(4);
-
 	MFP_ISRA &= IoMem[0xfffa0f];        			/* Cannot set in-service bits - only clear via software */
 	MFP_UpdateIRQ ( Cycles_GetClockCounterOnWriteAccess() );
 }
@@ -1688,8 +1704,6 @@ void MFP_InServiceA_WriteByte(void)
  */
 void MFP_InServiceB_WriteByte(void)
 {
-	M68000_WaitState(4);
-
 	MFP_ISRB &= IoMem[0xfffa11];        			/* Cannot set in-service bits - only clear via software */
 	MFP_UpdateIRQ ( Cycles_GetClockCounterOnWriteAccess() );
 }
@@ -1700,8 +1714,6 @@ void MFP_InServiceB_WriteByte(void)
  */
 void MFP_MaskA_WriteByte(void)
 {
-	M68000_WaitState(4);
-
 	MFP_IMRA = IoMem[0xfffa13];
 	MFP_UpdateIRQ ( Cycles_GetClockCounterOnWriteAccess() );
 }
@@ -1712,8 +1724,6 @@ void MFP_MaskA_WriteByte(void)
  */
 void MFP_MaskB_WriteByte(void)
 {
-	M68000_WaitState(4);
-
 	MFP_IMRB = IoMem[0xfffa15];
 	MFP_UpdateIRQ ( Cycles_GetClockCounterOnWriteAccess() );
 }
@@ -1726,8 +1736,6 @@ void MFP_VectorReg_WriteByte(void)
 {
 	Uint8 old_vr;
 
-	M68000_WaitState(4);
-
 	old_vr = MFP_VR;                    /* Copy for checking if set mode */
 	MFP_VR = IoMem[0xfffa17];
 
@@ -1761,8 +1769,6 @@ void MFP_TimerACtrl_WriteByte(void)
 {
 	Uint8 new_tacr;
 
-	M68000_WaitState(4);
-
 	new_tacr = IoMem[0xfffa19] & 0x0f;  /* FIXME : ignore bit 4 (reset) ? */
 
 	if ( MFP_TACR != new_tacr )         /* Timer control changed */
@@ -1787,8 +1793,6 @@ void MFP_TimerBCtrl_WriteByte(void)
 {
 	Uint8 new_tbcr;
 
-	M68000_WaitState(4);
-
 	new_tbcr = IoMem[0xfffa1b] & 0x0f;  /* FIXME : ignore bit 4 (reset) ? */
 
 	if (MFP_TBCR != new_tbcr)           /* Timer control changed */
@@ -1814,8 +1818,6 @@ void MFP_TimerCDCtrl_WriteByte(void)
 	Uint8 new_tcdcr;
 	Uint8 old_tcdcr;
 
-	M68000_WaitState(4);
-
 	new_tcdcr = IoMem[0xfffa1d];
 	old_tcdcr = MFP_TCDCR;
 //fprintf ( stderr , "write fa1d new %x old %x\n" , IoMem[0xfffa1d] , MFP_TCDCR );
@@ -1880,9 +1882,8 @@ void MFP_TimerCDCtrl_WriteByte(void)
  */
 void MFP_TimerAData_WriteByte(void)
 {
-	M68000_WaitState(4);
-
 	MFP_TADR = IoMem[0xfffa1f];         /* Store into data register */
+	MFP_TimerUnfold(INTERRUPT_MFP_TIMERA);	/* New data is used at the next expiry */
 
 	if (MFP_TACR == 0)                  /* Now check if timer is running - if so do not set */
 	{
@@ -1905,9 +1906,8 @@ void MFP_TimerAData_WriteByte(void)
  */
 void MFP_TimerBData_WriteByte(void)
 {
-	M68000_WaitState(4);
-
 	MFP_TBDR = IoMem[0xfffa21];         /* Store into data register */
+	MFP_TimerUnfold(INTERRUPT_MFP_TIMERB);	/* New data is used at the next expiry */
 
 	if (MFP_TBCR == 0)                  /* Now check if timer is running - if so do not set */
 	{
@@ -1930,9 +1930,8 @@ void MFP_TimerBData_WriteByte(void)
  */
 void MFP_TimerCData_WriteByte(void)
 {
-	M68000_WaitState(4);
-
 	MFP_TCDR = IoMem[0xfffa23];         /* Store into data register */
+	MFP_TimerUnfold(INTERRUPT_MFP_TIMERC);	/* New data is used at the next expiry */
 
 	if ((MFP_TCDCR&0x70) == 0)          /* Now check if timer is running - if so do not set */
 	{
@@ -1957,8 +1956,6 @@ void MFP_TimerDData_WriteByte(void)
 {
 	Uint32 pc = M68000_GetPC();
 
-	M68000_WaitState(4);
-
 	/* Need to change baud rate of RS232 emulation? */
 	if (ConfigureParams.RS232.bEnableRS232 && (IoMem[0xfffa1d] & 0x07))
 	{
@@ -1973,6 +1970,7 @@ void MFP_TimerDData_WriteByte(void)
 	}
 
 	MFP_TDDR = IoMem[0xfffa25];         /* Store into data register */
+	MFP_TimerUnfold(INTERRUPT_MFP_TIMERD);	/* New data is used at the next expiry */
 	if ((MFP_TCDCR&0x07) == 0)          /* Now check if timer is running - if so do not set */
 	{
 		MFP_TD_MAINCOUNTER = MFP_TDDR;  /* Timer is off, store to main counter */
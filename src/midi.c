@@ -9,6 +9,11 @@
   enough to let some ST programs (e.g. the game Pirates!) use the host's midi
   system.
 
+  Bytes are not passed to the host one by one: outgoing bytes are queued
+  with their delta time and handed to the frontend once per frame, and
+  incoming bytes are fetched once per frame into a queue from which they
+  are fed to the ACIA at the MIDI bit rate.
+
   TODO:
    - Most bits in the ACIA's status + control registers are currently ignored.
    - Check when we have to clear the ACIA_SR_INTERRUPT_REQUEST bit in the
@@ -36,6 +41,38 @@ const char Midi_fileid[] = "Hatari midi.c : " __DATE__ " " __TIME__;
 #define ACIA_SR_TX_EMPTY           0x02
 #define ACIA_SR_RX_FULL            0x01
 
+#define MIDI_QUEUE_SIZE            4096		/* Power of 2 */
+#define MIDI_QUEUE_MASK            (MIDI_QUEUE_SIZE-1)
+
+/* 1 start bit, 8 data bits, 1 stop bit at 31250 baud */
+#define MIDI_BYTE_CYCLES           ((Uint64)MachineClocks.CPU_Freq * 10 / 31250)
+
+typedef struct
+{
+	Uint8 Byte;
+	Uint64 Time;		/* Tx: delta time in us, Rx: clock cycle of reception */
+} MIDI_QUEUE_ENTRY;
+
+typedef struct
+{
+	MIDI_QUEUE_ENTRY Entry[MIDI_QUEUE_SIZE];
+	unsigned int Head;	/* Next entry to write */
+	unsigned int Tail;	/* Next entry to read */
+} MIDI_QUEUE;
+
+static MIDI_QUEUE MidiTxQueue;
+static MIDI_QUEUE MidiRxQueue;
+static Uint64 MidiRxLastDue;
+
+static struct
+{
+	Uint32 TxBytes;
+	Uint32 RxBytes;
+	Uint32 TxEarlyFlushes;	/* Tx queue was full before the end of the frame */
+	Uint32 RxDropped;	/* Rx queue was full, bytes from the host were lost */
+	Uint32 RxOverruns;	/* Byte received before the previous one was read */
+} MidiStats;
+
 
 struct retro_midi_interface *MidiRetroInterface;
 static Uint64 MidiWriteClockCounter;
@@ -45,12 +82,26 @@ static Uint8 MidiStatusRegister;
 static Uint8 nRxDataByte;
 
 
+static inline bool Midi_QueueEmpty(MIDI_QUEUE *q)
+{
+	return q->Head == q->Tail;
+}
+
+static inline bool Midi_QueueFull(MIDI_QUEUE *q)
+{
+	return ((q->Head + 1) & MIDI_QUEUE_MASK) == q->Tail;
+}
+
+
 /**
  * Initialization: Open MIDI device.
  */
 void Midi_Init(void)
 {
 	MidiWriteClockCounter = 0;
+	MidiTxQueue.Head = MidiTxQueue.Tail = 0;
+	MidiRxQueue.Head = MidiRxQueue.Tail = 0;
+	memset(&MidiStats, 0, sizeof(MidiStats));
 }
 
 
@@ -60,6 +111,13 @@ void Midi_Init(void)
 void Midi_UnInit(void)
 {
 	CycInt_RemovePendingInterrupt(INTERRUPT_MIDI);
+	Midi_FlushOutput();
+
+	if (MidiStats.TxBytes || MidiStats.RxBytes)
+		Log_Printf(LOG_INFO, "MIDI: %u bytes sent (%u early flushes), %u received"
+		           " (%u dropped, %u overruns)\n", MidiStats.TxBytes,
+		           MidiStats.TxEarlyFlushes, MidiStats.RxBytes,
+		           MidiStats.RxDropped, MidiStats.RxOverruns);
 }
 
 
@@ -72,6 +130,8 @@ void Midi_Reset(void)
 	MidiStatusRegister = ACIA_SR_TX_EMPTY;
 	nRxDataByte = 1;
 	MidiWriteClockCounter = 0;
+	MidiRxQueue.Head = MidiRxQueue.Tail = 0;
+	MidiRxLastDue = 0;
 
 	if (MidiRetroInterface)
 		CycInt_AddRelativeInterrupt(2050, INT_CPU_CYCLE, INTERRUPT_MIDI);
@@ -157,7 +217,7 @@ void Midi_Data_WriteByte(void)
 	if (MidiRetroInterface->output_enabled())
 	{
 		Uint64 deltaTime;
-		bool ret;
+		MIDI_QUEUE_ENTRY *e;
 
 		if (MidiWriteClockCounter == 0)
 			MidiWriteClockCounter = CyclesGlobalClockCounter;
@@ -167,9 +227,17 @@ void Midi_Data_WriteByte(void)
 		if (deltaTime > 0xFFFFFFFF)
 			deltaTime = 0;
 
-		ret = MidiRetroInterface->write(nTxDataByte, (uint32_t)deltaTime);
-		if (!ret)
-			LOG_TRACE(TRACE_MIDI, "MIDI: write error (doesn't stop MIDI)\n");
+		/* The frontend gets the whole frame at once, unless the
+		 * queue fills up before (e.g. long SysEx dumps) */
+		if (Midi_QueueFull(&MidiTxQueue))
+		{
+			MidiStats.TxEarlyFlushes++;
+			Midi_FlushOutput();
+		}
+		e = &MidiTxQueue.Entry[MidiTxQueue.Head];
+		e->Byte = nTxDataByte;
+		e->Time = deltaTime;
+		MidiTxQueue.Head = (MidiTxQueue.Head + 1) & MIDI_QUEUE_MASK;
 
 		MidiWriteClockCounter = CyclesGlobalClockCounter;
 	}
@@ -206,37 +274,90 @@ void Midi_InterruptHandler_Update(void)
 		MidiStatusRegister |= ACIA_SR_TX_EMPTY;
 	}
 
-	/* Read the bytes in, if we have any */
-	if (MidiRetroInterface && MidiRetroInterface->input_enabled())
+	/* Receive the next queued byte once its bit time has elapsed */
+	if (!Midi_QueueEmpty(&MidiRxQueue)
+	    && MidiRxQueue.Entry[MidiRxQueue.Tail].Time <= CyclesGlobalClockCounter)
 	{
-		bool ret;
-
-		ret = MidiRetroInterface->read(&nInChar);
-		if (ret)
+		nInChar = MidiRxQueue.Entry[MidiRxQueue.Tail].Byte;
+		MidiRxQueue.Tail = (MidiRxQueue.Tail + 1) & MIDI_QUEUE_MASK;
+		LOG_TRACE(TRACE_MIDI, "MIDI: Read character -> $%x\n", nInChar);
+		if (MidiStatusRegister & ACIA_SR_RX_FULL)
+			MidiStats.RxOverruns++;
+		nRxDataByte = nInChar;
+		/* Do we need to generate a receive interrupt? */
+		if ((MidiControlRegister & 0x80) == 0x80)
 		{
-			LOG_TRACE(TRACE_MIDI, "MIDI: Read character -> $%x\n", nInChar);
-			/* Copy into our internal queue */
-			nRxDataByte = nInChar;
-			/* Do we need to generate a receive interrupt? */
-			if ((MidiControlRegister & 0x80) == 0x80)
-			{
-				LOG_TRACE(TRACE_MIDI, "MIDI: WriteData receive interrupt!\n");
-				/* Acknowledge in MFP circuit */
-				MFP_InputOnChannel ( MFP_INT_ACIA , 0 );
-				MidiStatusRegister |= ACIA_SR_INTERRUPT_REQUEST;
-			}
-			MidiStatusRegister |= ACIA_SR_RX_FULL;
-			/* GPIP I4 - General Purpose Pin Keyboard/MIDI interrupt:
-			 * It will remain low(0) until data is read from $fffc06. */
-			MFP_GPIP &= ~0x10;
+			LOG_TRACE(TRACE_MIDI, "MIDI: WriteData receive interrupt!\n");
+			/* Acknowledge in MFP circuit */
+			MFP_InputOnChannel ( MFP_INT_ACIA , 0 );
+			MidiStatusRegister |= ACIA_SR_INTERRUPT_REQUEST;
 		}
-		else
-			LOG_TRACE(TRACE_MIDI, "MIDI: read error (doesn't stop MIDI)\n");
+		MidiStatusRegister |= ACIA_SR_RX_FULL;
+		/* GPIP I4 - General Purpose Pin Keyboard/MIDI interrupt:
+		 * It will remain low(0) until data is read from $fffc06. */
+		MFP_GPIP &= ~0x10;
 	}
 
 	CycInt_AddRelativeInterrupt(2050, INT_CPU_CYCLE, INTERRUPT_MIDI);
 }
 
+/**
+ * Fetch all bytes the host has received since the last call into the
+ * receive queue, timed so that they reach the ACIA one MIDI byte time
+ * apart. Called once per frame.
+ */
+void Midi_PollInput(void)
+{
+	Uint8 nInChar;
+	Uint64 due;
+
+	if (!MidiRetroInterface || !MidiRetroInterface->input_enabled())
+		return;
+
+	while (MidiRetroInterface->read(&nInChar))
+	{
+		if (Midi_QueueFull(&MidiRxQueue))
+		{
+			MidiStats.RxDropped++;
+			continue;
+		}
+		due = CyclesGlobalClockCounter;
+		if (due < MidiRxLastDue + MIDI_BYTE_CYCLES)
+			due = MidiRxLastDue + MIDI_BYTE_CYCLES;
+		MidiRxLastDue = due;
+
+		MidiRxQueue.Entry[MidiRxQueue.Head].Byte = nInChar;
+		MidiRxQueue.Entry[MidiRxQueue.Head].Time = due;
+		MidiRxQueue.Head = (MidiRxQueue.Head + 1) & MIDI_QUEUE_MASK;
+		MidiStats.RxBytes++;
+	}
+}
+
+
+/**
+ * Hand all queued outgoing bytes to the host. Called once per frame.
+ */
+void Midi_FlushOutput(void)
+{
+	MIDI_QUEUE_ENTRY *e;
+
+	if (Midi_QueueEmpty(&MidiTxQueue))
+		return;
+
+	while (!Midi_QueueEmpty(&MidiTxQueue))
+	{
+		e = &MidiTxQueue.Entry[MidiTxQueue.Tail];
+		if (MidiRetroInterface && !MidiRetroInterface->write(e->Byte, (uint32_t)e->Time))
+			LOG_TRACE(TRACE_MIDI, "MIDI: write error (doesn't stop MIDI)\n");
+		MidiTxQueue.Tail = (MidiTxQueue.Tail + 1) & MIDI_QUEUE_MASK;
+		MidiStats.TxBytes++;
+	}
+
+	if (MidiRetroInterface)
+		MidiRetroInterface->flush();
+}
+
+
 void Midi_SetRetroInterface(struct retro_midi_interface *interface)
 {
 	MidiRetroInterface = interface;
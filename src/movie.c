@@ -0,0 +1,567 @@
+/*
+  Hatari - movie.c
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+
+  Input movies: deterministic replay of recorded input.
+
+  A movie starts with an in-memory snapshot of the emulation state
+  (see memorySnapShot.c), taken at a frame boundary, followed by the
+  input the frontend gave to the emulation on every frame: IKBD key
+  presses, joystick and mouse state, and disk swaps. At the end of each
+  frame the VBL number and the emulation state hash are stored too.
+
+  Playing a movie restores the snapshot, feeds the recorded input back
+  instead of the frontend input, and compares the state hash of every
+  frame with the recorded one. This requires the deterministic mode,
+  without it the emulation state diverges right away. As nothing in a
+  movie depends on the host speed, it can be played headless at full
+  speed, e.g. with --benchmark and --run-vbls, to get a reproducible
+  benchmark of a real workload.
+
+  File format (gzip compressed when zlib is available), all numbers in
+  little endian byte order:
+    "HATARIMV", Uint32 version, Uint32 snapshot size, snapshot
+  followed by records, each starting with its type character:
+    'K' Uint8 scancode, Uint8 pressed
+    'I' Uint8 joystick 0, Uint8 joystick 1, Uint8 flags,
+        Sint16 mouse dx, Sint16 mouse dy
+    'D' Uint8 drive, Uint16 length, file name (empty for eject)
+    'F' Uint32 VBL, Uint32 state hash
+*/
+const char Movie_fileid[] = "Hatari movie.c : " __DATE__ " " __TIME__;
+
+#include "main.h"
+#include "configuration.h"
+#include "file.h"
+#include "floppy.h"
+#include "ikbd.h"
+#include "log.h"
+#include "memorySnapShot.h"
+#include "movie.h"
+#include "screen.h"
+#include "stMemory.h"
+#include "video.h"
+
+#if HAVE_LIBZ
+/* Remove possible conflicting mkdir declaration from cpu/sysdeps.h */
+#undef mkdir
+#include <zlib.h>
+typedef gzFile MOVIE_HANDLE;
+#else
+typedef FILE *MOVIE_HANDLE;
+#endif
+
+#define MOVIE_MAGIC		"HATARIMV"
+#define MOVIE_VERSION		1
+
+#define MOVIE_REC_KEY		'K'
+#define MOVIE_REC_INPUT		'I'
+#define MOVIE_REC_DISK		'D'
+#define MOVIE_REC_FRAME		'F'
+
+bool bMovieRecording;
+bool bMoviePlaying;
+
+static MOVIE_HANDLE MovieFile;
+static char *pszMovieName;
+static char *pszPendingName;	/* movie to start on next frame boundary */
+static bool bPendingRecord;
+static bool bMovieError;	/* write failed, stop at frame end */
+static int nNextRecord = -1;	/* peeked record type, 0 at end of file */
+
+static int nMovieFrames;
+static int nMismatches;
+static int nFirstMismatch;
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Store given value to buffer in little endian byte order
+ */
+static void Movie_Put16(Uint8 *p, Uint16 value)
+{
+	p[0] = value;
+	p[1] = value >> 8;
+}
+
+static void Movie_Put32(Uint8 *p, Uint32 value)
+{
+	p[0] = value;
+	p[1] = value >> 8;
+	p[2] = value >> 16;
+	p[3] = value >> 24;
+}
+
+static Uint16 Movie_Get16(const Uint8 *p)
+{
+	return p[0] | p[1] << 8;
+}
+
+static Uint32 Movie_Get32(const Uint8 *p)
+{
+	return p[0] | p[1] << 8 | p[2] << 16 | (Uint32)p[3] << 24;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Open given movie file, return NULL on failure
+ */
+static MOVIE_HANDLE Movie_FileOpen(const char *name, const char *mode)
+{
+#if HAVE_LIBZ
+	return gzopen(name, mode);
+#else
+	return fopen(name, mode);
+#endif
+}
+
+/**
+ * Read given number of bytes from the movie file, return false on failure
+ */
+static bool Movie_FileRead(MOVIE_HANDLE fh, void *pData, int nSize)
+{
+#if HAVE_LIBZ
+	return gzread(fh, pData, nSize) == nSize;
+#else
+	return nSize == 0 || fread(pData, nSize, 1, fh) == 1;
+#endif
+}
+
+/**
+ * Write given number of bytes to the movie file, return false on failure
+ */
+static bool Movie_FileWrite(MOVIE_HANDLE fh, const void *pData, int nSize)
+{
+#if HAVE_LIBZ
+	return nSize == 0 || gzwrite(fh, pData, nSize) == nSize;
+#else
+	return nSize == 0 || fwrite(pData, nSize, 1, fh) == 1;
+#endif
+}
+
+/**
+ * Close the movie file, return false if flushing it failed
+ */
+static bool Movie_FileClose(MOVIE_HANDLE fh)
+{
+#if HAVE_LIBZ
+	return gzclose(fh) == Z_OK;
+#else
+	return fclose(fh) == 0;
+#endif
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Write given bytes to the movie being recorded
+ */
+static void Movie_Write(const void *pData, int nSize)
+{
+	if (!bMovieError && !Movie_FileWrite(MovieFile, pData, nSize))
+	{
+		Log_Printf(LOG_ERROR, "Movie: writing '%s' failed!\n", pszMovieName);
+		bMovieError = true;
+	}
+}
+
+/**
+ * Read given number of bytes from the movie being played.
+ * Return false and stop playing if the file ends before that.
+ */
+static bool Movie_Read(void *pData, int nSize)
+{
+	if (Movie_FileRead(MovieFile, pData, nSize))
+		return true;
+
+	Log_Printf(LOG_ERROR, "Movie: '%s' is truncated!\n", pszMovieName);
+	Movie_Stop();
+	return false;
+}
+
+/**
+ * Return the type of the next record in the movie being played,
+ * or 0 at the end of the movie. The type is consumed by Movie_Read().
+ */
+static int Movie_PeekRecord(void)
+{
+	Uint8 type;
+
+	if (nNextRecord < 0)
+		nNextRecord = Movie_FileRead(MovieFile, &type, 1) ? type : 0;
+	return nNextRecord;
+}
+
+/**
+ * Read the contents of the peeked record
+ */
+static bool Movie_ReadRecord(void *pData, int nSize)
+{
+	nNextRecord = -1;
+	return Movie_Read(pData, nSize);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Open given movie file and start recording into it, from the current
+ * emulation state. Return false on failure.
+ */
+static bool Movie_StartRecording(const char *name)
+{
+	Uint8 header[16], *pState;
+	int nSize;
+
+	if (File_Exists(name))
+	{
+		Log_Printf(LOG_ERROR, "Movie: file '%s' already exists!\n", name);
+		return false;
+	}
+	nSize = MemorySnapShot_Size();
+	pState = nSize > 0 ? malloc(nSize) : NULL;
+	if (!pState || MemorySnapShot_CaptureMem(pState, nSize) != nSize)
+	{
+		Log_Printf(LOG_ERROR, "Movie: capturing the emulation state failed!\n");
+		free(pState);
+		return false;
+	}
+	MovieFile = Movie_FileOpen(name, "wb");
+	if (!MovieFile)
+	{
+		Log_Printf(LOG_ERROR, "Movie: opening '%s' failed!\n", name);
+		free(pState);
+		return false;
+	}
+
+	pszMovieName = strdup(name);
+	bMovieError = false;
+	memcpy(header, MOVIE_MAGIC, 8);
+	Movie_Put32(&header[8], MOVIE_VERSION);
+	Movie_Put32(&header[12], nSize);
+	Movie_Write(header, sizeof(header));
+	Movie_Write(pState, nSize);
+	free(pState);
+	if (bMovieError)
+	{
+		Movie_FileClose(MovieFile);
+		free(pszMovieName);
+		pszMovieName = NULL;
+		return false;
+	}
+
+	nMovieFrames = 0;
+	bMovieRecording = true;
+	Log_Printf(LOG_INFO, "Movie: recording to '%s' from VBL %d.\n", name, nVBLs);
+	return true;
+}
+
+/**
+ * Open given movie file, restore its emulation state and start
+ * playing it. Return false on failure.
+ */
+static bool Movie_StartPlayback(const char *name)
+{
+	Uint8 header[16], *pState;
+	Uint32 nSize;
+
+	MovieFile = Movie_FileOpen(name, "rb");
+	if (!MovieFile)
+	{
+		Log_Printf(LOG_ERROR, "Movie: opening '%s' failed!\n", name);
+		return false;
+	}
+	if (!Movie_FileRead(MovieFile, header, sizeof(header))
+	    || memcmp(header, MOVIE_MAGIC, 8) != 0
+	    || Movie_Get32(&header[8]) != MOVIE_VERSION)
+	{
+		Log_Printf(LOG_ERROR, "Movie: '%s' isn't a version %d movie!\n",
+		           name, MOVIE_VERSION);
+		Movie_FileClose(MovieFile);
+		return false;
+	}
+
+	nSize = Movie_Get32(&header[12]);
+	pState = nSize < 0x40000000 ? malloc(nSize) : NULL;
+	if (!pState || !Movie_FileRead(MovieFile, pState, nSize)
+	    || !MemorySnapShot_RestoreMem(pState, nSize))
+	{
+		Log_Printf(LOG_ERROR, "Movie: restoring the emulation state from '%s' failed!\n",
+		           name);
+		free(pState);
+		Movie_FileClose(MovieFile);
+		return false;
+	}
+	free(pState);
+
+	pszMovieName = strdup(name);
+	nNextRecord = -1;
+	nMovieFrames = nMismatches = 0;
+	nFirstMismatch = -1;
+	bMoviePlaying = true;
+	Log_Printf(LOG_INFO, "Movie: playing '%s' from VBL %d.\n", name, nVBLs);
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Start recording to given file on the next frame boundary
+ */
+void Movie_Record(const char *name)
+{
+	free(pszPendingName);
+	pszPendingName = strdup(name);
+	bPendingRecord = true;
+}
+
+/**
+ * Start playing given file on the next frame boundary
+ */
+void Movie_Play(const char *name)
+{
+	free(pszPendingName);
+	pszPendingName = strdup(name);
+	bPendingRecord = false;
+}
+
+/**
+ * Stop recording or playing, and show the playback result
+ */
+void Movie_Stop(void)
+{
+	if (bMovieRecording)
+	{
+		if (!Movie_FileClose(MovieFile) || bMovieError)
+			Log_Printf(LOG_ERROR, "Movie: writing '%s' failed!\n", pszMovieName);
+		else
+			Log_Printf(LOG_INFO, "Movie: %d frames recorded to '%s'.\n",
+			           nMovieFrames, pszMovieName);
+	}
+	else if (bMoviePlaying)
+	{
+		Movie_FileClose(MovieFile);
+		if (nMismatches)
+			Log_Printf(LOG_WARN, "Movie: %d frames played from '%s', %d state mismatches (first at VBL %d).\n",
+			           nMovieFrames, pszMovieName, nMismatches, nFirstMismatch);
+		else
+			Log_Printf(LOG_INFO, "Movie: %d frames played from '%s', all states matched.\n",
+			           nMovieFrames, pszMovieName);
+	}
+	bMovieRecording = bMoviePlaying = false;
+	free(pszMovieName);
+	pszMovieName = NULL;
+}
+
+/**
+ * Stop recording or playing, and forget a pending movie
+ */
+void Movie_UnInit(void)
+{
+	Movie_Stop();
+	free(pszPendingName);
+	pszPendingName = NULL;
+}
+
+/**
+ * Return number of frames whose state differed from the recorded one
+ * in the last played movie
+ */
+int Movie_GetMismatches(void)
+{
+	return nMismatches;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Add IKBD key press or release to the movie being recorded
+ */
+void Movie_RecordKey(Uint8 nScanCode, bool bPress)
+{
+	Uint8 rec[3];
+
+	rec[0] = MOVIE_REC_KEY;
+	rec[1] = nScanCode;
+	rec[2] = bPress;
+	Movie_Write(rec, sizeof(rec));
+}
+
+/**
+ * Add joystick and mouse input to the movie being recorded
+ */
+void Movie_RecordInput(const MOVIE_INPUT *pInput)
+{
+	Uint8 rec[8];
+
+	rec[0] = MOVIE_REC_INPUT;
+	rec[1] = pInput->nJoy0;
+	rec[2] = pInput->nJoy1;
+	rec[3] = pInput->nFlags;
+	Movie_Put16(&rec[4], pInput->nMouseDx);
+	Movie_Put16(&rec[6], pInput->nMouseDy);
+	Movie_Write(rec, sizeof(rec));
+}
+
+/**
+ * Add disk insertion (or ejection when name is NULL) to the movie
+ * being recorded
+ */
+void Movie_RecordDisk(int nDrive, const char *pszFileName)
+{
+	Uint8 rec[4];
+	int len = pszFileName ? strlen(pszFileName) : 0;
+
+	if (len > 0xffff)
+		len = 0xffff;
+	rec[0] = MOVIE_REC_DISK;
+	rec[1] = nDrive;
+	Movie_Put16(&rec[2], len);
+	Movie_Write(rec, sizeof(rec));
+	Movie_Write(pszFileName, len);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Play disk swap record from the movie
+ */
+static void Movie_PlayDisk(void)
+{
+	Uint8 rec[3];
+	char *pszFileName;
+	int len;
+
+	if (!Movie_ReadRecord(rec, sizeof(rec)))
+		return;
+	len = Movie_Get16(&rec[1]);
+	pszFileName = malloc(len + 1);
+	if (!pszFileName || !Movie_Read(pszFileName, len))
+	{
+		free(pszFileName);
+		return;
+	}
+	pszFileName[len] = '\0';
+
+	if (len == 0)
+		Floppy_EjectDiskFromDrive(rec[0]);
+	else if (Floppy_SetDiskFileName(rec[0], pszFileName, NULL))
+		Floppy_InsertDiskIntoDrive(rec[0]);
+	free(pszFileName);
+}
+
+/**
+ * Press the recorded keys and return the joystick and mouse input
+ * recorded for the current input update. Return false if no movie is
+ * played anymore.
+ */
+bool Movie_PlayInput(MOVIE_INPUT *pInput)
+{
+	Uint8 rec[7];
+
+	while (bMoviePlaying)
+	{
+		switch (Movie_PeekRecord())
+		{
+		 case MOVIE_REC_KEY:
+			if (Movie_ReadRecord(rec, 2))
+				IKBD_PressSTKey(rec[0], rec[1]);
+			break;
+		 case MOVIE_REC_DISK:
+			Movie_PlayDisk();
+			break;
+		 case MOVIE_REC_INPUT:
+			if (!Movie_ReadRecord(rec, 7))
+				return false;
+			pInput->nJoy0 = rec[0];
+			pInput->nJoy1 = rec[1];
+			pInput->nFlags = rec[2];
+			pInput->nMouseDx = (Sint16)Movie_Get16(&rec[3]);
+			pInput->nMouseDy = (Sint16)Movie_Get16(&rec[5]);
+			return true;
+		 default:
+			Log_Printf(LOG_ERROR, "Movie: no input recorded for VBL %d, playback out of sync!\n",
+			           nVBLs);
+			Movie_Stop();
+			return false;
+		}
+	}
+	return false;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Called by the frontend at the end of every emulated frame: record the
+ * state hash or compare it with the recorded one, and start or finish
+ * the movie.
+ */
+void Movie_FrameDone(void)
+{
+	Uint8 rec[9];
+	Uint32 hash;
+
+	if (pszPendingName)
+	{
+		char *name = pszPendingName;
+
+		pszPendingName = NULL;
+		Movie_Stop();
+		if (!ConfigureParams.System.bDeterministic)
+			Log_Printf(LOG_ERROR, "Movie: deterministic mode is needed for '%s'!\n", name);
+		else if (bPendingRecord)
+			Movie_StartRecording(name);
+		else if (Movie_StartPlayback(name))
+		{
+			/* disks swapped before the first frame */
+			while (bMoviePlaying && Movie_PeekRecord() == MOVIE_REC_DISK)
+				Movie_PlayDisk();
+		}
+		free(name);
+		return;
+	}
+
+	if (bMovieRecording)
+	{
+		rec[0] = MOVIE_REC_FRAME;
+		Movie_Put32(&rec[1], nVBLs);
+		Movie_Put32(&rec[5], STMemory_GetStateHash());
+		Movie_Write(rec, sizeof(rec));
+		nMovieFrames++;
+		if (bMovieError)
+			Movie_Stop();
+		return;
+	}
+
+	if (!bMoviePlaying)
+		return;
+
+	if (Movie_PeekRecord() != MOVIE_REC_FRAME)
+	{
+		Log_Printf(LOG_ERROR, "Movie: unplayed input left at VBL %d, playback out of sync!\n",
+		           nVBLs);
+		Movie_Stop();
+		return;
+	}
+	if (!Movie_ReadRecord(rec, 8))
+		return;
+	nMovieFrames++;
+	hash = STMemory_GetStateHash();
+	if (Movie_Get32(&rec[0]) != (Uint32)nVBLs || Movie_Get32(&rec[4]) != hash)
+	{
+		if (!nMismatches++)
+		{
+			nFirstMismatch = nVBLs;
+			Log_Printf(LOG_WARN, "Movie: VBL %d state hash %08x differs from recorded VBL %u hash %08x!\n",
+			           nVBLs, hash, Movie_Get32(&rec[0]), Movie_Get32(&rec[4]));
+		}
+	}
+
+	/* disks swapped between this and the next frame */
+	while (bMoviePlaying && Movie_PeekRecord() == MOVIE_REC_DISK)
+		Movie_PlayDisk();
+	if (bMoviePlaying && Movie_PeekRecord() == 0)
+		Movie_Stop();
+}
@@ -18,6 +18,17 @@ const char MSA_fileid[] = "Hatari msa.c : " __DATE__ " " __TIME__;
 #include "sysdeps.h"
 #include "maccess.h"
 
+/* SIMD versions of the run scanning (little endian only, for the mask bit order) */
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+# if defined(__SSE2__)
+#  include <emmintrin.h>
+#  define MSA_SIMD_SSE2 1
+# elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#  include <arm_neon.h>
+#  define MSA_SIMD_NEON 1
+# endif
+#endif
+
 
 #define SAVE_TO_MSA_IMAGES
 
@@ -113,98 +124,175 @@ bool MSA_FileNameIsMSA(const char *pszFileName, bool bAllowGZ)
 }
 
 
+/* Compressed image kept for on demand decoding of its tracks */
+typedef struct
+{
+	Uint8 *pMSAFile;
+	long nMSABytes;
+	int nBytesPerTrack;
+	long *pTrackOffsets;		/* of the track data, -1 if out of file */
+} MSA_LAZY;
+
+
 /*-----------------------------------------------------------------------*/
 /**
- * Uncompress .MSA data into a new buffer.
+ * Uncompress one MSA track with nDataLength bytes of (possibly
+ * RLE compressed) data into nBytesPerTrack bytes at pImageBuffer.
  */
-Uint8 *MSA_UnCompress(Uint8 *pMSAFile, long *pImageSize)
+static void MSA_UnCompressTrack(Uint8 *pMSAImageBuffer, int nDataLength,
+                                Uint8 *pImageBuffer, int nBytesPerTrack)
 {
-	MSAHEADERSTRUCT *pMSAHeader;
-	Uint8 *pMSAImageBuffer, *pImageBuffer;
+	Uint8 *pEnd = pMSAImageBuffer + nDataLength;
 	Uint8 Byte,Data;
-	int i,Track,Side,DataLength,NumBytesUnCompressed,RunLength;
+	int NumBytesUnCompressed,RunLength;
+
+	if (nDataLength == nBytesPerTrack)
+	{
+		/* No compression on track, simply copy */
+		memcpy(pImageBuffer, pMSAImageBuffer, nBytesPerTrack);
+		return;
+	}
+
+	/* Uncompress track */
+	NumBytesUnCompressed = 0;
+	while (NumBytesUnCompressed < nBytesPerTrack && pMSAImageBuffer < pEnd)
+	{
+		Byte = *pMSAImageBuffer++;
+		if (Byte != 0xE5 || pEnd - pMSAImageBuffer < 3)   /* Compressed header?? */
+		{
+			*pImageBuffer++ = Byte;       /* No, just copy byte */
+			NumBytesUnCompressed++;
+		}
+		else
+		{
+			Data = *pMSAImageBuffer++;    /* Byte to copy */
+			RunLength = do_get_mem_word(pMSAImageBuffer);  /* For length */
+			/* Limit length to size of track, incorrect images may overflow */
+			if (RunLength+NumBytesUnCompressed > nBytesPerTrack)
+			{
+				fprintf(stderr, "MSA_UnCompress: Illegal run length -> corrupted disk image?\n");
+				RunLength = nBytesPerTrack - NumBytesUnCompressed;
+			}
+			pMSAImageBuffer += sizeof(Uint16);
+			memset(pImageBuffer, Data, RunLength);
+			pImageBuffer += RunLength;
+			NumBytesUnCompressed += RunLength;
+		}
+	}
+}
+
+/**
+ * Decode given track of an MSA image into the disk buffer
+ */
+static bool MSA_LoadTrack(void *pData, Uint8 *pBuffer, int nTrack, Uint8 *pLoaded)
+{
+	MSA_LAZY *pLazy = pData;
+	long nOffset = pLazy->pTrackOffsets[nTrack];
+
+	pLoaded[nTrack] = 1;
+	if (nOffset < 0)
+		return false;
+	MSA_UnCompressTrack(pLazy->pMSAFile + nOffset + sizeof(Uint16),
+	                    do_get_mem_word(pLazy->pMSAFile + nOffset),
+	                    pBuffer + (long)nTrack * pLazy->nBytesPerTrack,
+	                    pLazy->nBytesPerTrack);
+	return true;
+}
+
+static void MSA_FreeLazy(void *pData)
+{
+	MSA_LAZY *pLazy = pData;
+
+	free(pLazy->pTrackOffsets);
+	free(pLazy->pMSAFile);
+	free(pLazy);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Set up uncompressing of (nMSABytes long) .MSA data into a new buffer
+ * for given drive.  Only the track offsets are indexed here, the tracks
+ * themselves are uncompressed by the floppy code on first access.
+ * Takes over the pMSAFile buffer in all cases.
+ */
+Uint8 *MSA_UnCompress(int Drive, Uint8 *pMSAFile, long nMSABytes, long *pImageSize)
+{
+	MSAHEADERSTRUCT *pMSAHeader;
+	MSA_LAZY *pLazy;
+	int nTracks, nBytesPerTrack, i;
+	long nOffset;
 	Uint8 *pBuffer = NULL;
 
 	*pImageSize = 0;
 
 	/* Is an '.msa' file?? Check header */
 	pMSAHeader = (MSAHEADERSTRUCT *)pMSAFile;
-	if (pMSAHeader->ID == SDL_SwapBE16(0x0E0F))
+	if (nMSABytes < (long)sizeof(MSAHEADERSTRUCT) || pMSAHeader->ID != SDL_SwapBE16(0x0E0F))
 	{
-		/* First swap 'header' words around to PC format - easier later on */
-		pMSAHeader->SectorsPerTrack = SDL_SwapBE16(pMSAHeader->SectorsPerTrack);
-		pMSAHeader->Sides = SDL_SwapBE16(pMSAHeader->Sides);
-		pMSAHeader->StartingTrack = SDL_SwapBE16(pMSAHeader->StartingTrack);
-		pMSAHeader->EndingTrack = SDL_SwapBE16(pMSAHeader->EndingTrack);
-
-		/* Create buffer */
-		pBuffer = malloc((pMSAHeader->EndingTrack - pMSAHeader->StartingTrack + 1)
-		                 * pMSAHeader->SectorsPerTrack * (pMSAHeader->Sides + 1)
-		                 * NUMBYTESPERSECTOR);
-		if (!pBuffer)
-		{
-			perror("MSA_UnCompress");
-			return NULL;
-		}
+		free(pMSAFile);
+		return NULL;
+	}
 
-		/* Set pointers */
-		pImageBuffer = (Uint8 *)pBuffer;
-		pMSAImageBuffer = pMSAFile + sizeof(MSAHEADERSTRUCT);
+	/* First swap 'header' words around to PC format - easier later on */
+	pMSAHeader->SectorsPerTrack = SDL_SwapBE16(pMSAHeader->SectorsPerTrack);
+	pMSAHeader->Sides = SDL_SwapBE16(pMSAHeader->Sides);
+	pMSAHeader->StartingTrack = SDL_SwapBE16(pMSAHeader->StartingTrack);
+	pMSAHeader->EndingTrack = SDL_SwapBE16(pMSAHeader->EndingTrack);
 
-		/* Uncompress to memory as '.ST' disk image - NOTE: assumes 512 bytes
-		 * per sector (use NUMBYTESPERSECTOR define)!!! */
-		for (Track = pMSAHeader->StartingTrack; Track <= pMSAHeader->EndingTrack; Track++)
+	nTracks = (pMSAHeader->EndingTrack - pMSAHeader->StartingTrack + 1) * (pMSAHeader->Sides + 1);
+	nBytesPerTrack = NUMBYTESPERSECTOR * pMSAHeader->SectorsPerTrack;
+	if (nTracks <= 0 || nBytesPerTrack == 0)
+	{
+		free(pMSAFile);
+		return NULL;
+	}
+
+	/* Create buffer (NOTE: assumes 512 bytes per sector), and
+	 * index the tracks, which are stored in alternating side order
+	 * like in an '.ST' image */
+	pBuffer = calloc(nTracks, nBytesPerTrack);
+	pLazy = malloc(sizeof(*pLazy));
+	if (pLazy)
+		pLazy->pTrackOffsets = malloc(nTracks * sizeof(long));
+	if (!pBuffer || !pLazy || !pLazy->pTrackOffsets)
+	{
+		perror("MSA_UnCompress");
+		if (pLazy)
+			free(pLazy->pTrackOffsets);
+		free(pLazy);
+		free(pBuffer);
+		free(pMSAFile);
+		return NULL;
+	}
+	nOffset = sizeof(MSAHEADERSTRUCT);
+	for (i = 0; i < nTracks; i++)
+	{
+		if (nOffset < 0 || nOffset + (long)sizeof(Uint16) > nMSABytes
+		    || nOffset + (long)sizeof(Uint16) + do_get_mem_word(pMSAFile + nOffset) > nMSABytes)
 		{
-			for (Side = 0; Side < (pMSAHeader->Sides+1); Side++)
-			{
-				int nBytesPerTrack = NUMBYTESPERSECTOR*pMSAHeader->SectorsPerTrack;
-
-				/* Uncompress MSA Track, first check if is not compressed */
-				DataLength = do_get_mem_word(pMSAImageBuffer);
-				pMSAImageBuffer += sizeof(Uint16);
-				if (DataLength == nBytesPerTrack)
-				{
-					/* No compression on track, simply copy and continue */
-					memcpy(pImageBuffer, pMSAImageBuffer, nBytesPerTrack);
-					pImageBuffer += nBytesPerTrack;
-					pMSAImageBuffer += DataLength;
-				}
-				else
-				{
-					/* Uncompress track */
-					NumBytesUnCompressed = 0;
-					while (NumBytesUnCompressed < nBytesPerTrack)
-					{
-						Byte = *pMSAImageBuffer++;
-						if (Byte != 0xE5)                 /* Compressed header?? */
-						{
-							*pImageBuffer++ = Byte;       /* No, just copy byte */
-							NumBytesUnCompressed++;
-						}
-						else
-						{
-							Data = *pMSAImageBuffer++;    /* Byte to copy */
-							RunLength = do_get_mem_word(pMSAImageBuffer);  /* For length */
-							/* Limit length to size of track, incorrect images may overflow */
-							if (RunLength+NumBytesUnCompressed > nBytesPerTrack)
-							{
-								fprintf(stderr, "MSA_UnCompress: Illegal run length -> corrupted disk image?\n");
-								RunLength = nBytesPerTrack - NumBytesUnCompressed;
-							}
-							pMSAImageBuffer += sizeof(Uint16);
-							for (i = 0; i < RunLength; i++)
-								*pImageBuffer++ = Data;   /* Copy byte */
-							NumBytesUnCompressed += RunLength;
-						}
-					}
-				}
-			}
+			pLazy->pTrackOffsets[i] = nOffset = -1;
+			continue;
 		}
-
-		/* Set size of loaded image */
-		*pImageSize = pImageBuffer-pBuffer;
+		pLazy->pTrackOffsets[i] = nOffset;
+		nOffset += sizeof(Uint16) + do_get_mem_word(pMSAFile + nOffset);
+	}
+	if (pLazy->pTrackOffsets[nTracks-1] < 0)
+		fprintf(stderr, "MSA_UnCompress: Image is truncated -> corrupted disk image?\n");
+
+	pLazy->pMSAFile = pMSAFile;
+	pLazy->nMSABytes = nMSABytes;
+	pLazy->nBytesPerTrack = nBytesPerTrack;
+	if (!Floppy_SetLazyImage(Drive, pBuffer, pLazy, nBytesPerTrack, nTracks,
+	                         MSA_LoadTrack, MSA_FreeLazy))
+	{
+		free(pBuffer);
+		return NULL;
 	}
 
+	/* Set size of loaded image */
+	*pImageSize = (long)nTracks * nBytesPerTrack;
+
 	/* Return pointer to buffer, NULL if failed */
 	return(pBuffer);
 }
@@ -212,28 +300,23 @@ Uint8 *MSA_UnCompress(Uint8 *pMSAFile, long *pImageSize)
 
 /*-----------------------------------------------------------------------*/
 /**
- * Uncompress .MSA file into memory, set number bytes of the disk image and
- * return a pointer to the buffer.
+ * Read .MSA file into memory, set number bytes of the disk image and
+ * return a pointer to the buffer. Tracks are uncompressed on demand.
  */
 Uint8 *MSA_ReadDisk(int Drive, const char *pszFileName, long *pImageSize, int *pImageType)
 {
 	Uint8 *pMsaFile;
 	Uint8 *pDiskBuffer = NULL;
+	long nMsaBytes = 0;
 
 	*pImageSize = 0;
 
-	/* Read in file */
-	pMsaFile = HFile_Read(pszFileName, NULL, NULL);
+	/* Read in file, and set up uncompressing it into disk buffer */
+	pMsaFile = HFile_Read(pszFileName, &nMsaBytes, NULL);
 	if (pMsaFile)
-	{
-		/* Uncompress into disk buffer */
-		pDiskBuffer = MSA_UnCompress(pMsaFile, pImageSize);
-
-		/* Free MSA file we loaded */
-		free(pMsaFile);
-	}
+		pDiskBuffer = MSA_UnCompress(Drive, pMsaFile, nMsaBytes, pImageSize);
 
-	if ( ( pMsaFile == NULL ) || ( pDiskBuffer == NULL ) )
+	if (pDiskBuffer == NULL)
 		return NULL;
 
 	*pImageType = FLOPPY_IMAGE_TYPE_MSA;
@@ -244,45 +327,128 @@ Uint8 *MSA_ReadDisk(int Drive, const char *pszFileName, long *pImageSize, int *p
 
 /*-----------------------------------------------------------------------*/
 /**
- * Return number of bytes of the same byte in the passed buffer
- * If we return '0' this means no run (or end of buffer)
+ * Return number of bytes at the start of the buffer which are the same
+ * as the first one (at least 1)
  */
-static int MSA_FindRunOfBytes(Uint8 *pBuffer, int nBytesInBuffer)
+static int MSA_RunLength(const Uint8 *pBuffer, int nBytes)
 {
-	Uint8 ScannedByte;
-	int nTotalRun;
-	bool bMarker;
-	int i;
+	Uint8 Byte = pBuffer[0];
+	int i = 1;
 
-	/* Is this the marker? If so, this is at least a run of one. */
-	bMarker = (*pBuffer == 0xE5);
+#if MSA_SIMD_SSE2
+	const __m128i vByte = _mm_set1_epi8(Byte);
 
-	/* Do we enough for a run? */
-	if (nBytesInBuffer < 2)
+	for ( ; i + 16 <= nBytes; i += 16)
 	{
-		if (nBytesInBuffer == 1 && bMarker)
-			return 1;
-		else
-			return 0;
+		__m128i v = _mm_loadu_si128((const __m128i *)(pBuffer + i));
+		int mask = ~_mm_movemask_epi8(_mm_cmpeq_epi8(v, vByte)) & 0xffff;
+		if (mask)
+			return i + __builtin_ctz(mask);
+	}
+#elif MSA_SIMD_NEON
+	const uint8x16_t vByte = vdupq_n_u8(Byte);
+
+	for ( ; i + 16 <= nBytes; i += 16)
+	{
+		uint8x16_t ne = vmvnq_u8(vceqq_u8(vld1q_u8(pBuffer + i), vByte));
+		/* 4 mask bits per byte */
+		uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(ne), 4)), 0);
+		if (mask)
+			return i + (__builtin_ctzll(mask) >> 2);
 	}
+#endif
+	while (i < nBytes && pBuffer[i] == Byte)
+		i++;
+	return i;
+}
+
 
-	/* OK, scan for run */
-	nTotalRun = 1;
-	ScannedByte = *pBuffer++;
+/*-----------------------------------------------------------------------*/
+/**
+ * Return number of bytes at the start of the buffer which are stored
+ * as they are, i.e. up to the first $E5 marker byte or the first run
+ * of at least 4 same bytes (shorter runs don't make a difference).
+ */
+static int MSA_LiteralLength(const Uint8 *pBuffer, int nBytes)
+{
+	int i = 0;
+
+#if MSA_SIMD_SSE2
+	const __m128i vMarker = _mm_set1_epi8((char)0xE5);
 
-	for (i = 1; i < nBytesInBuffer; i++)
+	/* compares bytes i..i+15 with the next 3 ones */
+	for ( ; i + 19 <= nBytes; i += 16)
 	{
-		if (*pBuffer++ == ScannedByte)
-			nTotalRun++;
-		else
+		__m128i a = _mm_loadu_si128((const __m128i *)(pBuffer + i));
+		__m128i b = _mm_loadu_si128((const __m128i *)(pBuffer + i + 1));
+		__m128i c = _mm_loadu_si128((const __m128i *)(pBuffer + i + 2));
+		__m128i d = _mm_loadu_si128((const __m128i *)(pBuffer + i + 3));
+		__m128i run = _mm_and_si128(_mm_cmpeq_epi8(a, b),
+		                            _mm_and_si128(_mm_cmpeq_epi8(b, c), _mm_cmpeq_epi8(c, d)));
+		int mask = _mm_movemask_epi8(_mm_or_si128(run, _mm_cmpeq_epi8(a, vMarker)));
+		if (mask)
+			return i + __builtin_ctz(mask);
+	}
+#elif MSA_SIMD_NEON
+	const uint8x16_t vMarker = vdupq_n_u8(0xE5);
+
+	for ( ; i + 19 <= nBytes; i += 16)
+	{
+		uint8x16_t a = vld1q_u8(pBuffer + i);
+		uint8x16_t b = vld1q_u8(pBuffer + i + 1);
+		uint8x16_t c = vld1q_u8(pBuffer + i + 2);
+		uint8x16_t d = vld1q_u8(pBuffer + i + 3);
+		uint8x16_t run = vandq_u8(vceqq_u8(a, b), vandq_u8(vceqq_u8(b, c), vceqq_u8(c, d)));
+		uint8x16_t stop = vorrq_u8(run, vceqq_u8(a, vMarker));
+		uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(stop), 4)), 0);
+		if (mask)
+			return i + (__builtin_ctzll(mask) >> 2);
+	}
+#endif
+	for ( ; i < nBytes; i++)
+	{
+		if (pBuffer[i] == 0xE5)
+			break;
+		if (i + 3 < nBytes && pBuffer[i] == pBuffer[i+1]
+		    && pBuffer[i] == pBuffer[i+2] && pBuffer[i] == pBuffer[i+3])
 			break;
 	}
+	return i;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * RLE compress given track to pDest, which needs room for nBytes + 3.
+ * Return the compressed size, or nBytes if the track doesn't get any
+ * smaller (it's then stored uncompressed).
+ */
+static int MSA_CompressTrack(Uint8 *pDest, const Uint8 *pTrack, int nBytes)
+{
+	int nPos = 0, nOut = 0, n;
+
+	while (nPos < nBytes && nOut < nBytes)
+	{
+		/* Copy bytes up to the next run... */
+		n = MSA_LiteralLength(pTrack + nPos, nBytes - nPos);
+		if (n > nBytes - nOut)
+			return nBytes;
+		memcpy(pDest + nOut, pTrack + nPos, n);
+		nOut += n;
+		nPos += n;
+		if (nPos == nBytes)
+			break;
 
-	/* Was this enough of a run to make a difference? */
-	if (nTotalRun < 4 && !bMarker)
-		nTotalRun = 0;                  /* Just store uncompressed */
+		/* ...and store the run: marker, byte and 16-bit length */
+		n = MSA_RunLength(pTrack + nPos, nBytes - nPos);
+		pDest[nOut++] = 0xE5;
+		pDest[nOut++] = pTrack[nPos];
+		do_put_mem_word(pDest + nOut, n);
+		nOut += sizeof(Uint16);
+		nPos += n;
+	}
 
-	return nTotalRun;
+	return nOut < nBytes ? nOut : nBytes;
 }
 
 
@@ -295,11 +461,10 @@ bool MSA_WriteDisk(int Drive, const char *pszFileName, Uint8 *pBuffer, int Image
 #ifdef SAVE_TO_MSA_IMAGES
 
 	MSAHEADERSTRUCT *pMSAHeader;
-	Uint16 *pMSADataLength;
 	Uint8 *pMSAImageBuffer, *pMSABuffer, *pImageBuffer;
-	Uint16 nSectorsPerTrack, nSides, nCompressedBytes, nBytesPerTrack;
+	Uint16 nSectorsPerTrack, nSides, nBytesPerTrack;
 	bool nRet;
-	int nTracks,nBytesToGo,nBytesRun;
+	int nTracks, nCompressedBytes;
 	int Track,Side;
 
 	/* Allocate workspace for compressed image */
@@ -330,56 +495,20 @@ bool MSA_WriteDisk(int Drive, const char *pszFileName, Uint8 *pBuffer, int Image
 			nBytesPerTrack = NUMBYTESPERSECTOR*nSectorsPerTrack;
 			pImageBuffer = pBuffer + (nBytesPerTrack*Side) + ((nBytesPerTrack*nSides)*Track);
 
-			/* Skip data length (fill in later) */
-			pMSADataLength = (Uint16 *)pMSABuffer;
+			/* Compress track after its data length */
+			nCompressedBytes = MSA_CompressTrack(pMSABuffer + sizeof(Uint16), pImageBuffer, nBytesPerTrack);
+			do_put_mem_word(pMSABuffer, nCompressedBytes);
 			pMSABuffer += sizeof(Uint16);
 
-			/* Compress track */
-			nBytesToGo = nBytesPerTrack;
-			nCompressedBytes = 0;
-			while (nBytesToGo > 0)
-			{
-				nBytesRun = MSA_FindRunOfBytes(pImageBuffer,nBytesToGo);
-				if (nBytesRun == 0)
-				{
-					/* Just copy byte */
-					*pMSABuffer++ = *pImageBuffer++;
-					nCompressedBytes++;
-					nBytesRun = 1;
-				}
-				else
-				{
-					/* Store run! */
-					*pMSABuffer++ = 0xE5;               /* Marker */
-					*pMSABuffer++ = *pImageBuffer;      /* Byte, and follow with 16-bit length */
-					do_put_mem_word(pMSABuffer, nBytesRun);
-					pMSABuffer += sizeof(Uint16);
-					pImageBuffer += nBytesRun;
-					nCompressedBytes += 4;
-				}
-				nBytesToGo -= nBytesRun;
-			}
-
-			/* Is compressed track smaller than the original? */
-			if (nCompressedBytes < nBytesPerTrack)
-			{
-				/* Yes, store size */
-				do_put_mem_word(pMSADataLength, nCompressedBytes);
-			}
-			else
-			{
-				/* No, just store uncompressed track */
-				do_put_mem_word(pMSADataLength, nBytesPerTrack);
-				pMSABuffer = ((Uint8 *)pMSADataLength) + 2;
-				pImageBuffer = pBuffer + (nBytesPerTrack*Side) + ((nBytesPerTrack*nSides)*Track);
-				memcpy(pMSABuffer,pImageBuffer, nBytesPerTrack);
-				pMSABuffer += nBytesPerTrack;
-			}
+			/* Is compressed track smaller than the original? If not, just store uncompressed track */
+			if (nCompressedBytes == nBytesPerTrack)
+				memcpy(pMSABuffer, pImageBuffer, nBytesPerTrack);
+			pMSABuffer += nCompressedBytes;
 		}
 	}
 
 	/* And save to file! */
-	nRet = File_Save(pszFileName,pMSAImageBuffer, pMSABuffer-pMSAImageBuffer, false);
+	nRet = File_SaveReplace(pszFileName, pMSAImageBuffer, pMSABuffer-pMSAImageBuffer);
 
 	/* Free workspace */
 	free(pMSAImageBuffer);
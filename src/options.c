@@ -27,6 +27,8 @@ const char Options_fileid[] = "Hatari options.c : " __DATE__ " " __TIME__;
 #include "control.h"
 #include "debugui.h"
 #include "file.h"
+#include "fileWriter.h"
+#include "rowPool.h"
 #include "floppy.h"
 #include "fdc.h"
 #include "screen.h"
@@ -41,11 +43,17 @@ const char Options_fileid[] = "Hatari options.c : " __DATE__ " " __TIME__;
 #include "avi_record.h"
 #include "hatari-glue.h"
 #include "68kDisass.h"
+#include "natfeats.h"
+#include "microbench.h"
+#include "movie.h"
+#include "timeline.h"
 #include "xbios.h"
+#include "rs232.h"
 
 bool bLoadAutoSave;        /* Load autosave memory snapshot at startup */
 bool bLoadMemorySave;      /* Load memory snapshot provided via option at startup */
 bool AviRecordOnStartup;   /* Start avi recording at startup */
+int ScreenShotEvery;       /* Save a screenshot every N VBLs, 0 = never */
 
 int ConOutDevice = CONOUT_DEVICE_NONE; /* device number for xconout device to track */
 
@@ -60,6 +68,8 @@ enum {
 	OPT_CONFIGFILE,
 	OPT_KEYMAPFILE,
 	OPT_FASTFORWARD,
+	OPT_HEADLESS,
+	OPT_HEADLESS_SAMPLE,
 	OPT_MONO,		/* common display options */
 	OPT_MONITOR,
 	OPT_FULLSCREEN,
@@ -75,18 +85,23 @@ enum {
 	OPT_BORDERS,		/* ST/STE display options */
 	OPT_RESOLUTION_ST,
 	OPT_SPEC512,
+	OPT_RENDER_THREAD,
 	OPT_ZOOM,
 	OPT_RESOLUTION,		/* TT/Falcon display options */
 	OPT_FORCE_MAX,
 	OPT_ASPECT,
+	OPT_CONVERT_THREADS,
 	OPT_VDI,		/* VDI options */
 	OPT_VDI_PLANES,
 	OPT_VDI_WIDTH,
 	OPT_VDI_HEIGHT,
+	OPT_VDI_ACCEL,
 	OPT_SCREEN_CROP,        /* screen capture options */
+	OPT_SCREENSHOT_EVERY,
 	OPT_AVIRECORD,
 	OPT_AVIRECORD_VCODEC,
 	OPT_AVIRECORD_FPS,
+	OPT_AVIRECORD_THREADS,
 	OPT_AVIRECORD_FILE,
 	OPT_JOYSTICK,		/* device options */
 	OPT_JOYSTICK0,
@@ -108,19 +123,23 @@ enum {
 	OPT_DISKB,
 	OPT_SLOWFLOPPY,
 	OPT_FASTFLOPPY,
+	OPT_TURBOFLOPPY,
 	OPT_WRITEPROT_FLOPPY,
 	OPT_WRITEPROT_HD,
 	OPT_HARDDRIVE,
 	OPT_GEMDOS_CASE,
 	OPT_GEMDOS_DRIVE,
+	OPT_FAST_PEXEC,
 	OPT_ACSIHDIMAGE,
 	OPT_IDEMASTERHDIMAGE,
 	OPT_IDESLAVEHDIMAGE,
+	OPT_HDOVERLAY,
 	OPT_MEMSIZE,		/* memory options */
 	OPT_MEMSTATE,
 	OPT_TOS,		/* ROM options */
 	OPT_PATCHTOS,
 	OPT_CARTRIDGE,
+	OPT_IKBDROM,
 	OPT_CPULEVEL,		/* CPU options */
 	OPT_CPUCLOCK,
 	OPT_COMPATIBLE,
@@ -137,11 +156,15 @@ enum {
 	OPT_TIMERD,
 	OPT_FASTBOOT,
 	OPT_RTC,
+	OPT_DETERMINISTIC,
 	OPT_MICROPHONE,		/* sound options */
+	OPT_MICLATENCY,
 	OPT_SOUND,
 	OPT_SOUNDBUFFERSIZE,
 	OPT_SOUNDSYNC,
 	OPT_YM_MIXING,
+	OPT_YM_BLEP,
+	OPT_SOUND_THREAD,
 #ifdef WIN32
 	OPT_WINCON,		/* debug options */
 #endif
@@ -151,6 +174,8 @@ enum {
 	OPT_CONOUT,
 	OPT_DISASM,
 	OPT_NATFEATS,
+	OPT_NATFEATS_BULK,
+	OPT_BATCH,
 	OPT_TRACE,
 	OPT_TRACEFILE,
 	OPT_PARSE,
@@ -161,6 +186,11 @@ enum {
 	OPT_LOGLEVEL,
 	OPT_ALERTLEVEL,
 	OPT_RUNVBLS,
+	OPT_BENCHMARK,
+	OPT_TIMELINE,
+	OPT_RECORDMOVIE,
+	OPT_PLAYMOVIE,
+	OPT_MICROBENCH,
 	OPT_ERROR,
 	OPT_CONTINUE
 };
@@ -189,6 +219,10 @@ static const opt_t HatariOptions[] = {
 	  "<file>", "Read (additional) keyboard mappings from <file>" },
 	{ OPT_FASTFORWARD, NULL, "--fast-forward",
 	  "<bool>", "Help skipping stuff on fast machine" },
+	{ OPT_HEADLESS, NULL, "--headless",
+	  "<bool>", "Run at full speed without drawing frames or sound output" },
+	{ OPT_HEADLESS_SAMPLE, NULL, "--headless-sample",
+	  "<x>", "Draw every x frames in headless mode (0 = only requested)" },
 
 	{ OPT_HEADER, NULL, NULL, NULL, "Common display" },
 	{ OPT_MONO,      "-m", "--mono",
@@ -223,6 +257,8 @@ static const opt_t HatariOptions[] = {
 	  "<bool>", "Keep desktop resolution on fullscreen" },
 	{ OPT_SPEC512, NULL, "--spec512",
 	  "<x>", "Spec512 palette threshold (0 <= x <= 512, 0=disable)" },
+	{ OPT_RENDER_THREAD, NULL, "--render-thread",
+	  "<bool>", "Convert screen on its own thread (on|off, off=default)" },
 	{ OPT_ZOOM, "-z", "--zoom",
 	  "<x>", "Double small resolutions (1=no, 2=yes)" },
 
@@ -233,6 +269,8 @@ static const opt_t HatariOptions[] = {
 	  "<bool>", "Resolution fixed to given max values" },
 	{ OPT_ASPECT, NULL, "--aspect",
 	  "<bool>", "Monitor aspect ratio correction" },
+	{ OPT_CONVERT_THREADS, NULL, "--convert-threads",
+	  "<x>", "Threads converting screen rows (x = 1-8)" },
 
 	{ OPT_HEADER, NULL, NULL, NULL, "VDI" },
 	{ OPT_VDI,	NULL, "--vdi",
@@ -243,16 +281,22 @@ static const opt_t HatariOptions[] = {
 	  "<w>", "VDI mode width (320 < w <= 1280)" },
 	{ OPT_VDI_HEIGHT,     NULL, "--vdi-height",
 	  "<h>", "VDI mode height (200 < h <= 960)" },
+	{ OPT_VDI_ACCEL,     NULL, "--vdi-accel",
+	  "<bool>", "Do common VDI drawing calls natively" },
 
 	{ OPT_HEADER, NULL, NULL, NULL, "Screen capture" },
 	{ OPT_SCREEN_CROP, NULL, "--crop",
 	  "<bool>", "Remove statusbar from screen capture" },
+	{ OPT_SCREENSHOT_EVERY, NULL, "--screenshot-every",
+	  "<x>", "Save a screenshot every x frames (0 = off)" },
 	{ OPT_AVIRECORD, NULL, "--avirecord",
 	  NULL, "Start AVI recording" },
 	{ OPT_AVIRECORD_VCODEC, NULL, "--avi-vcodec",
 	  "<x>", "Select avi video codec (x = bmp/png)" },
 	{ OPT_AVIRECORD_FPS, NULL, "--avi-fps",
 	  "<x>", "Force avi frame rate (x = 50/60/71/...)" },
+	{ OPT_AVIRECORD_THREADS, NULL, "--avi-threads",
+	  "<x>", "Threads encoding avi frames (x = 1-8)" },
 	{ OPT_AVIRECORD_FILE, NULL, "--avi-file",
 	  "<file>", "Use <file> to record avi" },
 
@@ -304,6 +348,8 @@ static const opt_t HatariOptions[] = {
 	  "<bool>", "Slow down floppy disk access emulation (deprecated, use --fastfdc)" },
 	{ OPT_FASTFLOPPY,   NULL, "--fastfdc",
 	  "<bool>", "Speed up floppy disk access emulation (can break some programs)" },
+	{ OPT_TURBOFLOPPY,   NULL, "--turbofdc",
+	  "<bool>", "Load ST/MSA/DIM floppy images at host speed" },
 	{ OPT_WRITEPROT_FLOPPY, NULL, "--protect-floppy",
 	  "<x>", "Write protect floppy image contents (on/off/auto)" },
 	{ OPT_WRITEPROT_HD, NULL, "--protect-hd",
@@ -314,12 +360,16 @@ static const opt_t HatariOptions[] = {
 	  "<x>", "Forcibly up/lowercase new GEMDOS dir/filenames (off/upper/lower)" },
 	{ OPT_GEMDOS_DRIVE, NULL, "--gemdos-drive",
 	  "<drive>", "Assign GEMDOS HD <dir> to drive letter <drive> (C-Z, skip)" },
+	{ OPT_FAST_PEXEC, NULL, "--fast-pexec",
+	  "<bool>", "Load and relocate programs from GEMDOS HD at host speed" },
 	{ OPT_ACSIHDIMAGE,   NULL, "--acsi",
 	  "<file>", "Emulate an ACSI harddrive with an image <file>" },
 	{ OPT_IDEMASTERHDIMAGE,   NULL, "--ide-master",
 	  "<file>", "Emulate an IDE master harddrive with an image <file>" },
 	{ OPT_IDESLAVEHDIMAGE,   NULL, "--ide-slave",
 	  "<file>", "Emulate an IDE slave harddrive with an image <file>" },
+	{ OPT_HDOVERLAY,   NULL, "--hd-overlay",
+	  "<dir>", "Keep HD image changes in copy-on-write overlays in <dir>" },
 	
 	{ OPT_HEADER, NULL, NULL, NULL, "Memory" },
 	{ OPT_MEMSIZE,   "-s", "--memsize",
@@ -334,6 +384,8 @@ static const opt_t HatariOptions[] = {
 	  "<bool>", "Apply TOS patches (experts only, leave it enabled!)" },
 	{ OPT_CARTRIDGE, NULL, "--cartridge",
 	  "<file>", "Use ROM cartridge image <file>" },
+	{ OPT_IKBDROM, NULL, "--ikbd-rom",
+	  "<file>", "Run IKBD ROM image <file> on an emulated HD6301" },
 
 	{ OPT_HEADER, NULL, NULL, NULL, "CPU" },
 	{ OPT_CPULEVEL,  NULL, "--cpulevel",
@@ -370,10 +422,14 @@ static const opt_t HatariOptions[] = {
 	  "<bool>", "Patch TOS and memvalid system variables for faster boot" },
 	{ OPT_RTC,    NULL, "--rtc",
 	  "<bool>", "Enable real-time clock" },
+	{ OPT_DETERMINISTIC, NULL, "--deterministic",
+	  "<bool>", "Emulate the same way on all hosts (e.g. for netplay)" },
 
 	{ OPT_HEADER, NULL, NULL, NULL, "Sound" },
 	{ OPT_MICROPHONE,   NULL, "--mic",
 	  "<bool>", "Enable/disable (Falcon only) microphone" },
+	{ OPT_MICLATENCY,   NULL, "--mic-latency",
+	  "<x>", "Microphone latency in ms (x=0/5-200, 0=default)" },
 	{ OPT_SOUND,   NULL, "--sound",
 	  "<x>", "Sound frequency (x=off/6000-50066, off=fastest)" },
 	{ OPT_SOUNDBUFFERSIZE,   NULL, "--sound-buffer-size",
@@ -381,7 +437,11 @@ static const opt_t HatariOptions[] = {
 	{ OPT_SOUNDSYNC,   NULL, "--sound-sync",
 	  "<bool>", "Sound synchronized emulation (on|off, off=default)" },
 	{ OPT_YM_MIXING,   NULL, "--ym-mixing",
-	  "<x>", "YM sound mixing method (x=linear/table/model)" },
+	  "<x>", "YM sound mixing method (x=linear/table/model/compact)" },
+	{ OPT_YM_BLEP,     NULL, "--ym-blep",
+	  "<bool>", "Band limited YM sound synthesis (on|off, off=default)" },
+	{ OPT_SOUND_THREAD, NULL, "--sound-thread",
+	  "<bool>", "Generate sound on its own thread (on|off, off=default)" },
 
 	{ OPT_HEADER, NULL, NULL, NULL, "Debug" },
 #ifdef WIN32
@@ -400,6 +460,10 @@ static const opt_t HatariOptions[] = {
 	  "<x>", "Set disassembly options (help/uae/ext/<bitmask>)" },
 	{ OPT_NATFEATS, NULL, "--natfeats",
 	  "<bool>", "Whether Native Features support is enabled" },
+	{ OPT_NATFEATS_BULK, NULL, "--natfeats-bulk",
+	  "<bool>", "Whether NF memory copy/checksum/zlib calls are enabled" },
+	{ OPT_BATCH,    NULL, "--batch",
+	  "<file>", "Run NF_BATCH jobs listed in <file> from a booted state" },
 	{ OPT_TRACE,   NULL, "--trace",
 	  "<flags>", "Activate emulation tracing, see '--trace help'" },
 	{ OPT_TRACEFILE, NULL, "--trace-file",
@@ -422,6 +486,18 @@ static const opt_t HatariOptions[] = {
 	  "<x>", "Show dialog for log messages above given level" },
 	{ OPT_RUNVBLS, NULL, "--run-vbls",
 	  "<x>", "Exit after x VBLs" },
+	{ OPT_BENCHMARK, NULL, "--benchmark",
+	  "<file>", "Write speed and frame statistics as JSON to <file> on exit" },
+	{ OPT_TIMELINE, NULL, "--timeline",
+	  "<file>", "Write CycInt handler timeline as Chrome trace to <file> on exit" },
+#ifdef __LIBRETRO__
+	{ OPT_RECORDMOVIE, NULL, "--record-movie",
+	  "<file>", "Record input and state hashes to <file> in deterministic mode" },
+	{ OPT_PLAYMOVIE, NULL, "--play-movie",
+	  "<file>", "Play input recorded to <file> and check the state hashes" },
+#endif
+	{ OPT_MICROBENCH, NULL, "--microbench",
+	  "<list>", "Only run given kernel micro-benchmarks (or 'all') and exit" },
 
 	{ OPT_ERROR, NULL, NULL, NULL, NULL }
 };
@@ -558,6 +634,7 @@ static void Opt_ShowHelp(void)
 	printf("<file>\tDevices accept also special 'stdout' and 'stderr' file names\n");
 	printf("\t(if you use stdout for midi or printer, set log to stderr).\n");
 	printf("\tSetting the file to 'none', disables given device or disk\n");
+	printf("\tRS-232 devices accept also 'tcp:<host>:<port>' and 'pty'\n");
 }
 
 
@@ -924,6 +1001,20 @@ bool Opt_ParseParameters(int argc, const char * const argv[])
 			ok = Opt_Bool(argv[++i], OPT_FASTFORWARD, &ConfigureParams.System.bFastForward);
 			break;
 
+		case OPT_HEADLESS:
+			ok = Opt_Bool(argv[++i], OPT_HEADLESS, &bVideoHeadless);
+			break;
+
+		case OPT_HEADLESS_SAMPLE:
+			val = atoi(argv[++i]);
+			if (val < 0)
+			{
+				return Opt_ShowError(OPT_HEADLESS_SAMPLE, argv[i],
+							"Invalid headless frame sampling interval");
+			}
+			nVideoHeadlessSample = val;
+			break;
+
 		case OPT_CONFIGFILE:
 			i += 1;
 			/* true -> file needs to exist */
@@ -1047,6 +1138,10 @@ bool Opt_ParseParameters(int argc, const char * const argv[])
 			ConfigureParams.Screen.nSpec512Threshold = threshold;
 			break;
 
+		case OPT_RENDER_THREAD:
+			ok = Opt_Bool(argv[++i], OPT_RENDER_THREAD, &ConfigureParams.Screen.bRenderThread);
+			break;
+
 		case OPT_ZOOM:
 			zoom = atoi(argv[++i]);
 			if (zoom < 1)
@@ -1084,11 +1179,31 @@ bool Opt_ParseParameters(int argc, const char * const argv[])
 			ok = Opt_Bool(argv[++i], OPT_ASPECT, &ConfigureParams.Screen.bAspectCorrect);
 			break;
 
+		case OPT_CONVERT_THREADS:
+			val = atoi(argv[++i]);
+			if (val < 1 || val > ROWPOOL_MAX_THREADS)
+			{
+				return Opt_ShowError(OPT_CONVERT_THREADS, argv[i],
+							"Invalid number of screen conversion threads");
+			}
+			ConfigureParams.Screen.nConvertThreads = val;
+			break;
+
 			/* screen capture options */
 		case OPT_SCREEN_CROP:
 			ok = Opt_Bool(argv[++i], OPT_SCREEN_CROP, &ConfigureParams.Screen.bCrop);
 			break;
 
+		case OPT_SCREENSHOT_EVERY:
+			val = atoi(argv[++i]);
+			if (val < 0)
+			{
+				return Opt_ShowError(OPT_SCREENSHOT_EVERY, argv[i],
+							"Invalid screenshot interval");
+			}
+			ScreenShotEvery = val;
+			break;
+
 		case OPT_AVIRECORD:
 			AviRecordOnStartup = true;
 			break;
@@ -1120,6 +1235,16 @@ bool Opt_ParseParameters(int argc, const char * const argv[])
 			ConfigureParams.Video.AviRecordFps = val;
 			break;
 
+		case OPT_AVIRECORD_THREADS:
+			val = atoi(argv[++i]);
+			if (val < 1 || val > FILEWRITER_MAX_THREADS)
+			{
+				return Opt_ShowError(OPT_AVIRECORD_THREADS, argv[i],
+							"Invalid number of avi encoding threads");
+			}
+			ConfigureParams.Video.AviRecordThreads = val;
+			break;
+
 		case OPT_AVIRECORD_FILE:
 			i += 1;
 			/* false -> file is created if it doesn't exist */
@@ -1168,6 +1293,10 @@ bool Opt_ParseParameters(int argc, const char * const argv[])
 			bLoadAutoSave = false;
 			break;
 
+		case OPT_VDI_ACCEL:
+			ok = Opt_Bool(argv[++i], OPT_VDI_ACCEL, &ConfigureParams.Screen.bVdiAccel);
+			break;
+
 			/* devices options */
 		case OPT_JOYSTICK:
 			i++;
@@ -1229,7 +1358,8 @@ bool Opt_ParseParameters(int argc, const char * const argv[])
       
 		case OPT_RS232_IN:
 			i += 1;
-			ok = Opt_StrCpy(OPT_RS232_IN, true, ConfigureParams.RS232.szInFileName,
+			ok = Opt_StrCpy(OPT_RS232_IN, !RS232_IsChannelName(argv[i]),
+					ConfigureParams.RS232.szInFileName,
 					argv[i], sizeof(ConfigureParams.RS232.szInFileName),
 					&ConfigureParams.RS232.bEnableRS232);
 			break;
@@ -1296,6 +1426,10 @@ bool Opt_ParseParameters(int argc, const char * const argv[])
 			ok = Opt_Bool(argv[++i], OPT_FASTFLOPPY, &ConfigureParams.DiskImage.FastFloppy);
 			break;
 
+		case OPT_TURBOFLOPPY:
+			ok = Opt_Bool(argv[++i], OPT_TURBOFLOPPY, &ConfigureParams.DiskImage.TurboFloppy);
+			break;
+
 		case OPT_WRITEPROT_FLOPPY:
 			i += 1;
 			if (strcasecmp(argv[i], "off") == 0)
@@ -1351,6 +1485,10 @@ bool Opt_ParseParameters(int argc, const char * const argv[])
 			}
 			return Opt_ShowError(OPT_GEMDOS_DRIVE, argv[i], "Invalid <drive>");
 
+		case OPT_FAST_PEXEC:
+			ok = Opt_Bool(argv[++i], OPT_FAST_PEXEC, &ConfigureParams.HardDisk.bFastPexec);
+			break;
+
 		case OPT_HARDDRIVE:
 			i += 1;
 			ok = Opt_StrCpy(OPT_HARDDRIVE, false, ConfigureParams.HardDisk.szHardDiskDirectories[0],
@@ -1402,6 +1540,21 @@ bool Opt_ParseParameters(int argc, const char * const argv[])
 			}
 			break;
 
+		case OPT_HDOVERLAY:
+			i += 1;
+			if (strcasecmp(argv[i], "none") == 0)
+			{
+				ConfigureParams.HardDisk.szOverlayDir[0] = '\0';
+				break;
+			}
+			if (!File_DirExists(argv[i]))
+			{
+				return Opt_ShowError(OPT_HDOVERLAY, argv[i], "Given overlay directory doesn't exist!");
+			}
+			ok = Opt_StrCpy(OPT_HDOVERLAY, false, ConfigureParams.HardDisk.szOverlayDir,
+					argv[i], sizeof(ConfigureParams.HardDisk.szOverlayDir), NULL);
+			break;
+
 			/* Memory options */
 		case OPT_MEMSIZE:
 			memsize = atoi(argv[++i]);
@@ -1439,6 +1592,13 @@ bool Opt_ParseParameters(int argc, const char * const argv[])
 			}
 			break;
 
+		case OPT_IKBDROM:
+			i += 1;
+			ok = Opt_StrCpy(OPT_IKBDROM, true, ConfigureParams.Rom.szIkbdRomFileName,
+					argv[i], sizeof(ConfigureParams.Rom.szIkbdRomFileName),
+					NULL);
+			break;
+
 		case OPT_MEMSTATE:
 			i += 1;
 			ok = Opt_StrCpy(OPT_MEMSTATE, true, ConfigureParams.Memory.szMemoryCaptureFileName,
@@ -1597,6 +1757,10 @@ bool Opt_ParseParameters(int argc, const char * const argv[])
 			ok = Opt_Bool(argv[++i], OPT_RTC, &ConfigureParams.System.bRealTimeClock);
 			break;
 
+		case OPT_DETERMINISTIC:
+			ok = Opt_Bool(argv[++i], OPT_DETERMINISTIC, &ConfigureParams.System.bDeterministic);
+			break;
+
 		case OPT_DSP:
 			i += 1;
 			if (strcasecmp(argv[i], "none") == 0)
@@ -1637,6 +1801,10 @@ bool Opt_ParseParameters(int argc, const char * const argv[])
 			{
 				ConfigureParams.Sound.YmVolumeMixing = YM_MODEL_MIXING;
 			}
+			else if (strcasecmp(argv[i], "compact") == 0)
+			{
+				ConfigureParams.Sound.YmVolumeMixing = YM_COMPACT_MIXING;
+			}
 			else
 			{
 				return Opt_ShowError(OPT_YM_MIXING, argv[i], "Unknown YM mixing method");
@@ -1678,11 +1846,29 @@ bool Opt_ParseParameters(int argc, const char * const argv[])
 		case OPT_SOUNDSYNC:
 			ok = Opt_Bool(argv[++i], OPT_SOUNDSYNC, &ConfigureParams.Sound.bEnableSoundSync);
 			break;
+
+		case OPT_YM_BLEP:
+			ok = Opt_Bool(argv[++i], OPT_YM_BLEP, &ConfigureParams.Sound.bYmBlepSynthesis);
+			break;
+
+		case OPT_SOUND_THREAD:
+			ok = Opt_Bool(argv[++i], OPT_SOUND_THREAD, &ConfigureParams.Sound.bSoundThread);
+			break;
 			
 		case OPT_MICROPHONE:
 			ok = Opt_Bool(argv[++i], OPT_MICROPHONE, &ConfigureParams.Sound.bEnableMicrophone);
 			break;
 
+		case OPT_MICLATENCY:
+			i += 1;
+			temp = atoi(argv[i]);
+			if (temp != 0 && (temp < 5 || temp > 200))
+			{
+				return Opt_ShowError(OPT_MICLATENCY, argv[i], "Unsupported microphone latency");
+			}
+			ConfigureParams.Sound.nMicrophoneLatency = temp;
+			break;
+
 		case OPT_KEYMAPFILE:
 			i += 1;
 			ok = Opt_StrCpy(OPT_KEYMAPFILE, true, ConfigureParams.Keyboard.szMappingFileName,
@@ -1754,6 +1940,16 @@ bool Opt_ParseParameters(int argc, const char * const argv[])
 			fprintf(stderr, "Native Features %s.\n", ConfigureParams.Log.bNatFeats ? "enabled" : "disabled");
 			break;
 
+		case OPT_NATFEATS_BULK:
+			ok = Opt_Bool(argv[++i], OPT_NATFEATS_BULK, &ConfigureParams.Log.bNatFeatsBulk);
+			fprintf(stderr, "Native Features bulk operations %s.\n", ConfigureParams.Log.bNatFeatsBulk ? "enabled" : "disabled");
+			break;
+
+		case OPT_BATCH:
+			i += 1;
+			ok = NatFeat_SetBatchFile(argv[i]);
+			break;
+
 		case OPT_PARACHUTE:
 			bNoSDLParachute = true;
 			break;
@@ -1839,6 +2035,30 @@ bool Opt_ParseParameters(int argc, const char * const argv[])
 		case OPT_RUNVBLS:
 			Main_SetRunVBLs(atol(argv[++i]));
 			break;
+
+		case OPT_BENCHMARK:
+			Main_SetBenchmarkFile(argv[++i]);
+			break;
+
+		case OPT_TIMELINE:
+			Timeline_SetFile(argv[++i]);
+			break;
+
+		case OPT_RECORDMOVIE:
+			Movie_Record(argv[++i]);
+			break;
+
+		case OPT_PLAYMOVIE:
+			Movie_Play(argv[++i]);
+			break;
+
+		case OPT_MICROBENCH:
+			i += 1;
+			if (!MicroBench_SetKernels(argv[i]))
+			{
+				return Opt_ShowError(OPT_MICROBENCH, argv[i], "Unknown kernel name");
+			}
+			break;
 		       
 		case OPT_ERROR:
 			/* unknown option or missing option parameter */
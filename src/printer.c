@@ -28,8 +28,13 @@ const char Printer_fileid[] = "Hatari printer.c : " __DATE__ " " __TIME__;
 
 /* After ~4 seconds (4*50 VBLs), flush & close printer */
 #define PRINTER_IDLE_CLOSE   (4*50)
+/* Output is written in large blocks: the buffer is flushed when it's
+ * full, or ~0.2 seconds (10 VBLs) after data started to go into it */
+#define PRINTER_BUFFER_SIZE  (64*1024)
+#define PRINTER_FLUSH_VBLS   10
 
 static int nIdleCount;
+static int nUnflushedVbls;
 static int bUnflushed;
 
 static FILE *pPrinterHandle;
@@ -75,6 +80,7 @@ void Printer_UnInit(void)
 	/* Close any open files */
 	pPrinterHandle = HFile_Close(pPrinterHandle);
 	bUnflushed = false;
+	nUnflushedVbls = 0;
 	nIdleCount = 0;
 }
 
@@ -102,6 +108,7 @@ bool Printer_TransferByteTo(Uint8 Byte)
 			ConfigureParams.Printer.bEnablePrinting = false;
 			return false;
 		}
+		setvbuf(pPrinterHandle, NULL, _IOFBF, PRINTER_BUFFER_SIZE);
 	}
 	if (fputc(Byte, pPrinterHandle) != Byte)
 	{
@@ -115,17 +122,21 @@ bool Printer_TransferByteTo(Uint8 Byte)
 
 /*-----------------------------------------------------------------------*/
 /**
- * Empty printer buffer, and if remains idle for set time close connection
- * (ie close file, stop printer)
+ * Empty printer buffer once it has had data for a while, and if remains
+ * idle for set time close connection (ie close file, stop printer)
  */
 void Printer_CheckIdleStatus(void)
 {
 	/* Is anything waiting for printer? */
 	if (bUnflushed)
 	{
-		fflush(pPrinterHandle);
-		bUnflushed = false;
 		nIdleCount = 0;
+		if (++nUnflushedVbls >= PRINTER_FLUSH_VBLS)
+		{
+			fflush(pPrinterHandle);
+			bUnflushed = false;
+			nUnflushedVbls = 0;
+		}
 	}
 	else
 	{
@@ -105,6 +105,8 @@
 /*	  This means only .B size (move.b for example) or movep opcode will work.	*/
 /*	  If the access is valid, add 1 cycle wait state, else ignore the write and	*/
 /*	  don't add any cycle.								*/
+/* The unconditional wait states are set in the IO memory tables (ioMemTab*.c), only	*/
+/* the ones depending on the access size are added in the handlers below.		*/
 
 
 
@@ -158,7 +160,8 @@ void PSG_Reset(void)
 	memset(PSGRegisters, 0, sizeof(PSGRegisters));
 	PSGRegisters[PSG_REG_IO_PORTA] = 0xff;			/* no drive selected + side 0 after a reset */
 
-	/* Update sound's emulation registers */
+	/* Update sound's emulation registers, once audio worker is done with them */
+	Sound_ThreadSync();
         for ( i=0 ; i < NUM_PSG_SOUND_REGISTERS; i++ )
 		Sound_WriteReg ( i , 0 );
 
@@ -271,9 +274,6 @@ void PSG_Set_DataRegister(Uint8 val)
 	if ( PSGRegisterSelect >= MAX_PSG_REGISTERS )
 		return;					/* not valid, ignore write and do nothing */
 
-	/* Create samples up until this point with current values */
-	Sound_Update(false);
-
 	/* When a read is made from $ff8800 without changing PSGRegisterSelect, we should return */
 	/* the non masked value. */
 	PSGRegisterReadData = val;			/* store non masked value for PSG_Get_DataRegister */
@@ -296,8 +296,9 @@ void PSG_Set_DataRegister(Uint8 val)
 
 	if ( PSGRegisterSelect < NUM_PSG_SOUND_REGISTERS )
 	{
-		/* Copy sound related registers 0..13 to the sound module's internal buffer */
-		Sound_WriteReg ( PSGRegisterSelect , PSGRegisters[PSGRegisterSelect] );
+		/* Copy sound related registers 0..13 to the sound module's internal buffer, */
+		/* samples up until this point are created with the current values */
+		Sound_JournalWriteReg ( PSGRegisterSelect , PSGRegisters[PSGRegisterSelect] );
 	}
 
 	else if ( PSGRegisterSelect == PSG_REG_IO_PORTA )
@@ -394,8 +395,6 @@ void PSG_Set_DataRegister(Uint8 val)
  */
 void PSG_ff8800_ReadByte(void)
 {
-	M68000_WaitState(1);				/* [NP] FIXME not 100% accurate, but gives good results */
-
 	IoMem[IoAccessCurrentAddress] = PSG_Get_DataRegister();
 
 	if (LOG_TRACE_LEVEL(TRACE_PSG_READ))
@@ -415,8 +414,6 @@ void PSG_ff8800_ReadByte(void)
  */
 void PSG_ff880x_ReadByte(void)
 {
-	M68000_WaitState(1);				/* [NP] FIXME not 100% accurate, but gives good results */
-
 	IoMem[IoAccessCurrentAddress] = 0xff;
 
 	if (LOG_TRACE_LEVEL(TRACE_PSG_READ))
@@ -437,9 +434,6 @@ void PSG_ff880x_ReadByte(void)
  */
 void PSG_ff8800_WriteByte(void)
 {
-//	M68000_WaitState(4);
-	M68000_WaitState(1);				/* [NP] FIXME not 100% accurate, but gives good results */
-
 	if (LOG_TRACE_LEVEL(TRACE_PSG_WRITE))
 	{
 		int FrameCycles, HblCounterVideo, LineCycles;
@@ -498,9 +492,6 @@ void PSG_ff8801_WriteByte(void)
  */
 void PSG_ff8802_WriteByte(void)
 {
-//	M68000_WaitState(4);
-	M68000_WaitState(1);				/* [NP] FIXME not 100% accurate, but gives good results */
-
 	if (LOG_TRACE_LEVEL(TRACE_PSG_WRITE))
 	{
 		int FrameCycles, HblCounterVideo, LineCycles;
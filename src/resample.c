@@ -0,0 +1,173 @@
+/*
+  Hatari - resample.c
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+
+  Streaming polyphase sample rate converter, shared by the STE DMA sound
+  and the Falcon crossbar DAC to convert their sample streams to the host
+  audio frequency.
+
+  The caller keeps the 32.32 fixed point read position (its fractional
+  part only, between blocks) exactly like the old nearest sample code did,
+  so the number of samples pulled from the emulated hardware per output
+  sample doesn't change. For each block, the caller asks how many input
+  samples it needs, writes them after the RESAMPLE_TAPS previous ones and
+  converts the whole block at once.
+
+  Each output sample is a RESAMPLE_TAPS long windowed sinc FIR of the input
+  samples up to its read position, with the coefficients picked from
+  RESAMPLE_PHASES precomputed sub-sample positions. This delays the output
+  by RESAMPLE_TAPS/2 input samples, but never needs samples that the
+  emulation hasn't produced yet. When downsampling, the cutoff is lowered
+  to the output Nyquist frequency.
+*/
+const char Resample_fileid[] = "Hatari resample.c : " __DATE__ " " __TIME__;
+
+#include <math.h>
+
+#include "main.h"
+#include "resample.h"
+
+#define RESAMPLE_COEF_SHIFT	14		/* coefficients are Q14 */
+#define RESAMPLE_PI		3.14159265358979323846
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Clear the previous input samples and force the coefficients to be
+ * recomputed on next Resample_SetStep() call.
+ */
+void Resample_Reset(RESAMPLER *pRes)
+{
+	memset(pRes->Buffer, 0, sizeof(pRes->Buffer));
+	pRes->nStep = 0;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Set ratio between input and output frequencies as 32.32 fixed point
+ * and compute the FIR of each phase if it changed.
+ */
+void Resample_SetStep(RESAMPLER *pRes, Sint64 nStep)
+{
+	double fc, u, x, w, Coefs[RESAMPLE_TAPS], fSum;
+	int p, j, nSum, nMax;
+
+	if (nStep == pRes->nStep)
+		return;
+	pRes->nStep = nStep;
+
+	/* cutoff relative to the input Nyquist frequency */
+	fc = 0.9;
+	if (nStep > (1LL << 32))
+		fc *= (double)(1LL << 32) / nStep;
+
+	for (p = 0; p < RESAMPLE_PHASES; p++)
+	{
+		fSum = 0;
+		for (j = 0; j < RESAMPLE_TAPS; j++)
+		{
+			/* distance of tap j from the read position, in input samples */
+			u = (RESAMPLE_TAPS - 1 - j) + (double)p / RESAMPLE_PHASES - RESAMPLE_TAPS / 2;
+			x = RESAMPLE_PI * fc * u;
+			w = 0.42 + 0.5 * cos(RESAMPLE_PI * u / (RESAMPLE_TAPS / 2))
+			    + 0.08 * cos(2 * RESAMPLE_PI * u / (RESAMPLE_TAPS / 2));
+			Coefs[j] = (x == 0 ? 1.0 : sin(x) / x) * w;
+			fSum += Coefs[j];
+		}
+
+		/* normalize each phase to unity DC gain, rounding error goes to the biggest tap */
+		nSum = nMax = 0;
+		for (j = 0; j < RESAMPLE_TAPS; j++)
+		{
+			pRes->Coefs[p][j] = lrint(Coefs[j] / fSum * (1 << RESAMPLE_COEF_SHIFT));
+			nSum += pRes->Coefs[p][j];
+			if (pRes->Coefs[p][j] > pRes->Coefs[p][nMax])
+				nMax = j;
+		}
+		pRes->Coefs[p][nMax] += (1 << RESAMPLE_COEF_SHIFT) - nSum;
+	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Add one input sample outside of a block (when the caller only needs to
+ * update the previous input samples).
+ */
+void Resample_Push(RESAMPLER *pRes, Sint16 nLeft, Sint16 nRight)
+{
+	memmove(pRes->Buffer[0], pRes->Buffer[1], (RESAMPLE_TAPS - 1) * sizeof(pRes->Buffer[0]));
+	pRes->Buffer[RESAMPLE_TAPS - 1][0] = nLeft;
+	pRes->Buffer[RESAMPLE_TAPS - 1][1] = nRight;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return how many of nOut output samples can be converted in one block
+ * without needing more than RESAMPLE_MAX_INPUT input samples.
+ */
+int Resample_BlockSize(const RESAMPLER *pRes, int nOut)
+{
+	int nMax = (RESAMPLE_MAX_INPUT - 1) / ((int)(pRes->nStep >> 32) + 1);
+
+	if (nMax < 1)
+		nMax = 1;
+	return nOut < nMax ? nOut : nMax;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return number of input samples to provide for nOut output samples,
+ * starting from given read position.
+ */
+int Resample_InputCount(const RESAMPLER *pRes, Sint64 nPhase, int nOut)
+{
+	return (nPhase + nOut * pRes->nStep) >> 32;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Convert a block: nIn new input samples have been written to
+ * Resample_Input(), as returned by Resample_InputCount() for nOut
+ * output samples. Stereo output samples are written to pOut and
+ * the read position is advanced to the remaining fraction.
+ */
+void Resample_Process(RESAMPLER *pRes, Sint64 *pPhase, int nIn, Sint16 (*pOut)[2], int nOut)
+{
+	Sint64 nPhase = *pPhase;
+	const Sint16 *pCoef;
+	const Sint16 (*pWin)[2];
+	int i, j, nLeft, nRight;
+
+	for (i = 0; i < nOut; i++)
+	{
+		/* window of the RESAMPLE_TAPS latest input samples at read position */
+		pWin = &pRes->Buffer[nPhase >> 32];
+		pCoef = pRes->Coefs[(nPhase & 0xffffffff) >> (32 - RESAMPLE_PHASE_BITS)];
+
+		nLeft = nRight = 1 << (RESAMPLE_COEF_SHIFT - 1);
+		for (j = 0; j < RESAMPLE_TAPS; j++)
+		{
+			nLeft += pWin[j][0] * pCoef[j];
+			nRight += pWin[j][1] * pCoef[j];
+		}
+		nLeft >>= RESAMPLE_COEF_SHIFT;
+		nRight >>= RESAMPLE_COEF_SHIFT;
+
+		/* sinc ringing can overshoot full scale input */
+		pOut[i][0] = nLeft > 32767 ? 32767 : (nLeft < -32768 ? -32768 : nLeft);
+		pOut[i][1] = nRight > 32767 ? 32767 : (nRight < -32768 ? -32768 : nRight);
+
+		nPhase += pRes->nStep;
+	}
+
+	/* keep the latest input samples for next block */
+	memmove(pRes->Buffer[0], pRes->Buffer[nIn], RESAMPLE_TAPS * sizeof(pRes->Buffer[0]));
+	*pPhase = nPhase & 0xffffffff;
+}
@@ -29,6 +29,7 @@ const char Reset_fileid[] = "Hatari reset.c : " __DATE__ " " __TIME__;
 #include "sound.h"
 #include "stMemory.h"
 #include "tos.h"
+#include "utils.h"
 #include "vdi.h"
 #include "nvram.h"
 #include "video.h"
@@ -48,6 +49,10 @@ static int Reset_ST(bool bCold)
 	{
 		int ret;
 
+		/* Same random numbers on all hosts after reset */
+		if (ConfigureParams.System.bDeterministic)
+			Hatari_srand(1);
+
 		Floppy_GetBootDrive();      /* Find which device to boot from (A: or C:) */
 
 		ret = TOS_LoadImage();      /* Load TOS, writes into cartridge memory */
@@ -117,6 +122,34 @@ int Reset_Cold(void)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Reset the emulation state which memory snapshots don't contain, before
+ * restoring a snapshot taken with the current machine configuration.
+ * Memory and IO maps, TOS and the chips are left as they are, restoring
+ * the snapshot overwrites their state.
+ */
+void Reset_SnapShot(void)
+{
+	VDI_Reset();                  /* Reset internal VDI variables */
+	NvRam_Reset();                /* reset NvRAM (video) settings */
+	GemDOS_Reset();               /* Reset GEMDOS emulation */
+
+	if (ConfigureParams.System.nMachineType == MACHINE_FALCON
+	    || ConfigureParams.System.nMachineType == MACHINE_TT)
+	{
+		Ncr5380_Reset();
+	}
+
+	M68000_Reset(true);           /* Clear CPU special flags and caches */
+
+	DebugCpu_SetDebugging();      /* Re-set debugging flag if needed */
+	DebugDsp_SetDebugging();
+
+	Midi_Reset();
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Warm reset ST (reset registers, leave in same state and reboot)
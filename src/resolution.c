@@ -25,6 +25,10 @@ const char Resolution_fileid[] = "Hatari resolution.c : " __DATE__ " " __TIME__;
 
 static int DesktopWidth, DesktopHeight;
 
+#ifdef __LIBRETRO__
+extern bool hatari_video_native;
+#endif
+
 /**
  * Initilizes resolution settings (gets current desktop
  * resolution, sets max Falcon/TT Videl zooming resolution).
@@ -73,6 +77,11 @@ DesktopWidth = retrow;
 DesktopHeight = retroh;
 ConfigureParams.Screen.nMaxWidth = DesktopWidth;
 ConfigureParams.Screen.nMaxHeight = DesktopHeight;
+/* native resolution output: keep low resolution undoubled */
+if (hatari_video_native) {
+	ConfigureParams.Screen.nMaxWidth = NUM_VISIBLE_LINE_PIXELS;
+	ConfigureParams.Screen.nMaxHeight = NUM_VISIBLE_LINES;
+}
 #endif
 	DEBUGPRINT(("Desktop resolution: %dx%d\n",DesktopWidth, DesktopHeight));
 	fprintf(stderr, "Configured max Hatari resolution = %dx%d, optimal for ST = %dx%d\n",
@@ -221,8 +230,11 @@ bool Resolution_Search(int *width, int *height, int *bpp, bool keep)
 	}
 #endif
 #else
-*width = retrow;
-*height = retroh;
+/* native resolution output: host screen follows the requested size */
+if (!(hatari_video_native && *width && *height)) {
+	*width = retrow;
+	*height = retroh;
+}
 *bpp = 2;
 #endif
 	DEBUGPRINT(("resolution: video mode selected: %dx%dx%d\n",
@@ -0,0 +1,445 @@
+/*
+  Hatari - rewind.c
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+
+  Rewind ring of emulation states.
+
+  States are captured with the in-memory snapshot chain (see
+  memorySnapShot.c). Only the latest state is kept in full; every
+  ring entry holds the difference between one state and the state
+  captured just before it. The snapshot is compared in 4 KiB blocks
+  (which for the ST-RAM part of the snapshot are ST-RAM pages),
+  unchanged blocks are not stored at all and changed blocks are stored
+  as run-length encoded XOR of the old and new contents. This way an
+  entry typically needs only some kilobytes instead of the full RAM
+  size, and stepping back costs just XORing the changed blocks back
+  into the latest state before restoring it.
+
+  Besides the ring used for the libretro rewind, the debugger keeps its
+  own ring of checkpoints for reverse execution, so the functions are
+  also available for separately created rings.
+
+  Delta format: a sequence of blocks, each starting with its Uint32
+  byte offset in the state, followed by (Uint16 zero count, Uint16
+  literal count, literal bytes) runs until the block is covered.
+  The sequence is terminated with REWIND_END_MARK offset.
+*/
+const char Rewind_fileid[] = "Hatari rewind.c : " __DATE__ " " __TIME__;
+
+#include "main.h"
+#include "log.h"
+#include "memorySnapShot.h"
+#include "rewind.h"
+
+
+#define REWIND_BLOCK_SIZE	4096
+#define REWIND_END_MARK		0xffffffff
+/* zero runs shorter than this are stored as literals, so that
+ * the run headers can never make a block bigger than these:
+ */
+#define REWIND_MIN_ZERO_RUN	4
+#define REWIND_MAX_BLOCK_SIZE	(4 + 4 + REWIND_BLOCK_SIZE + 4)
+
+typedef struct
+{
+	Uint8 *pDelta;		/* encoded XOR delta to the next newer state */
+	int nDeltaSize;		/* size of encoded delta */
+	int nStateSize;		/* size of the state it restores */
+} REWIND_ENTRY;
+
+struct REWIND_RING
+{
+	REWIND_ENTRY *pEntries;	/* ring of deltas */
+	int nMaxEntries;	/* size of the ring */
+	int nFirstEntry;	/* oldest entry in the ring */
+	int nUsedEntries;	/* number of valid entries */
+
+	Uint8 *pLatest;		/* latest captured state, in full */
+	int nLatestSize;	/* its size */
+	Uint8 *pCapture;	/* buffer for capturing a new state */
+	Uint8 *pEncode;		/* buffer for encoding a delta */
+	int nBufSize;		/* size of above buffers */
+};
+
+static REWIND_RING *pRewind;	/* ring for the libretro rewind */
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Free the delta of the given ring entry.
+ */
+static void Rewind_FreeEntry(REWIND_ENTRY *pEntry)
+{
+	free(pEntry->pDelta);
+	pEntry->pDelta = NULL;
+	pEntry->nDeltaSize = 0;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Forget all states of the given ring, keeping its buffers.
+ */
+void Rewind_RingClear(REWIND_RING *pRing)
+{
+	int i;
+
+	for (i = 0; i < pRing->nMaxEntries; i++)
+		Rewind_FreeEntry(&pRing->pEntries[i]);
+	pRing->nFirstEntry = pRing->nUsedEntries = 0;
+	pRing->nLatestSize = 0;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Free given ring with all its buffers and entries.
+ */
+void Rewind_RingFree(REWIND_RING *pRing)
+{
+	if (!pRing)
+		return;
+	Rewind_RingClear(pRing);
+	free(pRing->pEntries);
+	free(pRing->pLatest);
+	free(pRing->pCapture);
+	free(pRing->pEncode);
+	free(pRing);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Create a ring with given number of entries, i.e. which can step back
+ * that many times from the latest state. Return NULL on failure.
+ */
+REWIND_RING *Rewind_RingCreate(int nEntries)
+{
+	REWIND_RING *pRing;
+
+	if (nEntries <= 0)
+		return NULL;
+	pRing = calloc(1, sizeof(*pRing));
+	if (!pRing)
+		return NULL;
+	pRing->pEntries = calloc(nEntries, sizeof(*pRing->pEntries));
+	if (!pRing->pEntries)
+	{
+		free(pRing);
+		return NULL;
+	}
+	pRing->nMaxEntries = nEntries;
+	return pRing;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return number of states that can be currently stepped back to
+ * in the given ring.
+ */
+int Rewind_RingCount(REWIND_RING *pRing)
+{
+	return pRing->nUsedEntries;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Free all rewind buffers and entries.
+ */
+void Rewind_UnInit(void)
+{
+	Rewind_RingFree(pRewind);
+	pRewind = NULL;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Set up rewind ring with given number of entries (0 disables rewind).
+ * Return false if memory allocation failed.
+ */
+bool Rewind_Init(int nEntries)
+{
+	Rewind_UnInit();
+	if (nEntries <= 0)
+		return true;
+
+	pRewind = Rewind_RingCreate(nEntries);
+	return pRewind != NULL;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return true if rewinding is enabled.
+ */
+bool Rewind_IsEnabled(void)
+{
+	return pRewind != NULL;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return number of states that can be currently rewound.
+ */
+int Rewind_GetCount(void)
+{
+	return pRewind ? Rewind_RingCount(pRewind) : 0;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Make sure the state buffers are at least given size.
+ * The unused tail of the buffers is kept zeroed, so that states of
+ * different size can be XORed with each other.
+ */
+static bool Rewind_AllocBuffers(REWIND_RING *pRing, int nSize)
+{
+	Uint8 *pNew[3];
+	int i;
+
+	/* round up to full blocks */
+	nSize = (nSize + REWIND_BLOCK_SIZE - 1) & ~(REWIND_BLOCK_SIZE - 1);
+	if (nSize <= pRing->nBufSize)
+		return true;
+
+	pNew[0] = realloc(pRing->pLatest, nSize);
+	if (pNew[0])
+		pRing->pLatest = pNew[0];
+	pNew[1] = realloc(pRing->pCapture, nSize);
+	if (pNew[1])
+		pRing->pCapture = pNew[1];
+	pNew[2] = realloc(pRing->pEncode, nSize / REWIND_BLOCK_SIZE * REWIND_MAX_BLOCK_SIZE + 4);
+	if (pNew[2])
+		pRing->pEncode = pNew[2];
+	for (i = 0; i < 3; i++)
+	{
+		if (!pNew[i])
+			return false;
+	}
+	memset(pRing->pLatest + pRing->nBufSize, 0, nSize - pRing->nBufSize);
+	memset(pRing->pCapture + pRing->nBufSize, 0, nSize - pRing->nBufSize);
+	pRing->nBufSize = nSize;
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Encode XOR of given old and new block into pOut.
+ * Return number of bytes written.
+ */
+static int Rewind_EncodeBlock(Uint8 *pOut, const Uint8 *pOld, const Uint8 *pNew, Uint32 nOffset)
+{
+	Uint8 *pStart = pOut;
+	Uint16 nZeros, nLiterals;
+	int i = 0, j, run;
+
+	memcpy(pOut, &nOffset, 4);
+	pOut += 4;
+
+	while (i < REWIND_BLOCK_SIZE)
+	{
+		/* zero run */
+		for (j = i; j < REWIND_BLOCK_SIZE && pOld[j] == pNew[j]; j++)
+			;
+		nZeros = j - i;
+		i = j;
+
+		/* literals, up to next long enough zero run */
+		for (j = i; j < REWIND_BLOCK_SIZE; j++)
+		{
+			if (pOld[j] != pNew[j])
+				continue;
+			for (run = 0; j + run < REWIND_BLOCK_SIZE && pOld[j+run] == pNew[j+run]; run++)
+			{
+				if (run >= REWIND_MIN_ZERO_RUN)
+					break;
+			}
+			if (run >= REWIND_MIN_ZERO_RUN || j + run == REWIND_BLOCK_SIZE)
+				break;
+			j += run - 1;
+		}
+		nLiterals = j - i;
+
+		memcpy(pOut, &nZeros, 2);
+		memcpy(pOut + 2, &nLiterals, 2);
+		pOut += 4;
+		for (; i < j; i++)
+			*pOut++ = pOld[i] ^ pNew[i];
+	}
+	return pOut - pStart;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * XOR given encoded delta into pState.
+ */
+static void Rewind_ApplyDelta(Uint8 *pState, const Uint8 *pDelta)
+{
+	Uint32 nOffset;
+	Uint16 nZeros, nLiterals;
+	Uint8 *pDst;
+	int i, nLeft;
+
+	for (;;)
+	{
+		memcpy(&nOffset, pDelta, 4);
+		pDelta += 4;
+		if (nOffset == REWIND_END_MARK)
+			break;
+
+		pDst = pState + nOffset;
+		nLeft = REWIND_BLOCK_SIZE;
+		while (nLeft > 0)
+		{
+			memcpy(&nZeros, pDelta, 2);
+			memcpy(&nLiterals, pDelta + 2, 2);
+			pDelta += 4;
+			pDst += nZeros;
+			for (i = 0; i < nLiterals; i++)
+				*pDst++ ^= *pDelta++;
+			nLeft -= nZeros + nLiterals;
+		}
+	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Capture current emulation state into the given ring.
+ * Return false on failure.
+ */
+bool Rewind_RingPush(REWIND_RING *pRing)
+{
+	REWIND_ENTRY *pEntry;
+	Uint32 nOffset, nEnd = REWIND_END_MARK;
+	int nSize, nDeltaSize, nBlocks;
+	Uint8 *pTmp;
+
+	/* query state size only when it doesn't fit to buffers anymore,
+	 * a failed try is expected then and not worth a warning */
+	nSize = pRing->nBufSize ? MemorySnapShot_TryCaptureMem(pRing->pCapture, pRing->nBufSize) : -1;
+	if (nSize < 0)
+	{
+		nSize = MemorySnapShot_Size();
+		if (nSize < 0 || !Rewind_AllocBuffers(pRing, nSize))
+			return false;
+		if (MemorySnapShot_CaptureMem(pRing->pCapture, pRing->nBufSize) != nSize)
+			return false;
+	}
+	/* clear what's left there from an earlier, bigger state */
+	memset(pRing->pCapture + nSize, 0, pRing->nBufSize - nSize);
+
+	if (pRing->nLatestSize)
+	{
+		/* encode changes from new state back to previous one */
+		nBlocks = (nSize > pRing->nLatestSize ? nSize : pRing->nLatestSize);
+		nBlocks = (nBlocks + REWIND_BLOCK_SIZE - 1) / REWIND_BLOCK_SIZE;
+		nDeltaSize = 0;
+		for (nOffset = 0; nOffset < (Uint32)nBlocks * REWIND_BLOCK_SIZE; nOffset += REWIND_BLOCK_SIZE)
+		{
+			if (memcmp(pRing->pLatest + nOffset, pRing->pCapture + nOffset, REWIND_BLOCK_SIZE) == 0)
+				continue;
+			nDeltaSize += Rewind_EncodeBlock(pRing->pEncode + nDeltaSize,
+			                                 pRing->pLatest + nOffset, pRing->pCapture + nOffset, nOffset);
+		}
+		memcpy(pRing->pEncode + nDeltaSize, &nEnd, 4);
+		nDeltaSize += 4;
+
+		/* drop the oldest entry if ring is full */
+		if (pRing->nUsedEntries == pRing->nMaxEntries)
+		{
+			Rewind_FreeEntry(&pRing->pEntries[pRing->nFirstEntry]);
+			pRing->nFirstEntry = (pRing->nFirstEntry + 1) % pRing->nMaxEntries;
+			pRing->nUsedEntries--;
+		}
+		pEntry = &pRing->pEntries[(pRing->nFirstEntry + pRing->nUsedEntries) % pRing->nMaxEntries];
+		pEntry->pDelta = malloc(nDeltaSize);
+		if (!pEntry->pDelta)
+		{
+			Log_Printf(LOG_WARN, "Rewind: out of memory, ring emptied.\n");
+			Rewind_RingClear(pRing);
+			return false;
+		}
+		memcpy(pEntry->pDelta, pRing->pEncode, nDeltaSize);
+		pEntry->nDeltaSize = nDeltaSize;
+		pEntry->nStateSize = pRing->nLatestSize;
+		pRing->nUsedEntries++;
+	}
+
+	/* new state becomes the latest */
+	pTmp = pRing->pLatest;
+	pRing->pLatest = pRing->pCapture;
+	pRing->pCapture = pTmp;
+	pRing->nLatestSize = nSize;
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Drop the latest state of the given ring, so that the previous
+ * state becomes the latest one. Emulation state isn't touched.
+ * Return false if there was no previous state.
+ */
+bool Rewind_RingDrop(REWIND_RING *pRing)
+{
+	REWIND_ENTRY *pEntry;
+
+	if (!pRing->nUsedEntries)
+		return false;
+
+	pEntry = &pRing->pEntries[(pRing->nFirstEntry + pRing->nUsedEntries - 1) % pRing->nMaxEntries];
+	Rewind_ApplyDelta(pRing->pLatest, pEntry->pDelta);
+	pRing->nLatestSize = pEntry->nStateSize;
+	Rewind_FreeEntry(pEntry);
+	pRing->nUsedEntries--;
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Restore emulation to the latest state of the given ring.
+ * Return false if there's no state or restoring it failed.
+ */
+bool Rewind_RingRestore(REWIND_RING *pRing)
+{
+	if (!pRing->nLatestSize)
+		return false;
+	return MemorySnapShot_RestoreMem(pRing->pLatest, pRing->nLatestSize);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Capture current emulation state into the rewind ring.
+ * Return false on failure.
+ */
+bool Rewind_Push(void)
+{
+	if (!pRewind)
+		return false;
+	return Rewind_RingPush(pRewind);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Step back to the previous state in the rewind ring and restore it.
+ * Return false if there was nothing to rewind to.
+ */
+bool Rewind_Back(void)
+{
+	if (!pRewind || !Rewind_RingDrop(pRewind))
+		return false;
+	return Rewind_RingRestore(pRewind);
+}
@@ -0,0 +1,217 @@
+/*
+  Hatari - rowPool.c
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+
+  Worker pool for converting the rows of a frame in parallel.
+
+  RowPool_Run() splits the rows into bands of ROWPOOL_BAND_ROWS. The
+  calling thread and the workers take the next band from a shared atomic
+  counter until none is left, so a slow band doesn't hold the others, and
+  the call returns when all the workers are done with the frame. Rows have
+  to be independent of each other: a band function can't read the output
+  of the rows before its first one.
+
+  With one thread (the default), or without thread support, the rows are
+  converted by the caller in one go.
+*/
+const char RowPool_fileid[] = "Hatari rowPool.c : " __DATE__ " " __TIME__;
+
+#include <stdint.h>
+
+#include "main.h"
+#include "log.h"
+#include "rowPool.h"
+
+#if HAVE_PTHREAD_H
+#define ROWPOOL_THREAD 1
+#include <pthread.h>
+#endif
+
+#define ROWPOOL_BAND_ROWS	16
+
+static int nPoolThreads = 1;			/* including the caller */
+
+#if ROWPOOL_THREAD
+static pthread_t	PoolThreads[ROWPOOL_MAX_THREADS-1];
+static int		nPoolWorkers;			/* started worker threads */
+static pthread_mutex_t	pool_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t	pool_start_cond = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t	pool_done_cond = PTHREAD_COND_INITIALIZER;
+static Uint32		nPoolFrame;			/* incremented for each frame (protected by lock) */
+static int		nPoolBusy;			/* workers still on frame (protected by lock) */
+static bool		bPoolQuit;			/* protected by lock */
+
+static struct {
+	ROWPOOL_FUNC	pFunc;
+	void		*pParam;
+	int		nRows;
+	int		nBands;
+	int		nNextBand;			/* atomic */
+} PoolJob;
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Convert bands of the current frame until none is left.
+ */
+static void RowPool_DoBands(void)
+{
+	int nBand, nFirst, nLast;
+
+	while ((nBand = __atomic_fetch_add(&PoolJob.nNextBand, 1, __ATOMIC_RELAXED)) < PoolJob.nBands)
+	{
+		nFirst = nBand * ROWPOOL_BAND_ROWS;
+		nLast = nFirst + ROWPOOL_BAND_ROWS;
+		if (nLast > PoolJob.nRows)
+			nLast = PoolJob.nRows;
+		PoolJob.pFunc(nFirst, nLast, PoolJob.pParam);
+	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Worker thread : help with each frame handed to the pool.
+ */
+static void *RowPool_ThreadFunc(void *arg)
+{
+	/* Frame when started, not the current one: it may already be
+	 * handed out when the thread gets to run */
+	Uint32 nFrame = (Uint32)(uintptr_t)arg;
+
+	pthread_mutex_lock(&pool_lock);
+	for (;;)
+	{
+		while (nFrame == nPoolFrame && !bPoolQuit)
+			pthread_cond_wait(&pool_start_cond, &pool_lock);
+		if (bPoolQuit)
+			break;
+		nFrame = nPoolFrame;
+		pthread_mutex_unlock(&pool_lock);
+
+		RowPool_DoBands();
+
+		pthread_mutex_lock(&pool_lock);
+		if (--nPoolBusy == 0)
+			pthread_cond_signal(&pool_done_cond);
+	}
+	pthread_mutex_unlock(&pool_lock);
+	return NULL;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Start the missing worker threads. Return false if there are none.
+ */
+static bool RowPool_StartThreads(void)
+{
+	while (nPoolWorkers < nPoolThreads - 1)
+	{
+		if (pthread_create(&PoolThreads[nPoolWorkers], NULL, RowPool_ThreadFunc,
+		                   (void *)(uintptr_t)nPoolFrame) != 0)
+		{
+			Log_Printf(LOG_WARN, "Failed to create row conversion thread.\n");
+			nPoolThreads = nPoolWorkers + 1;
+			break;
+		}
+		nPoolWorkers++;
+	}
+	return nPoolWorkers > 0;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Stop all the worker threads.
+ */
+static void RowPool_StopThreads(void)
+{
+	int i;
+
+	if (nPoolWorkers == 0)
+		return;
+
+	pthread_mutex_lock(&pool_lock);
+	bPoolQuit = true;
+	pthread_cond_broadcast(&pool_start_cond);
+	pthread_mutex_unlock(&pool_lock);
+
+	for (i = 0; i < nPoolWorkers; i++)
+		pthread_join(PoolThreads[i], NULL);
+	nPoolWorkers = 0;
+	bPoolQuit = false;
+}
+#endif
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Call pFunc for all the nRows rows, split into bands converted in
+ * parallel by the pool threads. Return when all rows are converted.
+ */
+void RowPool_Run(int nRows, ROWPOOL_FUNC pFunc, void *pParam)
+{
+#if ROWPOOL_THREAD
+	if (nPoolThreads > 1 && nRows > ROWPOOL_BAND_ROWS && RowPool_StartThreads())
+	{
+		PoolJob.pFunc = pFunc;
+		PoolJob.pParam = pParam;
+		PoolJob.nRows = nRows;
+		PoolJob.nBands = (nRows + ROWPOOL_BAND_ROWS - 1) / ROWPOOL_BAND_ROWS;
+		PoolJob.nNextBand = 0;
+
+		pthread_mutex_lock(&pool_lock);
+		nPoolFrame++;
+		nPoolBusy = nPoolWorkers;
+		pthread_cond_broadcast(&pool_start_cond);
+		pthread_mutex_unlock(&pool_lock);
+
+		RowPool_DoBands();
+
+		/* Workers may still be on their last band */
+		pthread_mutex_lock(&pool_lock);
+		while (nPoolBusy > 0)
+			pthread_cond_wait(&pool_done_cond, &pool_lock);
+		pthread_mutex_unlock(&pool_lock);
+		return;
+	}
+#endif
+	if (nRows > 0)
+		pFunc(0, nRows, pParam);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Set number of threads converting the rows, the calling one included
+ * (1 = no worker threads). Workers are started on next frame.
+ */
+void RowPool_SetThreads(int nThreads)
+{
+	if (nThreads < 1)
+		nThreads = 1;
+	if (nThreads > ROWPOOL_MAX_THREADS)
+		nThreads = ROWPOOL_MAX_THREADS;
+	if (nThreads == nPoolThreads)
+		return;
+
+#if ROWPOOL_THREAD
+	RowPool_StopThreads();
+#endif
+	nPoolThreads = nThreads;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Stop the worker threads (called when Hatari exits).
+ */
+void RowPool_UnInit(void)
+{
+#if ROWPOOL_THREAD
+	RowPool_StopThreads();
+#endif
+}
@@ -9,25 +9,29 @@
   This is similar to the printing functions, we open a direct file
   (e.g. /dev/ttyS0) and send bytes over it.
   Using such method mimicks the ST exactly, and even allows us to connect
-  to an actual ST! To wait for incoming data, we create a thread which copies
-  the bytes into an input buffer. This method fits in with the internet code
-  which also reads data into a buffer.
+  to an actual ST! Instead of a file, "tcp:<host>:<port>" connects to a TCP
+  server and "pty" creates a pseudo terminal for other host programs.
+  Incoming data is polled without blocking once per VBL and copied into
+  an input buffer, from which the emulated MFP reads it.
 */
 const char RS232_fileid[] = "Hatari rs232.c : " __DATE__ " " __TIME__;
 
+#define _GNU_SOURCE		/* for posix_openpt() & co with glibc */
+
 #include <config.h>
 
 #if HAVE_TERMIOS_H
 # include <termios.h>
 # include <unistd.h>
 #endif
-#if defined(WIIU) || defined(VITA)
-//no rs323 for now
-#else
-#include <SDL.h>
-#include <SDL_thread.h>
-#include <errno.h>
+#if HAVE_INET_SOCKETS
+# include <unistd.h>
+# include <fcntl.h>
+# include <poll.h>
+# include <netdb.h>
+# include <sys/socket.h>
 #endif
+#include <errno.h>
 #include "main.h"
 #include "configuration.h"
 #include "ioMem.h"
@@ -50,7 +54,6 @@ static FILE *hComOut = NULL;       /* Handle to file for writing */
 
 static unsigned char InputBuffer_RS232[MAX_RS232INPUT_BUFFER];
 static int InputBuffer_Head=0, InputBuffer_Tail=0;
-static volatile bool bQuitThread = false;
 
 #if HAVE_TERMIOS_H
 
@@ -191,6 +194,119 @@ static bool RS232_SetBitsConfig(FILE *fhndl, int nCharSize, int nStopBits, bool
 #endif /* HAVE_TERMIOS_H */
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Return true if given RS-232 device name is a TCP connection ("tcp:host:port")
+ * or a pseudo terminal ("pty") instead of a file name.
+ */
+bool RS232_IsChannelName(const char *name)
+{
+	return strncmp(name, "tcp:", 4) == 0 || strcmp(name, "pty") == 0;
+}
+
+
+#if HAVE_INET_SOCKETS
+/*-----------------------------------------------------------------------*/
+/**
+ * Connect to the TCP server given as "tcp:host:port".
+ * Return file descriptor or -1 on error.
+ */
+static int RS232_ConnectTCP(const char *name)
+{
+	struct addrinfo hints, *res, *ai;
+	char host[256];
+	const char *port;
+	int fd = -1;
+
+	port = strrchr(name + 4, ':');
+	if (!port || port - (name + 4) >= (int)sizeof(host))
+	{
+		Log_Printf(LOG_WARN, "RS232: '%s' is not of the form tcp:<host>:<port>\n", name);
+		return -1;
+	}
+	memcpy(host, name + 4, port - (name + 4));
+	host[port - (name + 4)] = '\0';
+	port++;
+
+	memset(&hints, 0, sizeof(hints));
+	hints.ai_family = AF_UNSPEC;
+	hints.ai_socktype = SOCK_STREAM;
+	if (getaddrinfo(host, port, &hints, &res) != 0)
+	{
+		Log_Printf(LOG_WARN, "RS232: can't resolve '%s'\n", host);
+		return -1;
+	}
+	for (ai = res; ai; ai = ai->ai_next)
+	{
+		fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+		if (fd < 0)
+			continue;
+		if (connect(fd, ai->ai_addr, ai->ai_addrlen) == 0)
+			break;
+		close(fd);
+		fd = -1;
+	}
+	freeaddrinfo(res);
+
+	if (fd < 0)
+		Log_Printf(LOG_WARN, "RS232: can't connect to %s:%s\n", host, port);
+	return fd;
+}
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Create a pseudo terminal and tell the user the name of its slave side.
+ * Return file descriptor of the master side or -1 on error.
+ */
+static int RS232_OpenPTY(void)
+{
+	int fd;
+
+	fd = posix_openpt(O_RDWR | O_NOCTTY);
+	if (fd < 0)
+		return -1;
+	if (grantpt(fd) != 0 || unlockpt(fd) != 0)
+	{
+		close(fd);
+		return -1;
+	}
+	Log_Printf(LOG_INFO, "RS232: serial port is available as %s\n", ptsname(fd));
+	return fd;
+}
+#endif /* HAVE_INET_SOCKETS */
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Open a RS-232 device, which is either a file or a channel name.
+ * If the same channel is used for input and output, it's shared.
+ */
+static FILE *RS232_OpenDevice(const char *name, const char *mode)
+{
+#if HAVE_INET_SOCKETS
+	FILE *other;
+	int fd;
+
+	if (RS232_IsChannelName(name))
+	{
+		/* Input and output both use the same connection */
+		other = (mode[0] == 'r') ? hComOut : hComIn;
+		if (other && strcmp(ConfigureParams.RS232.szInFileName,
+		                    ConfigureParams.RS232.szOutFileName) == 0)
+			fd = dup(fileno(other));
+		else if (name[0] == 't')
+			fd = RS232_ConnectTCP(name);
+		else
+			fd = RS232_OpenPTY();
+		if (fd < 0)
+			return NULL;
+		return fdopen(fd, mode);
+	}
+#endif
+	return fopen(name, mode);
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Open file on COM port.
@@ -202,7 +318,7 @@ static bool RS232_OpenCOMPort(void)
 	if (!hComOut && ConfigureParams.RS232.szOutFileName[0])
 	{
 		/* Create our COM file for output */
-		hComOut = fopen(ConfigureParams.RS232.szOutFileName, "wb");
+		hComOut = RS232_OpenDevice(ConfigureParams.RS232.szOutFileName, "wb");
 		if (hComOut)
 		{
 			setvbuf(hComOut, NULL, _IONBF, 0);
@@ -227,7 +343,7 @@ static bool RS232_OpenCOMPort(void)
 	if (!hComIn && ConfigureParams.RS232.szInFileName[0])
 	{
 		/* Create our COM file for input */
-		hComIn = fopen(ConfigureParams.RS232.szInFileName, "rb");
+		hComIn = RS232_OpenDevice(ConfigureParams.RS232.szInFileName, "rb");
 		if (hComIn)
 		{
 			setvbuf(hComIn, NULL, _IONBF, 0);
@@ -269,83 +385,66 @@ static void RS232_CloseCOMPort(void)
 		fclose(hComOut);
 		hComOut = NULL;
 	}
+	InputBuffer_Head = InputBuffer_Tail = 0;
 	Dprintf(("Closed RS232 files.\n"));
 }
 
-#if !defined(WIIU) && !defined(VITA)
-/* thread stuff */
-static SDL_sem* pSemFreeBuf;       /* Semaphore to sync free space in InputBuffer_RS232 */
-static SDL_Thread *RS232Thread = NULL; /* Thread handle for reading incoming data */
-#endif
-
 /*-----------------------------------------------------------------------*/
 /**
- * Add incoming bytes from other machine into our input buffer
+ * Copy all bytes which are waiting on the input device into our input
+ * buffer, without blocking. Called once per VBL.
  */
-static void RS232_AddBytesToInputBuffer(unsigned char *pBytes, int nBytes)
+void RS232_Update(void)
 {
-	int i;
-#if !defined(WIIU) && !defined(VITA)
-	/* Copy bytes into input buffer */
-	for (i=0; i<nBytes; i++)
-	{
-		SDL_SemWait(pSemFreeBuf);    /* Wait for free space in buffer */
-		InputBuffer_RS232[InputBuffer_Tail] = *pBytes++;
-		InputBuffer_Tail = (InputBuffer_Tail+1) % MAX_RS232INPUT_BUFFER;
-	}
-#endif
-}
+	int nFree, nChunk, nRead;
+	bool bWasEmpty;
 
+	if (!hComIn)
+		return;
 
-/*-----------------------------------------------------------------------*/
-/**
- * Thread to read incoming RS-232 data, and pass to emulator input buffer
- */
-static int RS232_ThreadFunc(void *pData)
-{
-	int iInChar;
-	unsigned char cInChar;
-#if !defined(WIIU) && !defined(VITA)
-	/* Check for any RS-232 incoming data */
-	while (!bQuitThread)
+	bWasEmpty = (InputBuffer_Head == InputBuffer_Tail);
+
+	/* Keep one entry free to tell a full buffer from an empty one */
+	nFree = (InputBuffer_Head - InputBuffer_Tail - 1) & (MAX_RS232INPUT_BUFFER-1);
+	while (nFree > 0)
 	{
-		if (hComIn)
-		{
-			/* Read the bytes in, if we have any */
-			iInChar = fgetc(hComIn);
-			if (iInChar != EOF)
-			{
-				/* Copy into our internal queue */
-				cInChar = iInChar;
-				RS232_AddBytesToInputBuffer(&cInChar, 1);
-				/* FIXME: Use semaphores to lock MFP variables? */
-				MFP_InputOnChannel ( MFP_INT_RCV_BUF_FULL , 0 );
-				Dprintf(("RS232: Read character $%x\n", iInChar));
-				/* Sleep for a while */
-				SDL_Delay(2);
-			}
-			else
-			{
-				/*Dprintf(("RS232: Reached end of input file!\n"));*/
-				/* potential data race on hComIn modification */
-				clearerr(hComIn);
-				SDL_Delay(20);
-			}
-		}
-		else
+		/* Read up to the end of the ring, then wrap around */
+		nChunk = MAX_RS232INPUT_BUFFER - InputBuffer_Tail;
+		if (nChunk > nFree)
+			nChunk = nFree;
+#if HAVE_INET_SOCKETS
 		{
-			/* No RS-232 connection, sleep for 0.2s */
-			SDL_Delay(200);
+			struct pollfd pfd;
+
+			pfd.fd = fileno(hComIn);
+			pfd.events = POLLIN;
+			/* Only read what's there, never block the emulation */
+			if (poll(&pfd, 1, 0) <= 0 || !(pfd.revents & (POLLIN|POLLHUP)))
+				break;
+			nRead = read(pfd.fd, &InputBuffer_RS232[InputBuffer_Tail], nChunk);
 		}
-	}
+#else
+		nRead = fread(&InputBuffer_RS232[InputBuffer_Tail], 1, nChunk, hComIn);
+		if (nRead < nChunk)
+			clearerr(hComIn);	/* Continue after EOF when the file grows */
 #endif
-	return true;
+		if (nRead <= 0)
+			break;
+
+		Dprintf(("RS232: Read %i bytes ($%x ...)\n", nRead, InputBuffer_RS232[InputBuffer_Tail]));
+		InputBuffer_Tail = (InputBuffer_Tail + nRead) & (MAX_RS232INPUT_BUFFER-1);
+		nFree -= nRead;
+	}
+
+	/* Further interrupts are generated as the data register is read */
+	if (bWasEmpty && InputBuffer_Head != InputBuffer_Tail)
+		MFP_InputOnChannel ( MFP_INT_RCV_BUF_FULL , 0 );
 }
 
 
 /*-----------------------------------------------------------------------*/
 /**
- * Initialize RS-232, start thread to wait for incoming data
+ * Initialize RS-232
  * (we will open a connection when first bytes are sent even
  *  if RS-232 isn't initialized for reading).
  */
@@ -362,30 +461,6 @@ void RS232_Init(void)
 			return;
 		}
 	}
-	if (hComIn)
-	{
-		/* Create semaphore */
-		if (pSemFreeBuf == NULL)
-			pSemFreeBuf = SDL_CreateSemaphore(MAX_RS232INPUT_BUFFER);
-		if (pSemFreeBuf == NULL)
-		{
-			RS232_CloseCOMPort();
-			Log_Printf(LOG_WARN, "RS232_Init: Can't create semaphore!\n");
-			return;
-		}
-
-		/* Create thread to wait for incoming bytes over RS-232 */
-		if (!RS232Thread)
-		{
-			bQuitThread = false;
-#if WITH_SDL2
-			RS232Thread = SDL_CreateThread(RS232_ThreadFunc, "rs232", NULL);
-#else
-			RS232Thread = SDL_CreateThread(RS232_ThreadFunc, NULL);
-#endif
-			Dprintf(("RS232 thread has been created.\n"));
-		}
-	}
 #else
 	ConfigureParams.RS232.bEnableRS232 = false;
 	return;
@@ -399,31 +474,7 @@ void RS232_Init(void)
  */
 void RS232_UnInit(void)
 {
-#if !defined(WIIU) && !defined(VITA)
-	/* Close, kill thread and free resource */
-	if (RS232Thread)
-	{
-		/* Instead of killing the thread directly, we should
-		 * probably better inform it via IPC so that it can
-		 * terminate gracefully... but then we would need to
-		 * wait until it exits, otherwise there's a data race
-		 * on accessing/modifying hComIn.
-		 */
-		Dprintf(("Killing RS232 thread...\n"));
-		bQuitThread = true;
-#if !WITH_SDL2
-		SDL_KillThread(RS232Thread);
-#endif
-		RS232Thread = NULL;
-	}
 	RS232_CloseCOMPort();
-
-	if (pSemFreeBuf)
-	{
-		SDL_DestroySemaphore(pSemFreeBuf);
-		pSemFreeBuf = NULL;
-	}
-#endif
 }
 
 
@@ -664,20 +715,18 @@ bool RS232_TransferBytesTo(Uint8 *pBytes, int nBytes)
 bool RS232_ReadBytes(Uint8 *pBytes, int nBytes)
 {
 	int i;
-#if !defined(WIIU) && !defined(VITA)
+
 	/* Connected? */
 	if (hComIn && InputBuffer_Head != InputBuffer_Tail)
 	{
 		/* Read bytes out of input buffer */
-		for (i=0; i<nBytes; i++)
+		for (i=0; i<nBytes && InputBuffer_Head != InputBuffer_Tail; i++)
 		{
 			*pBytes++ = InputBuffer_RS232[InputBuffer_Head];
 			InputBuffer_Head = (InputBuffer_Head+1) % MAX_RS232INPUT_BUFFER;
-			SDL_SemPost(pSemFreeBuf);    /* Signal free space */
 		}
 		return true;
 	}
-#endif
 	return false;
 }
 
@@ -688,7 +737,6 @@ bool RS232_ReadBytes(Uint8 *pBytes, int nBytes)
  */
 bool RS232_GetStatus(void)
 {
-#if !defined(WIIU) && !defined(VITA)
 	/* Connected? */
 	if (hComIn)
 	{
@@ -696,7 +744,6 @@ bool RS232_GetStatus(void)
 		if (InputBuffer_Head != InputBuffer_Tail)
 			return true;
 	}
-#endif
 	/* No, none */
 	return false;
 }
@@ -708,8 +755,6 @@ bool RS232_GetStatus(void)
  */
 void RS232_SCR_ReadByte(void)
 {
-	M68000_WaitState(4);
-
 	/* nothing */
 }
 
@@ -719,8 +764,6 @@ void RS232_SCR_ReadByte(void)
  */
 void RS232_SCR_WriteByte(void)
 {
-	M68000_WaitState(4);
-
 	/*Dprintf(("RS232: Write to SCR: $%x\n", (int)IoMem[0xfffa27]));*/
 }
 
@@ -731,8 +774,6 @@ void RS232_SCR_WriteByte(void)
  */
 void RS232_UCR_ReadByte(void)
 {
-	M68000_WaitState(4);
-
 	Dprintf(("RS232: Read from UCR: $%x\n", (int)IoMem[0xfffa29]));
 }
 
@@ -742,8 +783,6 @@ void RS232_UCR_ReadByte(void)
  */
 void RS232_UCR_WriteByte(void)
 {
-	M68000_WaitState(4);
-
 	Dprintf(("RS232: Write to UCR: $%x\n", (int)IoMem[0xfffa29]));
 
 	RS232_HandleUCR(IoMem[0xfffa29]);
@@ -756,8 +795,6 @@ void RS232_UCR_WriteByte(void)
  */
 void RS232_RSR_ReadByte(void)
 {
-	M68000_WaitState(4);
-
 	if (RS232_GetStatus())
 		IoMem[0xfffa2b] |= 0x80;        /* Buffer full */
 	else
@@ -772,8 +809,6 @@ void RS232_RSR_ReadByte(void)
  */
 void RS232_RSR_WriteByte(void)
 {
-	M68000_WaitState(4);
-
 	Dprintf(("RS232: Write to RSR: $%x\n", (int)IoMem[0xfffa2b]));
 }
 
@@ -787,8 +822,6 @@ void RS232_RSR_WriteByte(void)
  */
 void RS232_TSR_ReadByte(void)
 {
-	M68000_WaitState(4);
-
 	IoMem[0xfffa2d] |= 0x80;        /* Buffer empty */
 
 	Dprintf(("RS232: Read from TSR: $%x\n", (int)IoMem[0xfffa2d]));
@@ -800,8 +833,6 @@ void RS232_TSR_ReadByte(void)
  */
 void RS232_TSR_WriteByte(void)
 {
-	M68000_WaitState(4);
-
 	Dprintf(("RS232: Write to TSR: $%x\n", (int)IoMem[0xfffa2d]));
 }
 
@@ -814,8 +845,6 @@ void RS232_UDR_ReadByte(void)
 {
 	Uint8 InByte = 0;
 
-	M68000_WaitState(4);
-
 	RS232_ReadBytes(&InByte, 1);
 	IoMem[0xfffa2f] = InByte;
 	Dprintf(("RS232: Read from UDR: $%x\n", (int)IoMem[0xfffa2f]));
@@ -835,8 +864,6 @@ void RS232_UDR_WriteByte(void)
 {
 	Uint8 OutByte;
 
-	M68000_WaitState(4);
-
 	OutByte = IoMem[0xfffa2f];
 	RS232_TransferBytesTo(&OutByte, 1);
 	Dprintf(("RS232: Write to UDR: $%x\n", (int)IoMem[0xfffa2f]));
@@ -17,14 +17,62 @@ const char Rtc_fileid[] = "Hatari rtc.c : " __DATE__ " " __TIME__;
 #include <time.h>
 
 #include "main.h"
+#include "configuration.h"
+#include "clocks_timings.h"
+#include "cycles.h"
 #include "ioMem.h"
 #include "rtc.h"
+#include "screen.h"
+#include "video.h"
 
 
 static bool rtc_bank;           /* RTC bank select (0=normal, 1=configuration(?)) */
 static Sint8 fake_am, fake_amz;
 
 
+static struct tm rtc_time;		/* broken-down time of rtc_time_ticks */
+static time_t rtc_time_ticks = -1;
+static int rtc_time_vbl = -1;		/* VBL the host time was read in */
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return the date and time shown by the emulated clocks: the host's local
+ * time, or in deterministic mode a fixed date advanced by the emulated
+ * time, so that the clock is the same on all hosts.
+ * Programs may poll the clock in loops, so the host time is read at most
+ * once per VBL, and the broken-down time is only converted again when
+ * the second changes.
+ */
+struct tm *Rtc_GetTime(void)
+{
+	time_t nTimeTicks;
+
+	if (ConfigureParams.System.bDeterministic)
+	{
+		nTimeTicks = RTC_DETERMINISTIC_EPOCH + CyclesGlobalClockCounter / MachineClocks.CPU_Freq;
+		if (nTimeTicks != rtc_time_ticks || rtc_time_vbl != -1)
+		{
+			rtc_time = *gmtime(&nTimeTicks);
+			rtc_time_ticks = nTimeTicks;
+			rtc_time_vbl = -1;
+		}
+		return &rtc_time;
+	}
+	if (rtc_time_vbl != nVBLs || rtc_time_ticks == -1)
+	{
+		nTimeTicks = time(NULL);
+		if (nTimeTicks != rtc_time_ticks)
+		{
+			rtc_time = *localtime(&nTimeTicks);
+			rtc_time_ticks = nTimeTicks;
+		}
+		rtc_time_vbl = nVBLs;
+	}
+	return &rtc_time;
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Read seconds units.
@@ -32,11 +80,9 @@ static Sint8 fake_am, fake_amz;
 void Rtc_SecondsUnits_ReadByte(void)
 {
 	struct tm *SystemTime;
-	time_t nTimeTicks;
 
 	/* Get system time */
-	nTimeTicks = time(NULL);
-	SystemTime = localtime(&nTimeTicks);
+	SystemTime = Rtc_GetTime();
 	IoMem[0xfffc21] = SystemTime->tm_sec % 10;
 }
 
@@ -48,11 +94,9 @@ void Rtc_SecondsUnits_ReadByte(void)
 void Rtc_SecondsTens_ReadByte(void)
 {
 	struct tm *SystemTime;
-	time_t nTimeTicks;
 
 	/* Get system time */
-	nTimeTicks = time(NULL);
-	SystemTime = localtime(&nTimeTicks);
+	SystemTime = Rtc_GetTime();
 	IoMem[0xfffc23] = SystemTime->tm_sec / 10;
 }
 
@@ -70,11 +114,9 @@ void Rtc_MinutesUnits_ReadByte(void)
 	else
 	{
 		struct tm *SystemTime;
-		time_t nTimeTicks;
 
 		/* Get system time */
-		nTimeTicks = time(NULL);
-		SystemTime = localtime(&nTimeTicks);
+		SystemTime = Rtc_GetTime();
 		IoMem[0xfffc25] = SystemTime->tm_min % 10;
 	}
 }
@@ -106,11 +148,9 @@ void Rtc_MinutesTens_ReadByte(void)
 	else
 	{
 		struct tm *SystemTime;
-		time_t nTimeTicks;
 
 		/* Get system time */
-		nTimeTicks = time(NULL);
-		SystemTime = localtime(&nTimeTicks);
+		SystemTime = Rtc_GetTime();
 		IoMem[0xfffc27] = SystemTime->tm_min / 10;
 	}
 }
@@ -136,11 +176,9 @@ void Rtc_MinutesTens_WriteByte(void)
 void Rtc_HoursUnits_ReadByte(void)
 {
 	struct tm *SystemTime;
-	time_t nTimeTicks;
 
 	/* Get system time */
-	nTimeTicks = time(NULL);
-	SystemTime = localtime(&nTimeTicks);
+	SystemTime = Rtc_GetTime();
 	IoMem[0xfffc29] = SystemTime->tm_hour % 10;
 }
 
@@ -152,11 +190,9 @@ void Rtc_HoursUnits_ReadByte(void)
 void Rtc_HoursTens_ReadByte(void)
 {
 	struct tm *SystemTime;
-	time_t nTimeTicks;
 
 	/* Get system time */
-	nTimeTicks = time(NULL);
-	SystemTime = localtime(&nTimeTicks);
+	SystemTime = Rtc_GetTime();
 	IoMem[0xfffc2b] = SystemTime->tm_hour / 10;
 }
 
@@ -168,11 +204,9 @@ void Rtc_HoursTens_ReadByte(void)
 void Rtc_Weekday_ReadByte(void)
 {
 	struct tm *SystemTime;
-	time_t nTimeTicks;
 
 	/* Get system time */
-	nTimeTicks = time(NULL);
-	SystemTime = localtime(&nTimeTicks);
+	SystemTime = Rtc_GetTime();
 	IoMem[0xfffc2d] = SystemTime->tm_wday;
 }
 
@@ -184,11 +218,9 @@ void Rtc_Weekday_ReadByte(void)
 void Rtc_DayUnits_ReadByte(void)
 {
 	struct tm *SystemTime;
-	time_t nTimeTicks;
 
 	/* Get system time */
-	nTimeTicks = time(NULL);
-	SystemTime = localtime(&nTimeTicks);
+	SystemTime = Rtc_GetTime();
 	IoMem[0xfffc2f] = SystemTime->tm_mday % 10;
 }
 
@@ -200,11 +232,9 @@ void Rtc_DayUnits_ReadByte(void)
 void Rtc_DayTens_ReadByte(void)
 {
 	struct tm *SystemTime;
-	time_t nTimeTicks;
 
 	/* Get system time */
-	nTimeTicks = time(NULL);
-	SystemTime = localtime(&nTimeTicks);
+	SystemTime = Rtc_GetTime();
 	IoMem[0xfffc31] = SystemTime->tm_mday / 10;
 }
 
@@ -216,11 +246,9 @@ void Rtc_DayTens_ReadByte(void)
 void Rtc_MonthUnits_ReadByte(void)
 {
 	struct tm *SystemTime;
-	time_t nTimeTicks;
 
 	/* Get system time */
-	nTimeTicks = time(NULL);
-	SystemTime = localtime(&nTimeTicks);
+	SystemTime = Rtc_GetTime();
 	IoMem[0xfffc33] = (SystemTime->tm_mon + 1) % 10;
 }
 
@@ -232,11 +260,9 @@ void Rtc_MonthUnits_ReadByte(void)
 void Rtc_MonthTens_ReadByte(void)
 {
 	struct tm *SystemTime;
-	time_t nTimeTicks;
 
 	/* Get system time */
-	nTimeTicks = time(NULL);
-	SystemTime = localtime(&nTimeTicks);
+	SystemTime = Rtc_GetTime();
 	IoMem[0xfffc35] = (SystemTime->tm_mon + 1) / 10;
 }
 
@@ -248,11 +274,9 @@ void Rtc_MonthTens_ReadByte(void)
 void Rtc_YearUnits_ReadByte(void)
 {
 	struct tm *SystemTime;
-	time_t nTimeTicks;
 
 	/* Get system time */
-	nTimeTicks = time(NULL);
-	SystemTime = localtime(&nTimeTicks);
+	SystemTime = Rtc_GetTime();
 	IoMem[0xfffc37] = SystemTime->tm_year % 10;
 }
 
@@ -264,11 +288,9 @@ void Rtc_YearUnits_ReadByte(void)
 void Rtc_YearTens_ReadByte(void)
 {
 	struct tm *SystemTime;
-	time_t nTimeTicks;
 
 	/* Get system time */
-	nTimeTicks = time(NULL);
-	SystemTime = localtime(&nTimeTicks);
+	SystemTime = Rtc_GetTime();
 	IoMem[0xfffc39] = (SystemTime->tm_year - 80) / 10;
 }
 
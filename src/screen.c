@@ -22,6 +22,11 @@
   for a screen. So not displaying the last two lines fixes garbage that could
   appear in the last two lines when displaying 47 lines (Digiworld 2 by ICE,
   Tyranny by DHS).
+  With the render thread enabled, the conversion of a frame runs on another
+  host thread while the emulation goes on with the next frame, and the frame
+  is shown on the next VBL. This makes the display one frame late. Frames
+  which need the emulation state (Spec512, VDI, 8-bit palettes, AVI
+  recording) are still converted and shown at once.
 */
 
 const char Screen_fileid[] = "Hatari screen.c : " __DATE__ " " __TIME__;
@@ -39,15 +44,23 @@ const char Screen_fileid[] = "Hatari screen.c : " __DATE__ " " __TIME__;
 #include "screen.h"
 #include "control.h"
 #include "convert/routines.h"
+#include "convert/simd.h"
 #include "resolution.h"
+#include "rowPool.h"
 #include "sound.h"
 #include "spec512.h"
 #include "statusbar.h"
+#include "stats.h"
 #include "vdi.h"
 #include "video.h"
 #include "falcon/videl.h"
 #include "falcon/hostscreen.h"
 
+#if HAVE_PTHREAD_H && !defined(__LIBRETRO__)
+#define SCREEN_THREAD 1
+#include <pthread.h>
+#endif
+
 #define DEBUG 0
 
 #if DEBUG
@@ -77,7 +90,10 @@ Uint8 *pSTScreen;
 FRAMEBUFFER *pFrameBuffer;    /* Pointer into current 'FrameBuffer' */
 
 static FRAMEBUFFER FrameBuffers[NUM_FRAMEBUFFERS]; /* Store frame buffer details to tell how to update */
+static Uint8 *pSTScreenConvert;                    /* ST screen data to convert (pSTScreen in conversion routines) */
 static Uint8 *pSTScreenCopy;                       /* Keep track of current and previous ST screen data */
+static Uint16 *pConvertHBLPalettes;                /* Palettes and masks of the converted lines */
+static Uint32 *pConvertHBLPaletteMasks;
 static Uint8 *pPCScreenDest;                       /* Destination PC buffer */
 static int STScreenEndHorizLine;                   /* End lines to be converted */
 static int PCScreenBytesPerLine;
@@ -88,6 +104,7 @@ static SDL_Rect STScreenRect;                      /* screen size without status
 
 static int STScreenLineOffset[NUM_VISIBLE_LINES];  /* Offsets for ST screen lines eg, 0,160,320... */
 static Uint16 HBLPalette[16], PrevHBLPalette[16];  /* Current palette for line, also copy of first line */
+static Uint64 HBLPaletteHash;                        /* Hash of 'HBLPalette[]' (see video.c) */
 
 static void (*ScreenDrawFunctionsNormal[3])(void); /* Screen draw functions */
 static void (*ScreenDrawFunctionsVDI[3])(void) =
@@ -100,6 +117,29 @@ static void (*ScreenDrawFunctionsVDI[3])(void) =
 static bool bScreenContentsChanged;     /* true if buffer changed and requires blitting */
 static bool bScrDoubleY;                /* true if double on Y */
 static int ScrUpdateFlag;               /* Bit mask of how to update screen */
+static SCREEN_RAWFRAME_FUNC pRawFrameHook;  /* host side decoding of ST frames */
+static bool bRawFrameShown;             /* last frame went to pRawFrameHook */
+static int nVDIChangedFirstRow;         /* VDI screen rows which can differ from */
+static int nVDIChangedEndRow = MAX_VDI_HEIGHT;  /* the previous screen */
+static int nVDIUpdateFirstRow = -1;     /* VDI screen rows converted on last draw, */
+static int nVDIUpdateEndRow;            /* -1 if whole screen needs to be shown */
+
+#if SCREEN_THREAD
+/* The emulation thread hands a frame to the render thread with
+ * pRenderFunction and waits for it to be cleared before the next one.
+ * The render thread only runs the conversion routine, it doesn't call
+ * SDL: the converted frame is shown by the emulation thread when it
+ * syncs with the render thread.
+ */
+static pthread_t render_thread;
+static pthread_mutex_t render_thread_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t render_thread_cond = PTHREAD_COND_INITIALIZER;
+static void (*pRenderFunction)(void);  /* conversion routine run by render thread (protected by lock) */
+static bool bRenderThreadQuit;         /* render thread should exit (protected by lock) */
+static bool bRenderThreadActive;       /* render thread exists */
+static bool bRenderPending;            /* frame handed to render thread, not shown yet */
+static Uint32 RenderPaletteMasks[HBL_PALETTE_MASKS];  /* Masks of the frame in conversion */
+#endif
 
 
 static bool Screen_DrawFrame(bool bForceFlip);
@@ -109,27 +149,91 @@ static bool Screen_DrawFrame(bool bForceFlip);
 SDL_Window *sdlWindow;
 static SDL_Renderer *sdlRenderer;
 static SDL_Texture *sdlTexture;
+static bool bTextureFullUpdate;	/* upload whole surface on next update */
+static Uint32 TexturePalette[256];	/* palette used for 8-bit texture contents */
+
+/**
+ * Convert given rectangle of an 8-bit surface through its palette
+ * straight into the (XRGB8888) streaming texture
+ */
+static void Screen_UpdateTexture8(SDL_Surface *screen, const SDL_Rect *rect,
+                                  const Uint32 *palette)
+{
+	Uint8 *src = (Uint8 *)screen->pixels + rect->y * screen->pitch + rect->x;
+	void *pixels;
+	int pitch, x, y;
+
+	if (SDL_LockTexture(sdlTexture, rect, &pixels, &pitch) != 0)
+		return;
+	for (y = 0; y < rect->h; y++)
+	{
+		Uint32 *dst = (Uint32 *)((Uint8 *)pixels + y * pitch);
+		for (x = 0; x < rect->w; x++)
+			dst[x] = palette[src[x]];
+		src += screen->pitch;
+	}
+	SDL_UnlockTexture(sdlTexture);
+}
 
+/**
+ * Upload only the given rectangles of the surface into the texture
+ * and show it.  Like with SDL1, a zero sized rectangle means the whole
+ * surface.
+ */
 void SDL_UpdateRects(SDL_Surface *screen, int numrects, SDL_Rect *rects)
 {
-	if (sdlscrn->format->BitsPerPixel == 8)
+	SDL_Rect full = { 0, 0, screen->w, screen->h };
+	SDL_Rect rect;
+	Uint32 palette[256];
+	int bpp = screen->format->BytesPerPixel;
+	int i;
+
+	if (bpp == 1)
 	{
-		sdlTexture = SDL_CreateTextureFromSurface(sdlRenderer, screen);
+		SDL_Palette *pal = screen->format->palette;
+		for (i = 0; i < pal->ncolors && i < 256; i++)
+		{
+			palette[i] = (pal->colors[i].r << 16)
+			             | (pal->colors[i].g << 8) | pal->colors[i].b;
+		}
+		for (; i < 256; i++)
+			palette[i] = 0;
+		/* palette change affects also the non-updated areas */
+		if (memcmp(palette, TexturePalette, sizeof(palette)) != 0)
+		{
+			memcpy(TexturePalette, palette, sizeof(palette));
+			bTextureFullUpdate = true;
+		}
 	}
-	else
+
+	if (bTextureFullUpdate)
+	{
+		rects = &full;
+		numrects = 1;
+		bTextureFullUpdate = false;
+	}
+	for (i = 0; i < numrects; i++)
 	{
-		SDL_UpdateTexture(sdlTexture, NULL, screen->pixels, screen->pitch);
+		if (rects[i].w == 0 && rects[i].h == 0)
+			rect = full;
+		else if (!SDL_IntersectRect(&rects[i], &full, &rect))
+			continue;
+
+		if (bpp == 1)
+		{
+			Screen_UpdateTexture8(screen, &rect, TexturePalette);
+		}
+		else
+		{
+			SDL_UpdateTexture(sdlTexture, &rect, (Uint8 *)screen->pixels
+			                  + rect.y * screen->pitch + rect.x * bpp,
+			                  screen->pitch);
+		}
 	}
 
 	SDL_RenderClear(sdlRenderer);
 	SDL_RenderCopy(sdlRenderer, sdlTexture, NULL, NULL);
 	SDL_RenderPresent(sdlRenderer);
-
-	if (sdlscrn->format->BitsPerPixel == 8)
-	{
-		SDL_DestroyTexture(sdlTexture);
-		sdlTexture = NULL;
-	}
 }
 
 void SDL_UpdateRect(SDL_Surface *screen, Sint32 x, Sint32 y, Sint32 w, Sint32 h)
@@ -407,6 +511,9 @@ bool Screen_SetSDLVideoSize(int width, int height, int bitdepth)
 	static bool bWasInFullScreen = false;
 	Uint32 sdlVideoFlags;
 
+	/* Show frame converted into the old surface first */
+	Screen_RenderSync();
+
 #if WITH_SDL2
 	if (bitdepth == 0 || bitdepth == 24)
 		bitdepth = 32;
@@ -466,6 +573,8 @@ bool Screen_SetSDLVideoSize(int width, int height, int bitdepth)
 	SDL_RenderSetLogicalSize(sdlRenderer, width, height);
 	if (bitdepth == 8)
 	{
+		/* converted through the palette on update */
+		int pfmt = SDL_PIXELFORMAT_RGB888;
 		SDL_Color cols[] = {	/* Colors for the sdl-gui */
 			{ 0, 0, 0, 255 }, { 64, 64, 64, 255 },
 			{ 128, 128, 128, 255 }, { 160, 160, 160, 255 },
@@ -478,6 +587,9 @@ bool Screen_SetSDLVideoSize(int width, int height, int bitdepth)
 		if (sdlscrn)
 			SDL_SetPaletteColors(sdlscrn->format->palette, cols,
 			                     128, ARRAYSIZE(cols));
+		sdlTexture = SDL_CreateTexture(sdlRenderer, pfmt,
+		                               SDL_TEXTUREACCESS_STREAMING,
+		                               width, height);
 	}
 	else
 	{
@@ -501,12 +613,13 @@ bool Screen_SetSDLVideoSize(int width, int height, int bitdepth)
 		sdlTexture = SDL_CreateTexture(sdlRenderer, pfmt,
 		                               SDL_TEXTUREACCESS_STREAMING,
 		                               width, height);
-		if (!sdlTexture)
-		{
-			fprintf(stderr,"Failed to create texture!\n");
-			exit(-3);
-		}
 	}
+	if (!sdlTexture)
+	{
+		fprintf(stderr,"Failed to create texture!\n");
+		exit(-3);
+	}
+	bTextureFullUpdate = true;
 
 #else	/* WITH_SDL2 */
 
@@ -577,6 +690,8 @@ static void Screen_SetResolution(void)
 	int Width, Height, nZoom, SBarHeight, BitCount, maxW, maxH;
 	bool bDoubleLowRes = false;
 
+	Screen_RenderSync();
+
 	/* Bits per pixel */
 	if (STRes == ST_HIGH_RES || bUseVDIRes)
 	{
@@ -721,13 +836,19 @@ void Screen_Init(void)
 	{
 		FrameBuffers[i].pSTScreen = malloc(MAX_VDI_BYTES);
 		FrameBuffers[i].pSTScreenCopy = malloc(MAX_VDI_BYTES);
-		if (!FrameBuffers[i].pSTScreen || !FrameBuffers[i].pSTScreenCopy)
+		FrameBuffers[i].pSTScreenRender = malloc(MAX_VDI_BYTES);
+		if (!FrameBuffers[i].pSTScreen || !FrameBuffers[i].pSTScreenCopy
+		    || !FrameBuffers[i].pSTScreenRender)
 		{
 			fprintf(stderr, "Failed to allocate frame buffer memory.\n");
 			exit(-1);
 		}
 	}
 	pFrameBuffer = &FrameBuffers[0];
+
+#if CONVERT_SIMD
+	Convert_SimdInit();
+#endif
 #ifndef __LIBRETRO__
 	/* Load and set icon */
 	snprintf(sIconFileName, sizeof(sIconFileName), "%s%chatari-icon.bmp",
@@ -756,6 +877,9 @@ void Screen_Init(void)
 
 	/* Configure some SDL stuff: */
 	SDL_ShowCursor(SDL_DISABLE);
+
+	Screen_EnableRenderThread(ConfigureParams.Screen.bRenderThread);
+	RowPool_SetThreads(ConfigureParams.Screen.nConvertThreads);
 }
 
 
@@ -767,11 +891,14 @@ void Screen_UnInit(void)
 {
 	int i;
 
+	Screen_EnableRenderThread(false);
+
 	/* Free memory used for copies */
 	for (i = 0; i < NUM_FRAMEBUFFERS; i++)
 	{
 		free(FrameBuffers[i].pSTScreen);
 		free(FrameBuffers[i].pSTScreenCopy);
+		free(FrameBuffers[i].pSTScreenRender);
 	}
 
 #if WITH_SDL2
@@ -858,6 +985,7 @@ static void Screen_Refresh(void)
 	{
 		if (ConfigureParams.System.nMachineType == MACHINE_FALCON)
 		{
+			Screen_SetFullUpdate();
 			VIDEL_renderScreen();
 			return;
 		}
@@ -1038,25 +1166,23 @@ static bool Screen_CompareResolution(int y, int *pUpdateLine, int oldres)
  */
 static void Screen_ComparePalette(int y, int *pUpdateLine)
 {
-	bool bPaletteChanged = false;
 	int i;
 
 	/* Did write to palette in this or previous frame? */
 	if (((HBLPaletteMasks[y]|pFrameBuffer->HBLPaletteMasks[y])&PALETTEMASK_PALETTE)!=0)
 	{
 		/* Check and update ones which changed */
-		for (i = 0; i < 16; i++)
+		if (HBLPaletteMasks[y]&PALETTEMASK_PALETTE)
 		{
-			if (HBLPaletteMasks[y]&(1<<i))        /* Update changes in ST palette */
-				HBLPalette[i] = HBLPalettes[(y*16)+i];
+			for (i = 0; i < 16; i++)
+			{
+				if (HBLPaletteMasks[y]&(1<<i))        /* Update changes in ST palette */
+					HBLPalette[i] = HBLPalettes[(y*16)+i];
+			}
+			HBLPaletteHash = HBLPaletteHashes[y];
 		}
 		/* Now check with same palette from previous frame for any differences(may be changing palette back) */
-		for (i = 0; (i < 16) && (!bPaletteChanged); i++)
-		{
-			if (HBLPalette[i]!=pFrameBuffer->HBLPalettes[(y*16)+i])
-				bPaletteChanged = true;
-		}
-		if (bPaletteChanged)
+		if (HBLPaletteHash != pFrameBuffer->HBLPaletteHashes[y])
 			*pUpdateLine |= PALETTEMASK_UPDATEPAL;
 		else
 			*pUpdateLine &= ~PALETTEMASK_UPDATEPAL;
@@ -1146,6 +1272,7 @@ static int Screen_ComparePaletteMask(int res)
 			/* Copy palette and mask for next frame */
 			memcpy(&pFrameBuffer->HBLPalettes[y*16],HBLPalette,sizeof(short int)*16);
 			pFrameBuffer->HBLPaletteMasks[y] = HBLPaletteMasks[y];
+			pFrameBuffer->HBLPaletteHashes[y] = HBLPaletteHash;
 		}
 		/* Did mix/have medium resolution? */
 		if (bLowMedMix || (res & ST_MEDIUM_RES_BIT))
@@ -1176,7 +1303,7 @@ static void Screen_SetFullUpdateMask(void)
  */
 static void Screen_SetConvertDetails(void)
 {
-	pSTScreen = pFrameBuffer->pSTScreen;          /* Source in ST memory */
+	pSTScreenConvert = pFrameBuffer->pSTScreen;   /* Source in ST memory */
 	pSTScreenCopy = pFrameBuffer->pSTScreenCopy;  /* Previous ST screen */
 	pPCScreenDest = sdlscrn->pixels;              /* Destination PC screen */
 
@@ -1186,6 +1313,8 @@ static void Screen_SetConvertDetails(void)
 	pPCScreenDest += PCScreenOffsetY * PCScreenBytesPerLine + PCScreenOffsetX * (sdlscrn->format->BitsPerPixel/8);
 
 	pHBLPalettes = pFrameBuffer->HBLPalettes;     /* HBL palettes pointer */
+	pConvertHBLPalettes = pHBLPalettes;           /* (video.c moves pHBLPalettes during next frame) */
+	pConvertHBLPaletteMasks = HBLPaletteMasks;
 	/* Not in TV-Mode? Then double up on Y: */
 	bScrDoubleY = !(ConfigureParams.Screen.nMonitorType == MONITOR_TYPE_TV);
 
@@ -1229,6 +1358,118 @@ static void Screen_SetConvertDetails(void)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Set the VDI screen rows which can differ from the previous converted
+ * screen, for the next frame.  Other rows are skipped by the VDI screen
+ * conversion, unless it needs to do a full update.
+ */
+void Screen_SetVDIChangedRows(int nFirst, int nEnd)
+{
+	nVDIChangedFirstRow = nFirst;
+	nVDIChangedEndRow = nEnd;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return first VDI screen row to convert and set *pEnd to the row after
+ * the last one.  PC screen destination is moved to the first row.
+ */
+static int Screen_GetVDIRows(bool bFullUpdate, int *pEnd)
+{
+	int first = 0, end = VDIHeight;
+
+	if (!bFullUpdate)
+	{
+		if (nVDIChangedFirstRow > first)
+			first = nVDIChangedFirstRow;
+		if (nVDIChangedEndRow < end)
+			end = nVDIChangedEndRow;
+	}
+	if (end < first)
+		end = first;
+	pPCScreenDest += first * PCScreenBytesPerLine;
+	*pEnd = end;
+	return first;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Called by the VDI screen conversion for the rows it changes.
+ */
+static inline void Screen_VDIRowChanged(int y)
+{
+	bScreenContentsChanged = true;
+	if (y < nVDIUpdateFirstRow)
+		nVDIUpdateFirstRow = y;
+	if (y >= nVDIUpdateEndRow)
+		nVDIUpdateEndRow = y + 1;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Set function to which the ST low and medium resolution frames are
+ * given before converting them, NULL to always convert them.
+ */
+void Screen_SetRawFrameHook(SCREEN_RAWFRAME_FUNC pFunc)
+{
+	pRawFrameHook = pFunc;
+	Screen_SetFullUpdate();
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Give the frame to pRawFrameHook when it can be shown without the given
+ * conversion routine (not VDI, mono, 8-bit or Spec512 modes).
+ * Return true if the hook did show it.
+ */
+static bool Screen_DrawRawFrame(void (*pDrawFunction)(void))
+{
+	SCREEN_RAWFRAME Frame;
+	int y;
+
+	if (!pRawFrameHook || bUseVDIRes || bUseHighRes)
+		return false;
+
+	Frame.bWide = true;
+	if (pDrawFunction == ConvertLowRes_320x16Bit || pDrawFunction == ConvertLowRes_320x32Bit)
+		Frame.bWide = false;
+	else if (pDrawFunction != ConvertLowRes_640x16Bit && pDrawFunction != ConvertLowRes_640x32Bit
+	         && pDrawFunction != ConvertMediumRes_640x16Bit && pDrawFunction != ConvertMediumRes_640x32Bit)
+		return false;
+
+	y = STScreenStartHorizLine;
+	Frame.pScreen = pSTScreenConvert + STScreenLineOffset[y] + STScreenLeftSkipBytes;
+	Frame.pPalettes = pConvertHBLPalettes + (y << 4);
+	Frame.pPaletteMasks = pConvertHBLPaletteMasks + y;
+	Frame.nPitch = SCREENBYTES_LINE;
+	Frame.nWidthBytes = STScreenWidthBytes;
+	Frame.nLines = STScreenEndHorizLine - y;
+	Frame.nOffsetX = PCScreenOffsetX;
+	Frame.nOffsetY = PCScreenOffsetY;
+	Frame.bDoubleY = bScrDoubleY;
+
+	if (pRawFrameHook(&Frame))
+	{
+		bRawFrameShown = true;
+		return true;
+	}
+
+	/* Host screen doesn't contain the previous frames */
+	if (bRawFrameShown)
+	{
+		Screen_SetFullUpdateMask();
+		Screen_ClearScreen();
+		bRawFrameShown = false;
+	}
+	return false;
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Lock full-screen for drawing
@@ -1260,12 +1501,10 @@ static void Screen_UnLock(void)
 
 /*-----------------------------------------------------------------------*/
 /**
- * Blit our converted ST screen to window/full-screen
+ * Show the updated screen areas in window/full-screen
  */
-static void Screen_Blit(SDL_Rect *sbar_rect)
+static void Screen_UpdateRects(SDL_Rect *sbar_rect)
 {
-	unsigned char *pTmpScreen;
-
 #if 0	/* double buffering cannot be used with partial screen updates */
 # if NUM_FRAMEBUFFERS > 1
 	if (bInFullScreen && (sdlscrn->flags & SDL_DOUBLEBUF))
@@ -1281,16 +1520,36 @@ static void Screen_Blit(SDL_Rect *sbar_rect)
 # endif
 #endif
 	{
-		int count = 1;
+		int count = 0;
 		SDL_Rect rects[2];
-		rects[0] = STScreenRect;
-		if (sbar_rect)
+		if (nVDIUpdateFirstRow < 0)
+		{
+			rects[count++] = STScreenRect;
+		}
+		else if (nVDIUpdateFirstRow < nVDIUpdateEndRow)
 		{
-			rects[1] = *sbar_rect;
-			count = 2;
+			/* only the converted VDI screen rows */
+			rects[count] = STScreenRect;
+			rects[count].y = PCScreenOffsetY + nVDIUpdateFirstRow;
+			rects[count++].h = nVDIUpdateEndRow - nVDIUpdateFirstRow;
 		}
-		SDL_UpdateRects(sdlscrn, count, rects);
+		if (sbar_rect)
+			rects[count++] = *sbar_rect;
+		if (count)
+			SDL_UpdateRects(sdlscrn, count, rects);
 	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Blit our converted ST screen to window/full-screen
+ */
+static void Screen_Blit(SDL_Rect *sbar_rect)
+{
+	unsigned char *pTmpScreen;
+
+	Screen_UpdateRects(sbar_rect);
 
 	/* Swap copy/raster buffers in screen. */
 	pTmpScreen = pFrameBuffer->pSTScreenCopy;
@@ -1299,11 +1558,151 @@ static void Screen_Blit(SDL_Rect *sbar_rect)
 }
 
 
+#if SCREEN_THREAD
+/*-----------------------------------------------------------------------*/
+/**
+ * Wait until the render thread has converted the frame handed to it.
+ */
+static void Screen_RenderWait(void)
+{
+	pthread_mutex_lock(&render_thread_lock);
+	while (pRenderFunction)
+		pthread_cond_wait(&render_thread_cond, &render_thread_lock);
+	pthread_mutex_unlock(&render_thread_lock);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Render thread : run the conversion routine of the frame handed to it.
+ */
+static void *Screen_RenderThreadFunc(void *arg)
+{
+	void (*pFunc)(void);
+
+	pthread_mutex_lock(&render_thread_lock);
+	for (;;)
+	{
+		while (!pRenderFunction && !bRenderThreadQuit)
+			pthread_cond_wait(&render_thread_cond, &render_thread_lock);
+		if (bRenderThreadQuit)
+			break;
+		pFunc = pRenderFunction;
+		pthread_mutex_unlock(&render_thread_lock);
+
+		CALL_VAR(pFunc);
+
+		pthread_mutex_lock(&render_thread_lock);
+		pRenderFunction = NULL;
+		pthread_cond_broadcast(&render_thread_cond);
+	}
+	pthread_mutex_unlock(&render_thread_lock);
+	return NULL;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Hand the frame set up by Screen_DrawFrame() to the render thread,
+ * if its conversion routine doesn't need the emulation state.
+ * Return false if the frame has to be converted by the caller.
+ */
+static bool Screen_RenderDefer(void (*pDrawFunction)(void), bool bForceFlip)
+{
+	Uint8 *pTmpScreen;
+
+	if (!bRenderThreadActive || bForceFlip || bRecordingAvi
+	    || pDrawFunction != ScreenDrawFunctionsNormal[STRes]
+	    || sdlscrn->format->BitsPerPixel == 8)
+		return false;
+
+	/* The masks are cleared and rebuilt while next frame is emulated */
+	memcpy(RenderPaletteMasks, HBLPaletteMasks, sizeof(RenderPaletteMasks));
+	pConvertHBLPaletteMasks = RenderPaletteMasks;
+
+	/* Emulation goes on in the spare buffer, while the render thread
+	 * reads the current and previous ones. Current one is the previous
+	 * one of next frame, and the previous one the next spare. */
+	pTmpScreen = pFrameBuffer->pSTScreenRender;
+	pFrameBuffer->pSTScreenRender = pFrameBuffer->pSTScreenCopy;
+	pFrameBuffer->pSTScreenCopy = pFrameBuffer->pSTScreen;
+	pFrameBuffer->pSTScreen = pTmpScreen;
+
+	bRenderPending = true;
+	pthread_mutex_lock(&render_thread_lock);
+	pRenderFunction = pDrawFunction;
+	pthread_cond_broadcast(&render_thread_cond);
+	pthread_mutex_unlock(&render_thread_lock);
+	return true;
+}
+#endif
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Wait for the render thread and show the frame it converted, before
+ * accessing the screen surface from the emulation thread.
+ */
+void Screen_RenderSync(void)
+{
+#if SCREEN_THREAD
+	SDL_Rect *sbar_rect;
+
+	if (!bRenderPending)
+		return;
+	Screen_RenderWait();
+	bRenderPending = false;
+
+	Screen_UnLock();
+	Statusbar_OverlayBackup(sdlscrn);
+	sbar_rect = Statusbar_Update(sdlscrn, false);
+	if (bScreenContentsChanged || sbar_rect)
+		Screen_UpdateRects(sbar_rect);
+#endif
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Enable/disable converting the screen on its own host thread.
+ */
+void Screen_EnableRenderThread(bool bEnable)
+{
+#if SCREEN_THREAD
+	if (bEnable == bRenderThreadActive)
+		return;
+
+	if (bEnable)
+	{
+		bRenderThreadQuit = false;
+		pRenderFunction = NULL;
+		if (pthread_create(&render_thread, NULL, Screen_RenderThreadFunc, NULL) != 0)
+		{
+			Log_Printf(LOG_WARN, "Failed to create render thread, converting screen inline.\n");
+			return;
+		}
+		bRenderThreadActive = true;
+	}
+	else
+	{
+		Screen_RenderSync();
+		pthread_mutex_lock(&render_thread_lock);
+		bRenderThreadQuit = true;
+		pthread_cond_broadcast(&render_thread_cond);
+		pthread_mutex_unlock(&render_thread_lock);
+		pthread_join(render_thread, NULL);
+		bRenderThreadActive = false;
+	}
+#endif
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Draw ST screen to window/full-screen framebuffer
  * @param  bForceFlip  Force screen update, even if contents did not change
- * @return  true if screen contents changed
+ * @return  true if screen contents changed (false if the frame was handed
+ *          to the render thread, it's then shown on next call)
  */
 static bool Screen_DrawFrame(bool bForceFlip)
 {
@@ -1312,6 +1711,9 @@ static bool Screen_DrawFrame(bool bForceFlip)
 	static bool bPrevFrameWasSpec512 = false;
 	SDL_Rect *sbar_rect;
 
+	/* Show previous frame, if it was converted on the render thread */
+	Screen_RenderSync();
+
 	/* Scan palette/resolution masks for each line and build up palette/difference tables */
 	new_res = Screen_ComparePaletteMask(STRes);
 	/* Do require palette? Check if changed and update */
@@ -1343,6 +1745,9 @@ static bool Screen_DrawFrame(bool bForceFlip)
 		if (bUseVDIRes)
 		{
 			pDrawFunction = ScreenDrawFunctionsVDI[VDIRes];
+			/* Converted rows are collected by the VDI conversion */
+			nVDIUpdateFirstRow = bForceFlip ? -1 : VDIHeight;
+			nVDIUpdateEndRow = 0;
 		}
 		else
 		{
@@ -1375,8 +1780,28 @@ static bool Screen_DrawFrame(bool bForceFlip)
 			}
 		}
 
+		if (pDrawFunction && Screen_DrawRawFrame(pDrawFunction))
+		{
+			Stats_Add(STATS_SCREEN_LINES, STScreenEndHorizLine - STScreenStartHorizLine);
+			bScreenContentsChanged = true;
+			pDrawFunction = NULL;
+		}
+
+#if SCREEN_THREAD
+		if (pDrawFunction && Screen_RenderDefer(pDrawFunction, bForceFlip))
+		{
+			Stats_Add(STATS_SCREEN_LINES, STScreenEndHorizLine - STScreenStartHorizLine);
+			/* Screen stays locked until the frame is shown */
+			pFrameBuffer->bFullUpdate = false;
+			pFrameBuffer->OverscanModeCopy = OverscanMode;
+			return false;
+		}
+#endif
 		if (pDrawFunction)
+		{
 			CALL_VAR(pDrawFunction);
+			Stats_Add(STATS_SCREEN_LINES, STScreenEndHorizLine - STScreenStartHorizLine);
+		}
 
 		/* Unlock screen */
 		Screen_UnLock();
@@ -1388,12 +1813,15 @@ static bool Screen_DrawFrame(bool bForceFlip)
 		/* Clear flags, remember type of overscan as if change need screen full update */
 		pFrameBuffer->bFullUpdate = false;
 		pFrameBuffer->OverscanModeCopy = OverscanMode;
+		nVDIChangedFirstRow = 0;
+		nVDIChangedEndRow = MAX_VDI_HEIGHT;
 
 		/* And show to user */
 		if (bScreenContentsChanged || bForceFlip || sbar_rect)
 		{
 			Screen_Blit(sbar_rect);
 		}
+		nVDIUpdateFirstRow = -1;
 
 		return bScreenContentsChanged;
 	}
@@ -1450,7 +1878,7 @@ static int AdjustLinePaletteRemap(int y)
 	int i;
 
 	/* Copy palette and convert to RGB in display format */
-	actHBLPal = pHBLPalettes + (y<<4);    /* offset in palette */
+	actHBLPal = pConvertHBLPalettes + (y<<4);    /* offset in palette */
 	for (i=0; i<16; i++)
 	{
 #if SDL_BYTEORDER == SDL_BIG_ENDIAN
@@ -1459,7 +1887,11 @@ static int AdjustLinePaletteRemap(int y)
 		STRGBPalette[i] = ST2RGB[*actHBLPal++];
 #endif
 	}
-	ScrUpdateFlag = HBLPaletteMasks[y];
+#if CONVERT_SIMD
+	if (bConvertUseSimd)
+		Convert_SimdSetPalette(STRGBPalette);
+#endif
+	ScrUpdateFlag = pConvertHBLPaletteMasks[y];
 	return ScrUpdateFlag;
 }
 
@@ -1487,6 +1919,11 @@ static void Convert_StartFrame(void)
 /* lookup tables and conversion macros */
 #include "convert/macros.h"
 
+/* Conversion routines read the screen data from their own pointer, as
+ * video.c moves pSTScreen during next frame while the render thread
+ * converts this one */
+#define pSTScreen pSTScreenConvert
+
 /* Conversion routines */
 
 #include "convert/low320x8.c"		/* LowRes To 320xH x 8-bit color */
@@ -1511,3 +1948,5 @@ static void Convert_StartFrame(void)
 #include "convert/vdi16.c"		/* VDI x 16 color */
 #include "convert/vdi4.c"		/* VDI x 4 color */
 #include "convert/vdi2.c"		/* VDI x 2 color */
+
+#undef pSTScreen
@@ -5,6 +5,11 @@
   or at your option any later version. Read the file gpl.txt for details.
 
   Screen Snapshots.
+
+  The emulation thread only copies the shown surface as 24-bit RGB rows
+  into a FileWriter job, the PNG (or BMP) encoding and the file writing
+  happen on the writer threads. The same path saves every Nth frame in
+  the batch mode (--screenshot-every), for regression captures.
 */
 const char ScreenSnapShot_fileid[] = "Hatari screenSnapShot.c : " __DATE__ " " __TIME__;
 
@@ -13,7 +18,9 @@ const char ScreenSnapShot_fileid[] = "Hatari screenSnapShot.c : " __DATE__ " " _
 #include <string.h>
 #include "main.h"
 #include "configuration.h"
+#include "fileWriter.h"
 #include "log.h"
+#include "options.h"
 #include "paths.h"
 #include "screen.h"
 #include "screenSnapShot.h"
@@ -23,11 +30,29 @@ const char ScreenSnapShot_fileid[] = "Hatari screenSnapShot.c : " __DATE__ " " _
 #if HAVE_LIBPNG
 # include <png.h>
 # include <assert.h>
-# include "pixel_convert.h"				/* inline functions */
 #endif
+#include "pixel_convert.h"				/* inline functions */
+
+#if HAVE_LIBPNG
+#define SNAPSHOT_EXT "png"
+#else
+#define SNAPSHOT_EXT "bmp"
+#endif
+
 
+/* Screenshot queued to the file writer, RGB rows follow */
+typedef struct {
+	char szFileName[FILENAME_MAX];
+	int nNumber;
+	int nWidth;
+	int nHeight;
+} SNAPSHOT_JOB;
 
 static int nScreenShots = 0;                /* Number of screen shots saved */
+static int nLastQueued;                     /* Number of last queued screen shot */
+static volatile int nLastWritten;           /* and of last one written (by writer thread) */
+static int nBatchFrames;                    /* VBLs since last batch screenshot */
+static bool bSavePending;                   /* save next frame drawn in headless mode */
 
 
 /*-----------------------------------------------------------------------*/
@@ -42,6 +67,9 @@ static void ScreenSnapShot_GetNum(void)
 	struct dirent *file;
 
 	nScreenShots = 0;
+	/* files of the queued screen shots may not be there yet */
+	if (nLastQueued != nLastWritten)
+		nScreenShots = nLastQueued;
 	if (workingdir == NULL)  return;
 
 	file = readdir(workingdir);
@@ -71,31 +99,6 @@ static void ScreenSnapShot_GetNum(void)
 
 
 #if HAVE_LIBPNG
-/**
- * Save given SDL surface as PNG. Return png file size > 0 for success.
- */
-static int ScreenSnapShot_SavePNG(SDL_Surface *surface, const char *filename)
-{
-	FILE *fp = NULL;
-	int ret, bottom;
-  
-	fp = fopen(filename, "wb");
-	if (!fp)
-		return -1;
-
-	if (ConfigureParams.Screen.bCrop)
-		bottom = Statusbar_GetHeight();
-	else
-		bottom = 0;
-
-	/* default compression/filter and configured cropping */
-	ret = ScreenSnapShot_SavePNG_ToFile(surface, fp, -1, -1, 0, 0, 0, bottom);
-
-	fclose (fp);
-	return ret;					/* >0 if OK, -1 if error */
-}
-
-
 /**
  * Save given SDL surface as PNG in an already opened FILE, eventually cropping some borders.
  * Return png file size > 0 for success.
@@ -210,37 +213,288 @@ png_cleanup:
 #endif
 
 
+#if HAVE_LIBPNG
+/**
+ * libpng write callback, append data to the encoded job.
+ */
+static void ScreenSnapShot_WritePNGData(png_structp png_ptr, png_bytep data, png_size_t length)
+{
+	FILEWRITER_BUFFER *pOut = png_get_io_ptr(png_ptr);
+	Uint8 *pDest = FileWriter_Reserve(pOut, length);
+
+	if (!pDest)
+		png_error(png_ptr, "out of memory");
+	memcpy(pDest, data, length);
+	pOut->nSize += length;
+}
+
+static void ScreenSnapShot_FlushPNGData(png_structp png_ptr)
+{
+}
+
+
+/**
+ * Encode the RGB rows of a screenshot job as PNG. Return false on error.
+ */
+static bool ScreenSnapShot_EncodePNG(const SNAPSHOT_JOB *pJob, FILEWRITER_BUFFER *pOut)
+{
+	const Uint8 *pRows = (const Uint8 *)(pJob + 1);
+	png_infop info_ptr = NULL;
+	png_structp png_ptr;
+	png_text pngtext;
+	char key[] = "Title";
+	char text[] = "Hatari screenshot";
+	int y;
+
+	png_ptr = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+	if (!png_ptr)
+		return false;
+	info_ptr = png_create_info_struct(png_ptr);
+	if (!info_ptr || setjmp(png_jmpbuf(png_ptr)))
+	{
+		png_destroy_write_struct(&png_ptr, info_ptr ? &info_ptr : NULL);
+		return false;
+	}
+
+	png_set_write_fn(png_ptr, pOut, ScreenSnapShot_WritePNGData, ScreenSnapShot_FlushPNGData);
+	png_set_IHDR(png_ptr, info_ptr, pJob->nWidth, pJob->nHeight, 8, PNG_COLOR_TYPE_RGB,
+		     PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT,
+		     PNG_FILTER_TYPE_DEFAULT);
+
+	pngtext.key = key;
+	pngtext.text = text;
+	pngtext.compression = PNG_TEXT_COMPRESSION_NONE;
+#ifdef PNG_iTXt_SUPPORTED
+	pngtext.lang = NULL;
+#endif
+	png_set_text(png_ptr, info_ptr, &pngtext, 1);
+	png_write_info(png_ptr, info_ptr);
+
+	for (y = 0; y < pJob->nHeight; y++)
+		png_write_row(png_ptr, (png_bytep)pRows + y * pJob->nWidth * 3);
+	png_write_end(png_ptr, info_ptr);
+
+	png_destroy_write_struct(&png_ptr, &info_ptr);
+	return true;
+}
+#endif
+
+
+/**
+ * Store little endian value for the BMP headers.
+ */
+static void ScreenSnapShot_StoreU32(Uint8 *p, Uint32 val)
+{
+	p[0] = val;
+	p[1] = val >> 8;
+	p[2] = val >> 16;
+	p[3] = val >> 24;
+}
+
+
+/**
+ * Encode the RGB rows of a screenshot job as 24-bit BMP. Return false on error.
+ */
+static bool ScreenSnapShot_EncodeBMP(const SNAPSHOT_JOB *pJob, FILEWRITER_BUFFER *pOut)
+{
+	const Uint8 *pSrc;
+	int nLineSize = (pJob->nWidth * 3 + 3) & ~3;	/* lines are 4 bytes aligned */
+	int nImageSize = nLineSize * pJob->nHeight;
+	Uint8 *p, *pDest;
+	int x, y;
+
+	p = FileWriter_Reserve(pOut, 54 + nImageSize);
+	if (!p)
+		return false;
+
+	/* file header and BITMAPINFOHEADER */
+	memset(p, 0, 54);
+	p[0] = 'B';
+	p[1] = 'M';
+	ScreenSnapShot_StoreU32(p + 2, 54 + nImageSize);
+	ScreenSnapShot_StoreU32(p + 10, 54);
+	ScreenSnapShot_StoreU32(p + 14, 40);
+	ScreenSnapShot_StoreU32(p + 18, pJob->nWidth);
+	ScreenSnapShot_StoreU32(p + 22, pJob->nHeight);
+	p[26] = 1;					/* planes */
+	p[28] = 24;					/* bits per pixel */
+	ScreenSnapShot_StoreU32(p + 34, nImageSize);
+	ScreenSnapShot_StoreU32(p + 38, 2835);		/* 72 DPI */
+	ScreenSnapShot_StoreU32(p + 42, 2835);
+
+	/* BGR lines, bottom-up */
+	for (y = 0; y < pJob->nHeight; y++)
+	{
+		pSrc = (const Uint8 *)(pJob + 1) + (pJob->nHeight - 1 - y) * pJob->nWidth * 3;
+		pDest = p + 54 + y * nLineSize;
+		for (x = 0; x < pJob->nWidth; x++, pSrc += 3)
+		{
+			*pDest++ = pSrc[2];
+			*pDest++ = pSrc[1];
+			*pDest++ = pSrc[0];
+		}
+		memset(pDest, 0, nLineSize - pJob->nWidth * 3);
+	}
+
+	pOut->nSize += 54 + nImageSize;
+	return true;
+}
+
+
+/**
+ * File writer encode function: PNG if possible, otherwise BMP. Errors are
+ * reported here and the job left empty, so that they don't stop the
+ * recordings using the same writer.
+ */
+static bool ScreenSnapShot_Encode(Uint8 *pData, int nSize, FILEWRITER_BUFFER *pOut, void *pParam)
+{
+	SNAPSHOT_JOB *pJob = (SNAPSHOT_JOB *)pData;
+	char *pExt = strrchr(pJob->szFileName, '.');
+
+#if HAVE_LIBPNG
+	if (ScreenSnapShot_EncodePNG(pJob, pOut))
+		return true;
+	pOut->nSize = 0;
+#endif
+	strcpy(pExt, ".bmp");
+	if (!ScreenSnapShot_EncodeBMP(pJob, pOut))
+	{
+		fprintf(stderr, "Screen dump failed!\n");
+		pOut->nSize = 0;
+	}
+	return true;
+}
+
+
+/**
+ * File writer write function, pParam is the job.
+ */
+static bool ScreenSnapShot_Write(Uint8 *pData, int nSize, void *pParam)
+{
+	SNAPSHOT_JOB *pJob = pParam;
+	FILE *fp;
+
+	nLastWritten = pJob->nNumber;
+	if (!nSize)
+		return true;
+
+	fp = fopen(pJob->szFileName, "wb");
+	if (fp && fwrite(pData, 1, nSize, fp) == (size_t)nSize)
+		fprintf(stderr, "Screen dump saved to: %s\n", pJob->szFileName);
+	else
+		fprintf(stderr, "Screen dump failed!\n");
+	if (fp)
+		fclose(fp);
+	return true;
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
- * Save screen shot file with filename like 'grab0000.[png|bmp]',
+ * Queue the shown screen to be saved with filename like 'grab0000.[png|bmp]',
  * 'grab0001.[png|bmp]', etc... Whether screen shots are saved as BMP
- * or PNG depends on Hatari configuration.
+ * or PNG depends on Hatari configuration. The file is written later,
+ * by the file writer.
  */
-void ScreenSnapShot_SaveScreen(void)
+static void ScreenSnapShot_QueueScreen(void)
 {
-	char *szFileName = malloc(FILENAME_MAX);
+	SDL_PixelFormat *fmt = sdlscrn->format;
+	SNAPSHOT_JOB *pJob;
+	Uint8 *pSrc, *pDest;
+	int y, w, h;
 
-	if (!szFileName)  return;
+	Screen_RenderSync();
+
+	w = sdlscrn->w;
+	h = sdlscrn->h;
+	if (ConfigureParams.Screen.bCrop)
+		h -= Statusbar_GetHeight();
+
+	pJob = (SNAPSHOT_JOB *)FileWriter_Begin(sizeof(SNAPSHOT_JOB) + w * h * 3);
+	if (!pJob)
+	{
+		fprintf(stderr, "Screen dump failed!\n");
+		return;
+	}
 
 	ScreenSnapShot_GetNum();
 	/* Create our filename */
 	nScreenShots++;
-#if HAVE_LIBPNG
-	/* try first PNG */
-	sprintf(szFileName,"%s/grab%4.4d.png", Paths_GetWorkingDir(), nScreenShots);
-	if (ScreenSnapShot_SavePNG(sdlscrn, szFileName) > 0)
+	nLastQueued = pJob->nNumber = nScreenShots;
+	snprintf(pJob->szFileName, sizeof(pJob->szFileName), "%s/grab%4.4d.%s",
+	         Paths_GetWorkingDir(), nScreenShots, SNAPSHOT_EXT);
+	pJob->nWidth = w;
+	pJob->nHeight = h;
+
+	/* Copy the surface as 24-bit RGB */
+	if (SDL_MUSTLOCK(sdlscrn))
+		SDL_LockSurface(sdlscrn);
+	pSrc = sdlscrn->pixels;
+	pDest = (Uint8 *)(pJob + 1);
+	for (y = 0; y < h; y++)
 	{
-		fprintf(stderr, "Screen dump saved to: %s\n", szFileName);
-		free(szFileName);
-		return;
+		switch (fmt->BytesPerPixel)
+		{
+		case 1:
+			PixelConvert_8to24Bits(pDest, pSrc, w, fmt->palette->colors);
+			break;
+		case 2:
+			PixelConvert_16to24Bits(pDest, (Uint16 *)pSrc, w, fmt);
+			break;
+		case 3:
+			memcpy(pDest, pSrc, w * 3);
+			break;
+		case 4:
+			PixelConvert_32to24Bits(pDest, (Uint32 *)pSrc, w, fmt);
+			break;
+		}
+		pSrc += sdlscrn->pitch;
+		pDest += w * 3;
 	}
-#endif
-	sprintf(szFileName,"%s/grab%4.4d.bmp", Paths_GetWorkingDir(), nScreenShots);
-	if (SDL_SaveBMP(sdlscrn, szFileName))
-		fprintf(stderr, "Screen dump failed!\n");
-	else
-		fprintf(stderr, "Screen dump saved to: %s\n", szFileName);
+	if (SDL_MUSTLOCK(sdlscrn))
+		SDL_UnlockSurface(sdlscrn);
 
-	free(szFileName);
+	FileWriter_CommitEncode(ScreenSnapShot_Encode, ScreenSnapShot_Write, pJob);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Save screen shot. In headless mode the shown screen is out of date,
+ * so the next frame is drawn and saved instead.
+ */
+void ScreenSnapShot_SaveScreen(void)
+{
+	if (bVideoHeadless)
+	{
+		bVideoFrameRequested = true;
+		bSavePending = true;
+		return;
+	}
+	ScreenSnapShot_QueueScreen();
 }
 
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Called on each VBL, after the frame is drawn: save the requested frame
+ * in headless mode and a screenshot every ScreenShotEvery frames when the
+ * batch mode is enabled.
+ */
+void ScreenSnapShot_UpdateBatch(void)
+{
+	/* the request is cleared when the frame is drawn */
+	if (bSavePending && !bVideoFrameRequested)
+	{
+		bSavePending = false;
+		ScreenSnapShot_QueueScreen();
+	}
+
+	if (ScreenShotEvery <= 0)
+		return;
+	if (++nBatchFrames >= ScreenShotEvery)
+	{
+		nBatchFrames = 0;
+		ScreenSnapShot_SaveScreen();
+	}
+}
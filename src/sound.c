@@ -74,6 +74,7 @@
 const char Sound_fileid[] = "Hatari sound.c : " __DATE__ " " __TIME__;
 
 #include <SDL_types.h>
+#include <math.h>
 
 #include "main.h"
 #include "audio.h"
@@ -88,12 +89,19 @@ const char Sound_fileid[] = "Hatari sound.c : " __DATE__ " " __TIME__;
 #include "psg.h"
 #include "sound.h"
 #include "screen.h"
+#include "perf.h"
+#include "stats.h"
 #include "video.h"
 #include "wavFormat.h"
 #include "ymFormat.h"
 #include "avi_record.h"
 #include "clocks_timings.h"
 
+#if HAVE_PTHREAD_H
+#define SOUND_THREAD 1
+#include <pthread.h>
+#endif
+
 
 
 /*--------------------------------------------------------------*/
@@ -162,6 +170,15 @@ static ymu16 ymout5_u16[32][32][32];
 /* Same table, after conversion to signed results (same pointer, with different type) */
 static yms16 *ymout5 = (yms16 *)ymout5_u16;
 
+/* Compact form of the circuit analysed model for YM_COMPACT_MIXING : the model */
+/* only depends on the sum of the 3 voices' conductances, so we keep the conductance */
+/* of each 5 bits volume and the signed output for YM_COMPACT_STEPS+1 sums, which is */
+/* linearly interpolated. Both tables use 2.2 KB instead of the 64 KB of ymout5[] */
+#define YM_COMPACT_STEPS	1024
+#define YM_COMPACT_FRAC_BITS	8
+static ymu32 YmCompactConductance[ 32 ];				/* in 1/2^YM_COMPACT_FRAC_BITS steps */
+static yms16 YmCompactOut[ YM_COMPACT_STEPS + 2 ];		/* +1 for the interpolation of the last step */
+
 
 
 /*--------------------------------------------------------------*/
@@ -216,11 +233,34 @@ static ymu16	Vol3Voices = 0;				/* volume 0-0x1f for voices having a constant vo
 							/* volume is set to 0 if voice has an envelope in EnvMask3Voices */
 
 
+/*--------------------------------------------------------------*/
+/* Band limited step (BLEP) synthesis. Each change of the output	*/
+/* level is placed at its exact position between two samples,	*/
+/* which is known from the fractional part of the tone, noise	*/
+/* and envelope counters, by adding a band limited step instead	*/
+/* of a hard one. The output is delayed by YM_BLEP_HALF samples	*/
+/* so that the steps can start before their edge.		*/
+/*--------------------------------------------------------------*/
+
+#define YM_BLEP_HALF		8			/* half length of a step, in samples */
+#define YM_BLEP_TAPS		(2*YM_BLEP_HALF)
+#define YM_BLEP_PHASES		64			/* sub-sample positions of an edge */
+#define YM_BLEP_CUTOFF		0.45			/* cutoff frequency relative to replay frequency */
+#define YM_BLOCK_SAMPLES	512			/* samples generated at once */
+
+static yms32	YmBlepTable[ YM_BLEP_PHASES ][ YM_BLEP_TAPS ];	/* band limited minus hard step, 1<<15 = 1.0 */
+static yms32	YmBlepCorr[ YM_BLOCK_SAMPLES + YM_BLEP_TAPS ];	/* corrections for upcoming output samples */
+static ymsample	YmBlepDelay[ YM_BLEP_HALF ];		/* hard step samples not output yet */
+static ymsample	YmBlepLevel;				/* level of the last sample */
+static ymu32	YmBlepPhase;				/* position of the edge ending the last run */
+
+
 /* Global variables that can be changed/read from other parts of Hatari */
 Uint8		SoundRegs[ 14 ];
 
 int		YmVolumeMixing = YM_TABLE_MIXING;
 bool		UseLowPassFilter = false;
+bool		UseBlepSynthesis = false;
 
 bool		bEnvelopeFreqFlag;			/* Cleared each frame for YM saving */
 
@@ -229,13 +269,87 @@ int		nGeneratedSamples;			/* Generated samples since audio buffer update */
 static int	ActiveSndBufIdx;			/* Current working index into above mix buffer */
 static int	ActiveSndBufIdxAvi;			/* Current working index to save an AVI audio frame */
 
-static yms64	SamplesPerFrame_unrounded = 0;		/* Number of samples for the current VBL, with simulated fractional part */
+static yms64	SamplesPerFrame_unrounded = 0;		/* Remainder of the samples per VBL division, carried to the next VBL */
 static int 	SamplesPerFrame;			/* Number of samples to generate for the current VBL */
 static int	CurrentSamplesNb = 0;			/* Number of samples already generated for the current VBL */
 
 bool		Sound_BufferIndexNeedReset = false;
 
 
+/*--------------------------------------------------------------*/
+/* Journal of YM register writes. While only the YM2149 is	*/
+/* heard, register writes are just stored with the sample	*/
+/* position they take effect at, and the samples are generated	*/
+/* in one go by the next Sound_Update() (usually at the VBL).	*/
+/*--------------------------------------------------------------*/
+
+#define SOUND_JOURNAL_SIZE	4096
+
+typedef struct
+{
+	int	nSamplePos;				/* sample of the VBL at which the write happened */
+	Uint8	Reg;
+	Uint8	Data;
+} SOUND_JOURNAL_ENTRY;
+
+static SOUND_JOURNAL_ENTRY	SoundJournal[ SOUND_JOURNAL_SIZE ];
+static int	nSoundJournalEntries;
+
+/* Run of journaled volume writes (digi-drums, sample replay) which	*/
+/* YM2149_DoSamples() applies itself while generating the samples,	*/
+/* instead of generating the samples up to each write separately.	*/
+static const SOUND_JOURNAL_ENTRY	*pVolumeStream;
+static int	nVolumeStreamLeft;
+static int	nVolumeStreamPos;			/* sample of the VBL generated next */
+
+
+/*--------------------------------------------------------------*/
+/* Audio worker thread. When all YM writes of a VBL were	*/
+/* journaled, the samples of that VBL are generated by the	*/
+/* worker while the emulation goes on with the next VBL.	*/
+/* Generated samples (from the worker or from the emulation	*/
+/* thread) are then passed to the audio output through a single	*/
+/* producer / single consumer ring, which needs no locking.	*/
+/* The SDL audio callback always reads this ring, libretro only	*/
+/* when the worker is active (else it reads the mix buffer at	*/
+/* the end of the frame, on the emulation thread).		*/
+/* Before the emulation thread accesses the sound state,	*/
+/* Sound_ThreadSync() waits for the worker to be done.		*/
+/*--------------------------------------------------------------*/
+
+#define SOUND_RING_SIZE		8192			/* stereo samples, must be a power of 2 */
+
+#if SOUND_THREAD || ( !defined(__LIBRETRO__) && defined(__GNUC__) )
+#define SOUND_RING_LOAD(x)	__atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+#define SOUND_RING_STORE(x,v)	__atomic_store_n(&(x), (v), __ATOMIC_RELEASE)
+#else
+#define SOUND_RING_LOAD(x)	(x)
+#define SOUND_RING_STORE(x,v)	((x) = (v))
+#endif
+
+static Sint16	SoundRing[ SOUND_RING_SIZE ][2];
+static Uint32	nSoundRingWrite;			/* free running, only changed by producer */
+static Uint32	nSoundRingRead;				/* free running, only changed by consumer */
+
+static bool	bSoundThreadActive;			/* worker exists, output goes through ring */
+static bool	bSoundOnThread;				/* samples are generated by worker */
+
+#if SOUND_THREAD
+static pthread_t	sound_thread;
+static pthread_mutex_t	sound_thread_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t	sound_thread_cond = PTHREAD_COND_INITIALIZER;
+static bool	bSoundThreadBusy;			/* worker renders SoundJob (protected by lock) */
+static bool	bSoundThreadQuit;			/* worker should exit (protected by lock) */
+
+static struct
+{
+	SOUND_JOURNAL_ENTRY	Journal[ SOUND_JOURNAL_SIZE ];
+	int	nEntries;
+	int	nSamplesPos;				/* samples of the VBL to have in the end */
+} SoundJob;
+#endif
+
+
 /*--------------------------------------------------------------*/
 /* Local functions prototypes					*/
 /*--------------------------------------------------------------*/
@@ -245,7 +359,9 @@ static ymsample	PWMaliasFilter		(ymsample x0);
 
 static void	interpolate_volumetable	(ymu16 volumetable[32][32][32]);
 
+static void	YM2149_ModelConductances(double conductance_[32]);
 static void	YM2149_BuildModelVolumeTable(ymu16 volumetable[32][32][32]);
+static void	YM2149_BuildCompactVolumeTable(unsigned int Level, bool DoCenter);
 static void	YM2149_BuildLinearVolumeTable(ymu16 volumetable[32][32][32]);
 static void	YM2149_Normalise_5bit_Table(ymu16 *in_5bit , yms16 *out_5bit, unsigned int Level, bool DoCenter);
 
@@ -258,10 +374,21 @@ static ymu32	YM2149_RndCompute	(void);
 static ymu32	Ym2149_ToneStepCompute	(ymu8 rHigh , ymu8 rLow);
 static ymu32	Ym2149_NoiseStepCompute	(ymu8 rNoise);
 static ymu32	Ym2149_EnvStepCompute	(ymu8 rHigh , ymu8 rLow);
-static ymsample	YM2149_NextSample	(void);
-
-static int	Sound_SetSamplesPassed(bool FillFrame);
+static void	Ym2149_StepTablesInit	(void);
+static void	YM2149_BuildBlepTable	(void);
+static void	YM2149_DoSamples	(ymsample *pBuf , int nSamples);
+static void	YM2149_BlepSamples	(ymsample *pBuf , int nSamples);
+static void	YM2149_FilterSamples	(ymsample *pBuf , int nSamples , bool bSubsonic);
+
+static int	Sound_GetSamplesPos(bool FillFrame);
+static void	Sound_GenerateUpTo(int SamplesPos);
 static void	Sound_GenerateSamples(int SamplesToGenerate);
+static void	Sound_ReplayJournal(const SOUND_JOURNAL_ENTRY *pJournal, int nEntries, int SamplesPos);
+static bool	Sound_IsYmOnly(void);
+static void	Sound_RingPush(void);
+static bool	Sound_RingIsOutput(void);
+static int	Sound_InitialSamples(void);
+static bool	Sound_ThreadDefer(void);
 
 
 
@@ -382,6 +509,28 @@ static ymsample	PWMaliasFilter(ymsample x0)
 }
 
 
+/**
+ * Apply the output filters to a block of YM samples. Each filter runs
+ * over the whole block in its own loop, so that the filter choice is
+ * made once per block and the filter state can stay in registers.
+ */
+static void	YM2149_FilterSamples(ymsample *pBuf , int nSamples , bool bSubsonic)
+{
+	int	i;
+
+	if ( UseLowPassFilter )
+		for ( i = 0 ; i < nSamples ; i++ )
+			pBuf[ i ] = LowPassFilter ( pBuf[ i ] );
+	else if ( !UseBlepSynthesis )			/* band limited steps don't alias */
+		for ( i = 0 ; i < nSamples ; i++ )
+			pBuf[ i ] = PWMaliasFilter ( pBuf[ i ] );
+
+	if ( bSubsonic )
+		for ( i = 0 ; i < nSamples ; i++ )
+			pBuf[ i ] = Subsonic_IIR_HPF_Left ( pBuf[ i ] );
+}
+
+
 
 /*--------------------------------------------------------------*/
 /* Build the volume conversion table used to simulate the	*/
@@ -502,15 +651,14 @@ static void	YM2149_BuildLinearVolumeTable(ymu16 volumetable[32][32][32])
  * being summed (this effectively doubles the pull-up resistance).
  */
 
-static void	YM2149_BuildModelVolumeTable(ymu16 volumetable[32][32][32])
-{
 #define MaxVol  65535.0               /* Normal Mode Maximum value in table */
 #define FOURTH2 1.19                  /* Fourth root of two from YM2149 */
 #define WARP    1.666666666666666667  /* measured as 1.65932 from 46602 */
 
+static void	YM2149_ModelConductances(double conductance_[32])
+{
 	double conductance;
-	double conductance_[32];
-	int	i, j, k;
+	int	i;
 
 /**
  * YM2149 and R8=1k follows (2^-1/4)^(n-31) better when 2 voices are
@@ -536,6 +684,14 @@ static void	YM2149_BuildModelVolumeTable(ymu16 volumetable[32][32][32])
 		conductance = 1.0/(1.0-1.0/FOURTH2/(1.0/conductance + 1.0))-1.0;
 	}
 	conductance_[0] = 1.0e-8; /* Avoid divide by zero */
+}
+
+static void	YM2149_BuildModelVolumeTable(ymu16 volumetable[32][32][32])
+{
+	double conductance_[32];
+	int	i, j, k;
+
+	YM2149_ModelConductances(conductance_);
 
 /**
  * YM2149 AC + DC components model:
@@ -614,6 +770,50 @@ static void	YM2149_Normalise_5bit_Table(ymu16 *in_5bit , yms16 *out_5bit, unsign
 
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Build the compact version of the circuit analysed model, used with
+ * YM_COMPACT_MIXING : as the model only depends on the sum of the 3 voices'
+ * conductances, we only need the conductance of each volume and a table
+ * of the output for YM_COMPACT_STEPS+1 values of this sum.
+ * The output is normalised like YM2149_Normalise_5bit_Table() does with the
+ * model table. For all 32*32*32 volumes, the interpolated result is within
+ * 2 of the normalised model table.
+ */
+
+static void	YM2149_BuildCompactVolumeTable(unsigned int Level, bool DoCenter)
+{
+	double	conductance_[32];
+	double	sum, scale;
+	int	i, tmp, res, Max;
+
+	YM2149_ModelConductances(conductance_);
+
+	/* 3 voices with volume 31 give the last step */
+	scale = (YM_COMPACT_STEPS << YM_COMPACT_FRAC_BITS) / (3.0 * conductance_[31]);
+	for (i = 0; i < 32; i++)
+		YmCompactConductance[i] = (ymu32)(0.5 + conductance_[i] * scale);
+
+	Max = (ymu16)(0.5+(MaxVol*WARP)/(1.0 + 1.0/(3.0 * conductance_[31])));
+	for (i = 0; i <= YM_COMPACT_STEPS; i++)
+	{
+		sum = 3.0 * conductance_[31] * i / YM_COMPACT_STEPS;
+		if (sum < conductance_[0])
+			sum = conductance_[0];		/* Avoid divide by zero */
+		tmp = (ymu16)(0.5+(MaxVol*WARP)/(1.0 + 1.0/sum));
+		res = tmp * Level / Max;
+
+		if ( DoCenter )
+			res -= (Level+1)>>1;
+
+		YmCompactOut[i] = res;
+	}
+	YmCompactOut[YM_COMPACT_STEPS+1] = YmCompactOut[YM_COMPACT_STEPS];
+}
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Precompute all 16 possible envelopes.
@@ -657,6 +857,29 @@ static void	YM2149_EnvBuild ( void )
 
 static void	Ym2149_BuildVolumeTable(void)
 {
+	/* The tables only depend on these, they're kept as long as they don't change */
+	static int	BuiltMixing = -1;
+	static unsigned int BuiltLevel;
+	unsigned int	Level = YM_OUTPUT_LEVEL;
+
+	/* On STE/TT, we use YM_OUTPUT_LEVEL>>1 to avoid overflow with DMA sound */
+	if ( (ConfigureParams.System.nMachineType == MACHINE_STE) || (ConfigureParams.System.nMachineType == MACHINE_MEGA_STE)
+		|| (ConfigureParams.System.nMachineType == MACHINE_TT) )
+		Level = YM_OUTPUT_LEVEL>>1;
+
+	if ( BuiltMixing == YmVolumeMixing && BuiltLevel == Level )
+		return;
+	Sound_ThreadSync();				/* audio worker uses the tables */
+	BuiltMixing = YmVolumeMixing;
+	BuiltLevel = Level;
+
+	/* The compact model doesn't use the 32*32*32 table at all */
+	if ( YmVolumeMixing == YM_COMPACT_MIXING )
+	{
+		YM2149_BuildCompactVolumeTable ( Level , YM_OUTPUT_CENTERED );
+		return;
+	}
+
 	/* Depending on the volume mixing method, we use a table based on real measures */
 	/* or a table based on a linear volume mixing. */
 	if ( YmVolumeMixing == YM_MODEL_MIXING )
@@ -667,12 +890,48 @@ static void	Ym2149_BuildVolumeTable(void)
 		YM2149_BuildLinearVolumeTable(ymout5_u16);	/* combine the 32 possible volumes */
 
 	/* Normalise/center the values (convert from u16 to s16) */
-	/* On STE/TT, we use YM_OUTPUT_LEVEL>>1 to avoid overflow with DMA sound */
-	if ( (ConfigureParams.System.nMachineType == MACHINE_STE) || (ConfigureParams.System.nMachineType == MACHINE_MEGA_STE)
-		|| (ConfigureParams.System.nMachineType == MACHINE_TT) )
-		YM2149_Normalise_5bit_Table ( ymout5_u16[0][0] , ymout5 , (YM_OUTPUT_LEVEL>>1) , YM_OUTPUT_CENTERED );
-	else
-		YM2149_Normalise_5bit_Table ( ymout5_u16[0][0] , ymout5 , YM_OUTPUT_LEVEL , YM_OUTPUT_CENTERED );
+	YM2149_Normalise_5bit_Table ( ymout5_u16[0][0] , ymout5 , Level , YM_OUTPUT_CENTERED );
+}
+
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Build the table of band limited step corrections. A band limited step
+ * is the integral of a Blackman windowed sinc of YM_BLEP_TAPS samples.
+ * For an edge at 'phase' / YM_BLEP_PHASES samples before output sample
+ * YM_BLEP_HALF, each entry is the difference between this step and the
+ * hard step at that sample, so that adding the entries to the hard step
+ * output gives a band limited output.
+ */
+
+static void	YM2149_BuildBlepTable(void)
+{
+	const int	Over = 16;			/* integration steps per phase */
+	const int	Steps = YM_BLEP_TAPS * YM_BLEP_PHASES * Over;
+	double		Integral[ YM_BLEP_TAPS * YM_BLEP_PHASES + 1 ];
+	double		t , w , sum = 0;
+	int		i , phase , j;
+
+	/* integrate the windowed sinc over -YM_BLEP_HALF .. +YM_BLEP_HALF */
+	Integral[ 0 ] = 0;
+	for ( i = 0 ; i < Steps ; i++ )
+	{
+		t = ( i + 0.5 ) / ( YM_BLEP_PHASES * Over ) - YM_BLEP_HALF;
+		w = 0.42 + 0.5 * cos ( M_PI * t / YM_BLEP_HALF ) + 0.08 * cos ( 2 * M_PI * t / YM_BLEP_HALF );
+		sum += w * ( t == 0 ? 2 * YM_BLEP_CUTOFF : sin ( 2 * M_PI * YM_BLEP_CUTOFF * t ) / ( M_PI * t ) );
+		if ( ( i + 1 ) % Over == 0 )
+			Integral[ ( i + 1 ) / Over ] = sum;
+	}
+
+	for ( phase = 0 ; phase < YM_BLEP_PHASES ; phase++ )
+		for ( j = 0 ; j < YM_BLEP_TAPS ; j++ )
+		{
+			/* position of output sample j relative to the edge, in 1/YM_BLEP_PHASES */
+			i = j * YM_BLEP_PHASES + phase;
+			w = Integral[ i ] / sum - ( j >= YM_BLEP_HALF ? 1 : 0 );
+			YmBlepTable[ phase ][ j ] = (yms32)floor ( w * 32768 + 0.5 );
+		}
 }
 
 
@@ -685,8 +944,16 @@ static void	Ym2149_BuildVolumeTable(void)
 
 static void	Ym2149_Init(void)
 {
-	/* Build the 16 envelope shapes */
-	YM2149_EnvBuild();
+	static bool	bConstTablesBuilt = false;
+
+	/* Build the 16 envelope shapes and the band limited steps, */
+	/* they never change and are kept if the emulation is restarted */
+	if ( !bConstTablesBuilt )
+	{
+		YM2149_EnvBuild();
+		YM2149_BuildBlepTable();
+		bConstTablesBuilt = true;
+	}
 
 	/* Build the volume conversion table */
 	Ym2149_BuildVolumeTable();
@@ -721,6 +988,13 @@ static void	Ym2149_Reset(void)
 
 	envShape = 0;
 	envPos = 0;
+
+	nSoundJournalEntries = 0;
+
+	memset ( YmBlepCorr , 0 , sizeof ( YmBlepCorr ) );
+	memset ( YmBlepDelay , 0 , sizeof ( YmBlepDelay ) );
+	YmBlepLevel = 0;
+	YmBlepPhase = 0;
 }
 
 
@@ -893,6 +1167,74 @@ static ymu32	Ym2149_EnvStepCompute(ymu8 rHigh , ymu8 rLow)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Sample replay code writes the period registers thousands of times per
+ * second, so instead of a 64 bit division on each write, the tone, noise
+ * and envelope steps of all periods are computed once per replay freq.
+ * The tables are rebuilt on the first register write after the replay
+ * freq changed.
+ */
+
+static ymu32	ToneStepTable[4096];
+static ymu32	NoiseStepTable[32];
+static ymu32	EnvStepTable[65536];
+static int	StepTablesFreq;				/* replay freq of the tables, 0 when not built */
+
+static void	Ym2149_StepTablesInit(void)
+{
+	int	per;
+
+	for ( per = 0 ; per < 4096 ; per++ )
+		ToneStepTable[ per ] = Ym2149_ToneStepCompute ( per >> 8 , per & 0xff );
+	for ( per = 0 ; per < 32 ; per++ )
+		NoiseStepTable[ per ] = Ym2149_NoiseStepCompute ( per );
+	for ( per = 0 ; per < 65536 ; per++ )
+		EnvStepTable[ per ] = Ym2149_EnvStepCompute ( per >> 8 , per & 0xff );
+
+	StepTablesFreq = YM_REPLAY_FREQ;
+}
+
+static inline ymu32	Ym2149_ToneStep(ymu8 rHigh , ymu8 rLow)
+{
+	return ToneStepTable[ ( (rHigh&15) << 8 ) | rLow ];
+}
+
+static inline ymu32	Ym2149_NoiseStep(ymu8 rNoise)
+{
+	return NoiseStepTable[ rNoise&0x1f ];
+}
+
+static inline ymu32	Ym2149_EnvStep(ymu8 rHigh , ymu8 rLow)
+{
+	return EnvStepTable[ ( rHigh << 8 ) | rLow ];
+}
+
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Convert the 3 volumes (5 bits each) into a sample, with the 64 KB ymout5[]
+ * table or with the compact model (which stays in the L1 cache).
+ */
+static inline ymsample	YM2149_Mix3Voices(ymu16 Tone3Voices)
+{
+	ymu32	sum;
+	int	i, frac;
+
+	if ( YmVolumeMixing != YM_COMPACT_MIXING )
+		return ymout5[ Tone3Voices ];
+
+	sum = YmCompactConductance[ Tone3Voices & YM_MASK_1VOICE ]
+	    + YmCompactConductance[ ( Tone3Voices >> 5 ) & YM_MASK_1VOICE ]
+	    + YmCompactConductance[ ( Tone3Voices >> 10 ) & YM_MASK_1VOICE ];
+	i = sum >> YM_COMPACT_FRAC_BITS;
+	frac = sum & ( ( 1 << YM_COMPACT_FRAC_BITS ) - 1 );
+
+	return YmCompactOut[ i ] + ( ( ( YmCompactOut[ i+1 ] - YmCompactOut[ i ] ) * frac ) >> YM_COMPACT_FRAC_BITS );
+}
+
+
 
 /*-----------------------------------------------------------------------*/
 /**
@@ -908,6 +1250,24 @@ static ymu32	Ym2149_EnvStepCompute(ymu8 rHigh , ymu8 rLow)
  * to all 0 bits or all 1 bits using a '-'
  */
 
+/**
+ * Apply the volume stream writes which happen at or before the next
+ * generated sample, and return how many samples can be generated before
+ * the next one, at most 'nMax'.
+ */
+static inline int	YM2149_VolumeStreamApply(int nMax)
+{
+	while ( nVolumeStreamLeft > 0 && pVolumeStream->nSamplePos <= nVolumeStreamPos )
+	{
+		Sound_WriteReg ( pVolumeStream->Reg , pVolumeStream->Data );
+		pVolumeStream++;
+		nVolumeStreamLeft--;
+	}
+	if ( nVolumeStreamLeft > 0 && pVolumeStream->nSamplePos - nVolumeStreamPos < nMax )
+		return pVolumeStream->nSamplePos - nVolumeStreamPos;
+	return nMax;
+}
+
 #ifndef NEWSTEP
 static ymsample	YM2149_NextSample(void)
 {
@@ -959,7 +1319,7 @@ static ymsample	YM2149_NextSample(void)
 
 	/* D/A conversion of the 3 volumes into a sample using a precomputed conversion table */
 
-	sample = ymout5[ Tone3Voices ];			/* 16 bits signed value */
+	sample = YM2149_Mix3Voices ( Tone3Voices );	/* 16 bits signed value */
 
 
 	/* Increment positions */
@@ -972,80 +1332,217 @@ static ymsample	YM2149_NextSample(void)
 	if ( envPos >= (3*32) << 24 )			/* blocks 0, 1 and 2 were used (envPos 0 to 95) */
 		envPos -= (2*32) << 24;			/* replay/loop blocks 1 and 2 (envPos 32 to 95) */
 
-	/* Apply low pass filter ? */
-	if ( UseLowPassFilter )
-		return LowPassFilter(sample);
-	else
-		return PWMaliasFilter(sample);
+	return sample;
+}
+
+static void	YM2149_DoSamples(ymsample *pBuf , int nSamples)
+{
+	while ( nSamples-- > 0 )
+	{
+		YM2149_VolumeStreamApply ( 1 );
+		nVolumeStreamPos++;
+		*pBuf++ = YM2149_NextSample();
+	}
+}
+
+/* edges positions aren't tracked by this version, keep hard steps */
+static void	YM2149_BlepSamples(ymsample *pBuf , int nSamples)
+{
 }
 #else
-static ymsample	YM2149_NextSample(void)
+/**
+ * Return how many samples 'pos' can be incremented by 'step' before its
+ * integer part (bits 24-31) changes, at most 'nMax'. For tone positions
+ * this is the number of samples until the next edge of the square wave.
+ */
+static inline int	YM2149_SamplesToEdge(ymu32 pos , ymu32 step , int nMax)
+{
+	ymu32		n;
+
+	if ( step == 0 )
+		return nMax;
+	n = ( 0xffffff - (pos & 0xffffff) ) / step + 1;
+	return n < (ymu32)nMax ? (int)n : nMax;
+}
+
+/**
+ * If 'pos' changes its integer part after exactly 'run' samples, store
+ * into pPhase how long before that sample the change happened, in
+ * 1/YM_BLEP_PHASES of a sample.
+ */
+static inline void	YM2149_EdgePhase(ymu32 pos , ymu32 step , int run , ymu32 *pPhase)
+{
+	ymu32		left;
+
+	if ( step == 0 )
+		return;
+	left = 0x1000000 - (pos & 0xffffff);
+	if ( ( left - 1 ) / step + 1 == (ymu32)run )
+		*pPhase = ( (yms64)run * step - left ) * YM_BLEP_PHASES / step;
+}
+
+/**
+ * Compute 'nSamples' unfiltered samples into pBuf.
+ * The output only changes on a tone, noise or envelope edge, so instead
+ * of stepping all the counters for each sample, the samples until the
+ * next edge are written in one go and the counters then advanced by
+ * the whole run. Edges of voices whose tone is disabled in the mixer,
+ * envelope steps when no voice uses the envelope and noise changes
+ * when no voice uses the noise don't change the output and don't end
+ * a run.
+ */
+static void	YM2149_DoSamples(ymsample *pBuf , int nSamples)
 {
 	ymsample	sample;
 	ymu32		bt;
 	ymu32		bn;
 	ymu16		Env3Voices;			/* 0x00CCBBAA */
 	ymu16		Tone3Voices;			/* 0x00CCBBAA */
+	yms64		env , noise;
+	bool		bNoiseUsed;
+	int		run , i , k = 0;
 
+	bNoiseUsed = ( mixerNA & mixerNB & mixerNC ) == 0 || noiseStep >= 1<<24;
 
-	/* Noise value : 0 or 0xffff */
-	if ( noisePos&0xff000000 )			/* integer part > 0 */
+	while ( nSamples > 0 )
 	{
-		currentNoise = YM2149_RndCompute();
-		noisePos &= 0xffffff;			/* keep fractional part of noisePos */
-	}
-	bn = currentNoise;				/* 0 or 0xffff */
+		/* Volume writes due now, the next one also ends the run */
+		run = YM2149_VolumeStreamApply ( nSamples );
 
-	/* Get the 5 bits volume corresponding to the current envelope's position */
-	Env3Voices = YmEnvWaves[ envShape ][ envPos>>24 ];	/* integer part of envPos is in bits 24-31 */
-	Env3Voices &= EnvMask3Voices;			/* only keep volumes for voices using envelope */
+		/* Noise value : 0 or 0xffff */
+		if ( noisePos&0xff000000 )		/* integer part > 0 */
+		{
+			currentNoise = YM2149_RndCompute();
+			noisePos &= 0xffffff;		/* keep fractional part of noisePos */
+		}
+		bn = currentNoise;			/* 0 or 0xffff */
 
-//fprintf ( stderr , "env %x %x %x\n" , Env3Voices , envStep , envPos );
+		/* Get the 5 bits volume corresponding to the current envelope's position */
+		Env3Voices = YmEnvWaves[ envShape ][ envPos>>24 ];	/* integer part of envPos is in bits 24-31 */
+		Env3Voices &= EnvMask3Voices;		/* only keep volumes for voices using envelope */
 
-	/* Tone3Voices will contain the output state of each voice : 0 or 0x1f */
-	bt = -( (posA>>24) & 1);			/* 0 if bit24=0 or 0xffffffff if bit24=1 */
-	bt = (bt | mixerTA) & (bn | mixerNA);		/* 0 or 0xffff */
-	Tone3Voices = bt & YM_MASK_1VOICE;		/* 0 or 0x1f */
-	bt = -( (posB>>24) & 1);
-	bt = (bt | mixerTB) & (bn | mixerNB);
-	Tone3Voices |= ( bt & YM_MASK_1VOICE ) << 5;
-	bt = -( (posC>>24) & 1);
-	bt = (bt | mixerTC) & (bn | mixerNC);
-	Tone3Voices |= ( bt & YM_MASK_1VOICE ) << 10;
+		/* Tone3Voices will contain the output state of each voice : 0 or 0x1f */
+		bt = -( (posA>>24) & 1);		/* 0 if bit24=0 or 0xffffffff if bit24=1 */
+		bt = (bt | mixerTA) & (bn | mixerNA);	/* 0 or 0xffff */
+		Tone3Voices = bt & YM_MASK_1VOICE;	/* 0 or 0x1f */
+		bt = -( (posB>>24) & 1);
+		bt = (bt | mixerTB) & (bn | mixerNB);
+		Tone3Voices |= ( bt & YM_MASK_1VOICE ) << 5;
+		bt = -( (posC>>24) & 1);
+		bt = (bt | mixerTC) & (bn | mixerNC);
+		Tone3Voices |= ( bt & YM_MASK_1VOICE ) << 10;
 
-	/* Combine fixed volumes and envelope volumes and keep the resulting */
-	/* volumes depending on the output state of each voice (0 or 0x1f) */
-	Tone3Voices &= ( Env3Voices | Vol3Voices );
+		/* Combine fixed volumes and envelope volumes and keep the resulting */
+		/* volumes depending on the output state of each voice (0 or 0x1f) */
+		Tone3Voices &= ( Env3Voices | Vol3Voices );
 
-	/* D/A conversion of the 3 volumes into a sample using a precomputed conversion table */
+		/* D/A conversion of the 3 volumes into a sample using a precomputed conversion table */
 
-	if (stepA == 0  &&  (Tone3Voices & YM_MASK_A) > 1)
-		Tone3Voices -= 1;     /* Voice A AC component removed; Transient DC component remains */
+		if (stepA == 0  &&  (Tone3Voices & YM_MASK_A) > 1)
+			Tone3Voices -= 1;     /* Voice A AC component removed; Transient DC component remains */
 
-	if (stepB == 0  &&  (Tone3Voices & YM_MASK_B) > 1<<5)
-		Tone3Voices -= 1<<5;  /* Voice B AC component removed; Transient DC component remains */
+		if (stepB == 0  &&  (Tone3Voices & YM_MASK_B) > 1<<5)
+			Tone3Voices -= 1<<5;  /* Voice B AC component removed; Transient DC component remains */
 
-	if (stepC == 0  &&  (Tone3Voices & YM_MASK_C) > 1<<10)
-		Tone3Voices -= 1<<10; /* Voice C AC component removed; Transient DC component remains */
+		if (stepC == 0  &&  (Tone3Voices & YM_MASK_C) > 1<<10)
+			Tone3Voices -= 1<<10; /* Voice C AC component removed; Transient DC component remains */
 
-	sample = ymout5[ Tone3Voices ];			/* 16 bits signed value */
+		sample = YM2149_Mix3Voices ( Tone3Voices );	/* 16 bits signed value */
 
+		/* Add a band limited step for a level change */
+		if ( UseBlepSynthesis && sample != YmBlepLevel )
+		{
+			yms32 delta = sample - YmBlepLevel;
+			for ( i = 0 ; i < YM_BLEP_TAPS ; i++ )
+				YmBlepCorr[ k + i ] += ( delta * YmBlepTable[ YmBlepPhase ][ i ] ) >> 15;
+		}
+		YmBlepLevel = sample;
+
+		/* Find how long this output lasts */
+		if ( bNoiseUsed )
+			run = YM2149_SamplesToEdge ( noisePos , noiseStep , run );
+		if ( !mixerTA )
+			run = YM2149_SamplesToEdge ( posA , stepA , run );
+		if ( !mixerTB )
+			run = YM2149_SamplesToEdge ( posB , stepB , run );
+		if ( !mixerTC )
+			run = YM2149_SamplesToEdge ( posC , stepC , run );
+		if ( EnvMask3Voices )
+			run = YM2149_SamplesToEdge ( envPos , envStep , run );
+
+		/* Find where the edge ending this run is */
+		if ( UseBlepSynthesis )
+		{
+			YmBlepPhase = 0;
+			if ( bNoiseUsed )
+				YM2149_EdgePhase ( noisePos , noiseStep , run , &YmBlepPhase );
+			if ( !mixerTA )
+				YM2149_EdgePhase ( posA , stepA , run , &YmBlepPhase );
+			if ( !mixerTB )
+				YM2149_EdgePhase ( posB , stepB , run , &YmBlepPhase );
+			if ( !mixerTC )
+				YM2149_EdgePhase ( posC , stepC , run , &YmBlepPhase );
+			if ( EnvMask3Voices )
+				YM2149_EdgePhase ( envPos , envStep , run , &YmBlepPhase );
+		}
 
-	/* Increment positions */
-	posA += stepA;
-	posB += stepB;
-	posC += stepC;
-	noisePos += noiseStep;
+		for ( i = 0 ; i < run ; i++ )
+			pBuf[ i ] = sample;
+		pBuf += run;
+		nSamples -= run;
+		k += run;
+		nVolumeStreamPos += run;
+
+		/* Increment positions */
+		posA += run * stepA;
+		posB += run * stepB;
+		posC += run * stepC;
+		if ( bNoiseUsed )
+			noisePos += run * noiseStep;
+		else
+		{
+			/* noise isn't heard, only keep the random generator in step */
+			noise = noisePos + (yms64)( run - 1 ) * noiseStep;
+			for ( i = noise >> 24 ; i > 0 ; i-- )
+				currentNoise = YM2149_RndCompute();
+			noisePos = ( noise & 0xffffff ) + noiseStep;
+		}
 
-	envPos += envStep;
-	if ( envPos >= (3*32) << 24 )			/* blocks 0, 1 and 2 were used (envPos 0 to 95) */
-		envPos -= (2*32) << 24;			/* replay/loop blocks 1 and 2 (envPos 32 to 95) */
+		env = envPos + (yms64)run * envStep;
+		if ( env >= (3*32) << 24 )		/* blocks 0, 1 and 2 were used (envPos 0 to 95) */
+			env = ( (32 << 24) + ( env - (32 << 24) ) % ( (2*32) << 24 ) );	/* replay/loop blocks 1 and 2 (envPos 32 to 95) */
+		envPos = env;
+	}
+}
 
-	/* Apply low pass filter ? */
-	if ( UseLowPassFilter )
-		return LowPassFilter(sample);
-	else
-		return PWMaliasFilter(sample);
+/**
+ * Turn a block of hard step samples from YM2149_DoSamples() into the
+ * band limited output, delayed by YM_BLEP_HALF samples.
+ * YmBlepCorr[] holds the corrections for the block and the following
+ * YM_BLEP_TAPS samples.
+ */
+static void	YM2149_BlepSamples(ymsample *pBuf , int nSamples)
+{
+	ymsample	Hist[ YM_BLEP_HALF + YM_BLOCK_SAMPLES ];
+	yms32		val;
+	int		i;
+
+	memcpy ( Hist , YmBlepDelay , sizeof ( YmBlepDelay ) );
+	memcpy ( Hist + YM_BLEP_HALF , pBuf , nSamples * sizeof ( ymsample ) );
+
+	for ( i = 0 ; i < nSamples ; i++ )
+	{
+		val = Hist[ i ] + YmBlepCorr[ i ];
+		if ( val > 32767 )
+			val = 32767;
+		else if ( val < -32768 )
+			val = -32768;
+		pBuf[ i ] = val;
+	}
+
+	memcpy ( YmBlepDelay , Hist + nSamples , sizeof ( YmBlepDelay ) );
+	memmove ( YmBlepCorr , YmBlepCorr + nSamples , YM_BLEP_TAPS * sizeof ( yms32 ) );
+	memset ( YmBlepCorr + YM_BLEP_TAPS , 0 , nSamples * sizeof ( yms32 ) );
 }
 #endif
 
@@ -1062,47 +1559,50 @@ static ymsample	YM2149_NextSample(void)
 #endif
 void	Sound_WriteReg( int reg , Uint8 data )
 {
+	if ( StepTablesFreq != YM_REPLAY_FREQ )
+		Ym2149_StepTablesInit();
+
 	switch (reg)
 	{
 		case 0:
 			SoundRegs[0] = data;
-			stepA = Ym2149_ToneStepCompute ( SoundRegs[1] , SoundRegs[0] );
+			stepA = Ym2149_ToneStep ( SoundRegs[1] , SoundRegs[0] );
 			if (!stepA) posA = 1u<<BIT_SHIFT;		// Assume output always 1 if 0 period (for Digi-sample)
 			break;
 
 		case 1:
 			SoundRegs[1] = data & 0x0f;
-			stepA = Ym2149_ToneStepCompute ( SoundRegs[1] , SoundRegs[0] );
+			stepA = Ym2149_ToneStep ( SoundRegs[1] , SoundRegs[0] );
 			if (!stepA) posA = 1u<<BIT_SHIFT;		// Assume output always 1 if 0 period (for Digi-sample)
 			break;
 
 		case 2:
 			SoundRegs[2] = data;
-			stepB = Ym2149_ToneStepCompute ( SoundRegs[3] , SoundRegs[2] );
+			stepB = Ym2149_ToneStep ( SoundRegs[3] , SoundRegs[2] );
 			if (!stepB) posB = 1u<<BIT_SHIFT;		// Assume output always 1 if 0 period (for Digi-sample)
 			break;
 
 		case 3:
 			SoundRegs[3] = data & 0x0f;
-			stepB = Ym2149_ToneStepCompute ( SoundRegs[3] , SoundRegs[2] );
+			stepB = Ym2149_ToneStep ( SoundRegs[3] , SoundRegs[2] );
 			if (!stepB) posB = 1u<<BIT_SHIFT;		// Assume output always 1 if 0 period (for Digi-sample)
 			break;
 
 		case 4:
 			SoundRegs[4] = data;
-			stepC = Ym2149_ToneStepCompute ( SoundRegs[5] , SoundRegs[4] );
+			stepC = Ym2149_ToneStep ( SoundRegs[5] , SoundRegs[4] );
 			if (!stepC) posC = 1u<<BIT_SHIFT;		// Assume output always 1 if 0 period (for Digi-sample)
 			break;
 
 		case 5:
 			SoundRegs[5] = data & 0x0f;
-			stepC = Ym2149_ToneStepCompute ( SoundRegs[5] , SoundRegs[4] );
+			stepC = Ym2149_ToneStep ( SoundRegs[5] , SoundRegs[4] );
 			if (!stepC) posC = 1u<<BIT_SHIFT;		// Assume output always 1 if 0 period (for Digi-sample)
 			break;
 
 		case 6:
 			SoundRegs[6] = data & 0x1f;
-			noiseStep = Ym2149_NoiseStepCompute ( SoundRegs[6] );
+			noiseStep = Ym2149_NoiseStep ( SoundRegs[6] );
 			if (!noiseStep)
 			{
 				noisePos = 0;
@@ -1167,12 +1667,12 @@ void	Sound_WriteReg( int reg , Uint8 data )
 
 		case 11:
 			SoundRegs[11] = data;
-			envStep = Ym2149_EnvStepCompute ( SoundRegs[12] , SoundRegs[11] );
+			envStep = Ym2149_EnvStep ( SoundRegs[12] , SoundRegs[11] );
 			break;
 
 		case 12:
 			SoundRegs[12] = data;
-			envStep = Ym2149_EnvStepCompute ( SoundRegs[12] , SoundRegs[11] );
+			envStep = Ym2149_EnvStep ( SoundRegs[12] , SoundRegs[11] );
 			break;
 
 		case 13:
@@ -1198,6 +1698,18 @@ void Sound_Init(void)
 	Ym2149_Init();
 
 	Sound_Reset();
+
+	Sound_EnableThread(ConfigureParams.Sound.bSoundThread);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Stop the audio worker thread (called when Hatari exits)
+ */
+void Sound_UnInit(void)
+{
+	Sound_EnableThread(false);
 }
 
 
@@ -1207,9 +1719,7 @@ void Sound_Init(void)
  */
 void Sound_Reset(void)
 {
-	/* Lock audio system before accessing variables which are used by the
-	 * callback function, too! */
-	Audio_Lock();
+	Sound_ThreadSync();
 
 	/* Clear sound mixing buffer: */
 	memset(MixBuffer, 0, sizeof(MixBuffer));
@@ -1220,17 +1730,16 @@ void Sound_Reset(void)
 
 	CompleteSndBufIdx = 0;
 	/* We do not start with 0 here to fake some initial samples: */
-	nGeneratedSamples = SoundBufferSize + SAMPLES_PER_FRAME;
+	nGeneratedSamples = Sound_InitialSamples();
 	ActiveSndBufIdx = nGeneratedSamples % MIXBUFFER_SIZE;
 	SamplesPerFrame = SAMPLES_PER_FRAME;
+	SamplesPerFrame_unrounded = 0;
 	CurrentSamplesNb = 0;
 	ActiveSndBufIdxAvi = ActiveSndBufIdx;
 //fprintf ( stderr , "Sound_Reset SoundBufferSize %d SAMPLES_PER_FRAME %d nGeneratedSamples %d , ActiveSndBufIdx %d\n" ,
 //	SoundBufferSize , SAMPLES_PER_FRAME, nGeneratedSamples , ActiveSndBufIdx );
 
 	Ym2149_Reset();
-
-	Audio_Unlock();
 }
 
 
@@ -1245,15 +1754,15 @@ void Sound_Reset(void)
  */
 void Sound_ResetBufferIndex(void)
 {
-	Audio_Lock();
-	nGeneratedSamples = SoundBufferSize + SAMPLES_PER_FRAME;
+	Sound_ThreadSync();
+	nGeneratedSamples = Sound_InitialSamples();
 	ActiveSndBufIdx =  (CompleteSndBufIdx + nGeneratedSamples) % MIXBUFFER_SIZE;
 	SamplesPerFrame = SAMPLES_PER_FRAME;
+	SamplesPerFrame_unrounded = 0;
 	CurrentSamplesNb = 0;
 	ActiveSndBufIdxAvi = ActiveSndBufIdx;
 //fprintf ( stderr , "Sound_ResetBufferIndex SoundBufferSize %d SAMPLES_PER_FRAME %d nGeneratedSamples %d , ActiveSndBufIdx %d\n" ,
 //	SoundBufferSize , SAMPLES_PER_FRAME, nGeneratedSamples , ActiveSndBufIdx );
-	Audio_Unlock();
 }
 
 
@@ -1263,6 +1772,15 @@ void Sound_ResetBufferIndex(void)
  */
 void Sound_MemorySnapShot_Capture(bool bSave)
 {
+	/* Apply journaled register writes before saving, drop them on restore */
+	if (bSave)
+		Sound_Update(false);
+	else
+	{
+		Sound_ThreadSync();
+		nSoundJournalEntries = 0;
+	}
+
 	/* Save/Restore details */
 	MemorySnapShot_Store(&stepA, sizeof(stepA));
 	MemorySnapShot_Store(&stepB, sizeof(stepB));
@@ -1299,17 +1817,18 @@ void Sound_MemorySnapShot_Capture(bool bSave)
 
 /*-----------------------------------------------------------------------*/
 /**
- * Find how many samples to generate and store in 'nSamplesToGenerate'
- * Also update sound cycles counter to store how many we actually did
- * so generates set amount each frame.
- * If FillFrame is true, this means we reach the end of the VBL and me must
- * add as many samples as necessary to get a total of SamplesPerFrame
- * for this VBL.
+ * Return how many samples should have been generated for the current VBL
+ * at this point. If we're called from the VBL interrupt (FillFrame==true),
+ * this is SamplesPerFrame, so that we have an exact total of
+ * SamplesPerFrame samples during a full VBL.
  */
-static int Sound_SetSamplesPassed(bool FillFrame)
+static int Sound_GetSamplesPos(bool FillFrame)
 {
 	int nSoundCycles;
-	int SamplesToGenerate;				/* How many samples are needed for this time-frame */
+	int SamplesPos;					/* How many samples are needed for this time-frame */
+
+	if ( FillFrame )
+		return SamplesPerFrame;
 
 	nSoundCycles = Cycles_GetCounter(CYCLES_COUNTER_VIDEO);
 
@@ -1317,47 +1836,80 @@ static int Sound_SetSamplesPassed(bool FillFrame)
 	/* 882/160256 samples per cpu clock cycle */
 
 	/* Total number of samples that we should have at this point of the VBL */
-	SamplesToGenerate = nSoundCycles * SamplesPerFrame
+	SamplesPos = nSoundCycles * SamplesPerFrame
 		/ ClocksTimings_GetCyclesPerVBL ( ConfigureParams.System.nMachineType , nScreenRefreshRate );
 
-//if (SamplesToGenerate > SamplesPerFrame )
-//fprintf ( stderr , "over run %d %d\n" , SamplesPerFrame , SamplesToGenerate );
+	if (SamplesPos > SamplesPerFrame)
+		SamplesPos = SamplesPerFrame;
 
-	if (SamplesToGenerate > SamplesPerFrame)
-		SamplesToGenerate = SamplesPerFrame;
+	return SamplesPos;
+}
 
-	SamplesToGenerate -= CurrentSamplesNb;		/* don't count samples that were already generated up to now */
-	if ( SamplesToGenerate < 0 )
-		SamplesToGenerate = 0;
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Generate samples until SamplesPos samples exist for the current VBL.
+ */
+static void Sound_GenerateUpTo(int SamplesPos)
+{
+	int SamplesToGenerate;
 
-	/* If we're called from the VBL interrupt (FillFrame==true), we must ensure we have */
-	/* an exact total of SamplesPerFrame samples during a full VBL (we take into account */
-	/* the samples that were already generated during this VBL) */
-	if ( FillFrame )
-	{
-		SamplesToGenerate = SamplesPerFrame - CurrentSamplesNb;	/* how many samples are missing to reach SamplesPerFrame */
-		if ( SamplesToGenerate < 0 )
-			SamplesToGenerate = 0;
-	}
+	SamplesToGenerate = SamplesPos - CurrentSamplesNb;	/* don't count samples that were already generated up to now */
+	if ( SamplesToGenerate <= 0 )
+		return;
 
 	/* Check we don't fill the sound's ring buffer before it's played by Audio_Callback()	*/
 	/* This should never happen, except if the system suffers major slowdown due to	other	*/
 	/* processes or if we run in fast forward mode.						*/
 	/* In the case of slowdown, we set Sound_BufferIndexNeedReset to "resync" the working	*/
 	/* buffer's index ActiveSndBufIdx with the system buffer's index CompleteSndBufIdx.	*/
-	/* In the case of fast forward, we do nothing here, Sound_BufferIndexNeedReset will be	*/
-	/* set when the user exits fast forward mode.						*/
+	/* In the case of fast forward (or headless mode), we do nothing here,			*/
+	/* Sound_BufferIndexNeedReset will be set when the user exits fast forward mode.	*/
 	if ( ( SamplesToGenerate > MIXBUFFER_SIZE - nGeneratedSamples ) && ( ConfigureParams.System.bFastForward == false )
-	    && ( ConfigureParams.Sound.bEnableSound == true ) )
+	    && !bVideoHeadless && ( ConfigureParams.Sound.bEnableSound == true ) )
 	{
 		Log_Printf ( LOG_WARN , "Your system is too slow, some sound samples were not correctly emulated\n" );
 		Sound_BufferIndexNeedReset = true;
 	}
 
-//fprintf ( stderr , "vbl %d hbl %d samp_gen %d / %d frac %lx\n" , nVBLs , nHBL , SamplesToGenerate , SamplesPerFrame , (long int)SamplesPerFrame_unrounded );
+	Sound_GenerateSamples( SamplesToGenerate );
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Generate YM samples into the mix buffer, both channels, from
+ * ActiveSndBufIdx on. Samples are computed and filtered in blocks in
+ * a local buffer. A block never crosses the end of the ring, so it's
+ * copied to the mix buffer as one contiguous span.
+ */
+static void Sound_GenerateYM(int SamplesToGenerate, bool bSubsonic)
+{
+	ymsample	YmBuffer[YM_BLOCK_SAMPLES];
+	Sint16		(*pMix)[2];
+	int		idx = ActiveSndBufIdx;
+	int		i, n;
 
-	return SamplesToGenerate;
+	while (SamplesToGenerate > 0)
+	{
+		n = SamplesToGenerate;
+		if (n > YM_BLOCK_SAMPLES)
+			n = YM_BLOCK_SAMPLES;
+		if (n > MIXBUFFER_SIZE - idx)
+			n = MIXBUFFER_SIZE - idx;
+
+		YM2149_DoSamples(YmBuffer, n);
+		if (UseBlepSynthesis)
+			YM2149_BlepSamples(YmBuffer, n);
+		YM2149_FilterSamples(YmBuffer, n, bSubsonic);
+
+		pMix = &MixBuffer[idx];
+		for (i = 0; i < n; i++)
+			pMix[i][0] = pMix[i][1] = YmBuffer[i];
+
+		idx = (idx + n) % MIXBUFFER_SIZE;
+		SamplesToGenerate -= n;
+	}
 }
 
 
@@ -1367,39 +1919,27 @@ static int Sound_SetSamplesPassed(bool FillFrame)
  */
 static void Sound_GenerateSamples(int SamplesToGenerate)
 {
-	int	i;
-	int	idx;
-
 	if (SamplesToGenerate <= 0)
 		return;
 
+	if (!bSoundOnThread)				/* worker's samples are counted when handing them over */
+		Stats_Add(STATS_AUDIO_SAMPLES, SamplesToGenerate);
+
 	if (ConfigureParams.System.nMachineType == MACHINE_FALCON)
 	{
-		for (i = 0; i < SamplesToGenerate; i++)
-		{
-			idx = (ActiveSndBufIdx + i) % MIXBUFFER_SIZE;
-			MixBuffer[idx][0] = MixBuffer[idx][1] = Subsonic_IIR_HPF_Left( YM2149_NextSample() );
-		}
+		Sound_GenerateYM(SamplesToGenerate, true);
  		/* If Falcon emulation, crossbar does the job */
  		Crossbar_GenerateSamples(ActiveSndBufIdx, SamplesToGenerate);
 	}
 	else if (ConfigureParams.System.nMachineType != MACHINE_ST)
 	{
-		for (i = 0; i < SamplesToGenerate; i++)
-		{
-			idx = (ActiveSndBufIdx + i) % MIXBUFFER_SIZE;
-			MixBuffer[idx][0] = MixBuffer[idx][1] = YM2149_NextSample();
-		}
+		Sound_GenerateYM(SamplesToGenerate, false);
  		/* If Ste or TT emulation, DmaSnd does mixing and filtering */
  		DmaSnd_GenerateSamples(ActiveSndBufIdx, SamplesToGenerate);
 	}
 	else if (ConfigureParams.System.nMachineType == MACHINE_ST)
 	{
-		for (i = 0; i < SamplesToGenerate; i++)
-		{
-			idx = (ActiveSndBufIdx + i) % MIXBUFFER_SIZE;
-			MixBuffer[idx][0] = MixBuffer[idx][1] = Subsonic_IIR_HPF_Left( YM2149_NextSample() );
-		}
+		Sound_GenerateYM(SamplesToGenerate, true);
  	}
 
 	ActiveSndBufIdx = (ActiveSndBufIdx + SamplesToGenerate) % MIXBUFFER_SIZE;
@@ -1408,6 +1948,54 @@ static void Sound_GenerateSamples(int SamplesToGenerate)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Generate given number of YM2149 samples into the mix buffer at its
+ * current position, for the micro-benchmarks. Unlike the emulation,
+ * this doesn't advance the sound position or update the statistics.
+ */
+void Sound_GenerateYMSamples(int nSamples)
+{
+	Sound_ThreadSync();
+	Sound_GenerateYM(nSamples, true);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Replay the given journaled register writes at their positions, then
+ * generate samples until SamplesPos samples exist for the current VBL.
+ */
+static void Sound_ReplayJournal(const SOUND_JOURNAL_ENTRY *pJournal, int nEntries, int SamplesPos)
+{
+	int i, j;
+
+	for ( i = 0 ; i < nEntries ; i = j )
+	{
+		Sound_GenerateUpTo( pJournal[i].nSamplePos );
+		if ( pJournal[i].Reg < 8 || pJournal[i].Reg > 10 )
+		{
+			Sound_WriteReg( pJournal[i].Reg , pJournal[i].Data );
+			j = i + 1;
+			continue;
+		}
+
+		/* Let the synthesis apply a run of volume writes itself */
+		for ( j = i + 1 ; j < nEntries ; j++ )
+			if ( pJournal[j].Reg < 8 || pJournal[j].Reg > 10 )
+				break;
+		pVolumeStream = &pJournal[i];
+		nVolumeStreamLeft = j - i;
+		nVolumeStreamPos = CurrentSamplesNb;
+		Sound_GenerateUpTo( j < nEntries ? pJournal[j].nSamplePos : SamplesPos );
+		for ( ; nVolumeStreamLeft > 0 ; nVolumeStreamLeft-- , pVolumeStream++ )
+			Sound_WriteReg( pVolumeStream->Reg , pVolumeStream->Data );
+	}
+
+	Sound_GenerateUpTo( SamplesPos );
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * This is called to built samples up until this clock cycle
@@ -1417,28 +2005,339 @@ static void Sound_GenerateSamples(int SamplesToGenerate)
  */
 void Sound_Update(bool FillFrame)
 {
-	int OldSndBufIdx = ActiveSndBufIdx;
-	int SamplesToGenerate;
+	int OldSndBufIdx;
+	int OldSamplesNb;
 
-	/* Make sure that we don't interfere with the audio callback function */
-	Audio_Lock();
+	Perf_Begin(PERF_AUDIO);
 
-	/* Find how many samples to generate */
-	SamplesToGenerate = Sound_SetSamplesPassed( FillFrame );
+	/* Let the worker finish the previous VBL first */
+	Sound_ThreadSync();
+	OldSndBufIdx = ActiveSndBufIdx;
+	OldSamplesNb = CurrentSamplesNb;
 
-	/* And generate */
-	Sound_GenerateSamples( SamplesToGenerate );
+	/* Replay the journaled register writes and generate up to now */
+	Sound_ReplayJournal( SoundJournal , nSoundJournalEntries , Sound_GetSamplesPos( FillFrame ) );
+	nSoundJournalEntries = 0;
 
-	/* Allow audio callback function to occur again */
-	Audio_Unlock();
+	/* Hand them to the audio output at once, not only at the end of the VBL */
+	if ( Sound_RingIsOutput() )
+		Sound_RingPush();
 
-	/* Save to WAV file, if open */
-	if (bRecordingWav)
-		WAVFormat_Update(MixBuffer, OldSndBufIdx, SamplesToGenerate);
+	/* Save to WAV file, if open (frames emulated ahead are rolled back) */
+	if (bRecordingWav && !bVideoFrameSpeculative)
+		WAVFormat_Update(MixBuffer, OldSndBufIdx, CurrentSamplesNb - OldSamplesNb);
+
+	Perf_End();
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return true if only the YM2149's output has to be generated, i.e. if
+ * this is not a Falcon, no DMA sound is playing and no YM file is recorded.
+ */
+static bool Sound_IsYmOnly(void)
+{
+	return !bRecordingYM && ConfigureParams.System.nMachineType != MACHINE_FALCON
+	    && ( ConfigureParams.System.nMachineType == MACHINE_ST || DmaSnd_IsIdle() );
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Write a YM register at the current emulation time.
+ * When only the YM2149 output is generated (i.e. no DMA sound is playing
+ * and no YM file is recorded), the write is just added to the journal,
+ * to be applied when the samples are generated. Else, samples are
+ * generated up to this point and the register written immediately.
+ */
+void Sound_JournalWriteReg(int reg, Uint8 data)
+{
+	if ( nSoundJournalEntries == SOUND_JOURNAL_SIZE || !Sound_IsYmOnly() )
+	{
+		Sound_Update(false);
+		Sound_WriteReg(reg, data);
+		return;
+	}
+
+	SoundJournal[nSoundJournalEntries].nSamplePos = Sound_GetSamplesPos(false);
+	SoundJournal[nSoundJournalEntries].Reg = reg;
+	SoundJournal[nSoundJournalEntries].Data = data;
+	nSoundJournalEntries++;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Move all samples generated so far from the mix buffer to the ring read
+ * by the audio output. If the output doesn't keep up (e.g. in fast forward
+ * mode), the samples which don't fit anymore are dropped.
+ */
+static void Sound_RingPush(void)
+{
+	Uint32 nWrite = nSoundRingWrite;
+	int nFree = SOUND_RING_SIZE - ( nWrite - SOUND_RING_LOAD( nSoundRingRead ) );
+	int n = nGeneratedSamples;
+	int i, idx;
+
+	if ( n > nFree )
+		n = nFree;
+
+	for ( i = 0 ; i < n ; i++ )
+	{
+		idx = ( CompleteSndBufIdx + i ) % MIXBUFFER_SIZE;
+		SoundRing[ ( nWrite + i ) & ( SOUND_RING_SIZE - 1 ) ][0] = MixBuffer[ idx ][0];
+		SoundRing[ ( nWrite + i ) & ( SOUND_RING_SIZE - 1 ) ][1] = MixBuffer[ idx ][1];
+	}
+	SOUND_RING_STORE( nSoundRingWrite , nWrite + n );
+
+	CompleteSndBufIdx = ( CompleteSndBufIdx + nGeneratedSamples ) % MIXBUFFER_SIZE;
+	nGeneratedSamples = 0;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return true if the audio output reads the generated samples from the ring.
+ */
+static bool Sound_RingIsOutput(void)
+{
+#ifdef __LIBRETRO__
+	return bSoundThreadActive;
+#else
+	return true;
+#endif
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return the number of silent samples to fake when (re)starting the sound
+ * generation, so that the audio output doesn't run dry at once. When the
+ * output reads the ring, only what it lacks to reach that fill level.
+ */
+static int Sound_InitialSamples(void)
+{
+	int n = SoundBufferSize + SAMPLES_PER_FRAME;
+
+	if ( Sound_RingIsOutput() )
+	{
+		n -= nSoundRingWrite - SOUND_RING_LOAD( nSoundRingRead );
+		if ( n < 0 )
+			n = 0;
+	}
+	return n;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return the number of samples the ring holds for the audio output.
+ */
+int Sound_RingFill(void)
+{
+	return SOUND_RING_LOAD( nSoundRingWrite ) - nSoundRingRead;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Set *ppSamples to the oldest samples of the ring and return how many
+ * of them can be read from there (this doesn't wrap around the ring end).
+ */
+int Sound_RingPeek(Sint16 **ppSamples)
+{
+	int idx = nSoundRingRead & ( SOUND_RING_SIZE - 1 );
+	int n = Sound_RingFill();
+
+	if ( n > SOUND_RING_SIZE - idx )
+		n = SOUND_RING_SIZE - idx;
+	*ppSamples = SoundRing[ idx ];
+	return n;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Remove given number of samples, already read, from the ring.
+ */
+void Sound_RingAdvance(int nSamples)
+{
+	SOUND_RING_STORE( nSoundRingRead , nSoundRingRead + nSamples );
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return the current write position of the ring, to be given later
+ * to Sound_RingTruncate().
+ */
+Uint32 Sound_RingTell(void)
+{
+	Sound_ThreadSync();
+	return SOUND_RING_LOAD( nSoundRingWrite );
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Drop the samples pushed to the ring since Sound_RingTell() returned
+ * the given position (used when a frame is only emulated speculatively).
+ */
+void Sound_RingTruncate(Uint32 nPos)
+{
+	Sound_ThreadSync();
+	SOUND_RING_STORE( nSoundRingWrite , nPos );
+}
+
+
+#if SOUND_THREAD
+/*-----------------------------------------------------------------------*/
+/**
+ * Wait until the worker has rendered the VBL handed to it.
+ */
+static void Sound_ThreadWait(void)
+{
+	pthread_mutex_lock(&sound_thread_lock);
+	while (bSoundThreadBusy)
+		pthread_cond_wait(&sound_thread_cond, &sound_thread_lock);
+	pthread_mutex_unlock(&sound_thread_lock);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Audio worker thread : complete the VBL in SoundJob and pass its
+ * samples to the output ring.
+ */
+static void *Sound_ThreadFunc(void *arg)
+{
+	pthread_mutex_lock(&sound_thread_lock);
+	for (;;)
+	{
+		while (!bSoundThreadBusy && !bSoundThreadQuit)
+			pthread_cond_wait(&sound_thread_cond, &sound_thread_lock);
+		if (bSoundThreadQuit)
+			break;
+		pthread_mutex_unlock(&sound_thread_lock);
+
+		bSoundOnThread = true;
+		Sound_ReplayJournal(SoundJob.Journal, SoundJob.nEntries, SoundJob.nSamplesPos);
+		Sound_RingPush();
+		CurrentSamplesNb = 0;
+		ActiveSndBufIdxAvi = ActiveSndBufIdx;
+		bEnvelopeFreqFlag = false;
+		bSoundOnThread = false;
+
+		pthread_mutex_lock(&sound_thread_lock);
+		bSoundThreadBusy = false;
+		pthread_cond_broadcast(&sound_thread_cond);
+	}
+	pthread_mutex_unlock(&sound_thread_lock);
+	return NULL;
+}
+#endif
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * At the end of a VBL, hand the remaining samples of the VBL to the worker,
+ * if it can generate them on its own, i.e. only the YM2149 is heard and
+ * no WAV or AVI file is recorded. Return false if the samples have to be
+ * generated by the caller.
+ */
+static bool Sound_ThreadDefer(void)
+{
+#if SOUND_THREAD
+	if ( !bSoundThreadActive || bRecordingWav || bRecordingAvi || !Sound_IsYmOnly() )
+		return false;
+
+	/* Worker renders one VBL at a time */
+	Sound_ThreadWait();
+
+	memcpy(SoundJob.Journal, SoundJournal, nSoundJournalEntries * sizeof(SoundJournal[0]));
+	SoundJob.nEntries = nSoundJournalEntries;
+	SoundJob.nSamplesPos = SamplesPerFrame;
+	nSoundJournalEntries = 0;
+	Stats_Add(STATS_AUDIO_SAMPLES, SamplesPerFrame - CurrentSamplesNb);
+
+	pthread_mutex_lock(&sound_thread_lock);
+	bSoundThreadBusy = true;
+	pthread_cond_broadcast(&sound_thread_cond);
+	pthread_mutex_unlock(&sound_thread_lock);
+	return true;
+#else
+	return false;
+#endif
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Wait for the audio worker, before accessing the sound emulation state
+ * from the emulation thread.
+ */
+void Sound_ThreadSync(void)
+{
+#if SOUND_THREAD
+	if (bSoundThreadActive)
+		Sound_ThreadWait();
+#endif
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return true if sound is generated with the worker thread. Audio output
+ * has then to be read with Sound_RingPeek() and Sound_RingAdvance().
+ */
+bool Sound_ThreadIsActive(void)
+{
+	return bSoundThreadActive;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Enable/disable generating sound on its own host thread.
+ */
+void Sound_EnableThread(bool bEnable)
+{
+#if SOUND_THREAD
+	if (bEnable == bSoundThreadActive)
+		return;
+
+	if (bEnable)
+	{
+		bSoundThreadQuit = false;
+		bSoundThreadBusy = false;
+		if (pthread_create(&sound_thread, NULL, Sound_ThreadFunc, NULL) != 0)
+		{
+			Log_Printf(LOG_WARN, "Failed to create audio thread, generating sound inline.\n");
+			return;
+		}
+#ifdef __LIBRETRO__
+		nSoundRingRead = nSoundRingWrite = 0;
+#endif
+		bSoundThreadActive = true;
+	}
+	else
+	{
+		Sound_ThreadWait();
+		pthread_mutex_lock(&sound_thread_lock);
+		bSoundThreadQuit = true;
+		pthread_cond_broadcast(&sound_thread_cond);
+		pthread_mutex_unlock(&sound_thread_lock);
+		pthread_join(sound_thread, NULL);
+		bSoundThreadActive = false;
+	}
+#endif
 }
 
+
 #ifdef __LIBRETRO__
 extern short signed int SNDBUF[1024*2];
+extern int snd_sampler;
 static void Retro_Audio_CallBack(int len)
 {
 	Sint16 *pBuffer;
@@ -1446,6 +2345,9 @@ static void Retro_Audio_CallBack(int len)
 
 	pBuffer = (Sint16 *)&SNDBUF[0];
 	len = len / 4; // Use length in samples (16 bit stereo), not in bytes
+	if (len > (int)(sizeof(SNDBUF) / 4))
+		len = sizeof(SNDBUF) / 4;
+	snd_sampler = len; // Number of samples retro_run passes to the frontend
 
 	/* Adjust emulation rate within +/- 0.58% (10 cents) occasionally,
 	 * to synchronize sound. Note that an octave (frequency doubling)
@@ -1522,15 +2424,28 @@ static void Retro_Audio_CallBack(int len)
  */
 void Sound_Update_VBL(void)
 {
-	Sound_Update(true);					/* generate as many samples as needed to fill this VBL */
+	bool bDeferred;
+
+	Perf_Begin(PERF_AUDIO);
+	bDeferred = Sound_ThreadDefer();			/* worker completes this VBL */
+	if ( !bDeferred )
+	{
+		Sound_Update(true);				/* generate as many samples as needed to fill this VBL */
 //fprintf ( stderr , "vbl done %d %d\n" , SamplesPerFrame , CurrentSamplesNb );
 
+		if ( Sound_RingIsOutput() )
+			Sound_RingPush();
 #ifdef __LIBRETRO__
-memset(SNDBUF,0,1024*4);
-Retro_Audio_CallBack(CurrentSamplesNb*4);
+		else
+		{
+			memset(SNDBUF,0,1024*4);
+			Retro_Audio_CallBack(CurrentSamplesNb*4);
+		}
 #endif
 
-	CurrentSamplesNb = 0;					/* VBL is complete, reset counter for next VBL */
+		CurrentSamplesNb = 0;				/* VBL is complete, reset counter for next VBL */
+	}
+	Perf_End();
 
 	/*Compute a fractional equivalent of SamplesPerFrame for the next VBL, to avoid rounding propagation */
 	//SamplesPerFrame_unrounded += (yms64) ClocksTimings_GetSamplesPerVBL ( ConfigureParams.System.nMachineType ,
@@ -1538,11 +2453,13 @@ Retro_Audio_CallBack(CurrentSamplesNb*4);
 	//SamplesPerFrame = SamplesPerFrame_unrounded >> 28;		/* use integer part */
 	//SamplesPerFrame_unrounded &= 0x0fffffff;			/* keep fractional part in the lower 28 bits */
 
-	// Hatari's audio system seems to be able to deal with a variable number of samples per frame, keeping aligned with the Atari's not-quite-50/60 Hz,
-	// but our RetroArch interface does not seem to be able to handle it (pads with 0 to fill the rest, creating a constant buzz).
-	// Forcing it to generate all samples every frame:
-	SamplesPerFrame = nAudioFrequency / nScreenRefreshRate;
-	SamplesPerFrame_unrounded = 0;
+	/* The libretro core passes each VBL's actual number of samples to the frontend,
+	 * but its timing announces nScreenRefreshRate frames and nAudioFrequency samples
+	 * per second : carry the remainder of the division, so that e.g. 22050 Hz output
+	 * at 60 Hz alternates 367 and 368 samples instead of losing 30 samples per second */
+	SamplesPerFrame_unrounded += nAudioFrequency;
+	SamplesPerFrame = SamplesPerFrame_unrounded / nScreenRefreshRate;
+	SamplesPerFrame_unrounded %= nScreenRefreshRate;
 
 	/* Reset sound buffer if needed (after pause, fast forward, slow system, ...) */
 	if ( Sound_BufferIndexNeedReset )
@@ -1551,8 +2468,11 @@ Retro_Audio_CallBack(CurrentSamplesNb*4);
 		Sound_BufferIndexNeedReset = false;
 	}
 	
+	if ( bDeferred )
+		return;
+
 	/* Record AVI audio frame is necessary */
-	if ( bRecordingAvi )
+	if ( bRecordingAvi && !bVideoFrameSpeculative )
 	{
 		int Len;
 
@@ -1624,6 +2544,26 @@ bool Sound_AreWeRecording(void)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Called after nAudioFrequency changed : recompute the tone, noise and
+ * envelope steps of the current YM2149 registers for the new frequency
+ * and restart the sound buffer index on next VBL.
+ */
+void Sound_FrequencyChanged(void)
+{
+	int reg;
+
+	Sound_ThreadSync();
+
+	/* Don't rewrite register 13, this would restart the envelope */
+	for ( reg = 0 ; reg < 13 ; reg++ )
+		Sound_WriteReg ( reg , SoundRegs[ reg ] );
+
+	Sound_BufferIndexNeedReset = true;
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Rebuild volume conversion table
@@ -17,6 +17,13 @@
   palette with each change. As the table is already ordered this makes things
   very simple. Speed is a problem, though, as the palette can change once every
   4 pixels - that's a lot of processing.
+
+  To keep that processing low, Spec512_StartFrame compiles the table of each
+  scanline into a list of the writes which really change a colour, with their
+  4-pixel span number, host palette index and ST2RGB value precomputed.
+  Spectrum 512 viewers rewrite all of the 48 colours of every line even when
+  most of them are unchanged, and the spans skipped outside of the displayed
+  part of a line are then applied in one go.
 */
 
 
@@ -88,14 +95,27 @@ CYCLEPALETTE;
 
 /* 314k; 1024-bytes per line */
 static CYCLEPALETTE CyclePalettes[(MAX_SCANLINES_PER_FRAME+1)*MAX_CYCLEPALETTES_PERLINE];
-static CYCLEPALETTE *pCyclePalette;
 static int nCyclePalettes[(MAX_SCANLINES_PER_FRAME+1)];  /* Number of entries in above table for each scanline */
 static int nPalettesAccesses;   /* Number of times accessed palette registers */
 static Uint16 CycleColour;
 static int CycleColourIndex;
-static int nScanLine, ScanLineCycleCount;
+static int nScanLine, nScanLineSpan;
 static bool bIsSpec512Display;
 
+#define SPANPALETTE_END  0xffff		/* nSpan of a line's terminator */
+
+/* Colour changes of the 'CyclePalettes' table, compiled for screen conversion */
+typedef struct
+{
+	Uint16 nSpan;         /* Number of 4-cycle spans into line */
+	Uint16 Index;         /* Index into 'STRGBPalette' (0...15) */
+	Uint32 RGB;           /* ST2RGB value of the colour */
+}
+SPANPALETTE;
+
+static SPANPALETTE SpanPalettes[(MAX_SCANLINES_PER_FRAME+1)*MAX_CYCLEPALETTES_PERLINE];
+static SPANPALETTE *pSpanPalette;
+
 #if SDL_BYTEORDER == SDL_BIG_ENDIAN
 static const int STRGBPalEndianTable[16] =
 {
@@ -251,6 +271,72 @@ void Spec512_StoreCyclePalette(Uint16 col, Uint32 addr)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Compile 'CyclePalettes' of the lines from nFirstLine to the end of the frame
+ * into 'SpanPalettes', starting from the first line palette. Writes that don't
+ * change their colour are dropped, like the writes which could never be
+ * reached when counting the cycles 4 by 4 from the start of the line (these
+ * stopped the line's updates).
+ */
+static void Spec512_CompileLines(int nFirstLine)
+{
+	Uint32 Palette[16], RGB;
+	CYCLEPALETTE *pCycle;
+	SPANPALETTE *pSpan;
+	int i, nLine, nNextCycle;
+
+	for (i = 0; i < 16; i++)
+		Palette[i] = ST2RGB[pHBLPalettes[i]];
+
+	for (nLine = nFirstLine; nLine < (nScanlinesPerFrame+1); nLine++)
+	{
+		pCycle = &CyclePalettes[nLine*MAX_CYCLEPALETTES_PERLINE];
+		pSpan = &SpanPalettes[nLine*MAX_CYCLEPALETTES_PERLINE];
+		nNextCycle = 0;
+
+		for (i = 0; i < nCyclePalettes[nLine]; i++, pCycle++)
+		{
+			if (pCycle->LineCycles < nNextCycle || pCycle->LineCycles >= nCyclesPerLine
+			    || (pCycle->LineCycles & 3))
+				break;
+			nNextCycle = pCycle->LineCycles + 4;
+
+			RGB = ST2RGB[pCycle->Colour];
+			if (Palette[pCycle->Index] == RGB)
+				continue;
+			Palette[pCycle->Index] = RGB;
+
+			pSpan->nSpan = pCycle->LineCycles / 4;
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+			pSpan->Index = STRGBPalEndianTable[pCycle->Index];
+#else
+			pSpan->Index = pCycle->Index;
+#endif
+			pSpan->RGB = RGB;
+			pSpan++;
+		}
+		pSpan->nSpan = SPANPALETTE_END;          /* Term */
+	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Apply the colour changes of the current line up to given span.
+ */
+static void Spec512_UpdatePaletteSpans(int nEndSpan)
+{
+	while (pSpanPalette->nSpan < nEndSpan)
+	{
+		STRGBPalette[pSpanPalette->Index] = pSpanPalette->RGB;
+		pSpanPalette += 1;
+	}
+	if (nScanLineSpan < nEndSpan)
+		nScanLineSpan = nEndSpan;
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Begin palette calculation for Spectrum 512 style images,
@@ -262,13 +348,6 @@ void Spec512_StartFrame(void)
 	/* Set so screen gets full-update when returns from Spectrum 512 display */
 	Screen_SetFullUpdate();
 
-	/* Set terminators on each line, so when scan during conversion we know when to stop */
-	for (i = 0; i < (nScanlinesPerFrame+1); i++)
-	{
-		pCyclePalette = &CyclePalettes[ (i*MAX_CYCLEPALETTES_PERLINE) + nCyclePalettes[i] ];
-		pCyclePalette->LineCycles = -1;          /* Term */
-	}
-
        /* Copy first line palette, kept in 'HBLPalettes' and store to 'STRGBPalette' */
        for (i = 0; i < 16; i++)
        {
@@ -284,6 +363,9 @@ void Spec512_StartFrame(void)
 	if (OverscanMode & OVERSCANMODE_TOP)
 		nScanLine += OVERSCAN_TOP;
 
+	/* Lines before the first scanned one are never applied */
+	Spec512_CompileLines(nScanLine);
+
 	/* Skip to first line(where start to draw screen from) */
 	for (i = 0; i < (STScreenStartHorizLine+(nStartHBL-OVERSCAN_TOP)); i++)
 		Spec512_ScanWholeLine();
@@ -297,13 +379,13 @@ void Spec512_StartFrame(void)
  */
 void Spec512_ScanWholeLine(void)
 {
-	/* Store pointer to line of palette cycle writes */
-	pCyclePalette = &CyclePalettes[nScanLine*MAX_CYCLEPALETTES_PERLINE];
+	/* Store pointer to line of palette changes */
+	pSpanPalette = &SpanPalettes[nScanLine*MAX_CYCLEPALETTES_PERLINE];
 	/* Ready for next scan line */
 	nScanLine++;
 
 	/* Update palette entries until we reach start of displayed screen */
-	ScanLineCycleCount = 0;
+	nScanLineSpan = 0;
 	Spec512_EndScanLine();        /* Read whole line of palettes and update 'STRGBPalette' */
 }
 
@@ -314,11 +396,10 @@ void Spec512_ScanWholeLine(void)
  */
 void Spec512_StartScanLine(void)
 {
-	int i;
 	int LineStartCycle;
 
-	/* Store pointer to line of palette cycle writes */
-	pCyclePalette = &CyclePalettes[nScanLine*MAX_CYCLEPALETTES_PERLINE];
+	/* Store pointer to line of palette changes */
+	pSpanPalette = &SpanPalettes[nScanLine*MAX_CYCLEPALETTES_PERLINE];
 	/* Ready for next scan line */
 	nScanLine++;
 
@@ -328,18 +409,16 @@ void Spec512_StartScanLine(void)
 		LineStartCycle = LINE_START_CYCLE_60;			/* The screen was 60 Hz */
 
 	/* Update palette entries until we reach start of displayed screen */
-	ScanLineCycleCount = 0;
+	nScanLineSpan = 0;
 //	for(i=0; i<((SCREEN_START_CYCLE-16)/4); i++)  /* This '16' is as we've already added in the 'move' instruction timing */
 #ifdef OLD_CYC_PAL
-	for (i=0; i<((LineStartCycle-SCREENBYTES_LEFT*2)/4 + 6); i++)	/* [NP] '6' is required to align pixels and colors */
+	Spec512_UpdatePaletteSpans((LineStartCycle-SCREENBYTES_LEFT*2)/4 + 6);	/* [NP] '6' is required to align pixels and colors */
 #else
-	for (i=0; i<((LineStartCycle-SCREENBYTES_LEFT*2)/4 + 7); i++)	/* [NP] '7' is required to align pixels and colors */
+	Spec512_UpdatePaletteSpans((LineStartCycle-SCREENBYTES_LEFT*2)/4 + 7);	/* [NP] '7' is required to align pixels and colors */
 #endif
-		Spec512_UpdatePaletteSpan();              /* Update palette for this 4-cycle period */
 
 	/* And skip for left border is not using overscan display to user */
-	for (i=0; i<(STScreenLeftSkipBytes/2); i++)   /* Eg, 16 bytes = 32 pixels or 8 palette periods */
-		Spec512_UpdatePaletteSpan();
+	Spec512_UpdatePaletteSpans(nScanLineSpan + STScreenLeftSkipBytes/2);   /* Eg, 16 bytes = 32 pixels or 8 palette periods */
 }
 
 
@@ -350,8 +429,7 @@ void Spec512_StartScanLine(void)
 void Spec512_EndScanLine(void)
 {
 	/* Continue to reads palette until complete so have correct version for next line */
-	while (ScanLineCycleCount < nCyclesPerLine)
-		Spec512_UpdatePaletteSpan();
+	Spec512_UpdatePaletteSpans((nCyclesPerLine+3)/4);
 }
 
 
@@ -361,16 +439,11 @@ void Spec512_EndScanLine(void)
  */
 void Spec512_UpdatePaletteSpan(void)
 {
-	if (pCyclePalette->LineCycles == ScanLineCycleCount)
+	if (pSpanPalette->nSpan == nScanLineSpan)
 	{
 		/* Need to update palette with new entry */
-#if SDL_BYTEORDER == SDL_BIG_ENDIAN
-		STRGBPalette[STRGBPalEndianTable[pCyclePalette->Index]] = ST2RGB[pCyclePalette->Colour];
-#else
-		STRGBPalette[pCyclePalette->Index] = ST2RGB[pCyclePalette->Colour];
-//fprintf ( stderr , "upd spec cyc %d %x %x\n" , ScanLineCycleCount , pCyclePalette->Index , pCyclePalette->Colour );
-#endif
-		pCyclePalette += 1;
+		STRGBPalette[pSpanPalette->Index] = pSpanPalette->RGB;
+		pSpanPalette += 1;
 	}
-	ScanLineCycleCount += 4;      /* Next 4 cycles */
+	nScanLineSpan++;      /* Next 4 cycles */
 }
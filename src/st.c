@@ -83,7 +83,7 @@ bool ST_WriteDisk(int Drive, const char *pszFileName, Uint8 *pBuffer, int ImageS
 #ifdef SAVE_TO_ST_IMAGES
 
 	/* Just save buffer directly to file */
-	return File_Save(pszFileName, pBuffer, ImageSize, false);
+	return File_SaveReplace(pszFileName, pBuffer, ImageSize);
 
 #else   /*SAVE_TO_ST_IMAGES*/
 
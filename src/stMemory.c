@@ -10,29 +10,213 @@ const char STMemory_fileid[] = "Hatari stMemory.c : " __DATE__ " " __TIME__;
 
 #include "stMemory.h"
 #include "configuration.h"
+#include "cycles.h"
 #include "floppy.h"
 #include "gemdos.h"
 #include "ioMem.h"
 #include "log.h"
+#include "m68000.h"
 #include "memory.h"
 #include "memorySnapShot.h"
 #include "tos.h"
+#include "utils.h"
 #include "vdi.h"
 
+#if !ENABLE_SMALL_MEM && !defined(_WIN32) && !defined(WIIU) && !defined(VITA) && !defined(__CELLOS_LV2__)
+# define STMEMORY_USE_MMAP 1
+# include <sys/mman.h>
+#endif
+
 
 /* STRam points to our ST Ram. Unless the user enabled SMALL_MEM where we have
  * to save memory, this includes all TOS ROM and IO hardware areas for ease
- * and emulation speed - so we create a 16 MiB array directly here.
+ * and emulation speed - so we reserve the whole 16 MiB address space in
+ * STMemory_Init(). Host pages are only used for the parts which are touched,
+ * i.e. the configured RAM plus ROM and IO memory.
  * But when the user turned on ENABLE_SMALL_MEM, this only points to a malloc'ed
- * buffer with the ST RAM; the ROM and IO memory will be handled separately. */
-#if ENABLE_SMALL_MEM
-Uint8 *STRam;
-#else
-Uint8 STRam[16*1024*1024];
+ * buffer with the ST RAM; the ROM and IO memory will be handled separately.
+ * STRam itself is kept in HotState (see hotState.h). */
+
+/* Accesses straddling the end of the address space (e.g. a long at
+ * $fffffe) read a few bytes past it, so there's an accessible page
+ * after it. An inaccessible guard page before it catches underruns. */
+#define STMEMORY_AREA_SIZE	0x1000000
+#define STMEMORY_GUARD_SIZE	0x10000
+#if STMEMORY_USE_MMAP
+static Uint8 *STMemory_Mapping;
+#endif
+
+/* STRam (when mapped) is aligned to the usual huge page size, so that
+ * the host can back it and large TT-RAM blocks with huge pages when the
+ * user enabled them (see STMemory_SetHugePages()). */
+#define STMEMORY_HUGE_PAGE_SIZE	0x200000
+#if STMEMORY_USE_MMAP
+# define STMEMORY_MAPPING_SIZE	(STMEMORY_GUARD_SIZE + STMEMORY_AREA_SIZE + STMEMORY_GUARD_SIZE + STMEMORY_HUGE_PAGE_SIZE)
 #endif
+static bool STMemory_bHugePages;
 
 Uint32 STRamEnd;            /* End of ST Ram, above this address is no-mans-land and ROM/IO memory */
 
+/* Dirty page tracking: pages written during the current frame, and
+ * during the previous (complete) frame. Updated only when enabled. */
+bool STMemory_bDirtyTracking;
+Uint32 STMemory_DirtyPages[STMEMORY_PAGES / 32];
+static Uint32 STMemory_DirtyPagesLast[STMEMORY_PAGES / 32];
+
+/* Backup of ST-RAM for snapshots which leave RAM out (run-ahead), with
+ * the pages written since the backup and RAM contents were last equal.
+ * The flag also makes the DSP keep its RAM in a backup of its own. */
+bool STMemory_bSnapShotRamBackup;
+static Uint8 *STMemory_RamBackup;
+static Uint32 STMemory_RamBackupEnd;
+static Uint32 STMemory_RamBackupPages[STMEMORY_PAGES / 32];
+
+/* Hash of each ST-RAM page for the state hash (netplay), with the pages
+ * written since they were last hashed, and the combined hash of them. */
+static Uint32 *STMemory_PageHashes;
+static Uint32 STMemory_HashPages[STMEMORY_PAGES / 32];
+static Uint32 STMemory_RamHash;
+
+
+/**
+ * Reserve the ST address space. Host memory gets committed lazily
+ * as the emulation first touches it.
+ */
+bool STMemory_Init(void)
+{
+#if !ENABLE_SMALL_MEM
+	if (STRam)
+		return true;
+#if STMEMORY_USE_MMAP
+	STMemory_Mapping = mmap(NULL, STMEMORY_MAPPING_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+	                        -1, 0);
+	if (STMemory_Mapping == MAP_FAILED)
+	{
+		STMemory_Mapping = NULL;
+		Log_Printf(LOG_FATAL, "Can't reserve the ST address space!\n");
+		return false;
+	}
+	/* The reservation leaves room to start STRam at a huge page boundary */
+	STRam = (Uint8 *)(((uintptr_t)STMemory_Mapping + STMEMORY_GUARD_SIZE + STMEMORY_HUGE_PAGE_SIZE - 1)
+	                  & ~(uintptr_t)(STMEMORY_HUGE_PAGE_SIZE - 1));
+	mprotect(STRam - STMEMORY_GUARD_SIZE, STMEMORY_GUARD_SIZE, PROT_NONE);
+	if (STMemory_bHugePages)
+		STMemory_SetHugePages(true);
+#else
+	STRam = calloc(1, STMEMORY_AREA_SIZE + STMEMORY_GUARD_SIZE);
+	if (!STRam)
+	{
+		Log_Printf(LOG_FATAL, "Can't allocate the ST address space!\n");
+		return false;
+	}
+#endif
+#endif	/* !ENABLE_SMALL_MEM */
+	return true;
+}
+
+
+/**
+ * Release the ST address space.
+ */
+void STMemory_UnInit(void)
+{
+	STMemory_RamBackupFree();
+#if !ENABLE_SMALL_MEM
+#if STMEMORY_USE_MMAP
+	if (STMemory_Mapping)
+		munmap(STMemory_Mapping, STMEMORY_MAPPING_SIZE);
+	STMemory_Mapping = NULL;
+#else
+	free(STRam);
+#endif
+	STRam = NULL;
+#endif
+}
+
+
+/**
+ * Give the host pages between the end of RAM and the ROM area back,
+ * e.g. after the RAM size has been reduced. They read as zero when
+ * they are touched again.
+ */
+void STMemory_ReleaseUnused(void)
+{
+#if STMEMORY_USE_MMAP
+	Uint32 start = (STRamEnd + STMEMORY_PAGE_SIZE - 1) & ~(STMEMORY_PAGE_SIZE - 1);
+
+	if (STRam && start < 0xe00000)
+		madvise(STRam + start, 0xe00000 - start, MADV_DONTNEED);
+#endif
+}
+
+
+/**
+ * Let the host back the ST address space and the large memory blocks
+ * allocated afterwards with (transparent) huge pages or not. With huge
+ * pages the random memory accesses of the emulated programs cause far
+ * fewer TLB misses. Where the host doesn't support them, this silently
+ * keeps using normal pages.
+ */
+void STMemory_SetHugePages(bool bEnable)
+{
+	STMemory_bHugePages = bEnable;
+#if STMEMORY_USE_MMAP && defined(MADV_HUGEPAGE)
+	if (STRam && STMemory_Mapping)
+		madvise(STRam, STMEMORY_AREA_SIZE, bEnable ? MADV_HUGEPAGE : MADV_NOHUGEPAGE);
+#endif
+}
+
+
+/**
+ * Allocate a large, zeroed memory block (e.g. TT-RAM), which gets huge
+ * pages when they are enabled. Like the ST address space, it is only
+ * reserved: host memory gets committed as the emulation first touches
+ * it. Free it with STMemory_FreeLarge().
+ */
+void *STMemory_AllocLarge(size_t size)
+{
+#if STMEMORY_USE_MMAP
+	void *mem = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+
+	if (mem == MAP_FAILED)
+		return NULL;
+#ifdef MADV_HUGEPAGE
+	if (STMemory_bHugePages && size >= STMEMORY_HUGE_PAGE_SIZE)
+		madvise(mem, size, MADV_HUGEPAGE);
+#endif
+	return mem;
+#else
+	return calloc(1, size);
+#endif
+}
+
+/**
+ * Free a memory block of given size from STMemory_AllocLarge().
+ */
+void STMemory_FreeLarge(void *mem, size_t size)
+{
+#if STMEMORY_USE_MMAP
+	if (mem)
+		munmap(mem, size);
+#else
+	free(mem);
+#endif
+}
+
+/**
+ * Zero a memory block of given size from STMemory_AllocLarge(). The
+ * pages are given back to the host and read as zero when touched again,
+ * so the parts never used after a reset cost no host memory.
+ */
+void STMemory_ClearLarge(void *mem, size_t size)
+{
+#if STMEMORY_USE_MMAP
+	if (madvise(mem, size, MADV_DONTNEED) == 0)
+		return;
+#endif
+	memset(mem, 0, size);
+}
+
 
 /**
  * Clear section of ST's memory space.
@@ -58,6 +242,8 @@ bool STMemory_SafeCopy(Uint32 addr, Uint8 *src, unsigned int len, const char *na
 {
 	Uint32 end;
 
+	STMemory_MarkDirty(addr, len);
+
 	if (STMemory_ValidArea(addr, len))
 	{
 		memcpy(&STRam[addr], src, len);
@@ -73,16 +259,263 @@ bool STMemory_SafeCopy(Uint32 addr, Uint8 *src, unsigned int len, const char *na
 	return false;
 }
 
+/**
+ * Enable or disable tracking of written ST-RAM pages. When enabled,
+ * the CPU uses RAM memory banks which mark the written pages, and the
+ * DMA / blitter write paths do the same. When disabled, the RAM write
+ * paths of the CPU have no extra overhead.
+ */
+void STMemory_SetDirtyTracking(bool bEnable)
+{
+	STMemory_ClearDirtyPages();
+	STMemory_MarkAllWritten();
+	STMemory_bDirtyTracking = bEnable;
+	memory_set_dirty_tracking(bEnable);
+}
+
+/**
+ * Called on VBL: pages written during the ending frame become the
+ * "last frame" set, and the current set is cleared for the new frame.
+ */
+void STMemory_DirtyTracking_VBL(void)
+{
+	int i;
+
+	if (!STMemory_bDirtyTracking)
+		return;
+	for (i = 0; i < STMEMORY_PAGES / 32; i++)
+	{
+		STMemory_RamBackupPages[i] |= STMemory_DirtyPages[i];
+		STMemory_HashPages[i] |= STMemory_DirtyPages[i];
+	}
+	memcpy(STMemory_DirtyPagesLast, STMemory_DirtyPages, sizeof(STMemory_DirtyPagesLast));
+	memset(STMemory_DirtyPages, 0, sizeof(STMemory_DirtyPages));
+}
+
+/**
+ * Reset dirty page information, for both current and last frame.
+ */
+void STMemory_ClearDirtyPages(void)
+{
+	memset(STMemory_DirtyPages, 0, sizeof(STMemory_DirtyPages));
+	memset(STMemory_DirtyPagesLast, 0, sizeof(STMemory_DirtyPagesLast));
+}
+
+/**
+ * Return bitmap of written pages, either for current frame so far or
+ * for the last complete frame. Bit (n & 31) of word (n >> 5) is set
+ * when page n (of STMEMORY_PAGE_SIZE bytes) was written.
+ */
+const Uint32 *STMemory_GetDirtyPages(bool bLastFrame)
+{
+	return bLastFrame ? STMemory_DirtyPagesLast : STMemory_DirtyPages;
+}
+
+/**
+ * Return true if any page in the given memory area was written,
+ * during the current or the last frame. When dirty page tracking
+ * is disabled, everything is considered dirty.
+ */
+bool STMemory_IsDirty(Uint32 addr, Uint32 size, bool bLastFrame)
+{
+	const Uint32 *pages = STMemory_GetDirtyPages(bLastFrame);
+	Uint32 page, last;
+
+	if (!STMemory_bDirtyTracking)
+		return true;
+	if (!size)
+		return false;
+	page = (addr & 0xffffff) >> STMEMORY_PAGE_SHIFT;
+	last = ((addr + size - 1) & 0xffffff) >> STMEMORY_PAGE_SHIFT;
+	if (last < page)
+		last = STMEMORY_PAGES - 1;
+	for ( ; page <= last; page++)
+	{
+		if (pages[page >> 5] & (1 << (page & 31)))
+			return true;
+	}
+	return false;
+}
+
+/**
+ * Consider all of ST-RAM as changed since the backup and the hashing,
+ * for RAM writes which don't go through dirty page tracking (reset,
+ * snapshot restore).
+ */
+void STMemory_MarkAllWritten(void)
+{
+	memset(STMemory_RamBackupPages, 0xff, sizeof(STMemory_RamBackupPages));
+	memset(STMemory_HashPages, 0xff, sizeof(STMemory_HashPages));
+}
+
+/**
+ * Free the ST-RAM backup.
+ */
+void STMemory_RamBackupFree(void)
+{
+	free(STMemory_RamBackup);
+	STMemory_RamBackup = NULL;
+	STMemory_RamBackupEnd = 0;
+	memset(STMemory_RamBackupPages, 0xff, sizeof(STMemory_RamBackupPages));
+}
+
+/**
+ * Copy the pages written since the last backup save or restore between
+ * ST-RAM and the backup, in the given direction. Restored pages are
+ * marked as written in the current frame, as their contents changed.
+ */
+static void STMemory_RamBackupCopy(bool bSave)
+{
+	Uint32 end = STRamEnd < STMemory_RamBackupEnd ? STRamEnd : STMemory_RamBackupEnd;
+	Uint32 addr, bits, size;
+	int i;
+
+	for (i = 0; i < STMEMORY_PAGES / 32; i++)
+		STMemory_RamBackupPages[i] |= STMemory_DirtyPages[i];
+
+	for (i = 0; i < STMEMORY_PAGES / 32; i++)
+	{
+		bits = STMemory_RamBackupPages[i];
+		if (!bits)
+			continue;
+		if (!bSave)
+			STMemory_DirtyPages[i] |= bits;
+		for (addr = (Uint32)i << (STMEMORY_PAGE_SHIFT + 5); bits; bits >>= 1, addr += STMEMORY_PAGE_SIZE)
+		{
+			if (!(bits & 1) || addr >= end)
+				continue;
+			size = end - addr < STMEMORY_PAGE_SIZE ? end - addr : STMEMORY_PAGE_SIZE;
+			if (bSave)
+				memcpy(&STMemory_RamBackup[addr], &STRam[addr], size);
+			else
+				memcpy(&STRam[addr], &STMemory_RamBackup[addr], size);
+		}
+	}
+	memset(STMemory_RamBackupPages, 0, sizeof(STMemory_RamBackupPages));
+}
+
+/**
+ * Bring the ST-RAM backup up to date. Only the written pages are copied,
+ * unless RAM size changed or dirty page tracking is disabled.
+ * Return false if the backup couldn't be allocated.
+ */
+static bool STMemory_RamBackupSave(void)
+{
+	if (STMemory_RamBackupEnd != STRamEnd || !STMemory_RamBackup)
+	{
+		Uint8 *pBackup = realloc(STMemory_RamBackup, STRamEnd);
+		if (!pBackup)
+			return false;
+		STMemory_RamBackup = pBackup;
+		STMemory_RamBackupEnd = STRamEnd;
+		memset(STMemory_RamBackupPages, 0xff, sizeof(STMemory_RamBackupPages));
+	}
+	if (!STMemory_bDirtyTracking)
+		memset(STMemory_RamBackupPages, 0xff, sizeof(STMemory_RamBackupPages));
+	STMemory_RamBackupCopy(true);
+	return true;
+}
+
+/**
+ * Add a 32-bit value to the hash, in the same byte order on all hosts.
+ */
+static void STMemory_HashLong(Uint32 *hash, Uint32 value)
+{
+	Uint8 bytes[4];
+
+	bytes[0] = value;
+	bytes[1] = value >> 8;
+	bytes[2] = value >> 16;
+	bytes[3] = value >> 24;
+	hash32_add_block(hash, bytes, sizeof(bytes));
+}
+
+/**
+ * Return a hash of the emulation state, to detect quickly when emulations
+ * which should run in lockstep (netplay) diverge: ST-RAM, IO memory, CPU
+ * registers and cycle counter. Only the ST-RAM pages written since the
+ * previous call are hashed again (all of them without dirty tracking).
+ */
+Uint32 STMemory_GetStateHash(void)
+{
+	Uint32 addr, bits, size, hash;
+	int i, page;
+
+	if (!STMemory_PageHashes)
+	{
+		STMemory_PageHashes = calloc(STMEMORY_PAGES, sizeof(Uint32));
+		if (!STMemory_PageHashes)
+			return 0;
+		STMemory_RamHash = 0;
+		memset(STMemory_HashPages, 0xff, sizeof(STMemory_HashPages));
+	}
+	if (!STMemory_bDirtyTracking)
+		memset(STMemory_HashPages, 0xff, sizeof(STMemory_HashPages));
+
+	/* The combined hash is the sum of the page hashes, update it with
+	 * the new hash of each written page (0 for pages above RAM end) */
+	for (i = 0; i < STMEMORY_PAGES / 32; i++)
+	{
+		bits = STMemory_HashPages[i] | STMemory_DirtyPages[i];
+		for (page = i * 32; bits; bits >>= 1, page++)
+		{
+			if (!(bits & 1))
+				continue;
+			hash = 0;
+			addr = (Uint32)page << STMEMORY_PAGE_SHIFT;
+			if (addr < STRamEnd)
+			{
+				size = STRamEnd - addr < STMEMORY_PAGE_SIZE ? STRamEnd - addr : STMEMORY_PAGE_SIZE;
+				hash32_reset(&hash);
+				STMemory_HashLong(&hash, page);
+				hash32_add_block(&hash, &STRam[addr], size);
+			}
+			STMemory_RamHash += hash - STMemory_PageHashes[page];
+			STMemory_PageHashes[page] = hash;
+		}
+	}
+	memset(STMemory_HashPages, 0, sizeof(STMemory_HashPages));
+
+	hash = STMemory_RamHash;
+	hash32_add_block(&hash, &IoMem[0xff8000], 0x8000);
+	for (i = 0; i < 16; i++)
+		STMemory_HashLong(&hash, Regs[i]);
+	STMemory_HashLong(&hash, M68000_GetPC());
+	STMemory_HashLong(&hash, M68000_GetSR());
+	STMemory_HashLong(&hash, CyclesGlobalClockCounter);
+	STMemory_HashLong(&hash, CyclesGlobalClockCounter >> 32);
+	return hash;
+}
+
 /**
  * Save/Restore snapshot of RAM / ROM variables
  * ('MemorySnapShot_Store' handles type)
  */
 void STMemory_MemorySnapShot_Capture(bool bSave)
 {
+	bool bInBackup = false;
+
 	MemorySnapShot_Store(&STRamEnd, sizeof(STRamEnd));
 
-	/* Only save/restore area of memory machine is set to, eg 1Mb */
-	MemorySnapShot_Store(STRam, STRamEnd);
+	/* With the RAM backup, only the written pages are copied */
+	if (STMemory_bSnapShotRamBackup)
+	{
+		bInBackup = !bSave || STMemory_RamBackupSave();
+		MemorySnapShot_Store(&bInBackup, sizeof(bInBackup));
+	}
+
+	if (bInBackup)
+	{
+		if (!bSave)
+			STMemory_RamBackupCopy(false);
+	}
+	else
+	{
+		/* Only save/restore area of memory machine is set to, eg 1Mb */
+		MemorySnapShot_Store(STRam, STRamEnd);
+		if (!bSave)
+			STMemory_MarkAllWritten();
+	}
 
 	/* And Cart/TOS/Hardware area */
 	MemorySnapShot_Store(&RomMem[0xE00000], 0x200000);
@@ -113,6 +546,9 @@ void STMemory_SetDefaultConfig(void)
 		0x0A    /* 4 MiB */
 	};
 
+	/* RAM gets written directly below and by the TOS loading */
+	STMemory_MarkAllWritten();
+
 	if (bRamTosImage)
 	{
 		/* Clear ST-RAM, excluding the RAM TOS image */
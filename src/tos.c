@@ -19,6 +19,10 @@
 const char TOS_fileid[] = "Hatari tos.c : " __DATE__ " " __TIME__;
 
 #include <SDL_endian.h>
+#if !defined(WIIU) && !defined(VITA)
+# include <sys/stat.h>
+# define TOS_CACHE_IMAGE 1
+#endif
 
 #include "main.h"
 #include "configuration.h"
@@ -561,6 +565,57 @@ static void TOS_CheckSysConfig(void)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Read the TOS image file. The (possibly uncompressed) contents of the last
+ * image are kept, so that a cold reset with the same unchanged file doesn't
+ * need to read and decompress it again. The file is identified by its name,
+ * size and modification time. Returns a copy the caller needs to free.
+ */
+static Uint8 *TOS_ReadImage(long *pnFileSize)
+{
+#if TOS_CACHE_IMAGE
+	static char szCachedName[FILENAME_MAX];
+	static off_t nCachedFileSize;
+	static time_t nCachedMTime;
+	static Uint8 *pCachedImage;
+	static long nCachedImageSize;
+	const char *name = ConfigureParams.Rom.szTosImageFileName;
+	struct stat st;
+	Uint8 *pImage;
+
+	if (stat(name, &st) != 0)
+		return HFile_Read(name, pnFileSize, pszTosNameExts);
+
+	if (!pCachedImage || strcmp(szCachedName, name) != 0
+	    || nCachedFileSize != st.st_size || nCachedMTime != st.st_mtime)
+	{
+		free(pCachedImage);
+		pCachedImage = HFile_Read(name, &nCachedImageSize, pszTosNameExts);
+		if (!pCachedImage || nCachedImageSize <= 0)
+		{
+			free(pCachedImage);
+			pCachedImage = NULL;
+			*pnFileSize = 0;
+			return NULL;
+		}
+		snprintf(szCachedName, sizeof(szCachedName), "%s", name);
+		nCachedFileSize = st.st_size;
+		nCachedMTime = st.st_mtime;
+	}
+
+	pImage = malloc(nCachedImageSize);
+	if (!pImage)
+		return NULL;
+	memcpy(pImage, pCachedImage, nCachedImageSize);
+	*pnFileSize = nCachedImageSize;
+	return pImage;
+#else
+	return HFile_Read(ConfigureParams.Rom.szTosImageFileName, pnFileSize, pszTosNameExts);
+#endif
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Load TOS Rom image file into ST memory space and fix image so it can be
@@ -576,7 +631,7 @@ int TOS_LoadImage(void)
 
 	/* Load TOS image into memory so that we can check its version */
 	TosVersion = 0;
-	pTosFile = HFile_Read(ConfigureParams.Rom.szTosImageFileName, &nFileSize, pszTosNameExts);
+	pTosFile = TOS_ReadImage(&nFileSize);
 
 	if (!pTosFile || nFileSize <= 0)
 	{
@@ -647,6 +702,7 @@ int TOS_LoadImage(void)
 	/* (Re-)Initialize the memory banks: */
 	memory_uninit();
 	memory_init(STRamEnd, 0, TosAddress);
+	STMemory_ReleaseUnused();
 
 	/* Clear Upper memory (ROM and IO memory) */
 	memset(&RomMem[0xe00000], 0, 0x200000);
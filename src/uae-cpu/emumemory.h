@@ -15,6 +15,7 @@
 #define UAE_MEMORY_H
 
 #include "maccess.h"
+#include "stMemory.h"
 
 #define call_mem_get_func(func, addr) ((*func)(addr))
 #define call_mem_put_func(func, addr, v) ((*func)(addr, v))
@@ -68,6 +69,14 @@ extern addrbank mem_banks[65536];
 
 extern void memory_init(uae_u32 nNewSTMemSize, uae_u32 nNewTTMemSize, uae_u32 nNewRomMemStart);
 extern void memory_uninit (void);
+extern void memory_set_dirty_tracking(bool bEnable);
+extern void memory_set_watch_handler(void (*handler)(uaecptr addr, int size));
+extern void memory_watch_bank(uaecptr addr);
+extern void memory_set_access_handler(void (*handler)(uaecptr addr, int size, bool bWrite));
+extern bool memory_is_plain_stram(uaecptr addr, uae_u32 size);
+extern bool memory_is_plain_read(uaecptr addr, uae_u32 size);
+extern bool memory_is_ide(uaecptr addr);
+extern void memory_set_fetch_window(uaecptr addr);
 extern void map_banks(addrbank *bank, int first, int count);
 
 #ifndef NO_INLINE_MEMORY_ACCESS
@@ -93,34 +102,57 @@ extern void byteput(uaecptr addr, uae_u32 b);
 #endif
 
 
+/* Nearly all CPU accesses go to plain ST RAM, so these are done directly
+ * without calling the memory bank functions. Only the RAM between 0x800
+ * and the end of ST RAM qualifies, the system area below needs the special
+ * checks from the SysMem bank. */
+extern uae_u32 STmem_direct_get, STmem_direct_put;
+
+#define STMEM_DIRECT(addr, limit) ((uae_u32)((addr) - 0x800) < (limit))
+
 static inline uae_u32 get_long(uaecptr addr)
 {
+    if (likely(STMEM_DIRECT(addr, STmem_direct_get)))
+	return do_get_mem_long(STRam + addr);
     return longget(addr);
 }
 
 static inline uae_u32 get_word(uaecptr addr)
 {
+    if (likely(STMEM_DIRECT(addr, STmem_direct_get)))
+	return do_get_mem_word(STRam + addr);
     return wordget(addr);
 }
 
 static inline uae_u32 get_byte(uaecptr addr)
 {
+    if (likely(STMEM_DIRECT(addr, STmem_direct_get)))
+	return STRam[addr];
     return byteget(addr);
 }
 
 static inline void put_long(uaecptr addr, uae_u32 l)
 {
-    longput(addr, l);
+    if (likely(STMEM_DIRECT(addr, STmem_direct_put)))
+	do_put_mem_long(STRam + addr, l);
+    else
+	longput(addr, l);
 }
 
 static inline void put_word(uaecptr addr, uae_u32 w)
 {
-    wordput(addr, w);
+    if (likely(STMEM_DIRECT(addr, STmem_direct_put)))
+	do_put_mem_word(STRam + addr, w);
+    else
+	wordput(addr, w);
 }
 
 static inline void put_byte(uaecptr addr, uae_u32 b)
 {
-    byteput(addr, b);
+    if (likely(STMEM_DIRECT(addr, STmem_direct_put)))
+	STRam[addr] = b;
+    else
+	byteput(addr, b);
 }
 
 static inline uae_u8 *get_real_address(uaecptr addr)
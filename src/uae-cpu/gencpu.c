@@ -108,7 +108,7 @@ static int *opcode_last_postfix;
 static unsigned long *counts;
 
 
-static void read_counts (void)
+static void read_counts (const char *countsname)
 {
     FILE *file;
     unsigned long opcode, count, total;
@@ -116,7 +116,7 @@ static void read_counts (void)
     int nr = 0;
     memset (counts, 0, 65536 * sizeof *counts);
 
-    file = fopen ("frequent.68k", "r");
+    file = fopen (countsname, "r");
     if (file) {
 	if (fscanf (file, "Total: %lu\n", &total) == EOF) {
 	    perror("read_counts");
@@ -764,12 +764,10 @@ static void genflags_normal (flagtypes type, wordsizes size, const char *value,
     switch (type) {
      case flag_logical:
 	printf ("\tCLEAR_CZNV;\n");
-	printf ("\tSET_ZFLG (%s == 0);\n", vstr);
-	printf ("\tSET_NFLG (%s < 0);\n", vstr);
+	printf ("\tSET_NZFLG (%s);\n", vstr);
 	break;
      case flag_logical_noclobber:
-	printf ("\tSET_ZFLG (%s == 0);\n", vstr);
-	printf ("\tSET_NFLG (%s < 0);\n", vstr);
+	printf ("\tSET_NZFLG (%s);\n", vstr);
 	break;
      case flag_av:
 	printf ("\tSET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));\n");
@@ -782,18 +780,16 @@ static void genflags_normal (flagtypes type, wordsizes size, const char *value,
 	printf ("\tSET_NFLG (%s < 0);\n", vstr);
 	break;
      case flag_add:
-	printf ("\tSET_ZFLG (%s == 0);\n", vstr);
+	printf ("\tSET_NZFLG (%s);\n", vstr);
 	printf ("\tSET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));\n");
 	printf ("\tSET_CFLG (%s < %s);\n", undstr, usstr);
 	duplicate_carry ();
-	printf ("\tSET_NFLG (flgn != 0);\n");
 	break;
      case flag_sub:
-	printf ("\tSET_ZFLG (%s == 0);\n", vstr);
+	printf ("\tSET_NZFLG (%s);\n", vstr);
 	printf ("\tSET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));\n");
 	printf ("\tSET_CFLG (%s > %s);\n", usstr, udstr);
 	duplicate_carry ();
-	printf ("\tSET_NFLG (flgn != 0);\n");
 	break;
      case flag_addx:
 	printf ("\tSET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));\n"); /* minterm SON: 0x42 */
@@ -806,10 +802,9 @@ static void genflags_normal (flagtypes type, wordsizes size, const char *value,
 	duplicate_carry ();
 	break;
      case flag_cmp:
-	printf ("\tSET_ZFLG (%s == 0);\n", vstr);
+	printf ("\tSET_NZFLG (%s);\n", vstr);
 	printf ("\tSET_VFLG ((flgs != flgo) && (flgn != flgo));\n");
 	printf ("\tSET_CFLG (%s > %s);\n", usstr, udstr);
-	printf ("\tSET_NFLG (flgn != 0);\n");
 	break;
     }
 }
@@ -2759,13 +2754,22 @@ static void generate_one_opcode (int rp)
     opcode_last_postfix[rp] = postfix;
 }
 
-static void generate_func (void)
+static void generate_func (int only_68000)
 {
     int i, j, rp;
 
     using_prefetch = 0;
     using_exception_3 = 0;
-    for (i = 0; i < 6; i++) {
+    if (only_68000) {
+	/* no 68010+ tables to share handlers with, generate all
+	 * 68000 handlers already for the first (postfix 4) table */
+	for (rp = 0; rp < nr_cpuop_funcs; rp++)
+	    opcode_next_clev[rp] = 0;
+	fprintf (stblfile, "#if !CPU_68000_ONLY\n"
+		 "#error \"68000 only opcode tables need CPU_68000_ONLY\"\n"
+		 "#endif\n");
+    }
+    for (i = only_68000 ? 4 : 0; i < 6; i++) {
 	cpu_level = 4 - i;
 	if (i == 5) {
 	    cpu_level = 0;
@@ -2776,6 +2780,9 @@ static void generate_func (void)
 	}
 
 	postfix = i;
+	/* 68000 only builds (CPU_68000_ONLY) just keep the 68000 tables */
+	if (i == 0)
+	    fprintf (stblfile, "#if !CPU_68000_ONLY\n");
 	fprintf (stblfile, "const struct cputbl CPUFUNC(op_smalltbl_%d)[] = {\n", postfix);
 
 	/* sam: this is for people with low memory (eg. me :)) */
@@ -2805,12 +2812,33 @@ static void generate_func (void)
 	}
 
 	fprintf (stblfile, "{ 0, 0, 0 }};\n");
+	if (i == 3)
+	    fprintf (stblfile, "#endif\n");
     }
 
 }
 
 int main (int argc, char **argv)
 {
+    const char *countsname = "frequent.68k";
+    int only_68000 = 0;
+    int i;
+
+    /* --68000-only: generate just the 68000 (ST/STE) opcode tables
+     * --counts <file>: order handlers by the opcode counts in <file>,
+     *   e.g. saved with the debugger "opcodes save" command
+     */
+    for (i = 1; i < argc; i++) {
+	if (strcmp (argv[i], "--68000-only") == 0)
+	    only_68000 = 1;
+	else if (strcmp (argv[i], "--counts") == 0 && i + 1 < argc)
+	    countsname = argv[++i];
+	else {
+	    fprintf (stderr, "usage: %s [--68000-only] [--counts <file>]\n", argv[0]);
+	    return -1;
+	}
+    }
+
     read_table68k ();
     do_merges ();
 
@@ -2818,7 +2846,7 @@ int main (int argc, char **argv)
     opcode_last_postfix = (int *) malloc (sizeof (int) * nr_cpuop_funcs);
     opcode_next_clev = (int *) malloc (sizeof (int) * nr_cpuop_funcs);
     counts = (unsigned long *) malloc (65536 * sizeof (unsigned long));
-    read_counts ();
+    read_counts (countsname);
 
     /* It would be a lot nicer to put all in one file (we'd also get rid of
      * cputbl.h that way), but cpuopti can't cope.  That could be fixed, but
@@ -2834,7 +2862,7 @@ int main (int argc, char **argv)
     generate_includes (stdout);
     generate_includes (stblfile);
 
-    generate_func ();
+    generate_func (only_68000);
 
     free (table68k);
     return 0;
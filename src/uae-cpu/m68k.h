@@ -7,18 +7,21 @@
   */
 
  
+/* Z and N are evaluated lazily: z holds a value which is zero when
+ * the Z flag is set, n a value which is negative when N is set, so an
+ * operation can store its (sign extended) result in both. */
 struct flag_struct {
     unsigned int c;
-    unsigned int z;
-    unsigned int n;
+    int z;
+    int n;
     unsigned int v; 
     unsigned int x;
 };
 
 extern struct flag_struct regflags;
 
-#define ZFLG (regflags.z)
-#define NFLG (regflags.n)
+#define ZFLG (regflags.z == 0)
+#define NFLG (regflags.n < 0)
 #define CFLG (regflags.c)
 #define VFLG (regflags.v)
 #define XFLG (regflags.x)
@@ -160,6 +160,10 @@ const char NewCpu_fileid[] = "Hatari newcpu.c : " __DATE__ " " __TIME__;
 #include "debugui.h"
 #include "debugcpu.h"
 #include "68kDisass.h"
+#include "stMemory.h"
+#include "stats.h"
+#include "ioMem.h"
+#include "ide.h"
 
 #ifdef HAVE_CAPSIMAGE
 #if CAPSIMAGE_VERSION == 5
@@ -193,8 +197,13 @@ int fpp_movem_next[256];
 
 cpuop_func *cpufunctbl[65536];
 
-int OpcodeFamily;
-int BusCyclePenalty = 0;
+#if ENABLE_COMPACT_DISPATCH
+/* cpufunctbl is only used while setting up the handlers, the emulation
+ * dispatches through an index per opcode into the distinct handlers */
+uae_u16 cpufuncidx[65536];
+cpuop_func *cpufuncs[CPUFUNCS_MAX];
+#endif
+
 
 #define COUNT_INSTRS 0
 
@@ -258,16 +267,39 @@ static unsigned long REGPARAM2 op_illg_1 (uae_u32 opcode)
 }
 
 
+/*
+ * Builds with CPU_68000_ONLY only contain the 68000 opcode handlers
+ * (the linker drops the others), so other CPU levels fall back to it.
+ */
+static void check_cpu_level(void)
+{
+#if CPU_68000_ONLY
+    if (currprefs.cpu_level > 0) {
+	Log_Printf(LOG_WARN, "This build only emulates the 68000, using it instead of the 680%d0.\n",
+	           currprefs.cpu_level);
+	currprefs.cpu_level = changed_prefs.cpu_level = 0;
+    }
+#endif
+}
+
+
 void build_cpufunctbl(void)
 {
     int i;
     unsigned long opcode;
-    const struct cputbl *tbl = (currprefs.cpu_level == 4 ? op_smalltbl_0_ff
-			      : currprefs.cpu_level == 3 ? op_smalltbl_1_ff
-			      : currprefs.cpu_level == 2 ? op_smalltbl_2_ff
-			      : currprefs.cpu_level == 1 ? op_smalltbl_3_ff
-			      : ! currprefs.cpu_compatible ? op_smalltbl_4_ff
-			      : op_smalltbl_5_ff);
+    const struct cputbl *tbl;
+
+    check_cpu_level();
+#if CPU_68000_ONLY
+    tbl = ! currprefs.cpu_compatible ? op_smalltbl_4_ff : op_smalltbl_5_ff;
+#else
+    tbl = (currprefs.cpu_level == 4 ? op_smalltbl_0_ff
+	   : currprefs.cpu_level == 3 ? op_smalltbl_1_ff
+	   : currprefs.cpu_level == 2 ? op_smalltbl_2_ff
+	   : currprefs.cpu_level == 1 ? op_smalltbl_3_ff
+	   : ! currprefs.cpu_compatible ? op_smalltbl_4_ff
+	   : op_smalltbl_5_ff);
+#endif
 
     Log_Printf(LOG_DEBUG, "Building CPU function table (%d %d %d).\n",
 	           currprefs.cpu_level, currprefs.cpu_compatible, currprefs.address_space_24);
@@ -295,9 +327,55 @@ void build_cpufunctbl(void)
 	if (tbl[i].specific)
 	    cpufunctbl[tbl[i].opcode] = tbl[i].handler;
     }
+#if ENABLE_COMPACT_DISPATCH
+    build_cpufunc_dispatch();
+#endif
 }
 
 
+#if ENABLE_COMPACT_DISPATCH
+/*
+ * Compact cpufunctbl into the dispatch tables, has to be called again
+ * whenever cpufunctbl is changed. Handlers are stored in the order of
+ * their first opcode, so the ones of the same instruction line are
+ * next to each other.
+ */
+void build_cpufunc_dispatch(void)
+{
+#define CPUFUNCS_HASH 8192	/* power of 2, larger than CPUFUNCS_MAX */
+    static uae_u16 hash[CPUFUNCS_HASH];	/* handler index + 1, 0 = free */
+    unsigned long opcode;
+    int nfuncs = 0, n = 0;
+
+    memset(hash, 0, sizeof(hash));
+    for (opcode = 0; opcode < 65536; opcode++) {
+	cpuop_func *f = cpufunctbl[opcode];
+	unsigned int h;
+
+	/* neighbour opcodes usually share the handler */
+	if (nfuncs && cpufuncs[n] == f) {
+	    cpufuncidx[opcode] = n;
+	    continue;
+	}
+	h = ((uintptr_t)f >> 4) & (CPUFUNCS_HASH - 1);
+	while (hash[h] && cpufuncs[hash[h] - 1] != f)
+	    h = (h + 1) & (CPUFUNCS_HASH - 1);
+	if (!hash[h]) {
+	    if (nfuncs == CPUFUNCS_MAX) {
+		fprintf(stderr, "build_cpufunc_dispatch: too many opcode handlers!\n");
+		abort();
+	    }
+	    cpufuncs[nfuncs++] = f;
+	    hash[h] = nfuncs;
+	}
+	n = hash[h] - 1;
+	cpufuncidx[opcode] = n;
+    }
+    Log_Printf(LOG_DEBUG, "CPU dispatch table has %d distinct handlers.\n", nfuncs);
+}
+#endif
+
+
 
 void init_m68k (void)
 {
@@ -337,6 +415,7 @@ void init_m68k (void)
 	}
     }
 #endif
+    check_cpu_level();
     write_log ("Building CPU table for configuration: 68");
     if (currprefs.address_space_24 && currprefs.cpu_level > 1)
         write_log ("EC");
@@ -868,6 +947,483 @@ static void InterruptAddJitter (int Level , int Pending)
 }
 
 
+/* Guarded fast path for one instruction dbf loops working on ST RAM, like */
+/*	loop:	move.l	(a0)+,(a1)+						*/
+/*		dbf	d0,loop							*/
+/* Such loops first run normally. When the dbf branches back to the same body */
+/* twice in a row with nothing else happening in between, the cycles taken by */
+/* one iteration are known and further iterations are done in bulk, as long */
+/* as they can't reach the next interrupt. The emulated timings are thus */
+/* the same as when running the loop instruction by instruction. */
+/* Loops reading sectors from the IDE data register with move.x (Ay),(Ax)+ */
+/* are done the same way, by one copy from the IDE sector buffer. */
+static struct {
+    uaecptr pc;			/* loop body of the last dbf, 0 if none */
+    int pending;		/* PendingInterruptCount after that dbf */
+    int main_cycles;		/* nCyclesMainCounter after that dbf */
+    Uint64 clock;		/* CyclesGlobalClockCounter after that dbf */
+    int last_family;		/* pairing state after that dbf */
+    int last_cycles;
+} dbf_loop;
+
+/* Run as many iterations of the loop at 'pc' as possible in bulk, each */
+/* of them taking the given amount of cycles. 'body' is the loop body opcode */
+/* and 'counter' the data register used by the dbf. */
+static void dbf_loop_run (uaecptr pc, uae_u32 body, int counter,
+			  int iter_pending, int iter_main, Uint64 iter_clock)
+{
+    int size, dst, src = -1, src_mode;
+    uae_u32 n, len, to, from = 0;
+    uae_u8 *d;
+
+    if ((body & 0xc1f8) == 0x00d8 || (body & 0xc1f8) == 0x00c0
+	|| (body & 0xc1f8) == 0x00d0) {
+	/* move.x (Ay)+,(Ax)+, move.x Dy,(Ax)+ or move.x (Ay),(Ax)+ */
+	switch (body >> 12) {
+	 case 1: size = 1; break;
+	 case 3: size = 2; break;
+	 case 2: size = 4; break;
+	 default: return;
+	}
+	dst = (body >> 9) & 7;
+	src = body & 7;
+	src_mode = (body >> 3) & 7;
+	if (src_mode == 0 ? src == counter : (src == 7 || src == dst))
+	    return;
+    } else if ((body & 0xff38) == 0x4218 && (body & 0xc0) != 0xc0) {
+	/* clr.x (Ax)+ */
+	size = 1 << ((body >> 6) & 3);
+	dst = body & 7;
+	src_mode = -1;
+    } else
+	return;
+    if (dst == 7 || iter_pending <= 0 || LOG_TRACE_LEVEL(TRACE_CPU_DISASM))
+	return;
+
+    /* Keep at least the last iteration for the normal loop, so that */
+    /* flags and the loop exit are handled by the instructions themselves */
+    n = m68k_dreg (regs, counter) & 0xffff;
+    if ((uae_u32)(PendingInterruptCount - 1) / iter_pending < n)
+	n = (PendingInterruptCount - 1) / iter_pending;
+    if (n == 0)
+	return;
+
+    len = n * size;
+    to = m68k_areg (regs, dst);
+    if ((size > 1 && (to & 1)) || !memory_is_plain_stram (to, len)
+	|| (to < pc + 6 && pc < to + len))
+	return;
+    if (src_mode == 3) {
+	from = m68k_areg (regs, src);
+	if ((size > 1 && (from & 1)) || !memory_is_plain_stram (from, len))
+	    return;
+	/* with overlapping ranges, bytes must be copied in the same order */
+	/* as the loop does, which allows no overlap within an element */
+	if (to > from && to < from + len && to - from < (uae_u32)size)
+	    return;
+    }
+
+    d = STRam + to;
+    if (src_mode == 2) {
+	/* only sector reads from the IDE data register */
+	if (size == 1 || !memory_is_ide (m68k_areg (regs, src)))
+	    return;
+	n = Ide_Mem_ReadBurst (m68k_areg (regs, src), d, size, n);
+	if (n == 0)
+	    return;
+	len = n * size;
+    } else if (src_mode < 0) {
+	memset (d, 0, len);
+    } else if (src_mode == 0) {
+	uae_u32 v = m68k_dreg (regs, src);
+	uae_u32 i;
+	for (i = 0; i < n; i++, d += size) {
+	    if (size == 4)
+		do_put_mem_long ((uae_u32 *)d, v);
+	    else if (size == 2)
+		do_put_mem_word ((uae_u16 *)d, v);
+	    else
+		*d = v;
+	}
+    } else if (to > from && to < from + len) {
+	const uae_u8 *s = STRam + from;
+	uae_u32 i;
+	for (i = 0; i < len; i++)
+	    d[i] = s[i];
+    } else {
+	memmove (d, STRam + from, len);
+    }
+    STMemory_MarkDirty (to, len);
+
+    m68k_areg (regs, dst) += len;
+    if (src_mode == 3)
+	m68k_areg (regs, src) += len;
+    m68k_dreg (regs, counter) -= n;
+
+    PendingInterruptCount -= n * iter_pending;
+    nCyclesMainCounter += n * iter_main;
+    CyclesGlobalClockCounter += n * iter_clock;
+    Stats_Add (STATS_CPU_INSTR, 2 * n);
+}
+
+/* Called after a dbf with no pending special flags, 'body' is the */
+/* next instruction opcode */
+static void dbf_loop_check (uae_u32 opcode, uae_u32 body)
+{
+    uaecptr pc = m68k_getpc ();
+
+    /* only loops with a one word body where dbf branched back */
+    if (pc != BusErrorPC - 2 || bDspEnabled) {
+	dbf_loop.pc = 0;
+	return;
+    }
+
+    if (dbf_loop.pc == pc && dbf_loop.last_family == LastOpcodeFamily
+	&& dbf_loop.last_cycles == LastInstrCycles)
+	dbf_loop_run (pc, body, opcode & 7, dbf_loop.pending - PendingInterruptCount,
+		      nCyclesMainCounter - dbf_loop.main_cycles,
+		      CyclesGlobalClockCounter - dbf_loop.clock);
+
+    dbf_loop.pc = pc;
+    dbf_loop.pending = PendingInterruptCount;
+    dbf_loop.main_cycles = nCyclesMainCounter;
+    dbf_loop.clock = CyclesGlobalClockCounter;
+    dbf_loop.last_family = LastOpcodeFamily;
+    dbf_loop.last_cycles = LastInstrCycles;
+}
+
+
+/* Fast path for idle loops polling memory that only an interrupt changes, */
+/* like waiting for the next VBL with					*/
+/*	loop:	cmp.l	$466.w,d0						*/
+/*		beq.s	loop							*/
+/* The loop body may only read registers and plain memory and only write */
+/* registers and flags. When the backward branch ends two iterations in a */
+/* row with the same registers, SR and prefetch, and nothing else happened */
+/* in between, each further iteration does exactly the same until an */
+/* interrupt event changes the memory. As many of them as can't reach the */
+/* next event are then skipped by only adding their cycles. */
+#define IDLE_LOOP_MAX_BODY	16	/* bytes before the branch */
+
+static struct {
+    uaecptr pc;			/* loop head of the last Bcc, 0 if none */
+    uaecptr end;		/* address of that Bcc */
+    bool body_ok;		/* loop body checked by idle_loop_body_ok() */
+    int pending;		/* PendingInterruptCount after that Bcc */
+    int main_cycles;		/* nCyclesMainCounter after that Bcc */
+    Uint64 clock;		/* CyclesGlobalClockCounter after that Bcc */
+    int last_family;		/* pairing state after that Bcc */
+    int last_cycles;
+    uae_u32 regs[16];		/* CPU state after that Bcc */
+    uae_u16 sr;
+    uae_u32 prefetch, prefetch_pc;
+} idle_loop;
+
+/* Skip the extension words of an operand at '*pc', check that it reads */
+/* nothing but registers, immediates or plain memory */
+static bool idle_loop_operand (int mode, int reg, int size, uaecptr *pc)
+{
+    uaecptr addr;
+
+    switch (mode) {
+     case Dreg: case Areg: case immi:
+	return true;
+     case imm:
+	*pc += size == 4 ? 4 : 2;
+	return true;
+     case imm0: case imm1:
+	*pc += 2;
+	return true;
+     case imm2:
+	*pc += 4;
+	return true;
+     case Aind:
+	addr = m68k_areg (regs, reg);
+	break;
+     case Ad16:
+	addr = m68k_areg (regs, reg) + (uae_s16)get_word (*pc);
+	*pc += 2;
+	break;
+     case PC16:
+	addr = *pc + (uae_s16)get_word (*pc);
+	*pc += 2;
+	break;
+     case absw:
+	addr = (uae_s16)get_word (*pc);
+	*pc += 2;
+	break;
+     case absl:
+	addr = get_long (*pc);
+	*pc += 4;
+	break;
+     default:
+	return false;
+    }
+    return memory_is_plain_read (addr, size);
+}
+
+/* Return true if the instructions from 'pc' up to the branch at 'end' */
+/* only compare, test or move registers and plain memory into registers */
+static bool idle_loop_body_ok (uaecptr pc, uaecptr end)
+{
+    if (!memory_is_plain_read (pc, end + 2 - pc))
+	return false;
+
+    while (pc < end) {
+	uae_u32 opcode = get_word (pc);
+	struct instr *dp = table68k + opcode;
+	int size = dp->size == sz_byte ? 1 : dp->size == sz_word ? 2 : 4;
+
+	pc += 2;
+	switch (dp->mnemo) {
+	 case i_NOP:
+	    continue;
+	 case i_TST: case i_CMP: case i_CMPA: case i_BTST:
+	    break;
+	 case i_MOVE: case i_MOVEA: case i_AND: case i_OR:
+	    if (dp->dmode != Dreg && dp->dmode != Areg)
+		return false;
+	    break;
+	 default:
+	    return false;
+	}
+	if (dp->suse && !idle_loop_operand (dp->smode, dp->sreg, size, &pc))
+	    return false;
+	if (dp->duse && !idle_loop_operand (dp->dmode, dp->dreg, size, &pc))
+	    return false;
+    }
+    return pc == end;
+}
+
+/* Called after a Bcc with no pending special flags. As the checked loop */
+/* body contains no branch, two calls in a row for the same loop are always */
+/* separated by exactly one iteration. */
+static void idle_loop_check (void)
+{
+    uaecptr pc = m68k_getpc ();
+    int iter_pending, n;
+
+    /* only short loops where the Bcc branched back */
+    if (pc >= BusErrorPC || BusErrorPC - pc > IDLE_LOOP_MAX_BODY || bDspEnabled) {
+	idle_loop.pc = 0;
+	return;
+    }
+
+    if (idle_loop.pc != pc || idle_loop.end != BusErrorPC) {
+	idle_loop.pc = pc;
+	idle_loop.end = BusErrorPC;
+	idle_loop.body_ok = idle_loop_body_ok (pc, BusErrorPC);
+	if (!idle_loop.body_ok)
+	    return;
+	MakeSR ();
+    } else {
+	if (!idle_loop.body_ok)
+	    return;
+	MakeSR ();
+	if (idle_loop.sr == regs.sr
+	    && idle_loop.last_family == LastOpcodeFamily
+	    && idle_loop.last_cycles == LastInstrCycles
+	    && idle_loop.prefetch == regs.prefetch
+	    && idle_loop.prefetch_pc == regs.prefetch_pc
+	    && memcmp (idle_loop.regs, regs.regs, sizeof (idle_loop.regs)) == 0) {
+	    /* Keep at least the last iteration before the event for the */
+	    /* normal loop, so that the event happens at the same instruction */
+	    iter_pending = idle_loop.pending - PendingInterruptCount;
+	    n = iter_pending > 0 ? (PendingInterruptCount - 1) / iter_pending : 0;
+	    if (n > 0 && !LOG_TRACE_LEVEL(TRACE_CPU_DISASM)
+		&& idle_loop_body_ok (pc, BusErrorPC)) {
+		PendingInterruptCount -= n * iter_pending;
+		nCyclesMainCounter += n * (nCyclesMainCounter - idle_loop.main_cycles);
+		CyclesGlobalClockCounter += n * (CyclesGlobalClockCounter - idle_loop.clock);
+	    }
+	}
+    }
+
+    idle_loop.pending = PendingInterruptCount;
+    idle_loop.main_cycles = nCyclesMainCounter;
+    idle_loop.clock = CyclesGlobalClockCounter;
+    idle_loop.last_family = LastOpcodeFamily;
+    idle_loop.last_cycles = LastInstrCycles;
+    memcpy (idle_loop.regs, regs.regs, sizeof (idle_loop.regs));
+    idle_loop.sr = regs.sr;
+    idle_loop.prefetch = regs.prefetch;
+    idle_loop.prefetch_pc = regs.prefetch_pc;
+}
+
+
+/* Fast path for loops waiting on the DSP host interface, like	*/
+/*	loop:	btst	#1,$ffffa202.w						*/
+/*		beq.s	loop							*/
+/* Such a loop only reads the host status register, which only the DSP */
+/* changes. When two iterations in a row cost the same, the following	*/
+/* ones are done here without interpreting the btst and the Bcc: before	*/
+/* each btst the status must still be the one read last time, then the	*/
+/* cycles of each instruction are added and the DSP runs for them, in	*/
+/* the same order as in m68k_run_1/2. The loop is left at the first	*/
+/* point where the normal loop would do something else: before the btst */
+/* when the status changed, before the Bcc when an interrupt event is	*/
+/* due or the DSP set a special flag.					*/
+typedef struct {
+    int pending;		/* PendingInterruptCount used by the instruction */
+    int cycles;			/* cycles added to the clock by it */
+    int cpu_cycles;		/* CYCLES_COUNTER_CPU after it */
+    int dsp_cycles;		/* cycles given to DSP_Run() for it */
+    int last_family;		/* pairing state after it */
+    int last_cycles;
+    int pairing;
+} dsp_poll_instr_t;
+
+static struct {
+    uaecptr pc;			/* loop head of the last Bcc, 0 if none */
+    uaecptr end;		/* address of that Bcc */
+    bool body_ok;		/* loop body checked by dsp_poll_body_ok() */
+    uae_u16 sr;			/* SR after that Bcc */
+    dsp_poll_instr_t btst;	/* costs of the iteration ending at that Bcc */
+    dsp_poll_instr_t bcc;
+    dsp_poll_instr_t prev;	/* costs of the previous instruction */
+    int pending;		/* PendingInterruptCount after the previous DSP_Run() */
+    Uint64 clock;		/* CyclesGlobalClockCounter after it */
+} dsp_poll;
+
+/* Return true if the only instruction from 'pc' up to the Bcc at 'end' */
+/* is a btst of the DSP host status register */
+static bool dsp_poll_body_ok (uaecptr pc, uaecptr end)
+{
+    uae_u32 opcode, bcc;
+    struct instr *dp;
+    uaecptr addr;
+
+    if (!memory_is_plain_read (pc, end + 2 - pc))
+	return false;
+
+    /* no bra or bsr */
+    bcc = get_word (end);
+    if ((bcc & 0xfe00) == 0x6000)
+	return false;
+
+    opcode = get_word (pc);
+    dp = table68k + opcode;
+    if (dp->mnemo != i_BTST || dp->smode != imm1)
+	return false;
+
+    pc += 4;
+    switch (dp->dmode) {
+     case Aind:
+	addr = m68k_areg (regs, dp->dreg);
+	break;
+     case Ad16:
+	addr = m68k_areg (regs, dp->dreg) + (uae_s16)get_word (pc);
+	pc += 2;
+	break;
+     case absw:
+	addr = (uae_s16)get_word (pc);
+	pc += 2;
+	break;
+     case absl:
+	addr = get_long (pc);
+	pc += 4;
+	break;
+     default:
+	return false;
+    }
+    return pc == end && (addr & 0xffffff) == 0xffa202;
+}
+
+/* Do what running an instruction with the given costs did, except the DSP */
+static void dsp_poll_add (const dsp_poll_instr_t *instr)
+{
+    PendingInterruptCount -= instr->pending;
+    nCyclesMainCounter += instr->cycles;
+    CyclesGlobalClockCounter += instr->cycles;
+    Cycles_SetCounter(CYCLES_COUNTER_CPU, instr->cpu_cycles);
+    LastOpcodeFamily = instr->last_family;
+    LastInstrCycles = instr->last_cycles;
+    Pairing = instr->pairing;
+    Stats_Add(STATS_CPU_INSTR, 1);
+}
+
+/* Run the iterations of a DSP polling loop as long as they would all */
+/* do the same. 'prefetch' is true for m68k_run_1. Return true if the */
+/* loop was left before the Bcc. */
+static bool dsp_poll_run (bool prefetch)
+{
+    uae_u8 status = IoMem_ReadByte (0xffa202);
+
+    for (;;) {
+	if (PendingInterruptCount <= dsp_poll.btst.pending
+	    || DSP_PeekHostStatus () != status)
+	    return false;
+	dsp_poll_add (&dsp_poll.btst);
+	DSP_Run (dsp_poll.btst.dsp_cycles);
+
+	if (regs.spcflags || PendingInterruptCount <= dsp_poll.bcc.pending) {
+	    /* let the normal loop do the Bcc */
+	    m68k_setpc (dsp_poll.end);
+	    if (prefetch)
+		fill_prefetch_0 ();
+	    return true;
+	}
+	dsp_poll_add (&dsp_poll.bcc);
+	DSP_Run (dsp_poll.bcc.dsp_cycles);
+
+	if (regs.spcflags)
+	    return false;
+    }
+}
+
+/* Called for a Bcc with no pending special flags, 'instr' are its costs */
+static void dsp_poll_check (dsp_poll_instr_t *instr, bool prefetch)
+{
+    uaecptr pc = m68k_getpc ();
+
+    /* only short loops where the Bcc branched back */
+    if (pc >= BusErrorPC || BusErrorPC - pc > 8)
+	return;
+
+    MakeSR ();
+    if (dsp_poll.pc != pc || dsp_poll.end != BusErrorPC) {
+	dsp_poll.pc = pc;
+	dsp_poll.end = BusErrorPC;
+	dsp_poll.body_ok = dsp_poll_body_ok (pc, BusErrorPC);
+    } else if (dsp_poll.body_ok && dsp_poll.sr == regs.sr
+	       && memcmp (&dsp_poll.btst, &dsp_poll.prev, sizeof (*instr)) == 0
+	       && memcmp (&dsp_poll.bcc, instr, sizeof (*instr)) == 0
+	       && !LOG_TRACE_LEVEL(TRACE_CPU_DISASM)
+	       && dsp_poll_body_ok (pc, BusErrorPC)
+	       && dsp_poll_run (prefetch)) {
+	/* the last instruction done was a btst */
+	dsp_poll.pc = 0;
+	*instr = dsp_poll.btst;
+    }
+    dsp_poll.sr = regs.sr;
+    dsp_poll.btst = dsp_poll.prev;
+    dsp_poll.bcc = *instr;
+}
+
+/* Called after each instruction when DSP emulation is enabled, with */
+/* the CPU cycles counter and PendingInterruptCount from before the DSP */
+/* ran for that instruction */
+static inline void dsp_poll_update (uae_u32 opcode, int cpu_cycles, int dsp_cycles, int pending, bool prefetch)
+{
+    dsp_poll_instr_t instr;
+
+    instr.pending = dsp_poll.pending - pending;
+    instr.cycles = CyclesGlobalClockCounter - dsp_poll.clock;
+    instr.cpu_cycles = cpu_cycles;
+    instr.dsp_cycles = dsp_cycles;
+    instr.last_family = LastOpcodeFamily;
+    instr.last_cycles = LastInstrCycles;
+    instr.pairing = Pairing;
+
+    if ((opcode & 0xf000) == 0x6000 && !regs.spcflags)
+	dsp_poll_check (&instr, prefetch);
+
+    dsp_poll.prev = instr;
+    dsp_poll.pending = PendingInterruptCount;
+    dsp_poll.clock = CyclesGlobalClockCounter;
+}
+
+
 /* Handle exceptions. We need a special case to handle MFP exceptions */
 /* on Atari ST, because it's possible to change the MFP's vector base */
 /* and get a conflict with 'normal' cpu exceptions. */
@@ -875,6 +1431,10 @@ void Exception(int nr, uaecptr oldpc, int ExceptionSource)
 {
     uae_u32 currpc = m68k_getpc () , newpc;
 
+    dbf_loop.pc = 0;
+    idle_loop.pc = 0;
+    dsp_poll.pc = 0;
+
     /*if( nr>=2 && nr<10 )  fprintf(stderr,"Exception (-> %i bombs)!\n",nr);*/
 
     /* Pending bits / vector number can change before the end of the IACK sequence. */
@@ -884,7 +1444,8 @@ void Exception(int nr, uaecptr oldpc, int ExceptionSource)
         M68000_AddCycles ( CPU_IACK_CYCLES_MFP );
 	CPU_IACK = true;
         while ( ( PendingInterruptCount <= 0 ) && ( PendingInterruptFunction ) )
-            CALL_VAR(PendingInterruptFunction);
+            CycInt_CallPendingHandler();
+        CycInt_HandlersDone();
         nr = MFP_ProcessIACK ( nr );
 	CPU_IACK = false;
     }
@@ -893,7 +1454,8 @@ void Exception(int nr, uaecptr oldpc, int ExceptionSource)
         M68000_AddCycles ( CPU_IACK_CYCLES_VIDEO );
 	CPU_IACK = true;
         while ( ( PendingInterruptCount <= 0 ) && ( PendingInterruptFunction ) )
-            CALL_VAR(PendingInterruptFunction);
+            CycInt_CallPendingHandler();
+        CycInt_HandlersDone();
         if ( MFP_UpdateNeeded == true )
             MFP_UpdateIRQ ( 0 );					/* update MFP's state if some internal timers related to MFP expired */
         pendingInterrupts &= ~( 1 << ( nr - 24 ) );			/* clear HBL or VBL pending bit */
@@ -915,6 +1477,7 @@ void Exception(int nr, uaecptr oldpc, int ExceptionSource)
             VDI_OldPC = currpc;
             currpc = CART_VDI_OPCODE_ADDR;
           }
+          else if (bVdiAesIntercept && VDI_Accelerate())  return;
         }
         else if (nr == 0x2d)
         {
@@ -1515,8 +2078,25 @@ void m68k_mull (uae_u32 opcode, uae_u32 src, uae_u16 extra)
 }
 
 
+/*
+ * Prefetch word outside of the current fetch window (see fetch_word()):
+ * move the window to the bank of addr, or read through the memory bank
+ * if that bank can't be read directly.
+ */
+uae_u32 fetch_word_slow (uaecptr addr)
+{
+    memory_set_fetch_window (addr);
+    if (addr - regs.fetch_start < regs.fetch_size)
+	return do_get_mem_word (regs.fetch_p + (addr - regs.fetch_start));
+    return get_word (addr);
+}
+
+
 void m68k_reset (void)
 {
+    dbf_loop.pc = 0;
+    idle_loop.pc = 0;
+    dsp_poll.pc = 0;
     regs.s = 1;
     regs.m = 0;
     regs.stopped = 0;
@@ -1647,6 +2227,37 @@ static bool do_specialties_interrupt (int Pending)
 }
 
 
+/* Wait in the STOP state for the next matching interrupt.
+ * Returns 1 if the CPU core has to return first (quit or end of frame). */
+static int do_specialties_stop (void)
+{
+    while (regs.spcflags & SPCFLAG_STOP) {
+
+	/* Take care of quit event if needed */
+	if (regs.spcflags & SPCFLAG_BRK)
+	    return 1;
+
+	M68000_AddCycles(4);
+
+	/* It is possible one or more ints happen at the same time */
+	/* We must process them during the same cpu cycle then choose the highest priority one */
+	while ( ( PendingInterruptCount <= 0 ) && ( PendingInterruptFunction ) )
+	    CycInt_CallPendingHandler();
+	CycInt_HandlersDone();
+	if ( MFP_UpdateNeeded == true )
+	    MFP_UpdateIRQ ( 0 );
+
+	/* Check is there's an interrupt to process (could be a delayed MFP interrupt) */
+	if ( do_specialties_interrupt(false) ) {	/* test if there's an interrupt and add non pending jitter */
+	    regs.stopped = 0;
+	    unset_special (SPCFLAG_STOP);
+	}
+    }
+
+    return 0;
+}
+
+
 static int do_specialties (void)
 {
     if(regs.spcflags & SPCFLAG_BUSERROR) {
@@ -1681,27 +2292,8 @@ static int do_specialties (void)
         }
 
 	/* No pending int, we have to wait for the next matching int */
-	while (regs.spcflags & SPCFLAG_STOP) {
-
-	    /* Take care of quit event if needed */
-	    if (regs.spcflags & SPCFLAG_BRK)
-		return 1;
-	
-	    M68000_AddCycles(4);
-	
-	    /* It is possible one or more ints happen at the same time */
-	    /* We must process them during the same cpu cycle then choose the highest priority one */
-	    while ( ( PendingInterruptCount <= 0 ) && ( PendingInterruptFunction ) )
-		CALL_VAR(PendingInterruptFunction);
-	    if ( MFP_UpdateNeeded == true )
-	        MFP_UpdateIRQ ( 0 );
-
-	    /* Check is there's an interrupt to process (could be a delayed MFP interrupt) */
-	    if ( do_specialties_interrupt(false) ) {	/* test if there's an interrupt and add non pending jitter */
-		regs.stopped = 0;
-		unset_special (SPCFLAG_STOP);
-	    }
-	}
+	if (do_specialties_stop ())
+	    return 1;
     }
 
 
@@ -1800,7 +2392,8 @@ static void m68k_run_1 (void)
 	//if ( CAPSGetDebugRequest() )
 	//  DebugUI(REASON_CPU_BREAKPOINT);
 
-	cycles = (*cpufunctbl[opcode])(opcode);
+	cycles = (*CPU_DISPATCH(opcode))(opcode);
+	Stats_Add(STATS_CPU_INSTR, 1);
 //fprintf (stderr, "ir out %x %x\n",do_get_mem_long(&regs.prefetch) , regs.prefetch_pc);
 
 #ifdef DEBUG_PREFETCH
@@ -1826,20 +2419,34 @@ static void m68k_run_1 (void)
 	/* For performance, we first test PendingInterruptCount, then regs.spcflags */
 	if ( PendingInterruptCount <= 0 )
 	{
+	    dbf_loop.pc = 0;
+	    idle_loop.pc = 0;
+	    dsp_poll.pc = 0;
 	    while ( ( PendingInterruptCount <= 0 ) && ( PendingInterruptFunction ) && ( ( regs.spcflags & SPCFLAG_STOP ) == 0 ) )
-		CALL_VAR ( PendingInterruptFunction );		/* call the interrupt's handler */
+		CycInt_CallPendingHandler();		/* call the interrupt's handler */
+	    CycInt_HandlersDone();
 	    if ( MFP_UpdateNeeded == true )
 		MFP_UpdateIRQ ( 0 );				/* update MFP's state if some internal timers related to MFP expired */
 	}
 
 	if (regs.spcflags) {
+	    dbf_loop.pc = 0;
+	    idle_loop.pc = 0;
+	    dsp_poll.pc = 0;
 	    if (do_specialties ())
 		return;
 	}
+	else if ((opcode & 0xfff8) == 0x51c8)
+	    dbf_loop_check (opcode, get_iword_prefetch (0));
+	else if ((opcode & 0xf000) == 0x6000)
+	    idle_loop_check ();
 
 	/* Run DSP 56k code if necessary */
 	if (bDspEnabled) {
-	    DSP_Run( Cycles_GetCounter(CYCLES_COUNTER_CPU) * 2);
+	    int cpu_cycles = Cycles_GetCounter(CYCLES_COUNTER_CPU);
+	    int pending = PendingInterruptCount;
+	    DSP_Run(cpu_cycles * 2);
+	    dsp_poll_update (opcode, cpu_cycles, cpu_cycles * 2, pending, true);
 	}
     }
 }
@@ -1876,7 +2483,8 @@ static void m68k_run_2 (void)
 	/* the error to build the exception stack frame */
 	BusErrorPC = m68k_getpc();
 
-	cycles = (*cpufunctbl[opcode])(opcode);
+	cycles = (*CPU_DISPATCH(opcode))(opcode);
+	Stats_Add(STATS_CPU_INSTR, 1);
 
 	if (bDspEnabled)
 	    Cycles_SetCounter(CYCLES_COUNTER_CPU, 0);	/* to measure the total number of cycles spent in the cpu */
@@ -1891,25 +2499,65 @@ static void m68k_run_2 (void)
 
         if ( PendingInterruptCount <= 0 )
 	{
+	    dbf_loop.pc = 0;
+	    idle_loop.pc = 0;
+	    dsp_poll.pc = 0;
 	    while ( ( PendingInterruptCount <= 0 ) && ( PendingInterruptFunction ) )
-		CALL_VAR(PendingInterruptFunction);
+		CycInt_CallPendingHandler();
+	    CycInt_HandlersDone();
 	    if ( MFP_UpdateNeeded == true )
 		MFP_UpdateIRQ ( 0 );
 	}
 
 	if (regs.spcflags) {
+	    dbf_loop.pc = 0;
+	    idle_loop.pc = 0;
+	    dsp_poll.pc = 0;
 	    if (do_specialties ())
 		return;
 	}
+	else if ((opcode & 0xfff8) == 0x51c8)
+	    dbf_loop_check (opcode, get_iword (0));
+	else if ((opcode & 0xf000) == 0x6000)
+	    idle_loop_check ();
 
 	/* Run DSP 56k code if necessary */
 	if (bDspEnabled) {
-	    DSP_Run( Cycles_GetCounter(CYCLES_COUNTER_CPU) );
+	    int cpu_cycles = Cycles_GetCounter(CYCLES_COUNTER_CPU);
+	    int pending = PendingInterruptCount;
+	    DSP_Run(cpu_cycles);
+	    dsp_poll_update (opcode, cpu_cycles, cpu_cycles, pending, false);
 	}
     }
 }
 
 
+/* Set when m68k_go() returned at the end of a frame, before the
+ * processing of the current instruction was complete */
+static bool frame_ended;
+
+/* Make m68k_go() return at the end of the current instruction, it can
+ * then be called again to run the next frame */
+void m68k_end_frame (void)
+{
+    frame_ended = true;
+    set_special (SPCFLAG_BRK);
+}
+
+/* Complete the instruction during which the previous frame ended: the
+ * CPU may still be waiting in the STOP state and the DSP has not run
+ * the cycles of this instruction yet */
+static void m68k_resume_frame (void)
+{
+    if ((regs.spcflags & SPCFLAG_STOP) && (do_specialties_stop () || do_specialties ()))
+	return;
+
+    if (bDspEnabled) {
+	int cpu_cycles = Cycles_GetCounter(CYCLES_COUNTER_CPU);
+	DSP_Run(currprefs.cpu_compatible ? cpu_cycles * 2 : cpu_cycles);
+    }
+}
+
 void m68k_go (int may_quit)
 {
     static int in_m68k_go = 0;
@@ -1920,6 +2568,10 @@ void m68k_go (int may_quit)
     }
 
     in_m68k_go++;
+    if (frame_ended) {
+	frame_ended = false;
+	m68k_resume_frame ();
+    }
     while (!(regs.spcflags & SPCFLAG_BRK)) {
         if(currprefs.cpu_compatible)
           m68k_run_1();
@@ -45,11 +45,14 @@
 #ifndef SET_CFLG
 
 #define SET_CFLG(x) (CFLG = (x))
-#define SET_NFLG(x) (NFLG = (x))
+#define SET_NFLG(x) (regflags.n = (x) ? -1 : 0)
 #define SET_VFLG(x) (VFLG = (x))
-#define SET_ZFLG(x) (ZFLG = (x))
+#define SET_ZFLG(x) (regflags.z = !(x))
 #define SET_XFLG(x) (XFLG = (x))
 
+/* Set Z and N from a sign extended result */
+#define SET_NZFLG(v) (regflags.z = regflags.n = (v))
+
 #define GET_CFLG CFLG
 #define GET_NFLG NFLG
 #define GET_VFLG VFLG
@@ -130,6 +133,11 @@ extern struct regstruct
 
     uae_u32 prefetch_pc;
     uae_u32 prefetch;
+
+    /* Host pointer to plain RAM or ROM used by refill_prefetch(), valid
+     * for word reads at fetch_start + [0, fetch_size) */
+    uae_u8 *fetch_p;
+    uae_u32 fetch_start, fetch_size;
 } regs, lastint_regs;
 
 STATIC_INLINE void set_special (uae_u32 x)
@@ -166,6 +174,17 @@ STATIC_INLINE uaecptr m68k_getpc_p (uae_u8 *p)
 #define get_iword(o) do_get_mem_word(regs.pc_p + (o))
 #define get_ilong(o) do_get_mem_long(regs.pc_p + (o))
 
+extern uae_u32 fetch_word_slow (uaecptr addr);
+
+/* Read a prefetch word, directly from the fetch window if addr is inside */
+STATIC_INLINE uae_u32 fetch_word (uaecptr addr)
+{
+    uae_u32 offs = addr - regs.fetch_start;
+    if (likely(offs < regs.fetch_size))
+	return do_get_mem_word (regs.fetch_p + offs);
+    return fetch_word_slow (addr);
+}
+
 STATIC_INLINE void refill_prefetch (uae_u32 currpc, uae_u32 offs)
 {
     uae_u32 t = (currpc + offs) & ~1;
@@ -175,7 +194,7 @@ STATIC_INLINE void refill_prefetch (uae_u32 currpc, uae_u32 offs)
     {
         r = regs.prefetch;
         r <<= 16;
-        r |= get_word (t+2);
+        r |= fetch_word (t+2);
     }
     else
     {
@@ -184,9 +203,9 @@ STATIC_INLINE void refill_prefetch (uae_u32 currpc, uae_u32 offs)
 	/* on a bus error region (eg : get_long(t=213ffffe) doesn't give a bus error, */
 	/* but it should. This should be better handled in memory.c */
 //        r = get_long (t);					/* read 2 new words */
-        r = get_word (t);
+        r = fetch_word (t);
         r <<= 16;
-        r |= get_word (t+2);
+        r |= fetch_word (t+2);
     }
     regs.prefetch = r;
 #else
@@ -194,7 +213,7 @@ STATIC_INLINE void refill_prefetch (uae_u32 currpc, uae_u32 offs)
     {
         r = do_get_mem_word (((uae_u8 *)&regs.prefetch) + 2);
         r <<= 16;
-        r |= get_word (t+2);
+        r |= fetch_word (t+2);
     }
     else
     {
@@ -203,9 +222,9 @@ STATIC_INLINE void refill_prefetch (uae_u32 currpc, uae_u32 offs)
 	/* on a bus error region (eg : get_long(t=213ffffe) doesn't give a bus error, */
 	/* but it should. This should be better handled in memory.c */
 //        r = get_long (t);					/* read 2 new words */
-        r = get_word (t);
+        r = fetch_word (t);
         r <<= 16;
-        r |= get_word (t+2);
+        r |= fetch_word (t+2);
     }
     do_put_mem_long (&regs.prefetch, r);
 #endif
@@ -338,6 +357,7 @@ extern void m68k_mull (uae_u32, uae_u32, uae_u16);
 extern void build_cpufunctbl(void);
 extern void init_m68k (void);
 extern void m68k_go (int);
+extern void m68k_end_frame (void);
 extern void m68k_dumpstate (FILE *, uaecptr *);
 extern void m68k_disasm (FILE *, uaecptr, uaecptr *, int);
 extern void m68k_reset (void);
@@ -381,13 +401,24 @@ extern const struct cputbl op_smalltbl_5_ff[];
 
 extern cpuop_func *cpufunctbl[65536];
 
+#if ENABLE_COMPACT_DISPATCH
+/* 16-bit handler index per opcode, 128 KB instead of 256/512 KB */
+#define CPUFUNCS_MAX 4096
+extern uae_u16 cpufuncidx[65536];
+extern cpuop_func *cpufuncs[CPUFUNCS_MAX];
+extern void build_cpufunc_dispatch(void);
+#define CPU_DISPATCH(opcode) (cpufuncs[cpufuncidx[opcode]])
+#else
+#define CPU_DISPATCH(opcode) (cpufunctbl[opcode])
+#endif
+
 extern uae_u32 caar, cacr;
 
 /* Family of the latest instruction executed (to check for pairing) */
-extern int OpcodeFamily;			/* see instrmnem in readcpu.h */
+#define OpcodeFamily HotState.OpcodeFamily	/* see instrmnem in readcpu.h */
 
 /* How many cycles to add to the current instruction in case a "misaligned" bus acces is made */
 /* (used when addressing mode is d8(an,ix)) */
-extern int BusCyclePenalty;
+#define BusCyclePenalty HotState.BusCyclePenalty
 
 #endif	/* UAE_NEWCPU_H */
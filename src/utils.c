@@ -6,11 +6,16 @@
  *
  * Utils functions :
  *	- CRC32
+ *	- CRC16
+ *	- Hash of memory blocks
+ *	- Pseudo random numbers
  *
  * This file contains various utility functions used by different parts of Hatari.
  */
 const char Utils_fileid[] = "Hatari utils.c : " __DATE__ " " __TIME__;
 
+#include "main.h"
+#include "memorySnapShot.h"
 #include "utils.h"
 
 
@@ -98,3 +103,86 @@ void	crc16_add_byte ( Uint16 *crc , Uint8 c )
         }
 }
 
+
+
+/************************************************************************/
+/* Function used to hash blocks of memory, to compare emulation states.	*/
+/* The hash is FNV-1a over 32 bit little endian words, so that it's	*/
+/* the same on all hosts and much faster than the CRC functions above.	*/
+/*	hash32_reset : call this once to reset the hash.			*/
+/*	hash32_add_block : update the hash with a block of bytes.		*/
+/************************************************************************/
+
+void	hash32_reset ( Uint32 *hash )
+{
+	*hash = HASH32_BASIS;
+}
+
+
+/*--------------------------------------------------------------*/
+/* Update the hash with 'len' bytes. Bytes after the last	*/
+/* complete word are added as a zero padded word.		*/
+/*--------------------------------------------------------------*/
+
+void	hash32_add_block ( Uint32 *hash , const Uint8 *p , int len )
+{
+	Uint32	h = *hash;
+	Uint32	w;
+
+	for ( ; len >= 4 ; p += 4 , len -= 4 )
+	{
+		w = p[0] | ( p[1] << 8 ) | ( p[2] << 16 ) | ( (Uint32)p[3] << 24 );
+		h = ( h ^ w ) * HASH32_PRIME;
+	}
+	if ( len > 0 )
+	{
+		w = 0;
+		while ( len-- > 0 )
+			w = ( w << 8 ) | p[ len ];
+		h = ( h ^ w ) * HASH32_PRIME;
+	}
+	*hash = h;
+}
+
+
+
+/************************************************************************/
+/* Pseudo random numbers for the emulation. Unlike rand(), the sequence	*/
+/* doesn't depend on the host C library and the state is saved in	*/
+/* memory snapshots, so that runs can be reproduced exactly.		*/
+/*	Hatari_srand : set the seed.					*/
+/*	Hatari_rand : return a number between 0 and HATARI_RAND_MAX.	*/
+/************************************************************************/
+
+static Uint32	RandState = 1;
+
+void	Hatari_srand ( Uint32 seed )
+{
+	RandState = seed ? seed : 1;			/* xorshift can't leave 0 */
+}
+
+
+/*--------------------------------------------------------------*/
+/* xorshift32 generator, see G. Marsaglia, "Xorshift RNGs".	*/
+/*--------------------------------------------------------------*/
+
+int	Hatari_rand ( void )
+{
+	Uint32	x = RandState;
+
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	RandState = x;
+	return x & HATARI_RAND_MAX;
+}
+
+
+/*--------------------------------------------------------------*/
+/* Save/Restore snapshot of the random generator state.		*/
+/*--------------------------------------------------------------*/
+
+void	Utils_MemorySnapShot_Capture ( bool bSave )
+{
+	MemorySnapShot_Store ( &RandState , sizeof ( RandState ) );
+}
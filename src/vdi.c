@@ -20,6 +20,7 @@ const char VDI_fileid[] = "Hatari vdi.c : " __DATE__ " " __TIME__;
 #include "screen.h"
 #include "stMemory.h"
 #include "vdi.h"
+#include "vdiAccel.h"
 #include "video.h"
 #include "configuration.h"
 
@@ -159,6 +160,7 @@ void VDI_Reset(void)
 {
 	/* no VDI calls in progress */
 	VDI_OldPC = 0;
+	VDIAccel_Reset();
 }
 
 /*-----------------------------------------------------------------------*/
@@ -852,6 +854,21 @@ bool VDI_AES_Entry(void)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Called on Trap #2 when VDI_AES_Entry() didn't need VDI_Complete().
+ * Return true if the VDI call was serviced natively and the trap
+ * needs to be skipped, like for the intercepted BIOS/XBIOS calls.
+ */
+bool VDI_Accelerate(void)
+{
+	if (!bVdiAccel || Regs[REG_D0] != 0x73 || !STMemory_ValidArea(Regs[REG_D1], 20))
+		return false;
+	/* vectors were stored by VDI_AES_Entry() for this same call */
+	return VDIAccel_Call(VDIOpCode, VDIControl, VDIIntin, VDIPtsin);
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Modify Line-A structure for our VDI resolutions
@@ -897,6 +914,9 @@ void VDI_Complete(void)
 	STMemory_WriteWord(LineABase-0x159*2, VDIHeight-1);  /* WKYRez */
 
 	VDI_LineA(LineABase, FontBase);  /* And modify Line-A structure accordingly */
+
+	if (bVdiAccel)
+		VDIAccel_OpenWorkstation(STMemory_ReadWord(VDIControl+2*6), VDIIntin);
 }
 
 
@@ -0,0 +1,612 @@
+/*
+  Hatari - vdiAccel.c
+
+  This file is distributed under the GNU General Public License, version 2
+  or at your option any later version. Read the file gpl.txt for details.
+
+  Native VDI acceleration for the extended VDI resolutions.
+
+  The most used VDI drawing calls, i.e. solid rectangle fills (v_bar,
+  vr_recfl) and the opaque and transparent raster copies (vro_cpyfm,
+  vrt_cpyfm), are done directly into ST RAM instead of running the TOS
+  VDI code for them on the emulated CPU.
+
+  TOS keeps the workstation attributes in its own private structures,
+  so the attribute calls these drawing calls depend on are followed here
+  for each workstation handle (and still passed on to TOS). A drawing
+  call is serviced natively only when all the state it depends on is
+  known and the result is the same as TOS would produce, otherwise it
+  goes to TOS as before.
+*/
+const char VDIAccel_fileid[] = "Hatari vdiAccel.c : " __DATE__ " " __TIME__;
+
+#include "main.h"
+#include "log.h"
+#include "memorySnapShot.h"
+#include "stMemory.h"
+#include "vdi.h"
+#include "vdiAccel.h"
+
+
+#define VDI_MAX_HANDLES    128
+#define VDI_MAX_LINEBYTES  8192     /* Widest memory form serviced natively */
+#define VDI_UNKNOWN        -1       /* Attribute not set through a followed call */
+
+/* VDI writing modes and fill interiors */
+#define VDI_MD_REPLACE     1
+#define VDI_MD_TRANS       2
+#define VDI_MD_XOR         3
+#define VDI_FIS_SOLID      1
+
+/* Logic operations (vro_cpyfm modes) needed for color expansion */
+#define VDI_ALL_WHITE      0
+#define VDI_S_ONLY         3
+#define VDI_NOTS_AND_D     4
+#define VDI_S_XOR_D        6
+#define VDI_S_OR_D         7
+#define VDI_NOT_S          12
+#define VDI_ALL_BLACK      15
+
+typedef struct
+{
+	bool bTracked;            /* Screen workstation opened while followed */
+	Sint16 nFillInterior;     /* vsf_interior() */
+	Sint16 nFillColor;        /* vsf_color(), as VDI color index */
+	Sint16 nWriteMode;        /* vswr_mode() */
+	Sint16 nClip;             /* vs_clip() flag */
+	Sint16 nClipX1, nClipY1, nClipX2, nClipY2;
+} VDIWORKSTATION;
+
+typedef struct
+{
+	Uint32 addr;
+	int width, height;
+	int planes;
+	int linebytes;
+} VDISURFACE;
+
+bool bVdiAccel = false;           /* Set to true to service VDI calls natively */
+
+static VDIWORKSTATION Workstations[VDI_MAX_HANDLES];
+static Uint16 RowBuffer[VDI_MAX_LINEBYTES/2 + MAX_VDI_PLANES];
+
+/* VDI color index -> hardware pen, as set up by TOS */
+static const Uint8 VdiToPen4[4] = { 0, 3, 1, 2 };
+static const Uint8 VdiToPen16[16] = { 0, 15, 1, 2, 4, 6, 3, 5, 7, 8, 9, 10, 12, 14, 11, 13 };
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Forget all workstations on reset, the ones opened after it
+ * are followed again.
+ */
+void VDIAccel_Reset(void)
+{
+	memset(Workstations, 0, sizeof(Workstations));
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Save/Restore snapshot of the followed workstation attributes.
+ */
+void VDIAccel_MemorySnapShot_Capture(bool bSave)
+{
+	MemorySnapShot_Store(Workstations, sizeof(Workstations));
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return hardware pen for given VDI color index,
+ * or VDI_UNKNOWN if the index isn't valid.
+ */
+static int VDIAccel_Pen(int index)
+{
+	if (index < 0 || index >= (1 << VDIPlanes))
+		return VDI_UNKNOWN;
+	switch (VDIPlanes)
+	{
+	 case 1:
+		return index;
+	 case 2:
+		return VdiToPen4[index];
+	 default:
+		return VdiToPen16[index];
+	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Start following attributes of a workstation opened with given intin
+ * array, if it's a screen workstation using raster coordinates.  Called
+ * on completion of the workstation open, with the new handle.
+ */
+void VDIAccel_OpenWorkstation(Uint16 handle, Uint32 intin)
+{
+	VDIWORKSTATION *ws;
+	Uint16 device, interior, color;
+
+	if (handle == 0 || handle >= VDI_MAX_HANDLES)
+		return;
+	ws = &Workstations[handle];
+	ws->bTracked = false;
+	if (!STMemory_ValidArea(intin, 11*2))
+		return;
+
+	device = STMemory_ReadWord(intin);
+	if (device < 1 || device > 10 || STMemory_ReadWord(intin+10*2) != 2)
+		return;
+	interior = STMemory_ReadWord(intin+7*2);
+	color = STMemory_ReadWord(intin+9*2);
+
+	ws->nFillInterior = interior <= 4 ? interior : VDI_UNKNOWN;
+	ws->nFillColor = color < (1 << VDIPlanes) ? color : VDI_UNKNOWN;
+	ws->nWriteMode = VDI_MD_REPLACE;
+	ws->nClip = 0;
+	ws->bTracked = true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Read rectangle corners from given ptsin address into x1/y1/x2/y2,
+ * sorted so that x1 <= x2 and y1 <= y2.
+ */
+static void VDIAccel_ReadRect(Uint32 ptsin, int *x1, int *y1, int *x2, int *y2)
+{
+	int ax = (Sint16)STMemory_ReadWord(ptsin);
+	int ay = (Sint16)STMemory_ReadWord(ptsin+2);
+	int bx = (Sint16)STMemory_ReadWord(ptsin+4);
+	int by = (Sint16)STMemory_ReadWord(ptsin+6);
+
+	*x1 = ax < bx ? ax : bx;
+	*x2 = ax < bx ? bx : ax;
+	*y1 = ay < by ? ay : by;
+	*y2 = ay < by ? by : ay;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return true if given destination rectangle is drawn the same way
+ * regardless of the workstation clipping.
+ */
+static bool VDIAccel_Unclipped(const VDIWORKSTATION *ws, int x1, int y1, int x2, int y2)
+{
+	if (ws->nClip == 0)
+		return true;
+	return x1 >= ws->nClipX1 && y1 >= ws->nClipY1 &&
+	       x2 <= ws->nClipX2 && y2 <= ws->nClipY2;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Get the VDI screen as a surface.
+ */
+static void VDIAccel_ScreenSurface(VDISURFACE *s)
+{
+	s->addr = STMemory_ReadLong(0x44e);   /* _v_bas_ad */
+	s->width = VDIWidth;
+	s->height = VDIHeight;
+	s->planes = VDIPlanes;
+	s->linebytes = (VDIWidth*VDIPlanes)/8;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return true if surface is of supported depth and completely
+ * within ST RAM.
+ */
+static bool VDIAccel_SurfaceValid(const VDISURFACE *s)
+{
+	if (s->planes < 1 || s->planes > MAX_VDI_PLANES || s->linebytes > VDI_MAX_LINEBYTES)
+		return false;
+	return !(s->addr & 1) && s->addr < STRamEnd &&
+		s->addr + (Uint32)s->linebytes*s->height <= STRamEnd;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Get surface for the MFDB at given address, zero fd_addr meaning
+ * the screen.  Return false if the form isn't in the interleaved
+ * device format, or isn't supported by VDIAccel_SurfaceValid().
+ */
+static bool VDIAccel_Surface(Uint32 mfdb, VDISURFACE *s)
+{
+	int wdwidth;
+
+	if (!STMemory_ValidArea(mfdb, 14))
+		return false;
+	s->addr = STMemory_ReadLong(mfdb);
+	if (s->addr == 0)
+	{
+		VDIAccel_ScreenSurface(s);
+	}
+	else
+	{
+		s->width = STMemory_ReadWord(mfdb+4);
+		s->height = STMemory_ReadWord(mfdb+6);
+		wdwidth = STMemory_ReadWord(mfdb+8);
+		s->planes = STMemory_ReadWord(mfdb+12);
+		/* standard format differs from device one only with planes */
+		if (s->planes > 1 && STMemory_ReadWord(mfdb+10) != 0)
+			return false;
+		if (s->width > wdwidth*16)
+			return false;
+		s->linebytes = wdwidth*2*s->planes;
+	}
+	return VDIAccel_SurfaceValid(s);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return true if given rectangle is within the surface.
+ */
+static bool VDIAccel_InSurface(const VDISURFACE *s, int x1, int y1, int x2, int y2)
+{
+	return x1 >= 0 && y1 >= 0 && x2 < s->width && y2 < s->height;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return result of given VDI logic operation (vro_cpyfm mode)
+ * on source and destination bits.
+ */
+static inline Uint16 VDIAccel_LogicOp(int op, Uint16 s, Uint16 d)
+{
+	Uint16 r = 0;
+
+	if (op & 1)
+		r |= s & d;
+	if (op & 2)
+		r |= s & ~d;
+	if (op & 4)
+		r |= ~s & d;
+	if (op & 8)
+		r |= ~(s | d);
+	return r;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Return 16 bits of given source plane from the row buffer, starting
+ * at bit offset rel from its first word (rel may be negative).
+ * Bits outside the buffered words are zero.
+ */
+static inline Uint16 VDIAccel_SourceBits(int rel, int words, int plane, int planes)
+{
+	int i = (rel + 16) / 16 - 1;
+	Uint32 hi = i >= 0 ? RowBuffer[i*planes + plane] : 0;
+	Uint32 lo = i + 1 < words ? RowBuffer[(i+1)*planes + plane] : 0;
+
+	return (((hi << 16) | lo) << (rel - i*16)) >> 16;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Combine w x h pixels at sx/sy of the source surface (or zero bits
+ * if src is NULL) with the destination surface at dx/dy, using given
+ * logic operation for each destination plane.  Single plane source
+ * is used for all destination planes.  Source rows are buffered,
+ * so overlapping areas within the same form are copied correctly.
+ */
+static void VDIAccel_Blit(const VDISURFACE *src, int sx, int sy,
+                          const VDISURFACE *dst, int dx, int dy,
+                          int w, int h, const Uint8 *ops)
+{
+	int planes = dst->planes;
+	int dw0 = dx >> 4, dw1 = (dx + w - 1) >> 4;
+	Uint16 lmask = 0xffff >> (dx & 15);
+	Uint16 rmask = 0xffff << (15 - ((dx + w - 1) & 15));
+	int sw0 = 0, swords = 0, srel = 0;
+	int row, step = 1, i, k, p;
+
+	if (src)
+	{
+		sw0 = sx >> 4;
+		swords = ((sx + w - 1) >> 4) - sw0 + 1;
+		srel = (sx & 15) - (dx & 15);
+		if (src->addr == dst->addr && sy < dy)
+		{
+			/* moving area down within same form, go bottom-up */
+			sy += h - 1;
+			dy += h - 1;
+			step = -1;
+		}
+	}
+
+	for (row = 0; row < h; row++)
+	{
+		Uint32 dstaddr = dst->addr + dy*dst->linebytes + dw0*planes*2;
+		Uint8 *pDst = &STRam[dstaddr];
+
+		if (src)
+		{
+			Uint8 *pSrc = &STRam[src->addr + sy*src->linebytes + sw0*src->planes*2];
+			for (i = 0; i < swords*src->planes; i++)
+				RowBuffer[i] = do_get_mem_word(pSrc + 2*i);
+		}
+		for (k = dw0; k <= dw1; k++)
+		{
+			Uint16 mask = 0xffff;
+			int rel = srel + (k - dw0)*16;
+
+			if (k == dw0)
+				mask &= lmask;
+			if (k == dw1)
+				mask &= rmask;
+			for (p = 0; p < planes; p++)
+			{
+				Uint16 s = 0, d, r;
+				if (src)
+					s = VDIAccel_SourceBits(rel, swords, src->planes > 1 ? p : 0, src->planes);
+				d = do_get_mem_word(pDst);
+				r = VDIAccel_LogicOp(ops[p], s, d);
+				do_put_mem_word(pDst, (d & ~mask) | (r & mask));
+				pDst += 2;
+			}
+		}
+		STMemory_MarkDirty(dstaddr, (dw1 - dw0 + 1)*planes*2);
+		sy += step;
+		dy += step;
+	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Finish natively serviced call, it has no output values.
+ * Return true so that the trap is skipped.
+ */
+static bool VDIAccel_Done(Uint32 control)
+{
+	STMemory_WriteWord(control+2*2, 0);   /* ptsout count */
+	STMemory_WriteWord(control+2*4, 0);   /* intout count */
+	return true;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * v_bar / vr_recfl: fill rectangle with solid fill color in replace
+ * mode.  Perimeter drawn by v_bar for solid fills is in the fill color
+ * within the same rectangle, so it doesn't change the result.
+ */
+static bool VDIAccel_FillRect(const VDIWORKSTATION *ws, Uint32 control, Uint32 ptsin)
+{
+	VDISURFACE screen;
+	Uint8 ops[MAX_VDI_PLANES];
+	int x1, y1, x2, y2, pen, p;
+
+	if (ws->nFillInterior != VDI_FIS_SOLID || ws->nWriteMode != VDI_MD_REPLACE ||
+	    ws->nClip == VDI_UNKNOWN || !STMemory_ValidArea(ptsin, 4*2))
+		return false;
+	pen = VDIAccel_Pen(ws->nFillColor);
+	if (pen == VDI_UNKNOWN)
+		return false;
+
+	VDIAccel_ReadRect(ptsin, &x1, &y1, &x2, &y2);
+	if (ws->nClip)
+	{
+		if (x1 < ws->nClipX1)
+			x1 = ws->nClipX1;
+		if (y1 < ws->nClipY1)
+			y1 = ws->nClipY1;
+		if (x2 > ws->nClipX2)
+			x2 = ws->nClipX2;
+		if (y2 > ws->nClipY2)
+			y2 = ws->nClipY2;
+		if (x1 > x2 || y1 > y2)
+			return VDIAccel_Done(control);
+	}
+	VDIAccel_ScreenSurface(&screen);
+	if (!VDIAccel_SurfaceValid(&screen) ||
+	    !VDIAccel_InSurface(&screen, x1, y1, x2, y2))
+		return false;
+
+	for (p = 0; p < screen.planes; p++)
+		ops[p] = (pen >> p) & 1 ? VDI_ALL_BLACK : VDI_ALL_WHITE;
+	VDIAccel_Blit(NULL, 0, 0, &screen, x1, y1, x2 - x1 + 1, y2 - y1 + 1, ops);
+
+	LOG_TRACE(TRACE_OS_VDI, "VDI fill %d,%d-%d,%d with pen %d done natively\n",
+		  x1, y1, x2, y2, pen);
+	return VDIAccel_Done(control);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Read source and destination MFDBs and rectangles of a raster copy.
+ * Return false unless both rectangles are of the same size and within
+ * their forms, and the destination one isn't affected by clipping.
+ */
+static bool VDIAccel_RasterArgs(const VDIWORKSTATION *ws, Uint32 control, Uint32 ptsin,
+                                VDISURFACE *src, VDISURFACE *dst,
+                                int *sx, int *sy, int *dx, int *dy, int *w, int *h)
+{
+	int sx2, sy2, dx2, dy2;
+
+	if (ws->nClip == VDI_UNKNOWN || !STMemory_ValidArea(ptsin, 8*2) ||
+	    !VDIAccel_Surface(STMemory_ReadLong(control+2*7), src) ||
+	    !VDIAccel_Surface(STMemory_ReadLong(control+2*9), dst))
+		return false;
+
+	VDIAccel_ReadRect(ptsin, sx, sy, &sx2, &sy2);
+	VDIAccel_ReadRect(ptsin+4*2, dx, dy, &dx2, &dy2);
+	*w = sx2 - *sx + 1;
+	*h = sy2 - *sy + 1;
+	if (dx2 - *dx + 1 != *w || dy2 - *dy + 1 != *h)
+		return false;
+
+	return VDIAccel_InSurface(src, *sx, *sy, sx2, sy2) &&
+	       VDIAccel_InSurface(dst, *dx, *dy, dx2, dy2) &&
+	       VDIAccel_Unclipped(ws, *dx, *dy, dx2, dy2);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * vro_cpyfm: opaque raster copy between device format forms.
+ */
+static bool VDIAccel_CopyOpaque(const VDIWORKSTATION *ws, Uint32 control, Uint32 intin, Uint32 ptsin)
+{
+	VDISURFACE src, dst;
+	Uint8 ops[MAX_VDI_PLANES];
+	int sx, sy, dx, dy, w, h, p;
+	Uint16 mode;
+
+	if (!STMemory_ValidArea(intin, 2))
+		return false;
+	mode = STMemory_ReadWord(intin);
+	if (mode > VDI_ALL_BLACK ||
+	    !VDIAccel_RasterArgs(ws, control, ptsin, &src, &dst, &sx, &sy, &dx, &dy, &w, &h) ||
+	    src.planes != VDIPlanes || dst.planes != VDIPlanes)
+		return false;
+
+	for (p = 0; p < dst.planes; p++)
+		ops[p] = mode;
+	VDIAccel_Blit(&src, sx, sy, &dst, dx, dy, w, h, ops);
+
+	LOG_TRACE(TRACE_OS_VDI, "VDI opaque copy %dx%d mode %d done natively\n", w, h, mode);
+	return VDIAccel_Done(control);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * vrt_cpyfm: expand monochrome form to colors of a device format form,
+ * in replace, transparent or XOR mode.  Like in TOS, this is done
+ * with a logic operation for each plane, selected by the plane bits
+ * of the foreground and background pens.
+ */
+static bool VDIAccel_CopyTransparent(const VDIWORKSTATION *ws, Uint32 control, Uint32 intin, Uint32 ptsin)
+{
+	VDISURFACE src, dst;
+	Uint8 ops[MAX_VDI_PLANES];
+	int sx, sy, dx, dy, w, h, p, fg, bg;
+	Uint16 mode;
+
+	if (!STMemory_ValidArea(intin, 3*2))
+		return false;
+	mode = STMemory_ReadWord(intin);
+	fg = VDIAccel_Pen(STMemory_ReadWord(intin+2));
+	bg = VDIAccel_Pen(STMemory_ReadWord(intin+4));
+	if (mode < VDI_MD_REPLACE || mode > VDI_MD_XOR ||
+	    (mode != VDI_MD_XOR && (fg == VDI_UNKNOWN || bg == VDI_UNKNOWN)) ||
+	    !VDIAccel_RasterArgs(ws, control, ptsin, &src, &dst, &sx, &sy, &dx, &dy, &w, &h) ||
+	    src.planes != 1 || dst.planes != VDIPlanes)
+		return false;
+
+	for (p = 0; p < dst.planes; p++)
+	{
+		bool fgbit = (fg >> p) & 1, bgbit = (bg >> p) & 1;
+		switch (mode)
+		{
+		 case VDI_MD_REPLACE:
+			if (fgbit)
+				ops[p] = bgbit ? VDI_ALL_BLACK : VDI_S_ONLY;
+			else
+				ops[p] = bgbit ? VDI_NOT_S : VDI_ALL_WHITE;
+			break;
+		 case VDI_MD_TRANS:
+			ops[p] = fgbit ? VDI_S_OR_D : VDI_NOTS_AND_D;
+			break;
+		 default:
+			ops[p] = VDI_S_XOR_D;
+			break;
+		}
+	}
+	VDIAccel_Blit(&src, sx, sy, &dst, dx, dy, w, h, ops);
+
+	LOG_TRACE(TRACE_OS_VDI, "VDI transparent copy %dx%d mode %d done natively\n", w, h, mode);
+	return VDIAccel_Done(control);
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Follow attribute calls for known workstations and service the
+ * supported drawing calls natively.  Return true if the call was
+ * completed here and the TOS VDI trap needs to be skipped.
+ */
+bool VDIAccel_Call(Uint16 opcode, Uint32 control, Uint32 intin, Uint32 ptsin)
+{
+	VDIWORKSTATION *ws;
+	Uint16 handle, value;
+
+	if (!STMemory_ValidArea(control, 11*2))
+		return false;
+	handle = STMemory_ReadWord(control+2*6);
+	if (handle == 0 || handle >= VDI_MAX_HANDLES || !Workstations[handle].bTracked)
+		return false;
+	ws = &Workstations[handle];
+
+	switch (opcode)
+	{
+	 case 2:    /* v_clswk */
+	 case 101:  /* v_clsvwk */
+		ws->bTracked = false;
+		break;
+
+	 case 11:   /* v_bar (GDP 1) */
+		if (STMemory_ReadWord(control+2*5) == 1)
+			return VDIAccel_FillRect(ws, control, ptsin);
+		break;
+	 case 114:  /* vr_recfl */
+		return VDIAccel_FillRect(ws, control, ptsin);
+	 case 109:  /* vro_cpyfm */
+		return VDIAccel_CopyOpaque(ws, control, intin, ptsin);
+	 case 121:  /* vrt_cpyfm */
+		return VDIAccel_CopyTransparent(ws, control, intin, ptsin);
+
+	 case 23:   /* vsf_interior */
+	 case 25:   /* vsf_color */
+	 case 32:   /* vswr_mode */
+		if (!STMemory_ValidArea(intin, 2))
+		{
+			ws->bTracked = false;
+			break;
+		}
+		value = STMemory_ReadWord(intin);
+		if (opcode == 23)
+			ws->nFillInterior = value <= 4 ? value : VDI_UNKNOWN;
+		else if (opcode == 25)
+			ws->nFillColor = value < (1 << VDIPlanes) ? value : VDI_UNKNOWN;
+		else
+			ws->nWriteMode = (value >= 1 && value <= 4) ? value : VDI_UNKNOWN;
+		break;
+
+	 case 129:  /* vs_clip */
+		if (!STMemory_ValidArea(intin, 2))
+		{
+			ws->bTracked = false;
+			break;
+		}
+		ws->nClip = STMemory_ReadWord(intin) ? 1 : 0;
+		if (ws->nClip)
+		{
+			int x1, y1, x2, y2;
+			if (!STMemory_ValidArea(ptsin, 4*2))
+			{
+				ws->nClip = VDI_UNKNOWN;
+				break;
+			}
+			VDIAccel_ReadRect(ptsin, &x1, &y1, &x2, &y2);
+			ws->nClipX1 = x1;
+			ws->nClipY1 = y1;
+			ws->nClipX2 = x2;
+			ws->nClipY2 = y2;
+		}
+		break;
+	}
+	return false;
+}
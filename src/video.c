@@ -354,6 +354,7 @@ const char Video_fileid[] = "Hatari video.c : " __DATE__ " " __TIME__;
 #include "configuration.h"
 #include "cycles.h"
 #include "fdc.h"
+#include "floppy.h"
 #include "cycInt.h"
 #include "ioMem.h"
 #include "keymap.h"
@@ -362,6 +363,7 @@ const char Video_fileid[] = "Hatari video.c : " __DATE__ " " __TIME__;
 #include "memorySnapShot.h"
 #include "mfp.h"
 #include "printer.h"
+#include "rs232.h"
 #include "screen.h"
 #include "screenSnapShot.h"
 #include "shortcut.h"
@@ -369,6 +371,9 @@ const char Video_fileid[] = "Hatari video.c : " __DATE__ " " __TIME__;
 #include "dmaSnd.h"
 #include "spec512.h"
 #include "stMemory.h"
+#include "perf.h"
+#include "stats.h"
+#include "heatmap.h"
 #include "vdi.h"
 #include "video.h"
 #include "ymFormat.h"
@@ -377,6 +382,11 @@ const char Video_fileid[] = "Hatari video.c : " __DATE__ " " __TIME__;
 #include "avi_record.h"
 #include "ikbd.h"
 #include "floppy_ipf.h"
+#include "utils.h"
+
+#ifdef __LIBRETRO__
+extern void update_input_late(int line, int lines);
+#endif
 
 
 /* The border's mask allows to keep track of all the border tricks		*/
@@ -405,6 +415,11 @@ const char Video_fileid[] = "Hatari video.c : " __DATE__ " " __TIME__;
 int STRes = ST_LOW_RES;                         /* current ST resolution */
 int TTRes;                                      /* TT shifter resolution mode */
 int nFrameSkips;                                /* speed up by skipping video frames */
+bool bVideoHeadless;                            /* only draw sampled or requested frames */
+int nVideoHeadlessSample;                       /* draw every Nth frame in headless mode, 0 = none */
+bool bVideoFrameRequested;                      /* draw next frame even in headless mode */
+bool bVideoFrameHidden;                         /* frame isn't shown (run-ahead), skip drawing it */
+bool bVideoFrameSpeculative;                    /* frame is rolled back (run-ahead), don't record it */
 
 bool bUseHighRes;                               /* Use hi-res (ie Mono monitor) */
 int OverscanMode;                               /* OVERSCANMODE_xxxx for current display frame */
@@ -412,6 +427,18 @@ Uint16 HBLPalettes[HBL_PALETTE_LINES];          /* 1x16 colour palette per scree
 Uint16 *pHBLPalettes;                           /* Pointer to current palette lists, one per HBL */
 Uint32 HBLPaletteMasks[HBL_PALETTE_MASKS];      /* Bit mask of palette colours changes, top bit set is resolution change */
 Uint32 *pHBLPaletteMasks;
+Uint64 HBLPaletteHashes[HBL_PALETTE_MASKS];     /* Hash of whole palette after the line's colour changes */
+static Uint16 HashPalette[16];                  /* Palette hashed in 'PaletteHash' */
+static Uint64 PaletteHash;
+
+/* All palette writes of one instruction (e.g. a movem.l to the colour
+ * registers) happen at the same video position, so the raster line of
+ * a burst of them is computed only once */
+static struct {
+	int FrameCycles;	/* video counter of the burst, -1 = none */
+	int HBL;
+	int Line;
+} PaletteBurst = { -1, 0, 0 };
 int nScreenRefreshRate = 50;                    /* 50 or 60 Hz in color, 71 Hz in mono */
 Uint32 VideoBase;                               /* Base address in ST Ram for screen (read on each VBL) */
 
@@ -521,6 +548,20 @@ typedef struct
 SHIFTER_FRAME	ShifterFrame;
 
 
+/* Extended VDI resolution screen copies, in the two ST screen buffers
+ * of the frame buffer. Screen RAM pages written since the copy into
+ * a buffer need to be copied again, when it's the next one drawn to */
+typedef struct
+{
+	Uint8	*pBuffer;			/* screen buffer, NULL if not known */
+	Uint32	DirtyPages[STMEMORY_PAGES / 32];	/* pages written since the copy */
+} VDI_SCREEN_COPY;
+
+static VDI_SCREEN_COPY	VDIScreenCopies[2];
+static Uint32	VDIScreenCopyAddr;		/* screen address of the copies */
+static int	VDIScreenCopyVBL;		/* VBL of the last dirty pages update */
+
+
 
 /*--------------------------------------------------------------*/
 /* Local functions prototypes                                   */
@@ -535,6 +576,7 @@ static void 	Video_Sync_SetDefaultStartEnd ( Uint8 Freq , int HblCounterVideo ,
 
 static int	Video_HBL_GetPos ( void );
 static int	Video_TimerB_GetDefaultPos ( void );
+static bool	Video_TimerB_Counting ( void );
 static void	Video_EndHBL ( void );
 static void	Video_StartHBL ( void );
 
@@ -543,6 +585,7 @@ static void	Video_StoreResolution(int y);
 static void	Video_CopyScreenLineMono(void);
 static void	Video_CopyScreenLineColor(void);
 static void	Video_CopyVDIScreen(void);
+static void	Video_TrackVDIScreen(void);
 static void	Video_SetHBLPaletteMaskPointers(void);
 
 static void	Video_UpdateTTPalette(int bpp);
@@ -575,6 +618,9 @@ void Video_MemorySnapShot_Capture(bool bSave)
 	MemorySnapShot_Store(&OverscanMode, sizeof(OverscanMode));
 	MemorySnapShot_Store(HBLPalettes, sizeof(HBLPalettes));
 	MemorySnapShot_Store(HBLPaletteMasks, sizeof(HBLPaletteMasks));
+	MemorySnapShot_Store(HBLPaletteHashes, sizeof(HBLPaletteHashes));
+	MemorySnapShot_Store(HashPalette, sizeof(HashPalette));
+	MemorySnapShot_Store(&PaletteHash, sizeof(PaletteHash));
 	MemorySnapShot_Store(&VideoBase, sizeof(VideoBase));
 	MemorySnapShot_Store(&LineWidth, sizeof(LineWidth));
 	MemorySnapShot_Store(&HWScrollCount, sizeof(HWScrollCount));
@@ -589,6 +635,8 @@ void Video_MemorySnapShot_Capture(bool bSave)
 	MemorySnapShot_Store(&bTTSampleHold, sizeof(bTTSampleHold));
 	MemorySnapShot_Store(&bTTHypermono, sizeof(bTTHypermono));
 	MemorySnapShot_Store(&TTSpecialVideoMode, sizeof(TTSpecialVideoMode));
+
+	PaletteBurst.FrameCycles = -1;
 }
 
 
@@ -1685,6 +1733,10 @@ void Video_InterruptHandler_HBL ( void )
 
 	nHBL++;						/* Increase HBL count */
 
+#ifdef __LIBRETRO__
+	update_input_late(nHBL, nScanlinesPerFrame);	/* Read host input late in the frame if requested */
+#endif
+
 	if (nHBL < nScanlinesPerFrame)
 	{
 		/* Update start cycle for next HBL */
@@ -1903,7 +1955,8 @@ void Video_InterruptHandler_EndLine(void)
 		return;
 
 	/* Generate new Endline, if need to - there are 313 HBLs per frame */
-	if (nHBL < nScanlinesPerFrame-1)
+	/* (only when timer B is in event count mode, see Video_StartTimerB) */
+	if ( ( nHBL < nScanlinesPerFrame-1 ) && Video_TimerB_Counting() )
 	{
 		/* By default, next EndLine's int will be on line nHBL+1 at pos 376+24 or 372+24 */
 		if ( ( IoMem[0xfffa03] & ( 1 << 3 ) ) == 0 )		/* count end of line */
@@ -1947,6 +2000,23 @@ void Video_InterruptHandler_EndLine(void)
 
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Return hash of colour 'col' in palette entry 'idx'. A palette's hash
+ * is the XOR of its entries' hashes, so that it can be updated for each
+ * colour change, and the screen conversion can compare the palettes of
+ * a line in two frames with just their hashes.
+ */
+static inline Uint64 Video_ColorHash(int idx, Uint16 col)
+{
+	Uint64 h = (((Uint64)idx << 16) | col) + 0x9e3779b97f4a7c15ull;
+
+	h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ull;
+	h = (h ^ (h >> 27)) * 0x94d049bb133111ebull;
+	return h ^ (h >> 31);
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Store whole palette on first line so have reference to work from
@@ -1957,12 +2027,16 @@ static void Video_StoreFirstLinePalette(void)
 	int i;
 
 	pp2 = (Uint16 *)&IoMem[0xff8240];
+	PaletteHash = 0;
 	for (i = 0; i < 16; i++)
 	{
 		HBLPalettes[i] = SDL_SwapBE16(*pp2++);
 		if ( ConfigureParams.System.nMachineType == MACHINE_ST)
 			HBLPalettes[i] &= 0x777;			/* Force unused "random" bits to 0 */
+		HashPalette[i] = HBLPalettes[i];
+		PaletteHash ^= Video_ColorHash(i, HBLPalettes[i]);
 	}
+	HBLPaletteHashes[0] = PaletteHash;
 
 	/* And set mask flag with palette and resolution */
 //	FIXME ; enlever PALETTEMASK_RESOLUTION
@@ -2099,6 +2173,85 @@ static void Video_CopyScreenLineMono(void)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Called at the end of each displayed line copied by Video_CopyScreenLineColor :
+ * skip the STE line width and set the STE video registers which were written
+ * during the line, now that the line was processed.
+ */
+static void Video_CopyScreenLineSteEnd(void)
+{
+	/* LineWidth is zero on ST. */
+	/* On STE, the Shifter skips the given amount of words. */
+	pVideoRaster += LineWidth*2;
+
+	/* On STE, handle modifications of the video counter address $ff8205/07/09 */
+	/* that occurred while the display was already ON */
+	if ( VideoCounterDelayedOffset != 0 )
+	{
+		pVideoRaster += ( VideoCounterDelayedOffset & ~1 );
+//		  fprintf ( stderr , "adjust video counter offset=%d new video=%x\n" , VideoCounterDelayedOffset , pVideoRaster-STRam );
+		VideoCounterDelayedOffset = 0;
+	}
+
+	if ( pVideoRasterDelayed != NULL )
+	{
+		pVideoRaster = pVideoRasterDelayed;
+//		  fprintf ( stderr , "adjust video counter const new video=%x\n" , pVideoRaster-STRam );
+		pVideoRasterDelayed = NULL;
+	}
+
+	/* On STE, if we wrote to the hwscroll register, we set the */
+	/* new value here, once the current line was processed */
+	if ( NewHWScrollCount >= 0 )
+	{
+		HWScrollCount = NewHWScrollCount;
+		HWScrollPrefetch = NewHWScrollPrefetch;
+		NewHWScrollCount = -1;
+		NewHWScrollPrefetch = -1;
+	}
+
+	/* On STE, if we trigger the left border + 16 pixels trick, we set the */
+	/* new value here, once the current line was processed */
+	if ( NewSteBorderFlag >= 0 )
+	{
+		if ( NewSteBorderFlag == 0 )
+			bSteBorderFlag = false;
+		else
+			bSteBorderFlag = true;
+		NewSteBorderFlag = -1;
+	}
+
+	/* On STE, if we wrote to the linewidth register, we set the */
+	/* new value here, once the current line was processed */
+	if ( NewLineWidth >= 0 )
+	{
+		LineWidth = NewLineWidth;
+		NewLineWidth = -1;
+	}
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Copy the most common kind of line, where the shifter line descriptor has
+ * no border removal and no pixel shift, and there's no STE scrolling : the
+ * 160 bytes of the line are copied between 2 empty borders.
+ */
+static void Video_CopyScreenLineNormal(void)
+{
+	memset(pSTScreen, 0, SCREENBYTES_LEFT);
+	memcpy(pSTScreen+SCREENBYTES_LEFT, pVideoRaster, SCREENBYTES_MIDDLE);
+	memset(pSTScreen+SCREENBYTES_LEFT+SCREENBYTES_MIDDLE, 0, SCREENBYTES_RIGHT);
+	pVideoRaster += SCREENBYTES_MIDDLE;
+
+	Video_CopyScreenLineSteEnd();
+
+	pSTScreen += SCREENBYTES_LINE;
+	pVideoRaster = ( ( pVideoRaster - STRam ) & 0xffffff ) + STRam;
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Copy one line of color screen into buffer for conversion later.
@@ -2116,6 +2269,14 @@ static void Video_CopyScreenLineColor(void)
 	LineBorderMask = ShifterFrame.ShifterLines[ nHBL ].BorderMask;
 	STF_PixelScroll = ShifterFrame.ShifterLines[ nHBL ].DisplayPixelShift;
 
+	/* Most lines of a frame are displayed lines without any special effect */
+	if ( ( LineBorderMask == 0 ) && ( STF_PixelScroll == 0 ) && ( HWScrollCount == 0 ) && !bSteBorderFlag
+	  && ( nHBL >= nStartHBL ) && ( nHBL < nEndHBL + BlankLines ) )
+	{
+		Video_CopyScreenLineNormal();
+		return;
+	}
+
 	/* Get resolution for this line (in case of mixed low/med screen) */
 	i = nHBL-nFirstVisibleHbl;
 	if ( i >= HBL_PALETTE_MASKS )
@@ -2400,54 +2561,8 @@ static void Video_CopyScreenLineColor(void)
 			}
 		}
 
-		/* LineWidth is zero on ST. */
-		/* On STE, the Shifter skips the given amount of words. */
-		pVideoRaster += LineWidth*2;
-
-		/* On STE, handle modifications of the video counter address $ff8205/07/09 */
-		/* that occurred while the display was already ON */
-		if ( VideoCounterDelayedOffset != 0 )
-		{
-			pVideoRaster += ( VideoCounterDelayedOffset & ~1 );
-//		  fprintf ( stderr , "adjust video counter offset=%d new video=%x\n" , VideoCounterDelayedOffset , pVideoRaster-STRam );
-			VideoCounterDelayedOffset = 0;
-		}
-
-		if ( pVideoRasterDelayed != NULL )
-		{
-			pVideoRaster = pVideoRasterDelayed;
-//		  fprintf ( stderr , "adjust video counter const new video=%x\n" , pVideoRaster-STRam );
-			pVideoRasterDelayed = NULL;
-		}
-
-		/* On STE, if we wrote to the hwscroll register, we set the */
-		/* new value here, once the current line was processed */
-		if ( NewHWScrollCount >= 0 )
-		{
-			HWScrollCount = NewHWScrollCount;
-			HWScrollPrefetch = NewHWScrollPrefetch;
-			NewHWScrollCount = -1;
-			NewHWScrollPrefetch = -1;
-		}
-
-		/* On STE, if we trigger the left border + 16 pixels trick, we set the */
-		/* new value here, once the current line was processed */
-		if ( NewSteBorderFlag >= 0 )
-		{
-			if ( NewSteBorderFlag == 0 )
-				bSteBorderFlag = false;
-			else
-				bSteBorderFlag = true;
-			NewSteBorderFlag = -1;
-		}
-
-		/* On STE, if we wrote to the linewidth register, we set the */
-		/* new value here, once the current line was processed */
-		if ( NewLineWidth >= 0 )
-		{
-			LineWidth = NewLineWidth;
-			NewLineWidth = -1;
-		}
+		/* Apply the STE registers' changes made during this line */
+		Video_CopyScreenLineSteEnd();
 
 
 		/* Handle 4 pixels hardware scrolling ('ST Cnx' demo in 'Punish Your Machine') */
@@ -2520,12 +2635,112 @@ static void Video_CopyScreenLineColor(void)
 
 /*-----------------------------------------------------------------------*/
 /**
- * Copy extended GEM resolution screen
+ * Add the RAM pages written during this VBL to the pages the VDI screen
+ * copies need to update.  Called on every VBL, also for skipped frames.
+ * Without dirty page tracking, or when the frames don't follow each
+ * other (e.g. after restoring a snapshot), the copies are forgotten.
+ */
+static void Video_TrackVDIScreen(void)
+{
+	const Uint32 *pages = STMemory_GetDirtyPages(false);
+	int i, j;
+
+	if (!STMemory_bDirtyTracking || nVBLs != VDIScreenCopyVBL + 1)
+	{
+		VDIScreenCopies[0].pBuffer = VDIScreenCopies[1].pBuffer = NULL;
+	}
+	else
+	{
+		for (i = 0; i < 2; i++)
+		{
+			for (j = 0; j < STMEMORY_PAGES / 32; j++)
+				VDIScreenCopies[i].DirtyPages[j] |= pages[j];
+		}
+	}
+	VDIScreenCopyVBL = nVBLs;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Find range of screen rows in the dirty pages of given screen copy.
+ * Return false if none of the rows are dirty.
+ */
+static bool Video_GetVDIDirtyRows(const VDI_SCREEN_COPY *pCopy, Uint32 addr,
+                                  int lineBytes, int *pFirst, int *pEnd)
+{
+	Uint32 size = lineBytes * VDIHeight;
+	Uint32 page, last, start, end;
+	int first = VDIHeight, endrow = 0;
+
+	page = addr >> STMEMORY_PAGE_SHIFT;
+	last = (addr + size - 1) >> STMEMORY_PAGE_SHIFT;
+	for ( ; page <= last; page++)
+	{
+		if (!(pCopy->DirtyPages[page >> 5] & (1 << (page & 31))))
+			continue;
+		start = page << STMEMORY_PAGE_SHIFT;
+		end = start + STMEMORY_PAGE_SIZE;
+		start = start > addr ? start - addr : 0;
+		end = end - addr < size ? end - addr : size;
+		if ((int)(start / lineBytes) < first)
+			first = start / lineBytes;
+		endrow = (end + lineBytes - 1) / lineBytes;
+	}
+	*pFirst = first;
+	*pEnd = endrow;
+	return first < endrow;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/**
+ * Copy extended GEM resolution screen.  With dirty page tracking only
+ * the screen rows written since the buffer was last drawn to are
+ * copied, and the rows written since the previous drawn screen are
+ * given to the screen conversion.
  */
 static void Video_CopyVDIScreen(void)
 {
-	/* Copy whole screen, don't care about being exact as for GEM only */
-	memcpy(pSTScreen, pVideoRaster, ((VDIWidth*VDIPlanes)/8)*VDIHeight);
+	int lineBytes = (VDIWidth*VDIPlanes)/8;
+	Uint32 addr = pVideoRaster - STRam;
+	VDI_SCREEN_COPY *pCopy = NULL, *pPrev = NULL;
+	int i, first, end;
+
+	if (addr != VDIScreenCopyAddr || addr + lineBytes*VDIHeight > STRamEnd)
+	{
+		VDIScreenCopies[0].pBuffer = VDIScreenCopies[1].pBuffer = NULL;
+		VDIScreenCopyAddr = addr;
+	}
+	for (i = 0; i < 2; i++)
+	{
+		if (VDIScreenCopies[i].pBuffer == pSTScreen)
+			pCopy = &VDIScreenCopies[i];
+		else if (VDIScreenCopies[i].pBuffer == pFrameBuffer->pSTScreenCopy)
+			pPrev = &VDIScreenCopies[i];
+	}
+
+	if (!pCopy)
+	{
+		/* Copy whole screen, don't care about being exact as for GEM only */
+		memcpy(pSTScreen, pVideoRaster, lineBytes*VDIHeight);
+		pCopy = (pPrev == &VDIScreenCopies[0]) ? &VDIScreenCopies[1] : &VDIScreenCopies[0];
+		pCopy->pBuffer = pSTScreen;
+	}
+	else if (Video_GetVDIDirtyRows(pCopy, addr, lineBytes, &first, &end))
+	{
+		memcpy(pSTScreen + first*lineBytes, pVideoRaster + first*lineBytes,
+		       (end - first)*lineBytes);
+	}
+	memset(pCopy->DirtyPages, 0, sizeof(pCopy->DirtyPages));
+
+	/* Other rows are same as in the previous screen */
+	if (!pPrev)
+		Screen_SetVDIChangedRows(0, VDIHeight);
+	else if (Video_GetVDIDirtyRows(pPrev, addr, lineBytes, &first, &end))
+		Screen_SetVDIChangedRows(first, end);
+	else
+		Screen_SetVDIChangedRows(0, 0);
 }
 
 
@@ -2539,6 +2754,7 @@ void Video_SetScreenRasters(void)
 	pHBLPaletteMasks = HBLPaletteMasks;
 	pHBLPalettes = HBLPalettes;
 	memset(pHBLPaletteMasks, 0, sizeof(Uint32)*NUM_VISIBLE_LINES);  /* Clear array */
+	PaletteBurst.FrameCycles = -1;
 }
 
 
@@ -2558,6 +2774,14 @@ static void Video_SetHBLPaletteMaskPointers(void)
 	//  FrameCycles = Cycles_GetCounterOnWriteAccess(CYCLES_COUNTER_VIDEO);
 	FrameCycles = Cycles_GetCounter(CYCLES_COUNTER_VIDEO) + 8;
 
+	/* Next write of the same burst? */
+	if ( FrameCycles == PaletteBurst.FrameCycles && nHBL == PaletteBurst.HBL )
+	{
+		pHBLPaletteMasks = &HBLPaletteMasks[PaletteBurst.Line];
+		pHBLPalettes = &HBLPalettes[16*PaletteBurst.Line];
+		return;
+	}
+
 	/* Find 'line' into palette - screen starts 63 lines down, less 29 for top overscan */
 	Video_ConvertPosition ( FrameCycles , &HblCounterVideo , &LineCycles );
 	Line = HblCounterVideo - nFirstVisibleHbl;
@@ -2574,6 +2798,10 @@ static void Video_SetHBLPaletteMaskPointers(void)
 	if (Line >= NUM_VISIBLE_LINES)
 		Line = NUM_VISIBLE_LINES-1;
 
+	PaletteBurst.FrameCycles = FrameCycles;
+	PaletteBurst.HBL = nHBL;
+	PaletteBurst.Line = Line;
+
 	/* Store pointers */
 	pHBLPaletteMasks = &HBLPaletteMasks[Line];  /* Next mask entry */
 	pHBLPalettes = &HBLPalettes[16*Line];       /* Next colour raster list x16 colours */
@@ -2653,6 +2881,7 @@ static void Video_ResetShifterTimings(void)
 	TimerBEventCountCycleStart = -1;		/* reset timer B activation cycle for this VBL */
 
 	BlankLines = 0;
+	PaletteBurst.FrameCycles = -1;
 }
 
 
@@ -2868,9 +3097,26 @@ bool Video_RenderTTScreen(void)
  */
 static void Video_DrawScreen(void)
 {
+	if (bUseVDIRes)
+		Video_TrackVDIScreen();
+
 	/* Skip frame if need to */
-	if (nVBLs % (nFrameSkips+1))
+	if (bVideoFrameHidden && (bVideoFrameSpeculative || !bRecordingAvi))
+		return;
+	if (bVideoHeadless)
+	{
+		if (!bVideoFrameRequested && !bRecordingAvi
+		    && !(nVideoHeadlessSample && nVBLs % nVideoHeadlessSample == 0))
+			return;
+		bVideoFrameRequested = false;
+	}
+	else if (nVBLs % (nFrameSkips+1))
+	{
+		Stats_Add(STATS_SKIPPED_FRAMES, 1);
 		return;
+	}
+
+	Perf_Begin(PERF_SCREEN);
 
 	/* Use extended VDI resolution?
 	 * If so, just copy whole screen on VBL rather than per HBL */
@@ -2896,6 +3142,8 @@ static void Video_DrawScreen(void)
 
 		Screen_Draw();
 	}
+
+	Perf_End();
 }
 
 
@@ -2905,6 +3153,15 @@ static void Video_DrawScreen(void)
  */
 
 
+/**
+ * Return true if timer B is counting end/start of line events
+ */
+static bool Video_TimerB_Counting ( void )
+{
+	return MFP_TBCR == 0x08;
+}
+
+
 /**
  * Start HBL or Timer B interrupt at position Pos. If position Pos was
  * already reached, then the interrupt is set on the next line.
@@ -2938,11 +3195,31 @@ static void Video_AddInterruptHBL ( int Pos )
 void Video_AddInterruptTimerB ( int Pos )
 {
 //fprintf ( stderr , "add timerb pos=%d\n" , Pos );
-	if ( !bUseVDIRes )
+	if ( !bUseVDIRes && Video_TimerB_Counting() )
 		Video_AddInterrupt ( Pos , INTERRUPT_VIDEO_ENDLINE );
 }
 
 
+/**
+ * End of line interrupts are only needed when timer B is in event count
+ * mode ; when timer B is stopped or in delay mode, the EndLine handler
+ * would only reschedule itself on every line, so we don't generate them.
+ * This is called when timer B enters event count mode, to start the
+ * interrupts again from the current line.
+ */
+void Video_StartTimerB ( void )
+{
+	int FrameCycles , HblCounterVideo , LineCycles;
+
+	if ( bUseVDIRes || CycInt_InterruptActive ( INTERRUPT_VIDEO_ENDLINE ) )
+		return;
+
+	Video_GetPosition ( &FrameCycles , &HblCounterVideo , &LineCycles );
+	LineTimerBCycle = Video_TimerB_GetPos ( HblCounterVideo );
+	Video_AddInterruptTimerB ( LineTimerBCycle );
+}
+
+
 /**
  * Add some video interrupts to handle the first HBL and the first Timer B
  * in a new VBL. Also add an interrupt to trigger the next VBL.
@@ -2963,15 +3240,18 @@ void Video_StartInterrupts ( int PendingCyclesOver )
 	{
 		Video_GetPosition ( &FrameCycles , &HblCounterVideo , &LineCycles );
 
-		/* Set Timer B interrupt for line 0 */
+		/* Set Timer B interrupt for line 0 (only if timer B counts lines, see Video_StartTimerB) */
 		Pos = Video_TimerB_GetPos ( 0 );
-		if ( Pos > FrameCycles )		/* check Pos for line 0 was not already reached */
-			Video_AddInterruptTimerB ( Pos );
-		else					/* the VBL was delayed by more than 1 HBL, add an immediate timer B */
+		if ( Video_TimerB_Counting() )
 		{
-			LOG_TRACE(TRACE_VIDEO_VBL , "VBL %d delayed too much video_cyc=%d >= pos=%d for first timer B, add immediate timer B\n" ,
-				nVBLs , FrameCycles , Pos );
-			CycInt_AddRelativeInterrupt ( 4 , INT_CPU_CYCLE, INTERRUPT_VIDEO_ENDLINE );
+			if ( Pos > FrameCycles )		/* check Pos for line 0 was not already reached */
+				Video_AddInterruptTimerB ( Pos );
+			else					/* the VBL was delayed by more than 1 HBL, add an immediate timer B */
+			{
+				LOG_TRACE(TRACE_VIDEO_VBL , "VBL %d delayed too much video_cyc=%d >= pos=%d for first timer B, add immediate timer B\n" ,
+					nVBLs , FrameCycles , Pos );
+				CycInt_AddRelativeInterrupt ( 4 , INT_CPU_CYCLE, INTERRUPT_VIDEO_ENDLINE );
+			}
 		}
 
 		/* Set HBL interrupt for line 0 */
@@ -3010,6 +3290,10 @@ void Video_InterruptHandler_VBL ( void )
 	/* Remove this interrupt from list and re-order */
 	CycInt_AcknowledgeInterrupt();
 
+	/* Flush the per-frame counters */
+	Stats_VBL();
+	HeatMap_VBL();
+
 	/* Increment the vbl jitter index */
 	VblJitterIndex++;
 	VblJitterIndex %= VBL_JITTER_ARRAY_SIZE;
@@ -3025,6 +3309,15 @@ void Video_InterruptHandler_VBL ( void )
 	/* Check printer status */
 	Printer_CheckIdleStatus();
 
+	/* Write back changed floppy images */
+	Floppy_WriteBackCheck();
+
+	/* Report memory snapshots saved in the background */
+	MemorySnapShot_CheckSaved();
+
+	/* Fetch incoming serial data */
+	RS232_Update();
+
 	/* Update counter for number of screen refreshes per second */
 	nVBLs++;
 	/* Set video registers for frame */
@@ -3050,12 +3343,18 @@ void Video_InterruptHandler_VBL ( void )
 	/* Update the IKBD's internal clock */
 	IKBD_UpdateClockOnVBL ();
 
-	/* Record video frame is necessary */
-	if ( bRecordingAvi )
-		Avi_RecordVideoStream ();
-
-	/* Store off PSG registers for YM file, is enabled */
-	YMFormat_UpdateRecording();
+	/* Frames emulated ahead are rolled back, they're recorded when emulated again */
+	if ( !bVideoFrameSpeculative )
+	{
+		/* Record video frame is necessary */
+		if ( bRecordingAvi )
+			Avi_RecordVideoStream ();
+		/* And batch screenshot */
+		ScreenSnapShot_UpdateBatch();
+
+		/* Store off PSG registers for YM file, is enabled */
+		YMFormat_UpdateRecording();
+	}
 	/* Generate 1/50th second of sound sample data, to be played by sound thread */
 	Sound_Update_VBL();
 
@@ -3080,6 +3379,9 @@ void Video_InterruptHandler_VBL ( void )
 	/* Set pending bit for VBL interrupt in the CPU IPL */
 	M68000_Exception(EXCEPTION_VBLANK, M68000_EXC_SRC_AUTOVEC);	/* Vertical blank interrupt, level 4 */
 
+	/* Written RAM pages of this frame become the 'last frame' pages */
+	STMemory_DirtyTracking_VBL();
+
 	Main_WaitOnVbl();
 }
 
@@ -3352,6 +3654,9 @@ void Video_ColorReg_WriteWord(void)
 		idx = (addr-0xff8240)/2;               /* words */
 		pHBLPalettes[idx] = col;               /* Set colour x */
 		*pHBLPaletteMasks |= 1 << idx;         /* And mask */
+		PaletteHash ^= Video_ColorHash(idx, HashPalette[idx]) ^ Video_ColorHash(idx, col);
+		HashPalette[idx] = col;
+		HBLPaletteHashes[pHBLPaletteMasks - HBLPaletteMasks] = PaletteHash;
 
 		if (LOG_TRACE_LEVEL(TRACE_VIDEO_COLOR))
 		{
@@ -3377,7 +3682,7 @@ void Video_ColorReg_WriteWord(void)
  * we use random values for now.
  * NOTE [NP] : When executing code from the IO addresses between 0xff8240-0xff825e
  * the unused bits on STF are set to '0' (used in "The Union Demo" protection).
- * So we use rand() only if PC is located in RAM.
+ * So we use Hatari_rand() only if PC is located in RAM.
  */
 void Video_ColorReg_ReadWord(void)
 {
@@ -3390,7 +3695,7 @@ void Video_ColorReg_ReadWord(void)
 	if ( (ConfigureParams.System.nMachineType == MACHINE_ST)
 	  && ( M68000_GetPC() < 0x400000 ) )				/* PC in RAM < 4MB */
 	{
-		col = ( col & 0x777 ) | ( rand() & 0x888 );
+		col = ( col & 0x777 ) | ( Hatari_rand() & 0x888 );
 		IoMem_WriteWord ( addr , col );
 	}
 
@@ -11,6 +11,7 @@
   We simply save out the WAVE format headers and then write the sample data
   (at the current rate of playback) as we build it up each frame. When we stop
   recording we complete the size information in the headers and close up.
+  The samples of each frame are written by the file writer thread.
 
 
   RIFF Chunk (12 bytes in length total) Byte Number
@@ -41,6 +42,7 @@ const char WAVFormat_fileid[] = "Hatari wavFormat.c : " __DATE__ " " __TIME__;
 #include "audio.h"
 #include "configuration.h"
 #include "file.h"
+#include "fileWriter.h"
 #include "log.h"
 #include "sound.h"
 #include "wavFormat.h"
@@ -138,6 +140,9 @@ void WAVFormat_CloseFile(void)
 
 		bRecordingWav = false;
 
+		/* Wait for the queued samples */
+		FileWriter_Flush();
+
 		/* Update headers with sizes */
 		nWavFileBytes = SDL_SwapLE32((12+24+8+nWavOutputBytes)-8);  /* File length, less 8 bytes for 'RIFF' and length */
 		fseek(WavFileHndl, 4, SEEK_SET);                            /* 'Total Length Of Package' element */
@@ -168,29 +173,47 @@ void WAVFormat_CloseFile(void)
 }
 
 
+/**
+ * Write a frame of little endian samples (called by the file writer)
+ */
+static bool WAVFormat_WriteSamples(Uint8 *pData, int nSize, void *pParam)
+{
+	if (nSize && fwrite(pData, nSize, 1, WavFileHndl) != 1)
+	{
+		perror("WAVFormat_Update");
+		return false;
+	}
+	return true;
+}
+
+
 /**
  * Update WAV file with current samples
  */
 void WAVFormat_Update(Sint16 pSamples[][2], int Index, int Length)
 {
-	Sint16 sample[2];
+	Sint16 *pOut;
 	int i;
 
 	if (bRecordingWav)
 	{
-		/* Output, better if did in two section if wrap */
+		pOut = (Sint16 *)FileWriter_Begin(Length * 4);
+		if (!pOut)
+		{
+			WAVFormat_CloseFile();
+			return;
+		}
 		for(i = 0; i < Length; i++)
 		{
 			/* Convert sample to little endian */
-			sample[0] = SDL_SwapLE16(pSamples[(Index+i)%MIXBUFFER_SIZE][0]);
-			sample[1] = SDL_SwapLE16(pSamples[(Index+i)%MIXBUFFER_SIZE][1]);
-			/* And store */
-			if (fwrite(&sample, sizeof(sample), 1, WavFileHndl) != 1)
-			{
-				perror("WAVFormat_Update");
-				WAVFormat_CloseFile();
-				return;
-			}
+			*pOut++ = SDL_SwapLE16(pSamples[(Index+i)%MIXBUFFER_SIZE][0]);
+			*pOut++ = SDL_SwapLE16(pSamples[(Index+i)%MIXBUFFER_SIZE][1]);
+		}
+		/* And store */
+		if (!FileWriter_Commit(WAVFormat_WriteSamples, NULL))
+		{
+			WAVFormat_CloseFile();
+			return;
 		}
 
 		/* Add samples to wav file length counter */
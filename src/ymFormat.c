@@ -5,12 +5,17 @@
   or at your option any later version. Read the file gpl.txt for details.
 
   YM File output, for use with STSound etc...
+
+  Registers are stored to memory on each VBL. When recording stops, the
+  workspace is handed to the file writer thread, which converts it to
+  register streams and saves it.
 */
 const char YMFormat_fileid[] = "Hatari ymFormat.c : " __DATE__ " " __TIME__;
 
 #include "main.h"
 #include "configuration.h"
 #include "file.h"
+#include "fileWriter.h"
 #include "log.h"
 #include "psg.h"
 #include "sound.h"
@@ -25,6 +30,13 @@ static int nYMVBLS = 0;
 static Uint8 *pYMData, *pYMWorkspace = NULL;
 static char *pszYMFileName = NULL;
 
+/* Recording handed to the file writer */
+typedef struct {
+	Uint8 *pWorkspace;
+	char *pszFileName;
+	int nVBLs;
+} YM_SAVE_JOB;
+
 /*-----------------------------------------------------------------------*/
 /**
  * Start recording YM registers to workspace
@@ -86,7 +98,7 @@ bool YMFormat_BeginRecording(const char *filename)
  * 
  * Convert to new workspace and return true if all OK.
  */
-static bool YMFormat_ConvertToStreams(void)
+static bool YMFormat_ConvertToStreams(YM_SAVE_JOB *pJob)
 {
 	Uint8 *pNewYMWorkspace;
 	Uint8 *pTmpYMData, *pNewYMData;
@@ -98,7 +110,7 @@ static bool YMFormat_ConvertToStreams(void)
 	if (pNewYMWorkspace)
 	{
 		/* Convert data, first copy over header */
-		pTmpYMData = pYMWorkspace;
+		pTmpYMData = pJob->pWorkspace;
 		pNewYMData = pNewYMWorkspace;
 		*pNewYMData++ = *pTmpYMData++;
 		*pNewYMData++ = *pTmpYMData++;
@@ -110,10 +122,10 @@ static bool YMFormat_ConvertToStreams(void)
 		{
 			/* Get pointer to source / destination */
 			pTmpYMStream = pTmpYMData + Reg;
-			pNewYMStream = pNewYMData + (Reg*nYMVBLS);
+			pNewYMStream = pNewYMData + (Reg*pJob->nVBLs);
 
 			/* Copy recording VBLs worth */
-			for(Count=0; Count<nYMVBLS; Count++)
+			for(Count=0; Count<pJob->nVBLs; Count++)
 			{
 				*pNewYMStream++ = *pTmpYMStream;
 				pTmpYMStream += NUM_PSG_SOUND_REGISTERS;
@@ -121,8 +133,8 @@ static bool YMFormat_ConvertToStreams(void)
 		}
 
 		/* Delete old workspace and assign new */
-		free(pYMWorkspace);
-		pYMWorkspace = pNewYMWorkspace;
+		free(pJob->pWorkspace);
+		pJob->pWorkspace = pNewYMWorkspace;
 
 		return true;
 	}
@@ -130,20 +142,54 @@ static bool YMFormat_ConvertToStreams(void)
 }
 
 
+/*-----------------------------------------------------------------------*/
+/**
+ * Convert recording and save it as '.YM' file (called by the file writer),
+ * then free it.
+ */
+static bool YMFormat_SaveRecording(Uint8 *pData, int nSize, void *pParam)
+{
+	YM_SAVE_JOB *pJob = (YM_SAVE_JOB *)pData;
+	bool bRet = false;
+
+	/* Convert YM to correct format(list of register 1, then register 2...) */
+	if (YMFormat_ConvertToStreams(pJob))
+	{
+		/* Save YM File */
+		bRet = File_Save(pJob->pszFileName, pJob->pWorkspace,(size_t)(pJob->nVBLs*NUM_PSG_SOUND_REGISTERS)+4, false);
+		if (!bRet)
+			Log_Printf(LOG_ERROR, "Failed to save YM sound data to '%s'!\n", pJob->pszFileName);
+	}
+	else
+		Log_Printf(LOG_ERROR, "YM sound data conversion failed!\n");
+
+	free(pJob->pWorkspace);
+	free(pJob->pszFileName);
+	return bRet;
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * End recording YM registers and save as '.YM' file
  */
 void YMFormat_EndRecording(void)
 {
+	YM_SAVE_JOB *pJob;
+
 	/* Recording, have recorded information? */
 	if (bRecordingYM && pszYMFileName && pYMWorkspace && nYMVBLS)
 	{
-		/* Convert YM to correct format(list of register 1, then register 2...) */
-		if (YMFormat_ConvertToStreams())
+		pJob = (YM_SAVE_JOB *)FileWriter_Begin(sizeof(YM_SAVE_JOB));
+		if (pJob)
 		{
-			/* Save YM File */
-			File_Save(pszYMFileName, pYMWorkspace,(size_t)(nYMVBLS*NUM_PSG_SOUND_REGISTERS)+4, false);
+			/* Writer takes ownership of the workspace */
+			pJob->pWorkspace = pYMWorkspace;
+			pJob->pszFileName = pszYMFileName;
+			pJob->nVBLs = nYMVBLS;
+			pYMWorkspace = NULL;
+			pszYMFileName = NULL;
+			FileWriter_Commit(YMFormat_SaveRecording, NULL);
 			/* And inform user */
 			Log_AlertDlg(LOG_INFO, "YM sound data recording has been stopped.");
 		}
@@ -218,6 +218,7 @@ struct dirent **ZIP_GetFilesDir(const zip_dir *zip, const char *dir, int *entrie
 	char *temp;
 	bool flag;
 	int slash;
+	size_t dirlen = strlen(dir);
 	struct dirent **fentries;
 
 	files = (zip_dir *)malloc(sizeof(zip_dir));
@@ -250,22 +251,27 @@ struct dirent **ZIP_GetFilesDir(const zip_dir *zip, const char *dir, int *entrie
 
 	for (i = 0; i < zip->nfiles; i++)
 	{
-		if (strlen(zip->names[i]) > strlen(dir))
+		if (strlen(zip->names[i]) > dirlen)
 		{
-			if (strncasecmp(zip->names[i], dir, strlen(dir)) == 0)
+			if (strncasecmp(zip->names[i], dir, dirlen) == 0)
 			{
 				temp = zip->names[i];
-				temp = (char *)(temp + strlen(dir));
+				temp = (char *)(temp + dirlen);
 				if (temp[0] != '\0')
 				{
 					if ((slash=Zip_FileNameHasSlash(temp)) > 0)
 					{
-						/* file is in a subdirectory, add this subdirectory if it doesn't exist in the list */
+						/* file is in a subdirectory, add this subdirectory if it doesn't exist in the list.
+						 * Archives list the files of a directory together, so search backwards and
+						 * stop at the first match to keep big archives from taking quadratic time */
 						flag = false;
 						for (j = files->nfiles-1; j > 0; j--)
 						{
 							if (strncasecmp(temp, files->names[j], slash+1) == 0)
+							{
 								flag = true;
+								break;
+							}
 						}
 						if (flag == false)
 						{
@@ -443,35 +449,18 @@ static char *ZIP_FirstFile(const char *filename, const char * const ppsExts[])
 
 /*-----------------------------------------------------------------------*/
 /**
- * Extract a file (filename) from a ZIP-file (uf), the number of 
- * bytes to uncompress is size. Returns a pointer to a buffer containing
- * the uncompressed data, or NULL.
+ * Extract the current file of a ZIP-file (uf), as selected by the caller
+ * with unzLocateFile(), the number of bytes to uncompress is size.
+ * The data is inflated straight into the returned buffer, or NULL is
+ * returned on error.
  */
-static void *ZIP_ExtractFile(unzFile uf, const char *filename, uLong size)
+static void *ZIP_ExtractFile(unzFile uf, uLong size)
 {
-	int err = UNZ_OK;
-	char filename_inzip[ZIP_PATH_MAX];
-	void* buf;
-	uInt size_buf;
-	unz_file_info file_info;
-
-
-	if (unzLocateFile(uf,filename, 0) != UNZ_OK)
-	{
-		Log_Printf(LOG_ERROR, "ZIP_ExtractFile: could not find file in archive\n");
-		return NULL;
-	}
-
-	err = unzGetCurrentFileInfo(uf,&file_info,filename_inzip,sizeof(filename_inzip),NULL,0,NULL,0);
-
-	if (err != UNZ_OK)
-	{
-		Log_Printf(LOG_ERROR, "ZIP_ExtractFile: could not get file info\n");
-		return NULL;
-	}
+	Uint8 *buf;
+	uLong done = 0;
+	int err;
 
-	size_buf = size;
-	buf = malloc(size_buf);
+	buf = malloc(size ? size : 1);
 	if (!buf)
 	{
 		perror("ZIP_ExtractFile");
@@ -486,21 +475,135 @@ static void *ZIP_ExtractFile(unzFile uf, const char *filename, uLong size)
 		return NULL;
 	}
 
-	do
+	while (done < size)
 	{
-		err = unzReadCurrentFile(uf,buf,size_buf);
-		if (err < 0)
+		err = unzReadCurrentFile(uf, buf + done, size - done);
+		if (err <= 0)
 		{
 			Log_Printf(LOG_ERROR, "ZIP_ExtractFile: could not read file\n");
+			free(buf);
 			return NULL;
 		}
+		done += err;
 	}
-	while (err > 0);
 
 	return buf;
 }
 
 
+/* Zipped .ST/.DIM image, inflated up to the accessed block on demand */
+#define ZIP_LAZY_BLOCK  (16*1024)
+
+typedef struct
+{
+	unzFile uf;			/* with the image file opened */
+	long nImageBytes;
+	long nInflated;			/* bytes inflated into the disk buffer */
+} ZIP_LAZY;
+
+/**
+ * Inflate the image up to the end of given block. The zip stream can
+ * only be read forward, but all blocks before it have been inflated
+ * on the way already.
+ */
+static bool ZIP_LoadBlock(void *pData, Uint8 *pBuffer, int nBlock, Uint8 *pLoaded)
+{
+	ZIP_LAZY *pLazy = pData;
+	long nEnd = (long)(nBlock + 1) * ZIP_LAZY_BLOCK;
+	int nRead, i;
+	bool bOk = true;
+
+	if (nEnd > pLazy->nImageBytes)
+		nEnd = pLazy->nImageBytes;
+
+	while (pLazy->nInflated < nEnd)
+	{
+		nRead = unzReadCurrentFile(pLazy->uf, pBuffer + pLazy->nInflated,
+		                           nEnd - pLazy->nInflated);
+		if (nRead <= 0)
+		{
+			Log_Printf(LOG_ERROR, "ZIP_LoadBlock: could not read file\n");
+			bOk = false;
+			break;
+		}
+		pLazy->nInflated += nRead;
+	}
+
+	for (i = 0; i <= nBlock && (long)(i + 1) * ZIP_LAZY_BLOCK <= pLazy->nInflated; i++)
+		pLoaded[i] = 1;
+	if (pLazy->nInflated == pLazy->nImageBytes)
+		pLoaded[nBlock] = 1;
+	return bOk;
+}
+
+static void ZIP_FreeLazy(void *pData)
+{
+	ZIP_LAZY *pLazy = pData;
+
+	unzCloseCurrentFile(pLazy->uf);
+	unzClose(pLazy->uf);
+	free(pLazy);
+}
+
+/**
+ * Set up inflating the (ImageSize bytes) .ST or .DIM image opened in
+ * given zip file into a new disk buffer on demand. Takes over the zip
+ * file in all cases. Return the buffer, or NULL on error.
+ */
+static Uint8 *ZIP_ReadDiskLazy(int Drive, unzFile uf, long *pImageSize, int nImageType)
+{
+	ZIP_LAZY *pLazy;
+	Uint8 *pDiskBuffer;
+	Uint8 DimHeader[32];
+	long nImageBytes = *pImageSize;
+
+	*pImageSize = 0;
+	if (unzOpenCurrentFile(uf) != UNZ_OK)
+	{
+		Log_Printf(LOG_ERROR, "ZIP_ReadDisk: could not open file\n");
+		unzClose(uf);
+		return NULL;
+	}
+	if (nImageType == FLOPPY_IMAGE_TYPE_DIM)
+	{
+		/* Skip DIM header */
+		nImageBytes -= sizeof(DimHeader);
+		if (nImageBytes <= 0 ||
+		    unzReadCurrentFile(uf, DimHeader, sizeof(DimHeader)) != sizeof(DimHeader))
+		{
+			unzCloseCurrentFile(uf);
+			unzClose(uf);
+			return NULL;
+		}
+	}
+
+	pDiskBuffer = calloc(1, nImageBytes);
+	pLazy = malloc(sizeof(*pLazy));
+	if (!pDiskBuffer || !pLazy)
+	{
+		perror("ZIP_ReadDisk");
+		free(pDiskBuffer);
+		free(pLazy);
+		unzCloseCurrentFile(uf);
+		unzClose(uf);
+		return NULL;
+	}
+	pLazy->uf = uf;
+	pLazy->nImageBytes = nImageBytes;
+	pLazy->nInflated = 0;
+	if (!Floppy_SetLazyImage(Drive, pDiskBuffer, pLazy, ZIP_LAZY_BLOCK,
+	                         (nImageBytes + ZIP_LAZY_BLOCK - 1) / ZIP_LAZY_BLOCK,
+	                         ZIP_LoadBlock, ZIP_FreeLazy))
+	{
+		free(pDiskBuffer);
+		return NULL;
+	}
+
+	*pImageSize = nImageBytes;
+	return pDiskBuffer;
+}
+
+
 /*-----------------------------------------------------------------------*/
 /**
  * Load disk image from a .ZIP archive into memory, set  the number
@@ -555,8 +658,16 @@ Uint8 *ZIP_ReadDisk(int Drive, const char *pszFileName, const char *pszZipPath,
 		return NULL;
 	}
 
+	/* plain disk images are inflated only when their tracks are accessed */
+	if (*pImageType == FLOPPY_IMAGE_TYPE_ST || *pImageType == FLOPPY_IMAGE_TYPE_DIM)
+	{
+		free(path);
+		*pImageSize = ImageSize;
+		return ZIP_ReadDiskLazy(Drive, uf, pImageSize, *pImageType);
+	}
+
 	/* extract to buf */
-	buf = ZIP_ExtractFile(uf, path, ImageSize);
+	buf = ZIP_ExtractFile(uf, ImageSize);
 
 	unzCloseCurrentFile(uf);
 	unzClose(uf);
@@ -583,22 +694,9 @@ Uint8 *ZIP_ReadDisk(int Drive, const char *pszFileName, const char *pszZipPath,
 		pDiskBuffer = buf;
 		break;
 	case FLOPPY_IMAGE_TYPE_MSA:
-		/* uncompress the MSA file */
-		pDiskBuffer = MSA_UnCompress(buf, (long *)&ImageSize);
-		free(buf);
-		buf = NULL;
-		break;
-	case FLOPPY_IMAGE_TYPE_DIM:
-		/* Skip DIM header */
-		ImageSize -= 32;
-		memmove(buf, buf+32, ImageSize);
-		/* return buffer */
-		pDiskBuffer = buf;
-		break;
-	case FLOPPY_IMAGE_TYPE_ST:
-		/* ST image => return buffer directly */
-		pDiskBuffer = buf;
-		break;
+		/* set up uncompressing the MSA tracks */
+		pDiskBuffer = MSA_UnCompress(Drive, buf, ImageSize, pImageSize);
+		return pDiskBuffer;
 	}
 	
 	if (pDiskBuffer)
@@ -656,7 +754,7 @@ Uint8 *ZIP_ReadFirstFile(const char *pszFileName, long *pImageSize, const char *
 	}
 
 	/* Extract to buffer */
-	pBuffer = ZIP_ExtractFile(uf, pszZipPath, file_info.uncompressed_size);
+	pBuffer = ZIP_ExtractFile(uf, file_info.uncompressed_size);
 
 	/* And close the file */
 	unzCloseCurrentFile(uf);
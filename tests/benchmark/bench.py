@@ -0,0 +1,177 @@
+#!/usr/bin/env python
+#
+# This program is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation; either version 2 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+"""
+Runs a fixed set of workloads headless under Hatari for a given number
+of emulated frames and collects their throughput into one JSON file:
+emulated VBLs per second, host (wall and CPU) time, peak RSS and the
+frame statistics counters (CPU/DSP instructions, blitter words, IO
+accesses, screen lines, audio samples, CycInt events).
+
+Each workload is started from a memory snapshot (<name>.sna) or a floppy
+image (<name>.st, .msa, .stx, .st.gz...) found in the workload directory,
+so that runs are reproducible.  Workloads without an image are skipped.
+The hard disk copy workload uses <name>/ subdirectory as GEMDOS drive.
+
+NOTE: To benchmark an uninstalled Hatari, give its path with -b, e.g.:
+	bench.py -b ../../build/src/hatari -t tos.img -o results.json images/
+"""
+
+import getopt, json, os, subprocess, sys, tempfile, time
+
+# name, Hatari machine options, description
+WORKLOADS = (
+    ("desktop",  ["--machine", "st"], "GEM desktop idle"),
+    ("blitter",  ["--machine", "ste", "--blitter", "on"], "blitter heavy demo"),
+    ("spec512",  ["--machine", "st", "--spec512", "1"], "raster / Spec512 demo"),
+    ("dmasound", ["--machine", "ste"], "STE DMA audio"),
+    ("dsp",      ["--machine", "falcon", "--dsp", "emu"], "Falcon DSP"),
+    ("hdcopy",   ["--machine", "st"], "hard disk copy"),
+)
+
+FLOPPY_EXTS = (".st", ".msa", ".stx", ".dim", ".ipf", ".st.gz", ".msa.gz", ".zip")
+
+# options common to all runs
+COMMON_OPTS = ["--headless", "on", "--fast-forward", "on", "--sound", "44100",
+               "--confirm-quit", "off", "--natfeats", "off"]
+
+
+def usage(msg=None):
+    name = os.path.basename(sys.argv[0])
+    print(__doc__)
+    print("Usage: %s [options] <workload directory>\n" % name)
+    print("Options:")
+    print("\t-h\t\tthis help")
+    print("\t-b <binary>\tHatari binary (default: hatari)")
+    print("\t-t <tos>\tTOS image to use")
+    print("\t-f <frames>\temulated frames per workload (default: 3000)")
+    print("\t-o <file>\tJSON output file (default: stdout)")
+    print("\t-w <names>\tcomma separated workloads to run (default: all)")
+    if msg:
+        print("\nERROR: %s!" % msg)
+    sys.exit(1)
+
+
+def find_image(imgdir, name):
+    "return (options, path) for the workload image, or (None, None)"
+    path = os.path.join(imgdir, name + ".sna")
+    if os.path.isfile(path):
+        return (["--memstate", path], path)
+    for ext in FLOPPY_EXTS:
+        path = os.path.join(imgdir, name + ext)
+        if os.path.isfile(path):
+            opts = ["--disk-a", path]
+            hddir = os.path.join(imgdir, name)
+            if os.path.isdir(hddir):
+                opts += ["--harddrive", hddir]
+            return (opts, path)
+    return (None, None)
+
+
+def run_workload(binary, tos, frames, imgdir, workload):
+    "run given workload, return its results dict or None"
+    name, machine, desc = workload
+    imgopts, path = find_image(imgdir, name)
+    if not imgopts:
+        sys.stderr.write("- %s: no image, skipped\n" % name)
+        return None
+
+    fd, resfile = tempfile.mkstemp(prefix="hatari-bench-", suffix=".json")
+    os.close(fd)
+    args = [binary] + COMMON_OPTS + machine + imgopts
+    if tos:
+        args += ["--tos", tos]
+    args += ["--run-vbls", str(frames), "--benchmark", resfile]
+
+    sys.stderr.write("- %s (%s)...\n" % (name, desc))
+    start = time.time()
+    try:
+        devnull = open(os.devnull, "w")
+        proc = subprocess.Popen(args, stdout=devnull, stderr=devnull)
+    except OSError as err:
+        usage("running '%s' failed: %s" % (binary, err))
+    # wait4() gives the resource usage of this child only
+    pid, status, rusage = os.wait4(proc.pid, 0)
+    elapsed = time.time() - start
+
+    result = {}
+    try:
+        with open(resfile) as f:
+            result = json.load(f)
+    except (IOError, ValueError):
+        sys.stderr.write("  ERROR: no results, exit status %d\n" % status)
+    os.remove(resfile)
+
+    result.update({
+        "workload": name,
+        "description": desc,
+        "image": os.path.basename(path),
+        "options": machine,
+        "exit_status": os.WEXITSTATUS(status) if os.WIFEXITED(status) else -1,
+        "process_seconds": round(elapsed, 3),
+        "process_peak_rss_kb": rusage.ru_maxrss,
+    })
+    if "vbl_per_second" in result:
+        sys.stderr.write("  %.1f VBL/s\n" % result["vbl_per_second"])
+    return result
+
+
+def main():
+    binary, tos, frames, outfile, names = "hatari", None, 3000, None, None
+    try:
+        longopts = ["help", "binary=", "tos=", "frames=", "output=", "workloads="]
+        opts, args = getopt.getopt(sys.argv[1:], "hb:t:f:o:w:", longopts)
+    except getopt.GetoptError as err:
+        usage(str(err))
+    for opt, arg in opts:
+        if opt in ("-h", "--help"):
+            usage()
+        elif opt in ("-b", "--binary"):
+            binary = arg
+        elif opt in ("-t", "--tos"):
+            tos = arg
+        elif opt in ("-f", "--frames"):
+            try:
+                frames = int(arg)
+            except ValueError:
+                frames = 0
+            if frames <= 0:
+                usage("invalid frame count '%s'" % arg)
+        elif opt in ("-o", "--output"):
+            outfile = arg
+        elif opt in ("-w", "--workloads"):
+            names = arg.split(",")
+    if len(args) != 1 or not os.path.isdir(args[0]):
+        usage("workload directory missing")
+
+    workloads = [w for w in WORKLOADS if not names or w[0] in names]
+    if not workloads:
+        usage("no such workloads: %s" % ",".join(names))
+
+    results = []
+    for workload in workloads:
+        result = run_workload(binary, tos, frames, args[0], workload)
+        if result:
+            results.append(result)
+
+    report = {"frames": frames, "tos": tos and os.path.basename(tos),
+              "results": results}
+    text = json.dumps(report, indent=2, sort_keys=True) + "\n"
+    if outfile:
+        with open(outfile, "w") as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+    return 0 if results else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
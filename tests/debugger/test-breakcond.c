@@ -115,15 +115,17 @@ int main(int argc, const char *argv[])
 		"( $200 ) . b > 200", /* byte access to avoid endianess */
 		"pc < $50000 && pc > $60000",
 		"pc > $50000 && pc < $54000",
-#define FAILING_BC_TEST_MATCHES 4
+		"pc = $50000",
+#define FAILING_BC_TEST_MATCHES 5
 		"pc > $50000 && pc < $60000",
+		"d0 = 4 && pc = $58000",
 		"( $200 ) . b > ( 200 ) . b",
 		"d0 = d1",
 		"a0 = pc",
 		NULL
 	};
 	const char *test;
-	char testidx[2] = "1";
+	char testidx[4] = "1";
 	int i, j, tests = 0, errors = 0;
 	int remaining_matches;
 	bool use_dsp;
@@ -193,7 +195,9 @@ int main(int argc, const char *argv[])
 	SetCpuRegister("d1", 4);
 	/* !match: "pc < $50000  &&  pc > $60000"
 	 * !match: "pc < $50000  &&  pc > $54000"
+	 * !match: "pc = $50000"
 	 *  match: "pc > $50000  &&  pc < $60000"
+	 *  match: "d0 = 4  &&  pc = $58000"
 	 */
 	regs.pc = 0x58000;
 	/* !match: "d0 = a0"
@@ -218,7 +222,7 @@ int main(int argc, const char *argv[])
 			fprintf(stderr, "WARNING: canonized breakpoint form didn't match\n");
 			errors++;
 		}
-		testidx[0] = '0' + i;
+		snprintf(testidx, sizeof(testidx), "%d", i);
 		BreakCond_Command(testidx, use_dsp); /* remove given */
 	}
 	remaining_matches = BreakCond_BreakPointCount(use_dsp);
@@ -246,7 +250,7 @@ int main(int argc, const char *argv[])
 
 		while ((i = BreakCond_MatchDsp())) {
 			fprintf(stderr, "Removing matching DSP breakpoint.\n");
-			testidx[0] = '0' + i;
+			snprintf(testidx, sizeof(testidx), "%d", i);
 			BreakCond_Command(testidx, use_dsp); /* remove given */
 		}
 
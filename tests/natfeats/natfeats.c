@@ -22,7 +22,8 @@
 static int nf_ok;
 
 /* handles for NF features that may be used more frequently */
-static long nfid_print, nfid_debugger, nfid_fastforward;
+static long nfid_print, nfid_debugger, nfid_fastforward, nfid_screenshot;
+static long nfid_memcpy, nfid_memset, nfid_crc32, nfid_adler32;
 
 
 /* API documentation is in natfeats.h header */
@@ -38,6 +39,11 @@ int nf_init(void)
 		nfid_print = nf_id("NF_STDERR");
 		nfid_debugger = nf_id("NF_DEBUGGER");
 		nfid_fastforward = nf_id("NF_FASTFORWARD");
+		nfid_screenshot = nf_id("NF_SCREENSHOT");
+		nfid_memcpy = nf_id("NF_MEMCPY");
+		nfid_memset = nf_id("NF_MEMSET");
+		nfid_crc32 = nf_id("NF_CRC32");
+		nfid_adler32 = nf_id("NF_ADLER32");
 	} else {
 		Cconws("Native Features initialization failed!\r\n");
 	}
@@ -74,6 +80,16 @@ long nf_fastforward(long enabled)
 	}
 }
 
+long nf_screenshot(void)
+{
+	if (nfid_screenshot) {
+		return nf_call(nfid_screenshot);
+	} else {
+		Cconws("NF_SCREENSHOT unavailable!\r\n");
+		return 0;
+	}
+}
+
 void nf_shutdown(void)
 {
 	long id;
@@ -99,6 +115,101 @@ void nf_exit(long exitval)
 	}
 }
 
+long nf_batch(char *buffer, long size)
+{
+	long id;
+	if(nf_ok && (id = nf_id("NF_BATCH"))) {
+		return nf_call(id, buffer, size);
+	} else {
+		Cconws("NF_BATCH unavailable!\r\n");
+		return 0;
+	}
+}
+
+long nf_memcpy(void *dst, const void *src, long size)
+{
+	char *d = dst;
+	const char *s = src;
+	long i;
+
+	if (nfid_memcpy) {
+		return nf_call(nfid_memcpy, dst, src, size);
+	}
+	if (d < s) {
+		for (i = 0; i < size; i++)
+			d[i] = s[i];
+	} else {
+		for (i = size; i > 0; i--)
+			d[i-1] = s[i-1];
+	}
+	return size;
+}
+
+long nf_memset(void *dst, int value, long size)
+{
+	char *d = dst;
+	long i;
+
+	if (nfid_memset) {
+		return nf_call(nfid_memset, dst, (long)value, size);
+	}
+	for (i = 0; i < size; i++)
+		d[i] = value;
+	return size;
+}
+
+unsigned long nf_crc32(const void *buf, long size, unsigned long crc)
+{
+	const unsigned char *b = buf;
+	int bit;
+
+	if (nfid_crc32) {
+		return nf_call(nfid_crc32, buf, size, crc);
+	}
+	crc = ~crc;
+	while (size-- > 0) {
+		crc ^= *b++;
+		for (bit = 0; bit < 8; bit++)
+			crc = (crc >> 1) ^ (0xedb88320UL & -(crc & 1));
+	}
+	return ~crc & 0xffffffffUL;
+}
+
+unsigned long nf_adler32(const void *buf, long size, unsigned long adler)
+{
+	const unsigned char *b = buf;
+	unsigned long s1 = adler & 0xffff, s2 = (adler >> 16) & 0xffff;
+
+	if (nfid_adler32) {
+		return nf_call(nfid_adler32, buf, size, adler);
+	}
+	while (size-- > 0) {
+		s1 = (s1 + *b++) % 65521;
+		s2 = (s2 + s1) % 65521;
+	}
+	return (s2 << 16) | s1;
+}
+
+long nf_deflate(void *dst, long dstsize, const void *src, long srcsize, int level)
+{
+	long id;
+	if(nf_ok && (id = nf_id("NF_DEFLATE"))) {
+		return nf_call(id | level, dst, dstsize, src, srcsize);
+	} else {
+		return -1;
+	}
+}
+
+long nf_inflate(void *dst, long dstsize, const void *src, long srcsize)
+{
+	long id;
+	if(nf_ok && (id = nf_id("NF_INFLATE"))) {
+		return nf_call(id, dst, dstsize, src, srcsize);
+	} else {
+		return -1;
+	}
+}
+
 #ifdef TEST
 
 /* show emulator name */
@@ -55,6 +55,13 @@ extern long nf_debugger(void);
  */
 extern long nf_fastforward(long enabled);
 
+/**
+ * save screenshot of the next emulated frame, works also
+ * in headless mode where frames are otherwise not drawn
+ * (Hatari specific)
+ */
+extern long nf_screenshot(void);
+
 /**
  * terminate the execution of the emulation if possible
  * (runs in supervisor mode)
@@ -67,4 +74,46 @@ extern void nf_shutdown(void);
  */
 extern void nf_exit(long exitval);
 
+/**
+ * get the command line of the next job given with Hatari's
+ * --batch option into buffer
+ * (Hatari specific)
+ * returns its length, 0 when there are no more jobs and -1 when
+ * it should be called again after Vsync().  A job runner (e.g. in
+ * AUTO folder) runs each job and passes its status to nf_exit(),
+ * after which Hatari brings the machine back to the state it had
+ * on the first call and the runner gets the next job.
+ */
+extern long nf_batch(char *buffer, long size);
+
+/**
+ * memory copy (areas may overlap) and fill, done by the emulator
+ * when Hatari's --natfeats-bulk option enables it, otherwise here
+ * (Hatari specific)
+ * returns size
+ */
+extern long nf_memcpy(void *dst, const void *src, long size);
+extern long nf_memset(void *dst, int value, long size);
+
+/**
+ * update CRC32 (start with 0) or Adler-32 (start with 1) checksum
+ * with given data, done by the emulator when Hatari's --natfeats-bulk
+ * option enables it, otherwise here
+ * (Hatari specific)
+ * returns the updated checksum
+ */
+extern unsigned long nf_crc32(const void *buf, long size, unsigned long crc);
+extern unsigned long nf_adler32(const void *buf, long size, unsigned long adler);
+
+/**
+ * compress data to zlib format with given level (0 = default),
+ * or decompress zlib/gzip format data, with Hatari's --natfeats-bulk
+ * option enabled
+ * (Hatari specific)
+ * returns the result size, or -1 if that's not enabled, the data is
+ * invalid or the result doesn't fit to the destination
+ */
+extern long nf_deflate(void *dst, long dstsize, const void *src, long srcsize, int level);
+extern long nf_inflate(void *dst, long dstsize, const void *src, long srcsize);
+
 #endif /* _NATFEAT_H */
@@ -171,7 +171,8 @@ To convert dot files e.g. to SVG, use:
 ('dot' tool is in Graphviz package.)
 """
 from copy import deepcopy
-from bisect import bisect_right
+from bisect import bisect_right, insort
+from operator import add
 import getopt, os, re, sys
 
 # PC address that was undefined during profiling,
@@ -297,8 +298,7 @@ class FunctionStats:
             # function call count is same as instruction
             # count for its first instruction
             cost[0] = values[1]
-        for i in range(1, len(cost)):
-            cost[i] += values[i]
+        cost[1:] = map(add, cost[1:], values[1:])
 
     def __repr__(self):
         "return printable current function instruction state"
@@ -528,8 +528,14 @@ class ProfileSymbols(Output):
         "add absolute symbol and return its name in case it got renamed"
         if self._check_symbol(addr, name, self.symbols):
             name = self._rename_symbol(addr, name)
+            if addr not in self.symbols:
+                if self.symbols_need_sort or self.symbols_sorted is None:
+                    self.symbols_need_sort = True
+                else:
+                    # profile addresses increase, so this is normally
+                    # an append and doesn't need whole list to be resorted
+                    insort(self.symbols_sorted, addr)
             self.symbols[addr] = name
-            self.symbols_need_sort = True
         return name
 
     def get_symbol(self, addr):
@@ -1052,7 +1058,7 @@ class EmulatorProfile(Output):
                     self.error_exit("memory addresses are not in order on line %d" % self.linenro)
                 prev_addr = addr
                 # counts[0] will be inferred call count
-                counts = [0] + [int(x) for x in match.group(2).split(',')]
+                counts = [0] + list(map(int, match.group(2).split(',')))
                 function = self._parse_line(function, addr, counts, discontinued)
                 if self.callgrind:
                     self.callgrind.output_line(function, counts, self.linenro)